@@ -23,6 +23,7 @@ typedef struct {
     PyHamtNode *h_root;
     PyObject *h_weakreflist;
     Py_ssize_t h_count;
+    Py_hash_t h_hash;
 } PyHamtObject;
 
 
@@ -68,6 +69,7 @@ PyAPI_DATA(PyTypeObject) _PyHamt_CollisionNode_Type;
 PyAPI_DATA(PyTypeObject) _PyHamtKeys_Type;
 PyAPI_DATA(PyTypeObject) _PyHamtValues_Type;
 PyAPI_DATA(PyTypeObject) _PyHamtItems_Type;
+PyAPI_DATA(PyTypeObject) _PyHamtMutation_Type;
 
 
 /* Create a new HAMT immutable mapping. */
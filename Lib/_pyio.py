@@ -26,6 +26,14 @@
 # open() uses st_blksize whenever we can
 DEFAULT_BUFFER_SIZE = 8 * 1024  # bytes
 
+# Maximum number of buffers passed to a single os.writev() call
+try:
+    _IOV_MAX = os.sysconf('SC_IOV_MAX')
+except (AttributeError, ValueError, OSError):
+    _IOV_MAX = -1
+if _IOV_MAX <= 0:
+    _IOV_MAX = 16
+
 # NOTE: Base classes defined here are registered with the "official" ABCs
 # defined in io.py. We don't use real inheritance though, because we don't want
 # to inherit the C implementations.
@@ -1296,6 +1304,74 @@ def write(self, b):
                         raise BlockingIOError(e.errno, e.strerror, written)
             return written
 
+    def writelines(self, lines):
+        """Write a list of lines to the stream.
+
+        Line separators are not added, so it is usual for each of the lines
+        provided to have a line separator at the end.  Lines that do not fit
+        in the buffer are written along with the buffered data in a single
+        vectored write, without copying them into the buffer.
+        """
+        if (type(self) is not BufferedWriter or type(self.raw) is not FileIO
+                or not hasattr(os, 'writev')):
+            return super().writelines(lines)
+        if self.closed:
+            raise ValueError("write to closed file")
+        # Check every line before writing anything.
+        views = []
+        for line in lines:
+            if isinstance(line, str):
+                raise TypeError("can't write str to binary stream")
+            views.append(memoryview(line).cast('B'))
+        written = 0
+        with self._write_lock:
+            if self.closed:
+                raise ValueError("write to closed file")
+            total = sum(map(len, views))
+            if len(self._write_buf) + total > self.buffer_size:
+                written = self._writev_unlocked(views)
+        # Write whatever was not written above the regular way.
+        for view in views:
+            if written >= len(view):
+                written -= len(view)
+                continue
+            self.write(view[written:])
+            written = 0
+
+    def _writev_unlocked(self, views):
+        # Write the buffered data followed by views with os.writev().
+        # Return how many bytes of views were written: less than their
+        # total size only if the file would block.
+        fd = self.raw.fileno()
+        pending = len(self._write_buf)
+        buffers = [view for view in views if view]
+        if pending:
+            buffers.insert(0, self._write_buf)
+        written = 0
+        while buffers:
+            try:
+                n = os.writev(fd, buffers[:_IOV_MAX])
+            except BlockingIOError:
+                break
+            if not n:
+                break
+            if pending:
+                # The buffered data goes out first.
+                k = min(n, pending)
+                del self._write_buf[:k]
+                pending -= k
+                n -= k
+                if pending:
+                    continue
+                del buffers[0]
+            written += n
+            while buffers and n >= len(buffers[0]):
+                n -= len(buffers[0])
+                del buffers[0]
+            if n:
+                buffers[0] = buffers[0][n:]
+        return written
+
     def truncate(self, pos=None):
         with self._write_lock:
             self._flush_unlocked()
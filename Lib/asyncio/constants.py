@@ -19,6 +19,22 @@
 # that don't support sendfile, or for TLS connections.
 SENDFILE_FALLBACK_READBUFFER_SIZE = 1024 * 256
 
+# Maximum number of datagrams moved per recvmmsg()/sendmmsg() call by
+# datagram transports, and the size of each receive buffer (large enough
+# for any UDP payload).  Receive buffers are added only while reads keep
+# filling all of them, so a quiet transport holds a single buffer.
+DATAGRAM_BATCH_SIZE = 8
+DATAGRAM_RECV_BUFFER_SIZE = 64 * 1024
+
+# Socket transports queue read-only buffers of at least this size without
+# copying them; smaller or mutable data is copied and coalesced.
+WRITE_COALESCE_SIZE = 4 * 1024
+
+# Socket transports send read-only buffers of at least this size with
+# MSG_ZEROCOPY where available.  Below it, pinning the pages and handling
+# the completion costs more than copying.
+ZEROCOPY_SEND_THRESHOLD = 64 * 1024
+
 # The enum should be here to break circular dependencies between
 # base_events and sslproto
 class _SendfileMode(enum.Enum):
@@ -98,7 +98,7 @@ def _run(self):
 class TimerHandle(Handle):
     """Object returned by timed callback registration methods."""
 
-    __slots__ = ['_scheduled', '_when']
+    __slots__ = ['_scheduled', '_when', '_heap_handle']
 
     def __init__(self, when, callback, args, loop, context=None):
         assert when is not None
@@ -107,6 +107,7 @@ def __init__(self, when, callback, args, loop, context=None):
             del self._source_traceback[-1]
         self._when = when
         self._scheduled = False
+        self._heap_handle = None
 
     def _repr_info(self):
         info = super()._repr_info()
@@ -118,27 +119,27 @@ def __hash__(self):
         return hash(self._when)
 
     def __lt__(self, other):
-        if isinstance(other, TimerHandle):
+        if isinstance(other, _PyTimerHandle):
             return self._when < other._when
         return NotImplemented
 
     def __le__(self, other):
-        if isinstance(other, TimerHandle):
+        if isinstance(other, _PyTimerHandle):
             return self._when < other._when or self.__eq__(other)
         return NotImplemented
 
     def __gt__(self, other):
-        if isinstance(other, TimerHandle):
+        if isinstance(other, _PyTimerHandle):
             return self._when > other._when
         return NotImplemented
 
     def __ge__(self, other):
-        if isinstance(other, TimerHandle):
+        if isinstance(other, _PyTimerHandle):
             return self._when > other._when or self.__eq__(other)
         return NotImplemented
 
     def __eq__(self, other):
-        if isinstance(other, TimerHandle):
+        if isinstance(other, _PyTimerHandle):
             return (self._when == other._when and
                     self._callback == other._callback and
                     self._args == other._args and
@@ -787,6 +788,8 @@ def set_child_watcher(watcher):
 
 
 # Alias pure-Python implementations for testing purposes.
+_PyHandle = Handle
+_PyTimerHandle = TimerHandle
 _py__get_running_loop = _get_running_loop
 _py__set_running_loop = _set_running_loop
 _py_get_running_loop = get_running_loop
@@ -807,3 +810,13 @@ def set_child_watcher(watcher):
     _c__set_running_loop = _set_running_loop
     _c_get_running_loop = get_running_loop
     _c_get_event_loop = get_event_loop
+
+
+try:
+    from _asyncio import Handle, TimerHandle
+except ImportError:
+    pass
+else:
+    # Alias C implementations for testing purposes.
+    _CHandle = Handle
+    _CTimerHandle = TimerHandle
@@ -6,6 +6,7 @@
 
 __all__ = 'BaseProactorEventLoop',
 
+import errno
 import io
 import os
 import socket
@@ -159,7 +160,13 @@ def _call_connection_lost(self, exc):
             # just close our end.  First calling shutdown() seems to
             # cure it, but maybe using DisconnectEx() would be better.
             if hasattr(self._sock, 'shutdown'):
-                self._sock.shutdown(socket.SHUT_RDWR)
+                try:
+                    self._sock.shutdown(socket.SHUT_RDWR)
+                except OSError as exc:
+                    # On Linux, shutdown() fails with ENOTCONN if the peer
+                    # has already closed the connection.
+                    if exc.errno != errno.ENOTCONN:
+                        raise
             self._sock.close()
             self._sock = None
             server = self._server
@@ -764,10 +771,13 @@ def _make_self_pipe(self):
         self._csock.setblocking(False)
         self._internal_fds += 1
 
+    def _process_self_data(self, data):
+        pass
+
     def _loop_self_reading(self, f=None):
         try:
             if f is not None:
-                f.result()  # may raise
+                self._process_self_data(f.result())  # may raise
             if self._self_reading_future is not f:
                 # When we scheduled this Future, we assigned it to
                 # _self_reading_future. If it's not there now, something has
@@ -9,8 +9,11 @@
 import collections
 import errno
 import functools
+import itertools
+import os
 import selectors
 import socket
+import struct
 import warnings
 import weakref
 try:
@@ -29,6 +32,32 @@
 from .log import logger
 
 
+# Datagram transports move several datagrams per system call when the
+# platform provides recvmmsg() and sendmmsg().
+_HAS_MMSG = (hasattr(socket.socket, 'recvmmsg_into') and
+             hasattr(socket.socket, 'sendmmsg'))
+
+# Socket transports gather queued buffers with sendmsg() instead of
+# joining them.
+_HAS_SENDMSG = hasattr(socket.socket, 'sendmsg')
+try:
+    _SC_IOV_MAX = os.sysconf('SC_IOV_MAX')
+except (AttributeError, ValueError, OSError):
+    _SC_IOV_MAX = -1
+if _SC_IOV_MAX <= 0:
+    _SC_IOV_MAX = 16
+
+_HAS_ZEROCOPY = (hasattr(socket, 'MSG_ZEROCOPY') and
+                 hasattr(socket, 'SO_ZEROCOPY') and _HAS_SENDMSG)
+if _HAS_ZEROCOPY:
+    # MSG_ZEROCOPY completions are struct sock_extended_err records
+    # (<linux/errqueue.h>) read from the socket error queue.
+    _SOCK_EXTENDED_ERR = struct.Struct('=IBBBBII')
+    _SO_EE_ORIGIN_ZEROCOPY = 5
+    _SO_EE_CODE_ZEROCOPY_COPIED = 1
+    _ZEROCOPY_ANCBUFSIZE = socket.CMSG_SPACE(64)
+
+
 def _test_selector_event(selector, fd, event):
     # Test if the selector is monitoring 'event' events
     # for the file descriptor 'fd'.
@@ -40,6 +69,47 @@ def _test_selector_event(selector, fd, event):
         return bool(key.events & event)
 
 
+def _drain_zerocopy_completions(sock, pending):
+    """Release the buffers of completed MSG_ZEROCOPY sends.
+
+    *pending* maps send sequence numbers to the buffers the kernel may
+    still read.  Return True if the kernel reported that it copied the
+    data anyway.
+    """
+    copied = False
+    while pending:
+        try:
+            _, ancdata, _, _ = sock.recvmsg(0, _ZEROCOPY_ANCBUFSIZE,
+                                            socket.MSG_ERRQUEUE)
+        except OSError:
+            break
+        for _, _, cmsg_data in ancdata:
+            if len(cmsg_data) < _SOCK_EXTENDED_ERR.size:
+                continue
+            _, origin, _, code, _, first, last = (
+                _SOCK_EXTENDED_ERR.unpack_from(cmsg_data))
+            if origin != _SO_EE_ORIGIN_ZEROCOPY:
+                continue
+            if code & _SO_EE_CODE_ZEROCOPY_COPIED:
+                copied = True
+            # A completion covers an inclusive range of sequence numbers,
+            # which wrap around at 2**32.
+            for i in range(((last - first) & 0xFFFFFFFF) + 1):
+                pending.pop((first + i) & 0xFFFFFFFF, None)
+    return copied
+
+
+def _close_after_zerocopy(loop, sock, pending, delay=0.001):
+    # Poll the error queue of a closed transport's socket until the kernel
+    # is done with its MSG_ZEROCOPY buffers, then close it.
+    _drain_zerocopy_completions(sock, pending)
+    if pending and not loop.is_closed():
+        loop.call_later(delay, _close_after_zerocopy, loop, sock, pending,
+                        min(delay * 2, 1.0))
+    else:
+        sock.close()
+
+
 def _check_ssl_socket(sock):
     if ssl is not None and isinstance(sock, ssl.SSLSocket):
         raise TypeError("Socket cannot be of type SSLSocket")
@@ -756,6 +826,7 @@ def _add_reader(self, fd, callback, *args):
 
 class _SelectorSocketTransport(_SelectorTransport):
 
+    _buffer_factory = collections.deque
     _start_tls_compatible = True
     _sendfile_compatible = constants._SendfileMode.TRY_NATIVE
 
@@ -767,6 +838,14 @@ def __init__(self, loop, sock, protocol, waiter=None,
         self._eof = False
         self._paused = False
         self._empty_waiter = None
+        self._buffer_size = 0
+        # MSG_ZEROCOPY state: None until the first large write tries to
+        # enable SO_ZEROCOPY, then True or False.
+        self._zerocopy = (None if _HAS_ZEROCOPY and
+                          sock.family in (socket.AF_INET, socket.AF_INET6)
+                          else False)
+        self._zerocopy_seq = 0
+        self._zerocopy_pending = {}
 
         # Disable the Nagle algorithm -- small writes will be
         # sent without waiting for the TCP ACK.  This generally
@@ -810,6 +889,8 @@ def resume_reading(self):
             logger.debug("%r resumes reading", self)
 
     def _read_ready(self):
+        if self._zerocopy_pending:
+            self._release_zerocopy_buffers()
         self._read_ready_cb()
 
     def _read_ready__get_buffer(self):
@@ -915,7 +996,7 @@ def write(self, data):
         if not self._buffer:
             # Optimization: try to send now.
             try:
-                n = self._sock.send(data)
+                n = self._send(data)
             except (BlockingIOError, InterruptedError):
                 pass
             except (SystemExit, KeyboardInterrupt):
@@ -924,23 +1005,127 @@ def write(self, data):
                 self._fatal_error(exc, 'Fatal write error on socket transport')
                 return
             else:
-                data = data[n:]
+                data = memoryview(data).cast('B')[n:]
                 if not data:
                     return
             # Not all was written; register write handler.
             self._loop._add_writer(self._sock_fd, self._write_ready)
 
         # Add it to the buffer.
-        self._buffer.extend(data)
+        self._buffer_append(data)
         self._maybe_pause_protocol()
 
+    def writelines(self, list_of_data):
+        list_of_data = list(list_of_data)
+        for data in list_of_data:
+            if not isinstance(data, (bytes, bytearray, memoryview)):
+                raise TypeError(f'data argument must be a bytes-like object, '
+                                f'not {type(data).__name__!r}')
+        if self._eof:
+            raise RuntimeError('Cannot call writelines() after write_eof()')
+        if self._empty_waiter is not None:
+            raise RuntimeError('unable to writelines; sendfile is in progress')
+        list_of_data = [data for data in list_of_data if data]
+        if not list_of_data:
+            return
+
+        if self._conn_lost:
+            if self._conn_lost >= constants.LOG_THRESHOLD_FOR_CONNLOST_WRITES:
+                logger.warning('socket.send() raised exception.')
+            self._conn_lost += 1
+            return
+
+        # Queue the buffers and gather them into as few sends as possible,
+        # rather than joining them first.
+        was_empty = not self._buffer
+        for data in list_of_data:
+            self._buffer_append(data)
+        if was_empty:
+            self._write_ready()
+            if self._buffer:
+                self._loop._add_writer(self._sock_fd, self._write_ready)
+        self._maybe_pause_protocol()
+
+    def _buffer_append(self, data):
+        # Large read-only buffers are queued as they are.  Anything else is
+        # copied, since the caller may reuse a mutable buffer once write()
+        # returns; small writes are coalesced into the last chunk.
+        buffer = self._buffer
+        view = memoryview(data)
+        if not view.c_contiguous:
+            view = memoryview(view.tobytes())
+        if view.readonly and view.nbytes >= constants.WRITE_COALESCE_SIZE:
+            buffer.append(view.cast('B'))
+        elif buffer and type(buffer[-1]) is bytearray:
+            buffer[-1] += view
+        else:
+            buffer.append(bytearray(view))
+        self._buffer_size += view.nbytes
+
+    def _consume_buffer(self, n):
+        self._buffer_size -= n
+        buffer = self._buffer
+        while n:
+            data = buffer[0]
+            size = len(data)
+            if size > n:
+                if type(data) is bytearray:
+                    del data[:n]
+                else:
+                    buffer[0] = data[n:]
+                break
+            buffer.popleft()
+            n -= size
+
+    def _send(self, data):
+        if (self._zerocopy is not False and
+                len(data) >= constants.ZEROCOPY_SEND_THRESHOLD and
+                (type(data) is bytes or
+                 (type(data) is memoryview and data.readonly))):
+            return self._send_zerocopy(data)
+        return self._sock.send(data)
+
+    def _send_zerocopy(self, data):
+        if self._zerocopy is None:
+            try:
+                self._sock.setsockopt(socket.SOL_SOCKET, socket.SO_ZEROCOPY, 1)
+            except OSError:
+                self._zerocopy = False
+                return self._sock.send(data)
+            self._zerocopy = True
+        try:
+            n = self._sock.send(data, socket.MSG_ZEROCOPY)
+        except OSError as exc:
+            if exc.errno != errno.ENOBUFS:
+                raise
+            # Pinning the pages exceeded the socket option memory limit.
+            return self._sock.send(data)
+        if n:
+            # The kernel reads the data until the completion arrives on the
+            # error queue: keep the buffer alive until then.
+            self._zerocopy_pending[self._zerocopy_seq] = data
+            self._zerocopy_seq = (self._zerocopy_seq + 1) & 0xFFFFFFFF
+        return n
+
+    def _release_zerocopy_buffers(self):
+        if _drain_zerocopy_completions(self._sock, self._zerocopy_pending):
+            # The kernel copied the data (e.g. over loopback), so zero-copy
+            # only adds overhead on this connection.
+            self._zerocopy = False
+
     def _write_ready(self):
         assert self._buffer, 'Data should not be empty'
 
         if self._conn_lost:
             return
+        if self._zerocopy_pending:
+            self._release_zerocopy_buffers()
         try:
-            n = self._sock.send(self._buffer)
+            if len(self._buffer) == 1 or not _HAS_SENDMSG:
+                n = self._send(self._buffer[0])
+            else:
+                n = self._sock.sendmsg(
+                    itertools.islice(self._buffer, _SC_IOV_MAX))
         except (BlockingIOError, InterruptedError):
             pass
         except (SystemExit, KeyboardInterrupt):
@@ -948,12 +1133,13 @@ def _write_ready(self):
         except BaseException as exc:
             self._loop._remove_writer(self._sock_fd)
             self._buffer.clear()
+            self._buffer_size = 0
             self._fatal_error(exc, 'Fatal write error on socket transport')
             if self._empty_waiter is not None:
                 self._empty_waiter.set_exception(exc)
         else:
             if n:
-                del self._buffer[:n]
+                self._consume_buffer(n)
             self._maybe_resume_protocol()  # May append to buffer.
             if not self._buffer:
                 self._loop._remove_writer(self._sock_fd)
@@ -974,7 +1160,26 @@ def write_eof(self):
     def can_write_eof(self):
         return True
 
+    def get_write_buffer_size(self):
+        return self._buffer_size
+
+    def _force_close(self, exc):
+        if not self._conn_lost:
+            self._buffer_size = 0
+        super()._force_close(exc)
+
     def _call_connection_lost(self, exc):
+        if self._zerocopy_pending:
+            # The kernel may still read the buffers of unacknowledged
+            # MSG_ZEROCOPY sends: keep them, and a duplicate of the socket
+            # to collect the completions, until it is done.
+            try:
+                sock = self._sock.dup()
+            except OSError:
+                pass
+            else:
+                _close_after_zerocopy(self._loop, sock,
+                                      self._zerocopy_pending)
         super()._call_connection_lost(exc)
         if self._empty_waiter is not None:
             self._empty_waiter.set_exception(
@@ -1000,6 +1205,11 @@ def __init__(self, loop, sock, protocol, address=None,
                  waiter=None, extra=None):
         super().__init__(loop, sock, protocol, extra)
         self._address = address
+        # Batched I/O is limited to UDP, where every datagram fits in a
+        # DATAGRAM_RECV_BUFFER_SIZE buffer.
+        self._batch_io = (_HAS_MMSG and
+                          sock.family in (socket.AF_INET, socket.AF_INET6))
+        self._recv_views = None
         self._loop.call_soon(self._protocol.connection_made, self)
         # only start reading when connection_made() has been called
         self._loop.call_soon(self._add_reader,
@@ -1015,6 +1225,9 @@ def get_write_buffer_size(self):
     def _read_ready(self):
         if self._conn_lost:
             return
+        if self._batch_io:
+            self._read_ready_batched()
+            return
         try:
             data, addr = self._sock.recvfrom(self.max_size)
         except (BlockingIOError, InterruptedError):
@@ -1028,6 +1241,54 @@ def _read_ready(self):
         else:
             self._protocol.datagram_received(data, addr)
 
+    def _recv_buffer_size(self):
+        # Like recvfrom(max_size): a datagram longer than max_size is
+        # truncated, and no UDP datagram needs more than
+        # DATAGRAM_RECV_BUFFER_SIZE.
+        return min(self.max_size, constants.DATAGRAM_RECV_BUFFER_SIZE)
+
+    def _read_ready_batched(self):
+        views = self._recv_views
+        if views is None:
+            views = self._recv_views = [
+                memoryview(bytearray(self._recv_buffer_size()))]
+        try:
+            received = self._sock.recvmmsg_into(views)
+        except (BlockingIOError, InterruptedError):
+            return
+        except OSError as exc:
+            self._protocol.error_received(exc)
+            return
+        except (SystemExit, KeyboardInterrupt):
+            raise
+        except BaseException as exc:
+            self._fatal_error(exc, 'Fatal read error on datagram transport')
+            return
+        for view, (nbytes, addr) in zip(views, received):
+            try:
+                self._protocol.datagram_received(bytes(view[:nbytes]), addr)
+            except (SystemExit, KeyboardInterrupt):
+                raise
+            except BaseException as exc:
+                # Report the error as an unbatched read would, and still
+                # deliver the rest of the batch.
+                self._loop.call_exception_handler({
+                    'message': 'Exception in datagram_received()',
+                    'exception': exc,
+                    'transport': self,
+                    'protocol': self._protocol,
+                })
+            if self._conn_lost:
+                # The protocol closed the transport.
+                return
+        if len(received) == len(views):
+            # More datagrams may be queued: double the batch, up to
+            # DATAGRAM_BATCH_SIZE buffers.
+            size = self._recv_buffer_size()
+            for _ in range(min(len(views),
+                               constants.DATAGRAM_BATCH_SIZE - len(views))):
+                views.append(memoryview(bytearray(size)))
+
     def sendto(self, data, addr=None):
         if not isinstance(data, (bytes, bytearray, memoryview)):
             raise TypeError(f'data argument must be a bytes-like object, '
@@ -1072,28 +1333,63 @@ def sendto(self, data, addr=None):
         self._maybe_pause_protocol()
 
     def _sendto_ready(self):
+        if self._batch_io:
+            if not self._send_buffered_batched():
+                return
+        else:
+            while self._buffer:
+                data, addr = self._buffer.popleft()
+                try:
+                    if self._extra['peername']:
+                        self._sock.send(data)
+                    else:
+                        self._sock.sendto(data, addr)
+                except (BlockingIOError, InterruptedError):
+                    self._buffer.appendleft((data, addr))  # Try again later.
+                    break
+                except OSError as exc:
+                    self._protocol.error_received(exc)
+                    return
+                except (SystemExit, KeyboardInterrupt):
+                    raise
+                except BaseException as exc:
+                    self._fatal_error(
+                        exc, 'Fatal write error on datagram transport')
+                    return
+
+        self._maybe_resume_protocol()  # May append to buffer.
+        if not self._buffer:
+            self._loop._remove_writer(self._sock_fd)
+            if self._closing:
+                self._call_connection_lost(None)
+
+    def _send_buffered_batched(self):
+        # Flush the buffer with sendmmsg().  Return False if an error was
+        # reported and the caller must stop.
+        connected = bool(self._extra['peername'])
         while self._buffer:
-            data, addr = self._buffer.popleft()
+            batch = list(itertools.islice(self._buffer,
+                                          constants.DATAGRAM_BATCH_SIZE))
+            if connected:
+                batch = [data for data, _ in batch]
             try:
-                if self._extra['peername']:
-                    self._sock.send(data)
-                else:
-                    self._sock.sendto(data, addr)
+                sent = self._sock.sendmmsg(batch)
             except (BlockingIOError, InterruptedError):
-                self._buffer.appendleft((data, addr))  # Try again later.
-                break
+                break  # Try again later.
             except OSError as exc:
+                # The first datagram failed; drop it like sendto() would.
+                self._buffer.popleft()
                 self._protocol.error_received(exc)
-                return
+                return False
             except (SystemExit, KeyboardInterrupt):
                 raise
             except BaseException as exc:
+                self._buffer.popleft()
                 self._fatal_error(
                     exc, 'Fatal write error on datagram transport')
-                return
-
-        self._maybe_resume_protocol()  # May append to buffer.
-        if not self._buffer:
-            self._loop._remove_writer(self._sock_fd)
-            if self._closing:
-                self._call_connection_lost(None)
+                return False
+            for _ in range(sent):
+                self._buffer.popleft()
+            if sent < len(batch):
+                break  # The socket buffer is full.
+        return True
@@ -21,6 +21,9 @@
 
 _DEFAULT_LIMIT = 2 ** 16  # 64 KiB
 
+# Minimum free space returned by StreamReaderProtocol.get_buffer()
+_RECV_BUFFER_SIZE = 2 ** 16  # 64 KiB
+
 
 async def open_connection(host=None, port=None, *,
                           limit=_DEFAULT_LIMIT, **kwds):
@@ -181,13 +184,18 @@ def _get_close_waiter(self, stream):
         raise NotImplementedError
 
 
-class StreamReaderProtocol(FlowControlMixin, protocols.Protocol):
+class StreamReaderProtocol(FlowControlMixin, protocols.Protocol,
+                           protocols.BufferedProtocol):
     """Helper class to adapt between Protocol and StreamReader.
 
     (This is a helper class instead of making StreamReader itself a
     Protocol subclass, because the StreamReader has other potential
     uses, and to prevent the user of the StreamReader to accidentally
     call inappropriate methods of the protocol.)
+
+    Transports supporting BufferedProtocol receive directly into the
+    buffer of the StreamReader.  Other transports, and subclasses
+    overriding data_received(), go through data_received().
     """
 
     _source_traceback = None
@@ -210,6 +218,13 @@ def __init__(self, stream_reader, client_connected_cb=None, loop=None):
         self._client_connected_cb = client_connected_cb
         self._over_ssl = False
         self._closed = self._loop.create_future()
+        # Receive into the reader's buffer unless the data has to go
+        # through an overridden data_received() or feed_data().
+        self._direct_receive = (
+            type(self).data_received is StreamReaderProtocol.data_received and
+            getattr(type(stream_reader), 'feed_data', None) is
+                StreamReader.feed_data)
+        self._recv_buffer = None
 
     @property
     def _stream_reader(self):
@@ -266,6 +281,21 @@ def data_received(self, data):
         if reader is not None:
             reader.feed_data(data)
 
+    def get_buffer(self, sizehint):
+        reader = self._stream_reader
+        if self._direct_receive and reader is not None:
+            return reader._get_buffer(sizehint)
+        if self._recv_buffer is None:
+            self._recv_buffer = bytearray(max(sizehint, _RECV_BUFFER_SIZE))
+        return self._recv_buffer
+
+    def buffer_updated(self, nbytes):
+        reader = self._stream_reader
+        if self._direct_receive and reader is not None:
+            reader._buffer_updated(nbytes)
+        else:
+            self.data_received(bytes(self._recv_buffer[:nbytes]))
+
     def eof_received(self):
         reader = self._stream_reader
         if reader is not None:
@@ -368,6 +398,130 @@ async def drain(self):
         await self._protocol._drain_helper()
 
 
+class _StreamBuffer:
+    """Receive buffer of StreamReader.
+
+    The unread data is kept in _data[_start:_end] and the free space
+    after it is handed out by get_buffer().  Consuming data only moves
+    _start; the unread data is moved to the front when more space is
+    needed, and the storage is released once everything was read.
+    """
+
+    __slots__ = ('_data', '_start', '_end')
+
+    def __init__(self):
+        self._data = bytearray()
+        self._start = 0
+        self._end = 0
+
+    def __len__(self):
+        return self._end - self._start
+
+    def __eq__(self, other):
+        return self._data[self._start:self._end] == other
+
+    __hash__ = None
+
+    def __repr__(self):
+        return f'<_StreamBuffer {bytes(self._data[self._start:self._end])!r}>'
+
+    def _reserve(self, size):
+        data = self._data
+        if len(data) - self._end >= size:
+            return
+        unread = self._end - self._start
+        # Leave unread + size bytes free: the next move only happens once
+        # at least as many bytes as were moved have been received.
+        # Use a new bytearray rather than resizing this one: a memoryview
+        # returned by get_buffer() may still be alive.
+        new = bytearray(2 * unread + size)
+        new[:unread] = data[self._start:self._end]
+        self._data = new
+        self._start = 0
+        self._end = unread
+
+    def _consumed(self, n):
+        self._start += n
+        if self._start == self._end:
+            self._data = bytearray()
+            self._start = self._end = 0
+
+    def extend(self, data):
+        """Append data to the buffer."""
+        n = len(data)
+        self._reserve(n)
+        self._data[self._end:self._end + n] = data
+        self._end += n
+
+    def get_buffer(self, sizehint):
+        """Return a writable memoryview of the free space.
+
+        It is at least sizehint bytes long.  buffer_updated() must be
+        called with the number of bytes written to it.
+        """
+        self._reserve(max(sizehint, 1))
+        return memoryview(self._data)[self._end:]
+
+    def buffer_updated(self, nbytes):
+        """Add nbytes bytes written to the last get_buffer() view."""
+        if not 0 <= nbytes <= len(self._data) - self._end:
+            raise ValueError('nbytes out of range')
+        self._end += nbytes
+
+    def take(self, n):
+        """Remove up to n bytes from the front of the buffer and return them."""
+        n = max(0, min(n, self._end - self._start))
+        with memoryview(self._data) as view:
+            chunk = bytes(view[self._start:self._start + n])
+        self._consumed(n)
+        return chunk
+
+    def discard(self, n):
+        """Remove up to n bytes from the front of the buffer."""
+        self._consumed(max(0, min(n, self._end - self._start)))
+
+    def clear(self):
+        """Remove all data from the buffer."""
+        self._consumed(self._end - self._start)
+
+    def startswith(self, prefix, offset=0):
+        """Return True if the data at offset starts with prefix."""
+        return self._data.startswith(prefix, self._start + offset, self._end)
+
+    def find(self, separators, offset=0):
+        """Find the match of separators which ends first.
+
+        separators is a sequence of non-empty bytes objects sorted by
+        length.  Return the (start, end) offsets of the match, or (-1, -1).
+        """
+        data = self._data
+        start = self._start + offset
+        end = self._end
+        match_start = match_end = -1
+        for sep in separators:
+            if not len(sep):
+                raise ValueError('empty separator')
+            i = data.find(sep, start, end)
+            if i != -1:
+                # A later separator must end before this match to win.
+                match_start = i - self._start
+                match_end = match_start + len(sep)
+                end = i + len(sep) - 1
+        return match_start, match_end
+
+
+# Alias pure-Python implementation for testing purposes.
+_PyStreamBuffer = _StreamBuffer
+
+try:
+    from _asyncio import _StreamBuffer
+except ImportError:
+    pass
+else:
+    # Alias C implementation for testing purposes.
+    _CStreamBuffer = _StreamBuffer
+
+
 class StreamReader:
 
     _source_traceback = None
@@ -384,7 +538,7 @@ def __init__(self, limit=_DEFAULT_LIMIT, loop=None):
             self._loop = events.get_event_loop()
         else:
             self._loop = loop
-        self._buffer = bytearray()
+        self._buffer = _StreamBuffer()
         self._eof = False    # Whether we're done.
         self._waiter = None  # A future used by _wait_for_data()
         self._exception = None
@@ -456,6 +610,21 @@ def feed_data(self, data):
             return
 
         self._buffer.extend(data)
+        self._data_fed()
+
+    def _get_buffer(self, sizehint):
+        assert not self._eof, 'get_buffer after feed_eof'
+        if sizehint < 0:
+            sizehint = _RECV_BUFFER_SIZE
+        return self._buffer.get_buffer(sizehint)
+
+    def _buffer_updated(self, nbytes):
+        if not nbytes:
+            return
+        self._buffer.buffer_updated(nbytes)
+        self._data_fed()
+
+    def _data_fed(self):
         self._wakeup_waiter()
 
         if (self._transport is not None and
@@ -523,7 +692,7 @@ async def readline(self):
             return e.partial
         except exceptions.LimitOverrunError as e:
             if self._buffer.startswith(sep, e.consumed):
-                del self._buffer[:e.consumed + seplen]
+                self._buffer.discard(e.consumed + seplen)
             else:
                 self._buffer.clear()
             self._maybe_resume_transport()
@@ -549,9 +718,23 @@ async def readuntil(self, separator=b'\n'):
         If the data cannot be read because of over limit, a
         LimitOverrunError exception  will be raised, and the data
         will be left in the internal buffer, so it can be read again.
+
+        The ``separator`` may also be a tuple of separators. In this
+        case the return value will be the shortest possible that has any
+        separator as the suffix. For the purposes of LimitOverrunError,
+        the shortest possible separator is considered to be the one that
+        matched.
         """
-        seplen = len(separator)
-        if seplen == 0:
+        if isinstance(separator, tuple):
+            # Makes sure shortest matches wins
+            separator = tuple(sorted(separator, key=len))
+        else:
+            separator = (separator,)
+        if not separator:
+            raise ValueError('Separator should contain at least one element')
+        min_seplen = len(separator[0])
+        max_seplen = len(separator[-1])
+        if min_seplen == 0:
             raise ValueError('Separator should be at least one-byte string')
 
         if self._exception is not None:
@@ -583,18 +766,18 @@ async def readuntil(self, separator=b'\n'):
         while True:
             buflen = len(self._buffer)
 
-            # Check if we now have enough data in the buffer for `separator` to
-            # fit.
-            if buflen - offset >= seplen:
-                isep = self._buffer.find(separator, offset)
+            # Check if we now have enough data in the buffer for shortest
+            # separator to fit.
+            if buflen - offset >= min_seplen:
+                match_start, match_end = self._buffer.find(separator, offset)
 
-                if isep != -1:
-                    # `separator` is in the buffer. `isep` will be used later
-                    # to retrieve the data.
+                if match_end != -1:
+                    # A separator is in the buffer. `match_start` and
+                    # `match_end` will be used later to retrieve the data.
                     break
 
                 # see upper comment for explanation.
-                offset = buflen + 1 - seplen
+                offset = max(0, buflen + 1 - max_seplen)
                 if offset > self._limit:
                     raise exceptions.LimitOverrunError(
                         'Separator is not found, and chunk exceed the limit',
@@ -605,21 +788,20 @@ async def readuntil(self, separator=b'\n'):
             # adds data which makes separator be found. That's why we check for
             # EOF *ater* inspecting the buffer.
             if self._eof:
-                chunk = bytes(self._buffer)
-                self._buffer.clear()
+                chunk = self._buffer.take(len(self._buffer))
                 raise exceptions.IncompleteReadError(chunk, None)
 
             # _wait_for_data() will resume reading if stream was paused.
             await self._wait_for_data('readuntil')
 
-        if isep > self._limit:
+        if match_start > self._limit:
             raise exceptions.LimitOverrunError(
-                'Separator is found, but chunk is longer than limit', isep)
+                'Separator is found, but chunk is longer than limit',
+                match_start)
 
-        chunk = self._buffer[:isep + seplen]
-        del self._buffer[:isep + seplen]
+        chunk = self._buffer.take(match_end)
         self._maybe_resume_transport()
-        return bytes(chunk)
+        return chunk
 
     async def read(self, n=-1):
         """Read up to `n` bytes from the stream.
@@ -665,8 +847,7 @@ async def read(self, n=-1):
             await self._wait_for_data('read')
 
         # This will work right even if buffer is less than n bytes
-        data = bytes(self._buffer[:n])
-        del self._buffer[:n]
+        data = self._buffer.take(n)
 
         self._maybe_resume_transport()
         return data
@@ -697,18 +878,12 @@ async def readexactly(self, n):
 
         while len(self._buffer) < n:
             if self._eof:
-                incomplete = bytes(self._buffer)
-                self._buffer.clear()
+                incomplete = self._buffer.take(len(self._buffer))
                 raise exceptions.IncompleteReadError(incomplete, n)
 
             await self._wait_for_data('readexactly')
 
-        if len(self._buffer) == n:
-            data = bytes(self._buffer)
-            self._buffer.clear()
-        else:
-            data = bytes(self._buffer[:n])
-            del self._buffer[:n]
+        data = self._buffer.take(n)
         self._maybe_resume_transport()
         return data
 
@@ -0,0 +1,419 @@
+"""Proactor event loop for Linux using io_uring."""
+
+import os
+import socket
+import sys
+import warnings
+import weakref
+
+import _uring
+
+from . import futures
+from . import proactor_events
+from . import unix_events
+
+
+__all__ = (
+    'UringProactor', 'UringEventLoop', 'UringEventLoopPolicy',
+)
+
+
+# Returned by a completion callback which queued a new operation for the
+# same future, e.g. to send the rest of a partially sent buffer.
+_PENDING = object()
+
+
+class _UringFuture(futures.Future):
+    """Subclass of Future which represents an io_uring operation.
+
+    Cancelling it requests the cancellation of the operation.
+    """
+
+    _op = None
+
+    def _cancel_operation(self):
+        op = self._op
+        if op is None:
+            return
+        self._op = None
+        proactor = self._loop._proactor
+        if proactor is not None and proactor._ring is not None:
+            proactor._ring.cancel(op)
+
+    def cancel(self, msg=None):
+        self._cancel_operation()
+        return super().cancel(msg=msg)
+
+
+# Completion callbacks: called with the proactor, the future, the object
+# the operation was submitted for, the (non-negative) result and the value
+# of the completion.  The future is set with their return value.
+
+def _finish_value(proactor, f, obj, res, value):
+    return value
+
+
+def _finish_result(proactor, f, obj, res, value):
+    return res
+
+
+def _finish_read_into(proactor, f, conn, res, value):
+    f._buf[:res] = value
+    return res
+
+
+def _finish_recvfrom(proactor, f, conn, res, value):
+    try:
+        return conn.recvfrom(*f._args)
+    except (BlockingIOError, InterruptedError):
+        proactor._submit(f, conn, _finish_recvfrom, proactor._ring.poll,
+                         conn.fileno(), _uring.POLLIN)
+        return _PENDING
+
+
+def _finish_send(proactor, f, conn, res, value):
+    data = f._data
+    if res < len(data):
+        # Partial send: queue the remaining data
+        data = f._data = memoryview(data).cast('B')[res:]
+        proactor._submit_send(f, conn, data)
+        return _PENDING
+    f._data = None
+    return None
+
+
+def _finish_sendto(proactor, f, conn, res, value):
+    buf, flags, addr = f._args
+    try:
+        if addr is None:
+            return conn.send(buf, flags)
+        return conn.sendto(buf, flags, addr)
+    except (BlockingIOError, InterruptedError):
+        proactor._submit(f, conn, _finish_sendto, proactor._ring.poll,
+                         conn.fileno(), _uring.POLLOUT)
+        return _PENDING
+
+
+def _finish_accept(proactor, f, listener, res, value):
+    conn = socket.socket(listener.family, listener.type, listener.proto,
+                         fileno=res)
+    conn.settimeout(listener.gettimeout())
+    return conn, conn.getpeername()
+
+
+def _finish_connect(proactor, f, conn, res, value):
+    err = conn.getsockopt(socket.SOL_SOCKET, socket.SO_ERROR)
+    if err != 0:
+        raise OSError(err, f'Connect call failed {f._args[0]}')
+    return None
+
+
+def _finish_sendfile(proactor, f, sock, res, value):
+    fileno, offset, count = f._args
+    try:
+        sent = os.sendfile(sock.fileno(), fileno, offset, count)
+    except (BlockingIOError, InterruptedError):
+        sent = 0
+    else:
+        if sent == 0:
+            # EOF
+            return None
+    if sent < count:
+        f._args = (fileno, offset + sent, count - sent)
+        proactor._submit(f, sock, _finish_sendfile, proactor._ring.poll,
+                         sock.fileno(), _uring.POLLOUT)
+        return _PENDING
+    return None
+
+
+class UringProactor:
+    """Proactor implementation using io_uring.
+
+    Operations are queued in the submission ring and handed to the kernel
+    in a single io_uring_enter() system call by select(), which also
+    collects the completions.
+    """
+
+    def __init__(self, entries=256):
+        self._loop = None
+        self._ring = _uring.Ring(entries)
+        self._stopped_serving = weakref.WeakSet()
+
+    def _check_closed(self):
+        if self._ring is None:
+            raise RuntimeError('UringProactor is closed')
+
+    def __repr__(self):
+        info = []
+        if self._ring is None:
+            info.append('closed')
+        else:
+            info.append('pending#=%s' % self._ring.pending)
+        return '<%s %s>' % (self.__class__.__name__, " ".join(info))
+
+    def set_loop(self, loop):
+        self._loop = loop
+
+    def select(self, timeout=None):
+        results = []
+        for (f, obj, callback), res, value in self._ring.wait(timeout):
+            if callback is _finish_accept:
+                if obj in self._stopped_serving:
+                    f.cancel()
+                if f.done() and res >= 0:
+                    # Don't leak a connection accepted after the
+                    # cancellation
+                    os.close(res)
+            if f.done():
+                continue
+            if res < 0:
+                f._op = None
+                f.set_exception(OSError(-res, os.strerror(-res)))
+            else:
+                try:
+                    value = callback(self, f, obj, res, value)
+                except OSError as e:
+                    f._op = None
+                    f.set_exception(e)
+                else:
+                    if value is _PENDING:
+                        continue
+                    f._op = None
+                    f.set_result(value)
+            results.append(f)
+        return results
+
+    def _result(self, value):
+        fut = self._loop.create_future()
+        fut.set_result(value)
+        return fut
+
+    def _future(self):
+        self._check_closed()
+        f = _UringFuture(loop=self._loop)
+        if f._source_traceback:
+            del f._source_traceback[-1]
+        return f
+
+    def _submit(self, f, obj, callback, method, *args):
+        # The ring keeps the key alive until the operation completes: the
+        # future is then set with the value returned by callback().
+        f._op = method((f, obj, callback), *args)
+        return f
+
+    def recv(self, conn, nbytes, flags=0):
+        f = self._future()
+        if isinstance(conn, socket.socket):
+            return self._submit(f, conn, _finish_value, self._ring.recv,
+                                conn.fileno(), nbytes, flags)
+        return self._submit(f, conn, _finish_value, self._ring.read,
+                            conn.fileno(), nbytes)
+
+    def recv_into(self, conn, buf, flags=0):
+        f = self._future()
+        if isinstance(conn, socket.socket):
+            return self._submit(f, conn, _finish_result, self._ring.recv_into,
+                                conn.fileno(), buf, flags)
+        # Pipes are read into a temporary buffer
+        f._buf = buf
+        return self._submit(f, conn, _finish_read_into, self._ring.read,
+                            conn.fileno(), len(buf))
+
+    def recvfrom(self, conn, nbytes, flags=0):
+        f = self._future()
+        f._args = (nbytes, flags)
+        return self._submit(f, conn, _finish_recvfrom, self._ring.poll,
+                            conn.fileno(), _uring.POLLIN)
+
+    def send(self, conn, buf, flags=0):
+        f = self._future()
+        if not isinstance(buf, (bytes, bytearray)):
+            buf = memoryview(buf).cast('B')
+        if isinstance(conn, socket.socket) and conn.gettimeout() == 0:
+            # Most sends fit in the socket buffer: try to complete them
+            # without a round trip through the ring.
+            try:
+                n = conn.send(buf, flags)
+            except (BlockingIOError, InterruptedError):
+                n = 0
+            except OSError as exc:
+                f.set_exception(exc)
+                return f
+            if n == len(buf):
+                f.set_result(None)
+                return f
+            if n:
+                buf = memoryview(buf).cast('B')[n:]
+        f._data = buf
+        f._args = (flags,)
+        return self._submit_send(f, conn, buf)
+
+    def _submit_send(self, f, conn, data):
+        if isinstance(conn, socket.socket):
+            return self._submit(f, conn, _finish_send, self._ring.send,
+                                conn.fileno(), data, *f._args)
+        # Start writing to pipes right away, like sockets do
+        self._submit(f, conn, _finish_send, self._ring.write,
+                     conn.fileno(), data)
+        self._ring.submit()
+        return f
+
+    def sendto(self, conn, buf, flags=0, addr=None):
+        f = self._future()
+        f._args = (buf, flags, addr)
+        return self._submit(f, conn, _finish_sendto, self._ring.poll,
+                            conn.fileno(), _uring.POLLOUT)
+
+    def accept(self, listener):
+        f = self._future()
+        return self._submit(f, listener, _finish_accept, self._ring.accept,
+                            listener.fileno(), socket.SOCK_CLOEXEC)
+
+    def connect(self, conn, address):
+        if conn.type == socket.SOCK_DGRAM:
+            # connect() completes immediately for UDP sockets
+            conn.connect(address)
+            return self._result(None)
+
+        try:
+            conn.connect(address)
+        except (BlockingIOError, InterruptedError):
+            pass
+        else:
+            return self._result(None)
+        f = self._future()
+        f._args = (address,)
+        return self._submit(f, conn, _finish_connect, self._ring.poll,
+                            conn.fileno(), _uring.POLLOUT)
+
+    def sendfile(self, sock, file, offset, count):
+        # io_uring has no sendfile operation: wait until the socket is
+        # writable and call os.sendfile() until count bytes are sent.
+        f = self._future()
+        f._args = (file.fileno(), offset, count)
+        return self._submit(f, sock, _finish_sendfile, self._ring.poll,
+                            sock.fileno(), _uring.POLLOUT)
+
+    def poll(self, conn, events):
+        """Wait until conn is ready for the given poll events.
+
+        POLLHUP and POLLERR are always reported.  The result of the
+        future is the mask of ready events.
+        """
+        f = self._future()
+        return self._submit(f, conn, _finish_result, self._ring.poll,
+                            conn.fileno(), events)
+
+    def _stop_serving(self, obj):
+        # obj is a socket.  It will be closed in
+        # BaseProactorEventLoop._stop_serving(); a connection accepted
+        # meanwhile is closed when the accept completes.
+        self._stopped_serving.add(obj)
+
+    def close(self):
+        if self._ring is None:
+            # already closed
+            return
+
+        # Cancel the in-flight operations and wait until the kernel has
+        # released their buffers.
+        ring = self._ring
+        self._ring = None
+        for (f, obj, callback), res, value in ring.close():
+            if callback is _finish_accept and res >= 0:
+                os.close(res)
+            if not f.done():
+                f._op = None
+                f.cancel()
+
+
+class _UringWritePipeTransport(
+        proactor_events._ProactorBaseWritePipeTransport):
+
+    def __init__(self, *args, **kw):
+        super().__init__(*args, **kw)
+        # Reading from the write end of a pipe doesn't report that the
+        # other end was closed on UNIX: wait for POLLHUP or POLLERR.
+        self._read_fut = self._loop._proactor.poll(self._sock, 0)
+        self._read_fut.add_done_callback(self._pipe_closed)
+
+    def _pipe_closed(self, fut):
+        if fut.cancelled():
+            # the transport has been closed
+            return
+        if self._closing:
+            assert self._read_fut is None
+            return
+        assert fut is self._read_fut, (fut, self._read_fut)
+        self._read_fut = None
+        if self._write_fut is not None:
+            self._force_close(BrokenPipeError())
+        else:
+            self.close()
+
+
+class UringEventLoop(proactor_events.BaseProactorEventLoop):
+    """Linux version of proactor event loop using io_uring."""
+
+    def __init__(self, proactor=None):
+        if proactor is None:
+            proactor = UringProactor()
+        super().__init__(proactor)
+        self._signal_handlers = {}
+
+    def close(self):
+        super().close()
+        if not sys.is_finalizing():
+            for sig in list(self._signal_handlers):
+                self.remove_signal_handler(sig)
+        else:
+            if self._signal_handlers:
+                warnings.warn(f"Closing the loop {self!r} "
+                              f"on interpreter shutdown "
+                              f"stage, skipping signal handlers removal",
+                              ResourceWarning,
+                              source=self)
+                self._signal_handlers.clear()
+
+    def _make_read_pipe_transport(self, sock, protocol, waiter=None,
+                                  extra=None):
+        # io_uring polls non-blocking pipes and ttys instead of blocking a
+        # kernel worker thread in read()
+        os.set_blocking(sock.fileno(), False)
+        return super()._make_read_pipe_transport(sock, protocol, waiter,
+                                                 extra)
+
+    def _make_write_pipe_transport(self, sock, protocol, waiter=None,
+                                   extra=None):
+        os.set_blocking(sock.fileno(), False)
+        return _UringWritePipeTransport(self, sock, protocol, waiter, extra)
+
+    def run_forever(self):
+        try:
+            assert self._self_reading_future is None
+            self.call_soon(self._loop_self_reading)
+            super().run_forever()
+        finally:
+            if self._self_reading_future is not None:
+                self._self_reading_future.cancel()
+                self._self_reading_future = None
+
+    # Signal handling and subprocesses are shared with the UNIX selector
+    # event loop: signal numbers arrive through the self-pipe, and the
+    # subprocess pipes are served by the proactor pipe transports.
+    _UnixLoop = unix_events._UnixSelectorEventLoop
+    _process_self_data = _UnixLoop._process_self_data
+    add_signal_handler = _UnixLoop.add_signal_handler
+    _handle_signal = _UnixLoop._handle_signal
+    remove_signal_handler = _UnixLoop.remove_signal_handler
+    _check_signal = _UnixLoop._check_signal
+    _make_subprocess_transport = _UnixLoop._make_subprocess_transport
+    _child_watcher_callback = _UnixLoop._child_watcher_callback
+    create_unix_connection = _UnixLoop.create_unix_connection
+    create_unix_server = _UnixLoop.create_unix_server
+    del _UnixLoop
+
+
+class UringEventLoopPolicy(unix_events.DefaultEventLoopPolicy):
+    """UNIX event loop policy creating io_uring event loops."""
+    _loop_factory = UringEventLoop
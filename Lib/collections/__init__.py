@@ -8,6 +8,7 @@
 * Counter      dict subclass for counting hashable objects
 * OrderedDict  dict subclass that remembers the order entries were added
 * defaultdict  dict subclass that calls a factory function to supply missing values
+* frozenmap    immutable mapping with structural sharing and batch mutations
 * UserDict     wrapper around dictionary objects for easier dict subclassing
 * UserList     wrapper around list objects for easier list subclassing
 * UserString   wrapper around string objects for easier string subclassing
@@ -23,6 +24,7 @@
     'UserString',
     'defaultdict',
     'deque',
+    'frozenmap',
     'namedtuple',
 ]
 
@@ -50,6 +52,13 @@
 except ImportError:
     pass
 
+try:
+    from _collections import frozenmap
+except ImportError:
+    pass
+else:
+    _collections_abc.Mapping.register(frozenmap)
+
 
 ################################################################################
 ### OrderedDict
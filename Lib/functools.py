@@ -18,7 +18,7 @@
 from collections import namedtuple
 # import types, weakref  # Deferred to single_dispatch()
 from reprlib import recursive_repr
-from _thread import RLock
+from _thread import RLock, allocate_lock, get_ident
 from types import GenericAlias
 
 
@@ -476,7 +476,8 @@ def _make_key(args, kwds, typed,
         return key[0]
     return _HashedSeq(key)
 
-def lru_cache(maxsize=128, typed=False):
+def lru_cache(maxsize=128, typed=False, *, maxbytes=None, ttl=None,
+              cost=None):
     """Least-recently-used cache decorator.
 
     If *maxsize* is set to None, the LRU features are disabled and the cache
@@ -486,10 +487,18 @@ def lru_cache(maxsize=128, typed=False):
     For example, f(3.0) and f(3) will be treated as distinct calls with
     distinct results.
 
+    If *maxbytes* is set, least recently used entries are also evicted while
+    the total cost of the cached results exceeds it.  The cost of a result is
+    cost(result) if *cost* is given and sys.getsizeof(result) otherwise.
+    If *ttl* is set, results older than *ttl* seconds are recomputed.
+    With any of these set, concurrent calls with the same arguments wait for
+    a single call of the user function instead of each calling it.
+
     Arguments to the cached function must be hashable.
 
     View the cache statistics named tuple (hits, misses, maxsize, currsize)
-    with f.cache_info().  Clear the cache and statistics with f.cache_clear().
+    with f.cache_info() and a dict of extended statistics with
+    f.cache_stats().  Clear the cache and statistics with f.cache_clear().
     Access the underlying function with f.__wrapped__.
 
     See:  http://en.wikipedia.org/wiki/Cache_replacement_policies#Least_recently_used_(LRU)
@@ -515,21 +524,38 @@ def lru_cache(maxsize=128, typed=False):
         raise TypeError(
             'Expected first argument to be an integer, a callable, or None')
 
+    budget = {name: value
+              for name, value in [('maxbytes', maxbytes), ('ttl', ttl),
+                                  ('cost', cost)]
+              if value is not None}
+
     def decorating_function(user_function):
-        wrapper = _lru_cache_wrapper(user_function, maxsize, typed, _CacheInfo)
-        wrapper.cache_parameters = lambda : {'maxsize': maxsize, 'typed': typed}
+        wrapper = _lru_cache_wrapper(user_function, maxsize, typed, _CacheInfo,
+                                     **budget)
+        wrapper.cache_parameters = lambda : {'maxsize': maxsize, 'typed': typed,
+                                             **budget}
         return update_wrapper(wrapper, user_function)
 
     return decorating_function
 
-def _lru_cache_wrapper(user_function, maxsize, typed, _CacheInfo):
+def _lru_cache_wrapper(user_function, maxsize, typed, _CacheInfo, *,
+                       maxbytes=None, ttl=None, cost=None):
     # Constants shared by all lru cache instances:
     sentinel = object()          # unique object used to signal cache misses
     make_key = _make_key         # build a key from the function arguments
     PREV, NEXT, KEY, RESULT = 0, 1, 2, 3   # names for the link fields
 
+    if maxbytes is not None and maxbytes < 0:
+        raise ValueError('maxbytes must be non-negative')
+    if ttl is not None and ttl <= 0:
+        raise ValueError('ttl must be positive')
+    if cost is not None and not callable(cost):
+        raise TypeError('cost must be callable or None')
+
     cache = {}
     hits = misses = 0
+    evictions = expirations = currbytes = 0
+    saved = 0.0
     full = False
     cache_get = cache.get    # bound method to lookup a key or return None
     cache_len = cache.__len__  # get cache size without calling len()
@@ -546,6 +572,79 @@ def wrapper(*args, **kwds):
             result = user_function(*args, **kwds)
             return result
 
+    elif maxbytes is not None or ttl is not None or cost is not None:
+        from sys import getsizeof
+        from time import monotonic
+        # Entries are [result, cost, expires, elapsed] kept in the insertion
+        # order of the cache dict, oldest first.
+        ECOST, EXPIRES, ELAPSED = 1, 2, 3
+        pending = {}             # key -> [lock, owner thread id, done]
+
+        def wrapper(*args, **kwds):
+            # Cost bounded caching with expiry and collapsed concurrent misses
+            nonlocal hits, misses, evictions, expirations, currbytes, saved
+            key = make_key(args, kwds, typed)
+            while True:
+                with lock:
+                    entry = cache_get(key)
+                    if entry is not None:
+                        if entry[EXPIRES] is None or monotonic() < entry[EXPIRES]:
+                            # Move the entry to the most recently used end
+                            del cache[key]
+                            cache[key] = entry
+                            hits += 1
+                            saved += entry[ELAPSED]
+                            return entry[0]
+                        del cache[key]
+                        currbytes -= entry[ECOST]
+                        expirations += 1
+                    flight = pending.get(key)
+                    if flight is None:
+                        flight = pending[key] = [allocate_lock(), get_ident(), False]
+                        flight[0].acquire()
+                        misses += 1
+                        break
+                    if flight[2] or flight[1] == get_ident():
+                        # Recursive call for the key being computed by this
+                        # thread: waiting would deadlock.
+                        flight = None
+                        misses += 1
+                        break
+                # Wait for the thread computing this key, then look again.
+                with flight[0]:
+                    pass
+            try:
+                start = monotonic()
+                result = user_function(*args, **kwds)
+                elapsed = monotonic() - start
+                if cost is not None:
+                    size = cost(result)
+                    if size < 0:
+                        raise ValueError('lru_cache cost must be non-negative')
+                elif maxbytes is not None:
+                    size = getsizeof(result)
+                else:
+                    size = 0
+                with lock:
+                    if key not in cache and (maxbytes is None or size <= maxbytes):
+                        while cache and (
+                                (maxsize is not None and cache_len() >= maxsize) or
+                                (maxbytes is not None and currbytes + size > maxbytes)):
+                            oldest = next(iter(cache))
+                            currbytes -= cache.pop(oldest)[ECOST]
+                            evictions += 1
+                        expires = None if ttl is None else monotonic() + ttl
+                        cache[key] = [result, size, expires, elapsed]
+                        currbytes += size
+            finally:
+                if flight is not None:
+                    with lock:
+                        if pending.get(key) is flight:
+                            del pending[key]
+                    flight[2] = True
+                    flight[0].release()
+            return result
+
     elif maxsize is None:
 
         def wrapper(*args, **kwds):
@@ -625,16 +724,27 @@ def cache_info():
         with lock:
             return _CacheInfo(hits, misses, maxsize, cache_len())
 
+    def cache_stats():
+        """Report extended cache statistics"""
+        with lock:
+            return {'hits': hits, 'misses': misses, 'evictions': evictions,
+                    'expirations': expirations, 'currsize': cache_len(),
+                    'currbytes': currbytes, 'maxbytes': maxbytes,
+                    'time_saved': saved}
+
     def cache_clear():
         """Clear the cache and cache statistics"""
-        nonlocal hits, misses, full
+        nonlocal hits, misses, evictions, expirations, currbytes, saved, full
         with lock:
             cache.clear()
             root[:] = [root, root, None, None]
             hits = misses = 0
+            evictions = expirations = currbytes = 0
+            saved = 0.0
             full = False
 
     wrapper.cache_info = cache_info
+    wrapper.cache_stats = cache_stats
     wrapper.cache_clear = cache_clear
     return wrapper
 
@@ -21,6 +21,12 @@
 _COMPRESS_LEVEL_TRADEOFF = 6
 _COMPRESS_LEVEL_BEST = 9
 
+# Parallel compression splits the input into blocks of this size, and hands
+# batches of _PARALLEL_BATCH_BLOCKS blocks per thread to zlib at a time.
+_PARALLEL_BLOCK_SIZE = 128 * 1024
+_PARALLEL_BATCH_BLOCKS = 4
+_DEFLATE_WINDOW_SIZE = 32 * 1024
+
 
 def open(filename, mode="rb", compresslevel=_COMPRESS_LEVEL_BEST,
          encoding=None, errors=None, newline=None):
@@ -132,7 +138,8 @@ class GzipFile(_compression.BaseStream):
     myfileobj = None
 
     def __init__(self, filename=None, mode=None,
-                 compresslevel=_COMPRESS_LEVEL_BEST, fileobj=None, mtime=None):
+                 compresslevel=_COMPRESS_LEVEL_BEST, fileobj=None, mtime=None,
+                 *, threads=1):
         """Constructor for the GzipFile class.
 
         At least one of fileobj and filename must be given a
@@ -164,6 +171,11 @@ def __init__(self, filename=None, mode=None,
         to the last modification time field in the stream when compressing.
         If omitted or None, the current time is used.
 
+        The threads argument is the number of threads used to compress.  If
+        it is greater than 1, the data is split into blocks that are
+        compressed concurrently and joined into a single deflate stream that
+        any gzip reader can decompress.  0 means os.cpu_count().
+
         """
 
         if mode and ('t' in mode or 'U' in mode):
@@ -196,13 +208,23 @@ def __init__(self, filename=None, mode=None,
                     "change in future Python releases.  "
                     "Specify the mode argument for opening it for writing.",
                     FutureWarning, 2)
+            if threads == 0:
+                threads = os.cpu_count() or 1
+            elif threads < 0:
+                raise ValueError("threads must be non-negative")
             self.mode = WRITE
             self._init_write(filename)
-            self.compress = zlib.compressobj(compresslevel,
-                                             zlib.DEFLATED,
-                                             -zlib.MAX_WBITS,
-                                             zlib.DEF_MEM_LEVEL,
-                                             0)
+            self._threads = threads
+            if threads > 1:
+                self._compresslevel = compresslevel
+                self._zdict = b''
+                self._pending = bytearray()
+            else:
+                self.compress = zlib.compressobj(compresslevel,
+                                                 zlib.DEFLATED,
+                                                 -zlib.MAX_WBITS,
+                                                 zlib.DEF_MEM_LEVEL,
+                                                 0)
             self._write_mtime = mtime
         else:
             raise ValueError("Invalid mode: {!r}".format(mode))
@@ -286,13 +308,50 @@ def write(self,data):
             length = data.nbytes
 
         if length > 0:
-            self.fileobj.write(self.compress.compress(data))
+            if self._threads > 1:
+                self._write_parallel(data)
+            else:
+                self.fileobj.write(self.compress.compress(data))
             self.size += length
             self.crc = zlib.crc32(data, self.crc)
             self.offset += length
 
         return length
 
+    def _write_parallel(self, data):
+        data = memoryview(data).cast('B')
+        batch = self._threads * _PARALLEL_BATCH_BLOCKS * _PARALLEL_BLOCK_SIZE
+        if self._pending:
+            need = batch - len(self._pending)
+            self._pending += data[:need]
+            data = data[need:]
+            if len(self._pending) < batch:
+                return
+            self.fileobj.write(self._deflate_pending(finish=False))
+        # Compress large writes in place rather than copying them
+        while len(data) >= batch:
+            self.fileobj.write(self._deflate_parallel(data[:batch],
+                                                      finish=False))
+            data = data[batch:]
+        self._pending += data
+
+    def _deflate_pending(self, finish):
+        data = self._deflate_parallel(self._pending, finish)
+        self._pending = bytearray()
+        return data
+
+    def _deflate_parallel(self, data, finish):
+        compressed = zlib.deflate_parallel(data, self._compresslevel,
+                                           threads=self._threads,
+                                           blocksize=_PARALLEL_BLOCK_SIZE,
+                                           zdict=self._zdict, finish=finish)
+        # The end of the data primes the dictionary of the next batch
+        if len(data) >= _DEFLATE_WINDOW_SIZE:
+            self._zdict = bytes(data[-_DEFLATE_WINDOW_SIZE:])
+        else:
+            self._zdict = (self._zdict + data)[-_DEFLATE_WINDOW_SIZE:]
+        return compressed
+
     def read(self, size=-1):
         self._check_not_closed()
         if self.mode != READ:
@@ -331,7 +390,10 @@ def close(self):
         self.fileobj = None
         try:
             if self.mode == WRITE:
-                fileobj.write(self.compress.flush())
+                if self._threads > 1:
+                    fileobj.write(self._deflate_pending(finish=True))
+                else:
+                    fileobj.write(self.compress.flush())
                 write32u(fileobj, self.crc)
                 # self.size may exceed 2 GiB, or even 4 GiB
                 write32u(fileobj, self.size & 0xffffffff)
@@ -347,7 +409,14 @@ def flush(self,zlib_mode=zlib.Z_SYNC_FLUSH):
         self._check_not_closed()
         if self.mode == WRITE:
             # Ensure the compressor's buffer is flushed
-            self.fileobj.write(self.compress.flush(zlib_mode))
+            if self._threads > 1:
+                # Each batch ends on a byte boundary, so a sync flush is
+                # just compressing what is pending.
+                self.fileobj.write(self._deflate_pending(finish=False))
+                if zlib_mode == zlib.Z_FULL_FLUSH:
+                    self._zdict = b''
+            else:
+                self.fileobj.write(self.compress.flush(zlib_mode))
             self.fileobj.flush()
 
     def fileno(self):
@@ -544,12 +613,15 @@ def _rewind(self):
         super()._rewind()
         self._new_member = True
 
-def compress(data, compresslevel=_COMPRESS_LEVEL_BEST, *, mtime=None):
+def compress(data, compresslevel=_COMPRESS_LEVEL_BEST, *, mtime=None,
+             threads=1):
     """Compress data in one shot and return the compressed string.
     Optional argument is the compression level, in range of 0-9.
+    If threads is greater than 1, compress blocks of data concurrently.
     """
     buf = io.BytesIO()
-    with GzipFile(fileobj=buf, mode='wb', compresslevel=compresslevel, mtime=mtime) as f:
+    with GzipFile(fileobj=buf, mode='wb', compresslevel=compresslevel,
+                  mtime=mtime, threads=threads) as f:
         f.write(data)
     return buf.getvalue()
 
@@ -65,7 +65,8 @@
 algorithms_available = set(__always_supported)
 
 __all__ = __always_supported + ('new', 'algorithms_guaranteed',
-                                'algorithms_available', 'pbkdf2_hmac')
+                                'algorithms_available', 'pbkdf2_hmac',
+                                'hash_many')
 
 
 __builtin_constructor_cache = {}
@@ -166,6 +167,34 @@ def __hash_new(name, data=b'', **kwargs):
         return __get_builtin_constructor(name)(data)
 
 
+def __get_builtin_many(name):
+    # The builtin modules providing a function that hashes a whole
+    # sequence of messages with a single release of the GIL.
+    try:
+        if name in {'SHA1', 'sha1'}:
+            import _sha1
+            return _sha1.sha1_many
+        elif name in {'SHA224', 'sha224'}:
+            import _sha256
+            return _sha256.sha224_many
+        elif name in {'SHA256', 'sha256'}:
+            import _sha256
+            return _sha256.sha256_many
+    except ImportError:
+        pass
+    return None
+
+
+def hash_many(name, messages):
+    """hash_many(name, messages) - Return a list of the digests of each
+    bytes-like object in the iterable messages, using the named algorithm.
+    """
+    many = __get_builtin_many(name)
+    if many is not None:
+        return many(messages)
+    return [new(name, message).digest() for message in messages]
+
+
 try:
     import _hashlib
     new = __hash_new
@@ -125,7 +125,9 @@
 """
 
 __all__ = ['heappush', 'heappop', 'heapify', 'heapreplace', 'merge',
-           'nlargest', 'nsmallest', 'heappushpop']
+           'nlargest', 'nsmallest', 'heappushpop', 'Heap']
+
+import operator
 
 def heappush(heap, item):
     """Push item onto heap, maintaining the heap invariant."""
@@ -311,6 +313,174 @@ def _siftup_max(heap, pos):
     heap[pos] = newitem
     _siftdown_max(heap, startpos, pos)
 
+class _HeapHandle:
+    """Reference to an item stored in a Heap.
+
+    Handles are returned by Heap.push() and accepted by Heap.remove() and
+    Heap.update().
+    """
+
+    __slots__ = ('_item', '_key', '_index')
+
+    def __init__(self, item, key):
+        self._item = item
+        self._key = key
+        self._index = -1
+
+    @property
+    def item(self):
+        'The item this handle refers to.'
+        return self._item
+
+class Heap:
+    """Heap(iterable=(), /, *, key=None)
+
+    A min-heap with optional key function and handles to stored items.
+
+    push() returns a handle that can later be passed to remove() or
+    update() to delete or reprioritize that item in O(log n) time.
+    """
+
+    def __init__(self, iterable=(), /, *, key=None):
+        if key is not None and not callable(key):
+            raise TypeError('key must be callable or None')
+        self._key = key
+        self._entries = []
+        self.pushmany(iterable)
+
+    @property
+    def key(self):
+        'The key function, or None.'
+        return self._key
+
+    def __len__(self):
+        return len(self._entries)
+
+    def _handle(self, item):
+        return _HeapHandle(item, item if self._key is None else self._key(item))
+
+    def _siftdown(self, startpos, pos):
+        entries = self._entries
+        newitem = entries[pos]
+        newkey = newitem._key
+        while pos > startpos:
+            parentpos = (pos - 1) >> 1
+            parent = entries[parentpos]
+            if not newkey < parent._key:
+                break
+            entries[pos] = parent
+            parent._index = pos
+            pos = parentpos
+        entries[pos] = newitem
+        newitem._index = pos
+
+    def _siftup(self, pos):
+        entries = self._entries
+        endpos = len(entries)
+        startpos = pos
+        newitem = entries[pos]
+        childpos = 2*pos + 1
+        while childpos < endpos:
+            rightpos = childpos + 1
+            if rightpos < endpos and not entries[childpos]._key < entries[rightpos]._key:
+                childpos = rightpos
+            child = entries[pos] = entries[childpos]
+            child._index = pos
+            pos = childpos
+            childpos = 2*pos + 1
+        entries[pos] = newitem
+        newitem._index = pos
+        self._siftdown(startpos, pos)
+
+    def _fix(self, pos):
+        entries = self._entries
+        if pos and entries[pos]._key < entries[(pos - 1) >> 1]._key:
+            self._siftdown(0, pos)
+        else:
+            self._siftup(pos)
+
+    def _take(self, pos):
+        entries = self._entries
+        handle = entries[pos]
+        last = entries.pop()
+        if last is not handle:
+            entries[pos] = last
+            last._index = pos
+            self._fix(pos)
+        handle._index = -1
+        return handle.item
+
+    def _validate(self, handle):
+        if not isinstance(handle, _HeapHandle):
+            raise TypeError('expected a heap handle, not %s'
+                            % type(handle).__name__)
+        pos = handle._index
+        if not 0 <= pos < len(self._entries) or self._entries[pos] is not handle:
+            raise ValueError('handle is not in this heap')
+
+    def push(self, item):
+        'Push item onto the heap and return a handle to it.'
+        handle = self._handle(item)
+        handle._index = len(self._entries)
+        self._entries.append(handle)
+        self._siftdown(0, handle._index)
+        return handle
+
+    def pushmany(self, iterable):
+        'Push all items from iterable onto the heap.'
+        handles = [self._handle(item) for item in iterable]
+        entries = self._entries
+        oldsize = len(entries)
+        for i, handle in enumerate(handles, oldsize):
+            handle._index = i
+        entries.extend(handles)
+        if len(handles) > oldsize:
+            # Many new entries: a bottom-up heapify is cheaper than n sifts.
+            for i in reversed(range(len(entries)//2)):
+                self._siftup(i)
+        else:
+            for i in range(oldsize, len(entries)):
+                self._siftdown(0, i)
+
+    def pop(self):
+        'Pop the smallest item off the heap.'
+        if not self._entries:
+            raise IndexError('pop from an empty heap')
+        return self._take(0)
+
+    def popmany(self, n, /):
+        'Pop up to n smallest items off the heap and return them as a sorted list.'
+        n = operator.index(n)
+        if n < 0:
+            raise ValueError('n must be non-negative')
+        return [self._take(0) for _ in range(min(n, len(self._entries)))]
+
+    def peek(self):
+        'Return the smallest item without removing it.'
+        if not self._entries:
+            raise IndexError('peek at an empty heap')
+        return self._entries[0].item
+
+    def remove(self, handle, /):
+        'Remove the item referred to by handle from the heap and return it.'
+        self._validate(handle)
+        return self._take(handle._index)
+
+    def update(self, handle, item, /):
+        'Replace the item referred to by handle and restore the heap invariant.'
+        self._validate(handle)
+        key = item if self._key is None else self._key(item)
+        self._validate(handle)
+        handle._item = item
+        handle._key = key
+        self._fix(handle._index)
+
+    def clear(self):
+        'Remove all items from the heap.'
+        for handle in self._entries:
+            handle._index = -1
+        self._entries.clear()
+
 def merge(*iterables, key=None, reverse=False):
     '''Merge multiple sorted inputs into a single sorted output.
 
@@ -97,13 +97,13 @@
 """
 __version__ = '2.0.9'
 __all__ = [
-    'dump', 'dumps', 'load', 'loads',
+    'dump', 'dumps', 'dumpb', 'load', 'loads', 'iterload',
     'JSONDecoder', 'JSONDecodeError', 'JSONEncoder',
 ]
 
 __author__ = 'Bob Ippolito <bob@redivi.com>'
 
-from .decoder import JSONDecoder, JSONDecodeError
+from .decoder import JSONDecoder, JSONDecodeError, IncrementalDecoder
 from .encoder import JSONEncoder
 import codecs
 
@@ -238,6 +238,36 @@ def dumps(obj, *, skipkeys=False, ensure_ascii=True, check_circular=True,
         **kw).encode(obj)
 
 
+def dumpb(obj, fp=None, *, skipkeys=False, ensure_ascii=True,
+        check_circular=True, allow_nan=True, cls=None, indent=None,
+        separators=None, default=None, sort_keys=False, **kw):
+    """Serialize ``obj`` to JSON formatted UTF-8 ``bytes``.
+
+    The output is built as bytes directly, without creating an intermediate
+    ``str``.  If ``fp`` (a ``.write()``-supporting binary file-like object)
+    is given, the output is written to it in chunks and ``None`` is
+    returned.
+
+    The other arguments have the same meaning as in ``dumps()``.  A string
+    containing lone surrogates cannot be encoded when ``ensure_ascii`` is
+    false and raises ``UnicodeEncodeError``.
+    """
+    write = None if fp is None else fp.write
+    # cached encoder
+    if (not skipkeys and ensure_ascii and
+        check_circular and allow_nan and
+        cls is None and indent is None and separators is None and
+        default is None and not sort_keys and not kw):
+        return _default_encoder.encode_bytes(obj, write)
+    if cls is None:
+        cls = JSONEncoder
+    return cls(
+        skipkeys=skipkeys, ensure_ascii=ensure_ascii,
+        check_circular=check_circular, allow_nan=allow_nan, indent=indent,
+        separators=separators, default=default, sort_keys=sort_keys,
+        **kw).encode_bytes(obj, write)
+
+
 _default_decoder = JSONDecoder(object_hook=None, object_pairs_hook=None)
 
 
@@ -296,6 +326,30 @@ def load(fp, *, cls=None, object_hook=None, parse_float=None,
         parse_constant=parse_constant, object_pairs_hook=object_pairs_hook, **kw)
 
 
+def iterload(fp, *, array=False, cls=None, chunk_size=65536, **kw):
+    """Iterate over the JSON values in ``fp``, a ``.read()``-supporting
+    file-like object, without reading it into memory at once.
+
+    By default ``fp`` holds a sequence of whitespace separated values, such
+    as newline-delimited JSON.  If ``array`` is true it must hold a single
+    JSON array, and its elements are yielded instead.  ``fp`` may be opened
+    in text or binary mode; binary data must be UTF-8.
+
+    ``fp`` is read ``chunk_size`` bytes or characters at a time, and only
+    the value being decoded is held in memory.  The other keyword arguments
+    have the same meaning as in ``load()``.
+    """
+    if cls is None:
+        cls = JSONDecoder
+    decoder = IncrementalDecoder(cls(**kw), array=array)
+    while True:
+        chunk = fp.read(chunk_size)
+        if not chunk:
+            break
+        yield from decoder.feed(chunk)
+    yield from decoder.close()
+
+
 def loads(s, *, cls=None, object_hook=None, parse_float=None,
         parse_int=None, parse_constant=None, object_pairs_hook=None, **kw):
     """Deserialize ``s`` (a ``str``, ``bytes`` or ``bytearray`` instance
@@ -7,8 +7,12 @@
     from _json import scanstring as c_scanstring
 except ImportError:
     c_scanstring = None
+try:
+    from _json import make_splitter as c_make_splitter
+except ImportError:
+    c_make_splitter = None
 
-__all__ = ['JSONDecoder', 'JSONDecodeError']
+__all__ = ['JSONDecoder', 'JSONDecodeError', 'IncrementalDecoder']
 
 FLAGS = re.VERBOSE | re.MULTILINE | re.DOTALL
 
@@ -354,3 +358,193 @@ def raw_decode(self, s, idx=0):
         except StopIteration as err:
             raise JSONDecodeError("Expecting value", s, err.value) from None
         return obj, end
+
+
+_SPLIT_WS = frozenset(b' \t\n\r')
+_SPLIT_SCALAR_END = frozenset(b' \t\n\r,]}[{"')
+(_ARRAY_START, _ARRAY_FIRST, _ARRAY_NEXT, _ARRAY_VALUE, _ARRAY_END,
+ _VALUES) = range(6)
+
+
+class py_make_splitter(object):
+    """Split a UTF-8 encoded byte stream into JSON records.
+
+    Each record is a top-level value, or with *array* true an element of
+    a single top-level array, returned as a ``str`` for a decoder to parse.
+    Only the bytes of the record in progress are retained between calls.
+
+    """
+    def __init__(self, *, array=False):
+        self._buf = bytearray()
+        self._pos = 0
+        self._start = -1
+        self._depth = 0
+        self._in_string = False
+        self._escape = False
+        self._scalar = False
+        self._started = False
+        self._array = bool(array)
+        self._state = _ARRAY_START if array else _VALUES
+
+    def _error(self, msg, end):
+        doc = self._buf[:end].decode('utf-8', 'replace')
+        raise JSONDecodeError(msg, doc, len(doc))
+
+    def _emit(self, result, end):
+        result.append(self._buf[self._start:end].decode('utf-8',
+                                                        'surrogatepass'))
+        self._start = -1
+        self._scalar = False
+        if self._array:
+            self._state = _ARRAY_NEXT
+
+    def feed(self, data):
+        """Add *data* and return the list of records it completed."""
+        buf = self._buf
+        buf += data
+        result = []
+        if not self._started:
+            # Skip a UTF-8 byte order mark, like json.loads() does.
+            if b'\xef\xbb\xbf'.startswith(buf[:3]):
+                if len(buf) < 3:
+                    return result
+                self._pos = 3
+            self._started = True
+        i = self._pos
+        n = len(buf)
+        while i < n:
+            c = buf[i]
+            if self._start >= 0:
+                if self._in_string:
+                    if self._escape:
+                        self._escape = False
+                    elif c == 0x5c:     # backslash
+                        self._escape = True
+                    elif c == 0x22:     # '"'
+                        self._in_string = False
+                        if not self._depth:
+                            self._emit(result, i + 1)
+                    i += 1
+                    continue
+                if not self._scalar:
+                    if c == 0x22:
+                        self._in_string = True
+                    elif c in b'[{':
+                        self._depth += 1
+                    elif c in b']}':
+                        self._depth -= 1
+                        if not self._depth:
+                            self._emit(result, i + 1)
+                    i += 1
+                    continue
+                # A number or literal ends at the first byte that cannot be
+                # part of it; that byte is examined again below.
+                if c not in _SPLIT_SCALAR_END:
+                    i += 1
+                    continue
+                self._emit(result, i)
+
+            if c in _SPLIT_WS:
+                i += 1
+                continue
+            state = self._state
+            if state == _ARRAY_START:
+                if c != 0x5b:           # '['
+                    self._error("Expecting '['", i)
+                self._state = _ARRAY_FIRST
+                i += 1
+                continue
+            elif state == _ARRAY_FIRST:
+                if c == 0x5d:           # ']'
+                    self._state = _ARRAY_END
+                    i += 1
+                    continue
+            elif state == _ARRAY_NEXT:
+                if c == 0x2c:           # ','
+                    self._state = _ARRAY_VALUE
+                elif c == 0x5d:
+                    self._state = _ARRAY_END
+                else:
+                    self._error("Expecting ',' delimiter", i)
+                i += 1
+                continue
+            elif state == _ARRAY_VALUE:
+                if c == 0x5d:
+                    self._error("Expecting value", i)
+            elif state == _ARRAY_END:
+                self._error("Extra data", i)
+
+            # Start a new record.
+            self._start = i
+            if c == 0x22:
+                self._in_string = True
+            elif c in b'[{':
+                self._depth = 1
+            elif c in b']},':
+                self._error("Expecting value", i)
+            else:
+                self._scalar = True
+            i += 1
+
+        # Drop the bytes that no longer belong to any record.
+        keep = self._start if self._start >= 0 else i
+        del buf[:keep]
+        self._pos = i - keep
+        if self._start >= 0:
+            self._start = 0
+        return result
+
+    def close(self):
+        """Return the list of remaining records and reset the buffer."""
+        result = []
+        if self._start >= 0:
+            if not self._scalar:
+                self._error("Unterminated string" if self._in_string
+                            else "Unterminated value", len(self._buf))
+            self._emit(result, len(self._buf))
+        if self._array and self._state != _ARRAY_END:
+            self._error("Expecting value" if self._state == _ARRAY_START
+                        else "Unterminated array", len(self._buf))
+        del self._buf[:]
+        self._pos = 0
+        return result
+
+
+make_splitter = c_make_splitter or py_make_splitter
+
+
+class IncrementalDecoder(object):
+    """Decode a stream of JSON values fed in chunks.
+
+    Chunks may be ``bytes`` in UTF-8 or ``str``.  Each call to ``feed()``
+    or ``close()`` returns the list of values completed so far: the
+    whitespace separated top-level values of the stream (such as
+    newline-delimited JSON), or with *array* true the elements of a single
+    top-level array.  Records are parsed with *decoder*, a
+    :class:`JSONDecoder` instance created with default arguments if omitted.
+
+    A JSONDecodeError raised for invalid data carries only the record (or
+    the unconsumed input) as its ``doc``, and its position is relative to
+    that text rather than to the whole stream.
+
+    """
+    def __init__(self, decoder=None, *, array=False):
+        if decoder is None:
+            decoder = JSONDecoder()
+        self.decoder = decoder
+        self.splitter = make_splitter(array=array)
+
+    def feed(self, data):
+        """Add *data* and return the list of values it completed."""
+        if isinstance(data, str):
+            data = data.encode('utf-8', 'surrogatepass')
+        decode = self.decoder.decode
+        return [decode(record) for record in self.splitter.feed(data)]
+
+    def close(self):
+        """Return the list of remaining values.
+
+        Raise :exc:`JSONDecodeError` if the stream ends inside a value.
+        """
+        decode = self.decoder.decode
+        return [decode(record) for record in self.splitter.close()]
@@ -201,6 +201,37 @@ def encode(self, o):
             chunks = list(chunks)
         return ''.join(chunks)
 
+    def encode_bytes(self, o, write=None):
+        """Return the JSON representation of a Python data structure as
+        UTF-8 encoded bytes.
+
+        If *write* is given, it is called with successive chunks of the
+        output instead, and None is returned.
+
+        >>> from json.encoder import JSONEncoder
+        >>> JSONEncoder().encode_bytes({"foo": ["bar", "baz"]})
+        b'{"foo": ["bar", "baz"]}'
+
+        """
+        if c_make_encoder is not None and self.indent is None:
+            if self.check_circular:
+                markers = {}
+            else:
+                markers = None
+            if self.ensure_ascii:
+                _encoder = encode_basestring_ascii
+            else:
+                _encoder = encode_basestring
+            _encode = c_make_encoder(
+                markers, self.default, _encoder, self.indent,
+                self.key_separator, self.item_separator, self.sort_keys,
+                self.skipkeys, self.allow_nan).encode_bytes
+            return _encode(o, write)
+        data = self.encode(o).encode('utf-8')
+        if write is None:
+            return data
+        write(data)
+
     def iterencode(self, o, _one_shot=False):
         """Encode the given object and yield each string
         representation as available.
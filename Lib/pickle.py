@@ -30,7 +30,7 @@
 from functools import partial
 import sys
 from sys import maxsize
-from struct import pack, unpack
+from struct import pack, unpack, error as struct_error
 import re
 import io
 import codecs
@@ -194,6 +194,12 @@ def __init__(self, value):
 NEXT_BUFFER      = b'\x97'  # push next out-of-band buffer
 READONLY_BUFFER  = b'\x98'  # make top of stack readonly
 
+# Packed lists, protocol 5 extension
+
+PACKED_INT64     = b'\x99'  # push list of 64-bit ints
+PACKED_FLOAT64   = b'\x9a'  # push list of floats
+PACKED_LATIN1    = b'\x9b'  # push list of short latin-1 strs
+
 __all__.extend([x for x in dir() if re.match("[A-Z][A-Z0-9_]+$", x)])
 
 
@@ -260,6 +266,33 @@ def write_large_bytes(self, header, payload):
         write(payload)
 
 
+class _BufferReader:
+    """Minimal binary file reading a bytes-like object without copying it."""
+
+    def __init__(self, buffer):
+        self._buffer = memoryview(buffer).cast('B')
+        self._pos = 0
+
+    def read(self, n=-1):
+        start = self._pos
+        end = len(self._buffer) if n < 0 else min(start + n, len(self._buffer))
+        self._pos = end
+        return bytes(self._buffer[start:end])
+
+    def readline(self):
+        buffer = self._buffer
+        start = pos = self._pos
+        while pos < len(buffer):
+            chunk = bytes(buffer[pos:pos + 256])
+            i = chunk.find(b'\n')
+            if i >= 0:
+                pos += i + 1
+                break
+            pos += len(chunk)
+        self._pos = pos
+        return bytes(buffer[start:pos])
+
+
 class _Unframer:
 
     def __init__(self, file_read, file_readline, file_tell=None):
@@ -407,7 +440,7 @@ def decode_long(data):
 class _Pickler:
 
     def __init__(self, file, protocol=None, *, fix_imports=True,
-                 buffer_callback=None):
+                 buffer_callback=None, packed=False):
         """This takes a binary file for writing a pickle data stream.
 
         The optional *protocol* argument tells the pickler to use the
@@ -440,6 +473,10 @@ def __init__(self, file, protocol=None, *, fix_imports=True,
 
         It is an error if *buffer_callback* is not None and *protocol*
         is None or smaller than 5.
+
+        If *packed* is true, lists of ints that fit in 64 bits, of
+        floats, or of Latin-1 strings shorter than 256 characters are
+        pickled with compact packed opcodes.  It requires protocol 5.
         """
         if protocol is None:
             protocol = DEFAULT_PROTOCOL
@@ -450,6 +487,9 @@ def __init__(self, file, protocol=None, *, fix_imports=True,
         if buffer_callback is not None and protocol < 5:
             raise ValueError("buffer_callback needs protocol >= 5")
         self._buffer_callback = buffer_callback
+        if packed and protocol < 5:
+            raise ValueError("packed needs protocol >= 5")
+        self._packed = packed
         try:
             self._file_write = file.write
         except AttributeError:
@@ -923,6 +963,14 @@ def save_tuple(self, obj):
     dispatch[tuple] = save_tuple
 
     def save_list(self, obj):
+        # Packed elements bypass save(), so a persistent_id() hook must
+        # see them one by one instead.
+        if (self._packed and
+                getattr(self.persistent_id, '__func__', None)
+                    is _Pickler.persistent_id and
+                self._save_packed_list(obj)):
+            self.memoize(obj)
+            return
         if self.bin:
             self.write(EMPTY_LIST)
         else:   # proto 0 -- can't use EMPTY_LIST
@@ -934,6 +982,39 @@ def save_list(self, obj):
     dispatch[list] = save_list
 
     _BATCHSIZE = 1000
+    _PACKED_MIN_LEN = 16
+
+    def _save_packed_list(self, obj):
+        # Save a list of exact ints, floats or short latin-1 strs with a
+        # single packed opcode.  Return false if the list doesn't qualify.
+        n = len(obj)
+        if n < self._PACKED_MIN_LEN:
+            return False
+        t = type(obj[0])
+        if t not in (int, float, str):
+            return False
+        for x in obj:
+            if type(x) is not t:
+                return False
+        try:
+            if t is int:
+                op = PACKED_INT64
+                data = pack('<%dq' % n, *obj)
+            elif t is float:
+                op = PACKED_FLOAT64
+                data = pack('<%dd' % n, *obj)
+            else:
+                op = PACKED_LATIN1
+                encoded = [x.encode('latin-1') for x in obj]
+                data = bytes(map(len, encoded)) + b''.join(encoded)
+        except (struct_error, UnicodeEncodeError, ValueError):
+            return False
+        header = op + pack('<Q', n)
+        if len(data) >= self.framer._FRAME_SIZE_TARGET:
+            self._write_large_bytes(header, data)
+        else:
+            self.write(header + data)
+        return True
 
     def _batch_appends(self, items):
         # Helper to batch up APPENDS sequences
@@ -1137,7 +1218,7 @@ def save_type(self, obj):
 class _Unpickler:
 
     def __init__(self, file, *, fix_imports=True,
-                 encoding="ASCII", errors="strict", buffers=None):
+                 encoding="ASCII", errors="strict", buffers=None, memo=True):
         """This takes a binary file for reading a pickle data stream.
 
         The protocol version of the pickle is detected automatically, so
@@ -1154,7 +1235,14 @@ def __init__(self, file, *, fix_imports=True,
         requires no arguments.  Both methods should return bytes.
         Thus file-like object can be a binary file object opened for
         reading, a BytesIO object, or any other custom object that
-        meets this interface.
+        meets this interface.  *file* can also be a bytes-like object.
+
+        If *memo* is false, the memo is not maintained.  This is faster
+        for pickles without shared or recursive references, but such
+        references cannot be loaded.
+
+        The unpickler is an iterator over the successive pickles of the
+        stream, which ends cleanly at the end of the input.
 
         If *buffers* is not None, it should be an iterable of buffer-enabled
         objects that is consumed each time the pickle stream references
@@ -1176,8 +1264,14 @@ def __init__(self, file, *, fix_imports=True,
         'bytes' to read theses 8-bit string instances as bytes objects.
         """
         self._buffers = iter(buffers) if buffers is not None else None
+        if not hasattr(file, 'read'):
+            try:
+                file = _BufferReader(file)
+            except TypeError:
+                pass
         self._file_readline = file.readline
         self._file_read = file.read
+        self._use_memo = memo
         self.memo = {}
         self.encoding = encoding
         self.errors = errors
@@ -1189,6 +1283,20 @@ def load(self):
 
         Return the reconstituted object hierarchy specified in the file.
         """
+        self._start_load()
+        return self._load(self.read(1))
+
+    def __iter__(self):
+        return self
+
+    def __next__(self):
+        self._start_load()
+        key = self.read(1)
+        if not key:
+            raise StopIteration
+        return self._load(key)
+
+    def _start_load(self):
         # Check whether Unpickler was initialized correctly. This is
         # only needed to mimic the behavior of _pickle.Unpickler.dump().
         if not hasattr(self, "_file_read"):
@@ -1202,15 +1310,17 @@ def load(self):
         self.stack = []
         self.append = self.stack.append
         self.proto = 0
+
+    def _load(self, key):
         read = self.read
         dispatch = self.dispatch
         try:
             while True:
-                key = read(1)
                 if not key:
                     raise EOFError
                 assert isinstance(key, bytes_types)
                 dispatch[key[0]](self)
+                key = read(1)
         except _Stop as stopinst:
             return stopinst.value
 
@@ -1411,6 +1521,35 @@ def load_readonly_buffer(self):
                 self.stack[-1] = m.toreadonly()
     dispatch[READONLY_BUFFER[0]] = load_readonly_buffer
 
+    def _read_packed_count(self):
+        n, = unpack('<Q', self.read(8))
+        if n > maxsize // 8:
+            raise UnpicklingError("packed list exceeds system's maximum "
+                                  "size of %d bytes" % maxsize)
+        return n
+
+    def load_packed_int64(self):
+        n = self._read_packed_count()
+        self.append(list(unpack('<%dq' % n, self.read(8 * n))))
+    dispatch[PACKED_INT64[0]] = load_packed_int64
+
+    def load_packed_float64(self):
+        n = self._read_packed_count()
+        self.append(list(unpack('<%dd' % n, self.read(8 * n))))
+    dispatch[PACKED_FLOAT64[0]] = load_packed_float64
+
+    def load_packed_latin1(self):
+        n = self._read_packed_count()
+        lengths = self.read(n)
+        data = str(self.read(sum(lengths)), 'latin-1')
+        result = []
+        i = 0
+        for size in lengths:
+            result.append(data[i:i + size])
+            i += size
+        self.append(result)
+    dispatch[PACKED_LATIN1[0]] = load_packed_latin1
+
     def load_short_binstring(self):
         len = self.read(1)[0]
         data = self.read(len)
@@ -1636,26 +1775,30 @@ def load_put(self):
         i = int(self.readline()[:-1])
         if i < 0:
             raise ValueError("negative PUT argument")
-        self.memo[i] = self.stack[-1]
+        if self._use_memo:
+            self.memo[i] = self.stack[-1]
     dispatch[PUT[0]] = load_put
 
     def load_binput(self):
         i = self.read(1)[0]
         if i < 0:
             raise ValueError("negative BINPUT argument")
-        self.memo[i] = self.stack[-1]
+        if self._use_memo:
+            self.memo[i] = self.stack[-1]
     dispatch[BINPUT[0]] = load_binput
 
     def load_long_binput(self):
         i, = unpack('<I', self.read(4))
         if i > maxsize:
             raise ValueError("negative LONG_BINPUT argument")
-        self.memo[i] = self.stack[-1]
+        if self._use_memo:
+            self.memo[i] = self.stack[-1]
     dispatch[LONG_BINPUT[0]] = load_long_binput
 
     def load_memoize(self):
-        memo = self.memo
-        memo[len(memo)] = self.stack[-1]
+        if self._use_memo:
+            memo = self.memo
+            memo[len(memo)] = self.stack[-1]
     dispatch[MEMOIZE[0]] = load_memoize
 
     def load_append(self):
@@ -1747,14 +1890,16 @@ def load_stop(self):
 
 # Shorthands
 
-def _dump(obj, file, protocol=None, *, fix_imports=True, buffer_callback=None):
+def _dump(obj, file, protocol=None, *, fix_imports=True, buffer_callback=None,
+          packed=False):
     _Pickler(file, protocol, fix_imports=fix_imports,
-             buffer_callback=buffer_callback).dump(obj)
+             buffer_callback=buffer_callback, packed=packed).dump(obj)
 
-def _dumps(obj, protocol=None, *, fix_imports=True, buffer_callback=None):
+def _dumps(obj, protocol=None, *, fix_imports=True, buffer_callback=None,
+           packed=False):
     f = io.BytesIO()
     _Pickler(f, protocol, fix_imports=fix_imports,
-             buffer_callback=buffer_callback).dump(obj)
+             buffer_callback=buffer_callback, packed=packed).dump(obj)
     res = f.getvalue()
     assert isinstance(res, bytes_types)
     return res
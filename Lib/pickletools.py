@@ -600,6 +600,95 @@ def read_bytearray8(f):
               the number of bytes, and the second argument is that many bytes.
               """)
 
+def _read_packed(f, itemsize, name):
+    n = read_uint8(f)
+    if n > sys.maxsize // itemsize:
+        raise ValueError("%s item count > sys.maxsize: %d" % (name, n))
+    data = f.read(n * itemsize)
+    if len(data) == n * itemsize:
+        return n, data
+    raise ValueError("expected %d bytes in a %s, but only %d remain" %
+                     (n * itemsize, name, len(data)))
+
+def read_packedint64(f):
+    r"""
+    >>> import io
+    >>> read_packedint64(io.BytesIO(b"\x02\x00\x00\x00\x00\x00\x00\x00"
+    ...                             b"\x01\x00\x00\x00\x00\x00\x00\x00"
+    ...                             b"\xff\xff\xff\xff\xff\xff\xff\xff"))
+    [1, -1]
+    """
+
+    n, data = _read_packed(f, 8, "packedint64")
+    return list(_unpack("<%dq" % n, data))
+
+packedint64 = ArgumentDescriptor(
+                name="packedint64",
+                n=TAKEN_FROM_ARGUMENT8U,
+                reader=read_packedint64,
+                doc="""A counted array of 64-bit signed ints.
+
+                The first argument is an 8-byte little-endian unsigned int
+                giving the number of items, and the second argument is that
+                many 8-byte little-endian signed ints.
+                """)
+
+def read_packedfloat64(f):
+    r"""
+    >>> import io
+    >>> read_packedfloat64(io.BytesIO(b"\x01\x00\x00\x00\x00\x00\x00\x00"
+    ...                               b"\x00\x00\x00\x00\x00\x00\xf8\x3f"))
+    [1.5]
+    """
+
+    n, data = _read_packed(f, 8, "packedfloat64")
+    return list(_unpack("<%dd" % n, data))
+
+packedfloat64 = ArgumentDescriptor(
+                  name="packedfloat64",
+                  n=TAKEN_FROM_ARGUMENT8U,
+                  reader=read_packedfloat64,
+                  doc="""A counted array of floats.
+
+                  The first argument is an 8-byte little-endian unsigned int
+                  giving the number of items, and the second argument is that
+                  many 8-byte little-endian IEEE-754 doubles.
+                  """)
+
+def read_packedlatin1(f):
+    r"""
+    >>> import io
+    >>> read_packedlatin1(io.BytesIO(b"\x02\x00\x00\x00\x00\x00\x00\x00"
+    ...                              b"\x02\x01abc"))
+    ['ab', 'c']
+    """
+
+    n, lengths = _read_packed(f, 1, "packedlatin1")
+    size = sum(lengths)
+    data = f.read(size)
+    if len(data) != size:
+        raise ValueError("expected %d bytes in a packedlatin1, but only %d "
+                         "remain" % (size, len(data)))
+    data = str(data, "latin-1")
+    result = []
+    i = 0
+    for length in lengths:
+        result.append(data[i:i + length])
+        i += length
+    return result
+
+packedlatin1 = ArgumentDescriptor(
+                 name="packedlatin1",
+                 n=TAKEN_FROM_ARGUMENT8U,
+                 reader=read_packedlatin1,
+                 doc="""A counted array of short Latin-1 strings.
+
+                 The first argument is an 8-byte little-endian unsigned int
+                 giving the number of strings n.  It is followed by n 1-byte
+                 string lengths, then by the Latin-1 encoded characters of
+                 all n strings, concatenated.
+                 """)
+
 def read_unicodestringnl(f):
     r"""
     >>> import io
@@ -1559,6 +1648,43 @@ def __init__(self, name, code, arg,
       Stack after:  ... [1, 2, 3, 'abc']
       """),
 
+    I(name='PACKED_INT64',
+      code='\x99',
+      arg=packedint64,
+      stack_before=[],
+      stack_after=[pylist],
+      proto=5,
+      doc="""Push a list of ints.
+
+      The argument gives the items as 8-byte signed ints.  Written by
+      picklers created with packed=True for lists of ints in that range.
+      """),
+
+    I(name='PACKED_FLOAT64',
+      code='\x9a',
+      arg=packedfloat64,
+      stack_before=[],
+      stack_after=[pylist],
+      proto=5,
+      doc="""Push a list of floats.
+
+      The argument gives the items as 8-byte IEEE-754 doubles.  Written by
+      picklers created with packed=True for lists of floats.
+      """),
+
+    I(name='PACKED_LATIN1',
+      code='\x9b',
+      arg=packedlatin1,
+      stack_before=[],
+      stack_after=[pylist],
+      proto=5,
+      doc="""Push a list of strings.
+
+      The argument gives the lengths and characters of the items.  Written
+      by picklers created with packed=True for lists of strings of at most
+      255 Latin-1 characters.
+      """),
+
     # Ways to build tuples.
 
     I(name='EMPTY_TUPLE',
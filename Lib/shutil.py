@@ -32,6 +32,11 @@
 except ImportError:
     _LZMA_SUPPORTED = False
 
+try:
+    import fcntl
+except ImportError:
+    fcntl = None
+
 _WINDOWS = os.name == 'nt'
 posix = nt = None
 if os.name == 'posix':
@@ -40,6 +45,8 @@
     import nt
 
 COPY_BUFSIZE = 1024 * 1024 if _WINDOWS else 64 * 1024
+_USE_CP_FICLONE = hasattr(fcntl, "FICLONE") and sys.platform.startswith("linux")
+_USE_CP_COPY_FILE_RANGE = hasattr(os, "copy_file_range")
 _USE_CP_SENDFILE = hasattr(os, "sendfile") and sys.platform.startswith("linux")
 _HAS_FCOPYFILE = posix and hasattr(posix, "_fcopyfile")  # macOS
 
@@ -101,6 +108,88 @@ def _fastcopy_fcopyfile(fsrc, fdst, flags):
         else:
             raise err from None
 
+def _fastcopy_ficlone(fsrc, fdst):
+    """Make fdst share the data blocks of fsrc (a "reflink") by using the
+    FICLONE ioctl(2).  This is much faster than copying and takes no extra
+    space, but only works within one file system that supports it (e.g.
+    Btrfs or XFS).
+    """
+    try:
+        infd = fsrc.fileno()
+        outfd = fdst.fileno()
+    except Exception as err:
+        raise _GiveupOnFastCopy(err)  # not a regular file
+
+    try:
+        fcntl.ioctl(outfd, fcntl.FICLONE, infd)
+    except OSError as err:
+        # Not supported by the file system, or the files are on different
+        # file systems.  Nothing was written: copy the data instead.
+        raise _GiveupOnFastCopy(err)
+
+def _fastcopy_blocksize(infd):
+    # Hopefully the whole file will be copied in a single call.
+    # The copy function is called in a loop 'till EOF is reached (0 return)
+    # so a bufsize smaller or bigger than the actual file size
+    # should not make any difference, also in case the file content
+    # changes while being copied.
+    try:
+        blocksize = max(os.fstat(infd).st_size, 2 ** 23)  # min 8MiB
+    except OSError:
+        blocksize = 2 ** 27  # 128MiB
+    # On 32-bit architectures truncate to 1GiB to avoid OverflowError,
+    # see bpo-38319.
+    if sys.maxsize < 2 ** 32:
+        blocksize = min(blocksize, 2 ** 30)
+    return blocksize
+
+def _fastcopy_copy_file_range(fsrc, fdst):
+    """Copy data from one regular file to another by using the
+    copy_file_range(2) syscall, which lets the file system copy the data
+    itself (server-side on network file systems) and may share blocks.
+    This should work on Linux >= 4.5 only.
+    """
+    global _USE_CP_COPY_FILE_RANGE
+    try:
+        infd = fsrc.fileno()
+        outfd = fdst.fileno()
+    except Exception as err:
+        raise _GiveupOnFastCopy(err)  # not a regular file
+
+    blocksize = _fastcopy_blocksize(infd)
+    offset = 0
+    while True:
+        try:
+            sent = os.copy_file_range(infd, outfd, blocksize)
+        except OSError as err:
+            # ...in oder to have a more informative exception.
+            err.filename = fsrc.name
+            err.filename2 = fdst.name
+
+            if err.errno == errno.ENOSYS:
+                # The kernel does not implement copy_file_range().
+                _USE_CP_COPY_FILE_RANGE = False
+                raise _GiveupOnFastCopy(err)
+
+            if err.errno == errno.ENOSPC:  # filesystem is full
+                raise err from None
+
+            # Give up on first call and if no data was copied (e.g. EXDEV
+            # from kernels which only copy within a file system).
+            if offset == 0:
+                raise _GiveupOnFastCopy(err)
+
+            raise err
+        else:
+            if sent == 0:
+                # Files of pseudo file systems such as procfs report a size
+                # of 0 and copy_file_range() copies nothing from them:
+                # let the fallback read them.
+                if offset == 0:
+                    raise _GiveupOnFastCopy()
+                break  # EOF
+            offset += sent
+
 def _fastcopy_sendfile(fsrc, fdst):
     """Copy data from one regular mmap-like fd to another by using
     high-performance sendfile(2) syscall.
@@ -122,20 +211,7 @@ def _fastcopy_sendfile(fsrc, fdst):
     except Exception as err:
         raise _GiveupOnFastCopy(err)  # not a regular file
 
-    # Hopefully the whole file will be copied in a single call.
-    # sendfile() is called in a loop 'till EOF is reached (0 return)
-    # so a bufsize smaller or bigger than the actual file size
-    # should not make any difference, also in case the file content
-    # changes while being copied.
-    try:
-        blocksize = max(os.fstat(infd).st_size, 2 ** 23)  # min 8MiB
-    except OSError:
-        blocksize = 2 ** 27  # 128MiB
-    # On 32-bit architectures truncate to 1GiB to avoid OverflowError,
-    # see bpo-38319.
-    if sys.maxsize < 2 ** 32:
-        blocksize = min(blocksize, 2 ** 30)
-
+    blocksize = _fastcopy_blocksize(infd)
     offset = 0
     while True:
         try:
@@ -259,13 +335,27 @@ def copyfile(src, dst, *, follow_symlinks=True):
                     return dst
                 except _GiveupOnFastCopy:
                     pass
-            # Linux
-            elif _USE_CP_SENDFILE:
-                try:
-                    _fastcopy_sendfile(fsrc, fdst)
-                    return dst
-                except _GiveupOnFastCopy:
-                    pass
+            # Linux: share the data blocks, else copy them in the kernel
+            elif (_USE_CP_FICLONE or _USE_CP_COPY_FILE_RANGE or
+                  _USE_CP_SENDFILE):
+                if _USE_CP_FICLONE:
+                    try:
+                        _fastcopy_ficlone(fsrc, fdst)
+                        return dst
+                    except _GiveupOnFastCopy:
+                        pass
+                if _USE_CP_COPY_FILE_RANGE:
+                    try:
+                        _fastcopy_copy_file_range(fsrc, fdst)
+                        return dst
+                    except _GiveupOnFastCopy:
+                        pass
+                if _USE_CP_SENDFILE:
+                    try:
+                        _fastcopy_sendfile(fsrc, fdst)
+                        return dst
+                    except _GiveupOnFastCopy:
+                        pass
             # Windows, see:
             # https://github.com/python/cpython/pull/7160#discussion_r195405230
             elif _WINDOWS and file_size > 0:
@@ -438,8 +528,56 @@ def _ignore_patterns(path, names):
         return set(ignored_names)
     return _ignore_patterns
 
+class _CopytreeWorkers:
+    """Copy the files of copytree(..., workers=n) with a thread pool.
+
+    The copies of at most a few per thread are in flight at any time.  The
+    metadata of the directories is copied at the end, since copying their
+    files would change it.
+    """
+
+    def __init__(self, pool, workers):
+        self._pool = pool
+        self._max_pending = workers * 16
+        self._pending = collections.deque()
+        self._dirs = []
+        self.errors = []
+
+    def copy(self, copy_function, srcobj, srcname, dstname):
+        future = self._pool.submit(copy_function, srcobj, dstname)
+        self._pending.append((srcname, dstname, future))
+        while len(self._pending) > self._max_pending:
+            self._wait()
+
+    def copystat(self, src, dst):
+        # Directories are registered after their sub-directories.
+        self._dirs.append((src, dst))
+
+    def _wait(self):
+        srcname, dstname, future = self._pending.popleft()
+        try:
+            future.result()
+        except Error as err:
+            self.errors.extend(err.args[0])
+        except OSError as why:
+            self.errors.append((srcname, dstname, str(why)))
+
+    def finish(self):
+        while self._pending:
+            self._wait()
+        for src, dst in self._dirs:
+            _copytree_copystat(src, dst, self.errors)
+
+def _copytree_copystat(src, dst, errors):
+    try:
+        copystat(src, dst)
+    except OSError as why:
+        # Copying file access times may fail on Windows
+        if getattr(why, 'winerror', None) is None:
+            errors.append((src, dst, str(why)))
+
 def _copytree(entries, src, dst, symlinks, ignore, copy_function,
-              ignore_dangling_symlinks, dirs_exist_ok=False):
+              ignore_dangling_symlinks, dirs_exist_ok=False, copier=None):
     if ignore is not None:
         ignored_names = ignore(os.fspath(src), [x.name for x in entries])
     else:
@@ -477,13 +615,18 @@ def _copytree(entries, src, dst, symlinks, ignore, copy_function,
                         continue
                     # otherwise let the copy occur. copy2 will raise an error
                     if srcentry.is_dir():
-                        copytree(srcobj, dstname, symlinks, ignore,
-                                 copy_function, dirs_exist_ok=dirs_exist_ok)
+                        _copytree_scandir(srcobj, dstname, symlinks, ignore,
+                                          copy_function,
+                                          dirs_exist_ok=dirs_exist_ok,
+                                          copier=copier)
                     else:
                         copy_function(srcobj, dstname)
             elif srcentry.is_dir():
-                copytree(srcobj, dstname, symlinks, ignore, copy_function,
-                         dirs_exist_ok=dirs_exist_ok)
+                _copytree_scandir(srcobj, dstname, symlinks, ignore,
+                                  copy_function, dirs_exist_ok=dirs_exist_ok,
+                                  copier=copier)
+            elif copier is not None:
+                copier.copy(copy_function, srcobj, srcname, dstname)
             else:
                 # Will raise a SpecialFileError for unsupported file types
                 copy_function(srcobj, dstname)
@@ -493,18 +636,31 @@ def _copytree(entries, src, dst, symlinks, ignore, copy_function,
             errors.extend(err.args[0])
         except OSError as why:
             errors.append((srcname, dstname, str(why)))
-    try:
-        copystat(src, dst)
-    except OSError as why:
-        # Copying file access times may fail on Windows
-        if getattr(why, 'winerror', None) is None:
-            errors.append((src, dst, str(why)))
+    if copier is not None:
+        copier.copystat(src, dst)
+    else:
+        _copytree_copystat(src, dst, errors)
     if errors:
         raise Error(errors)
     return dst
 
+def _copytree_scandir(src, dst, symlinks=False, ignore=None,
+                      copy_function=copy2, ignore_dangling_symlinks=False,
+                      dirs_exist_ok=False, copier=None):
+    sys.audit("shutil.copytree", src, dst)
+    # copy2() and copy() use the stat results of the entries: fetch them
+    # while reading the directory rather than one at a time.
+    prefetch_stat = copy_function is copy2 or copy_function is copy
+    with os.scandir(src, stat=prefetch_stat) as itr:
+        entries = list(itr)
+    return _copytree(entries=entries, src=src, dst=dst, symlinks=symlinks,
+                     ignore=ignore, copy_function=copy_function,
+                     ignore_dangling_symlinks=ignore_dangling_symlinks,
+                     dirs_exist_ok=dirs_exist_ok, copier=copier)
+
 def copytree(src, dst, symlinks=False, ignore=None, copy_function=copy2,
-             ignore_dangling_symlinks=False, dirs_exist_ok=False):
+             ignore_dangling_symlinks=False, dirs_exist_ok=False, *,
+             workers=None):
     """Recursively copy a directory tree and return the destination directory.
 
     dirs_exist_ok dictates whether to raise an exception in case dst or any
@@ -540,14 +696,31 @@ def copytree(src, dst, symlinks=False, ignore=None, copy_function=copy2,
     destination path as arguments. By default, copy2() is used, but any
     function that supports the same signature (like copy()) can be used.
 
+    If the optional workers argument is given, files are copied
+    concurrently by a pool of that many threads, and the metadata of the
+    directories is copied once all the files have been copied.
+
     """
-    sys.audit("shutil.copytree", src, dst)
-    with os.scandir(src) as itr:
-        entries = list(itr)
-    return _copytree(entries=entries, src=src, dst=dst, symlinks=symlinks,
-                     ignore=ignore, copy_function=copy_function,
-                     ignore_dangling_symlinks=ignore_dangling_symlinks,
-                     dirs_exist_ok=dirs_exist_ok)
+    if workers is None:
+        return _copytree_scandir(src, dst, symlinks, ignore, copy_function,
+                                 ignore_dangling_symlinks, dirs_exist_ok)
+    if workers <= 0:
+        raise ValueError("workers must be greater than 0")
+
+    from concurrent.futures import ThreadPoolExecutor
+    with ThreadPoolExecutor(workers,
+                            thread_name_prefix='shutil.copytree') as pool:
+        copier = _CopytreeWorkers(pool, workers)
+        try:
+            _copytree_scandir(src, dst, symlinks, ignore, copy_function,
+                              ignore_dangling_symlinks, dirs_exist_ok,
+                              copier=copier)
+        except Error as err:
+            copier.errors.extend(err.args[0])
+        copier.finish()
+    if copier.errors:
+        raise Error(copier.errors)
+    return dst
 
 if hasattr(os.stat_result, 'st_file_attributes'):
     # Special handling for directory junctions to make them behave like
@@ -1060,6 +1060,25 @@ def test_bytearray8(self):
         dumped = b'\x80\x05\x96\x03\x00\x00\x00\x00\x00\x00\x00xxx.'
         self.assertEqual(self.loads(dumped), bytearray(b'xxx'))
 
+    def test_packed_lists(self):
+        dumped = (b'\x80\x05\x99\x02\0\0\0\0\0\0\0'
+                  b'\x01\0\0\0\0\0\0\0\xfe\xff\xff\xff\xff\xff\xff\xff.')
+        self.assertEqual(self.loads(dumped), [1, -2])
+        dumped = (b'\x80\x05\x9a\x01\0\0\0\0\0\0\0'
+                  b'\0\0\0\0\0\0\xf8\x3f.')
+        self.assertEqual(self.loads(dumped), [1.5])
+        dumped = (b'\x80\x05\x9b\x03\0\0\0\0\0\0\0'
+                  b'\x02\x00\x01ab\xe9.')
+        self.assertEqual(self.loads(dumped), ['ab', '', '\xe9'])
+        dumped = b'\x80\x05\x99\0\0\0\0\0\0\0\0.'
+        self.assertEqual(self.loads(dumped), [])
+
+    def test_truncated_packed_lists(self):
+        for dumped in [b'\x80\x05\x99\x02\0\0\0\0\0\0\0\x01\0\0\0.',
+                       b'\x80\x05\x9a\x01\0\0\0.',
+                       b'\x80\x05\x9b\x01\0\0\0\0\0\0\0\x05ab.']:
+            self.check_unpickling_error(self.truncated_errors, dumped)
+
     @requires_32b
     def test_large_32b_binbytes8(self):
         dumped = b'\x80\x04\x8e\4\0\0\0\1\0\0\0\xe2\x82\xac\x00.'
@@ -2901,6 +2920,50 @@ def buffer_callback(obj):
     # XXX Unfortunately cannot test non-contiguous array
     # (see comment in PicklableNDArray.__reduce_ex__)
 
+    def test_packed(self):
+        for proto in range(0, 5):
+            with self.assertRaises(ValueError):
+                self.dumps([1] * 20, proto, packed=True)
+        n = 100
+        cases = [
+            (list(range(-n, n)) + [2**63 - 1, -2**63], pickle.PACKED_INT64),
+            ([i / 3 for i in range(n)] + [float('inf'), -0.0],
+             pickle.PACKED_FLOAT64),
+            (['x' * (i % 256) for i in range(n)] + ['\xe9\xff', ''],
+             pickle.PACKED_LATIN1),
+        ]
+        for obj, opcode in cases:
+            for proto in range(5, pickle.HIGHEST_PROTOCOL + 1):
+                data = self.dumps(obj, proto, packed=True)
+                self.assertEqual(count_opcode(opcode, data), 1)
+                self.assertEqual(self.loads(data), obj)
+                self.assertEqual(count_opcode(opcode,
+                                              self.dumps(obj, proto)), 0)
+                # Shared references to a packed list are preserved.
+                data = self.dumps([obj, obj], proto, packed=True)
+                self.assertEqual(count_opcode(opcode, data), 1)
+                x, y = self.loads(data)
+                self.assertIs(x, y)
+                self.assertEqual(x, obj)
+
+    def test_packed_not_applicable(self):
+        n = 100
+        for obj in [[1] * 10,
+                    [1] * n + [2**63],
+                    [1] * n + [True],
+                    [1] * n + [1.0],
+                    [1.0] * n + [1],
+                    ['a'] * n + ['\u20ac'],
+                    ['a'] * n + ['a' * 256],
+                    [True] * n,
+                    MyList([1] * n)]:
+            for proto in range(5, pickle.HIGHEST_PROTOCOL + 1):
+                data = self.dumps(obj, proto, packed=True)
+                for opcode in (pickle.PACKED_INT64, pickle.PACKED_FLOAT64,
+                               pickle.PACKED_LATIN1):
+                    self.assertEqual(count_opcode(opcode, data), 0)
+                self.assert_is_copy(obj, self.loads(data))
+
     def test_oob_buffers(self):
         # Test out-of-band buffers (PEP 574)
         for obj in self.buffer_like_objects():
@@ -3451,6 +3514,18 @@ def test_persistence(self):
             self.assertEqual(self.load_count, 5)
             self.assertEqual(self.load_false_count, 1)
 
+    def test_persistence_packed(self):
+        # persistent_id() still sees the elements of a packable list.
+        L = list(range(20))
+        for proto in range(5, pickle.HIGHEST_PROTOCOL + 1):
+            self.id_count = 0
+            self.load_count = 0
+            data = self.dumps(L, proto, packed=True)
+            self.assertEqual(count_opcode(pickle.PACKED_INT64, data), 0)
+            self.assertEqual(self.loads(data), L)
+            self.assertEqual(self.id_count, 10)
+            self.assertEqual(self.load_count, 10)
+
 
 class AbstractIdentityPersistentPicklerTests(unittest.TestCase):
 
@@ -3626,6 +3701,71 @@ def test_multiple_unpicklings_minimal(self):
         # (bpo-39681)
         self._check_multiple_unpicklings(MinimalIO, seekable=False)
 
+    def _check_iter_unpickler(self, ioclass):
+        for proto in protocols:
+            with self.subTest(proto=proto, ioclass=ioclass):
+                # Several dump() calls of one Pickler share its memo.
+                objs = [[str(i)] * 3 + [{'k': str(i)}] * 2 for i in range(5)]
+                f = io.BytesIO()
+                pickler = self.pickler_class(f, proto)
+                shared = ['shared']
+                for obj in objs:
+                    pickler.dump([shared, obj])
+                pickler.dump(shared)
+                pickled = f.getvalue()
+                expected = [[shared, obj] for obj in objs] + [shared]
+                unpickler = self.unpickler_class(ioclass(pickled))
+                result = list(unpickler)
+                self.assertEqual(result, expected)
+                self.assertIs(result[0][0], result[-1])
+                self.assertEqual(list(unpickler), [])
+                unpickler = self.unpickler_class(ioclass(pickled[:-1]))
+                with self.assertRaises((EOFError, pickle.UnpicklingError)):
+                    list(unpickler)
+                self.assertEqual(list(self.unpickler_class(ioclass(b''))), [])
+
+                # A single pickle per stream needs no shared memo.
+                for obj in objs:
+                    unpickler = self.unpickler_class(
+                        ioclass(self.dumps(obj, proto)))
+                    self.assertEqual(list(unpickler), [obj])
+
+    def test_iter_unpickler(self):
+        self._check_iter_unpickler(io.BytesIO)
+        self._check_iter_unpickler(UnseekableIO)
+        self._check_iter_unpickler(MinimalIO)
+        self._check_iter_unpickler(bytes)
+        self._check_iter_unpickler(lambda data: memoryview(bytearray(data)))
+
+    def test_unpickle_from_buffer(self):
+        data = [(x, str(x)) for x in range(100)] + [b"abcde", len]
+        for proto in protocols:
+            pickled = self.dumps(data, proto)
+            for buf in (pickled, bytearray(pickled), memoryview(pickled)):
+                unpickler = self.unpickler_class(buf)
+                self.assertEqual(unpickler.load(), data)
+                self.assertRaises(EOFError, unpickler.load)
+        with self.assertRaises((TypeError, AttributeError)):
+            self.unpickler_class(42)
+
+    def test_unpickle_without_memo(self):
+        data = [(x, str(x)) for x in range(10)]
+        shared = [[1, 2]] * 2
+        for proto in protocols:
+            unpickler = self.unpickler_class(self.dumps(data, proto),
+                                             memo=False)
+            self.assertEqual(unpickler.load(), data)
+            self.assertEqual(unpickler.memo.copy(), {})
+            unpickler = self.unpickler_class(self.dumps(shared, proto),
+                                             memo=False)
+            with self.assertRaises(pickle.UnpicklingError):
+                unpickler.load()
+
+    def dumps(self, obj, proto):
+        f = io.BytesIO()
+        self.pickler_class(f, proto).dump(obj)
+        return f.getvalue()
+
     def test_unpickling_buffering_readline(self):
         # Issue #12687: the unpickler's buffering logic could fail with
         # text mode opcodes.
@@ -1190,6 +1190,17 @@ def test_issue17223(self):
         self.assertRaises(ValueError, a.tounicode)
         self.assertRaises(ValueError, str, a)
 
+    def test_arithmetic(self):
+        a = array.array(self.typecode, self.example)
+        self.assertRaises(TypeError, a.sum)
+        self.assertRaises(TypeError, a.min)
+        self.assertRaises(TypeError, a.dot, a)
+        self.assertRaises(TypeError, a.add, a)
+        self.assertRaises(TypeError, a.mul, 2)
+        self.assertRaises(TypeError, a.cumsum)
+        self.assertRaises(TypeError, a.astype, 'i')
+        self.assertRaises(TypeError, array.array('i').astype, 'u')
+
 class NumberTest(BaseTest):
 
     def test_extslice(self):
@@ -1288,6 +1299,63 @@ def test_frombytearray(self):
         b = array.array(self.typecode, a)
         self.assertEqual(a, b)
 
+    def test_sum(self):
+        a = array.array(self.typecode, self.example)
+        self.assertEqual(a.sum(), sum(self.example))
+        self.assertEqual(type(a.sum()), type(sum(a)))
+        self.assertEqual(array.array(self.typecode).sum(), 0)
+        self.assertRaises(TypeError, a.sum, 1)
+
+    def test_min_max(self):
+        a = array.array(self.typecode, self.example)
+        self.assertEqual(a.min(), min(a))
+        self.assertEqual(a.max(), max(a))
+        self.assertEqual(type(a.min()), type(a[0]))
+        b = array.array(self.typecode)
+        self.assertRaises(ValueError, b.min)
+        self.assertRaises(ValueError, b.max)
+
+    def test_dot(self):
+        a = array.array(self.typecode, self.example)
+        b = array.array(self.typecode, reversed(self.example))
+        self.assertEqual(a.dot(b), sum(x * y for x, y in zip(a, b)))
+        self.assertEqual(array.array(self.typecode).dot(
+                         array.array(self.typecode)), 0)
+        self.assertRaises(TypeError, a.dot, list(b))
+        other = 'f' if self.typecode == 'd' else 'd'
+        self.assertRaises(TypeError, a.dot, array.array(other, a))
+        self.assertRaises(ValueError, a.dot, b[1:])
+
+    def test_add_mul(self):
+        a = array.array(self.typecode, range(5))
+        b = array.array(self.typecode, [3, 1, 4, 1, 5])
+        self.assertEqual(a.add(2), array.array(self.typecode, range(2, 7)))
+        self.assertEqual(a.mul(3), array.array(self.typecode, range(0, 15, 3)))
+        self.assertEqual(a.add(b), array.array(self.typecode, [3, 2, 6, 4, 9]))
+        self.assertEqual(a.mul(b), array.array(self.typecode, [0, 1, 8, 3, 20]))
+        # The operands are left untouched.
+        self.assertEqual(a, array.array(self.typecode, range(5)))
+        self.assertRaises(TypeError, a.add, 'x')
+        other = 'f' if self.typecode == 'd' else 'd'
+        self.assertRaises(TypeError, a.add, array.array(other, range(5)))
+        self.assertRaises(ValueError, a.mul, b[:-1])
+
+    def test_cumsum(self):
+        a = array.array(self.typecode, [3, 1, 4, 1, 5])
+        self.assertEqual(a.cumsum(),
+                         array.array(self.typecode, [3, 4, 8, 9, 14]))
+        self.assertEqual(array.array(self.typecode).cumsum(),
+                         array.array(self.typecode))
+
+    def test_astype(self):
+        a = array.array(self.typecode, range(5))
+        for typecode in 'fd' if self.typecode in 'fd' else 'bBhHiIlLqQfd':
+            b = a.astype(typecode)
+            self.assertEqual(b.typecode, typecode)
+            self.assertEqual(b.tolist(), list(range(5)))
+        self.assertRaises(TypeError, a.astype, 'u')
+        self.assertRaises(ValueError, a.astype, 'x')
+
 class IntegerNumberTest(NumberTest):
     def test_type_error(self):
         a = array.array(self.typecode)
@@ -1322,6 +1390,27 @@ def test_overflow(self):
         self.check_overflow(lower, upper)
         self.check_overflow(Intable(lower), Intable(upper))
 
+    def test_arithmetic_overflow(self):
+        a = array.array(self.typecode)
+        lower = -1 * int(pow(2, a.itemsize * 8 - 1))
+        upper = int(pow(2, a.itemsize * 8 - 1)) - 1
+        a = array.array(self.typecode, [lower, upper])
+        self.assertEqual(a.sum(), -1)
+        self.assertEqual(array.array(self.typecode, [upper] * 3).sum(),
+                         3 * upper)
+        self.assertEqual(a.dot(a), lower * lower + upper * upper)
+        self.assertRaises(OverflowError, a.add, 1)
+        self.assertRaises(OverflowError, a.add, -1)
+        self.assertRaises(OverflowError, a.mul, 2)
+        self.assertRaises(OverflowError, a.mul, -1)
+        self.assertEqual(a.mul(1), a)
+        self.assertRaises(OverflowError,
+                          array.array(self.typecode, [upper, 1]).cumsum)
+        self.assertRaises(OverflowError,
+                          array.array(self.typecode, [lower, -1]).cumsum)
+        self.assertRaises(OverflowError, a.astype, 'Q')
+        self.assertEqual(a.astype('q').tolist(), [lower, upper])
+
 class UnsignedNumberTest(IntegerNumberTest):
     example = [0, 1, 17, 23, 42, 0xff]
     smallerexample = [0, 1, 17, 23, 42, 0xfe]
@@ -1335,6 +1424,21 @@ def test_overflow(self):
         self.check_overflow(lower, upper)
         self.check_overflow(Intable(lower), Intable(upper))
 
+    def test_arithmetic_overflow(self):
+        a = array.array(self.typecode)
+        upper = int(pow(2, a.itemsize * 8)) - 1
+        a = array.array(self.typecode, [0, upper])
+        self.assertEqual(array.array(self.typecode, [upper] * 3).sum(),
+                         3 * upper)
+        self.assertEqual(a.dot(a), upper * upper)
+        self.assertRaises(OverflowError, a.add, 1)
+        self.assertRaises(OverflowError, a.add, -1)
+        self.assertRaises(OverflowError, a.mul, 2)
+        self.assertRaises(OverflowError,
+                          array.array(self.typecode, [upper, 1]).cumsum)
+        self.assertRaises(OverflowError, a.astype, 'b')
+        self.assertEqual(a.astype('Q').tolist(), [0, upper])
+
     def test_bytes_extend(self):
         s = bytes(self.example)
 
@@ -1412,6 +1516,21 @@ def test_nan(self):
         self.assertIs(a < b, False)
         self.assertIs(a <= b, False)
 
+    def test_nan_min_max(self):
+        nan = float('nan')
+        a = array.array(self.typecode, [nan, 1.0])
+        self.assertNotEqual(a.min(), a.min())
+        self.assertNotEqual(a.max(), a.max())
+        a = array.array(self.typecode, [1.0, nan])
+        self.assertEqual(a.min(), 1.0)
+        self.assertEqual(a.max(), 1.0)
+
+    def test_float_astype(self):
+        a = array.array(self.typecode, [1.5, -2.0])
+        self.assertRaises(TypeError, a.astype, 'i')
+        self.assertEqual(a.astype('d').tolist(), [1.5, -2.0])
+        self.assertEqual(a.astype('f').tolist(), [1.5, -2.0])
+
     def test_byteswap(self):
         a = array.array(self.typecode, self.example)
         self.assertRaises(TypeError, a.byteswap, 42)
@@ -2,7 +2,6 @@
 
 import concurrent.futures
 import errno
-import math
 import socket
 import sys
 import threading
@@ -150,9 +149,11 @@ def test_ipaddr_info_no_inet_pton(self, m_socket):
 
 class BaseEventLoopTests(test_utils.TestCase):
 
+    loop_class = base_events.BaseEventLoop
+
     def setUp(self):
         super().setUp()
-        self.loop = base_events.BaseEventLoop()
+        self.loop = self.loop_class()
         self.loop._selector = mock.Mock()
         self.loop._selector.select.return_value = ()
         self.set_event_loop(self.loop)
@@ -203,6 +204,13 @@ def test__add_callback_handle(self):
         self.assertFalse(self.loop._scheduled)
         self.assertIn(h, self.loop._ready)
 
+    def test__add_callback_py_handle(self):
+        h = asyncio.events._PyHandle(lambda: False, (), self.loop, None)
+
+        self.loop._add_callback(h)
+        self.assertFalse(self.loop._scheduled)
+        self.assertIn(h, self.loop._ready)
+
     def test__add_callback_cancelled_handle(self):
         h = asyncio.Handle(lambda: False, (), self.loop, None)
         h.cancel()
@@ -253,7 +261,8 @@ def cb():
 
         h = self.loop.call_later(10.0, cb)
         self.assertIsInstance(h, asyncio.TimerHandle)
-        self.assertIn(h, self.loop._scheduled)
+        self.assertTrue(h._scheduled)
+        self.assertIs(self.loop._scheduled.peek(), h)
         self.assertNotIn(h, self.loop._ready)
 
     def test_call_later_negative_delays(self):
@@ -362,13 +371,14 @@ def test__run_once(self):
         h1.cancel()
 
         self.loop._process_events = mock.Mock()
-        self.loop._scheduled.append(h1)
-        self.loop._scheduled.append(h2)
+        self.loop._scheduled.push(h1)
+        self.loop._scheduled.push(h2)
         self.loop._run_once()
 
         t = self.loop._selector.select.call_args[0][0]
         self.assertTrue(9.5 < t < 10.5, t)
-        self.assertEqual([h2], self.loop._scheduled)
+        self.assertEqual(len(self.loop._scheduled), 1)
+        self.assertIs(self.loop._scheduled.peek(), h2)
         self.assertTrue(self.loop._process_events.called)
 
     def test_set_debug(self):
@@ -390,7 +400,7 @@ def cb(loop):
                                 self.loop, None)
 
         self.loop._process_events = mock.Mock()
-        self.loop._scheduled.append(h)
+        self.loop._scheduled.push(h)
         self.loop._run_once()
 
         self.assertTrue(processed)
@@ -399,78 +409,58 @@ def cb(loop):
     def test__run_once_cancelled_event_cleanup(self):
         self.loop._process_events = mock.Mock()
 
-        self.assertTrue(
-            0 < base_events._MIN_CANCELLED_TIMER_HANDLES_FRACTION < 1.0)
-
         def cb():
             pass
 
-        # Set up one "blocking" event that will not be cancelled to
-        # ensure later cancelled events do not make it to the head
-        # of the queue and get cleaned.
-        not_cancelled_count = 1
-        self.loop.call_later(3000, cb)
-
-        # Add less than threshold (base_events._MIN_SCHEDULED_TIMER_HANDLES)
-        # cancelled handles, ensure they aren't removed
-
-        cancelled_count = 2
-        for x in range(2):
-            h = self.loop.call_later(3600, cb)
-            h.cancel()
-
-        # Add some cancelled events that will be at head and removed
-        cancelled_count += 2
-        for x in range(2):
-            h = self.loop.call_later(100, cb)
+        # cancel() removes the timer from the heap at once, wherever
+        # it is in the queue.
+        not_cancelled = [self.loop.call_later(3000, cb)]
+        cancelled = []
+        for delay in (3600, 100, 5000, 1):
+            h = self.loop.call_later(delay, cb)
             h.cancel()
+            cancelled.append(h)
+            not_cancelled.append(self.loop.call_later(delay + 0.5, cb))
 
-        # This test is invalid if _MIN_SCHEDULED_TIMER_HANDLES is too low
-        self.assertLessEqual(cancelled_count + not_cancelled_count,
-            base_events._MIN_SCHEDULED_TIMER_HANDLES)
-
-        self.assertEqual(self.loop._timer_cancelled_count, cancelled_count)
+        self.assertEqual(len(self.loop._scheduled), len(not_cancelled))
+        for h in cancelled:
+            self.assertFalse(h._scheduled)
+        for h in not_cancelled:
+            self.assertTrue(h._scheduled)
 
+        # cancelling twice is harmless
+        cancelled[0].cancel()
         self.loop._run_once()
+        self.assertEqual(len(self.loop._scheduled), len(not_cancelled))
 
-        cancelled_count -= 2
-
-        self.assertEqual(self.loop._timer_cancelled_count, cancelled_count)
-
-        self.assertEqual(len(self.loop._scheduled),
-            cancelled_count + not_cancelled_count)
-
-        # Need enough events to pass _MIN_CANCELLED_TIMER_HANDLES_FRACTION
-        # so that deletion of cancelled events will occur on next _run_once
-        add_cancel_count = int(math.ceil(
-            base_events._MIN_SCHEDULED_TIMER_HANDLES *
-            base_events._MIN_CANCELLED_TIMER_HANDLES_FRACTION)) + 1
-
-        add_not_cancel_count = max(base_events._MIN_SCHEDULED_TIMER_HANDLES -
-            add_cancel_count, 0)
-
-        # Add some events that will not be cancelled
-        not_cancelled_count += add_not_cancel_count
-        for x in range(add_not_cancel_count):
-            self.loop.call_later(3600, cb)
+        # Timers flagged as cancelled without cancel() are dropped when
+        # they reach the head of the queue.
+        first = self.loop._scheduled.peek()
+        first._cancelled = True
+        self.loop._run_once()
+        self.assertEqual(len(self.loop._scheduled), len(not_cancelled) - 1)
+        self.assertFalse(first._scheduled)
 
-        # Add enough cancelled events
-        cancelled_count += add_cancel_count
-        for x in range(add_cancel_count):
-            h = self.loop.call_later(3600, cb)
+        # close() unschedules the remaining timers
+        self.loop.close()
+        self.assertEqual(len(self.loop._scheduled), 0)
+        for h in not_cancelled:
+            self.assertFalse(h._scheduled)
             h.cancel()
 
-        # Ensure all handles are still scheduled
-        self.assertEqual(len(self.loop._scheduled),
-            cancelled_count + not_cancelled_count)
-
+    def test__run_once_timer_order(self):
+        self.loop._process_events = mock.Mock()
+        calls = []
+        now = self.loop.time()
+        delays = [0.3, -1, 0.1, -2, 0.2, -3, 0.0]
+        handles = [self.loop.call_at(now + d, calls.append, d)
+                   for d in delays]
+        handles[0].cancel()
+        handles[1].cancel()
         self.loop._run_once()
-
-        # Ensure cancelled events were removed
-        self.assertEqual(len(self.loop._scheduled), not_cancelled_count)
-
-        # Ensure only uncancelled events remain scheduled
-        self.assertTrue(all([not x._cancelled for x in self.loop._scheduled]))
+        self.assertEqual(calls, [-3, -2, 0.0])
+        self.assertEqual(len(self.loop._scheduled), 2)
+        self.assertEqual(self.loop._scheduled.peek().when(), now + 0.1)
 
     def test_run_until_complete_type_error(self):
         self.assertRaises(TypeError,
@@ -994,6 +984,18 @@ def test_asyncgen_finalization_by_gc_in_other_thread(self):
             self.assertTrue(status['finalized'])
 
 
+class PyEventLoopCore(base_events._PyEventLoopCore,
+                      base_events.BaseEventLoop):
+    pass
+
+
+@unittest.skipUnless(hasattr(base_events, '_CEventLoopCore'),
+                     'requires the C _asyncio module')
+class PyCoreBaseEventLoopTests(BaseEventLoopTests):
+
+    loop_class = PyEventLoopCore
+
+
 class MyProto(asyncio.Protocol):
     done = None
 
@@ -10,6 +10,8 @@
     ssl = None
 
 import asyncio
+from asyncio import constants
+from asyncio import selector_events
 from asyncio.selector_events import BaseSelectorEventLoop
 from asyncio.selector_events import _SelectorTransport
 from asyncio.selector_events import _SelectorSocketTransport
@@ -515,6 +517,15 @@ def socket_transport(self, waiter=None):
         self.addCleanup(close_transport, transport)
         return transport
 
+    def capture_sendmsg(self, nbytes):
+        # The transport passes sendmsg() an iterator over its live buffer.
+        buffers = []
+        def sendmsg(bufs):
+            buffers.extend(map(bytes, bufs))
+            return nbytes
+        self.sock.sendmsg.side_effect = sendmsg
+        return buffers
+
     def test_ctor(self):
         waiter = self.loop.create_future()
         tr = self.socket_transport(waiter=waiter)
@@ -680,18 +691,17 @@ def test_write_memoryview(self):
 
     def test_write_no_data(self):
         transport = self.socket_transport()
-        transport._buffer.extend(b'data')
+        transport._buffer_append(b'data')
         transport.write(b'')
         self.assertFalse(self.sock.send.called)
-        self.assertEqual(list_to_buffer([b'data']), transport._buffer)
+        self.assertEqual(b'data', b''.join(transport._buffer))
 
     def test_write_buffer(self):
         transport = self.socket_transport()
-        transport._buffer.extend(b'data1')
+        transport._buffer_append(b'data1')
         transport.write(b'data2')
         self.assertFalse(self.sock.send.called)
-        self.assertEqual(list_to_buffer([b'data1', b'data2']),
-                         transport._buffer)
+        self.assertEqual(b'data1data2', b''.join(transport._buffer))
 
     def test_write_partial(self):
         data = b'data'
@@ -701,7 +711,7 @@ def test_write_partial(self):
         transport.write(data)
 
         self.loop.assert_writer(7, transport._write_ready)
-        self.assertEqual(list_to_buffer([b'ta']), transport._buffer)
+        self.assertEqual(b'ta', b''.join(transport._buffer))
 
     def test_write_partial_bytearray(self):
         data = bytearray(b'data')
@@ -711,7 +721,7 @@ def test_write_partial_bytearray(self):
         transport.write(data)
 
         self.loop.assert_writer(7, transport._write_ready)
-        self.assertEqual(list_to_buffer([b'ta']), transport._buffer)
+        self.assertEqual(b'ta', b''.join(transport._buffer))
         self.assertEqual(data, bytearray(b'data'))  # Hasn't been mutated.
 
     def test_write_partial_memoryview(self):
@@ -722,7 +732,7 @@ def test_write_partial_memoryview(self):
         transport.write(data)
 
         self.loop.assert_writer(7, transport._write_ready)
-        self.assertEqual(list_to_buffer([b'ta']), transport._buffer)
+        self.assertEqual(b'ta', b''.join(transport._buffer))
 
     def test_write_partial_none(self):
         data = b'data'
@@ -733,7 +743,7 @@ def test_write_partial_none(self):
         transport.write(data)
 
         self.loop.assert_writer(7, transport._write_ready)
-        self.assertEqual(list_to_buffer([b'data']), transport._buffer)
+        self.assertEqual(b'data', b''.join(transport._buffer))
 
     def test_write_tryagain(self):
         self.sock.send.side_effect = BlockingIOError
@@ -743,7 +753,7 @@ def test_write_tryagain(self):
         transport.write(data)
 
         self.loop.assert_writer(7, transport._write_ready)
-        self.assertEqual(list_to_buffer([b'data']), transport._buffer)
+        self.assertEqual(b'data', b''.join(transport._buffer))
 
     @mock.patch('asyncio.selector_events.logger')
     def test_write_exception(self, m_log):
@@ -784,7 +794,7 @@ def test_write_ready(self):
         self.sock.send.return_value = len(data)
 
         transport = self.socket_transport()
-        transport._buffer.extend(data)
+        transport._buffer_append(data)
         self.loop._add_writer(7, transport._write_ready)
         transport._write_ready()
         self.assertTrue(self.sock.send.called)
@@ -796,7 +806,7 @@ def test_write_ready_closing(self):
 
         transport = self.socket_transport()
         transport._closing = True
-        transport._buffer.extend(data)
+        transport._buffer_append(data)
         self.loop._add_writer(7, transport._write_ready)
         transport._write_ready()
         self.assertTrue(self.sock.send.called)
@@ -814,44 +824,147 @@ def test_write_ready_partial(self):
         self.sock.send.return_value = 2
 
         transport = self.socket_transport()
-        transport._buffer.extend(data)
+        transport._buffer_append(data)
         self.loop._add_writer(7, transport._write_ready)
         transport._write_ready()
         self.loop.assert_writer(7, transport._write_ready)
-        self.assertEqual(list_to_buffer([b'ta']), transport._buffer)
+        self.assertEqual(b'ta', b''.join(transport._buffer))
 
     def test_write_ready_partial_none(self):
         data = b'data'
         self.sock.send.return_value = 0
 
         transport = self.socket_transport()
-        transport._buffer.extend(data)
+        transport._buffer_append(data)
         self.loop._add_writer(7, transport._write_ready)
         transport._write_ready()
         self.loop.assert_writer(7, transport._write_ready)
-        self.assertEqual(list_to_buffer([b'data']), transport._buffer)
+        self.assertEqual(b'data', b''.join(transport._buffer))
 
     def test_write_ready_tryagain(self):
         self.sock.send.side_effect = BlockingIOError
 
         transport = self.socket_transport()
-        transport._buffer = list_to_buffer([b'data1', b'data2'])
+        transport._buffer_append(b'data1')
+        transport._buffer_append(b'data2')
         self.loop._add_writer(7, transport._write_ready)
         transport._write_ready()
 
         self.loop.assert_writer(7, transport._write_ready)
-        self.assertEqual(list_to_buffer([b'data1data2']), transport._buffer)
+        self.assertEqual(b'data1data2', b''.join(transport._buffer))
 
     def test_write_ready_exception(self):
         err = self.sock.send.side_effect = OSError()
 
         transport = self.socket_transport()
         transport._fatal_error = mock.Mock()
-        transport._buffer.extend(b'data')
+        transport._buffer_append(b'data')
         transport._write_ready()
         transport._fatal_error.assert_called_with(
                                    err,
                                    'Fatal write error on socket transport')
+        self.assertEqual(transport.get_write_buffer_size(), 0)
+
+    def test_write_large_readonly_not_copied(self):
+        data = b'x' * constants.WRITE_COALESCE_SIZE
+        self.sock.send.side_effect = BlockingIOError
+
+        transport = self.socket_transport()
+        transport.write(data)
+        transport.write(memoryview(data))
+
+        self.assertEqual(len(transport._buffer), 2)
+        self.assertIs(transport._buffer[0].obj, data)
+        self.assertIs(transport._buffer[1].obj, data)
+        self.assertEqual(transport.get_write_buffer_size(), 2 * len(data))
+
+    def test_write_mutable_copied(self):
+        data = bytearray(b'x' * constants.WRITE_COALESCE_SIZE)
+        self.sock.send.side_effect = BlockingIOError
+
+        transport = self.socket_transport()
+        transport.write(data)
+        data[:] = b'y' * len(data)
+
+        self.assertEqual(b''.join(transport._buffer),
+                         b'x' * constants.WRITE_COALESCE_SIZE)
+
+    def test_write_small_coalesced(self):
+        self.sock.send.side_effect = BlockingIOError
+
+        transport = self.socket_transport()
+        transport.write(b'data1')
+        transport.write(memoryview(b'data2'))
+        transport.write(bytearray(b'data3'))
+
+        self.assertEqual(list(transport._buffer),
+                         [bytearray(b'data1data2data3')])
+        self.assertEqual(transport.get_write_buffer_size(), 15)
+
+    @unittest.skipUnless(selector_events._HAS_SENDMSG, 'need sendmsg()')
+    def test_write_ready_sendmsg(self):
+        big = b'x' * constants.WRITE_COALESCE_SIZE
+        self.sock.send.side_effect = BlockingIOError
+        buffers = self.capture_sendmsg(len(big) + 2)
+
+        transport = self.socket_transport()
+        transport.write(big)
+        transport.write(b'data')
+        self.loop._add_writer(7, transport._write_ready)
+        transport._write_ready()
+
+        self.assertEqual(b''.join(buffers), big + b'data')
+        self.loop.assert_writer(7, transport._write_ready)
+        self.assertEqual(b''.join(transport._buffer), b'ta')
+        self.assertEqual(transport.get_write_buffer_size(), 2)
+
+        self.sock.send.side_effect = None
+        self.sock.send.return_value = 2
+        transport._write_ready()
+        self.assertFalse(self.loop.writers)
+        self.assertEqual(transport.get_write_buffer_size(), 0)
+
+    @unittest.skipUnless(selector_events._HAS_SENDMSG, 'need sendmsg()')
+    def test_writelines(self):
+        big = b'x' * constants.WRITE_COALESCE_SIZE
+        buffers = self.capture_sendmsg(len(big) + 4)
+
+        transport = self.socket_transport()
+        transport.writelines([b'', big, bytearray(b'data')])
+
+        self.assertEqual(b''.join(buffers), big + b'data')
+        self.assertFalse(self.sock.send.called)
+        self.assertFalse(transport._buffer)
+        self.assertFalse(self.loop.writers)
+
+    @unittest.skipUnless(selector_events._HAS_SENDMSG, 'need sendmsg()')
+    def test_writelines_partial(self):
+        big = b'x' * constants.WRITE_COALESCE_SIZE
+        self.sock.sendmsg.return_value = 2
+
+        transport = self.socket_transport()
+        transport.writelines([big, b'data'])
+
+        self.loop.assert_writer(7, transport._write_ready)
+        self.assertEqual(b''.join(transport._buffer), big[2:] + b'data')
+
+    def test_writelines_buffer(self):
+        transport = self.socket_transport()
+        transport._buffer_append(b'data1')
+        transport.writelines([b'data2', b'data3'])
+        self.assertFalse(self.sock.send.called)
+        self.assertFalse(self.sock.sendmsg.called)
+        self.assertEqual(b''.join(transport._buffer), b'data1data2data3')
+
+    def test_writelines_str(self):
+        transport = self.socket_transport()
+        self.assertRaises(TypeError, transport.writelines, [b'data', 'str'])
+        self.assertFalse(transport._buffer)
+
+    def test_writelines_after_eof(self):
+        transport = self.socket_transport()
+        transport.write_eof()
+        self.assertRaises(RuntimeError, transport.writelines, [b'data'])
 
     def test_write_eof(self):
         tr = self.socket_transport()
@@ -867,7 +980,7 @@ def test_write_eof_buffer(self):
         self.sock.send.side_effect = BlockingIOError
         tr.write(b'data')
         tr.write_eof()
-        self.assertEqual(tr._buffer, list_to_buffer([b'data']))
+        self.assertEqual(b''.join(tr._buffer), b'data')
         self.assertTrue(tr._eof)
         self.assertFalse(self.sock.shutdown.called)
         self.sock.send.side_effect = lambda _: 4
@@ -891,6 +1004,65 @@ def test_transport_close_remove_writer(self, m_log):
         remove_writer.assert_called_with(self.sock_fd)
 
 
+@unittest.skipUnless(selector_events._HAS_ZEROCOPY, 'need MSG_ZEROCOPY')
+class SelectorSocketTransportZeroCopyTests(test_utils.TestCase):
+
+    def setUp(self):
+        super().setUp()
+        self.loop = asyncio.SelectorEventLoop()
+        self.set_event_loop(self.loop)
+
+    def make_transport(self):
+        with socket.create_server(('127.0.0.1', 0)) as server:
+            client = socket.create_connection(server.getsockname())
+            peer, _ = server.accept()
+        self.addCleanup(peer.close)
+        client.setblocking(False)
+        peer.setblocking(False)
+        protocol = test_utils.make_test_protocol(asyncio.Protocol)
+        transport = self.loop._make_socket_transport(client, protocol)
+        self.addCleanup(transport.close)
+        return transport, peer
+
+    async def recv_all(self, sock, size):
+        data = bytearray()
+        while len(data) < size:
+            chunk = await self.loop.sock_recv(sock, size - len(data))
+            self.assertTrue(chunk)
+            data += chunk
+        return data
+
+    def test_write_zerocopy(self):
+        data = bytes(range(256)) * (4 * constants.ZEROCOPY_SEND_THRESHOLD //
+                                    256)
+
+        async def main():
+            transport, peer = self.make_transport()
+            transport.write(data)
+            self.assertEqual(await self.recv_all(peer, len(data)), data)
+            # The completions arrive once the data is acknowledged.
+            for _ in range(100):
+                if not transport._zerocopy_pending:
+                    break
+                transport._release_zerocopy_buffers()
+                await asyncio.sleep(0.01)
+            self.assertEqual(transport._zerocopy_pending, {})
+
+        self.loop.run_until_complete(main())
+
+    def test_close_with_pending_zerocopy(self):
+        data = b'x' * (4 * constants.ZEROCOPY_SEND_THRESHOLD)
+
+        async def main():
+            transport, peer = self.make_transport()
+            transport.write(data)
+            transport.close()
+            self.assertEqual(await self.recv_all(peer, len(data)), data)
+            self.assertEqual(await self.loop.sock_recv(peer, 1), b'')
+
+        self.loop.run_until_complete(main())
+
+
 class SelectorSocketTransportBufferedProtocolTests(test_utils.TestCase):
 
     def setUp(self):
@@ -1369,5 +1541,175 @@ class MyException(Exception):
             exc_info=(MyException, MOCK_ANY, MOCK_ANY))
 
 
+@unittest.skipUnless(hasattr(socket.socket, 'recvmmsg_into'),
+                     'need socket.recvmmsg_into() and socket.sendmmsg()')
+class SelectorDatagramTransportBatchTests(test_utils.TestCase):
+
+    def setUp(self):
+        super().setUp()
+        self.loop = self.new_test_loop()
+        self.protocol = test_utils.make_test_protocol(asyncio.DatagramProtocol)
+        self.sock = mock.Mock(spec_set=socket.socket)
+        self.sock.fileno.return_value = 7
+        self.sock.family = socket.AF_INET
+
+    def datagram_transport(self, address=None):
+        self.sock.getpeername.side_effect = None if address else OSError
+        transport = _SelectorDatagramTransport(self.loop, self.sock,
+                                               self.protocol,
+                                               address=address)
+        self.addCleanup(close_transport, transport)
+        self.assertTrue(transport._batch_io)
+        return transport
+
+    def test_read_ready(self):
+        transport = self.datagram_transport()
+
+        def recvmmsg_into(buffers):
+            sizes.append(len(buffers))
+            buffers[0][:3] = b'abc'
+            if len(buffers) == 1:
+                return [(3, ('0.0.0.0', 1))]
+            buffers[1][:2] = b'de'
+            return [(3, ('0.0.0.0', 1)), (2, ('0.0.0.0', 2))]
+
+        sizes = []
+        self.sock.recvmmsg_into.side_effect = recvmmsg_into
+        for i in range(3):
+            transport._read_ready()
+
+        self.assertFalse(self.sock.recvfrom.called)
+        self.assertEqual(self.protocol.datagram_received.call_args_list,
+                         [mock.call(b'abc', ('0.0.0.0', 1))] +
+                         [mock.call(b'abc', ('0.0.0.0', 1)),
+                          mock.call(b'de', ('0.0.0.0', 2))] * 2)
+        # The batch only grows while reads fill every buffer.
+        self.assertEqual(sizes, [1, 2, 4])
+        self.assertEqual(len(transport._recv_views), 4)
+
+    def test_read_ready_batch_size(self):
+        transport = self.datagram_transport()
+        self.sock.recvmmsg_into.side_effect = (
+            lambda buffers: [(0, ())] * len(buffers))
+        for i in range(10):
+            transport._read_ready()
+        self.assertEqual(len(transport._recv_views),
+                         constants.DATAGRAM_BATCH_SIZE)
+
+    def test_read_ready_max_size(self):
+        transport = self.datagram_transport()
+        self.sock.recvmmsg_into.side_effect = (
+            lambda buffers: [(0, ())] * len(buffers))
+        transport._read_ready()
+        self.assertEqual(len(transport._recv_views[0]),
+                         constants.DATAGRAM_RECV_BUFFER_SIZE)
+
+        transport = self.datagram_transport()
+        transport.max_size = 100
+        transport._read_ready()
+        transport._read_ready()
+        self.assertEqual([len(view) for view in transport._recv_views],
+                         [100] * 4)
+
+    def test_read_ready_close_in_callback(self):
+        transport = self.datagram_transport()
+        transport._recv_views = [memoryview(bytearray(10))] * 2
+        self.sock.recvmmsg_into.return_value = [(0, ()), (0, ())]
+        self.protocol.datagram_received.side_effect = (
+            lambda data, addr: transport.close())
+        transport._read_ready()
+
+        self.assertEqual(self.protocol.datagram_received.call_count, 1)
+
+    def test_read_ready_callback_error(self):
+        transport = self.datagram_transport()
+        transport._recv_views = [memoryview(bytearray(10))] * 3
+        self.sock.recvmmsg_into.return_value = [(0, ('0.0.0.0', i))
+                                                for i in range(3)]
+        err = RuntimeError()
+        self.protocol.datagram_received.side_effect = [None, err, None]
+        self.loop.call_exception_handler = mock.Mock()
+        transport._read_ready()
+
+        # The datagram after the failing one is still delivered.
+        self.assertEqual(self.protocol.datagram_received.call_count, 3)
+        self.loop.call_exception_handler.assert_called_once_with({
+            'message': 'Exception in datagram_received()',
+            'exception': err,
+            'transport': transport,
+            'protocol': self.protocol,
+        })
+        self.assertFalse(transport.is_closing())
+
+    def test_read_ready_oserr(self):
+        transport = self.datagram_transport()
+
+        err = self.sock.recvmmsg_into.side_effect = ConnectionRefusedError()
+        transport._fatal_error = mock.Mock()
+        transport._read_ready()
+
+        self.assertFalse(transport._fatal_error.called)
+        self.protocol.error_received.assert_called_with(err)
+
+    def test_sendto_ready(self):
+        self.sock.sendmmsg.return_value = 2
+
+        transport = self.datagram_transport()
+        transport._buffer.extend([(b'data1', ('0.0.0.0', 1)),
+                                  (b'data2', ('0.0.0.0', 2))])
+        self.loop._add_writer(7, transport._sendto_ready)
+        transport._sendto_ready()
+
+        self.sock.sendmmsg.assert_called_once_with(
+            [(b'data1', ('0.0.0.0', 1)), (b'data2', ('0.0.0.0', 2))])
+        self.assertFalse(self.sock.sendto.called)
+        self.assertFalse(self.loop.writers)
+
+    def test_sendto_ready_connected(self):
+        self.sock.sendmmsg.return_value = 1
+
+        transport = self.datagram_transport(address=('0.0.0.0', 1))
+        transport._buffer.append((b'data', ('0.0.0.0', 1)))
+        transport._sendto_ready()
+
+        self.sock.sendmmsg.assert_called_once_with([b'data'])
+
+    def test_sendto_ready_partial(self):
+        self.sock.sendmmsg.return_value = 1
+
+        transport = self.datagram_transport()
+        transport._buffer.extend([(b'data1', ()), (b'data2', ())])
+        self.loop._add_writer(7, transport._sendto_ready)
+        transport._sendto_ready()
+
+        self.loop.assert_writer(7, transport._sendto_ready)
+        self.assertEqual([(b'data2', ())], list(transport._buffer))
+
+    def test_sendto_ready_tryagain(self):
+        self.sock.sendmmsg.side_effect = BlockingIOError
+
+        transport = self.datagram_transport()
+        transport._buffer.extend([(b'data1', ()), (b'data2', ())])
+        self.loop._add_writer(7, transport._sendto_ready)
+        transport._sendto_ready()
+
+        self.loop.assert_writer(7, transport._sendto_ready)
+        self.assertEqual(
+            [(b'data1', ()), (b'data2', ())],
+            list(transport._buffer))
+
+    def test_sendto_ready_error_received(self):
+        self.sock.sendmmsg.side_effect = ConnectionRefusedError
+
+        transport = self.datagram_transport()
+        transport._fatal_error = mock.Mock()
+        transport._buffer.extend([(b'data1', ()), (b'data2', ())])
+        transport._sendto_ready()
+
+        self.assertFalse(transport._fatal_error.called)
+        self.assertTrue(self.protocol.error_received.called)
+        self.assertEqual([(b'data2', ())], list(transport._buffer))
+
+
 if __name__ == '__main__':
     unittest.main()
@@ -16,6 +16,7 @@
     ssl = None
 
 import asyncio
+from asyncio import streams
 from test.test_asyncio import utils as test_utils
 
 
@@ -471,6 +472,85 @@ def test_readuntil_limit_found_sep(self):
 
         self.assertEqual(b'some dataAAA', stream._buffer)
 
+    def test_readuntil_multi_separators(self):
+        stream = asyncio.StreamReader(loop=self.loop)
+
+        stream.feed_data(b'line1\r\nline2\nline3\r')
+        seps = (b'\n', b'\r\n')
+        data = self.loop.run_until_complete(stream.readuntil(seps))
+        self.assertEqual(b'line1\r\n', data)
+        data = self.loop.run_until_complete(stream.readuntil(seps))
+        self.assertEqual(b'line2\n', data)
+        self.assertEqual(b'line3\r', stream._buffer)
+
+        # the match which ends first wins, whatever its length
+        stream.feed_data(b'\nxxAByyB')
+        self.loop.run_until_complete(stream.readuntil(b'\n'))
+        data = self.loop.run_until_complete(
+            stream.readuntil((b'yyB', b'AB')))
+        self.assertEqual(b'xxAB', data)
+        self.assertEqual(b'yyB', stream._buffer)
+
+        # a separator can complete in a later chunk
+        async def read():
+            return await stream.readuntil((b'QQQ', b'ZZ'))
+        task = self.loop.create_task(read())
+        test_utils.run_briefly(self.loop)
+        stream.feed_data(b'Z')
+        test_utils.run_briefly(self.loop)
+        self.assertFalse(task.done())
+        stream.feed_data(b'Z')
+        self.assertEqual(b'yyBZZ', self.loop.run_until_complete(task))
+
+    def test_readuntil_multi_separators_invalid(self):
+        stream = asyncio.StreamReader(loop=self.loop)
+        with self.assertRaisesRegex(ValueError, 'at least one element'):
+            self.loop.run_until_complete(stream.readuntil(()))
+        with self.assertRaisesRegex(ValueError, 'at least one-byte'):
+            self.loop.run_until_complete(stream.readuntil((b'A', b'')))
+
+    def test_readuntil_multi_separators_limit(self):
+        stream = asyncio.StreamReader(loop=self.loop, limit=3)
+        stream.feed_data(b'dataAAA')
+        with self.assertRaisesRegex(asyncio.LimitOverrunError,
+                                    'is found') as cm:
+            self.loop.run_until_complete(stream.readuntil((b'AAA', b'B')))
+        self.assertEqual(cm.exception.consumed, 4)
+        self.assertEqual(b'dataAAA', stream._buffer)
+
+    def test_protocol_receives_into_reader_buffer(self):
+        stream = asyncio.StreamReader(loop=self.loop)
+        protocol = asyncio.StreamReaderProtocol(stream, loop=self.loop)
+        self.assertIsInstance(protocol, asyncio.BufferedProtocol)
+
+        buf = protocol.get_buffer(-1)
+        self.assertGreater(len(buf), 0)
+        buf[:6] = b'line1\n'
+        del buf
+        protocol.buffer_updated(6)
+        asyncio.protocols._feed_data_to_buffered_proto(protocol, b'line2\n')
+        self.assertEqual(b'line1\nline2\n', stream._buffer)
+        data = self.loop.run_until_complete(stream.readline())
+        self.assertEqual(b'line1\n', data)
+
+    def test_protocol_buffer_with_overridden_data_received(self):
+        received = []
+
+        class Protocol(asyncio.StreamReaderProtocol):
+            def data_received(self, data):
+                received.append(data)
+                super().data_received(data)
+
+        stream = asyncio.StreamReader(loop=self.loop)
+        protocol = Protocol(stream, loop=self.loop)
+        asyncio.protocols._feed_data_to_buffered_proto(protocol, b'data')
+        self.assertEqual(received, [b'data'])
+        self.assertEqual(b'data', stream._buffer)
+
+        # no reader: the data is dropped
+        protocol = asyncio.StreamReaderProtocol(None, loop=self.loop)
+        asyncio.protocols._feed_data_to_buffered_proto(protocol, b'data')
+
     def test_readexactly_zero_or_less(self):
         # Read exact number of bytes (zero or less).
         stream = asyncio.StreamReader(loop=self.loop)
@@ -964,5 +1044,118 @@ def test_eof_feed_when_closing_writer(self):
         self.assertEqual(messages, [])
 
 
+class BaseStreamBufferTests:
+
+    StreamBuffer = None
+
+    def test_extend_take(self):
+        buf = self.StreamBuffer()
+        self.assertEqual(len(buf), 0)
+        self.assertFalse(buf)
+        self.assertEqual(buf, b'')
+        buf.extend(b'hello ')
+        buf.extend(bytearray(b'world'))
+        buf.extend(memoryview(b'!'))
+        self.assertEqual(len(buf), 12)
+        self.assertEqual(buf, b'hello world!')
+        self.assertNotEqual(buf, b'hello')
+        self.assertNotEqual(buf, 'hello world!')
+        self.assertEqual(buf.take(6), b'hello ')
+        self.assertEqual(buf, b'world!')
+        self.assertEqual(buf.take(0), b'')
+        self.assertEqual(buf.take(-1), b'')
+        self.assertEqual(buf.take(100), b'world!')
+        self.assertEqual(buf.take(100), b'')
+        self.assertEqual(len(buf), 0)
+        with self.assertRaises(TypeError):
+            hash(buf)
+
+    def test_discard_clear(self):
+        buf = self.StreamBuffer()
+        buf.extend(b'abcdef')
+        buf.discard(2)
+        self.assertEqual(buf, b'cdef')
+        buf.discard(100)
+        self.assertEqual(buf, b'')
+        buf.extend(b'abc')
+        buf.clear()
+        self.assertEqual(buf, b'')
+
+    def test_get_buffer(self):
+        buf = self.StreamBuffer()
+        buf.extend(b'abc')
+        view = buf.get_buffer(10)
+        self.assertGreaterEqual(len(view), 10)
+        view[:3] = b'def'
+        buf.buffer_updated(3)
+        self.assertEqual(buf, b'abcdef')
+        with self.assertRaises(ValueError):
+            buf.buffer_updated(-1)
+        with self.assertRaises(ValueError):
+            buf.buffer_updated(len(view))
+
+        # the view stays valid while the buffer grows and is consumed
+        buf.extend(b'x' * 100000)
+        self.assertEqual(buf.take(6), b'abcdef')
+        view[:3] = b'zzz'
+        self.assertEqual(buf.take(1), b'x')
+        view.release()
+
+        view = buf.get_buffer(-1)
+        self.assertGreater(len(view), 0)
+        view.release()
+
+    def test_get_buffer_grows(self):
+        buf = self.StreamBuffer()
+        expected = bytearray()
+        for i in range(200):
+            chunk = bytes([i]) * (i * 7 + 1)
+            view = buf.get_buffer(len(chunk))
+            view[:len(chunk)] = chunk
+            view.release()
+            buf.buffer_updated(len(chunk))
+            expected += chunk
+            if i % 3 == 0:
+                self.assertEqual(buf.take(i * 5), bytes(expected[:i * 5]))
+                del expected[:i * 5]
+        self.assertEqual(buf, expected)
+
+    def test_startswith(self):
+        buf = self.StreamBuffer()
+        buf.extend(b'xxabc')
+        buf.discard(2)
+        self.assertTrue(buf.startswith(b'ab'))
+        self.assertTrue(buf.startswith(b'bc', 1))
+        self.assertTrue(buf.startswith(b''))
+        self.assertFalse(buf.startswith(b'abcd'))
+        self.assertFalse(buf.startswith(b'x'))
+
+    def test_find(self):
+        buf = self.StreamBuffer()
+        buf.extend(b'--data\r\nmore\n')
+        buf.discard(2)
+        self.assertEqual(buf.find((b'\n',)), (5, 6))
+        self.assertEqual(buf.find((b'\n', b'\r\n')), (5, 6))
+        self.assertEqual(buf.find((b'\r\n', b'a\r\n')), (4, 6))
+        self.assertEqual(buf.find((b'\n',), 6), (10, 11))
+        self.assertEqual(buf.find((b'ta', b'a\r\n')), (2, 4))
+        self.assertEqual(buf.find((b'zz', b'yyy')), (-1, -1))
+        self.assertEqual(buf.find((b'\n',), 100), (-1, -1))
+        self.assertEqual(buf.find([bytearray(b'more')]), (6, 10))
+        self.assertRaises(ValueError, buf.find, (b'\n', b''))
+        self.assertRaises(ValueError, self.StreamBuffer().find, (b'',))
+        self.assertEqual(self.StreamBuffer().find((b'\n',)), (-1, -1))
+
+
+class PyStreamBufferTests(BaseStreamBufferTests, unittest.TestCase):
+    StreamBuffer = streams._PyStreamBuffer
+
+
+@unittest.skipUnless(hasattr(streams, '_CStreamBuffer'),
+                     'requires the C _asyncio module')
+class CStreamBufferTests(BaseStreamBufferTests, unittest.TestCase):
+    StreamBuffer = getattr(streams, '_CStreamBuffer', None)
+
+
 if __name__ == '__main__':
     unittest.main()
@@ -0,0 +1,198 @@
+"""Tests for uring_events.py"""
+
+import errno
+import os
+import socket
+import sys
+import unittest
+
+if not sys.platform.startswith('linux'):
+    raise unittest.SkipTest('Linux only')
+
+from test.support import import_helper
+_uring = import_helper.import_module('_uring')
+
+import asyncio
+from test.test_asyncio import utils as test_utils
+
+
+def tearDownModule():
+    asyncio.set_event_loop_policy(None)
+
+
+def make_ring(entries=8):
+    try:
+        return _uring.Ring(entries)
+    except OSError as exc:
+        raise unittest.SkipTest(f"io_uring is not available: {exc}")
+
+
+def wait_all(ring, count):
+    results = {}
+    while len(results) < count:
+        for key, res, value in ring.wait(5.0):
+            results[key] = (res, value)
+    return results
+
+
+class RingTests(unittest.TestCase):
+
+    def setUp(self):
+        self.ring = make_ring()
+        self.addCleanup(self.ring.close)
+        self.a, self.b = socket.socketpair()
+        self.addCleanup(self.a.close)
+        self.addCleanup(self.b.close)
+
+    def test_invalid_entries(self):
+        with self.assertRaises(ValueError):
+            _uring.Ring(0)
+
+    def test_send_recv(self):
+        self.ring.recv('r', self.b.fileno(), 100)
+        self.ring.send('s', self.a.fileno(), b'hello')
+        self.assertEqual(self.ring.pending, 2)
+        results = wait_all(self.ring, 2)
+        self.assertEqual(results['s'], (5, None))
+        self.assertEqual(results['r'], (5, b'hello'))
+        self.assertEqual(self.ring.pending, 0)
+
+    def test_recv_into(self):
+        buf = bytearray(10)
+        self.ring.recv_into('r', self.b.fileno(), buf)
+        self.a.send(b'abc')
+        results = wait_all(self.ring, 1)
+        self.assertEqual(results['r'][0], 3)
+        self.assertEqual(buf[:3], b'abc')
+
+    def test_read_write_pipe(self):
+        rfd, wfd = os.pipe()
+        self.addCleanup(os.close, rfd)
+        self.addCleanup(os.close, wfd)
+        self.ring.write('w', wfd, b'data')
+        self.ring.read('r', rfd, 10)
+        results = wait_all(self.ring, 2)
+        self.assertEqual(results['w'], (4, None))
+        self.assertEqual(results['r'], (4, b'data'))
+
+    def test_poll(self):
+        self.ring.poll('p', self.b.fileno(), _uring.POLLIN)
+        self.assertEqual(self.ring.wait(0), [])
+        self.a.send(b'x')
+        res, value = wait_all(self.ring, 1)['p']
+        self.assertTrue(res & _uring.POLLIN)
+
+    def test_timeout(self):
+        self.ring.timeout('t', 0.01)
+        self.assertEqual(wait_all(self.ring, 1)['t'], (0, None))
+
+    def test_wait_timeout(self):
+        self.ring.recv('r', self.b.fileno(), 10)
+        self.assertEqual(self.ring.wait(0.01), [])
+        self.assertEqual(self.ring.pending, 1)
+
+    def test_cancel(self):
+        op = self.ring.recv('r', self.b.fileno(), 10)
+        self.ring.cancel(op)
+        # cancelling twice is a no-op
+        self.ring.cancel(op)
+        res, value = wait_all(self.ring, 1)['r']
+        self.assertIn(-res, (errno.ECANCELED, errno.EINTR))
+        # cancelling a completed operation is a no-op
+        self.ring.cancel(op)
+        self.assertEqual(self.ring.wait(0), [])
+
+    def test_many_operations(self):
+        # more operations than submission queue entries
+        count = 50
+        for i in range(count):
+            self.ring.timeout(i, 0)
+        results = wait_all(self.ring, count)
+        self.assertEqual(sorted(results), list(range(count)))
+
+    def test_close(self):
+        self.ring.recv('r', self.b.fileno(), 10)
+        completions = self.ring.close()
+        self.assertEqual([key for key, res, value in completions], ['r'])
+        self.assertTrue(self.ring.closed)
+        self.assertEqual(self.ring.close(), [])
+        with self.assertRaises(ValueError):
+            self.ring.wait(0)
+        with self.assertRaises(ValueError):
+            self.ring.recv('r', self.b.fileno(), 10)
+        with self.assertRaises(ValueError):
+            self.ring.fileno()
+
+
+class UringEventLoopTests(test_utils.TestCase):
+
+    def setUp(self):
+        super().setUp()
+        try:
+            self.loop = asyncio.UringEventLoop()
+        except OSError as exc:
+            self.skipTest(f"io_uring is not available: {exc}")
+        self.set_event_loop(self.loop)
+
+    def test_sock_sendall_large(self):
+        a, b = socket.socketpair()
+        a.setblocking(False)
+        b.setblocking(False)
+        data = os.urandom(4 * 1024 * 1024)
+
+        async def reader():
+            chunks = []
+            size = 0
+            while size < len(data):
+                chunk = await self.loop.sock_recv(b, 65536)
+                chunks.append(chunk)
+                size += len(chunk)
+            return b''.join(chunks)
+
+        async def main():
+            task = self.loop.create_task(reader())
+            await self.loop.sock_sendall(a, data)
+            return await task
+
+        with a, b:
+            self.assertEqual(self.loop.run_until_complete(main()), data)
+
+    def test_sock_recv_cancel(self):
+        a, b = socket.socketpair()
+        a.setblocking(False)
+        b.setblocking(False)
+
+        async def main():
+            task = self.loop.create_task(self.loop.sock_recv(b, 10))
+            await asyncio.sleep(0)
+            task.cancel()
+            with self.assertRaises(asyncio.CancelledError):
+                await task
+            # the socket is still usable afterwards
+            await self.loop.sock_sendall(a, b'abc')
+            return await self.loop.sock_recv(b, 10)
+
+        with a, b:
+            self.assertEqual(self.loop.run_until_complete(main()), b'abc')
+
+    def test_close_with_pending_operations(self):
+        a, b = socket.socketpair()
+        a.setblocking(False)
+        b.setblocking(False)
+        fut = self.loop._proactor.recv(b, 10)
+        self.loop.close()
+        self.assertTrue(fut.cancelled())
+        a.close()
+        b.close()
+
+    def test_policy(self):
+        policy = asyncio.UringEventLoopPolicy()
+        loop = policy.new_event_loop()
+        try:
+            self.assertIsInstance(loop, asyncio.UringEventLoop)
+        finally:
+            loop.close()
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -760,6 +760,36 @@ def testDecompressorChunksMaxsize(self):
         self.assertEqual(out, self.BIG_TEXT)
         self.assertEqual(bzd.unused_data, b"")
 
+    def testDecompressInto(self):
+        bzd = BZ2Decompressor()
+        buf = bytearray(100)
+        out = []
+
+        # Feed some input
+        len_ = len(self.BIG_DATA) - 64
+        n = bzd.decompress_into(self.BIG_DATA[:len_], buf)
+        self.assertFalse(bzd.needs_input)
+        self.assertEqual(n, len(buf))
+        out.append(bytes(buf))
+
+        # Retrieve remaining data, providing the rest of the input once
+        n = bzd.decompress_into(self.BIG_DATA[len_:], buf)
+        out.append(bytes(buf[:n]))
+        while not bzd.eof:
+            n = bzd.decompress_into(b'', buf)
+            self.assertLessEqual(n, len(buf))
+            out.append(bytes(buf[:n]))
+
+        self.assertEqual(b"".join(out), self.BIG_TEXT)
+        self.assertEqual(bzd.unused_data, b"")
+        self.assertRaises(EOFError, bzd.decompress_into, b'', buf)
+
+    def testDecompressIntoBadBuffer(self):
+        bzd = BZ2Decompressor()
+        self.assertRaises(TypeError, bzd.decompress_into, self.DATA)
+        self.assertRaises(TypeError, bzd.decompress_into, self.DATA, b'x' * 10)
+        self.assertEqual(bzd.decompress_into(b'', bytearray()), 0)
+
     def test_decompressor_inputbuf_1(self):
         # Test reusing input buffer after moving existing
         # contents to beginning
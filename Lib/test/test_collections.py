@@ -17,7 +17,7 @@
 from collections import namedtuple, Counter, OrderedDict, _count_elements
 from collections import UserDict, UserString, UserList
 from collections import ChainMap
-from collections import deque
+from collections import deque, frozenmap
 from collections.abc import Awaitable, Coroutine
 from collections.abc import AsyncIterator, AsyncIterable, AsyncGenerator
 from collections.abc import Hashable, Iterable, Iterator, Generator, Reversible
@@ -2329,6 +2329,131 @@ def test_gt(self):
         self.assertFalse(Counter(a=2, b=1, c=0) > Counter('aab'))
 
 
+################################################################################
+### frozenmap
+################################################################################
+
+class TestFrozenMap(unittest.TestCase):
+
+    def test_constructor(self):
+        self.assertEqual(len(frozenmap()), 0)
+        self.assertIs(frozenmap(), frozenmap())
+        m = frozenmap({'a': 1, 'b': 2})
+        self.assertEqual(dict(m.items()), {'a': 1, 'b': 2})
+        self.assertEqual(frozenmap([('a', 1), ('b', 2)]), m)
+        self.assertEqual(frozenmap(a=1, b=2), m)
+        self.assertEqual(frozenmap({'a': 1}, b=2), m)
+        self.assertEqual(frozenmap(UserDict(a=1, b=2)), m)
+        self.assertIs(frozenmap(m), m)
+        self.assertRaises(TypeError, frozenmap, 1)
+        self.assertRaises(TypeError, frozenmap, [1])
+        self.assertRaises(ValueError, frozenmap, [(1, 2, 3)])
+        self.assertRaises(TypeError, frozenmap, {}, {})
+        self.assertRaises(TypeError, frozenmap, [([], 1)])
+
+    def test_mapping(self):
+        m = frozenmap({i: str(i) for i in range(100)})
+        self.assertIsInstance(m, Mapping)
+        self.assertNotIsInstance(m, MutableMapping)
+        self.assertEqual(len(m), 100)
+        self.assertEqual(m[7], '7')
+        self.assertIn(7, m)
+        self.assertNotIn(100, m)
+        self.assertRaises(KeyError, m.__getitem__, 100)
+        self.assertEqual(m.get(100, 'x'), 'x')
+        self.assertEqual(sorted(m), list(range(100)))
+        self.assertEqual(sorted(m.keys()), list(range(100)))
+        self.assertEqual(sorted(m.values(), key=int),
+                         [str(i) for i in range(100)])
+        self.assertRaises(TypeError, operator.setitem, m, 1, 2)
+
+    def test_persistent_operations(self):
+        m = frozenmap(a=1)
+        m2 = m.set('b', 2)
+        self.assertEqual(m, frozenmap(a=1))
+        self.assertEqual(m2, frozenmap(a=1, b=2))
+        self.assertEqual(m2.delete('a'), frozenmap(b=2))
+        self.assertIs(m2.delete('missing'), m2)
+        m3 = m2.update({'a': 10, 'c': 3}, d=4)
+        self.assertEqual(m3, frozenmap(a=10, b=2, c=3, d=4))
+        self.assertIs(m2.update(), m2)
+        self.assertIs(m2.update({'a': 1}), m2)
+
+    def test_update_from_dict_mutated(self):
+        class Key(str):
+            def __eq__(self, other):
+                d.clear()
+                return str.__eq__(self, other)
+            __hash__ = str.__hash__
+        d = {Key('a'): 1, Key('b'): 2}
+        self.assertRaises(RuntimeError, frozenmap(a=0).update, d)
+
+    def test_hash_and_eq(self):
+        m = frozenmap({i: i * 2 for i in range(50)})
+        self.assertEqual(hash(m), hash(frozenmap({i: i * 2 for i in reversed(range(50))})))
+        self.assertNotEqual(hash(m), hash(m.set(0, 1)))
+        self.assertEqual({m: 1}[frozenmap(m.items())], 1)
+        self.assertNotEqual(m, dict(m.items()))
+        self.assertRaises(TypeError, hash, frozenmap(a=[]))
+
+    def test_repr(self):
+        self.assertEqual(repr(frozenmap()), 'frozenmap({})')
+        self.assertEqual(repr(frozenmap(a=1)), "frozenmap({'a': 1})")
+        m = frozenmap(a=[])
+        m['a'].append(m)
+        self.assertEqual(repr(m), "frozenmap({'a': [frozenmap({...})]})")
+
+    def test_pickle_copy(self):
+        m = frozenmap({i: str(i) for i in range(100)})
+        for proto in range(pickle.HIGHEST_PROTOCOL + 1):
+            with self.subTest(proto=proto):
+                self.assertEqual(pickle.loads(pickle.dumps(m, proto)), m)
+        self.assertIs(copy.copy(m), m)
+        self.assertEqual(copy.deepcopy(m), m)
+
+    def test_generic_alias(self):
+        self.assertIsInstance(frozenmap[str, int], types.GenericAlias)
+
+    def test_mutation(self):
+        m = frozenmap({i: i for i in range(100)})
+        with m.mutate() as mm:
+            self.assertEqual(len(mm), 100)
+            for i in range(0, 100, 2):
+                del mm[i]
+            mm[100] = 100
+            mm.set(101, 101)
+            mm.update({102: 102}, x=1)
+            self.assertEqual(mm.pop(1), 1)
+            self.assertEqual(mm.pop(1, 'missing'), 'missing')
+            self.assertRaises(KeyError, mm.pop, 1)
+            self.assertRaises(KeyError, mm.__delitem__, 1)
+            self.assertEqual(mm.get(3), 3)
+            self.assertIsNone(mm.get(2))
+            self.assertIn(3, mm)
+            self.assertEqual(mm[5], 5)
+            result = mm.finish()
+        self.assertEqual(len(m), 100)
+        self.assertEqual(len(result), 53)
+        self.assertEqual(result,
+                         frozenmap({i: i for i in range(3, 103, 2) if i < 100},
+                                   **{'x': 1}).update({100: 100, 101: 101, 102: 102}))
+        # The mutation is closed by the with statement.
+        self.assertRaises(ValueError, mm.__setitem__, 1, 1)
+        self.assertRaises(ValueError, mm.update, {})
+        self.assertEqual(mm.finish(), result)
+
+    def test_mutation_snapshots(self):
+        mm = frozenmap().mutate()
+        snapshots = []
+        for i in range(200):
+            mm[i % 70] = i
+            if i % 10 == 0:
+                snapshots.append((mm.finish(), {k: v for k, v in mm.finish().items()}))
+        for snapshot, expected in snapshots:
+            self.assertEqual(dict(snapshot.items()), expected)
+        self.assertRaises(TypeError, hash, mm)
+
+
 ################################################################################
 ### Run tests
 ################################################################################
@@ -2337,7 +2462,7 @@ def test_main(verbose=None):
     NamedTupleDocs = doctest.DocTestSuite(module=collections)
     test_classes = [TestNamedTuple, NamedTupleDocs, TestOneTrickPonyABCs,
                     TestCollectionABCs, TestCounter, TestChainMap,
-                    TestUserObjects,
+                    TestUserObjects, TestFrozenMap,
                     ]
     support.run_unittest(*test_classes)
     support.run_doctest(collections, verbose)
@@ -622,6 +622,77 @@ def test_hamt_stress(self):
             self.assertEqual(len(h), 0)
             self.assertEqual(list(h.items()), [])
 
+    def test_hamt_mutation_stress(self):
+        # Hashes in a small range produce Collision nodes, and the key
+        # count produces Array nodes; both are updated in place.
+        rnd = random.Random(7)
+        h = hamt()
+        d = {}
+        snapshots = []
+        with h.mutate() as mm:
+            for i in range(4000):
+                key = HashKey(rnd.randrange(600), str(rnd.randrange(1500)))
+                if rnd.random() < 0.3:
+                    self.assertEqual(mm.pop(key, 'missing'),
+                                     d.pop(key, 'missing'))
+                else:
+                    mm[key] = i
+                    d[key] = i
+                self.assertEqual(len(mm), len(d))
+                if not i % 397:
+                    snapshots.append((mm.finish(), d.copy()))
+            snapshots.append((mm.finish(), d.copy()))
+
+        for snapshot, expected in snapshots:
+            self.assertEqual(len(snapshot), len(expected))
+            self.assertEqual(dict(snapshot.items()), expected)
+
+    def test_hamt_mutation_does_not_affect_source(self):
+        h = hamt().update({str(i): i for i in range(200)})
+        with h.mutate() as mm:
+            for i in range(0, 200, 2):
+                del mm[str(i)]
+            mm['new'] = 1
+            h2 = mm.finish()
+        self.assertEqual(len(h), 200)
+        self.assertEqual(dict(h.items()), {str(i): i for i in range(200)})
+        self.assertEqual(len(h2), 101)
+        self.assertNotIn('0', h2)
+        self.assertEqual(h2['1'], 1)
+
+    def test_hamt_mutation_errors(self):
+        A = HashKey(100, 'A')
+        B = HashKey(101, 'B')
+        mm = hamt().mutate()
+        mm[A] = 1
+        mm[B] = 2
+
+        with self.assertRaises(HashingError):
+            with HaskKeyCrasher(error_on_hash=True):
+                mm[A] = 3
+        with self.assertRaises(EqError):
+            with HaskKeyCrasher(error_on_eq=True):
+                del mm[HashKey(100, 'A')]
+        with self.assertRaises(KeyError):
+            del mm[HashKey(102, 'C')]
+
+        self.assertEqual(mm[A], 1)
+        self.assertEqual(len(mm), 2)
+        self.assertEqual(dict(mm.finish().items()), {A: 1, B: 2})
+
+    def test_hamt_mutation_reentrant(self):
+        class EvilKey(HashKey):
+            __hash__ = HashKey.__hash__
+            def __eq__(self, other):
+                mm['evil'] = 1
+                return super().__eq__(other)
+
+        mm = hamt().mutate()
+        mm[EvilKey(10, 'a')] = 1
+        with self.assertRaises(RuntimeError):
+            mm[HashKey(10, 'a')] = 2
+        self.assertEqual(len(mm), 1)
+
     def test_hamt_delete_1(self):
         A = HashKey(100, 'A')
         B = HashKey(101, 'B')
@@ -184,6 +184,71 @@ def test_extend(self):
         d.extend(d)
         self.assertEqual(list(d), list('abcdabcd'))
 
+    def test_extend_sequence(self):
+        BIG = 1000
+        for seq in (list(range(BIG)), tuple(range(BIG))):
+            for start in ([], [-1], list(range(-100, 0))):
+                d = deque(start)
+                d.extend(seq)
+                self.assertEqual(list(d), start + list(seq))
+                d = deque(start)
+                d.extendleft(seq)
+                self.assertEqual(list(d), list(reversed(seq)) + start)
+                for maxlen in (1, 10, 64, 65, 999, 1000, 1001, 2000):
+                    d = deque(start, maxlen)
+                    d.extend(seq)
+                    self.assertEqual(list(d), (start + list(seq))[-maxlen:])
+                    d = deque(start, maxlen)
+                    d.extendleft(seq)
+                    self.assertEqual(list(d),
+                                     (list(reversed(seq)) + start)[:maxlen])
+        d = deque(range(5), 0)
+        d.extend([1, 2, 3])
+        d.extendleft([1, 2, 3])
+        self.assertEqual(list(d), [])
+
+    def test_extend_sequence_mutation(self):
+        # Evicting the old items may run code that mutates the sequence
+        seq = list(range(20))
+        class A:
+            def __del__(self):
+                seq.clear()
+        d = deque([A()], maxlen=10)
+        d.extend(seq)
+        self.assertEqual(list(d), [])
+        seq = list(range(20))
+        d = deque([A()], maxlen=10)
+        d.extendleft(seq)
+        self.assertEqual(list(d), [])
+
+    def test_popn(self):
+        for n in (0, 1, 63, 64, 65, 200):
+            for k in (0, 1, 5, 64, 65, 200, 300):
+                d = deque(range(n))
+                l = list(range(n))
+                self.assertEqual(d.popleftn(k), l[:k])
+                self.assertEqual(list(d), l[k:])
+                d = deque(range(n))
+                self.assertEqual(d.popn(k), l[::-1][:k])
+                self.assertEqual(list(d), l[:max(n - k, 0)])
+        d = deque('abc')
+        self.assertRaises(ValueError, d.popleftn, -1)
+        self.assertRaises(ValueError, d.popn, -1)
+        self.assertRaises(TypeError, d.popleftn, 1.0)
+        self.assertRaises(TypeError, d.popn)
+        # The deque stays usable after being emptied in bulk
+        d = deque(range(100))
+        d.popleftn(100)
+        d.append(1)
+        d.appendleft(0)
+        self.assertEqual(list(d), [0, 1])
+
+    def test_popn_iteration(self):
+        d = deque(range(10))
+        it = iter(d)
+        d.popleftn(1)
+        self.assertRaises(RuntimeError, next, it)
+
     def test_add(self):
         d = deque()
         e = deque('abc')
@@ -236,6 +301,28 @@ def test_getitem(self):
             for j in range(1-len(l), len(l)):
                 assert d[j] == l[j]
 
+        # Sequential indexing interleaved with operations at both ends
+        d = deque(range(1000))
+        l = list(range(1000))
+        for i in range(0, 1000, 7):
+            self.assertEqual(d[i % len(l)], l[i % len(l)])
+            if i % 3 == 0:
+                d.appendleft(-i)
+                l.insert(0, -i)
+            if i % 5 == 0:
+                d.pop()
+                l.pop()
+            if i % 11 == 0:
+                d.popleftn(20)
+                del l[:20]
+            if i % 13 == 0:
+                d.rotate(100)
+                l[:] = l[-100:] + l[:-100]
+            self.assertEqual(d[len(l) // 3], l[len(l) // 3])
+            d[-len(l) // 2] = i
+            l[-len(l) // 2] = i
+        self.assertEqual(list(d), l)
+
         d = deque('superman')
         self.assertEqual(d[0], 's')
         self.assertEqual(d[-1], 'n')
@@ -741,7 +828,7 @@ class C(object):
     @support.cpython_only
     def test_sizeof(self):
         BLOCKLEN = 64
-        basesize = support.calcvobjsize('2P4nP')
+        basesize = support.calcvobjsize('2P4nPnP')
         blocksize = struct.calcsize('P%dPP' % BLOCKLEN)
         self.assertEqual(object.__sizeof__(deque()), basesize)
         check = self.check_sizeof
@@ -1693,6 +1693,167 @@ def f():
             return 1
         self.assertEqual(f.cache_parameters(), {'maxsize': 1000, "typed": True})
 
+        @self.module.lru_cache(maxsize=None, maxbytes=100, cost=len)
+        def f():
+            return 1
+        self.assertEqual(f.cache_parameters(),
+                         {'maxsize': None, "typed": False, 'maxbytes': 100,
+                          'cost': len})
+
+    def test_lru_cache_maxbytes(self):
+        calls = []
+        @self.module.lru_cache(maxsize=None, maxbytes=10, cost=len)
+        def f(x):
+            calls.append(x)
+            return 'x' * x
+        self.assertEqual(f(4), 'xxxx')
+        self.assertEqual(f(4), 'xxxx')
+        self.assertEqual(f(5), 'xxxxx')
+        stats = f.cache_stats()
+        self.assertEqual(stats['currsize'], 2)
+        self.assertEqual(stats['currbytes'], 9)
+        self.assertEqual(stats['maxbytes'], 10)
+        self.assertEqual(stats['evictions'], 0)
+        # 4 is the least recently used entry and makes room for 3
+        self.assertEqual(f(3), 'xxx')
+        stats = f.cache_stats()
+        self.assertEqual(stats['evictions'], 1)
+        self.assertEqual(stats['currbytes'], 8)
+        self.assertEqual(f(5), 'xxxxx')
+        self.assertEqual(calls, [4, 5, 3])
+        # Results costing more than maxbytes are returned but not cached
+        self.assertEqual(f(11), 'x' * 11)
+        self.assertEqual(f(11), 'x' * 11)
+        self.assertEqual(calls, [4, 5, 3, 11, 11])
+        self.assertEqual(f.cache_info(), (2, 5, None, 2))
+
+        # Without a cost function, sys.getsizeof() is used
+        @self.module.lru_cache(maxbytes=sys.getsizeof(b'x' * 100) * 2)
+        def g(x):
+            return b'x' * x
+        g(100)
+        g(101)
+        g(100)
+        stats = g.cache_stats()
+        self.assertEqual(stats['currsize'], 1)
+        self.assertEqual(stats['currbytes'], sys.getsizeof(b'x' * 100))
+        self.assertEqual(stats['evictions'], 2)
+
+        f.cache_clear()
+        stats = f.cache_stats()
+        self.assertEqual(stats['currsize'], 0)
+        self.assertEqual(stats['currbytes'], 0)
+        self.assertEqual(stats['evictions'], 0)
+
+    def test_lru_cache_maxbytes_with_maxsize(self):
+        @self.module.lru_cache(maxsize=2, maxbytes=100, cost=lambda r: 1)
+        def f(x):
+            return x
+        for x in range(5):
+            f(x)
+        self.assertEqual(f.cache_info(), (0, 5, 2, 2))
+        self.assertEqual(f.cache_stats()['evictions'], 3)
+
+    def test_lru_cache_ttl(self):
+        calls = []
+        @self.module.lru_cache(ttl=0.05)
+        def f(x):
+            calls.append(x)
+            return x
+        f(1)
+        f(1)
+        self.assertEqual(calls, [1])
+        time.sleep(0.1)
+        f(1)
+        self.assertEqual(calls, [1, 1])
+        stats = f.cache_stats()
+        self.assertEqual(stats['expirations'], 1)
+        self.assertEqual(stats['hits'], 1)
+        self.assertEqual(stats['misses'], 2)
+        self.assertEqual(stats['currsize'], 1)
+
+    def test_lru_cache_time_saved(self):
+        @self.module.lru_cache(ttl=3600)
+        def f(x):
+            time.sleep(0.01)
+            return x
+        f(1)
+        self.assertEqual(f.cache_stats()['time_saved'], 0)
+        f(1)
+        f(1)
+        self.assertGreaterEqual(f.cache_stats()['time_saved'], 0.01)
+
+    def test_lru_cache_budget_bad_arguments(self):
+        def f(x):
+            return x
+        with self.assertRaises(ValueError):
+            self.module.lru_cache(maxbytes=-1)(f)
+        with self.assertRaises(ValueError):
+            self.module.lru_cache(ttl=0)(f)
+        with self.assertRaises(TypeError):
+            self.module.lru_cache(cost=1)(f)
+        g = self.module.lru_cache(maxbytes=10, cost=lambda r: -1)(f)
+        with self.assertRaises(ValueError):
+            g(1)
+
+    def test_lru_cache_single_flight(self):
+        n = 5
+        calls = []
+        release = threading.Event()
+        @self.module.lru_cache(ttl=3600)
+        def f(x):
+            calls.append(x)
+            release.wait(10)
+            return 3 * x
+        results = []
+        def test():
+            results.append(f(2))
+        threads = [threading.Thread(target=test) for k in range(n)]
+        with threading_helper.start_threads(threads):
+            while not calls:
+                time.sleep(0.001)
+            time.sleep(0.05)
+            release.set()
+        self.assertEqual(results, [6] * n)
+        self.assertEqual(calls, [2])
+        self.assertEqual(f.cache_info(), (n - 1, 1, 128, 1))
+
+    def test_lru_cache_single_flight_error(self):
+        # A failing call wakes up the waiters, which then retry themselves
+        calls = []
+        release = threading.Event()
+        @self.module.lru_cache(ttl=3600)
+        def f(x):
+            calls.append(x)
+            if len(calls) == 1:
+                release.wait(10)
+                raise ValueError
+            return x
+        errors = []
+        def test():
+            try:
+                f(1)
+            except ValueError:
+                errors.append(1)
+        threads = [threading.Thread(target=test) for k in range(3)]
+        with threading_helper.start_threads(threads):
+            while not calls:
+                time.sleep(0.001)
+            time.sleep(0.05)
+            release.set()
+        self.assertEqual(errors, [1])
+        self.assertEqual(calls, [1, 1])
+
+    def test_lru_cache_single_flight_recursion(self):
+        @self.module.lru_cache(ttl=3600)
+        def f(x):
+            if x == 0:
+                return 0
+            return f(x) if x < 0 else x + f(x - 1)
+        self.assertEqual(f(5), 15)
+        with self.assertRaises(RecursionError):
+            f(-1)
+
     def test_lru_cache_weakrefable(self):
         @self.module.lru_cache
         def test_function(x):
@@ -17,6 +17,7 @@
 from test.support.script_helper import assert_python_ok, assert_python_failure
 
 gzip = import_helper.import_module('gzip')
+import zlib
 
 data1 = b"""  int length=DEFAULTALLOC, err = Z_OK;
   PyObject *RetVal;
@@ -553,6 +554,30 @@ def test_compress_mtime(self):
                         f.read(1) # to set mtime attribute
                         self.assertEqual(f.mtime, mtime)
 
+    def test_compress_threads(self):
+        data = (data1 + data2) * 5000
+        for threads in (0, 2, 3):
+            for level in (1, 9):
+                with self.subTest(threads=threads, level=level):
+                    datac = gzip.compress(data, level, threads=threads)
+                    self.assertEqual(gzip.decompress(datac), data)
+                    self.assertEqual(zlib.decompress(datac, 31), data)
+        self.assertEqual(gzip.decompress(gzip.compress(b'', threads=2)), b'')
+        self.assertRaises(ValueError, gzip.compress, data, threads=-1)
+
+    def test_write_threads(self):
+        data = (data1 + data2) * 5000
+        buf = io.BytesIO()
+        with gzip.GzipFile(fileobj=buf, mode='wb', threads=2) as f:
+            for i in range(0, len(data), 100003):
+                f.write(memoryview(data)[i:i+100003])
+            f.flush()
+            f.write(data1)
+            f.flush(zlib.Z_FULL_FLUSH)
+            f.write(array.array('I', data2[:100]))
+        expected = data + data1 + data2[:100]
+        self.assertEqual(gzip.decompress(buf.getvalue()), expected)
+
     def test_decompress(self):
         for data in (data1, data2):
             buf = io.BytesIO()
@@ -272,6 +272,44 @@ def test_get_builtin_constructor(self):
         self.assertIs(constructor, _md5.md5)
         self.assertEqual(sorted(builtin_constructor_cache), ['MD5', 'md5'])
 
+    def test_hash_many(self):
+        messages = [b'', b'abc', bytearray(b'x' * 1000),
+                    memoryview(b'y' * 100000), array.array('b', b'z' * 63)]
+        for name in ('md5', 'sha1', 'SHA1', 'sha224', 'sha256', 'SHA256',
+                     'sha512', 'sha3_256', 'blake2b'):
+            with self.subTest(name=name):
+                expected = [hashlib.new(name, m).digest() for m in messages]
+                self.assertEqual(hashlib.hash_many(name, messages), expected)
+                self.assertEqual(hashlib.hash_many(name, iter(messages)),
+                                 expected)
+                self.assertEqual(hashlib.hash_many(name, []), [])
+                self.assertRaises(TypeError, hashlib.hash_many, name,
+                                  [b'abc', 'abc'])
+                self.assertRaises(TypeError, hashlib.hash_many, name, 1)
+        self.assertRaises(ValueError, hashlib.hash_many, 'spam', [b''])
+
+    def test_builtin_hash_many(self):
+        # Messages around the block size exercise padding in the builtin
+        # block functions, which use the SHA extensions when available.
+        messages = [bytes(range(256)) * 4 for _ in range(3)]
+        messages += [bytes(range(n)) for n in range(130)]
+        for module_name, funcs in (('_sha1', ('sha1',)),
+                                   ('_sha256', ('sha224', 'sha256'))):
+            module = self._conditional_import_module(module_name)
+            if module is None:
+                continue
+            for func in funcs:
+                with self.subTest(func=func):
+                    many = getattr(module, func + '_many')
+                    cons = getattr(module, func)
+                    self.assertEqual(many(messages),
+                                     [cons(m).digest() for m in messages])
+                    h = cons()
+                    for m in messages:
+                        h.update(m)
+                    self.assertEqual(h.digest(),
+                                     cons(b''.join(messages)).digest())
+
     def test_hexdigest(self):
         for cons in self.hash_constructors:
             h = cons(usedforsecurity=False)
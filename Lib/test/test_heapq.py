@@ -1,5 +1,6 @@
 """Unittests for heapq."""
 
+import gc
 import random
 import unittest
 import doctest
@@ -15,7 +16,7 @@
 # _heapq.nlargest/nsmallest are saved in heapq._nlargest/_smallest when
 # _heapq is imported, so check them there
 func_names = ['heapify', 'heappop', 'heappush', 'heappushpop', 'heapreplace',
-              '_heappop_max', '_heapreplace_max', '_heapify_max']
+              '_heappop_max', '_heapreplace_max', '_heapify_max', 'Heap']
 
 class TestModules(TestCase):
     def test_py_functions(self):
@@ -274,6 +275,166 @@ class TestHeapC(TestHeap, TestCase):
     module = c_heapq
 
 
+class TestHeapType:
+
+    def test_push_pop(self):
+        data = [random.random() for i in range(256)]
+        heap = self.module.Heap()
+        for item in data:
+            heap.push(item)
+        self.assertEqual(len(heap), len(data))
+        self.assertEqual(heap.peek(), min(data))
+        self.assertEqual([heap.pop() for i in range(len(data))], sorted(data))
+        self.assertEqual(len(heap), 0)
+        self.assertFalse(heap)
+        self.assertRaises(IndexError, heap.pop)
+        self.assertRaises(IndexError, heap.peek)
+
+    def test_mixed_keys(self):
+        # Unboxed int and float keys must still compare correctly with
+        # each other and with arbitrary objects.
+        data = [3, 2.5, 2**70, -2**70, 0, -1.5, 10**18, True, float('inf')]
+        heap = self.module.Heap(data)
+        self.assertEqual(heap.popmany(len(data)), sorted(data))
+
+    def test_key(self):
+        data = [(random.randrange(50), i) for i in range(300)]
+        heap = self.module.Heap(data, key=itemgetter(0))
+        self.assertIs(heap.key, heap.key)
+        out = heap.popmany(len(data))
+        self.assertEqual([k for k, i in out], sorted(k for k, i in data))
+        self.assertIsNone(self.module.Heap().key)
+        self.assertRaises(TypeError, self.module.Heap, key=1)
+        self.assertRaises(TypeError, self.module.Heap, [], itemgetter(0))
+
+    def test_pushmany_popmany(self):
+        for n, m in ((0, 10), (10, 0), (5, 100), (100, 5), (50, 50)):
+            first = [random.randrange(1000) for i in range(n)]
+            second = [random.randrange(1000) for i in range(m)]
+            heap = self.module.Heap(first)
+            heap.pushmany(iter(second))
+            self.assertEqual(heap.popmany(10), sorted(first + second)[:10])
+            self.assertEqual(heap.popmany(n + m), sorted(first + second)[10:])
+            self.assertEqual(heap.popmany(1), [])
+        self.assertRaises(ValueError, heap.popmany, -1)
+        self.assertRaises(TypeError, heap.pushmany, 1)
+
+    def test_remove(self):
+        data = list(range(100))
+        random.shuffle(data)
+        heap = self.module.Heap()
+        handles = {item: heap.push(item) for item in data}
+        removed = set(random.sample(data, 40))
+        for item in removed:
+            self.assertEqual(heap.remove(handles[item]), item)
+            self.assertEqual(handles[item].item, item)
+        self.assertEqual(heap.popmany(100),
+                         sorted(set(data) - removed))
+        # Removed and popped handles are no longer in the heap.
+        for handle in handles.values():
+            self.assertRaises(ValueError, heap.remove, handle)
+        self.assertRaises(ValueError, self.module.Heap().remove,
+                          heap.push(1))
+        self.assertRaises(TypeError, heap.remove, 1)
+
+    def test_update(self):
+        data = [random.random() for i in range(100)]
+        heap = self.module.Heap()
+        handles = [heap.push(item) for item in data]
+        for i in random.sample(range(100), 50):
+            data[i] = random.random() * 2 - 0.5
+            heap.update(handles[i], data[i])
+            self.assertIs(handles[i].item, data[i])
+            self.assertEqual(heap.peek(), min(data))
+        self.assertEqual(heap.popmany(100), sorted(data))
+        self.assertRaises(ValueError, heap.update, handles[0], 0)
+        with self.assertRaises(AttributeError):
+            handles[0].item = 0
+
+    def test_gc_during_comparison(self):
+        # Every handle must be in the heap exactly once while __lt__ runs.
+        class Key:
+            def __init__(self, value):
+                self.value = value
+            def __lt__(self, other):
+                gc.collect()
+                return self.value < other.value
+        data = list(range(15))
+        random.shuffle(data)
+        heap = self.module.Heap(key=Key)
+        handles = [heap.push(x) for x in data]
+        heap.update(handles[5], -1)
+        heap.remove(handles[10])
+        self.assertEqual([heap.pop() for i in range(14)],
+                         sorted(set(data + [-1]) - {data[5], data[10]}))
+
+    def test_decrease_key(self):
+        # Dijkstra-style decrease-key with a key function.
+        heap = self.module.Heap(key=itemgetter(0))
+        handles = [heap.push((10 * i, i)) for i in range(20)]
+        heap.update(handles[15], (-1, 15))
+        heap.update(handles[0], (1000, 0))
+        self.assertEqual(heap.pop(), (-1, 15))
+        self.assertEqual(heap.popmany(100)[-1], (1000, 0))
+
+    def test_clear(self):
+        heap = self.module.Heap(range(10))
+        handle = heap.push(5)
+        heap.clear()
+        self.assertEqual(len(heap), 0)
+        self.assertRaises(ValueError, heap.remove, handle)
+        heap.push(1)
+        self.assertEqual(heap.pop(), 1)
+
+    def test_key_errors(self):
+        def key(x):
+            if x == 3:
+                raise ZeroDivisionError
+            return x
+        heap = self.module.Heap([5, 4], key=key)
+        self.assertRaises(ZeroDivisionError, heap.push, 3)
+        self.assertRaises(ZeroDivisionError, heap.pushmany, [1, 2, 3])
+        handle = heap.push(6)
+        self.assertRaises(ZeroDivisionError, heap.update, handle, 3)
+        self.assertEqual(heap.popmany(10), [4, 5, 6])
+
+    def test_cmp_err(self):
+        heap = self.module.Heap()
+        heap.push(CmpErr())
+        self.assertRaises(ZeroDivisionError, heap.push, CmpErr())
+
+    def test_unorderable_items(self):
+        # Items without an order of their own can be used through a key.
+        heap = self.module.Heap(key=itemgetter('t'))
+        heap.pushmany([{'t': 3}, {'t': 1}])
+        heap.push({'t': 2})
+        self.assertEqual(heap.popmany(3), [{'t': 1}, {'t': 2}, {'t': 3}])
+
+class TestHeapTypePython(TestHeapType, TestCase):
+    module = py_heapq
+
+
+@skipUnless(c_heapq, 'requires _heapq')
+class TestHeapTypeC(TestHeapType, TestCase):
+    module = c_heapq
+
+    def test_mutation_during_comparison(self):
+        class Evil:
+            def __init__(self, value):
+                self.value = value
+            def __lt__(self, other):
+                heap.push(Evil(0))
+                return self.value < other.value
+        heap = self.module.Heap()
+        heap.push(Evil(1))
+        self.assertRaises(RuntimeError, heap.push, Evil(2))
+        self.assertRaises(RuntimeError, heap.pushmany, [Evil(2)])
+
+    def test_handle_not_instantiable(self):
+        handle = self.module.Heap().push(1)
+        self.assertRaises(TypeError, type(handle))
+
+
 #==============================================================================
 
 class LenOnly:
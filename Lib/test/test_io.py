@@ -1787,6 +1787,65 @@ def test_writelines_error(self):
         self.assertRaises(TypeError, bufio.writelines, None)
         self.assertRaises(TypeError, bufio.writelines, 'abc')
 
+    def test_writelines_closed(self):
+        # A closed writer raises even if there is nothing to write.
+        self.addCleanup(os_helper.unlink, os_helper.TESTFN)
+        for raw in (self.MockRawIO(),
+                    self.FileIO(os_helper.TESTFN, self.write_mode)):
+            with self.subTest(raw=type(raw).__name__):
+                bufio = self.tp(raw, 8)
+                bufio.close()
+                self.assertRaises(ValueError, bufio.writelines, [])
+                self.assertRaises(ValueError, bufio.writelines, iter([]))
+                self.assertRaises(ValueError, bufio.writelines, [b'ab'])
+
+    def test_writelines_file(self):
+        # Lines which do not fit in the buffer are written to a FileIO
+        # together with the buffered data, bypassing the buffer.
+        self.addCleanup(os_helper.unlink, os_helper.TESTFN)
+        with self.tp(self.FileIO(os_helper.TESTFN, self.write_mode),
+                     16) as bufio:
+            bufio.write(b"head")
+            bufio.writelines([b"a" * 20, b"", bytearray(b"b" * 30),
+                              memoryview(b"cde")[1:]])
+            self.assertEqual(bufio.tell(), 56)
+            bufio.writelines([b"f", b"g"])
+            self.assertEqual(bufio.tell(), 58)
+            bufio.writelines(iter([b"h" * 40]))
+            bufio.seek(2)
+            bufio.writelines([b"i" * 3, b"j" * 17])
+            self.assertEqual(bufio.tell(), 22)
+            bufio.writelines([])
+            self.assertEqual(bufio.tell(), 22)
+        with self.open(os_helper.TESTFN, "rb") as f:
+            self.assertEqual(f.read(), b"he" + b"i" * 3 + b"j" * 17 +
+                             b"aa" + b"b" * 30 + b"defg" + b"h" * 40)
+
+    def test_writelines_file_error(self):
+        # Nothing is written if one of the lines is not bytes-like.
+        self.addCleanup(os_helper.unlink, os_helper.TESTFN)
+        with self.tp(self.FileIO(os_helper.TESTFN, "w"), 16) as bufio:
+            self.assertRaises(TypeError, bufio.writelines, [b"a" * 20, "b"])
+            self.assertEqual(bufio.tell(), 0)
+        self.assertEqual(os.path.getsize(os_helper.TESTFN), 0)
+
+    @unittest.skipUnless(hasattr(os, 'set_blocking'),
+                         'os.set_blocking() required for this test')
+    def test_writelines_non_blocking(self):
+        r, w = os.pipe()
+        os.set_blocking(w, False)
+        data = [bytes([i]) * 100_000 for i in range(b"a"[0], b"z"[0])]
+        with self.FileIO(r, "r") as rf:
+            wf = self.tp(self.FileIO(w, "w"), 1024)
+            with self.assertRaises(BlockingIOError):
+                wf.writelines(data)
+            received = rf.read(sum(map(len, data)))
+            self.assertTrue(b"".join(data).startswith(received))
+            try:
+                wf.close()
+            except BlockingIOError:
+                pass
+
     def test_destructor(self):
         writer = self.MockRawIO()
         bufio = self.tp(writer, 8)
@@ -2401,6 +2460,9 @@ def test_interleaved_readline_write(self):
 
     # You can't construct a BufferedRandom over a non-seekable stream.
     test_unseekable = None
+    test_writelines_non_blocking = None
+    # BufferedRandom.writelines() writes each line in turn.
+    test_writelines_file_error = None
 
     # writable() returns True, so there's no point to test it over
     # a writable stream.
@@ -3086,6 +3148,52 @@ def test_multibyte_seek_and_tell(self):
         self.assertEqual(f.tell(), p1)
         f.close()
 
+    def test_builtin_decoders_chunks(self):
+        # UTF-8, Latin-1 and ASCII input split at every possible point
+        # decodes and seeks back correctly.
+        text = "ab\r\ncd\u00e9\u20ac\U0001d11e\rx\ny\n"
+        for encoding in "utf-8", "latin-1", "ascii":
+            data = text.encode(encoding, "replace")
+            expected = data.decode(encoding)
+            for newline in None, "":
+                for chunk_size in 1, 2, 3, 5:
+                    with self.subTest(encoding=encoding, newline=newline,
+                                      chunk_size=chunk_size):
+                        t = self.TextIOWrapper(self.BytesIO(data * 3),
+                                               encoding=encoding,
+                                               newline=newline)
+                        t._CHUNK_SIZE = chunk_size
+                        lines = []
+                        while True:
+                            pos = t.tell()
+                            line = t.readline()
+                            if not line:
+                                break
+                            lines.append((pos, line))
+                        if newline is None:
+                            self.assertEqual(t.newlines, ("\r", "\n", "\r\n"))
+                            self.assertEqual("".join(l for p, l in lines),
+                                             expected.replace("\r\n", "\n")
+                                                     .replace("\r", "\n") * 3)
+                        else:
+                            self.assertEqual("".join(l for p, l in lines),
+                                             expected * 3)
+                        for pos, line in lines:
+                            t.seek(pos)
+                            self.assertEqual(t.readline(), line)
+
+    def test_builtin_decoders_errors(self):
+        t = self.TextIOWrapper(self.BytesIO(b"a\xffb\xe2\x82"),
+                               encoding="utf-8", errors="replace")
+        self.assertEqual(t.read(), "a\ufffdb\ufffd")
+        t = self.TextIOWrapper(self.BytesIO(b"a\xffb"),
+                               encoding="ascii", errors="surrogateescape")
+        self.assertEqual(t.read(), "a\udcffb")
+        t = self.TextIOWrapper(self.BytesIO(b"a\xe2\x82"), encoding="utf-8")
+        t._CHUNK_SIZE = 1
+        self.assertEqual(t.read(1), "a")
+        self.assertRaises(UnicodeDecodeError, t.read)
+
     def test_seek_with_encoder_state(self):
         f = self.open(os_helper.TESTFN, "w", encoding="euc_jis_2004")
         f.write("\u00e6\u0300")
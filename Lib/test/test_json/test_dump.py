@@ -1,4 +1,4 @@
-from io import StringIO
+from io import BytesIO, StringIO
 from test.test_json import PyTest, CTest
 
 from test.support import bigmemtest, _1G
@@ -57,6 +57,66 @@ def __lt__(self, o):
         d[1337] = "true.dat"
         self.assertEqual(self.dumps(d, sort_keys=True), '{"1337": "true.dat"}')
 
+    def test_dumpb(self):
+        docs = [
+            {}, [], 'abc', 1, -2.5, None, True, float('nan'),
+            {'a': [1, {'b': None}], 'c': 'x\ty"z\\', 'd': (1, 2)},
+            ['\x00\x1f\x7f', 'caf\xe9 \u20ac \U0001f600', '\ud800'],
+            ['0123456789abcdef"0123456789abcdef\n0123456789'],
+            [{'key': i, 'k\xe9y': 'v'} for i in range(3)],
+        ]
+        for doc in docs:
+            for kw in ({}, {'ensure_ascii': False}, {'sort_keys': True},
+                       {'separators': (',', ':')}, {'indent': 2}):
+                if (not kw.get('ensure_ascii', True) and
+                        '\ud800' in self.dumps(doc, ensure_ascii=False)):
+                    self.assertRaises(UnicodeEncodeError,
+                                      self.json.dumpb, doc, **kw)
+                    continue
+                with self.subTest(doc=doc, **kw):
+                    expected = self.dumps(doc, **kw).encode('utf-8')
+                    self.assertEqual(self.json.dumpb(doc, **kw), expected)
+                    bio = BytesIO()
+                    self.assertIsNone(self.json.dumpb(doc, bio, **kw))
+                    self.assertEqual(bio.getvalue(), expected)
+
+    def test_dumpb_options(self):
+        self.assertEqual(self.json.dumpb({'a': object(), 'b': 1},
+                                         default=lambda o: [o.__class__.__name__]),
+                         b'{"a": ["object"], "b": 1}')
+        self.assertEqual(self.json.dumpb({b'x': 1, 'y': 2}, skipkeys=True),
+                         b'{"y": 2}')
+        self.assertEqual(self.json.dumpb({2: 3.0, 4.0: 5, False: 1, None: 0},
+                                         sort_keys=False),
+                         b'{"2": 3.0, "4.0": 5, "false": 1, "null": 0}')
+        self.assertRaises(TypeError, self.json.dumpb, {b'x': 1})
+        self.assertRaises(ValueError, self.json.dumpb, float('inf'),
+                          allow_nan=False)
+        a = []
+        a.append(a)
+        self.assertRaises(ValueError, self.json.dumpb, a)
+        d = {}
+        d['d'] = d
+        self.assertRaises(ValueError, self.json.dumpb, d)
+
+    def test_dumpb_chunks(self):
+        doc = [{'name': 'item %d' % i, 'value': i} for i in range(10000)]
+        expected = self.dumps(doc).encode()
+        chunks = []
+        self.assertIsNone(self.json.JSONEncoder().encode_bytes(doc,
+                                                               chunks.append))
+        self.assertEqual(b''.join(chunks), expected)
+        self.assertTrue(all(isinstance(c, bytes) for c in chunks))
+        if len(chunks) > 1:
+            self.assertLessEqual(max(map(len, chunks[:-1])), 65536)
+        self.assertEqual(self.json.dumpb(doc), expected)
+
+    def test_dumpb_write_error(self):
+        def write(data):
+            raise OSError
+        self.assertRaises(OSError, self.json.JSONEncoder().encode_bytes,
+                          ['x' * 100000], write)
+
 
 class TestPyDump(TestDump, PyTest): pass
 
@@ -0,0 +1,129 @@
+import io
+from decimal import Decimal
+from test.test_json import PyTest, CTest
+
+
+DOCS = [{'a': [1, '}]'], 'b': None}, [], 'x\\"y', -1.5e3, True, False,
+        None, 0, {}, ['€', '\U0001f600', '\ud800']]
+
+
+class TestStream:
+    def split_all(self, data, **kw):
+        splitter = self.json.decoder.make_splitter(**kw)
+        result = []
+        for i in range(len(data)):
+            result += splitter.feed(data[i:i+1])
+        return result + splitter.close()
+
+    def decode_chunks(self, data, size, **kw):
+        decoder = self.json.decoder.IncrementalDecoder(**kw)
+        result = []
+        for i in range(0, len(data), size):
+            result += decoder.feed(data[i:i+size])
+        return result + decoder.close()
+
+    def test_values(self):
+        text = '\n'.join(self.dumps(doc) for doc in DOCS) + '\n'
+        data = text.encode('utf-8', 'surrogatepass')
+        for size in (1, 2, 3, 7, len(data)):
+            self.assertEqual(self.decode_chunks(data, size), DOCS)
+        self.assertEqual(self.decode_chunks(text, 5), DOCS)
+
+    def test_array(self):
+        data = self.dumps(DOCS, ensure_ascii=False, indent=2).encode(
+            'utf-8', 'surrogatepass')
+        for size in (1, 4, len(data)):
+            self.assertEqual(self.decode_chunks(data, size, array=True), DOCS)
+        self.assertEqual(self.decode_chunks(b' [ ] ', 1, array=True), [])
+
+    def test_records(self):
+        self.assertEqual(self.split_all(b'1 "a"{"b":[2]}[3]true 4.5'),
+                         ['1', '"a"', '{"b":[2]}', '[3]', 'true', '4.5'])
+        self.assertEqual(self.split_all(b'[1,"a" , {"b":2}]', array=True),
+                         ['1', '"a"', '{"b":2}'])
+        self.assertEqual(self.split_all(b''), [])
+
+    def test_incomplete(self):
+        splitter = self.json.decoder.make_splitter()
+        self.assertEqual(splitter.feed(b'{"a": "\\"}'), [])
+        self.assertEqual(splitter.feed(b'"} 12'), ['{"a": "\\"}"}'])
+        self.assertEqual(splitter.feed(b'3'), [])
+        self.assertEqual(splitter.close(), ['123'])
+
+    def test_bom(self):
+        splitter = self.json.decoder.make_splitter()
+        self.assertEqual(splitter.feed(b'\xef'), [])
+        self.assertEqual(splitter.feed(b'\xbb\xbf[1] '), ['[1]'])
+        self.assertEqual(splitter.close(), [])
+        self.assertEqual(self.split_all(b'\xef\xbb\xbf[1]', array=True), ['1'])
+
+    def test_decoder(self):
+        decoder = self.json.JSONDecoder(parse_float=Decimal)
+        inc = self.json.decoder.IncrementalDecoder(decoder, array=True)
+        self.assertIs(inc.decoder, decoder)
+        self.assertEqual(inc.feed(b'[1.5, {"a": 2.'), [Decimal('1.5')])
+        self.assertEqual(inc.feed(b'25}]'), [{'a': Decimal('2.25')}])
+        self.assertEqual(inc.close(), [])
+
+    def test_iterload(self):
+        text = ''.join(self.dumps(doc) + '\n' for doc in DOCS)
+        it = self.json.iterload(io.StringIO(text), chunk_size=3)
+        self.assertEqual(next(it), DOCS[0])
+        self.assertEqual(list(it), DOCS[1:])
+        data = self.dumps(DOCS).encode()
+        self.assertEqual(list(self.json.iterload(io.BytesIO(data),
+                                                 array=True, chunk_size=5)),
+                         DOCS)
+        it = self.json.iterload(io.BytesIO(b'{"a": 1.5}'),
+                                parse_float=Decimal)
+        self.assertEqual(list(it), [{'a': Decimal('1.5')}])
+
+    def test_invalid_utf8(self):
+        for data in (b'"\xff"', b'["\xc3"]', b'\xe2\x82'):
+            with self.subTest(data=data):
+                with self.assertRaises(UnicodeDecodeError):
+                    self.split_all(data)
+
+    def test_errors(self):
+        cases = [
+            (b'{"a": 1', {}, 'Unterminated value'),
+            (b'"abc', {}, 'Unterminated string'),
+            (b']', {}, 'Expecting value'),
+            (b'', {'array': True}, 'Expecting value'),
+            (b'{}', {'array': True}, "Expecting '['"),
+            (b'[1 2]', {'array': True}, "Expecting ',' delimiter"),
+            (b'[1,]', {'array': True}, 'Expecting value'),
+            (b'[,1]', {'array': True}, 'Expecting value'),
+            (b'[1] 2', {'array': True}, 'Extra data'),
+            (b'[1, 2', {'array': True}, 'Unterminated array'),
+        ]
+        for data, kw, msg in cases:
+            with self.subTest(data=data, **kw):
+                with self.assertRaises(self.JSONDecodeError) as cm:
+                    self.split_all(data, **kw)
+                self.assertEqual(cm.exception.msg, msg)
+        with self.assertRaises(self.JSONDecodeError) as cm:
+            self.decode_chunks(b'1\n[1 2]', 4)
+        self.assertEqual(cm.exception.msg, "Expecting ',' delimiter")
+        # Positions are relative to the record, not to the stream.
+        self.assertEqual(cm.exception.doc, '[1 2]')
+        self.assertEqual(cm.exception.pos, 3)
+        self.assertEqual((cm.exception.lineno, cm.exception.colno), (1, 4))
+
+    def test_bounded_buffer(self):
+        splitter = self.json.decoder.make_splitter()
+        record = b'{"key": "' + b'x' * 1000 + b'"}\n'
+        for i in range(100):
+            self.assertEqual(len(splitter.feed(record)), 1)
+        self.assertEqual(splitter.feed(record[:50]), [])
+        self.assertEqual(splitter.feed(record[50:]),
+                         [record.decode().strip()])
+
+    def test_bad_arguments(self):
+        splitter = self.json.decoder.make_splitter()
+        self.assertRaises(TypeError, splitter.feed, 'str')
+        self.assertRaises(TypeError, self.json.decoder.make_splitter, True)
+
+
+class TestPyStream(TestStream, PyTest): pass
+class TestCStream(TestStream, CTest): pass
@@ -190,6 +190,38 @@ def test_decompressor_chunks_maxsize(self):
         self.assertEqual(lzd.check, lzma.CHECK_CRC64)
         self.assertEqual(lzd.unused_data, b"")
 
+    def test_decompressor_decompress_into(self):
+        lzd = LZMADecompressor()
+        buf = bytearray(100)
+        out = []
+
+        # Feed first half the input
+        len_ = len(COMPRESSED_XZ) // 2
+        n = lzd.decompress_into(COMPRESSED_XZ[:len_], buf)
+        self.assertFalse(lzd.needs_input)
+        self.assertEqual(n, len(buf))
+        out.append(bytes(buf))
+
+        # Retrieve remaining data, providing the rest of the input once
+        n = lzd.decompress_into(COMPRESSED_XZ[len_:], buf)
+        out.append(bytes(buf[:n]))
+        while not lzd.eof:
+            n = lzd.decompress_into(b'', buf)
+            self.assertLessEqual(n, len(buf))
+            out.append(bytes(buf[:n]))
+
+        self.assertEqual(b"".join(out), INPUT)
+        self.assertEqual(lzd.check, lzma.CHECK_CRC64)
+        self.assertEqual(lzd.unused_data, b"")
+        self.assertRaises(EOFError, lzd.decompress_into, b'', buf)
+
+    def test_decompressor_decompress_into_bad_buffer(self):
+        lzd = LZMADecompressor()
+        self.assertRaises(TypeError, lzd.decompress_into, COMPRESSED_XZ)
+        self.assertRaises(TypeError, lzd.decompress_into, COMPRESSED_XZ,
+                          b'x' * 10)
+        self.assertEqual(lzd.decompress_into(b'', bytearray()), 0)
+
     def test_decompressor_inputbuf_1(self):
         # Test reusing input buffer after moving existing
         # contents to beginning
@@ -511,6 +511,62 @@ def testNoIntern(self):
         s2 = sys.intern(s)
         self.assertNotEqual(id(s2), id(s))
 
+class StringTableTestCase(unittest.TestCase, HelperMixin):
+    def test_roundtrip(self):
+        sample = ('spam', sys.intern('eggs'), '\u20ac', '\udc80', '',
+                  'x' * 300, -1, 0, 127, -(2**31), 2**31 - 1, 2**31, 2**70,
+                  ['spam', {'eggs': 'spam'}, {'eggs', 'ham'}])
+        for v in range(5, marshal.version + 1):
+            self.helper(sample, v)
+        self.helper(sample)
+
+    def test_equal_strings_are_shared(self):
+        a = ''.join(['sp', 'am'])
+        b = ''.join(['sp', 'am'])
+        self.assertIsNot(a, b)
+        data = marshal.dumps([a, b], 5)
+        self.assertEqual(data.count(b'spam'), 1)
+        new = marshal.loads(data)
+        self.assertEqual(new, [a, b])
+        self.assertIs(new[0], new[1])
+
+    def test_interned(self):
+        a = ''.join(['an interned', ' string'])
+        b = sys.intern('an interned string')
+        for sample in ([a, b], [b, a]):
+            new = marshal.loads(marshal.dumps(sample, 5))
+            self.assertIs(new[0], b)
+            self.assertIs(new[1], b)
+
+    def test_smaller_than_version_4(self):
+        with open(__file__, "rb") as f:
+            code = compile(f.read(), __file__, "exec")
+        self.assertLess(len(marshal.dumps(code, 5)),
+                        len(marshal.dumps(code, 4)))
+        self.assertEqual(marshal.loads(marshal.dumps(code, 5)), code)
+        self.assertLess(len(marshal.dumps(list(range(-64, 64)), 5)),
+                        len(marshal.dumps(list(range(-64, 64)), 4)))
+
+    def test_truncated(self):
+        data = marshal.dumps(('spam', 'eggs', 12345, ['spam'] * 3), 5)
+        for i in range(len(data)):
+            with self.assertRaises((EOFError, ValueError, TypeError)):
+                marshal.loads(data[:i])
+
+    def test_bad_data(self):
+        # string reference without a table
+        self.assertRaises(ValueError, marshal.loads, b'q\x00')
+        # string reference out of range
+        self.assertRaises(ValueError, marshal.loads, b'X\x01\x02\x01aq\x01')
+        # unknown string table flags
+        self.assertRaises(ValueError, marshal.loads, b'X\x01\x04\x01aq\x00')
+        # overlong varint
+        self.assertRaises(ValueError, marshal.loads, b'v' + b'\xff' * 10)
+        # invalid object reference
+        self.assertRaises(ValueError, marshal.loads, b'R\x00')
+        self.assertEqual(marshal.loads(b'X\x01\x02\x01aq\x00'), 'a')
+        self.assertEqual(marshal.loads(b'v\x03'), -2)
+
 @support.cpython_only
 @unittest.skipUnless(_testcapi, 'requires _testcapi')
 class CAPI_TestCase(unittest.TestCase, HelperMixin):
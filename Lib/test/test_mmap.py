@@ -303,6 +303,109 @@ def test_rfind(self):
         self.assertEqual(m.rfind(b'one', 1, -2), -1)
         self.assertEqual(m.rfind(bytearray(b'one')), 8)
 
+    def test_find_long_needle(self):
+        data = b'ab' * 1000 + b'abc' + b'ab' * 1000
+        m = mmap.mmap(-1, len(data))
+        m[:] = data
+        for sub in b'ab' * 100 + b'c', b'c' + b'ab' * 100, b'abc', b'':
+            self.assertEqual(m.find(sub), data.find(sub))
+            self.assertEqual(m.rfind(sub), data.rfind(sub))
+            self.assertEqual(m.find(sub, 2001, 2003), data.find(sub, 2001, 2003))
+            self.assertEqual(m.rfind(sub, 5, -5), data.rfind(sub, 5, -5))
+        self.assertEqual(m.find(b'', 10, 5), -1)
+        self.assertEqual(m.rfind(b'', 10, 5), -1)
+        m.close()
+
+    def test_iterlines(self):
+        data = b'one\ntwo\n\nthree\r\nfour'
+        m = mmap.mmap(-1, len(data))
+        m[:] = data
+        lines = list(m.iterlines())
+        self.assertEqual([bytes(line) for line in lines],
+                         data.splitlines(keepends=True))
+        self.assertTrue(all(type(line) is memoryview for line in lines))
+        self.assertEqual(m.tell(), len(data))
+        self.assertEqual(list(m.iterlines()), [])
+        # The lines share the map's memory, which cannot go away under them.
+        m[0:1] = b'O'
+        self.assertEqual(bytes(lines[0]), b'One\n')
+        self.assertRaises(BufferError, m.close)
+        del lines
+        gc_collect()
+
+        m.seek(4)
+        it = m.iterlines()
+        self.assertEqual(bytes(next(it)), b'two\n')
+        self.assertEqual(m.tell(), 8)
+        m.seek(0)
+        self.assertEqual(bytes(next(it)), b'One\n')
+        del it
+        gc_collect()
+
+        m.seek(0)
+        self.assertEqual([bytes(r) for r in m.iterlines(b'\r\n')],
+                         [b'One\ntwo\n\nthree\r\n', b'four'])
+        m.seek(0)
+        self.assertEqual([bytes(r) for r in m.iterlines(bytearray(b'o'))],
+                         [b'One\ntwo', b'\n\nthree\r\nfo', b'ur'])
+        self.assertRaises(ValueError, m.iterlines, b'')
+        self.assertRaises(TypeError, m.iterlines, '\n')
+        self.assertRaises(ValueError, m.iterlines, prefetch=-1)
+        self.assertRaises(ValueError, m.iterlines, errors='strict')
+        m.close()
+        self.assertRaises(ValueError, m.iterlines)
+
+    def test_iterlines_decode(self):
+        data = 'caf\xe9\n\u20ac\n'.encode('utf-8') + b'\xff'
+        m = mmap.mmap(-1, len(data))
+        m[:] = data
+        it = m.iterlines(encoding='utf-8')
+        self.assertEqual(next(it), 'caf\xe9\n')
+        self.assertEqual(next(it), '\u20ac\n')
+        self.assertRaises(UnicodeDecodeError, next, it)
+        self.assertEqual(m.tell(), len(data) - 1)
+        self.assertEqual(list(m.iterlines(encoding='utf-8', errors='replace')),
+                         ['\ufffd'])
+        m.seek(0)
+        self.assertEqual(list(m.iterlines(encoding='latin-1'))[0], 'caf\xc3\xa9\n')
+        # Decoding does not pin the map.
+        it = m.iterlines(encoding='ascii')
+        m.close()
+        self.assertRaises(ValueError, next, it)
+
+    def test_iterlines_decode_close(self):
+        # The map cannot go away while a codec decodes a line.
+        import codecs
+        def decode(data, errors='strict'):
+            self.assertRaises(BufferError, m.close)
+            self.assertRaises(BufferError, m.resize, 1)
+            return str(data, 'ascii'), len(data)
+        def search(name):
+            if name == 'test_mmap_closing':
+                return codecs.CodecInfo(None, decode, name=name)
+        codecs.register(search)
+        self.addCleanup(codecs.unregister, search)
+        m = mmap.mmap(-1, 8)
+        m[:] = b'abc\ndef\n'
+        self.assertEqual(list(m.iterlines(encoding='test_mmap_closing')),
+                         ['abc\n', 'def\n'])
+        m.close()
+
+    def test_iterlines_prefetch(self):
+        data = b'x' * 100 + b'\n'
+        with open(TESTFN, 'wb') as f:
+            f.write(data * 1000)
+        with open(TESTFN, 'rb') as f:
+            m = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+        m.seek(5 * PAGESIZE + 3)
+        lines = list(m.iterlines(prefetch=PAGESIZE))
+        self.assertEqual(b''.join(lines), m[5 * PAGESIZE + 3:])
+        self.assertTrue(lines[0].readonly)
+        del lines
+        m.seek(0)
+        self.assertEqual(len(list(m.iterlines(prefetch=10**12))), 1000)
+        m.close()
+
 
     def test_double_close(self):
         # make sure a double close doesn't crash on Solaris (Bug# 665913)
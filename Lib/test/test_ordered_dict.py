@@ -763,9 +763,9 @@ def test_sizeof_exact(self):
         od.x = 1
         check(od, basicsize)
         od.update([(i, i) for i in range(3)])
-        check(od, basicsize + keysize + 8*p + 8 + 5*entrysize + 3*nodesize)
+        check(od, basicsize + keysize + 8*p + 8*2 + 5*entrysize + 3*nodesize)
         od.update([(i, i) for i in range(3, 10)])
-        check(od, basicsize + keysize + 16*p + 16 + 10*entrysize + 10*nodesize)
+        check(od, basicsize + keysize + 16*p + 16*2 + 10*entrysize + 10*nodesize)
 
         check(od.keys(), size('P'))
         check(od.items(), size('P'))
@@ -1526,6 +1526,21 @@ def test_fd_leak(self):
     test_walk_many_open_files = None
 
 
+class ThreadedWalkTests(WalkTests):
+    """Tests for os.walk() with a thread pool."""
+    def walk(self, top, **kwargs):
+        return super().walk(top, workers=3, **kwargs)
+
+    def test_bad_workers(self):
+        self.assertRaises(ValueError, os.walk, self.walk_path, workers=0)
+
+    def test_close(self):
+        walk_it = self.walk(self.walk_path)
+        next(walk_it)
+        walk_it.close()
+        self.assertEqual(list(walk_it), [])
+
+
 class BytesWalkTests(WalkTests):
     """Tests for os.walk() with bytes."""
     def walk(self, top, **kwargs):
@@ -4352,6 +4367,87 @@ def test_fd(self):
         finally:
             os.close(fd)
 
+    def test_many_entries(self):
+        names = ['file%03d' % i for i in range(300)]
+        for name in names:
+            self.create_file(name)
+        for stat in False, True:
+            with os.scandir(self.path, stat=stat) as it:
+                entries = list(it)
+            self.assertEqual(sorted(entry.name for entry in entries), names)
+            self.assertEqual([entry.name for entry in entries],
+                             os.listdir(self.path))
+
+    def test_threads(self):
+        # An iterator shared by threads stays consistent: a thread calling
+        # next() while another one reads a batch gets RuntimeError, and
+        # close() during a read takes effect once the read is done.
+        names = ['file%03d' % i for i in range(1000)]
+        for name in names:
+            self.create_file(name)
+        for close in False, True:
+            with self.subTest(close=close):
+                found = []
+                iterator = os.scandir(self.path)
+
+                def read():
+                    while True:
+                        try:
+                            entry = next(iterator)
+                        except StopIteration:
+                            return
+                        except RuntimeError:
+                            continue
+                        found.append(entry.name)
+
+                threads = [threading.Thread(target=read) for i in range(4)]
+                with threading_helper.start_threads(threads):
+                    if close:
+                        iterator.close()
+                self.assertEqual(len(found), len(set(found)))
+                if close:
+                    self.assertLessEqual(set(found), set(names))
+                else:
+                    self.assertEqual(sorted(found), names)
+                self.assertEqual(list(iterator), [])
+
+    def test_stat_prefetch(self):
+        self.create_file('file.txt')
+        os.mkdir(os.path.join(self.path, 'dir'))
+        expected_names = ['dir', 'file.txt']
+        if os_helper.can_symlink():
+            os.symlink('file.txt', os.path.join(self.path, 'link'))
+            expected_names.append('link')
+        stats = {name: os.stat(os.path.join(self.path, name),
+                               follow_symlinks=False)
+                 for name in expected_names}
+
+        paths = [self.path, self.bytes_path]
+        if os.scandir in os.supports_fd:
+            fd = os.open(self.path, os.O_RDONLY)
+            self.addCleanup(os.close, fd)
+            paths.append(fd)
+        for path in paths:
+            with os.scandir(path, stat=True) as it:
+                entries = {os.fsdecode(entry.name): entry for entry in it}
+            self.assertEqual(sorted(entries), expected_names)
+            for name, entry in entries.items():
+                self.assert_stat_equal(entry.stat(follow_symlinks=False),
+                                       stats[name], False)
+                if name != 'link':
+                    self.assertIs(entry.stat(), entry.stat(follow_symlinks=False))
+                self.assertEqual(entry.is_dir(), name == 'dir')
+
+        if sys.platform != 'win32':
+            # The stat results were fetched with the entries.
+            with os.scandir(self.path, stat=True) as it:
+                entries = list(it)
+            os_helper.unlink(os.path.join(self.path, 'file.txt'))
+            for entry in entries:
+                if entry.name == 'file.txt':
+                    self.assert_stat_equal(entry.stat(), stats['file.txt'],
+                                           False)
+
     def test_empty_path(self):
         self.assertRaises(FileNotFoundError, os.scandir, '')
 
@@ -76,13 +76,15 @@ def test__all__(self):
             'read_unicodestring1', 'read_unicodestring4',
             'read_unicodestring8', 'read_decimalnl_short',
             'read_decimalnl_long', 'read_floatnl', 'read_float8',
-            'read_long1', 'read_long4',
+            'read_long1', 'read_long4', 'read_packedint64',
+            'read_packedfloat64', 'read_packedlatin1',
             'uint1', 'uint2', 'int4', 'uint4', 'uint8', 'stringnl',
             'stringnl_noescape', 'stringnl_noescape_pair', 'string1',
             'string4', 'bytes1', 'bytes4', 'bytes8', 'bytearray8',
             'unicodestringnl', 'unicodestring1', 'unicodestring4',
             'unicodestring8', 'decimalnl_short', 'decimalnl_long',
-            'floatnl', 'float8', 'long1', 'long4',
+            'floatnl', 'float8', 'long1', 'long4', 'packedint64',
+            'packedfloat64', 'packedlatin1',
             'StackObject',
             'pyint', 'pylong', 'pyinteger_or_bool', 'pybool', 'pyfloat',
             'pybytes_or_str', 'pystring', 'pybytes', 'pybytearray',
@@ -787,6 +787,59 @@ def test_copytree_subdirectory(self):
         rv = shutil.copytree(src_dir, dst_dir)
         self.assertEqual(['pol'], os.listdir(rv))
 
+    def test_copytree_workers(self):
+        src_dir = self.mkdtemp()
+        dst_dir = os.path.join(self.mkdtemp(), 'destination')
+        for i in range(5):
+            os.makedirs(os.path.join(src_dir, 'dir%d' % i, 'sub'))
+            for j in range(30):
+                write_file((src_dir, 'dir%d' % i, 'file%d' % j), str(i * j))
+                write_file((src_dir, 'dir%d' % i, 'sub', 'file%d' % j), '')
+        for root, dirs, files in os.walk(src_dir):
+            os.utime(root, ns=(10**18, 10**18))
+        os.chmod(os.path.join(src_dir, 'dir3'), 0o750)
+
+        rv = shutil.copytree(src_dir, dst_dir, workers=4)
+        self.assertEqual(rv, dst_dir)
+        src_walk = list(os.walk(src_dir))
+        dst_walk = list(os.walk(dst_dir))
+        self.assertEqual([x[1:] for x in src_walk], [x[1:] for x in dst_walk])
+        for (src_root, _, files), (dst_root, _, _) in zip(src_walk, dst_walk):
+            src_st = os.stat(src_root)
+            dst_st = os.stat(dst_root)
+            # Directory metadata is copied after the files.
+            self.assertEqual(src_st.st_mtime_ns, dst_st.st_mtime_ns)
+            self.assertEqual(src_st.st_mode, dst_st.st_mode)
+            for name in files:
+                self.assertEqual(read_file((src_root, name)),
+                                 read_file((dst_root, name)))
+
+        self.assertRaises(ValueError, shutil.copytree, src_dir, dst_dir,
+                          workers=0)
+
+    def test_copytree_workers_errors(self):
+        src_dir = self.mkdtemp()
+        dst_dir = os.path.join(self.mkdtemp(), 'destination')
+        os.mkdir(os.path.join(src_dir, 'dir'))
+        for name in 'a', 'b', 'c':
+            write_file((src_dir, name), name)
+            write_file((src_dir, 'dir', name), name)
+
+        def copy_function(src, dst):
+            if os.path.basename(src) == 'b':
+                raise OSError(errno.EIO, 'cannot copy', src)
+            return shutil.copy2(src, dst)
+
+        with self.assertRaises(Error) as cm:
+            shutil.copytree(src_dir, dst_dir, copy_function=copy_function,
+                            workers=2)
+        self.assertEqual(sorted(src for src, dst, why in cm.exception.args[0]),
+                         [os.path.join(src_dir, 'b'),
+                          os.path.join(src_dir, 'dir', 'b')])
+        self.assertEqual(sorted(os.listdir(dst_dir)), ['a', 'c', 'dir'])
+        self.assertEqual(sorted(os.listdir(os.path.join(dst_dir, 'dir'))),
+                         ['a', 'c'])
+
 class TestCopy(BaseTest, unittest.TestCase):
 
     ### shutil.copymode
@@ -2396,6 +2449,13 @@ def test_filesystem_full(self):
 class TestZeroCopySendfile(_ZeroCopyFileTest, unittest.TestCase):
     PATCHPOINT = "os.sendfile"
 
+    def setUp(self):
+        # copyfile() tries these first.
+        for name in '_USE_CP_FICLONE', '_USE_CP_COPY_FILE_RANGE':
+            patcher = unittest.mock.patch.object(shutil, name, False)
+            patcher.start()
+            self.addCleanup(patcher.stop)
+
     def zerocopy_fun(self, fsrc, fdst):
         return shutil._fastcopy_sendfile(fsrc, fdst)
 
@@ -2511,6 +2571,108 @@ def test_file2file_not_supported(self):
             shutil._USE_CP_SENDFILE = True
 
 
+@unittest.skipUnless(shutil._USE_CP_COPY_FILE_RANGE,
+                     'os.copy_file_range() not supported')
+class TestZeroCopyCopyFileRange(_ZeroCopyFileTest, unittest.TestCase):
+    PATCHPOINT = "os.copy_file_range"
+
+    def setUp(self):
+        # copyfile() tries a reflink first.
+        patcher = unittest.mock.patch.object(shutil, '_USE_CP_FICLONE', False)
+        patcher.start()
+        self.addCleanup(patcher.stop)
+
+    def zerocopy_fun(self, fsrc, fdst):
+        return shutil._fastcopy_copy_file_range(fsrc, fdst)
+
+    def test_empty_file(self):
+        # Nothing copied from the start could also be a file of a pseudo
+        # file system: leave it to the fallback.
+        srcname = TESTFN + 'src'
+        dstname = TESTFN + 'dst'
+        self.addCleanup(lambda: os_helper.unlink(srcname))
+        self.addCleanup(lambda: os_helper.unlink(dstname))
+        with open(srcname, "wb"):
+            pass
+
+        with open(srcname, "rb") as src:
+            with open(dstname, "wb") as dst:
+                self.assertRaises(_GiveupOnFastCopy, self.zerocopy_fun,
+                                  src, dst)
+        shutil.copyfile(srcname, dstname)
+        self.assertEqual(read_file(dstname, binary=True), b"")
+
+    def test_exception_on_second_call(self):
+        def copy_file_range(*args, **kwargs):
+            if not flag:
+                flag.append(None)
+                return orig_copy_file_range(*args, **kwargs)
+            else:
+                raise OSError(errno.EBADF, "yo")
+
+        flag = []
+        orig_copy_file_range = os.copy_file_range
+        # Copy in small blocks, so that there is a second call.
+        with unittest.mock.patch.object(shutil, '_fastcopy_blocksize',
+                                        return_value=65536):
+            with unittest.mock.patch('os.copy_file_range',
+                                     side_effect=copy_file_range):
+                with self.get_files() as (src, dst):
+                    with self.assertRaises(OSError) as cm:
+                        self.zerocopy_fun(src, dst)
+        assert flag
+        self.assertEqual(cm.exception.errno, errno.EBADF)
+
+    def test_not_implemented(self):
+        try:
+            with unittest.mock.patch(
+                    self.PATCHPOINT,
+                    side_effect=OSError(errno.ENOSYS, "yo")) as m:
+                with self.get_files() as (src, dst):
+                    with self.assertRaises(_GiveupOnFastCopy):
+                        self.zerocopy_fun(src, dst)
+                assert m.called
+            assert not shutil._USE_CP_COPY_FILE_RANGE
+
+            with unittest.mock.patch(self.PATCHPOINT) as m:
+                shutil.copyfile(TESTFN, TESTFN2)
+                assert not m.called
+            self.assertEqual(read_file(TESTFN2, binary=True), self.FILEDATA)
+        finally:
+            shutil._USE_CP_COPY_FILE_RANGE = True
+
+
+@unittest.skipUnless(shutil._USE_CP_FICLONE, 'FICLONE not supported')
+class TestZeroCopyFiclone(unittest.TestCase):
+
+    def setUp(self):
+        self.addCleanup(os_helper.unlink, TESTFN)
+        self.addCleanup(os_helper.unlink, TESTFN2)
+        write_test_file(TESTFN, 1024 * 1024)
+
+    def test_regular_copy(self):
+        with open(TESTFN, 'rb') as src, open(TESTFN2, 'wb') as dst:
+            try:
+                shutil._fastcopy_ficlone(src, dst)
+            except _GiveupOnFastCopy:
+                self.skipTest('reflinks not supported by the file system')
+        self.assertEqual(read_file(TESTFN2, binary=True),
+                         read_file(TESTFN, binary=True))
+
+    def test_not_supported(self):
+        # Reflinks are not supported across file systems, and by most file
+        # systems: copyfile() falls back to copying the data.
+        with unittest.mock.patch('fcntl.ioctl',
+                                 side_effect=OSError(errno.EXDEV, "yo")) as m:
+            with open(TESTFN, 'rb') as src, open(TESTFN2, 'wb') as dst:
+                self.assertRaises(_GiveupOnFastCopy,
+                                  shutil._fastcopy_ficlone, src, dst)
+            shutil.copyfile(TESTFN, TESTFN2)
+            assert m.called
+        self.assertEqual(read_file(TESTFN2, binary=True),
+                         read_file(TESTFN, binary=True))
+
+
 @unittest.skipIf(not MACOS, 'macOS only')
 class TestZeroCopyMACOS(_ZeroCopyFileTest, unittest.TestCase):
     PATCHPOINT = "posix._fcopyfile"
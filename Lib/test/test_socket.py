@@ -2511,6 +2511,26 @@ def _testSendAll(self):
         big_chunk = b'f' * 2048
         self.serv_conn.sendall(big_chunk)
 
+    def testSendAllBuffers(self):
+        # Testing sendall() with a list of buffers
+        msg = b''
+        while 1:
+            read = self.cli_conn.recv(65536)
+            if not read:
+                break
+            msg += read
+        self.assertEqual(msg, (b'ab' + b'c' * 3000 + b'd') * 2000)
+
+    def _testSendAllBuffers(self):
+        # More buffers than fit in one sendmsg() call, and more data than
+        # fits in the socket buffers.
+        buffers = [b'ab', memoryview(b'c' * 3000), b'', bytearray(b'd')]
+        self.serv_conn.sendall(buffers * 1000)
+        self.serv_conn.sendall(tuple(buffers) * 1000)
+        self.assertRaises(TypeError, self.serv_conn.sendall, [b'x', 'y'])
+        self.serv_conn.sendall([])
+        self.serv_conn.shutdown(socket.SHUT_WR)
+
     def testFromFd(self):
         # Testing fromfd()
         fd = self.cli_conn.fileno()
@@ -2638,6 +2658,76 @@ def testRecvFromNegative(self):
     def _testRecvFromNegative(self):
         self.cli.sendto(MSG, 0, (HOST, self.port))
 
+@unittest.skipUnless(hasattr(socket.socket, "recvmmsg_into") and
+                     hasattr(socket.socket, "sendmmsg"),
+                     'recvmmsg_into() and sendmmsg() required for this test.')
+class BatchedUDPTest(SocketUDPTest):
+    # Tests for recvmmsg_into() and sendmmsg().
+
+    def setUp(self):
+        super().setUp()
+        self.cli = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        self.cli.bind((HOST, 0))
+        self.addCleanup(self.cli.close)
+        self.serv.settimeout(support.LOOPBACK_TIMEOUT)
+
+    def testSendmmsgAddressed(self):
+        addr = (HOST, self.port)
+        msgs = [(b'a', addr), (bytearray(b'bb'), addr),
+                (memoryview(b'ccc'), addr)]
+        self.assertEqual(self.cli.sendmmsg(msgs), 3)
+        for expected in (b'a', b'bb', b'ccc'):
+            self.assertEqual(self.serv.recv(1024), expected)
+
+    def testSendmmsgConnected(self):
+        self.cli.connect((HOST, self.port))
+        self.assertEqual(self.cli.sendmmsg([b'a', b'bb']), 2)
+        self.assertEqual(self.serv.recv(1024), b'a')
+        self.assertEqual(self.serv.recv(1024), b'bb')
+
+    def testSendmmsgEmpty(self):
+        self.assertEqual(self.cli.sendmmsg([]), 0)
+
+    def testSendmmsgBadArgs(self):
+        self.assertRaises(TypeError, self.cli.sendmmsg)
+        self.assertRaises(TypeError, self.cli.sendmmsg, object())
+        self.assertRaises(TypeError, self.cli.sendmmsg, [1])
+        self.assertRaises(TypeError, self.cli.sendmmsg, [('a', HOST)])
+        self.assertRaises(TypeError, self.cli.sendmmsg,
+                          [(b'a', (HOST, self.port), 0)])
+
+    def testRecvmmsgInto(self):
+        addr = (HOST, self.port)
+        self.cli.sendmmsg([(b'abc', addr), (b'', addr), (b'defgh', addr)])
+        bufs = [bytearray(4) for _ in range(5)]
+        received = []
+        while len(received) < 3:
+            received += self.serv.recvmmsg_into(bufs[len(received):])
+        cli_addr = self.cli.getsockname()
+        self.assertEqual(received, [(3, cli_addr), (0, cli_addr),
+                                    (4, cli_addr)])
+        self.assertEqual(bufs[0][:3], b'abc')
+        # Datagrams longer than their buffer are truncated.
+        self.assertEqual(bufs[2], b'defg')
+
+    def testRecvmmsgIntoNonBlocking(self):
+        self.serv.setblocking(False)
+        self.assertRaises(BlockingIOError, self.serv.recvmmsg_into,
+                          [bytearray(16)])
+
+    def testRecvmmsgIntoTimeout(self):
+        self.serv.settimeout(0.01)
+        self.assertRaises(socket.timeout, self.serv.recvmmsg_into,
+                          [bytearray(16)])
+
+    def testRecvmmsgIntoEmpty(self):
+        self.assertEqual(self.serv.recvmmsg_into([]), [])
+
+    def testRecvmmsgIntoBadArgs(self):
+        self.assertRaises(TypeError, self.serv.recvmmsg_into)
+        self.assertRaises(TypeError, self.serv.recvmmsg_into, object())
+        self.assertRaises(TypeError, self.serv.recvmmsg_into, [b'readonly'])
+
 # Tests for the sendmsg()/recvmsg() interface.  Where possible, the
 # same test code is used with different families and types of socket
 # (e.g. stream, datagram), and tests using recvmsg() are repeated
@@ -6635,8 +6725,8 @@ def close_fds(fds):
 def test_main():
     tests = [GeneralModuleTests, BasicTCPTest, TCPCloserTest, TCPTimeoutTest,
              TestExceptions, BufferIOTest, BasicTCPTest2, BasicUDPTest,
-             UDPTimeoutTest, CreateServerTest, CreateServerFunctionalTest,
-             SendRecvFdsTests]
+             BatchedUDPTest, UDPTimeoutTest, CreateServerTest,
+             CreateServerFunctionalTest, SendRecvFdsTests]
 
     tests.extend([
         NonBlockingTCPTests,
@@ -856,5 +856,146 @@ def test_half_float(self):
             self.assertEqual(bits, struct.pack(formatcode, f))
 
 
+class ColumnsTest(unittest.TestCase):
+    """
+    Tests for column-wise packing and unpacking
+    (struct.Struct.unpack_columns and struct.Struct.pack_columns).
+    """
+
+    def records(self, fmt, n=40):
+        def value(code, i):
+            if code in 'bhilqn':
+                return (-1) ** i * i * 3
+            if code in 'BHILQNP':
+                return i * 5
+            if code in 'efd':
+                return i / 4
+            if code == '?':
+                return i % 3 == 0
+            if code == 'c':
+                return bytes([i + 65])
+            return b'abc'
+        codes = [c for c in fmt.lstrip('@=<>!')
+                 if not c.isdigit() and c != 'x']
+        return [tuple(value(c, i) for c in codes) for i in range(n)]
+
+    def check_roundtrip(self, fmt, n=40):
+        s = struct.Struct(fmt)
+        recs = self.records(fmt, n)
+        buf = b''.join(s.pack(*r) for r in recs)
+        columns = s.unpack_columns(buf)
+        self.assertIsInstance(columns, tuple)
+        self.assertEqual(len(columns), len(recs[0]))
+        self.assertEqual(list(zip(*[list(c) for c in columns])),
+                         list(s.iter_unpack(buf)))
+        self.assertEqual(s.pack_columns(columns), buf)
+        self.assertEqual(s.pack_columns([list(c) for c in columns]), buf)
+        self.assertEqual([list(c) for c in struct.unpack_columns(fmt, buf)],
+                         [list(c) for c in columns])
+        self.assertEqual(struct.pack_columns(fmt, columns), buf)
+        return columns
+
+    def test_integers(self):
+        for code, byteorder in iter_integer_formats():
+            with self.subTest(code=code, byteorder=byteorder):
+                fmt = byteorder + 'x' + code + 'b'
+                columns = self.check_roundtrip(fmt)
+                self.assertIsInstance(columns[0], memoryview)
+                self.assertEqual(columns[0].itemsize, struct.calcsize('=' + code)
+                                 if byteorder not in ('', '@')
+                                 else struct.calcsize(code))
+
+    def test_other_codes(self):
+        for byteorder in byteorders:
+            with self.subTest(byteorder=byteorder):
+                columns = self.check_roundtrip(byteorder + 'c?efd3s5p')
+                self.assertEqual([c.format for c in columns[:5]],
+                                 ['c', '?', 'f', 'f', 'd'])
+                self.assertEqual(columns[5][0], b'abc')
+                self.assertIsInstance(columns[5], list)
+                self.assertIsInstance(columns[6], list)
+        self.check_roundtrip('P')
+
+    def test_columns_are_writable(self):
+        s = struct.Struct('<iH')
+        columns = s.unpack_columns(s.pack(1, 2) * 3)
+        columns[0][1] = -7
+        self.assertEqual(s.pack_columns(columns),
+                         s.pack(1, 2) + s.pack(-7, 2) + s.pack(1, 2))
+
+    def test_bool_normalized(self):
+        s = struct.Struct('<?')
+        self.assertEqual(s.unpack_columns(b'\x00\x02\xff')[0].tolist(),
+                         [False, True, True])
+
+    def test_empty(self):
+        s = struct.Struct('>ih')
+        columns = s.unpack_columns(b'')
+        self.assertEqual([len(c) for c in columns], [0, 0])
+        self.assertEqual(s.pack_columns(columns), b'')
+        self.assertEqual(s.pack_columns([[], []]), b'')
+        self.assertEqual(struct.pack_columns('4x', []), b'')
+
+    def test_pack_from_arrays(self):
+        a = array.array('q', [1, -2, 3])
+        d = array.array('d', [0.5, 1.5, 2.5])
+        s = struct.Struct('>qf')
+        self.assertEqual(s.pack_columns([a, d]),
+                         b''.join(s.pack(x, y) for x, y in zip(a, d)))
+        # Not a matching native format: packed value by value
+        self.assertEqual(s.pack_columns([array.array('b', [1, -2, 3]), d]),
+                         b''.join(s.pack(x, y) for x, y in zip(a, d)))
+        self.assertEqual(s.pack_columns([memoryview(bytes(24)).cast('q'), d]),
+                         b''.join(s.pack(0, y) for y in d))
+        self.assertEqual(struct.pack_columns('B', [b'abc']), b'abc')
+        self.assertEqual(struct.pack_columns('2s', [[b'ab', b'cd']]), b'abcd')
+        # Non-contiguous buffer
+        self.assertEqual(struct.pack_columns('<q', [memoryview(a)[::2]]),
+                         struct.pack('<qq', 1, 3))
+
+    def test_pack_errors(self):
+        s = struct.Struct('<ih')
+        with self.assertRaises(struct.error):
+            s.pack_columns([[1, 2]])
+        with self.assertRaises(struct.error):
+            s.pack_columns([[1, 2], [1]])
+        with self.assertRaises(struct.error):
+            s.pack_columns([array.array('i', [1, 2]), [1]])
+        with self.assertRaises(struct.error):
+            s.pack_columns([[1, 2], [1, 2**20]])
+        with self.assertRaises(struct.error):
+            s.pack_columns([[1, 'x'], [1, 2]])
+        with self.assertRaises(TypeError):
+            s.pack_columns(42)
+        with self.assertRaises(TypeError):
+            s.pack_columns([42, [1]])
+        with self.assertRaises(OverflowError):
+            struct.pack_columns('<e', [array.array('d', [1e300])])
+        # Signedness must match to avoid silently wrapping values
+        self.assertRaises(struct.error, struct.pack_columns, 'I',
+                          [array.array('i', [-1])])
+
+    def test_pack_mutating_column(self):
+        # Converting a value must not be able to shrink the columns.
+        class Evil:
+            def __index__(self):
+                column.clear()
+                columns.clear()
+                return 1
+        column = [Evil()] + list(range(100))
+        columns = [column]
+        self.assertEqual(struct.pack_columns('<b', columns),
+                         bytes([1] + list(range(100))))
+
+    def test_unpack_errors(self):
+        s = struct.Struct('>ih')
+        with self.assertRaises(struct.error):
+            s.unpack_columns(b'12345')
+        with self.assertRaises(struct.error):
+            struct.Struct('>').unpack_columns(b'')
+        with self.assertRaises(TypeError):
+            s.unpack_columns([1, 2])
+
+
 if __name__ == '__main__':
     unittest.main()
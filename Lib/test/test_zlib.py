@@ -1,6 +1,7 @@
 import unittest
 from test import support
 from test.support import import_helper
+import array
 import binascii
 import copy
 import pickle
@@ -191,6 +192,35 @@ def test_incomplete_stream(self):
             "Error -5 while decompressing data: incomplete or truncated stream",
             zlib.decompress, x[:-1])
 
+    def test_deflate_parallel(self):
+        data = HAMLET_SCENE * 1000
+        for threads in (1, 2, 4):
+            for blocksize in (1000, 32768, 1 << 20):
+                with self.subTest(threads=threads, blocksize=blocksize):
+                    x = zlib.deflate_parallel(data, 6, threads=threads,
+                                              blocksize=blocksize)
+                    self.assertEqual(zlib.decompress(x, -zlib.MAX_WBITS), data)
+        self.assertEqual(zlib.decompress(zlib.deflate_parallel(b'', threads=2),
+                                         -zlib.MAX_WBITS), b'')
+
+    def test_deflate_parallel_chained(self):
+        # Consecutive calls form a single stream
+        data = HAMLET_SCENE * 1000
+        n = len(data) // 3
+        x = (zlib.deflate_parallel(data[:n], threads=2, finish=False) +
+             zlib.deflate_parallel(data[n:], threads=2, zdict=data[:n]))
+        self.assertEqual(zlib.decompress(x, -zlib.MAX_WBITS), data)
+        dco = zlib.decompressobj(-zlib.MAX_WBITS)
+        x = zlib.deflate_parallel(data, threads=2, finish=False)
+        self.assertEqual(dco.decompress(x), data)
+        self.assertFalse(dco.eof)
+
+    def test_deflate_parallel_errors(self):
+        self.assertRaises(zlib.error, zlib.deflate_parallel, b'', 10)
+        self.assertRaises(ValueError, zlib.deflate_parallel, b'', threads=0)
+        self.assertRaises(ValueError, zlib.deflate_parallel, b'', blocksize=0)
+        self.assertRaises(TypeError, zlib.deflate_parallel, b'', 1, 2)
+
     # Memory use of the following functions takes into account overallocation
 
     @bigmemtest(size=_1G + 1024 * 1024, memuse=3)
@@ -424,6 +454,37 @@ def test_maxlen_custom(self):
         dco = zlib.decompressobj()
         self.assertEqual(dco.decompress(compressed, CustomInt()), data[:100])
 
+    def test_decompress_into(self):
+        data = HAMLET_SCENE * 128
+        compressed = zlib.compress(data)
+        dco = zlib.decompressobj()
+        buf = bytearray(1000)
+        bufs = []
+        cb = compressed
+        while not dco.eof:
+            n = dco.decompress_into(cb, buf)
+            self.assertLessEqual(n, len(buf))
+            bufs.append(bytes(buf[:n]))
+            cb = dco.unconsumed_tail
+        self.assertEqual(b''.join(bufs), data)
+        self.assertEqual(dco.unconsumed_tail, b'')
+        self.assertEqual(dco.unused_data, b'')
+
+    def test_decompress_into_misc(self):
+        data = HAMLET_SCENE
+        compressed = zlib.compress(data)
+        dco = zlib.decompressobj()
+        # An empty buffer consumes no input
+        self.assertEqual(dco.decompress_into(compressed, bytearray()), 0)
+        self.assertEqual(dco.unconsumed_tail, compressed)
+        # Other writable buffers are accepted
+        buf = array.array('b', bytes(len(data) + 100))
+        n = dco.decompress_into(compressed, memoryview(buf)[50:])
+        self.assertEqual(n, len(data))
+        self.assertEqual(buf.tobytes()[50:50 + n], data)
+        self.assertTrue(dco.eof)
+        self.assertRaises(TypeError, dco.decompress_into, compressed, bytes(10))
+
     def test_clear_unconsumed_tail(self):
         # Issue #12050: calling decompress() without providing max_length
         # should clear the unconsumed_tail attribute.
@@ -1,5 +1,8 @@
 #include "Python.h"
+#include "pycore_call.h"          // _PyObject_Call_Prepend()
 #include "pycore_pyerrors.h"      // _PyErr_ClearExcState()
+#include "pycore_tuple.h"         // _PyTuple_ITEMS()
+#include "structmember.h"         // PyMemberDef
 #include <stddef.h>               // offsetof()
 
 
@@ -30,6 +33,8 @@ static PyObject *asyncio_task_print_stack_func;
 static PyObject *asyncio_task_repr_info_func;
 static PyObject *asyncio_InvalidStateError;
 static PyObject *asyncio_CancelledError;
+static PyObject *asyncio_extract_stack;
+static PyObject *asyncio_format_callback_source;
 static PyObject *context_kwname;
 static int module_initialized;
 
@@ -101,10 +106,36 @@ typedef struct {
 #endif
 } PyRunningLoopHolder;
 
+#define HandleObj_HEAD(prefix)                                              \
+    PyObject_HEAD                                                           \
+    PyObject *prefix##_callback;                                            \
+    PyObject *prefix##_args;                                                \
+    PyObject *prefix##_loop;                                                \
+    PyObject *prefix##_source_tb;                                           \
+    PyObject *prefix##_repr;                                                \
+    PyObject *prefix##_context;                                             \
+    PyObject *prefix##_weakreflist;                                         \
+    int prefix##_cancelled;
+
+typedef struct {
+    HandleObj_HEAD(h)
+} HandleObj;
+
+typedef struct {
+    HandleObj_HEAD(th)
+    PyObject *th_when;
+    /* heapq handle of the timer in loop._scheduled */
+    PyObject *th_heap_handle;
+    int th_scheduled;
+} TimerHandleObj;
+
 
 static PyTypeObject FutureType;
 static PyTypeObject TaskType;
 static PyTypeObject PyRunningLoopHolder_Type;
+static PyTypeObject HandleType;
+static PyTypeObject TimerHandleType;
+static PyTypeObject EventLoopCoreType;
 
 
 #define Future_CheckExact(obj) Py_IS_TYPE(obj, &FutureType)
@@ -113,6 +144,18 @@ static PyTypeObject PyRunningLoopHolder_Type;
 #define Future_Check(obj) PyObject_TypeCheck(obj, &FutureType)
 #define Task_Check(obj) PyObject_TypeCheck(obj, &TaskType)
 
+#define Handle_Check(obj) PyObject_TypeCheck(obj, &HandleType)
+#define TimerHandle_Check(obj) PyObject_TypeCheck(obj, &TimerHandleType)
+
+typedef struct {
+    PyObject_HEAD
+    PyObject *sb_data;      /* bytearray or NULL when empty */
+    Py_ssize_t sb_start;
+    Py_ssize_t sb_end;
+} StreamBufferObj;
+
+static PyTypeObject StreamBufferType;
+
 #include "clinic/_asynciomodule.c.h"
 
 
@@ -3012,191 +3055,2394 @@ task_wakeup(TaskObj *task, PyObject *o)
 }
 
 
-/*********************** Functions **************************/
-
+/*********************** Handle **************************/
 
 /*[clinic input]
-_asyncio._get_running_loop
+class _asyncio.Handle "HandleObj *" "&HandleType"
+class _asyncio.TimerHandle "TimerHandleObj *" "&TimerHandleType"
+[clinic start generated code]*/
+/*[clinic end generated code: output=da39a3ee5e6b4b0d input=6d21dd13050cb891]*/
 
-Return the running event loop or None.
 
-This is a low-level function intended to be used by event loops.
-This function is thread-specific.
+static int
+handle_ensure_alive(HandleObj *h)
+{
+    if (h->h_loop == NULL) {
+        PyErr_SetString(PyExc_RuntimeError,
+                        "Handle object is not initialized.");
+        return -1;
+    }
+    return 0;
+}
 
-[clinic start generated code]*/
 
-static PyObject *
-_asyncio__get_running_loop_impl(PyObject *module)
-/*[clinic end generated code: output=b4390af721411a0a input=0a21627e25a4bd43]*/
+static int
+loop_get_debug(PyObject *loop)
 {
-    PyObject *loop;
-    if (get_running_loop(&loop)) {
-        return NULL;
-    }
-    if (loop == NULL) {
-        /* There's no currently running event loop */
-        Py_RETURN_NONE;
+    _Py_IDENTIFIER(get_debug);
+
+    PyObject *res = _PyObject_CallMethodIdNoArgs(loop, &PyId_get_debug);
+    if (res == NULL) {
+        return -1;
     }
-    return loop;
+    int debug = PyObject_IsTrue(res);
+    Py_DECREF(res);
+    return debug;
 }
 
-/*[clinic input]
-_asyncio._set_running_loop
-    loop: 'O'
-    /
 
-Set the running event loop.
+/* Initialize a handle.  A negative debug asks loop.get_debug() whether
+   the creation traceback should be recorded. */
+static int
+handle_init(HandleObj *h, PyObject *callback, PyObject *args,
+            PyObject *loop, PyObject *context, int debug)
+{
+    if (context == Py_None) {
+        context = PyContext_CopyCurrent();
+        if (context == NULL) {
+            return -1;
+        }
+    }
+    else {
+        Py_INCREF(context);
+    }
+    Py_XSETREF(h->h_context, context);
 
-This is a low-level function intended to be used by event loops.
-This function is thread-specific.
-[clinic start generated code]*/
+    Py_INCREF(loop);
+    Py_XSETREF(h->h_loop, loop);
+    Py_INCREF(callback);
+    Py_XSETREF(h->h_callback, callback);
+    Py_INCREF(args);
+    Py_XSETREF(h->h_args, args);
+    h->h_cancelled = 0;
+    Py_CLEAR(h->h_repr);
+    Py_CLEAR(h->h_source_tb);
+
+    if (debug < 0) {
+        debug = loop_get_debug(loop);
+        if (debug < 0) {
+            return -1;
+        }
+    }
+    if (debug) {
+        /* There is no Python frame for this function: the current frame
+           is the one that created the handle. */
+        PyObject *frame = (PyObject *)PyEval_GetFrame();
+        h->h_source_tb = PyObject_CallOneArg(asyncio_extract_stack,
+                                             frame ? frame : Py_None);
+        if (h->h_source_tb == NULL) {
+            return -1;
+        }
+    }
+    return 0;
+}
 
-static PyObject *
-_asyncio__set_running_loop(PyObject *module, PyObject *loop)
-/*[clinic end generated code: output=ae56bf7a28ca189a input=4c9720233d606604]*/
+
+static int
+timerhandle_init(TimerHandleObj *th, PyObject *when, PyObject *callback,
+                 PyObject *args, PyObject *loop, PyObject *context, int debug)
 {
-    if (set_running_loop(loop)) {
-        return NULL;
+    if (when == Py_None) {
+        PyErr_SetString(PyExc_AssertionError, "when cannot be None");
+        return -1;
     }
-    Py_RETURN_NONE;
+    if (handle_init((HandleObj *)th, callback, args, loop,
+                    context, debug) < 0) {
+        return -1;
+    }
+    Py_INCREF(when);
+    Py_XSETREF(th->th_when, when);
+    Py_CLEAR(th->th_heap_handle);
+    th->th_scheduled = 0;
+    return 0;
 }
 
-/*[clinic input]
-_asyncio.get_event_loop
 
-Return an asyncio event loop.
+/*[clinic input]
+_asyncio.Handle.__init__
 
-When called from a coroutine or a callback (e.g. scheduled with
-call_soon or similar API), this function will always return the
-running event loop.
+    callback: object
+    args as cb_args: object
+    loop: object
+    context: object = None
 
-If there is no running event loop set, the function will return
-the result of `get_event_loop_policy().get_event_loop()` call.
+Object returned by callback registration methods.
 [clinic start generated code]*/
 
-static PyObject *
-_asyncio_get_event_loop_impl(PyObject *module)
-/*[clinic end generated code: output=2a2d8b2f824c648b input=9364bf2916c8655d]*/
+static int
+_asyncio_Handle___init___impl(HandleObj *self, PyObject *callback,
+                              PyObject *cb_args, PyObject *loop,
+                              PyObject *context)
+/*[clinic end generated code: output=70e458ccbb8b6db0 input=6d8e3748096c94d2]*/
 {
-    return get_event_loop();
+    return handle_init(self, callback, cb_args, loop, context, -1);
 }
 
+
 /*[clinic input]
-_asyncio.get_running_loop
+_asyncio.TimerHandle.__init__
 
-Return the running event loop.  Raise a RuntimeError if there is none.
+    when: object
+    callback: object
+    args as cb_args: object
+    loop: object
+    context: object = None
 
-This function is thread-specific.
+Object returned by timed callback registration methods.
 [clinic start generated code]*/
 
+static int
+_asyncio_TimerHandle___init___impl(TimerHandleObj *self, PyObject *when,
+                                   PyObject *callback, PyObject *cb_args,
+                                   PyObject *loop, PyObject *context)
+/*[clinic end generated code: output=ad3d93aa0e089493 input=5821ceb627f4808f]*/
+{
+    return timerhandle_init(self, when, callback, cb_args, loop,
+                            context, -1);
+}
+
+
 static PyObject *
-_asyncio_get_running_loop_impl(PyObject *module)
-/*[clinic end generated code: output=c247b5f9e529530e input=2a3bf02ba39f173d]*/
+handle_new(PyObject *callback, PyObject *args, PyObject *loop,
+           PyObject *context, int debug)
 {
-    PyObject *loop;
-    if (get_running_loop(&loop)) {
+    HandleObj *h = (HandleObj *)HandleType.tp_alloc(&HandleType, 0);
+    if (h == NULL) {
         return NULL;
     }
-    if (loop == NULL) {
-        /* There's no currently running event loop */
-        PyErr_SetString(
-            PyExc_RuntimeError, "no running event loop");
+    if (handle_init(h, callback, args, loop, context, debug) < 0) {
+        Py_DECREF(h);
+        return NULL;
     }
-    return loop;
+    return (PyObject *)h;
 }
 
-/*[clinic input]
-_asyncio._register_task
-
-    task: object
-
-Register a new task in asyncio as executed by loop.
-
-Returns None.
-[clinic start generated code]*/
 
 static PyObject *
-_asyncio__register_task_impl(PyObject *module, PyObject *task)
-/*[clinic end generated code: output=8672dadd69a7d4e2 input=21075aaea14dfbad]*/
+timerhandle_new(PyObject *when, PyObject *callback, PyObject *args,
+                PyObject *loop, PyObject *context, int debug)
 {
-    if (register_task(task) < 0) {
+    TimerHandleObj *th = (TimerHandleObj *)TimerHandleType.tp_alloc(
+        &TimerHandleType, 0);
+    if (th == NULL) {
         return NULL;
     }
-    Py_RETURN_NONE;
+    if (timerhandle_init(th, when, callback, args, loop,
+                         context, debug) < 0) {
+        Py_DECREF(th);
+        return NULL;
+    }
+    return (PyObject *)th;
 }
 
 
-/*[clinic input]
-_asyncio._unregister_task
-
-    task: object
+static int
+handle_cancel(HandleObj *h)
+{
+    if (h->h_cancelled) {
+        return 0;
+    }
+    h->h_cancelled = 1;
 
-Unregister a task.
+    int debug = loop_get_debug(h->h_loop);
+    if (debug < 0) {
+        return -1;
+    }
+    if (debug) {
+        /* Keep a representation in debug mode to keep callback and
+           parameters.  For example, to log the warning
+           "Executing <Handle...> took 2.5 second" */
+        PyObject *repr = PyObject_Repr((PyObject *)h);
+        if (repr == NULL) {
+            return -1;
+        }
+        Py_XSETREF(h->h_repr, repr);
+    }
+    Py_INCREF(Py_None);
+    Py_XSETREF(h->h_callback, Py_None);
+    Py_INCREF(Py_None);
+    Py_XSETREF(h->h_args, Py_None);
+    return 0;
+}
 
-Returns None.
-[clinic start generated code]*/
 
-static PyObject *
-_asyncio__unregister_task_impl(PyObject *module, PyObject *task)
-/*[clinic end generated code: output=6e5585706d568a46 input=28fb98c3975f7bdc]*/
+/* Report an exception raised by a callback to the loop's exception
+   handler, like the pure Python Handle._run() does.  SystemExit and
+   KeyboardInterrupt are left to propagate. */
+static int
+handle_report_exception(HandleObj *h)
 {
-    if (unregister_task(task) < 0) {
-        return NULL;
-    }
-    Py_RETURN_NONE;
-}
+    _Py_IDENTIFIER(call_exception_handler);
+    _Py_IDENTIFIER(message);
+    _Py_IDENTIFIER(exception);
+    _Py_IDENTIFIER(handle);
+    _Py_IDENTIFIER(source_traceback);
 
+    PyObject *et, *ev, *etb;
+    PyObject *saved_type, *saved_value, *saved_tb;
+    PyObject *cb = NULL;
+    PyObject *message = NULL;
+    PyObject *context = NULL;
+    PyObject *res = NULL;
 
-/*[clinic input]
-_asyncio._enter_task
+    if (PyErr_ExceptionMatches(PyExc_SystemExit) ||
+        PyErr_ExceptionMatches(PyExc_KeyboardInterrupt)) {
+        return -1;
+    }
 
-    loop: object
-    task: object
+    PyErr_Fetch(&et, &ev, &etb);
+    PyErr_NormalizeException(&et, &ev, &etb);
+    if (etb != NULL) {
+        PyException_SetTraceback(ev, etb);
+    }
 
-Enter into task execution or resume suspended task.
+    /* The exception handler runs as if it was called from an except
+       clause handling the exception. */
+    PyErr_GetExcInfo(&saved_type, &saved_value, &saved_tb);
+    Py_INCREF(et);
+    Py_INCREF(ev);
+    Py_XINCREF(etb);
+    PyErr_SetExcInfo(et, ev, etb);
 
-Task belongs to loop.
+    cb = PyObject_CallFunctionObjArgs(
+        asyncio_format_callback_source,
+        h->h_callback ? h->h_callback : Py_None,
+        h->h_args ? h->h_args : Py_None, NULL);
+    if (cb == NULL) {
+        goto finally;
+    }
+    message = PyUnicode_FromFormat("Exception in callback %S", cb);
+    if (message == NULL) {
+        goto finally;
+    }
+    context = PyDict_New();
+    if (context == NULL) {
+        goto finally;
+    }
+    if (_PyDict_SetItemId(context, &PyId_message, message) < 0 ||
+        _PyDict_SetItemId(context, &PyId_exception, ev) < 0 ||
+        _PyDict_SetItemId(context, &PyId_handle, (PyObject *)h) < 0) {
+        goto finally;
+    }
+    if (h->h_source_tb != NULL) {
+        int has_tb = PyObject_IsTrue(h->h_source_tb);
+        if (has_tb < 0) {
+            goto finally;
+        }
+        if (has_tb && _PyDict_SetItemId(context, &PyId_source_traceback,
+                                        h->h_source_tb) < 0) {
+            goto finally;
+        }
+    }
+    res = _PyObject_CallMethodIdOneArg(h->h_loop, &PyId_call_exception_handler,
+                                       context);
+
+finally:
+    PyErr_SetExcInfo(saved_type, saved_value, saved_tb);
+    Py_DECREF(et);
+    Py_DECREF(ev);
+    Py_XDECREF(etb);
+    Py_XDECREF(cb);
+    Py_XDECREF(message);
+    Py_XDECREF(context);
+    if (res == NULL) {
+        return -1;
+    }
+    Py_DECREF(res);
+    return 0;
+}
 
-Returns None.
-[clinic start generated code]*/
 
 static PyObject *
-_asyncio__enter_task_impl(PyObject *module, PyObject *loop, PyObject *task)
-/*[clinic end generated code: output=a22611c858035b73 input=de1b06dca70d8737]*/
+handle_call(PyObject *context, PyObject *callback, PyObject *args)
 {
-    if (enter_task(loop, task) < 0) {
-        return NULL;
+    _Py_IDENTIFIER(run);
+    PyObject *res;
+
+    if (!PyTuple_CheckExact(args)) {
+        args = PySequence_Tuple(args);
+        if (args == NULL) {
+            return NULL;
+        }
+    }
+    else {
+        Py_INCREF(args);
     }
-    Py_RETURN_NONE;
-}
 
+    if (PyContext_CheckExact(context)) {
+        if (PyContext_Enter(context) < 0) {
+            Py_DECREF(args);
+            return NULL;
+        }
+        res = PyObject_Vectorcall(callback, _PyTuple_ITEMS(args),
+                                  PyTuple_GET_SIZE(args), NULL);
+        if (PyContext_Exit(context) < 0) {
+            Py_CLEAR(res);
+        }
+    }
+    else {
+        /* context.run(callback, *args) */
+        PyObject *run = _PyObject_GetAttrId(context, &PyId_run);
+        if (run == NULL) {
+            Py_DECREF(args);
+            return NULL;
+        }
+        res = _PyObject_Call_Prepend(PyThreadState_GET(), run,
+                                     callback, args, NULL);
+        Py_DECREF(run);
+    }
+    Py_DECREF(args);
+    return res;
+}
 
-/*[clinic input]
-_asyncio._leave_task
 
-    loop: object
-    task: object
+/* Run the callback of a handle.  Return -1 with an exception set only
+   for exceptions which must propagate out of the event loop. */
+static int
+handle_run(HandleObj *h)
+{
+    if (handle_ensure_alive(h) < 0) {
+        return -1;
+    }
 
-Leave task execution or suspend a task.
+    /* The callback can cancel its own handle: hold strong references. */
+    PyObject *context = h->h_context;
+    PyObject *callback = h->h_callback ? h->h_callback : Py_None;
+    PyObject *args = h->h_args ? h->h_args : Py_None;
+    Py_INCREF(context);
+    Py_INCREF(callback);
+    Py_INCREF(args);
+    PyObject *res = handle_call(context, callback, args);
+    Py_DECREF(context);
+    Py_DECREF(callback);
+    Py_DECREF(args);
 
-Task belongs to loop.
+    if (res == NULL) {
+        return handle_report_exception(h);
+    }
+    Py_DECREF(res);
+    return 0;
+}
 
-Returns None.
-[clinic start generated code]*/
 
 static PyObject *
-_asyncio__leave_task_impl(PyObject *module, PyObject *loop, PyObject *task)
-/*[clinic end generated code: output=0ebf6db4b858fb41 input=51296a46313d1ad8]*/
+handle_repr_info(HandleObj *h)
 {
-    if (leave_task(loop, task) < 0) {
+    PyObject *item;
+    PyObject *info = PyList_New(0);
+    if (info == NULL) {
         return NULL;
     }
-    Py_RETURN_NONE;
-}
 
+    item = PyUnicode_FromString(_PyType_Name(Py_TYPE(h)));
+    if (item == NULL || PyList_Append(info, item) < 0) {
+        goto error;
+    }
+    Py_DECREF(item);
+
+    if (h->h_cancelled) {
+        item = PyUnicode_FromString("cancelled");
+        if (item == NULL || PyList_Append(info, item) < 0) {
+            goto error;
+        }
+        Py_DECREF(item);
+    }
+
+    if (h->h_callback != NULL && h->h_callback != Py_None) {
+        item = PyObject_CallFunctionObjArgs(
+            asyncio_format_callback_source, h->h_callback,
+            h->h_args ? h->h_args : Py_None, NULL);
+        if (item == NULL || PyList_Append(info, item) < 0) {
+            goto error;
+        }
+        Py_DECREF(item);
+    }
+
+    if (h->h_source_tb != NULL) {
+        int has_tb = PyObject_IsTrue(h->h_source_tb);
+        if (has_tb < 0) {
+            goto error_noitem;
+        }
+        if (has_tb) {
+            PyObject *frame, *filename = NULL, *lineno = NULL;
+
+            frame = PySequence_GetItem(h->h_source_tb, -1);
+            if (frame == NULL) {
+                goto error_noitem;
+            }
+            filename = PySequence_GetItem(frame, 0);
+            if (filename != NULL) {
+                lineno = PySequence_GetItem(frame, 1);
+            }
+            Py_DECREF(frame);
+            item = NULL;
+            if (lineno != NULL) {
+                item = PyUnicode_FromFormat("created at %S:%S",
+                                            filename, lineno);
+            }
+            Py_XDECREF(filename);
+            Py_XDECREF(lineno);
+            if (item == NULL || PyList_Append(info, item) < 0) {
+                goto error;
+            }
+            Py_DECREF(item);
+        }
+    }
+    return info;
+
+error:
+    Py_XDECREF(item);
+error_noitem:
+    Py_DECREF(info);
+    return NULL;
+}
+
+
+/*[clinic input]
+_asyncio.Handle.cancel
+
+Cancel the callback.
+
+If the callback has already been canceled or executed,
+this method has no effect.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio_Handle_cancel_impl(HandleObj *self)
+/*[clinic end generated code: output=ddb39234782aab82 input=6429249073d50dc7]*/
+{
+    if (handle_ensure_alive(self) < 0 || handle_cancel(self) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+
+/*[clinic input]
+_asyncio.Handle.cancelled
+
+Return True if the callback was cancelled.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio_Handle_cancelled_impl(HandleObj *self)
+/*[clinic end generated code: output=0f4ad57f569e9f24 input=95c3f2f4a4c1b9d7]*/
+{
+    return PyBool_FromLong(self->h_cancelled);
+}
+
+
+/*[clinic input]
+_asyncio.Handle._run
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio_Handle__run_impl(HandleObj *self)
+/*[clinic end generated code: output=1b186b710881500a input=94fc71ae0ddc7106]*/
+{
+    if (handle_run(self) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+
+/*[clinic input]
+_asyncio.Handle._repr_info
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio_Handle__repr_info_impl(HandleObj *self)
+/*[clinic end generated code: output=7838b12075048d03 input=dba1c0a083077d57]*/
+{
+    return handle_repr_info(self);
+}
+
+
+static PyObject *
+HandleObj_repr(HandleObj *h)
+{
+    _Py_IDENTIFIER(_repr_info);
+
+    if (h->h_repr != NULL && h->h_repr != Py_None) {
+        Py_INCREF(h->h_repr);
+        return h->h_repr;
+    }
+
+    PyObject *rinfo = _PyObject_CallMethodIdNoArgs((PyObject *)h,
+                                                   &PyId__repr_info);
+    if (rinfo == NULL) {
+        return NULL;
+    }
+
+    PyObject *sep = PyUnicode_FromString(" ");
+    if (sep == NULL) {
+        Py_DECREF(rinfo);
+        return NULL;
+    }
+    PyObject *rinfo_s = PyUnicode_Join(sep, rinfo);
+    Py_DECREF(sep);
+    Py_DECREF(rinfo);
+    if (rinfo_s == NULL) {
+        return NULL;
+    }
+
+    PyObject *rstr = PyUnicode_FromFormat("<%U>", rinfo_s);
+    Py_DECREF(rinfo_s);
+    return rstr;
+}
+
+
+static PyObject *
+HandleObj_get_cancelled(HandleObj *h, void *Py_UNUSED(ignored))
+{
+    return PyBool_FromLong(h->h_cancelled);
+}
+
+static int
+HandleObj_set_cancelled(HandleObj *h, PyObject *val, void *Py_UNUSED(ignored))
+{
+    if (val == NULL) {
+        PyErr_SetString(PyExc_AttributeError, "cannot delete attribute");
+        return -1;
+    }
+    int is_true = PyObject_IsTrue(val);
+    if (is_true < 0) {
+        return -1;
+    }
+    h->h_cancelled = is_true;
+    return 0;
+}
+
+
+static int
+HandleObj_traverse(HandleObj *h, visitproc visit, void *arg)
+{
+    Py_VISIT(h->h_callback);
+    Py_VISIT(h->h_args);
+    Py_VISIT(h->h_loop);
+    Py_VISIT(h->h_source_tb);
+    Py_VISIT(h->h_repr);
+    Py_VISIT(h->h_context);
+    return 0;
+}
+
+static int
+HandleObj_clear(HandleObj *h)
+{
+    Py_CLEAR(h->h_callback);
+    Py_CLEAR(h->h_args);
+    Py_CLEAR(h->h_loop);
+    Py_CLEAR(h->h_source_tb);
+    Py_CLEAR(h->h_repr);
+    Py_CLEAR(h->h_context);
+    return 0;
+}
+
+static void
+HandleObj_dealloc(HandleObj *h)
+{
+    PyObject_GC_UnTrack(h);
+    if (h->h_weakreflist != NULL) {
+        PyObject_ClearWeakRefs((PyObject *)h);
+    }
+    (void)HandleObj_clear(h);
+    Py_TYPE(h)->tp_free(h);
+}
+
+
+static PyMethodDef HandleType_methods[] = {
+    _ASYNCIO_HANDLE_CANCEL_METHODDEF
+    _ASYNCIO_HANDLE_CANCELLED_METHODDEF
+    _ASYNCIO_HANDLE__RUN_METHODDEF
+    _ASYNCIO_HANDLE__REPR_INFO_METHODDEF
+    {NULL, NULL}        /* Sentinel */
+};
+
+static PyMemberDef HandleType_members[] = {
+    {"_callback", T_OBJECT, offsetof(HandleObj, h_callback), 0},
+    {"_args", T_OBJECT, offsetof(HandleObj, h_args), 0},
+    {"_loop", T_OBJECT, offsetof(HandleObj, h_loop), 0},
+    {"_source_traceback", T_OBJECT, offsetof(HandleObj, h_source_tb), 0},
+    {"_repr", T_OBJECT, offsetof(HandleObj, h_repr), 0},
+    {"_context", T_OBJECT, offsetof(HandleObj, h_context), 0},
+    {NULL}  /* Sentinel */
+};
+
+static PyGetSetDef HandleType_getsetlist[] = {
+    {"_cancelled", (getter)HandleObj_get_cancelled,
+                   (setter)HandleObj_set_cancelled, NULL},
+    {NULL} /* Sentinel */
+};
+
+static PyTypeObject HandleType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "_asyncio.Handle",
+    sizeof(HandleObj),                       /* tp_basicsize */
+    .tp_dealloc = (destructor)HandleObj_dealloc,
+    .tp_repr = (reprfunc)HandleObj_repr,
+    .tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC | Py_TPFLAGS_BASETYPE,
+    .tp_doc = _asyncio_Handle___init____doc__,
+    .tp_traverse = (traverseproc)HandleObj_traverse,
+    .tp_clear = (inquiry)HandleObj_clear,
+    .tp_weaklistoffset = offsetof(HandleObj, h_weakreflist),
+    .tp_methods = HandleType_methods,
+    .tp_members = HandleType_members,
+    .tp_getset = HandleType_getsetlist,
+    .tp_init = (initproc)_asyncio_Handle___init__,
+    .tp_new = PyType_GenericNew,
+};
+
+
+/* ----- TimerHandle */
+
+/*[clinic input]
+_asyncio.TimerHandle.cancel
+
+Cancel the callback.
+
+If the callback has already been canceled or executed,
+this method has no effect.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio_TimerHandle_cancel_impl(TimerHandleObj *self)
+/*[clinic end generated code: output=315df6426e6662ff input=591e1744affb32b8]*/
+{
+    _Py_IDENTIFIER(_timer_handle_cancelled);
+
+    if (handle_ensure_alive((HandleObj *)self) < 0) {
+        return NULL;
+    }
+    if (!self->th_cancelled) {
+        PyObject *res = _PyObject_CallMethodIdOneArg(
+            self->th_loop, &PyId__timer_handle_cancelled, (PyObject *)self);
+        if (res == NULL) {
+            return NULL;
+        }
+        Py_DECREF(res);
+    }
+    if (handle_cancel((HandleObj *)self) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+
+/*[clinic input]
+_asyncio.TimerHandle.when
+
+Return a scheduled callback time.
+
+The time is an absolute timestamp, using the same time
+reference as loop.time().
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio_TimerHandle_when_impl(TimerHandleObj *self)
+/*[clinic end generated code: output=cab0e5577e51b3af input=de801fd191075931]*/
+{
+    PyObject *when = self->th_when ? self->th_when : Py_None;
+    Py_INCREF(when);
+    return when;
+}
+
+
+/*[clinic input]
+_asyncio.TimerHandle._repr_info
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio_TimerHandle__repr_info_impl(TimerHandleObj *self)
+/*[clinic end generated code: output=40e332eea82788b7 input=0ea1c37005c8bd50]*/
+{
+    PyObject *info = handle_repr_info((HandleObj *)self);
+    if (info == NULL) {
+        return NULL;
+    }
+    PyObject *when = PyUnicode_FromFormat(
+        "when=%S", self->th_when ? self->th_when : Py_None);
+    if (when == NULL) {
+        Py_DECREF(info);
+        return NULL;
+    }
+    Py_ssize_t pos = self->th_cancelled ? 2 : 1;
+    int res = PyList_Insert(info, pos, when);
+    Py_DECREF(when);
+    if (res < 0) {
+        Py_DECREF(info);
+        return NULL;
+    }
+    return info;
+}
+
+
+static int
+timerhandle_eq(TimerHandleObj *a, TimerHandleObj *b)
+{
+    int res;
+
+    if (a->th_cancelled != b->th_cancelled) {
+        return 0;
+    }
+    res = PyObject_RichCompareBool(a->th_when, b->th_when, Py_EQ);
+    if (res <= 0) {
+        return res;
+    }
+    res = PyObject_RichCompareBool(a->th_callback ? a->th_callback : Py_None,
+                                   b->th_callback ? b->th_callback : Py_None,
+                                   Py_EQ);
+    if (res <= 0) {
+        return res;
+    }
+    return PyObject_RichCompareBool(a->th_args ? a->th_args : Py_None,
+                                    b->th_args ? b->th_args : Py_None,
+                                    Py_EQ);
+}
+
+static PyObject *
+TimerHandleObj_richcompare(TimerHandleObj *self, PyObject *other, int op)
+{
+    TimerHandleObj *o = (TimerHandleObj *)other;
+    int res;
+
+    if (!TimerHandle_Check(other) ||
+        self->th_when == NULL || o->th_when == NULL) {
+        Py_RETURN_NOTIMPLEMENTED;
+    }
+
+    switch (op) {
+    case Py_LT:
+    case Py_GT:
+        return PyObject_RichCompare(self->th_when, o->th_when, op);
+    case Py_LE:
+    case Py_GE:
+        res = PyObject_RichCompareBool(self->th_when, o->th_when,
+                                       op == Py_LE ? Py_LT : Py_GT);
+        if (res == 0) {
+            res = timerhandle_eq(self, o);
+        }
+        break;
+    case Py_EQ:
+        res = timerhandle_eq(self, o);
+        break;
+    case Py_NE:
+        res = timerhandle_eq(self, o);
+        if (res >= 0) {
+            res = !res;
+        }
+        break;
+    default:
+        Py_RETURN_NOTIMPLEMENTED;
+    }
+    if (res < 0) {
+        return NULL;
+    }
+    return PyBool_FromLong(res);
+}
+
+static Py_hash_t
+TimerHandleObj_hash(TimerHandleObj *th)
+{
+    return PyObject_Hash(th->th_when ? th->th_when : Py_None);
+}
+
+
+static PyObject *
+TimerHandleObj_get_scheduled(TimerHandleObj *th, void *Py_UNUSED(ignored))
+{
+    return PyBool_FromLong(th->th_scheduled);
+}
+
+static int
+TimerHandleObj_set_scheduled(TimerHandleObj *th, PyObject *val,
+                             void *Py_UNUSED(ignored))
+{
+    if (val == NULL) {
+        PyErr_SetString(PyExc_AttributeError, "cannot delete attribute");
+        return -1;
+    }
+    int is_true = PyObject_IsTrue(val);
+    if (is_true < 0) {
+        return -1;
+    }
+    th->th_scheduled = is_true;
+    return 0;
+}
+
+
+static int
+TimerHandleObj_traverse(TimerHandleObj *th, visitproc visit, void *arg)
+{
+    Py_VISIT(th->th_when);
+    Py_VISIT(th->th_heap_handle);
+    return HandleObj_traverse((HandleObj *)th, visit, arg);
+}
+
+static int
+TimerHandleObj_clear(TimerHandleObj *th)
+{
+    Py_CLEAR(th->th_when);
+    Py_CLEAR(th->th_heap_handle);
+    return HandleObj_clear((HandleObj *)th);
+}
+
+static void
+TimerHandleObj_dealloc(TimerHandleObj *th)
+{
+    PyObject_GC_UnTrack(th);
+    if (th->th_weakreflist != NULL) {
+        PyObject_ClearWeakRefs((PyObject *)th);
+    }
+    (void)TimerHandleObj_clear(th);
+    Py_TYPE(th)->tp_free(th);
+}
+
+
+static PyMethodDef TimerHandleType_methods[] = {
+    _ASYNCIO_TIMERHANDLE_CANCEL_METHODDEF
+    _ASYNCIO_TIMERHANDLE_WHEN_METHODDEF
+    _ASYNCIO_TIMERHANDLE__REPR_INFO_METHODDEF
+    {NULL, NULL}        /* Sentinel */
+};
+
+static PyMemberDef TimerHandleType_members[] = {
+    {"_when", T_OBJECT, offsetof(TimerHandleObj, th_when), 0},
+    {"_heap_handle", T_OBJECT, offsetof(TimerHandleObj, th_heap_handle), 0},
+    {NULL}  /* Sentinel */
+};
+
+static PyGetSetDef TimerHandleType_getsetlist[] = {
+    {"_scheduled", (getter)TimerHandleObj_get_scheduled,
+                   (setter)TimerHandleObj_set_scheduled, NULL},
+    {NULL} /* Sentinel */
+};
+
+static PyTypeObject TimerHandleType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "_asyncio.TimerHandle",
+    sizeof(TimerHandleObj),                  /* tp_basicsize */
+    .tp_base = &HandleType,
+    .tp_dealloc = (destructor)TimerHandleObj_dealloc,
+    .tp_hash = (hashfunc)TimerHandleObj_hash,
+    .tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC | Py_TPFLAGS_BASETYPE,
+    .tp_doc = _asyncio_TimerHandle___init____doc__,
+    .tp_traverse = (traverseproc)TimerHandleObj_traverse,
+    .tp_clear = (inquiry)TimerHandleObj_clear,
+    .tp_richcompare = (richcmpfunc)TimerHandleObj_richcompare,
+    .tp_weaklistoffset = offsetof(TimerHandleObj, th_weakreflist),
+    .tp_methods = TimerHandleType_methods,
+    .tp_members = TimerHandleType_members,
+    .tp_getset = TimerHandleType_getsetlist,
+    .tp_init = (initproc)_asyncio_TimerHandle___init__,
+    .tp_new = PyType_GenericNew,
+};
+
+
+/*********************** Event loop core **************************/
+
+/* The scheduling methods of BaseEventLoop: call_soon(), call_at(),
+   call_later() and _run_once().  The state stays in the instance
+   dictionary of the Python subclass: the ready queue is the
+   collections.deque in loop._ready and the timers are kept in the
+   heapq.Heap in loop._scheduled. */
+
+/*[clinic input]
+class _asyncio._EventLoopCore "PyObject *" "&EventLoopCoreType"
+[clinic start generated code]*/
+/*[clinic end generated code: output=da39a3ee5e6b4b0d input=6cecdf9c2b29cbd9]*/
+
+/* Keep in sync with base_events.MAXIMUM_SELECT_TIMEOUT */
+#define MAXIMUM_SELECT_TIMEOUT (24 * 3600)
+
+_Py_IDENTIFIER(_ready);
+_Py_IDENTIFIER(_scheduled);
+_Py_IDENTIFIER(append);
+
+/* call_at implementation of _EventLoopCore, to detect overrides */
+static PyObject *loop_core_call_at;
+
+
+static int
+loop_get_flag(PyObject *loop, _Py_Identifier *name)
+{
+    PyObject *value = _PyObject_GetAttrId(loop, name);
+    if (value == NULL) {
+        return -1;
+    }
+    int res = PyObject_IsTrue(value);
+    Py_DECREF(value);
+    return res;
+}
+
+
+/* Check that the loop is open and run the debug mode checks.
+   Return the debug flag, or -1 on error. */
+static int
+loop_check_call(PyObject *loop, PyObject *callback, const char *method)
+{
+    _Py_IDENTIFIER(_closed);
+    _Py_IDENTIFIER(_debug);
+    _Py_IDENTIFIER(_check_thread);
+    _Py_IDENTIFIER(_check_callback);
+
+    int closed = loop_get_flag(loop, &PyId__closed);
+    if (closed < 0) {
+        return -1;
+    }
+    if (closed) {
+        PyErr_SetString(PyExc_RuntimeError, "Event loop is closed");
+        return -1;
+    }
+
+    int debug = loop_get_flag(loop, &PyId__debug);
+    if (debug <= 0) {
+        return debug;
+    }
+
+    PyObject *res = _PyObject_CallMethodIdNoArgs(loop, &PyId__check_thread);
+    if (res == NULL) {
+        return -1;
+    }
+    Py_DECREF(res);
+
+    PyObject *name = PyUnicode_FromString(method);
+    if (name == NULL) {
+        return -1;
+    }
+    res = _PyObject_CallMethodIdObjArgs(loop, &PyId__check_callback,
+                                        callback, name, NULL);
+    Py_DECREF(name);
+    if (res == NULL) {
+        return -1;
+    }
+    Py_DECREF(res);
+    return 1;
+}
+
+
+/* Parse the "(positional..., *args, context=None)" signature shared by
+   call_soon(), call_at() and call_later(). */
+static int
+parse_callback_args(const char *fname, Py_ssize_t npos,
+                    PyObject *const *args, Py_ssize_t nargs,
+                    PyObject *kwnames, PyObject **context)
+{
+    *context = Py_None;
+    if (nargs < npos) {
+        PyErr_Format(PyExc_TypeError,
+                     "%s() takes at least %zd positional argument%s "
+                     "(%zd given)",
+                     fname, npos, npos == 1 ? "" : "s", nargs);
+        return -1;
+    }
+    if (kwnames != NULL) {
+        for (Py_ssize_t i = 0; i < PyTuple_GET_SIZE(kwnames); i++) {
+            PyObject *name = PyTuple_GET_ITEM(kwnames, i);
+            if (!_PyUnicode_EqualToASCIIString(name, "context")) {
+                PyErr_Format(PyExc_TypeError,
+                             "%s() got an unexpected keyword argument '%S'",
+                             fname, name);
+                return -1;
+            }
+            *context = args[nargs + i];
+        }
+    }
+    return 0;
+}
+
+
+static PyObject *
+tuple_from_array(PyObject *const *src, Py_ssize_t n)
+{
+    PyObject *tuple = PyTuple_New(n);
+    if (tuple == NULL) {
+        return NULL;
+    }
+    for (Py_ssize_t i = 0; i < n; i++) {
+        Py_INCREF(src[i]);
+        PyTuple_SET_ITEM(tuple, i, src[i]);
+    }
+    return tuple;
+}
+
+
+static PyObject *
+loop_call_soon(PyObject *loop, PyObject *callback, PyObject *args,
+               PyObject *context, int debug)
+{
+    PyObject *handle = handle_new(callback, args, loop, context, debug);
+    if (handle == NULL) {
+        return NULL;
+    }
+
+    PyObject *ready = _PyObject_GetAttrId(loop, &PyId__ready);
+    if (ready == NULL) {
+        Py_DECREF(handle);
+        return NULL;
+    }
+    PyObject *res = _PyObject_CallMethodIdOneArg(ready, &PyId_append, handle);
+    Py_DECREF(ready);
+    if (res == NULL) {
+        Py_DECREF(handle);
+        return NULL;
+    }
+    Py_DECREF(res);
+    return handle;
+}
+
+
+static PyObject *
+loop_call_at(PyObject *loop, PyObject *when, PyObject *callback,
+             PyObject *args, PyObject *context, int debug)
+{
+    _Py_IDENTIFIER(push);
+
+    PyObject *timer = timerhandle_new(when, callback, args, loop,
+                                      context, debug);
+    if (timer == NULL) {
+        return NULL;
+    }
+
+    PyObject *scheduled = _PyObject_GetAttrId(loop, &PyId__scheduled);
+    if (scheduled == NULL) {
+        Py_DECREF(timer);
+        return NULL;
+    }
+    PyObject *heap_handle = _PyObject_CallMethodIdOneArg(scheduled,
+                                                         &PyId_push, timer);
+    Py_DECREF(scheduled);
+    if (heap_handle == NULL) {
+        Py_DECREF(timer);
+        return NULL;
+    }
+    TimerHandleObj *th = (TimerHandleObj *)timer;
+    Py_XSETREF(th->th_heap_handle, heap_handle);
+    th->th_scheduled = 1;
+    return timer;
+}
+
+
+static PyObject *
+EventLoopCore_call_soon(PyObject *self, PyObject *const *args,
+                        Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *context;
+
+    if (parse_callback_args("call_soon", 1, args, nargs,
+                            kwnames, &context) < 0) {
+        return NULL;
+    }
+    int debug = loop_check_call(self, args[0], "call_soon");
+    if (debug < 0) {
+        return NULL;
+    }
+    PyObject *cb_args = tuple_from_array(args + 1, nargs - 1);
+    if (cb_args == NULL) {
+        return NULL;
+    }
+    PyObject *handle = loop_call_soon(self, args[0], cb_args, context, debug);
+    Py_DECREF(cb_args);
+    return handle;
+}
+
+PyDoc_STRVAR(EventLoopCore_call_soon__doc__,
+"call_soon($self, callback, /, *args, context=None)\n"
+"--\n"
+"\n"
+"Arrange for a callback to be called as soon as possible.\n"
+"\n"
+"This operates as a FIFO queue: callbacks are called in the\n"
+"order in which they are registered.  Each callback will be\n"
+"called exactly once.\n"
+"\n"
+"Any positional arguments after the callback will be passed to\n"
+"the callback when it is called.");
+
+
+static PyObject *
+EventLoopCore_call_at(PyObject *self, PyObject *const *args,
+                      Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *context;
+
+    if (parse_callback_args("call_at", 2, args, nargs,
+                            kwnames, &context) < 0) {
+        return NULL;
+    }
+    int debug = loop_check_call(self, args[1], "call_at");
+    if (debug < 0) {
+        return NULL;
+    }
+    PyObject *cb_args = tuple_from_array(args + 2, nargs - 2);
+    if (cb_args == NULL) {
+        return NULL;
+    }
+    PyObject *timer = loop_call_at(self, args[0], args[1], cb_args,
+                                   context, debug);
+    Py_DECREF(cb_args);
+    return timer;
+}
+
+PyDoc_STRVAR(EventLoopCore_call_at__doc__,
+"call_at($self, when, callback, /, *args, context=None)\n"
+"--\n"
+"\n"
+"Like call_later(), but uses an absolute time.\n"
+"\n"
+"Absolute time corresponds to the event loop's time() method.");
+
+
+static PyObject *
+EventLoopCore_call_later(PyObject *self, PyObject *const *args,
+                         Py_ssize_t nargs, PyObject *kwnames)
+{
+    _Py_IDENTIFIER(call_at);
+    _Py_IDENTIFIER(time);
+    _Py_IDENTIFIER(_source_traceback);
+
+    PyObject *context;
+    PyObject *meth = NULL;
+    PyObject *timer;
+
+    if (parse_callback_args("call_later", 2, args, nargs,
+                            kwnames, &context) < 0) {
+        return NULL;
+    }
+
+    PyObject *now = _PyObject_CallMethodIdNoArgs(self, &PyId_time);
+    if (now == NULL) {
+        return NULL;
+    }
+    PyObject *when = PyNumber_Add(now, args[0]);
+    Py_DECREF(now);
+    if (when == NULL) {
+        return NULL;
+    }
+
+    PyObject *name = _PyUnicode_FromId(&PyId_call_at);  // borrowed
+    if (name == NULL) {
+        Py_DECREF(when);
+        return NULL;
+    }
+    int unbound = _PyObject_GetMethod(self, name, &meth);
+    if (meth == NULL) {
+        Py_DECREF(when);
+        return NULL;
+    }
+
+    if (unbound && meth == loop_core_call_at) {
+        /* Fast path: call_at() is not overridden */
+        Py_DECREF(meth);
+        int debug = loop_check_call(self, args[1], "call_at");
+        if (debug < 0) {
+            Py_DECREF(when);
+            return NULL;
+        }
+        PyObject *cb_args = tuple_from_array(args + 2, nargs - 2);
+        if (cb_args == NULL) {
+            Py_DECREF(when);
+            return NULL;
+        }
+        timer = loop_call_at(self, when, args[1], cb_args, context, debug);
+        Py_DECREF(cb_args);
+        Py_DECREF(when);
+        return timer;
+    }
+
+    /* self.call_at(when, callback, *args, context=context) */
+    PyObject *call_args = PyTuple_New(nargs);
+    if (call_args == NULL) {
+        Py_DECREF(meth);
+        Py_DECREF(when);
+        return NULL;
+    }
+    PyTuple_SET_ITEM(call_args, 0, when);  // steals
+    for (Py_ssize_t i = 1; i < nargs; i++) {
+        Py_INCREF(args[i]);
+        PyTuple_SET_ITEM(call_args, i, args[i]);
+    }
+    PyObject *kwargs = PyDict_New();
+    if (kwargs == NULL || PyDict_SetItemString(kwargs, "context",
+                                               context) < 0) {
+        Py_XDECREF(kwargs);
+        Py_DECREF(call_args);
+        Py_DECREF(meth);
+        return NULL;
+    }
+    if (unbound) {
+        timer = _PyObject_Call_Prepend(PyThreadState_GET(), meth, self,
+                                       call_args, kwargs);
+    }
+    else {
+        timer = PyObject_Call(meth, call_args, kwargs);
+    }
+    Py_DECREF(kwargs);
+    Py_DECREF(call_args);
+    Py_DECREF(meth);
+    if (timer == NULL) {
+        return NULL;
+    }
+
+    /* Drop the frame of the overriding call_at() */
+    PyObject *tb = _PyObject_GetAttrId(timer, &PyId__source_traceback);
+    if (tb == NULL) {
+        Py_DECREF(timer);
+        return NULL;
+    }
+    int has_tb = PyObject_IsTrue(tb);
+    if (has_tb > 0) {
+        has_tb = PySequence_DelItem(tb, -1);
+    }
+    Py_DECREF(tb);
+    if (has_tb < 0) {
+        Py_DECREF(timer);
+        return NULL;
+    }
+    return timer;
+}
+
+PyDoc_STRVAR(EventLoopCore_call_later__doc__,
+"call_later($self, delay, callback, /, *args, context=None)\n"
+"--\n"
+"\n"
+"Arrange for a callback to be called at a given time.\n"
+"\n"
+"Return a Handle: an opaque object with a cancel() method that\n"
+"can be used to cancel the call.\n"
+"\n"
+"The delay can be an int or float, expressed in seconds.  It is\n"
+"always relative to the current time.\n"
+"\n"
+"Each callback will be called exactly once.  If two callbacks\n"
+"are scheduled for exactly the same time, it undefined which\n"
+"will be called first.\n"
+"\n"
+"Any positional arguments after the callback will be passed to\n"
+"the callback when it is called.");
+
+
+/*[clinic input]
+_asyncio._EventLoopCore._call_soon
+
+    callback: object
+    args as cb_args: object
+    context: object
+    /
+
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__EventLoopCore__call_soon_impl(PyObject *self, PyObject *callback,
+                                        PyObject *cb_args, PyObject *context)
+/*[clinic end generated code: output=a6e42023ff489dcd input=ac9299611bb3ed2b]*/
+{
+    _Py_IDENTIFIER(_debug);
+
+    int debug = loop_get_flag(self, &PyId__debug);
+    if (debug < 0) {
+        return NULL;
+    }
+    return loop_call_soon(self, callback, cb_args, context, debug);
+}
+
+
+static int
+handle_is_cancelled(PyObject *handle)
+{
+    _Py_IDENTIFIER(_cancelled);
+
+    if (Handle_Check(handle)) {
+        return ((HandleObj *)handle)->h_cancelled;
+    }
+    return loop_get_flag(handle, &PyId__cancelled);
+}
+
+
+/*[clinic input]
+_asyncio._EventLoopCore._add_callback
+
+    handle: object
+    /
+
+Add a Handle to _ready.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__EventLoopCore__add_callback(PyObject *self, PyObject *handle)
+/*[clinic end generated code: output=9cdc13e718ede35e input=e57ed4e92914085f]*/
+{
+    int cancelled = handle_is_cancelled(handle);
+    if (cancelled < 0) {
+        return NULL;
+    }
+    if (!cancelled) {
+        PyObject *ready = _PyObject_GetAttrId(self, &PyId__ready);
+        if (ready == NULL) {
+            return NULL;
+        }
+        PyObject *res = _PyObject_CallMethodIdOneArg(ready, &PyId_append,
+                                                     handle);
+        Py_DECREF(ready);
+        if (res == NULL) {
+            return NULL;
+        }
+        Py_DECREF(res);
+    }
+    Py_RETURN_NONE;
+}
+
+
+/* Forget that timer is scheduled and return its heapq handle (or None). */
+static PyObject *
+timer_unschedule(PyObject *timer)
+{
+    _Py_IDENTIFIER(_heap_handle);
+
+    if (TimerHandle_Check(timer)) {
+        TimerHandleObj *th = (TimerHandleObj *)timer;
+        PyObject *heap_handle = th->th_heap_handle;
+        th->th_heap_handle = NULL;
+        th->th_scheduled = 0;
+        if (heap_handle == NULL) {
+            Py_RETURN_NONE;
+        }
+        return heap_handle;
+    }
+
+    PyObject *heap_handle = _PyObject_GetAttrId(timer, &PyId__heap_handle);
+    if (heap_handle == NULL) {
+        return NULL;
+    }
+    if (_PyObject_SetAttrId(timer, &PyId__heap_handle, Py_None) < 0 ||
+        _PyObject_SetAttrId(timer, &PyId__scheduled, Py_False) < 0) {
+        Py_DECREF(heap_handle);
+        return NULL;
+    }
+    return heap_handle;
+}
+
+
+/*[clinic input]
+_asyncio._EventLoopCore._timer_handle_cancelled
+
+    handle: object
+    /
+
+Notification that a TimerHandle has been cancelled.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__EventLoopCore__timer_handle_cancelled(PyObject *self,
+                                                PyObject *handle)
+/*[clinic end generated code: output=763d6092eb490232 input=340ca54c40a7beb6]*/
+{
+    _Py_IDENTIFIER(remove);
+
+    int scheduled;
+    if (TimerHandle_Check(handle)) {
+        scheduled = ((TimerHandleObj *)handle)->th_scheduled;
+    }
+    else {
+        scheduled = loop_get_flag(handle, &PyId__scheduled);
+        if (scheduled < 0) {
+            return NULL;
+        }
+    }
+    if (!scheduled) {
+        Py_RETURN_NONE;
+    }
+
+    PyObject *heap_handle = timer_unschedule(handle);
+    if (heap_handle == NULL) {
+        return NULL;
+    }
+    if (heap_handle == Py_None) {
+        Py_DECREF(heap_handle);
+        Py_RETURN_NONE;
+    }
+    PyObject *heap = _PyObject_GetAttrId(self, &PyId__scheduled);
+    if (heap == NULL) {
+        Py_DECREF(heap_handle);
+        return NULL;
+    }
+    PyObject *res = _PyObject_CallMethodIdOneArg(heap, &PyId_remove,
+                                                 heap_handle);
+    Py_DECREF(heap);
+    Py_DECREF(heap_handle);
+    if (res == NULL) {
+        return NULL;
+    }
+    Py_DECREF(res);
+    Py_RETURN_NONE;
+}
+
+
+static PyObject *
+timer_get_when(PyObject *timer)
+{
+    _Py_IDENTIFIER(_when);
+
+    if (TimerHandle_Check(timer)) {
+        PyObject *when = ((TimerHandleObj *)timer)->th_when;
+        if (when != NULL) {
+            Py_INCREF(when);
+            return when;
+        }
+    }
+    return _PyObject_GetAttrId(timer, &PyId__when);
+}
+
+
+/* Return 1 if a < b, 0 if not and -1 on error */
+static inline int
+number_lt(PyObject *a, PyObject *b)
+{
+    if (PyFloat_CheckExact(a) && PyFloat_CheckExact(b)) {
+        return PyFloat_AS_DOUBLE(a) < PyFloat_AS_DOUBLE(b);
+    }
+    return PyObject_RichCompareBool(a, b, Py_LT);
+}
+
+
+/* Compute the select() timeout: min(max(0, when - now), MAX) */
+static PyObject *
+loop_timer_timeout(PyObject *loop, PyObject *when)
+{
+    _Py_IDENTIFIER(time);
+
+    PyObject *now = _PyObject_CallMethodIdNoArgs(loop, &PyId_time);
+    if (now == NULL) {
+        return NULL;
+    }
+    PyObject *timeout = PyNumber_Subtract(when, now);
+    Py_DECREF(now);
+    if (timeout == NULL) {
+        return NULL;
+    }
+
+    PyObject *zero = PyLong_FromLong(0);
+    if (zero == NULL) {
+        Py_DECREF(timeout);
+        return NULL;
+    }
+    int lt = number_lt(zero, timeout);
+    if (lt <= 0) {
+        Py_DECREF(timeout);
+        if (lt < 0) {
+            Py_DECREF(zero);
+            return NULL;
+        }
+        return zero;
+    }
+    Py_DECREF(zero);
+
+    PyObject *maximum = PyLong_FromLong(MAXIMUM_SELECT_TIMEOUT);
+    if (maximum == NULL) {
+        Py_DECREF(timeout);
+        return NULL;
+    }
+    lt = number_lt(maximum, timeout);
+    if (lt != 0) {
+        Py_DECREF(timeout);
+        if (lt < 0) {
+            Py_DECREF(maximum);
+            return NULL;
+        }
+        return maximum;
+    }
+    Py_DECREF(maximum);
+    return timeout;
+}
+
+
+/* Pop the timers which are due from the heap into the ready queue.
+   Cancelled timers at the head of the heap are dropped. */
+static int
+loop_pop_timers(PyObject *loop, PyObject *ready, PyObject *scheduled,
+                PyObject *end_time)
+{
+    _Py_IDENTIFIER(peek);
+    _Py_IDENTIFIER(pop);
+
+    for (;;) {
+        Py_ssize_t size = PyObject_Size(scheduled);
+        if (size <= 0) {
+            return (int)size;
+        }
+        PyObject *timer = _PyObject_CallMethodIdNoArgs(scheduled, &PyId_peek);
+        if (timer == NULL) {
+            return -1;
+        }
+
+        int cancelled = handle_is_cancelled(timer);
+        if (cancelled < 0) {
+            Py_DECREF(timer);
+            return -1;
+        }
+        if (!cancelled) {
+            if (end_time == NULL) {
+                Py_DECREF(timer);
+                return 0;
+            }
+            PyObject *when = timer_get_when(timer);
+            if (when == NULL) {
+                Py_DECREF(timer);
+                return -1;
+            }
+            int due = number_lt(when, end_time);
+            Py_DECREF(when);
+            if (due <= 0) {
+                Py_DECREF(timer);
+                return due;
+            }
+        }
+
+        PyObject *res = _PyObject_CallMethodIdNoArgs(scheduled, &PyId_pop);
+        if (res == NULL) {
+            Py_DECREF(timer);
+            return -1;
+        }
+        Py_DECREF(res);
+        res = timer_unschedule(timer);
+        if (res == NULL) {
+            Py_DECREF(timer);
+            return -1;
+        }
+        Py_DECREF(res);
+        if (!cancelled) {
+            res = _PyObject_CallMethodIdOneArg(ready, &PyId_append, timer);
+            if (res == NULL) {
+                Py_DECREF(timer);
+                return -1;
+            }
+            Py_DECREF(res);
+        }
+        Py_DECREF(timer);
+    }
+}
+
+
+static int
+loop_run_ready(PyObject *loop, PyObject *ready)
+{
+    _Py_IDENTIFIER(popleft);
+    _Py_IDENTIFIER(_debug);
+    _Py_IDENTIFIER(_run);
+    _Py_IDENTIFIER(_run_handle_debug);
+
+    /* Run the callbacks which are ready now, but not the ones they
+       schedule: those run on the next iteration, after polling for I/O. */
+    Py_ssize_t ntodo = PyObject_Size(ready);
+    if (ntodo < 0) {
+        return -1;
+    }
+    for (Py_ssize_t i = 0; i < ntodo; i++) {
+        PyObject *handle = _PyObject_CallMethodIdNoArgs(ready, &PyId_popleft);
+        if (handle == NULL) {
+            return -1;
+        }
+        int cancelled = handle_is_cancelled(handle);
+        if (cancelled) {
+            Py_DECREF(handle);
+            if (cancelled < 0) {
+                return -1;
+            }
+            continue;
+        }
+
+        int debug = loop_get_flag(loop, &PyId__debug);
+        int err;
+        if (debug) {
+            if (debug < 0) {
+                Py_DECREF(handle);
+                return -1;
+            }
+            PyObject *res = _PyObject_CallMethodIdOneArg(
+                loop, &PyId__run_handle_debug, handle);
+            err = res == NULL ? -1 : 0;
+            Py_XDECREF(res);
+        }
+        else if (Py_IS_TYPE(handle, &HandleType) ||
+                 Py_IS_TYPE(handle, &TimerHandleType)) {
+            err = handle_run((HandleObj *)handle);
+        }
+        else {
+            PyObject *res = _PyObject_CallMethodIdNoArgs(handle, &PyId__run);
+            err = res == NULL ? -1 : 0;
+            Py_XDECREF(res);
+        }
+        Py_DECREF(handle);
+        if (err < 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+
+/*[clinic input]
+_asyncio._EventLoopCore._run_once
+
+Run one full iteration of the event loop.
+
+This calls all currently ready callbacks, polls for I/O,
+schedules the resulting callbacks, and finally schedules
+'call_later' callbacks.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__EventLoopCore__run_once_impl(PyObject *self)
+/*[clinic end generated code: output=c4a8c1911cd46f57 input=4747b227d818b141]*/
+{
+    _Py_IDENTIFIER(_stopping);
+    _Py_IDENTIFIER(_selector);
+    _Py_IDENTIFIER(select);
+    _Py_IDENTIFIER(_process_events);
+    _Py_IDENTIFIER(time);
+    _Py_IDENTIFIER(_clock_resolution);
+    _Py_IDENTIFIER(peek);
+
+    PyObject *ready = NULL;
+    PyObject *scheduled = NULL;
+    PyObject *timeout = NULL;
+    PyObject *res = NULL;
+    PyObject *end_time = NULL;
+    PyObject *result = NULL;
+
+    ready = _PyObject_GetAttrId(self, &PyId__ready);
+    if (ready == NULL) {
+        goto finally;
+    }
+    scheduled = _PyObject_GetAttrId(self, &PyId__scheduled);
+    if (scheduled == NULL) {
+        goto finally;
+    }
+
+    /* Drop timers cancelled without notifying the loop */
+    if (loop_pop_timers(self, ready, scheduled, NULL) < 0) {
+        goto finally;
+    }
+
+    Py_ssize_t nready = PyObject_Size(ready);
+    if (nready < 0) {
+        goto finally;
+    }
+    int stopping = nready ? 1 : loop_get_flag(self, &PyId__stopping);
+    if (stopping < 0) {
+        goto finally;
+    }
+    Py_ssize_t nscheduled = PyObject_Size(scheduled);
+    if (nscheduled < 0) {
+        goto finally;
+    }
+    if (stopping) {
+        timeout = PyLong_FromLong(0);
+    }
+    else if (nscheduled) {
+        /* Compute the desired timeout. */
+        PyObject *timer = _PyObject_CallMethodIdNoArgs(scheduled, &PyId_peek);
+        if (timer == NULL) {
+            goto finally;
+        }
+        PyObject *when = timer_get_when(timer);
+        Py_DECREF(timer);
+        if (when == NULL) {
+            goto finally;
+        }
+        timeout = loop_timer_timeout(self, when);
+        Py_DECREF(when);
+    }
+    else {
+        Py_INCREF(Py_None);
+        timeout = Py_None;
+    }
+    if (timeout == NULL) {
+        goto finally;
+    }
+
+    PyObject *selector = _PyObject_GetAttrId(self, &PyId__selector);
+    if (selector == NULL) {
+        goto finally;
+    }
+    PyObject *event_list = _PyObject_CallMethodIdOneArg(selector, &PyId_select,
+                                                        timeout);
+    Py_DECREF(selector);
+    if (event_list == NULL) {
+        goto finally;
+    }
+    res = _PyObject_CallMethodIdOneArg(self, &PyId__process_events,
+                                       event_list);
+    Py_DECREF(event_list);
+    if (res == NULL) {
+        goto finally;
+    }
+    Py_CLEAR(res);
+
+    /* Handle 'later' callbacks that are ready. */
+    PyObject *now = _PyObject_CallMethodIdNoArgs(self, &PyId_time);
+    if (now == NULL) {
+        goto finally;
+    }
+    PyObject *resolution = _PyObject_GetAttrId(self, &PyId__clock_resolution);
+    if (resolution == NULL) {
+        Py_DECREF(now);
+        goto finally;
+    }
+    end_time = PyNumber_Add(now, resolution);
+    Py_DECREF(now);
+    Py_DECREF(resolution);
+    if (end_time == NULL) {
+        goto finally;
+    }
+    if (loop_pop_timers(self, ready, scheduled, end_time) < 0) {
+        goto finally;
+    }
+
+    /* This is the only place where callbacks are actually *called*.
+       All other places just add them to ready. */
+    if (loop_run_ready(self, ready) < 0) {
+        goto finally;
+    }
+
+    Py_INCREF(Py_None);
+    result = Py_None;
+
+finally:
+    Py_XDECREF(ready);
+    Py_XDECREF(scheduled);
+    Py_XDECREF(timeout);
+    Py_XDECREF(end_time);
+    return result;
+}
+
+
+static PyMethodDef EventLoopCoreType_methods[] = {
+    {"call_soon", (PyCFunction)(void(*)(void))EventLoopCore_call_soon,
+     METH_FASTCALL|METH_KEYWORDS, EventLoopCore_call_soon__doc__},
+    {"call_at", (PyCFunction)(void(*)(void))EventLoopCore_call_at,
+     METH_FASTCALL|METH_KEYWORDS, EventLoopCore_call_at__doc__},
+    {"call_later", (PyCFunction)(void(*)(void))EventLoopCore_call_later,
+     METH_FASTCALL|METH_KEYWORDS, EventLoopCore_call_later__doc__},
+    _ASYNCIO__EVENTLOOPCORE__CALL_SOON_METHODDEF
+    _ASYNCIO__EVENTLOOPCORE__ADD_CALLBACK_METHODDEF
+    _ASYNCIO__EVENTLOOPCORE__TIMER_HANDLE_CANCELLED_METHODDEF
+    _ASYNCIO__EVENTLOOPCORE__RUN_ONCE_METHODDEF
+    {NULL, NULL}        /* Sentinel */
+};
+
+PyDoc_STRVAR(EventLoopCore_doc,
+"Scheduling core of asyncio.BaseEventLoop.");
+
+static PyTypeObject EventLoopCoreType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "_asyncio._EventLoopCore",
+    sizeof(PyObject),                        /* tp_basicsize */
+    .tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+    .tp_doc = EventLoopCore_doc,
+    .tp_methods = EventLoopCoreType_methods,
+    .tp_new = PyType_GenericNew,
+};
+
+
+/*********************** StreamBuffer **************************/
+
+/* Receive buffer of asyncio.StreamReader.  The unread data is
+   sb_data[sb_start:sb_end] and the rest of the bytearray is free space
+   handed out by get_buffer().  Consuming data only moves sb_start. */
+
+/*[clinic input]
+class _asyncio._StreamBuffer "StreamBufferObj *" "&StreamBufferType"
+[clinic start generated code]*/
+/*[clinic end generated code: output=da39a3ee5e6b4b0d input=acd9bfae5f32d45e]*/
+
+#define SB_CAPACITY(sb) \
+    ((sb)->sb_data != NULL ? PyByteArray_GET_SIZE((sb)->sb_data) : 0)
+#define SB_DATA(sb) (PyByteArray_AS_STRING((sb)->sb_data) + (sb)->sb_start)
+#define SB_LENGTH(sb) ((sb)->sb_end - (sb)->sb_start)
+
+
+/* Make room for at least size bytes after the unread data. */
+static int
+streambuffer_reserve(StreamBufferObj *sb, Py_ssize_t size)
+{
+    Py_ssize_t capacity = SB_CAPACITY(sb);
+    Py_ssize_t unread = SB_LENGTH(sb);
+    Py_ssize_t newsize;
+
+    if (capacity - sb->sb_end >= size) {
+        return 0;
+    }
+    /* Leave unread + size bytes free: the next move only happens once
+       at least as many bytes as were moved have been received. */
+    if (unread > (PY_SSIZE_T_MAX - size) / 2) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    newsize = 2 * unread + size;
+
+    if (sb->sb_data != NULL &&
+        ((PyByteArrayObject *)sb->sb_data)->ob_exports == 0)
+    {
+        char *data = PyByteArray_AS_STRING(sb->sb_data);
+        if (sb->sb_start) {
+            memmove(data, data + sb->sb_start, unread);
+            sb->sb_start = 0;
+            sb->sb_end = unread;
+        }
+        if (capacity >= newsize) {
+            return 0;
+        }
+        return PyByteArray_Resize(sb->sb_data, newsize);
+    }
+
+    /* A memoryview returned by get_buffer() is still alive: the
+       bytearray cannot be modified, use a new one. */
+    PyObject *data = PyByteArray_FromStringAndSize(NULL, newsize);
+    if (data == NULL) {
+        return -1;
+    }
+    if (unread) {
+        memcpy(PyByteArray_AS_STRING(data), SB_DATA(sb), unread);
+    }
+    Py_XSETREF(sb->sb_data, data);
+    sb->sb_start = 0;
+    sb->sb_end = unread;
+    return 0;
+}
+
+
+static void
+streambuffer_consumed(StreamBufferObj *sb, Py_ssize_t n)
+{
+    sb->sb_start += n;
+    if (sb->sb_start == sb->sb_end) {
+        /* Release the storage so idle streams hold no memory */
+        Py_CLEAR(sb->sb_data);
+        sb->sb_start = sb->sb_end = 0;
+    }
+}
+
+
+/* Return the offset of the first occurrence of sep in s, or -1. */
+static Py_ssize_t
+streambuffer_search(const char *s, Py_ssize_t n,
+                    const char *sep, Py_ssize_t m)
+{
+    if (m == 0) {
+        return 0;
+    }
+    if (m > n) {
+        return -1;
+    }
+    const char *p = s;
+    const char *last = s + n - m;
+    while (p <= last) {
+        p = memchr(p, (unsigned char)sep[0], last - p + 1);
+        if (p == NULL) {
+            return -1;
+        }
+        if (memcmp(p + 1, sep + 1, m - 1) == 0) {
+            return p - s;
+        }
+        p++;
+    }
+    return -1;
+}
+
+
+/*[clinic input]
+_asyncio._StreamBuffer.extend
+
+    data: Py_buffer
+    /
+
+Append data to the buffer.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__StreamBuffer_extend_impl(StreamBufferObj *self, Py_buffer *data)
+/*[clinic end generated code: output=e60d8ec03a60a719 input=5cef92c7b4b9a09f]*/
+{
+    if (streambuffer_reserve(self, data->len) < 0) {
+        return NULL;
+    }
+    if (data->len) {
+        memcpy(PyByteArray_AS_STRING(self->sb_data) + self->sb_end,
+               data->buf, data->len);
+        self->sb_end += data->len;
+    }
+    Py_RETURN_NONE;
+}
+
+
+/*[clinic input]
+_asyncio._StreamBuffer.get_buffer
+
+    sizehint: Py_ssize_t
+    /
+
+Return a writable memoryview of the free space.
+
+It is at least sizehint bytes long.  buffer_updated() must be
+called with the number of bytes written to it.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__StreamBuffer_get_buffer_impl(StreamBufferObj *self,
+                                       Py_ssize_t sizehint)
+/*[clinic end generated code: output=9567b70c1b22311e input=082e8e7276eb31ab]*/
+{
+    if (streambuffer_reserve(self, Py_MAX(sizehint, 1)) < 0) {
+        return NULL;
+    }
+    PyObject *view = PyMemoryView_FromObject(self->sb_data);
+    if (view == NULL) {
+        return NULL;
+    }
+    PyObject *tail = PySequence_GetSlice(view, self->sb_end,
+                                         PY_SSIZE_T_MAX);
+    Py_DECREF(view);
+    return tail;
+}
+
+
+/*[clinic input]
+_asyncio._StreamBuffer.buffer_updated
+
+    nbytes: Py_ssize_t
+    /
+
+Add nbytes bytes written to the last get_buffer() view.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__StreamBuffer_buffer_updated_impl(StreamBufferObj *self,
+                                           Py_ssize_t nbytes)
+/*[clinic end generated code: output=a92007dd332a3c54 input=534f12d30a5983ca]*/
+{
+    if (nbytes < 0 || nbytes > SB_CAPACITY(self) - self->sb_end) {
+        PyErr_SetString(PyExc_ValueError, "nbytes out of range");
+        return NULL;
+    }
+    self->sb_end += nbytes;
+    Py_RETURN_NONE;
+}
+
+
+/*[clinic input]
+_asyncio._StreamBuffer.take
+
+    n: Py_ssize_t
+    /
+
+Remove up to n bytes from the front of the buffer and return them.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__StreamBuffer_take_impl(StreamBufferObj *self, Py_ssize_t n)
+/*[clinic end generated code: output=79cf2a61ca9d1a80 input=43af778bfe705329]*/
+{
+    n = Py_MAX(0, Py_MIN(n, SB_LENGTH(self)));
+    if (n == 0) {
+        return PyBytes_FromStringAndSize(NULL, 0);
+    }
+    PyObject *chunk = PyBytes_FromStringAndSize(SB_DATA(self), n);
+    if (chunk != NULL) {
+        streambuffer_consumed(self, n);
+    }
+    return chunk;
+}
+
+
+/*[clinic input]
+_asyncio._StreamBuffer.discard
+
+    n: Py_ssize_t
+    /
+
+Remove up to n bytes from the front of the buffer.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__StreamBuffer_discard_impl(StreamBufferObj *self, Py_ssize_t n)
+/*[clinic end generated code: output=3fa951f9828b2984 input=3f1fa0c9c18c5376]*/
+{
+    streambuffer_consumed(self, Py_MAX(0, Py_MIN(n, SB_LENGTH(self))));
+    Py_RETURN_NONE;
+}
+
+
+/*[clinic input]
+_asyncio._StreamBuffer.clear
+
+Remove all data from the buffer.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__StreamBuffer_clear_impl(StreamBufferObj *self)
+/*[clinic end generated code: output=68085c7b245593a0 input=648ea598f239415d]*/
+{
+    streambuffer_consumed(self, SB_LENGTH(self));
+    Py_RETURN_NONE;
+}
+
+
+/*[clinic input]
+_asyncio._StreamBuffer.startswith
+
+    prefix: Py_buffer
+    offset: Py_ssize_t = 0
+    /
+
+Return True if the data at offset starts with prefix.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__StreamBuffer_startswith_impl(StreamBufferObj *self,
+                                       Py_buffer *prefix, Py_ssize_t offset)
+/*[clinic end generated code: output=884b053a694f3c3c input=79680fe23c0c0b5a]*/
+{
+    Py_ssize_t len = SB_LENGTH(self);
+    offset = Py_MAX(0, Py_MIN(offset, len));
+    if (prefix->len > len - offset) {
+        Py_RETURN_FALSE;
+    }
+    if (prefix->len == 0) {
+        Py_RETURN_TRUE;
+    }
+    return PyBool_FromLong(
+        memcmp(SB_DATA(self) + offset, prefix->buf, prefix->len) == 0);
+}
+
+
+/*[clinic input]
+_asyncio._StreamBuffer.find
+
+    separators: object
+    offset: Py_ssize_t = 0
+    /
+
+Find the match of separators which ends first.
+
+separators is a sequence of non-empty bytes objects sorted by
+length.  Return the (start, end) offsets of the match, or (-1, -1).
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__StreamBuffer_find_impl(StreamBufferObj *self, PyObject *separators,
+                                 Py_ssize_t offset)
+/*[clinic end generated code: output=ece2bb17182eb69e input=93b747777ffce42a]*/
+{
+    Py_ssize_t len = SB_LENGTH(self);
+    Py_ssize_t match_start = -1, match_end = -1;
+    /* A later separator must end before `end` to win */
+    Py_ssize_t end = len;
+
+    offset = Py_MAX(0, Py_MIN(offset, len));
+
+    PyObject *seq = PySequence_Fast(separators,
+                                    "separators must be a sequence");
+    if (seq == NULL) {
+        return NULL;
+    }
+    for (Py_ssize_t i = 0; i < PySequence_Fast_GET_SIZE(seq); i++) {
+        Py_buffer sep;
+        if (PyObject_GetBuffer(PySequence_Fast_GET_ITEM(seq, i), &sep,
+                               PyBUF_SIMPLE) < 0) {
+            Py_DECREF(seq);
+            return NULL;
+        }
+        if (sep.len == 0) {
+            PyErr_SetString(PyExc_ValueError, "empty separator");
+            PyBuffer_Release(&sep);
+            Py_DECREF(seq);
+            return NULL;
+        }
+        if (end - offset >= sep.len) {
+            Py_ssize_t pos = streambuffer_search(
+                SB_DATA(self) + offset, end - offset, sep.buf, sep.len);
+            if (pos >= 0) {
+                match_start = offset + pos;
+                match_end = match_start + sep.len;
+                end = match_end - 1;
+            }
+        }
+        PyBuffer_Release(&sep);
+    }
+    Py_DECREF(seq);
+    return Py_BuildValue("(nn)", match_start, match_end);
+}
+
+
+static Py_ssize_t
+StreamBufferObj_length(StreamBufferObj *sb)
+{
+    return SB_LENGTH(sb);
+}
+
+
+static PyObject *
+StreamBufferObj_richcompare(StreamBufferObj *self, PyObject *other, int op)
+{
+    Py_buffer view;
+    int equal;
+
+    if ((op != Py_EQ && op != Py_NE) || !PyObject_CheckBuffer(other)) {
+        Py_RETURN_NOTIMPLEMENTED;
+    }
+    if (PyObject_GetBuffer(other, &view, PyBUF_SIMPLE) < 0) {
+        return NULL;
+    }
+    equal = view.len == SB_LENGTH(self) &&
+            (view.len == 0 || memcmp(SB_DATA(self), view.buf, view.len) == 0);
+    PyBuffer_Release(&view);
+    return PyBool_FromLong(op == Py_EQ ? equal : !equal);
+}
+
+
+static PyObject *
+StreamBufferObj_repr(StreamBufferObj *sb)
+{
+    PyObject *data = PyBytes_FromStringAndSize(
+        SB_LENGTH(sb) ? SB_DATA(sb) : NULL, SB_LENGTH(sb));
+    if (data == NULL) {
+        return NULL;
+    }
+    PyObject *res = PyUnicode_FromFormat("<_StreamBuffer %R>", data);
+    Py_DECREF(data);
+    return res;
+}
+
+
+static void
+StreamBufferObj_dealloc(StreamBufferObj *sb)
+{
+    Py_XDECREF(sb->sb_data);
+    Py_TYPE(sb)->tp_free(sb);
+}
+
+
+static PyMethodDef StreamBufferType_methods[] = {
+    _ASYNCIO__STREAMBUFFER_EXTEND_METHODDEF
+    _ASYNCIO__STREAMBUFFER_GET_BUFFER_METHODDEF
+    _ASYNCIO__STREAMBUFFER_BUFFER_UPDATED_METHODDEF
+    _ASYNCIO__STREAMBUFFER_TAKE_METHODDEF
+    _ASYNCIO__STREAMBUFFER_DISCARD_METHODDEF
+    _ASYNCIO__STREAMBUFFER_CLEAR_METHODDEF
+    _ASYNCIO__STREAMBUFFER_STARTSWITH_METHODDEF
+    _ASYNCIO__STREAMBUFFER_FIND_METHODDEF
+    {NULL, NULL}        /* Sentinel */
+};
+
+static PySequenceMethods StreamBufferType_as_sequence = {
+    .sq_length = (lenfunc)StreamBufferObj_length,
+};
+
+PyDoc_STRVAR(StreamBuffer_doc,
+"Receive buffer of asyncio.StreamReader.");
+
+static PyTypeObject StreamBufferType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "_asyncio._StreamBuffer",
+    sizeof(StreamBufferObj),                 /* tp_basicsize */
+    .tp_dealloc = (destructor)StreamBufferObj_dealloc,
+    .tp_repr = (reprfunc)StreamBufferObj_repr,
+    .tp_as_sequence = &StreamBufferType_as_sequence,
+    .tp_hash = PyObject_HashNotImplemented,
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_doc = StreamBuffer_doc,
+    .tp_richcompare = (richcmpfunc)StreamBufferObj_richcompare,
+    .tp_methods = StreamBufferType_methods,
+    .tp_new = PyType_GenericNew,
+};
+
+
+/*********************** Functions **************************/
+
+
+/*[clinic input]
+_asyncio._get_running_loop
+
+Return the running event loop or None.
+
+This is a low-level function intended to be used by event loops.
+This function is thread-specific.
+
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__get_running_loop_impl(PyObject *module)
+/*[clinic end generated code: output=b4390af721411a0a input=0a21627e25a4bd43]*/
+{
+    PyObject *loop;
+    if (get_running_loop(&loop)) {
+        return NULL;
+    }
+    if (loop == NULL) {
+        /* There's no currently running event loop */
+        Py_RETURN_NONE;
+    }
+    return loop;
+}
+
+/*[clinic input]
+_asyncio._set_running_loop
+    loop: 'O'
+    /
+
+Set the running event loop.
+
+This is a low-level function intended to be used by event loops.
+This function is thread-specific.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__set_running_loop(PyObject *module, PyObject *loop)
+/*[clinic end generated code: output=ae56bf7a28ca189a input=4c9720233d606604]*/
+{
+    if (set_running_loop(loop)) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+_asyncio.get_event_loop
+
+Return an asyncio event loop.
+
+When called from a coroutine or a callback (e.g. scheduled with
+call_soon or similar API), this function will always return the
+running event loop.
+
+If there is no running event loop set, the function will return
+the result of `get_event_loop_policy().get_event_loop()` call.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio_get_event_loop_impl(PyObject *module)
+/*[clinic end generated code: output=2a2d8b2f824c648b input=9364bf2916c8655d]*/
+{
+    return get_event_loop();
+}
+
+/*[clinic input]
+_asyncio.get_running_loop
+
+Return the running event loop.  Raise a RuntimeError if there is none.
+
+This function is thread-specific.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio_get_running_loop_impl(PyObject *module)
+/*[clinic end generated code: output=c247b5f9e529530e input=2a3bf02ba39f173d]*/
+{
+    PyObject *loop;
+    if (get_running_loop(&loop)) {
+        return NULL;
+    }
+    if (loop == NULL) {
+        /* There's no currently running event loop */
+        PyErr_SetString(
+            PyExc_RuntimeError, "no running event loop");
+    }
+    return loop;
+}
+
+/*[clinic input]
+_asyncio._register_task
+
+    task: object
+
+Register a new task in asyncio as executed by loop.
+
+Returns None.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__register_task_impl(PyObject *module, PyObject *task)
+/*[clinic end generated code: output=8672dadd69a7d4e2 input=21075aaea14dfbad]*/
+{
+    if (register_task(task) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+
+/*[clinic input]
+_asyncio._unregister_task
+
+    task: object
+
+Unregister a task.
+
+Returns None.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__unregister_task_impl(PyObject *module, PyObject *task)
+/*[clinic end generated code: output=6e5585706d568a46 input=28fb98c3975f7bdc]*/
+{
+    if (unregister_task(task) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+
+/*[clinic input]
+_asyncio._enter_task
+
+    loop: object
+    task: object
+
+Enter into task execution or resume suspended task.
+
+Task belongs to loop.
+
+Returns None.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__enter_task_impl(PyObject *module, PyObject *loop, PyObject *task)
+/*[clinic end generated code: output=a22611c858035b73 input=de1b06dca70d8737]*/
+{
+    if (enter_task(loop, task) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+
+/*[clinic input]
+_asyncio._leave_task
+
+    loop: object
+    task: object
+
+Leave task execution or suspend a task.
+
+Task belongs to loop.
+
+Returns None.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__leave_task_impl(PyObject *module, PyObject *loop, PyObject *task)
+/*[clinic end generated code: output=0ebf6db4b858fb41 input=51296a46313d1ad8]*/
+{
+    if (leave_task(loop, task) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+
+/*********************** PyRunningLoopHolder ********************/
 
-/*********************** PyRunningLoopHolder ********************/
-
 
 static PyRunningLoopHolder *
 new_running_loop_holder(PyObject *loop)
@@ -3272,6 +5518,8 @@ module_free(void *m)
     Py_CLEAR(asyncio_task_repr_info_func);
     Py_CLEAR(asyncio_InvalidStateError);
     Py_CLEAR(asyncio_CancelledError);
+    Py_CLEAR(asyncio_extract_stack);
+    Py_CLEAR(asyncio_format_callback_source);
 
     Py_CLEAR(all_tasks);
     Py_CLEAR(current_tasks);
@@ -3347,6 +5595,10 @@ module_init(void)
     WITH_MOD("asyncio.coroutines")
     GET_MOD_ATTR(asyncio_iscoroutine_func, "iscoroutine")
 
+    WITH_MOD("asyncio.format_helpers")
+    GET_MOD_ATTR(asyncio_extract_stack, "extract_stack")
+    GET_MOD_ATTR(asyncio_format_callback_source, "_format_callback_source")
+
     WITH_MOD("traceback")
     GET_MOD_ATTR(traceback_extract_stack, "extract_stack")
 
@@ -3430,6 +5682,32 @@ PyInit__asyncio(void)
         return NULL;
     }
 
+    if (PyModule_AddType(m, &HandleType) < 0) {
+        Py_DECREF(m);
+        return NULL;
+    }
+
+    if (PyModule_AddType(m, &TimerHandleType) < 0) {
+        Py_DECREF(m);
+        return NULL;
+    }
+
+    if (PyModule_AddType(m, &EventLoopCoreType) < 0) {
+        Py_DECREF(m);
+        return NULL;
+    }
+
+    if (PyModule_AddType(m, &StreamBufferType) < 0) {
+        Py_DECREF(m);
+        return NULL;
+    }
+    loop_core_call_at = PyDict_GetItemString(EventLoopCoreType.tp_dict,
+                                             "call_at");  // borrowed
+    if (loop_core_call_at == NULL) {
+        Py_DECREF(m);
+        return NULL;
+    }
+
     Py_INCREF(all_tasks);
     if (PyModule_AddObject(m, "_all_tasks", all_tasks) < 0) {
         Py_DECREF(all_tasks);
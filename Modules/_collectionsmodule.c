@@ -1,4 +1,5 @@
 #include "Python.h"
+#include "pycore_hamt.h"          // _PyHamt_Type
 #include "pycore_long.h"          // _PyLong_GetZero()
 #include "structmember.h"         // PyMemberDef
 
@@ -76,6 +77,15 @@ static PyTypeObject tuplegetter_type;
  *     d.rightindex == CENTER
  *
  * Checking for d.len == 0 is the intended way to see whether d is empty.
+ *
+ * Indexing has to walk the chain of blocks.  To make sequential and
+ * nearby accesses cheap, d.cachedblock remembers the block found by the
+ * last lookup and d.cachedblocknum its position counted in blocks from
+ * d.leftblock.  Lookups start from whichever of the leftblock, the
+ * rightblock and the cached block is nearest.  The cache is dropped
+ * (d.cachedblock == NULL) when its block is freed or the blocks are
+ * relinked, and d.cachedblocknum is adjusted when blocks are added or
+ * removed on the left.
  */
 
 typedef struct BLOCK {
@@ -92,6 +102,8 @@ typedef struct {
     Py_ssize_t rightindex;      /* 0 <= rightindex < BLOCKLEN */
     size_t state;               /* incremented whenever the indices move */
     Py_ssize_t maxlen;          /* maxlen is -1 for unbounded deques */
+    block *cachedblock;         /* block of the last lookup, or NULL */
+    Py_ssize_t cachedblocknum;  /* position of cachedblock in the chain */
     PyObject *weakreflist;
 } dequeobject;
 
@@ -180,6 +192,7 @@ deque_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     deque->rightindex = CENTER;
     deque->state = 0;
     deque->maxlen = -1;
+    deque->cachedblock = NULL;
     deque->weakreflist = NULL;
 
     return (PyObject *)deque;
@@ -204,6 +217,8 @@ deque_pop(dequeobject *deque, PyObject *unused)
         if (Py_SIZE(deque)) {
             prevblock = deque->rightblock->leftlink;
             assert(deque->leftblock != deque->rightblock);
+            if (deque->cachedblock == deque->rightblock)
+                deque->cachedblock = NULL;
             freeblock(deque->rightblock);
             CHECK_NOT_END(prevblock);
             MARK_END(prevblock->rightlink);
@@ -242,6 +257,9 @@ deque_popleft(dequeobject *deque, PyObject *unused)
         if (Py_SIZE(deque)) {
             assert(deque->leftblock != deque->rightblock);
             prevblock = deque->leftblock->rightlink;
+            if (deque->cachedblock == deque->leftblock)
+                deque->cachedblock = NULL;
+            deque->cachedblocknum--;
             freeblock(deque->leftblock);
             CHECK_NOT_END(prevblock);
             MARK_END(prevblock->leftlink);
@@ -260,6 +278,132 @@ deque_popleft(dequeobject *deque, PyObject *unused)
 
 PyDoc_STRVAR(popleft_doc, "Remove and return the leftmost element.");
 
+/* Bulk pops move the pointers block by block into a new list.  The
+   references owned by the deque are transferred, so no reference counts
+   change and no arbitrary code can run while the deque is adjusted. */
+
+static Py_ssize_t
+deque_bulk_count(dequeobject *deque, PyObject *arg)
+{
+    Py_ssize_t n = PyNumber_AsSsize_t(arg, PyExc_OverflowError);
+    if (n == -1 && PyErr_Occurred())
+        return -1;
+    if (n < 0) {
+        PyErr_SetString(PyExc_ValueError, "count must be non-negative");
+        return -1;
+    }
+    return Py_MIN(n, Py_SIZE(deque));
+}
+
+static PyObject *
+deque_popn(dequeobject *deque, PyObject *arg)
+{
+    PyObject *result, **dest;
+    block *prevblock;
+    Py_ssize_t n, m;
+
+    n = deque_bulk_count(deque, arg);
+    if (n < 0)
+        return NULL;
+    result = PyList_New(n);
+    if (result == NULL)
+        return NULL;
+    dest = ((PyListObject *)result)->ob_item;
+
+    while (n > 0) {
+        PyObject **src;
+
+        m = Py_MIN(n, deque->rightindex + 1);
+        src = &deque->rightblock->data[deque->rightindex];
+        deque->rightindex -= m;
+        Py_SET_SIZE(deque, Py_SIZE(deque) - m);
+        n -= m;
+        do {
+            *(dest++) = *(src--);
+        } while (--m);
+
+        if (deque->rightindex < 0) {
+            if (Py_SIZE(deque)) {
+                prevblock = deque->rightblock->leftlink;
+                assert(deque->leftblock != deque->rightblock);
+                if (deque->cachedblock == deque->rightblock)
+                    deque->cachedblock = NULL;
+                freeblock(deque->rightblock);
+                CHECK_NOT_END(prevblock);
+                MARK_END(prevblock->rightlink);
+                deque->rightblock = prevblock;
+                deque->rightindex = BLOCKLEN - 1;
+            } else {
+                assert(deque->leftblock == deque->rightblock);
+                assert(deque->leftindex == deque->rightindex+1);
+                deque->leftindex = CENTER + 1;
+                deque->rightindex = CENTER;
+            }
+        }
+    }
+    deque->state++;
+    return result;
+}
+
+PyDoc_STRVAR(popn_doc,
+"D.popn(n) -> list -- remove and return up to n rightmost elements,\n\
+the rightmost first.");
+
+static PyObject *
+deque_popleftn(dequeobject *deque, PyObject *arg)
+{
+    PyObject *result, **dest;
+    block *prevblock;
+    Py_ssize_t n, m;
+
+    n = deque_bulk_count(deque, arg);
+    if (n < 0)
+        return NULL;
+    result = PyList_New(n);
+    if (result == NULL)
+        return NULL;
+    dest = ((PyListObject *)result)->ob_item;
+
+    while (n > 0) {
+        PyObject **src;
+
+        m = Py_MIN(n, BLOCKLEN - deque->leftindex);
+        src = &deque->leftblock->data[deque->leftindex];
+        deque->leftindex += m;
+        Py_SET_SIZE(deque, Py_SIZE(deque) - m);
+        n -= m;
+        do {
+            *(dest++) = *(src++);
+        } while (--m);
+
+        if (deque->leftindex == BLOCKLEN) {
+            if (Py_SIZE(deque)) {
+                assert(deque->leftblock != deque->rightblock);
+                prevblock = deque->leftblock->rightlink;
+                if (deque->cachedblock == deque->leftblock)
+                    deque->cachedblock = NULL;
+                deque->cachedblocknum--;
+                freeblock(deque->leftblock);
+                CHECK_NOT_END(prevblock);
+                MARK_END(prevblock->leftlink);
+                deque->leftblock = prevblock;
+                deque->leftindex = 0;
+            } else {
+                assert(deque->leftblock == deque->rightblock);
+                assert(deque->leftindex == deque->rightindex+1);
+                deque->leftindex = CENTER + 1;
+                deque->rightindex = CENTER;
+            }
+        }
+    }
+    deque->state++;
+    return result;
+}
+
+PyDoc_STRVAR(popleftn_doc,
+"D.popleftn(n) -> list -- remove and return up to n leftmost elements,\n\
+the leftmost first.");
+
 /* The deque's size limit is d.maxlen.  The limit can be zero or positive.
  * If there is no limit, then d.maxlen == -1.
  *
@@ -324,6 +468,7 @@ deque_appendleft_internal(dequeobject *deque, PyObject *item, Py_ssize_t maxlen)
         deque->leftblock = b;
         MARK_END(b->leftlink);
         deque->leftindex = BLOCKLEN;
+        deque->cachedblocknum++;
     }
     Py_SET_SIZE(deque, Py_SIZE(deque) + 1);
     deque->leftindex--;
@@ -378,6 +523,131 @@ consume_iterator(PyObject *it)
     return finalize_iterator(it);
 }
 
+/* Fast paths for extend() and extendleft() with a list or a tuple.  The
+   pointers are copied a block at a time.  When the sequence alone fills a
+   bounded deque, the current contents are cleared first and the leading
+   items, which would be evicted right away, are skipped, so no blocks are
+   allocated for them.  Only increfs happen while copying; the decrefs of
+   clearing and trimming run before or after, so the sequence is re-read
+   after anything that could have mutated it. */
+
+static int deque_clear(dequeobject *deque);
+
+static PyObject *
+deque_extend_sequence(dequeobject *deque, PyObject *seq, Py_ssize_t maxlen)
+{
+    PyObject **src;
+    Py_ssize_t n, m;
+
+    assert(maxlen != 0);
+    if (maxlen > 0 && PySequence_Fast_GET_SIZE(seq) >= maxlen)
+        deque_clear(deque);
+    n = PySequence_Fast_GET_SIZE(seq);
+    src = PySequence_Fast_ITEMS(seq);
+    if (maxlen > 0 && n > maxlen) {
+        src += n - maxlen;
+        n = maxlen;
+    }
+
+    /* Space saving heuristic.  Start filling from the left */
+    if (Py_SIZE(deque) == 0) {
+        assert(deque->leftblock == deque->rightblock);
+        assert(deque->leftindex == deque->rightindex+1);
+        deque->leftindex = 1;
+        deque->rightindex = 0;
+    }
+
+    deque->state++;
+    while (n > 0) {
+        PyObject **dest;
+
+        if (deque->rightindex == BLOCKLEN - 1) {
+            block *b = newblock();
+            if (b == NULL)
+                return NULL;
+            b->leftlink = deque->rightblock;
+            CHECK_END(deque->rightblock->rightlink);
+            deque->rightblock->rightlink = b;
+            deque->rightblock = b;
+            MARK_END(b->rightlink);
+            deque->rightindex = -1;
+        }
+        m = Py_MIN(n, BLOCKLEN - 1 - deque->rightindex);
+        dest = &deque->rightblock->data[deque->rightindex + 1];
+        deque->rightindex += m;
+        Py_SET_SIZE(deque, Py_SIZE(deque) + m);
+        n -= m;
+        do {
+            PyObject *item = *(src++);
+            Py_INCREF(item);
+            *(dest++) = item;
+        } while (--m);
+    }
+    while (NEEDS_TRIM(deque, maxlen)) {
+        PyObject *olditem = deque_popleft(deque, NULL);
+        Py_DECREF(olditem);
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+deque_extendleft_sequence(dequeobject *deque, PyObject *seq, Py_ssize_t maxlen)
+{
+    PyObject **src;
+    Py_ssize_t n, m;
+
+    assert(maxlen != 0);
+    if (maxlen > 0 && PySequence_Fast_GET_SIZE(seq) >= maxlen)
+        deque_clear(deque);
+    n = PySequence_Fast_GET_SIZE(seq);
+    src = PySequence_Fast_ITEMS(seq);
+    if (maxlen > 0 && n > maxlen) {
+        src += n - maxlen;
+        n = maxlen;
+    }
+
+    /* Space saving heuristic.  Start filling from the right */
+    if (Py_SIZE(deque) == 0) {
+        assert(deque->leftblock == deque->rightblock);
+        assert(deque->leftindex == deque->rightindex+1);
+        deque->leftindex = BLOCKLEN - 1;
+        deque->rightindex = BLOCKLEN - 2;
+    }
+
+    deque->state++;
+    while (n > 0) {
+        PyObject **dest;
+
+        if (deque->leftindex == 0) {
+            block *b = newblock();
+            if (b == NULL)
+                return NULL;
+            b->rightlink = deque->leftblock;
+            CHECK_END(deque->leftblock->leftlink);
+            deque->leftblock->leftlink = b;
+            deque->leftblock = b;
+            MARK_END(b->leftlink);
+            deque->leftindex = BLOCKLEN;
+            deque->cachedblocknum++;
+        }
+        m = Py_MIN(n, deque->leftindex);
+        dest = &deque->leftblock->data[deque->leftindex - 1];
+        deque->leftindex -= m;
+        Py_SET_SIZE(deque, Py_SIZE(deque) + m);
+        n -= m;
+        do {
+            PyObject *item = *(src++);
+            Py_INCREF(item);
+            *(dest--) = item;
+        } while (--m);
+    }
+    while (NEEDS_TRIM(deque, maxlen)) {
+        PyObject *olditem = deque_pop(deque, NULL);
+        Py_DECREF(olditem);
+    }
+    Py_RETURN_NONE;
+}
+
 static PyObject *
 deque_extend(dequeobject *deque, PyObject *iterable)
 {
@@ -396,6 +666,10 @@ deque_extend(dequeobject *deque, PyObject *iterable)
         return result;
     }
 
+    if (maxlen != 0 &&
+        (PyList_CheckExact(iterable) || PyTuple_CheckExact(iterable)))
+        return deque_extend_sequence(deque, iterable, maxlen);
+
     it = PyObject_GetIter(iterable);
     if (it == NULL)
         return NULL;
@@ -443,6 +717,10 @@ deque_extendleft(dequeobject *deque, PyObject *iterable)
         return result;
     }
 
+    if (maxlen != 0 &&
+        (PyList_CheckExact(iterable) || PyTuple_CheckExact(iterable)))
+        return deque_extendleft_sequence(deque, iterable, maxlen);
+
     it = PyObject_GetIter(iterable);
     if (it == NULL)
         return NULL;
@@ -603,6 +881,7 @@ deque_clear(dequeobject *deque)
     deque->rightblock = b;
     deque->leftindex = CENTER + 1;
     deque->rightindex = CENTER;
+    deque->cachedblock = NULL;
     deque->state++;
 
     /* Now the old size, leftblock, and leftindex are disconnected from
@@ -794,6 +1073,8 @@ _deque_rotate(dequeobject *deque, Py_ssize_t n)
     assert(-halflen <= n && n <= halflen);
 
     deque->state++;
+    /* Blocks move from one end to the other */
+    deque->cachedblock = NULL;
     while (n > 0) {
         if (leftindex == 0) {
             if (b == NULL) {
@@ -1169,12 +1450,54 @@ valid_index(Py_ssize_t i, Py_ssize_t limit)
     return (size_t) i < (size_t) limit;
 }
 
+/* Return the block holding the element at the valid index i and store
+   its offset within that block in *offset.  The walk starts from the
+   nearest of the leftblock, the rightblock and the cached block. */
+static block *
+deque_locate(dequeobject *deque, Py_ssize_t i, Py_ssize_t *offset)
+{
+    block *b;
+    Py_ssize_t n, dist, last;
+
+    i += deque->leftindex;
+    n = (Py_ssize_t)((size_t) i / BLOCKLEN);
+    *offset = (Py_ssize_t)((size_t) i % BLOCKLEN);
+    last = (Py_ssize_t)(
+            ((size_t)(deque->leftindex + Py_SIZE(deque) - 1)) / BLOCKLEN);
+
+    if (n <= last - n) {
+        b = deque->leftblock;
+        dist = n;
+    } else {
+        b = deque->rightblock;
+        dist = n - last;
+    }
+    if (deque->cachedblock != NULL) {
+        Py_ssize_t cdist = n - deque->cachedblocknum;
+        assert(0 <= deque->cachedblocknum && deque->cachedblocknum <= last);
+        if (Py_ABS(cdist) < Py_ABS(dist)) {
+            b = deque->cachedblock;
+            dist = cdist;
+        }
+    }
+    while (dist > 0) {
+        b = b->rightlink;
+        dist--;
+    }
+    while (dist < 0) {
+        b = b->leftlink;
+        dist++;
+    }
+    deque->cachedblock = b;
+    deque->cachedblocknum = n;
+    return b;
+}
+
 static PyObject *
 deque_item(dequeobject *deque, Py_ssize_t i)
 {
     block *b;
     PyObject *item;
-    Py_ssize_t n, index=i;
 
     if (!valid_index(i, Py_SIZE(deque))) {
         PyErr_SetString(PyExc_IndexError, "deque index out of range");
@@ -1188,21 +1511,7 @@ deque_item(dequeobject *deque, Py_ssize_t i)
         i = deque->rightindex;
         b = deque->rightblock;
     } else {
-        i += deque->leftindex;
-        n = (Py_ssize_t)((size_t) i / BLOCKLEN);
-        i = (Py_ssize_t)((size_t) i % BLOCKLEN);
-        if (index < (Py_SIZE(deque) >> 1)) {
-            b = deque->leftblock;
-            while (--n >= 0)
-                b = b->rightlink;
-        } else {
-            n = (Py_ssize_t)(
-                    ((size_t)(deque->leftindex + Py_SIZE(deque) - 1))
-                    / BLOCKLEN - n);
-            b = deque->rightblock;
-            while (--n >= 0)
-                b = b->leftlink;
-        }
+        b = deque_locate(deque, i, &i);
     }
     item = b->data[i];
     Py_INCREF(item);
@@ -1272,30 +1581,15 @@ deque_ass_item(dequeobject *deque, Py_ssize_t i, PyObject *v)
 {
     PyObject *old_value;
     block *b;
-    Py_ssize_t n, len=Py_SIZE(deque), halflen=(len+1)>>1, index=i;
 
-    if (!valid_index(i, len)) {
+    if (!valid_index(i, Py_SIZE(deque))) {
         PyErr_SetString(PyExc_IndexError, "deque index out of range");
         return -1;
     }
     if (v == NULL)
         return deque_del_item(deque, i);
 
-    i += deque->leftindex;
-    n = (Py_ssize_t)((size_t) i / BLOCKLEN);
-    i = (Py_ssize_t)((size_t) i % BLOCKLEN);
-    if (index <= halflen) {
-        b = deque->leftblock;
-        while (--n >= 0)
-            b = b->rightlink;
-    } else {
-        n = (Py_ssize_t)(
-                ((size_t)(deque->leftindex + Py_SIZE(deque) - 1))
-                / BLOCKLEN - n);
-        b = deque->rightblock;
-        while (--n >= 0)
-            b = b->leftlink;
-    }
+    b = deque_locate(deque, i, &i);
     Py_INCREF(v);
     old_value = b->data[i];
     b->data[i] = v;
@@ -1619,6 +1913,10 @@ static PyMethodDef deque_methods[] = {
         METH_NOARGS,             pop_doc},
     {"popleft",                 (PyCFunction)deque_popleft,
         METH_NOARGS,             popleft_doc},
+    {"popleftn",                (PyCFunction)deque_popleftn,
+        METH_O,                  popleftn_doc},
+    {"popn",                    (PyCFunction)deque_popn,
+        METH_O,                  popn_doc},
     {"__reduce__",              (PyCFunction)deque_reduce,
         METH_NOARGS,             reduce_doc},
     {"remove",                  (PyCFunction)deque_remove,
@@ -2600,6 +2898,7 @@ collections_exec(PyObject *module) {
         &deque_type,
         &defdict_type,
         &PyODict_Type,
+        &_PyHamt_Type,
         &dequeiter_type,
         &dequereviter_type,
         &tuplegetter_type
@@ -19,6 +19,7 @@ typedef struct _functools_state {
     PyTypeObject *partial_type;
     PyTypeObject *keyobject_type;
     PyTypeObject *lru_list_elem_type;
+    PyTypeObject *lru_budget_elem_type;
 } _functools_state;
 
 static inline _functools_state *
@@ -736,6 +737,10 @@ iterable is empty.");
        from being called more than once.  In the C version, the "known hash"
        variants of dictionary calls as used to the same effect.
 
+   5)  In the budgeted mode (maxbytes, ttl or cost given), the Python version
+       keeps the entries in the insertion order of the cache dict instead of
+       a linked list.
+
 */
 
 struct lru_list_elem;
@@ -770,6 +775,22 @@ static PyType_Spec lru_list_elem_type_spec = {
     .slots = lru_list_elem_type_slots
 };
 
+/* Links used by the budgeted mode.  The extra fields only matter there, so
+   the plain bounded cache keeps the smaller lru_list_elem. */
+typedef struct {
+    lru_list_elem link;
+    Py_ssize_t cost;        /* charged against maxbytes */
+    _PyTime_t expires;      /* monotonic deadline, -1 if there is no ttl */
+    _PyTime_t elapsed;      /* time the user function took for this result */
+} lru_budget_elem;
+
+static PyType_Spec lru_budget_elem_type_spec = {
+    .name = "functools._lru_budget_elem",
+    .basicsize = sizeof(lru_budget_elem),
+    .flags = Py_TPFLAGS_DEFAULT,
+    .slots = lru_list_elem_type_slots
+};
+
 
 typedef PyObject *(*lru_cache_ternaryfunc)(struct lru_cache_object *, PyObject *, PyObject *);
 
@@ -788,6 +809,15 @@ typedef struct lru_cache_object {
     PyObject *cache_info_type;
     PyObject *dict;
     PyObject *weakreflist;
+    /* budgeted mode only */
+    Py_ssize_t maxbytes;    /* -1 for no byte budget */
+    Py_ssize_t currbytes;
+    _PyTime_t ttl;          /* -1 for no expiry */
+    PyObject *cost;         /* user cost function or NULL */
+    PyObject *pending;      /* key -> capsule of lru_pending for calls in flight */
+    Py_ssize_t evictions;
+    Py_ssize_t expirations;
+    _PyTime_t saved;        /* sum of the elapsed time of the hits */
 } lru_cache_object;
 
 static PyObject *
@@ -1135,21 +1165,329 @@ bounded_lru_cache_wrapper(lru_cache_object *self, PyObject *args, PyObject *kwds
     return result;
 }
 
+/* Budgeted mode.
+
+   Selected when any of maxbytes, ttl or cost is given.  The cache is bounded
+   both by the number of entries (maxsize, which may be None here) and by the
+   sum of the entry costs (maxbytes).  The cost of an entry is cost(result)
+   if a cost function was given and sys.getsizeof(result) otherwise.
+   Entries older than ttl seconds are treated as misses and discarded when
+   they are looked up or reach the end of the LRU list.
+
+   Concurrent misses on the same key are collapsed ("single flight"): the
+   first caller registers a pending record holding a locked lock in
+   self->pending and the other threads block on that lock with the GIL
+   released, then retry the lookup.  A recursive call for a key that the
+   same thread is computing is not deduplicated, since waiting would
+   deadlock.
+*/
+
+#define LRU_PENDING_NAME "functools._lru_pending"
+
+typedef struct {
+    PyThread_type_lock lock;    /* held by the owner while computing */
+    unsigned long owner;
+    int done;
+} lru_pending;
+
+static void
+lru_pending_destructor(PyObject *capsule)
+{
+    lru_pending *pending = PyCapsule_GetPointer(capsule, LRU_PENDING_NAME);
+    PyThread_free_lock(pending->lock);
+    PyMem_Free(pending);
+}
+
+/* Return a capsule wrapping a new lru_pending, with its lock acquired by
+   the current thread. */
+static PyObject *
+lru_pending_new(void)
+{
+    lru_pending *pending;
+    PyObject *capsule;
+
+    pending = PyMem_Malloc(sizeof(lru_pending));
+    if (pending == NULL) {
+        return PyErr_NoMemory();
+    }
+    pending->lock = PyThread_allocate_lock();
+    if (pending->lock == NULL) {
+        PyMem_Free(pending);
+        PyErr_SetString(PyExc_MemoryError, "can't allocate lock");
+        return NULL;
+    }
+    PyThread_acquire_lock(pending->lock, WAIT_LOCK);
+    pending->owner = PyThread_get_thread_ident();
+    pending->done = 0;
+    capsule = PyCapsule_New(pending, LRU_PENDING_NAME, lru_pending_destructor);
+    if (capsule == NULL) {
+        PyThread_release_lock(pending->lock);
+        PyThread_free_lock(pending->lock);
+        PyMem_Free(pending);
+        return NULL;
+    }
+    return capsule;
+}
+
+/* Unregister a pending record and wake up its waiters.  The current
+   exception, if any, is preserved. */
+static void
+lru_pending_finish(lru_cache_object *self, PyObject *key, Py_hash_t hash,
+                   PyObject *capsule)
+{
+    lru_pending *pending = PyCapsule_GetPointer(capsule, LRU_PENDING_NAME);
+    PyObject *exc, *val, *tb, *popresult;
+
+    PyErr_Fetch(&exc, &val, &tb);
+    popresult = _PyDict_Pop_KnownHash(self->pending, key, hash, Py_None);
+    if (popresult == NULL) {
+        PyErr_WriteUnraisable((PyObject *)self);
+    }
+    else {
+        Py_DECREF(popresult);
+    }
+    PyErr_Restore(exc, val, tb);
+    /* If the record could not be removed, later callers see it as done
+       and compute the result themselves instead of waiting forever. */
+    pending->done = 1;
+    PyThread_release_lock(pending->lock);
+}
+
+/* Remove a link from the list and from the cache dict.  The references
+   held by the list and by the dict are released once the cache is in a
+   consistent state again. */
+static int
+lru_budget_discard(lru_cache_object *self, lru_list_elem *link)
+{
+    PyObject *popresult;
+
+    lru_cache_extract_link(link);
+    popresult = _PyDict_Pop_KnownHash(self->cache, link->key, link->hash,
+                                      Py_None);
+    if (popresult == NULL) {
+        /* The link is still referenced by the dict, so it has to go back
+           into the list; it becomes the most recently used one. */
+        lru_cache_append_link(self, link);
+        return -1;
+    }
+    self->currbytes -= ((lru_budget_elem *)link)->cost;
+    Py_DECREF(popresult);
+    Py_DECREF(link);
+    return 0;
+}
+
+static int
+lru_budget_store(lru_cache_object *self, PyObject *key, Py_hash_t hash,
+                 PyObject *result, _PyTime_t elapsed)
+{
+    lru_budget_elem *entry;
+    Py_ssize_t cost = 0;
+
+    if (_PyDict_GetItem_KnownHash(self->cache, key, hash) != NULL) {
+        /* Added while the user function was running. */
+        return 0;
+    }
+    if (PyErr_Occurred()) {
+        return -1;
+    }
+
+    if (self->cost != NULL) {
+        PyObject *cost_O = PyObject_CallOneArg(self->cost, result);
+        if (cost_O == NULL) {
+            return -1;
+        }
+        cost = PyNumber_AsSsize_t(cost_O, PyExc_OverflowError);
+        Py_DECREF(cost_O);
+        if (cost == -1 && PyErr_Occurred()) {
+            return -1;
+        }
+        if (cost < 0) {
+            PyErr_SetString(PyExc_ValueError,
+                            "lru_cache cost must be non-negative");
+            return -1;
+        }
+    }
+    else if (self->maxbytes >= 0) {
+        size_t size = _PySys_GetSizeOf(result);
+        if (size == (size_t)-1) {
+            return -1;
+        }
+        cost = (Py_ssize_t)Py_MIN(size, (size_t)PY_SSIZE_T_MAX);
+    }
+    if (self->maxbytes >= 0 && cost > self->maxbytes) {
+        /* It would never fit, return it without caching. */
+        return 0;
+    }
+
+    while (self->root.next != &self->root &&
+           ((self->maxsize >= 0 &&
+             PyDict_GET_SIZE(self->cache) >= self->maxsize) ||
+            (self->maxbytes >= 0 &&
+             self->currbytes > self->maxbytes - cost)))
+    {
+        self->evictions++;
+        if (lru_budget_discard(self, self->root.next) < 0) {
+            return -1;
+        }
+    }
+    /* Releasing the evicted entries may have run arbitrary code. */
+    if (_PyDict_GetItem_KnownHash(self->cache, key, hash) != NULL) {
+        return 0;
+    }
+    if (PyErr_Occurred()) {
+        return -1;
+    }
+
+    entry = (lru_budget_elem *)PyObject_New(lru_list_elem,
+                                            self->lru_list_elem_type);
+    if (entry == NULL) {
+        return -1;
+    }
+    Py_INCREF(key);
+    Py_INCREF(result);
+    entry->link.hash = hash;
+    entry->link.key = key;
+    entry->link.result = result;
+    entry->cost = cost;
+    entry->elapsed = elapsed;
+    if (self->ttl >= 0) {
+        entry->expires = _PyTime_GetMonotonicClock() + self->ttl;
+    }
+    else {
+        entry->expires = -1;
+    }
+    if (_PyDict_SetItem_KnownHash(self->cache, key, (PyObject *)entry,
+                                  hash) < 0) {
+        Py_DECREF(entry);
+        return -1;
+    }
+    lru_cache_append_link(self, &entry->link);
+    self->currbytes += cost;
+    return 0;
+}
+
+static PyObject *
+budgeted_lru_cache_wrapper(lru_cache_object *self, PyObject *args, PyObject *kwds)
+{
+    lru_list_elem *link;
+    lru_pending *pending;
+    PyObject *key, *result, *capsule;
+    Py_hash_t hash;
+    _PyTime_t start;
+
+    key = lru_cache_make_key(self->kwd_mark, args, kwds, self->typed);
+    if (!key)
+        return NULL;
+    hash = PyObject_Hash(key);
+    if (hash == -1) {
+        Py_DECREF(key);
+        return NULL;
+    }
+
+  retry:
+    link = (lru_list_elem *)_PyDict_GetItem_KnownHash(self->cache, key, hash);
+    if (link != NULL) {
+        lru_budget_elem *entry = (lru_budget_elem *)link;
+        if (entry->expires < 0 ||
+            _PyTime_GetMonotonicClock() < entry->expires)
+        {
+            lru_cache_extract_link(link);
+            lru_cache_append_link(self, link);
+            result = link->result;
+            self->hits++;
+            self->saved += entry->elapsed;
+            Py_INCREF(result);
+            Py_DECREF(key);
+            return result;
+        }
+        self->expirations++;
+        if (lru_budget_discard(self, link) < 0) {
+            Py_DECREF(key);
+            return NULL;
+        }
+        goto retry;
+    }
+    if (PyErr_Occurred()) {
+        Py_DECREF(key);
+        return NULL;
+    }
+
+    capsule = _PyDict_GetItem_KnownHash(self->pending, key, hash);
+    if (capsule != NULL) {
+        pending = PyCapsule_GetPointer(capsule, LRU_PENDING_NAME);
+        if (pending == NULL) {
+            Py_DECREF(key);
+            return NULL;
+        }
+        if (!pending->done && pending->owner != PyThread_get_thread_ident()) {
+            Py_INCREF(capsule);
+            Py_BEGIN_ALLOW_THREADS
+            PyThread_acquire_lock(pending->lock, WAIT_LOCK);
+            PyThread_release_lock(pending->lock);
+            Py_END_ALLOW_THREADS
+            Py_DECREF(capsule);
+            goto retry;
+        }
+        /* Recursive call, or a stale record: compute without one. */
+        capsule = NULL;
+    }
+    else if (PyErr_Occurred()) {
+        Py_DECREF(key);
+        return NULL;
+    }
+    else {
+        capsule = lru_pending_new();
+        if (capsule == NULL) {
+            Py_DECREF(key);
+            return NULL;
+        }
+        if (_PyDict_SetItem_KnownHash(self->pending, key, capsule, hash) < 0) {
+            pending = PyCapsule_GetPointer(capsule, LRU_PENDING_NAME);
+            PyThread_release_lock(pending->lock);
+            Py_DECREF(capsule);
+            Py_DECREF(key);
+            return NULL;
+        }
+    }
+
+    self->misses++;
+    start = _PyTime_GetMonotonicClock();
+    result = PyObject_Call(self->func, args, kwds);
+    if (result != NULL &&
+        lru_budget_store(self, key, hash, result,
+                         _PyTime_GetMonotonicClock() - start) < 0)
+    {
+        Py_CLEAR(result);
+    }
+    if (capsule != NULL) {
+        lru_pending_finish(self, key, hash, capsule);
+        Py_DECREF(capsule);
+    }
+    Py_DECREF(key);
+    return result;
+}
+
 static PyObject *
 lru_cache_new(PyTypeObject *type, PyObject *args, PyObject *kw)
 {
     PyObject *func, *maxsize_O, *cache_info_type, *cachedict;
+    PyObject *maxbytes_O = Py_None, *ttl_O = Py_None, *cost = Py_None;
+    PyObject *pending = NULL;
     int typed;
     lru_cache_object *obj;
-    Py_ssize_t maxsize;
+    Py_ssize_t maxsize, maxbytes = -1;
+    _PyTime_t ttl = -1;
     PyObject *(*wrapper)(lru_cache_object *, PyObject *, PyObject *);
     _functools_state *state;
+    PyTypeObject *elem_type;
     static char *keywords[] = {"user_function", "maxsize", "typed",
-                               "cache_info_type", NULL};
+                               "cache_info_type", "maxbytes", "ttl",
+                               "cost", NULL};
 
-    if (!PyArg_ParseTupleAndKeywords(args, kw, "OOpO:lru_cache", keywords,
+    if (!PyArg_ParseTupleAndKeywords(args, kw, "OOpO|$OOO:lru_cache", keywords,
                                      &func, &maxsize_O, &typed,
-                                     &cache_info_type)) {
+                                     &cache_info_type, &maxbytes_O, &ttl_O,
+                                     &cost)) {
         return NULL;
     }
 
@@ -1185,12 +1523,52 @@ lru_cache_new(PyTypeObject *type, PyObject *args, PyObject *kw)
         return NULL;
     }
 
-    if (!(cachedict = PyDict_New()))
+    if (maxbytes_O != Py_None) {
+        if (!PyIndex_Check(maxbytes_O)) {
+            PyErr_SetString(PyExc_TypeError,
+                            "maxbytes should be integer or None");
+            return NULL;
+        }
+        maxbytes = PyNumber_AsSsize_t(maxbytes_O, PyExc_OverflowError);
+        if (maxbytes == -1 && PyErr_Occurred())
+            return NULL;
+        if (maxbytes < 0) {
+            PyErr_SetString(PyExc_ValueError, "maxbytes must be non-negative");
+            return NULL;
+        }
+    }
+    if (ttl_O != Py_None) {
+        if (_PyTime_FromSecondsObject(&ttl, ttl_O, _PyTime_ROUND_CEILING) < 0)
+            return NULL;
+        if (ttl <= 0) {
+            PyErr_SetString(PyExc_ValueError, "ttl must be positive");
+            return NULL;
+        }
+    }
+    if (cost != Py_None && !PyCallable_Check(cost)) {
+        PyErr_SetString(PyExc_TypeError, "cost must be callable or None");
+        return NULL;
+    }
+
+    elem_type = state->lru_list_elem_type;
+    if (wrapper != uncached_lru_cache_wrapper &&
+        (maxbytes_O != Py_None || ttl_O != Py_None || cost != Py_None))
+    {
+        wrapper = budgeted_lru_cache_wrapper;
+        elem_type = state->lru_budget_elem_type;
+        if (!(pending = PyDict_New()))
+            return NULL;
+    }
+
+    if (!(cachedict = PyDict_New())) {
+        Py_XDECREF(pending);
         return NULL;
+    }
 
     obj = (lru_cache_object *)type->tp_alloc(type, 0);
     if (obj == NULL) {
         Py_DECREF(cachedict);
+        Py_XDECREF(pending);
         return NULL;
     }
 
@@ -1205,12 +1583,25 @@ lru_cache_new(PyTypeObject *type, PyObject *args, PyObject *kw)
     obj->maxsize = maxsize;
     Py_INCREF(state->kwd_mark);
     obj->kwd_mark = state->kwd_mark;
-    Py_INCREF(state->lru_list_elem_type);
-    obj->lru_list_elem_type = state->lru_list_elem_type;
+    Py_INCREF(elem_type);
+    obj->lru_list_elem_type = elem_type;
     Py_INCREF(cache_info_type);
     obj->cache_info_type = cache_info_type;
     obj->dict = NULL;
     obj->weakreflist = NULL;
+    obj->maxbytes = maxbytes;
+    obj->currbytes = 0;
+    obj->ttl = ttl;
+    if (cost != Py_None) {
+        Py_INCREF(cost);
+        obj->cost = cost;
+    }
+    else {
+        obj->cost = NULL;
+    }
+    obj->pending = pending;
+    obj->evictions = obj->expirations = 0;
+    obj->saved = 0;
     return (PyObject *)obj;
 }
 
@@ -1246,6 +1637,8 @@ lru_cache_tp_clear(lru_cache_object *self)
     Py_CLEAR(self->lru_list_elem_type);
     Py_CLEAR(self->cache_info_type);
     Py_CLEAR(self->dict);
+    Py_CLEAR(self->cost);
+    Py_CLEAR(self->pending);
     lru_cache_clear_list(list);
     return 0;
 }
@@ -1299,11 +1692,40 @@ lru_cache_cache_clear(lru_cache_object *self, PyObject *unused)
 {
     lru_list_elem *list = lru_cache_unlink_list(self);
     self->hits = self->misses = 0;
+    self->evictions = self->expirations = 0;
+    self->currbytes = 0;
+    self->saved = 0;
     PyDict_Clear(self->cache);
     lru_cache_clear_list(list);
     Py_RETURN_NONE;
 }
 
+static PyObject *
+lru_cache_cache_stats(lru_cache_object *self, PyObject *unused)
+{
+    PyObject *maxbytes;
+
+    if (self->maxbytes < 0) {
+        Py_INCREF(Py_None);
+        maxbytes = Py_None;
+    }
+    else {
+        maxbytes = PyLong_FromSsize_t(self->maxbytes);
+        if (maxbytes == NULL) {
+            return NULL;
+        }
+    }
+    return Py_BuildValue("{sn,sn,sn,sn,sn,sn,sN,sd}",
+                         "hits", self->hits,
+                         "misses", self->misses,
+                         "evictions", self->evictions,
+                         "expirations", self->expirations,
+                         "currsize", PyDict_GET_SIZE(self->cache),
+                         "currbytes", self->currbytes,
+                         "maxbytes", maxbytes,
+                         "time_saved", _PyTime_AsSecondsDouble(self->saved));
+}
+
 static PyObject *
 lru_cache_reduce(PyObject *self, PyObject *unused)
 {
@@ -1340,6 +1762,8 @@ lru_cache_tp_traverse(lru_cache_object *self, visitproc visit, void *arg)
     Py_VISIT(self->lru_list_elem_type);
     Py_VISIT(self->cache_info_type);
     Py_VISIT(self->dict);
+    Py_VISIT(self->cost);
+    Py_VISIT(self->pending);
     return 0;
 }
 
@@ -1357,12 +1781,25 @@ typed:    False     cache f(3) and f(3.0) as identical calls\n\
           True      cache f(3) and f(3.0) as distinct calls\n\
 \n\
 cache_info_type:    namedtuple class with the fields:\n\
-                        hits misses currsize maxsize\n"
+                        hits misses currsize maxsize\n\
+\n\
+maxbytes: None      no limit on the total cost of the entries\n\
+          n         evict entries while their total cost exceeds n\n\
+\n\
+ttl:      None      entries never expire\n\
+          seconds   entries older than this are recomputed\n\
+\n\
+cost:     None      the cost of a result is sys.getsizeof(result)\n\
+          callable  cost(result) returns the cost of a result\n\
+\n\
+Giving any of maxbytes, ttl or cost also makes concurrent calls with\n\
+the same arguments wait for a single call of the user function.\n"
 );
 
 static PyMethodDef lru_cache_methods[] = {
     {"cache_info", (PyCFunction)lru_cache_cache_info, METH_NOARGS},
     {"cache_clear", (PyCFunction)lru_cache_cache_clear, METH_NOARGS},
+    {"cache_stats", (PyCFunction)lru_cache_cache_stats, METH_NOARGS},
     {"__reduce__", (PyCFunction)lru_cache_reduce, METH_NOARGS},
     {"__copy__", (PyCFunction)lru_cache_copy, METH_VARARGS},
     {"__deepcopy__", (PyCFunction)lru_cache_deepcopy, METH_VARARGS},
@@ -1464,6 +1901,15 @@ _functools_exec(PyObject *module)
         return -1;
     }
 
+    state->lru_budget_elem_type = (PyTypeObject *)PyType_FromModuleAndSpec(
+        module, &lru_budget_elem_type_spec, NULL);
+    if (state->lru_budget_elem_type == NULL) {
+        return -1;
+    }
+    if (PyModule_AddType(module, state->lru_budget_elem_type) < 0) {
+        return -1;
+    }
+
     return 0;
 }
 
@@ -1475,6 +1921,7 @@ _functools_traverse(PyObject *module, visitproc visit, void *arg)
     Py_VISIT(state->partial_type);
     Py_VISIT(state->keyobject_type);
     Py_VISIT(state->lru_list_elem_type);
+    Py_VISIT(state->lru_budget_elem_type);
     return 0;
 }
 
@@ -1486,6 +1933,7 @@ _functools_clear(PyObject *module)
     Py_CLEAR(state->partial_type);
     Py_CLEAR(state->keyobject_type);
     Py_CLEAR(state->lru_list_elem_type);
+    Py_CLEAR(state->lru_budget_elem_type);
     return 0;
 }
 
@@ -9,13 +9,54 @@ annotated by François Pinard, and converted to C by Raymond Hettinger.
 #include "Python.h"
 #include "pycore_list.h"          // _PyList_ITEMS()
 
-#include "clinic/_heapqmodule.c.h"
+typedef struct {
+    PyTypeObject *heap_type;
+    PyTypeObject *handle_type;
+} heapq_state;
+
+static inline heapq_state *
+get_heapq_state(PyObject *module)
+{
+    void *state = PyModule_GetState(module);
+    assert(state != NULL);
+    return (heapq_state *)state;
+}
+
+enum {
+    KEY_OBJECT,
+    KEY_INT,
+    KEY_FLOAT
+};
 
+typedef struct {
+    PyObject_HEAD
+    PyObject *item;
+    PyObject *key;
+    int kind;
+    union {
+        long long i;
+        double d;
+    } value;
+    Py_ssize_t index;               /* -1 when not in a heap */
+} handleobject;
+
+typedef struct {
+    PyObject_HEAD
+    handleobject **entries;
+    Py_ssize_t size;
+    Py_ssize_t allocated;
+    PyObject *keyfunc;              /* NULL when items are their own keys */
+    PyTypeObject *handle_type;
+    int busy;                       /* > 0 while comparing entries */
+} heapobject;
+
+#include "clinic/_heapqmodule.c.h"
 
 /*[clinic input]
 module _heapq
+class _heapq.Heap "heapobject *" "((heapq_state *)PyType_GetModuleState(type))->heap_type"
 [clinic start generated code]*/
-/*[clinic end generated code: output=da39a3ee5e6b4b0d input=d7cca0a2e4c0ceb3]*/
+/*[clinic end generated code: output=da39a3ee5e6b4b0d input=8420aa037503addc]*/
 
 static int
 siftdown(PyListObject *heap, Py_ssize_t startpos, Py_ssize_t pos)
@@ -532,6 +573,739 @@ _heapq__heapify_max_impl(PyObject *module, PyObject *heap)
     return heapify_internal(heap, siftup_max);
 }
 
+/* Heap objects **************************************************************/
+
+/* A Heap stores handle objects rather than bare items.  Each handle caches
+   the key extracted from its item and, when that key is an exact int that
+   fits in 64 bits or an exact float, an unboxed copy of it, so that the
+   common scheduler and shortest-path workloads compare machine numbers
+   instead of calling rich comparison.  Handles also remember their current
+   position in the heap, which makes remove() and update() O(log n).
+*/
+
+static handleobject *
+handle_new(heapobject *heap, PyObject *item)
+{
+    handleobject *h;
+    PyObject *key;
+
+    if (heap->keyfunc != NULL) {
+        key = PyObject_CallOneArg(heap->keyfunc, item);
+        if (key == NULL) {
+            return NULL;
+        }
+    }
+    else {
+        Py_INCREF(item);
+        key = item;
+    }
+
+    h = PyObject_GC_New(handleobject, heap->handle_type);
+    if (h == NULL) {
+        Py_DECREF(key);
+        return NULL;
+    }
+    Py_INCREF(item);
+    h->item = item;
+    h->key = key;
+    h->kind = KEY_OBJECT;
+    h->index = -1;
+    if (PyLong_CheckExact(key)) {
+        int overflow;
+        long long v = PyLong_AsLongLongAndOverflow(key, &overflow);
+        if (!overflow) {
+            h->kind = KEY_INT;
+            h->value.i = v;
+        }
+    }
+    else if (PyFloat_CheckExact(key)) {
+        h->kind = KEY_FLOAT;
+        h->value.d = PyFloat_AS_DOUBLE(key);
+    }
+    PyObject_GC_Track(h);
+    return h;
+}
+
+static int
+handle_traverse(handleobject *h, visitproc visit, void *arg)
+{
+    Py_VISIT(Py_TYPE(h));
+    Py_VISIT(h->item);
+    Py_VISIT(h->key);
+    return 0;
+}
+
+static int
+handle_clear(handleobject *h)
+{
+    Py_CLEAR(h->item);
+    Py_CLEAR(h->key);
+    return 0;
+}
+
+static void
+handle_dealloc(handleobject *h)
+{
+    PyTypeObject *tp = Py_TYPE(h);
+    PyObject_GC_UnTrack(h);
+    (void)handle_clear(h);
+    tp->tp_free(h);
+    Py_DECREF(tp);
+}
+
+static PyObject *
+handle_get_item(handleobject *h, void *Py_UNUSED(closure))
+{
+    if (h->item == NULL) {
+        Py_RETURN_NONE;
+    }
+    Py_INCREF(h->item);
+    return h->item;
+}
+
+static PyGetSetDef handle_getsets[] = {
+    {"item", (getter)handle_get_item, NULL,
+     PyDoc_STR("The item this handle refers to.")},
+    {NULL}  /* sentinel */
+};
+
+PyDoc_STRVAR(handle_doc,
+"Reference to an item stored in a Heap.\n\
+\n\
+Handles are returned by Heap.push() and accepted by Heap.remove() and\n\
+Heap.update().");
+
+static PyType_Slot handle_slots[] = {
+    {Py_tp_dealloc, handle_dealloc},
+    {Py_tp_traverse, handle_traverse},
+    {Py_tp_clear, handle_clear},
+    {Py_tp_getset, handle_getsets},
+    {Py_tp_doc, (void *)handle_doc},
+    {0, 0}
+};
+
+static PyType_Spec handle_spec = {
+    .name = "_heapq.HeapHandle",
+    .basicsize = sizeof(handleobject),
+    .flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC,
+    .slots = handle_slots,
+};
+
+/* Return 1 if a sorts before b, 0 if not, -1 on error. */
+static inline int
+entry_lt(handleobject *a, handleobject *b)
+{
+    if (a->kind == b->kind) {
+        if (a->kind == KEY_INT) {
+            return a->value.i < b->value.i;
+        }
+        if (a->kind == KEY_FLOAT) {
+            return a->value.d < b->value.d;
+        }
+    }
+    return PyObject_RichCompareBool(a->key, b->key, Py_LT);
+}
+
+/* The sift functions mirror siftdown() and siftup() above: they swap
+   handles, so that every handle is in the entries array exactly once
+   whenever a comparison can run Python code, and they keep each handle's
+   index current.  The entries array cannot be resized while they run: every
+   mutating method refuses to run while self->busy is set.  On error the heap
+   invariant may be broken. */
+
+static int
+heap_siftdown(heapobject *self, Py_ssize_t startpos, Py_ssize_t pos)
+{
+    handleobject **arr = self->entries;
+    handleobject *newitem = arr[pos];
+    int cmp = 0;
+
+    self->busy++;
+    while (pos > startpos) {
+        Py_ssize_t parentpos = (pos - 1) >> 1;
+        handleobject *parent = arr[parentpos];
+        cmp = entry_lt(newitem, parent);
+        if (cmp <= 0) {
+            break;
+        }
+        arr[parentpos] = newitem;
+        newitem->index = parentpos;
+        arr[pos] = parent;
+        parent->index = pos;
+        pos = parentpos;
+    }
+    self->busy--;
+    return cmp < 0 ? -1 : 0;
+}
+
+static int
+heap_siftup(heapobject *self, Py_ssize_t pos)
+{
+    handleobject **arr = self->entries;
+    Py_ssize_t endpos = self->size;
+    Py_ssize_t startpos = pos;
+    Py_ssize_t childpos, limit;
+    handleobject *tmp1, *tmp2;
+
+    /* Bubble up the smaller child until hitting a leaf. */
+    self->busy++;
+    limit = endpos >> 1;         /* smallest pos that has no child */
+    while (pos < limit) {
+        /* Set childpos to index of smaller child. */
+        childpos = 2*pos + 1;    /* leftmost child position  */
+        if (childpos + 1 < endpos) {
+            int cmp = entry_lt(arr[childpos], arr[childpos + 1]);
+            if (cmp < 0) {
+                self->busy--;
+                return -1;
+            }
+            childpos += ((unsigned)cmp ^ 1);   /* increment when cmp==0 */
+        }
+        /* Move the smaller child up. */
+        tmp1 = arr[childpos];
+        tmp2 = arr[pos];
+        arr[childpos] = tmp2;
+        tmp2->index = childpos;
+        arr[pos] = tmp1;
+        tmp1->index = pos;
+        pos = childpos;
+    }
+    self->busy--;
+    /* Bubble it up to its final resting place (by sifting its parents down). */
+    return heap_siftdown(self, startpos, pos);
+}
+
+/* Restore the invariant around an entry whose key changed at pos. */
+static int
+heap_fix(heapobject *self, Py_ssize_t pos)
+{
+    if (pos > 0) {
+        int cmp;
+        self->busy++;
+        cmp = entry_lt(self->entries[pos], self->entries[(pos - 1) >> 1]);
+        self->busy--;
+        if (cmp < 0) {
+            return -1;
+        }
+        if (cmp) {
+            return heap_siftdown(self, 0, pos);
+        }
+    }
+    return heap_siftup(self, pos);
+}
+
+static int
+heap_check_busy(heapobject *self)
+{
+    if (self->busy) {
+        PyErr_SetString(PyExc_RuntimeError,
+                        "Heap mutated during comparison");
+        return -1;
+    }
+    return 0;
+}
+
+static int
+heap_reserve(heapobject *self, Py_ssize_t n)
+{
+    handleobject **entries;
+    Py_ssize_t newsize;
+
+    if (n <= self->allocated - self->size) {
+        return 0;
+    }
+    if (n > PY_SSIZE_T_MAX / (Py_ssize_t)sizeof(handleobject *) - self->size) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    newsize = self->size + n;
+    /* Over-allocate like list_resize() to amortize repeated pushes. */
+    if (newsize <= PY_SSIZE_T_MAX / (Py_ssize_t)sizeof(handleobject *)
+                   - (newsize >> 3) - 6) {
+        newsize += (newsize >> 3) + 6;
+    }
+    entries = PyMem_Resize(self->entries, handleobject *, newsize);
+    if (entries == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    self->entries = entries;
+    self->allocated = newsize;
+    return 0;
+}
+
+/* Detach the handle at pos, refill the hole from the end of the array and
+   return a new reference to the handle's item. */
+static PyObject *
+heap_take(heapobject *self, Py_ssize_t pos)
+{
+    handleobject *h = self->entries[pos];
+    handleobject *last;
+    PyObject *item;
+    int err = 0;
+
+    self->size--;
+    last = self->entries[self->size];
+    if (last != h) {
+        self->entries[pos] = last;
+        last->index = pos;
+        err = heap_fix(self, pos);
+    }
+    h->index = -1;
+    item = h->item;
+    Py_INCREF(item);
+    Py_DECREF(h);
+    if (err < 0) {
+        Py_DECREF(item);
+        return NULL;
+    }
+    return item;
+}
+
+static int
+heap_validate(heapobject *self, PyObject *handle)
+{
+    if (!Py_IS_TYPE(handle, self->handle_type)) {
+        PyErr_Format(PyExc_TypeError,
+                     "expected a heap handle, not %.200s",
+                     Py_TYPE(handle)->tp_name);
+        return -1;
+    }
+    Py_ssize_t pos = ((handleobject *)handle)->index;
+    if (pos < 0 || pos >= self->size || self->entries[pos] != (handleobject *)handle) {
+        PyErr_SetString(PyExc_ValueError, "handle is not in this heap");
+        return -1;
+    }
+    return 0;
+}
+
+static void
+heap_release(heapobject *self)
+{
+    handleobject **entries = self->entries;
+    Py_ssize_t i, n = self->size;
+
+    self->entries = NULL;
+    self->size = self->allocated = 0;
+    for (i = 0; i < n; i++) {
+        entries[i]->index = -1;
+        Py_DECREF(entries[i]);
+    }
+    PyMem_Free(entries);
+}
+
+static int heap_extend(heapobject *self, PyObject *iterable);
+
+static PyObject *
+heap_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+    static char *kwlist[] = {"", "key", NULL};
+    PyObject *iterable = NULL, *keyfunc = Py_None;
+    heapobject *self;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "|O$O:Heap", kwlist,
+                                     &iterable, &keyfunc)) {
+        return NULL;
+    }
+    if (keyfunc != Py_None && !PyCallable_Check(keyfunc)) {
+        PyErr_SetString(PyExc_TypeError, "key must be callable or None");
+        return NULL;
+    }
+    heapq_state *state = PyType_GetModuleState(type);
+    self = PyObject_GC_New(heapobject, type);
+    if (self == NULL) {
+        return NULL;
+    }
+    self->entries = NULL;
+    self->size = self->allocated = 0;
+    self->busy = 0;
+    Py_INCREF(state->handle_type);
+    self->handle_type = state->handle_type;
+    if (keyfunc != Py_None) {
+        Py_INCREF(keyfunc);
+        self->keyfunc = keyfunc;
+    }
+    else {
+        self->keyfunc = NULL;
+    }
+    PyObject_GC_Track(self);
+    if (iterable != NULL && heap_extend(self, iterable) < 0) {
+        Py_DECREF(self);
+        return NULL;
+    }
+    return (PyObject *)self;
+}
+
+static int
+heap_traverse(heapobject *self, visitproc visit, void *arg)
+{
+    Py_ssize_t i;
+
+    Py_VISIT(Py_TYPE(self));
+    Py_VISIT(self->handle_type);
+    Py_VISIT(self->keyfunc);
+    for (i = 0; i < self->size; i++) {
+        Py_VISIT(self->entries[i]);
+    }
+    return 0;
+}
+
+static int
+heap_clear(heapobject *self)
+{
+    Py_CLEAR(self->keyfunc);
+    heap_release(self);
+    return 0;
+}
+
+static void
+heap_dealloc(heapobject *self)
+{
+    PyTypeObject *tp = Py_TYPE(self);
+    PyObject_GC_UnTrack(self);
+    (void)heap_clear(self);
+    Py_CLEAR(self->handle_type);
+    tp->tp_free(self);
+    Py_DECREF(tp);
+}
+
+static Py_ssize_t
+heap_len(heapobject *self)
+{
+    return self->size;
+}
+
+/*[clinic input]
+_heapq.Heap.push
+
+    item: object
+    /
+
+Push item onto the heap and return a handle to it.
+[clinic start generated code]*/
+
+static PyObject *
+_heapq_Heap_push(heapobject *self, PyObject *item)
+/*[clinic end generated code: output=b2c1f141e4ca1a0f input=d2c22345bc241923]*/
+{
+    handleobject *h;
+
+    if (heap_check_busy(self) < 0) {
+        return NULL;
+    }
+    /* The key function may run arbitrary code; compute it first. */
+    h = handle_new(self, item);
+    if (h == NULL) {
+        return NULL;
+    }
+    if (heap_check_busy(self) < 0 || heap_reserve(self, 1) < 0) {
+        Py_DECREF(h);
+        return NULL;
+    }
+    self->entries[self->size] = h;
+    h->index = self->size++;
+    Py_INCREF(h);
+    if (heap_siftdown(self, 0, h->index) < 0) {
+        Py_DECREF(h);
+        return NULL;
+    }
+    return (PyObject *)h;
+}
+
+static int
+heap_extend(heapobject *self, PyObject *iterable)
+{
+    PyObject *seq, *handles;
+    Py_ssize_t i, n, oldsize;
+    int err = 0;
+
+    seq = PySequence_Fast(iterable, "pushmany() argument must be iterable");
+    if (seq == NULL) {
+        return -1;
+    }
+    n = PySequence_Fast_GET_SIZE(seq);
+    handles = PyList_New(n);
+    if (handles == NULL) {
+        Py_DECREF(seq);
+        return -1;
+    }
+    /* Extract every key before touching the array, so that a failing or
+       heap-mutating key function leaves the heap as it was. */
+    for (i = 0; i < n; i++) {
+        handleobject *h = handle_new(self, PySequence_Fast_GET_ITEM(seq, i));
+        if (h == NULL) {
+            Py_DECREF(handles);
+            Py_DECREF(seq);
+            return -1;
+        }
+        PyList_SET_ITEM(handles, i, (PyObject *)h);
+    }
+    Py_DECREF(seq);
+    if (heap_check_busy(self) < 0 || heap_reserve(self, n) < 0) {
+        Py_DECREF(handles);
+        return -1;
+    }
+    oldsize = self->size;
+    for (i = 0; i < n; i++) {
+        handleobject *h = (handleobject *)PyList_GET_ITEM(handles, i);
+        Py_INCREF(h);
+        h->index = self->size;
+        self->entries[self->size++] = h;
+    }
+    Py_DECREF(handles);
+
+    if (n > oldsize) {
+        /* Many new entries: a bottom-up heapify is cheaper than n sifts. */
+        for (i = (self->size >> 1) - 1; i >= 0 && !err; i--) {
+            err = heap_siftup(self, i);
+        }
+    }
+    else {
+        for (i = oldsize; i < self->size && !err; i++) {
+            err = heap_siftdown(self, 0, i);
+        }
+    }
+    return err;
+}
+
+/*[clinic input]
+_heapq.Heap.pushmany
+
+    iterable: object
+    /
+
+Push all items from iterable onto the heap.
+[clinic start generated code]*/
+
+static PyObject *
+_heapq_Heap_pushmany(heapobject *self, PyObject *iterable)
+/*[clinic end generated code: output=a54b2c400359ac69 input=285e005e932fec82]*/
+{
+    if (heap_check_busy(self) < 0 || heap_extend(self, iterable) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+_heapq.Heap.pop
+
+Pop the smallest item off the heap.
+[clinic start generated code]*/
+
+static PyObject *
+_heapq_Heap_pop_impl(heapobject *self)
+/*[clinic end generated code: output=b78e49db62f9c375 input=3f77805dd39da9f3]*/
+{
+    if (heap_check_busy(self) < 0) {
+        return NULL;
+    }
+    if (self->size == 0) {
+        PyErr_SetString(PyExc_IndexError, "pop from an empty heap");
+        return NULL;
+    }
+    return heap_take(self, 0);
+}
+
+/*[clinic input]
+_heapq.Heap.popmany
+
+    n: Py_ssize_t
+    /
+
+Pop up to n smallest items off the heap and return them as a sorted list.
+[clinic start generated code]*/
+
+static PyObject *
+_heapq_Heap_popmany_impl(heapobject *self, Py_ssize_t n)
+/*[clinic end generated code: output=641a1b7a553bce94 input=63d7d1bf5b5d12c7]*/
+{
+    PyObject *result;
+    Py_ssize_t i;
+
+    if (heap_check_busy(self) < 0) {
+        return NULL;
+    }
+    if (n < 0) {
+        PyErr_SetString(PyExc_ValueError, "n must be non-negative");
+        return NULL;
+    }
+    if (n > self->size) {
+        n = self->size;
+    }
+    result = PyList_New(n);
+    if (result == NULL) {
+        return NULL;
+    }
+    /* Comparisons cannot mutate the heap, so it holds at least n items. */
+    for (i = 0; i < n; i++) {
+        PyObject *item = heap_take(self, 0);
+        if (item == NULL) {
+            Py_SET_SIZE(result, i);
+            Py_DECREF(result);
+            return NULL;
+        }
+        PyList_SET_ITEM(result, i, item);
+    }
+    return result;
+}
+
+/*[clinic input]
+_heapq.Heap.peek
+
+Return the smallest item without removing it.
+[clinic start generated code]*/
+
+static PyObject *
+_heapq_Heap_peek_impl(heapobject *self)
+/*[clinic end generated code: output=fb7d3e7e182f4862 input=2ab21275c7fa37d0]*/
+{
+    if (self->size == 0) {
+        PyErr_SetString(PyExc_IndexError, "peek at an empty heap");
+        return NULL;
+    }
+    Py_INCREF(self->entries[0]->item);
+    return self->entries[0]->item;
+}
+
+/*[clinic input]
+_heapq.Heap.remove
+
+    handle: object
+    /
+
+Remove the item referred to by handle from the heap and return it.
+[clinic start generated code]*/
+
+static PyObject *
+_heapq_Heap_remove(heapobject *self, PyObject *handle)
+/*[clinic end generated code: output=1b5553faaeb74611 input=9370599b425de1b7]*/
+{
+    if (heap_check_busy(self) < 0 || heap_validate(self, handle) < 0) {
+        return NULL;
+    }
+    return heap_take(self, ((handleobject *)handle)->index);
+}
+
+/*[clinic input]
+_heapq.Heap.update
+
+    handle: object
+    item: object
+    /
+
+Replace the item referred to by handle and restore the heap invariant.
+[clinic start generated code]*/
+
+static PyObject *
+_heapq_Heap_update_impl(heapobject *self, PyObject *handle, PyObject *item)
+/*[clinic end generated code: output=984eb726909c869f input=05c21001ae573246]*/
+{
+    handleobject *h, *tmp;
+    PyObject *olditem, *oldkey;
+
+    if (heap_check_busy(self) < 0 || heap_validate(self, handle) < 0) {
+        return NULL;
+    }
+    tmp = handle_new(self, item);
+    if (tmp == NULL) {
+        return NULL;
+    }
+    /* The key function may have removed the handle meanwhile. */
+    if (heap_check_busy(self) < 0 || heap_validate(self, handle) < 0) {
+        Py_DECREF(tmp);
+        return NULL;
+    }
+    h = (handleobject *)handle;
+    olditem = h->item;
+    oldkey = h->key;
+    h->item = tmp->item;
+    h->key = tmp->key;
+    h->kind = tmp->kind;
+    h->value = tmp->value;
+    tmp->item = olditem;
+    tmp->key = oldkey;
+    Py_DECREF(tmp);
+    if (heap_fix(self, h->index) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+_heapq.Heap.clear
+
+Remove all items from the heap.
+[clinic start generated code]*/
+
+static PyObject *
+_heapq_Heap_clear_impl(heapobject *self)
+/*[clinic end generated code: output=d2ec25b61a784a74 input=95be8f0c99a0381b]*/
+{
+    if (heap_check_busy(self) < 0) {
+        return NULL;
+    }
+    heap_release(self);
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+heap_get_key(heapobject *self, void *Py_UNUSED(closure))
+{
+    if (self->keyfunc == NULL) {
+        Py_RETURN_NONE;
+    }
+    Py_INCREF(self->keyfunc);
+    return self->keyfunc;
+}
+
+static PyMethodDef heap_methods[] = {
+    _HEAPQ_HEAP_PUSH_METHODDEF
+    _HEAPQ_HEAP_PUSHMANY_METHODDEF
+    _HEAPQ_HEAP_POP_METHODDEF
+    _HEAPQ_HEAP_POPMANY_METHODDEF
+    _HEAPQ_HEAP_PEEK_METHODDEF
+    _HEAPQ_HEAP_REMOVE_METHODDEF
+    _HEAPQ_HEAP_UPDATE_METHODDEF
+    _HEAPQ_HEAP_CLEAR_METHODDEF
+    {NULL, NULL}           /* sentinel */
+};
+
+static PyGetSetDef heap_getsets[] = {
+    {"key", (getter)heap_get_key, NULL,
+     PyDoc_STR("The key function, or None.")},
+    {NULL}  /* sentinel */
+};
+
+PyDoc_STRVAR(heap_doc,
+"Heap(iterable=(), /, *, key=None)\n\
+--\n\
+\n\
+A min-heap with optional key function and handles to stored items.\n\
+\n\
+push() returns a handle that can later be passed to remove() or\n\
+update() to delete or reprioritize that item in O(log n) time.");
+
+static PyType_Slot heap_slots[] = {
+    {Py_tp_dealloc, heap_dealloc},
+    {Py_tp_traverse, heap_traverse},
+    {Py_tp_clear, heap_clear},
+    {Py_tp_methods, heap_methods},
+    {Py_tp_getset, heap_getsets},
+    {Py_tp_new, heap_new},
+    {Py_tp_doc, (void *)heap_doc},
+    {Py_sq_length, heap_len},
+    {Py_mp_length, heap_len},
+    {0, 0}
+};
+
+static PyType_Spec heap_spec = {
+    .name = "_heapq.Heap",
+    .basicsize = sizeof(heapobject),
+    .flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC,
+    .slots = heap_slots,
+};
+
 static PyMethodDef heapq_methods[] = {
     _HEAPQ_HEAPPUSH_METHODDEF
     _HEAPQ_HEAPPUSHPOP_METHODDEF
@@ -673,14 +1447,57 @@ From all times, sorting has always been a Great Art! :-)\n");
 static int
 heapq_exec(PyObject *m)
 {
+    heapq_state *state = get_heapq_state(m);
+
     PyObject *about = PyUnicode_FromString(__about__);
     if (PyModule_AddObject(m, "__about__", about) < 0) {
         Py_DECREF(about);
         return -1;
     }
+
+    state->handle_type = (PyTypeObject *)PyType_FromModuleAndSpec(
+        m, &handle_spec, NULL);
+    if (state->handle_type == NULL) {
+        return -1;
+    }
+    /* Handles are only created by Heap.push(). */
+    state->handle_type->tp_new = NULL;
+
+    state->heap_type = (PyTypeObject *)PyType_FromModuleAndSpec(
+        m, &heap_spec, NULL);
+    if (state->heap_type == NULL) {
+        return -1;
+    }
+    if (PyModule_AddType(m, state->heap_type) < 0) {
+        return -1;
+    }
+    return 0;
+}
+
+static int
+heapq_traverse(PyObject *m, visitproc visit, void *arg)
+{
+    heapq_state *state = get_heapq_state(m);
+    Py_VISIT(state->heap_type);
+    Py_VISIT(state->handle_type);
     return 0;
 }
 
+static int
+heapq_clear(PyObject *m)
+{
+    heapq_state *state = get_heapq_state(m);
+    Py_CLEAR(state->heap_type);
+    Py_CLEAR(state->handle_type);
+    return 0;
+}
+
+static void
+heapq_free(void *m)
+{
+    heapq_clear((PyObject *)m);
+}
+
 static struct PyModuleDef_Slot heapq_slots[] = {
     {Py_mod_exec, heapq_exec},
     {0, NULL}
@@ -690,12 +1507,12 @@ static struct PyModuleDef _heapqmodule = {
     PyModuleDef_HEAD_INIT,
     "_heapq",
     module_doc,
-    0,
+    sizeof(heapq_state),
     heapq_methods,
     heapq_slots,
-    NULL,
-    NULL,
-    NULL
+    heapq_traverse,
+    heapq_clear,
+    heapq_free
 };
 
 PyMODINIT_FUNC
@@ -13,6 +13,10 @@
 #include "structmember.h"         // PyMemberDef
 #include "_iomodule.h"
 
+#ifdef HAVE_SYS_UIO_H
+#include <sys/uio.h>              // writev()
+#endif
+
 /*[clinic input]
 module _io
 class _io._BufferedIOBase "PyObject *" "&PyBufferedIOBase_Type"
@@ -2063,6 +2067,246 @@ _io_BufferedWriter_write_impl(buffered *self, Py_buffer *buffer)
     LEAVE_BUFFERED(self)
     return res;
 }
+
+#ifdef HAVE_WRITEV
+#ifdef IOV_MAX
+#  define BUFFERED_IOV_MAX IOV_MAX
+#else
+#  define BUFFERED_IOV_MAX 16
+#endif
+
+/* Write the pending buffered data followed by `bufs` to the raw file with
+   vectored writes, bypassing the buffer.  Only used when the raw stream is
+   an exact FileIO, so its file descriptor can be written to directly.
+   Return how many bytes of `bufs` were written: less than their total size
+   only if the file would block, in which case the caller writes the rest
+   the regular way.  Return -1 with an exception set on error. */
+static Py_ssize_t
+_bufferedwriter_writev_unlocked(buffered *self, Py_buffer *bufs,
+                                Py_ssize_t nbufs)
+{
+    struct iovec *iovs, *iov;
+    Py_ssize_t i, niov = 0, pending = 0, written = 0;
+    int fd;
+
+    fd = PyObject_AsFileDescriptor(self->raw);
+    if (fd < 0)
+        return -1;
+
+    /* The buffered data can be written along with `bufs` if the raw
+       stream is positioned at its start and the logical position at its
+       end, which is the case after a series of plain writes.  Otherwise
+       flush it first. */
+    if (VALID_WRITE_BUFFER(self) && self->write_pos < self->write_end &&
+        self->raw_pos == self->write_pos && self->pos == self->write_end) {
+        pending = Py_SAFE_DOWNCAST(self->write_end - self->write_pos,
+                                   Py_off_t, Py_ssize_t);
+    }
+    else {
+        PyObject *res = _bufferedwriter_flush_unlocked(self);
+        if (res == NULL) {
+            if (_buffered_check_blocking_error() == NULL)
+                return -1;
+            /* Let the caller buffer what it can. */
+            PyErr_Clear();
+            return 0;
+        }
+        Py_DECREF(res);
+    }
+
+    iovs = PyMem_New(struct iovec, nbufs + 1);
+    if (iovs == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    if (pending > 0) {
+        iovs[niov].iov_base = self->buffer + self->write_pos;
+        iovs[niov].iov_len = pending;
+        niov++;
+    }
+    for (i = 0; i < nbufs; i++) {
+        if (bufs[i].len > 0) {
+            iovs[niov].iov_base = bufs[i].buf;
+            iovs[niov].iov_len = bufs[i].len;
+            niov++;
+        }
+    }
+
+    iov = iovs;
+    while (niov > 0) {
+        Py_ssize_t n, consumed;
+
+        Py_BEGIN_ALLOW_THREADS
+        errno = 0;
+        n = writev(fd, iov, (int)Py_MIN(niov, BUFFERED_IOV_MAX));
+        Py_END_ALLOW_THREADS
+        if (n < 0) {
+            if (errno == EINTR) {
+                if (PyErr_CheckSignals() < 0)
+                    goto error;
+                continue;
+            }
+            if (errno == EAGAIN)
+                break;
+            PyErr_SetFromErrno(PyExc_OSError);
+            goto error;
+        }
+        if (n == 0)
+            break;
+        if (self->abs_pos != -1)
+            self->abs_pos += n;
+
+        /* The buffered data goes out first. */
+        consumed = Py_MIN(n, pending);
+        pending -= consumed;
+        self->write_pos += consumed;
+        self->raw_pos = self->write_pos;
+        written += n - consumed;
+
+        while (niov > 0 && (size_t)n >= iov->iov_len) {
+            n -= iov->iov_len;
+            iov++;
+            niov--;
+        }
+        if (n > 0) {
+            iov->iov_base = (char *)iov->iov_base + n;
+            iov->iov_len -= n;
+        }
+        /* Partial writes can return successfully when interrupted by a
+           signal (see write(2)).  We must run signal handlers before
+           blocking another time, possibly indefinitely. */
+        if (PyErr_CheckSignals() < 0)
+            goto error;
+    }
+    PyMem_Free(iovs);
+
+    if (pending == 0) {
+        _bufferedwriter_reset_buf(self);
+        self->pos = 0;
+        self->raw_pos = 0;
+    }
+    return written;
+
+error:
+    PyMem_Free(iovs);
+    return -1;
+}
+#endif /* HAVE_WRITEV */
+
+/*[clinic input]
+_io.BufferedWriter.writelines
+    lines: object
+    /
+
+Write a list of lines to stream.
+
+Line separators are not added, so it is usual for each of the
+lines provided to have a line separator at the end.  Lines that do
+not fit in the buffer are written along with the buffered data in a
+single vectored write, without copying them into the buffer.
+[clinic start generated code]*/
+
+static PyObject *
+_io_BufferedWriter_writelines(buffered *self, PyObject *lines)
+/*[clinic end generated code: output=7566d221eb1717a5 input=29fb727515414d85]*/
+{
+    PyObject *seq, *res = NULL;
+    Py_buffer *bufs;
+    Py_ssize_t i, nlines, nbufs = 0, total = 0, written = 0;
+
+    CHECK_INITIALIZED(self)
+    CHECK_CLOSED(self, "write to closed file")
+
+    if (!self->fast_closed_checks) {
+        /* Subclasses and custom raw streams get the generic behaviour:
+           one self.write() call per line. */
+        PyObject *iter = PyObject_GetIter(lines);
+        if (iter == NULL)
+            return NULL;
+        while (1) {
+            PyObject *line = PyIter_Next(iter);
+            if (line == NULL)
+                break;
+            do {
+                res = PyObject_CallMethodObjArgs((PyObject *)self,
+                                                 _PyIO_str_write, line, NULL);
+            } while (res == NULL && _PyIO_trap_eintr());
+            Py_DECREF(line);
+            if (res == NULL)
+                break;
+            Py_DECREF(res);
+        }
+        Py_DECREF(iter);
+        if (PyErr_Occurred())
+            return NULL;
+        Py_RETURN_NONE;
+    }
+
+    seq = PySequence_Fast(lines, "writelines() argument must be iterable");
+    if (seq == NULL)
+        return NULL;
+    nlines = PySequence_Fast_GET_SIZE(seq);
+    bufs = PyMem_New(Py_buffer, nlines);
+    if (bufs == NULL && nlines > 0) {
+        PyErr_NoMemory();
+        goto end;
+    }
+    /* Check every line before writing anything. */
+    for (; nbufs < nlines; nbufs++) {
+        PyObject *line = PySequence_Fast_GET_ITEM(seq, nbufs);
+        if (PyObject_GetBuffer(line, &bufs[nbufs], PyBUF_SIMPLE) < 0)
+            goto end;
+        total += bufs[nbufs].len;
+    }
+
+#ifdef HAVE_WRITEV
+    if (nbufs > 0) {
+        Py_off_t used;
+
+        if (!ENTER_BUFFERED(self))
+            goto end;
+        if (IS_CLOSED(self)) {
+            PyErr_SetString(PyExc_ValueError, "write to closed file");
+            LEAVE_BUFFERED(self)
+            goto end;
+        }
+        used = VALID_WRITE_BUFFER(self) ? self->pos : 0;
+        if (total > self->buffer_size - used)
+            written = _bufferedwriter_writev_unlocked(self, bufs, nbufs);
+        LEAVE_BUFFERED(self)
+        if (written < 0)
+            goto end;
+    }
+#endif
+
+    /* Write whatever was not written above the regular way. */
+    for (i = 0; i < nbufs; i++) {
+        Py_buffer rest;
+        PyObject *r;
+
+        if (written >= bufs[i].len) {
+            written -= bufs[i].len;
+            continue;
+        }
+        rest = bufs[i];
+        rest.buf = (char *)rest.buf + written;
+        rest.len -= written;
+        written = 0;
+        r = _io_BufferedWriter_write_impl(self, &rest);
+        if (r == NULL)
+            goto end;
+        Py_DECREF(r);
+    }
+    res = Py_None;
+    Py_INCREF(res);
+
+end:
+    for (i = 0; i < nbufs; i++)
+        PyBuffer_Release(&bufs[i]);
+    PyMem_Free(bufs);
+    Py_DECREF(seq);
+    return res;
+}
 
 
 
@@ -2489,6 +2733,7 @@ static PyMethodDef bufferedwriter_methods[] = {
     {"_dealloc_warn", (PyCFunction)buffered_dealloc_warn, METH_O},
 
     _IO_BUFFEREDWRITER_WRITE_METHODDEF
+    _IO_BUFFEREDWRITER_WRITELINES_METHODDEF
     _IO__BUFFERED_TRUNCATE_METHODDEF
     {"flush", (PyCFunction)buffered_flush, METH_NOARGS},
     _IO__BUFFERED_SEEK_METHODDEF
@@ -527,6 +527,20 @@ _io_BufferedWriter_write(buffered *self, PyObject *arg)
     return return_value;
 }
 
+PyDoc_STRVAR(_io_BufferedWriter_writelines__doc__,
+"writelines($self, lines, /)\n"
+"--\n"
+"\n"
+"Write a list of lines to stream.\n"
+"\n"
+"Line separators are not added, so it is usual for each of the\n"
+"lines provided to have a line separator at the end.  Lines that do\n"
+"not fit in the buffer are written along with the buffered data in a\n"
+"single vectored write, without copying them into the buffer.");
+
+#define _IO_BUFFEREDWRITER_WRITELINES_METHODDEF    \
+    {"writelines", (PyCFunction)_io_BufferedWriter_writelines, METH_O, _io_BufferedWriter_writelines__doc__},
+
 PyDoc_STRVAR(_io_BufferedRWPair___init____doc__,
 "BufferedRWPair(reader, writer, buffer_size=DEFAULT_BUFFER_SIZE, /)\n"
 "--\n"
@@ -637,4 +651,4 @@ _io_BufferedRandom___init__(PyObject *self, PyObject *args, PyObject *kwargs)
 exit:
     return return_value;
 }
-/*[clinic end generated code: output=98ccf7610c0e82ba input=a9049054013a1b77]*/
+/*[clinic end generated code: output=028eec0e024dffaa input=a9049054013a1b77]*/
@@ -227,8 +227,18 @@ typedef struct {
     unsigned int pendingcr: 1;
     unsigned int translate: 1;
     unsigned int seennl: 3;
+    /* Built-in decoder used instead of decoder.decode() (see
+       _textiowrapper_set_decoder()), and the bytes of an incomplete UTF-8
+       sequence it holds back. */
+    char builtin;
+    PyObject *undecoded;
 } nldecoder_object;
 
+#define BUILTIN_DECODER_NONE   0
+#define BUILTIN_DECODER_ASCII  1
+#define BUILTIN_DECODER_LATIN1 2
+#define BUILTIN_DECODER_UTF8   3
+
 /*[clinic input]
 _io.IncrementalNewlineDecoder.__init__
     decoder: object
@@ -267,6 +277,8 @@ _io_IncrementalNewlineDecoder___init___impl(nldecoder_object *self,
     self->translate = translate ? 1 : 0;
     self->seennl = 0;
     self->pendingcr = 0;
+    self->builtin = BUILTIN_DECODER_NONE;
+    Py_CLEAR(self->undecoded);
 
     return 0;
 }
@@ -276,6 +288,7 @@ incrementalnewlinedecoder_dealloc(nldecoder_object *self)
 {
     Py_CLEAR(self->decoder);
     Py_CLEAR(self->errors);
+    Py_CLEAR(self->undecoded);
     Py_TYPE(self)->tp_free((PyObject *)self);
 }
 
@@ -303,6 +316,66 @@ check_decoded(PyObject *decoded)
 #define SEEN_CRLF 4
 #define SEEN_ALL (SEEN_CR | SEEN_LF | SEEN_CRLF)
 
+/* Decode input with the built-in decoder.  An incomplete UTF-8 sequence at
+   the end of the input is kept for the next call unless final is true. */
+static PyObject *
+nldecoder_builtin_decode(nldecoder_object *self, PyObject *input, int final)
+{
+    Py_buffer buf;
+    const char *errors, *s;
+    char *joined = NULL;
+    Py_ssize_t len, consumed;
+    PyObject *output = NULL;
+
+    errors = PyUnicode_AsUTF8(self->errors);
+    if (errors == NULL)
+        return NULL;
+    if (PyObject_GetBuffer(input, &buf, PyBUF_SIMPLE) < 0)
+        return NULL;
+    s = buf.buf;
+    len = buf.len;
+
+    switch (self->builtin) {
+    case BUILTIN_DECODER_ASCII:
+        output = PyUnicode_DecodeASCII(s, len, errors);
+        break;
+    case BUILTIN_DECODER_LATIN1:
+        output = PyUnicode_DecodeLatin1(s, len, errors);
+        break;
+    default:
+        if (self->undecoded != NULL) {
+            /* Complete the sequence held back by the previous call. */
+            Py_ssize_t n = PyBytes_GET_SIZE(self->undecoded);
+            joined = PyMem_Malloc(n + len);
+            if (joined == NULL) {
+                PyErr_NoMemory();
+                goto end;
+            }
+            memcpy(joined, PyBytes_AS_STRING(self->undecoded), n);
+            memcpy(joined + n, s, len);
+            s = joined;
+            len += n;
+        }
+        output = PyUnicode_DecodeUTF8Stateful(s, len, errors,
+                                              final ? NULL : &consumed);
+        if (output == NULL)
+            goto end;
+        Py_CLEAR(self->undecoded);
+        if (!final && consumed < len) {
+            self->undecoded = PyBytes_FromStringAndSize(s + consumed,
+                                                        len - consumed);
+            if (self->undecoded == NULL)
+                Py_CLEAR(output);
+        }
+        break;
+    }
+
+end:
+    PyMem_Free(joined);
+    PyBuffer_Release(&buf);
+    return output;
+}
+
 PyObject *
 _PyIncrementalNewlineDecoder_decode(PyObject *myself,
                                     PyObject *input, int final)
@@ -318,7 +391,10 @@ _PyIncrementalNewlineDecoder_decode(PyObject *myself,
     }
 
     /* decode input (with the eventual \r from a previous pass) */
-    if (self->decoder != Py_None) {
+    if (self->builtin != BUILTIN_DECODER_NONE) {
+        output = nldecoder_builtin_decode(self, input, final);
+    }
+    else if (self->decoder != Py_None) {
         output = PyObject_CallMethodObjArgs(self->decoder,
             _PyIO_str_decode, input, final ? Py_True : Py_False, NULL);
     }
@@ -529,7 +605,19 @@ _io_IncrementalNewlineDecoder_getstate_impl(nldecoder_object *self)
     PyObject *buffer;
     unsigned long long flag;
 
-    if (self->decoder != Py_None) {
+    if (self->builtin != BUILTIN_DECODER_NONE) {
+        if (self->undecoded != NULL) {
+            buffer = self->undecoded;
+            Py_INCREF(buffer);
+        }
+        else {
+            buffer = PyBytes_FromStringAndSize(NULL, 0);
+            if (buffer == NULL)
+                return NULL;
+        }
+        flag = 0;
+    }
+    else if (self->decoder != Py_None) {
         PyObject *state = PyObject_CallMethodNoArgs(self->decoder,
            _PyIO_str_getstate);
         if (state == NULL)
@@ -586,6 +674,20 @@ _io_IncrementalNewlineDecoder_setstate(nldecoder_object *self,
     self->pendingcr = (int) (flag & 1);
     flag >>= 1;
 
+    if (self->builtin != BUILTIN_DECODER_NONE) {
+        /* Only the UTF-8 decoder has a state of its own. */
+        Py_CLEAR(self->undecoded);
+        if (self->builtin == BUILTIN_DECODER_UTF8) {
+            buffer = PyBytes_FromObject(buffer);
+            if (buffer == NULL)
+                return NULL;
+            if (PyBytes_GET_SIZE(buffer) > 0)
+                self->undecoded = buffer;
+            else
+                Py_DECREF(buffer);
+        }
+        Py_RETURN_NONE;
+    }
     if (self->decoder != Py_None)
         return _PyObject_CallMethodId(self->decoder,
                                       &PyId_setstate, "((OK))", buffer, flag);
@@ -603,6 +705,9 @@ _io_IncrementalNewlineDecoder_reset_impl(nldecoder_object *self)
 {
     self->seennl = 0;
     self->pendingcr = 0;
+    Py_CLEAR(self->undecoded);
+    if (self->builtin != BUILTIN_DECODER_NONE)
+        Py_RETURN_NONE;
     if (self->decoder != Py_None)
         return PyObject_CallMethodNoArgs(self->decoder, _PyIO_str_reset);
     else
@@ -680,10 +785,11 @@ typedef struct
                                    // ascii unicode, bytes, or list of them.
     Py_ssize_t pending_bytes_count;
 
-    /* snapshot is either NULL, or a tuple (dec_flags, next_input) where
-     * dec_flags is the second (integer) item of the decoder state and
-     * next_input is the chunk of input bytes that comes next after the
-     * snapshot point.  We use this to reconstruct decoder states in tell().
+    /* snapshot is either NULL, or a tuple (dec_flags, dec_buffer,
+     * input_chunk) where dec_flags is the second (integer) item of the
+     * decoder state and dec_buffer + input_chunk is the chunk of input bytes
+     * that comes next after the snapshot point.  We use this to reconstruct
+     * decoder states in tell().
      */
     PyObject *snapshot;
     /* Bytes-to-characters ratio for the current chunk. Serves as input for
@@ -858,6 +964,21 @@ set_newline(textio *self, const char *newline)
     return 0;
 }
 
+/* Encodings decoded by IncrementalNewlineDecoder itself when used by
+   TextIOWrapper, bypassing the slow incremental decoding methods. */
+
+typedef struct {
+    const char *name;
+    char builtin;
+} builtindecoderentry;
+
+static const builtindecoderentry builtindecoders[] = {
+    {"ascii",       BUILTIN_DECODER_ASCII},
+    {"iso8859-1",   BUILTIN_DECODER_LATIN1},
+    {"utf-8",       BUILTIN_DECODER_UTF8},
+    {NULL, 0}
+};
+
 static int
 _textiowrapper_set_decoder(textio *self, PyObject *codec_info,
                            const char *errors)
@@ -890,6 +1011,30 @@ _textiowrapper_set_decoder(textio *self, PyObject *codec_info,
             return -1;
         Py_CLEAR(self->decoder);
         self->decoder = incrementalDecoder;
+
+        /* Let the newline decoder decode the most popular encodings itself
+           rather than through the incremental decoder's methods. */
+        if (_PyObject_LookupAttrId(codec_info, &PyId_name, &res) < 0) {
+            return -1;
+        }
+        if (res != NULL && PyUnicode_Check(res)) {
+            const builtindecoderentry *e = builtindecoders;
+            while (e->name != NULL) {
+                if (_PyUnicode_EqualToASCIIString(res, e->name)) {
+                    nldecoder_object *nl = (nldecoder_object *)self->decoder;
+                    PyObject *errors_obj = PyUnicode_FromString(errors);
+                    if (errors_obj == NULL) {
+                        Py_DECREF(res);
+                        return -1;
+                    }
+                    Py_SETREF(nl->errors, errors_obj);
+                    nl->builtin = e->builtin;
+                    break;
+                }
+                e++;
+            }
+        }
+        Py_XDECREF(res);
     }
 
     return 0;
@@ -1820,8 +1965,13 @@ textiowrapper_read_chunk(textio *self, Py_ssize_t size_hint)
         /* To prepare for tell(), we need to snapshot a point in the file
          * where the decoder's input buffer is empty.
          */
-        PyObject *state = PyObject_CallMethodNoArgs(self->decoder,
-                                                     _PyIO_str_getstate);
+        PyObject *state;
+        if (Py_IS_TYPE(self->decoder, &PyIncrementalNewlineDecoder_Type))
+            state = _io_IncrementalNewlineDecoder_getstate_impl(
+                (nldecoder_object *)self->decoder);
+        else
+            state = PyObject_CallMethodNoArgs(self->decoder,
+                                              _PyIO_str_getstate);
         if (state == NULL)
             return -1;
         /* Given this, we know there was a valid snapshot point
@@ -1895,17 +2045,13 @@ textiowrapper_read_chunk(textio *self, Py_ssize_t size_hint)
 
     if (self->telling) {
         /* At the snapshot point, len(dec_buffer) bytes before the read, the
-         * next input to be decoded is dec_buffer + input_chunk.
+         * next input to be decoded is dec_buffer + input_chunk.  tell()
+         * joins them if it needs to.
          */
-        PyObject *next_input = dec_buffer;
-        PyBytes_Concat(&next_input, input_chunk);
-        dec_buffer = NULL; /* Reference lost to PyBytes_Concat */
-        if (next_input == NULL) {
-            goto fail;
-        }
-        PyObject *snapshot = Py_BuildValue("NN", dec_flags, next_input);
+        PyObject *snapshot = Py_BuildValue("NNO", dec_flags, dec_buffer,
+                                           input_chunk);
+        dec_flags = dec_buffer = NULL;
         if (snapshot == NULL) {
-            dec_flags = NULL;
             goto fail;
         }
         Py_XSETREF(self->snapshot, snapshot);
@@ -2599,7 +2745,7 @@ _io_TextIOWrapper_seek_impl(textio *self, PyObject *cookieObj, int whence)
             goto fail;
         }
 
-        snapshot = Py_BuildValue("iN", cookie.dec_flags, input_chunk);
+        snapshot = Py_BuildValue("iyN", cookie.dec_flags, "", input_chunk);
         if (snapshot == NULL) {
             goto fail;
         }
@@ -2621,7 +2767,7 @@ _io_TextIOWrapper_seek_impl(textio *self, PyObject *cookieObj, int whence)
         self->decoded_chars_used = cookie.chars_to_skip;
     }
     else {
-        snapshot = Py_BuildValue("iy", cookie.dec_flags, "");
+        snapshot = Py_BuildValue("iyy", cookie.dec_flags, "", "");
         if (snapshot == NULL)
             goto fail;
         Py_XSETREF(self->snapshot, snapshot);
@@ -2650,7 +2796,7 @@ _io_TextIOWrapper_tell_impl(textio *self)
     PyObject *res;
     PyObject *posobj = NULL;
     cookie_type cookie = {0,0,0,0,0};
-    PyObject *next_input;
+    PyObject *snapshot_buffer, *input_chunk, *next_input = NULL;
     Py_ssize_t chars_to_skip, chars_decoded;
     Py_ssize_t skip_bytes, skip_back;
     PyObject *saved_state = NULL;
@@ -2698,12 +2844,15 @@ _io_TextIOWrapper_tell_impl(textio *self)
 
     /* Skip backward to the snapshot point (see _read_chunk). */
     assert(PyTuple_Check(self->snapshot));
-    if (!PyArg_ParseTuple(self->snapshot, "iO", &cookie.dec_flags, &next_input))
+    if (!PyArg_ParseTuple(self->snapshot, "iOO", &cookie.dec_flags,
+                          &snapshot_buffer, &input_chunk))
         goto fail;
 
-    assert (PyBytes_Check(next_input));
+    assert (PyBytes_Check(snapshot_buffer));
+    assert (PyBytes_Check(input_chunk));
 
-    cookie.start_pos -= PyBytes_GET_SIZE(next_input);
+    cookie.start_pos -= (PyBytes_GET_SIZE(snapshot_buffer) +
+                         PyBytes_GET_SIZE(input_chunk));
 
     /* How many decoded characters have been used up since the snapshot? */
     if (self->decoded_chars_used == 0)  {
@@ -2711,6 +2860,13 @@ _io_TextIOWrapper_tell_impl(textio *self)
         return textiowrapper_build_cookie(&cookie);
     }
 
+    /* The input that comes next after the snapshot point */
+    next_input = snapshot_buffer;
+    Py_INCREF(next_input);
+    PyBytes_Concat(&next_input, input_chunk);
+    if (next_input == NULL)
+        goto fail;
+
     chars_to_skip = self->decoded_chars_used;
 
     /* Decoder state will be restored at the end */
@@ -2848,6 +3004,7 @@ _io_TextIOWrapper_tell_impl(textio *self)
     }
 
 finally:
+    Py_DECREF(next_input);
     res = _PyObject_CallMethodIdOneArg(self->decoder, &PyId_setstate, saved_state);
     Py_DECREF(saved_state);
     if (res == NULL)
@@ -2859,6 +3016,7 @@ _io_TextIOWrapper_tell_impl(textio *self)
     return textiowrapper_build_cookie(&cookie);
 
 fail:
+    Py_XDECREF(next_input);
     if (saved_state) {
         PyObject *type, *value, *traceback;
         PyErr_Fetch(&type, &value, &traceback);
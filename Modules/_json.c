@@ -15,6 +15,7 @@
 typedef struct {
     PyObject *PyScannerType;
     PyObject *PyEncoderType;
+    PyObject *PySplitterType;
 } _jsonmodulestate;
 
 static inline _jsonmodulestate*
@@ -101,6 +102,11 @@ static int
 encoder_listencode_obj(PyEncoderObject *s, _PyAccu *acc, PyObject *obj, Py_ssize_t indent_level);
 static int
 encoder_listencode_dict(PyEncoderObject *s, _PyAccu *acc, PyObject *dct, Py_ssize_t indent_level);
+typedef struct _JSONWriter _JSONWriter;
+static int
+encoder_write_list(PyEncoderObject *s, _JSONWriter *w, PyObject *seq);
+static int
+encoder_write_dict(PyEncoderObject *s, _JSONWriter *w, PyObject *dct);
 static PyObject *
 _encoded_const(PyObject *obj);
 static void
@@ -1232,6 +1238,352 @@ static PyType_Spec PyScannerType_spec = {
     .slots = PyScannerType_slots,
 };
 
+/* Splitter objects: frame a UTF-8 byte stream into JSON records.
+ *
+ * A splitter is fed chunks of bytes and returns, as str, every top-level
+ * value (or every element of a top-level array) that the chunks complete.
+ * It only tracks nesting, strings and escapes; each record is then decoded
+ * by the regular scanner.  Only the bytes of the record in progress are
+ * kept between calls, so memory stays bounded by the largest record. */
+
+enum {
+    SPLIT_ARRAY_START,      /* array mode: expecting '[' */
+    SPLIT_ARRAY_FIRST,      /* array mode: expecting a value or ']' */
+    SPLIT_ARRAY_NEXT,       /* array mode: expecting ',' or ']' */
+    SPLIT_ARRAY_VALUE,      /* array mode: expecting a value after ',' */
+    SPLIT_ARRAY_END,        /* array mode: only whitespace may follow */
+    SPLIT_VALUES            /* values mode: expecting a value */
+};
+
+typedef struct {
+    PyObject_HEAD
+    char *buf;              /* unconsumed input */
+    Py_ssize_t len;
+    Py_ssize_t allocated;
+    Py_ssize_t pos;         /* next byte of buf to examine */
+    Py_ssize_t start;       /* start of the current record, or -1 */
+    Py_ssize_t depth;       /* nesting inside the current record */
+    int state;
+    char in_string;
+    char escape;
+    char scalar;            /* the current record is a number or literal */
+    char started;           /* a possible BOM has been skipped */
+    char array;
+} PySplitterObject;
+
+#define IS_JSON_WS(c) ((c) == ' ' || (c) == '\t' || (c) == '\n' || (c) == '\r')
+
+static PyObject *
+splitter_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+    static char *kwlist[] = {"array", NULL};
+    PySplitterObject *s;
+    int array = 0;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "|$p:make_splitter", kwlist,
+                                     &array)) {
+        return NULL;
+    }
+
+    s = (PySplitterObject *)type->tp_alloc(type, 0);
+    if (s == NULL) {
+        return NULL;
+    }
+    s->buf = NULL;
+    s->len = s->allocated = s->pos = 0;
+    s->start = -1;
+    s->depth = 0;
+    s->in_string = s->escape = s->scalar = s->started = 0;
+    s->array = (char)array;
+    s->state = array ? SPLIT_ARRAY_START : SPLIT_VALUES;
+    return (PyObject *)s;
+}
+
+static void
+splitter_dealloc(PySplitterObject *self)
+{
+    PyTypeObject *tp = Py_TYPE(self);
+    PyMem_Free(self->buf);
+    tp->tp_free(self);
+    Py_DECREF(tp);
+}
+
+static void
+splitter_error(PySplitterObject *self, const char *msg, Py_ssize_t end)
+{
+    /* Report the error against the unconsumed input up to 'end'. */
+    PyObject *doc = PyUnicode_DecodeUTF8(self->buf, end, "replace");
+    if (doc == NULL) {
+        return;
+    }
+    raise_errmsg(msg, doc, PyUnicode_GET_LENGTH(doc));
+    Py_DECREF(doc);
+}
+
+static int
+splitter_emit(PySplitterObject *self, PyObject *result, Py_ssize_t end)
+{
+    PyObject *record;
+    int rc;
+
+    record = PyUnicode_DecodeUTF8(self->buf + self->start,
+                                  end - self->start, "surrogatepass");
+    if (record == NULL) {
+        return -1;
+    }
+    rc = PyList_Append(result, record);
+    Py_DECREF(record);
+    self->start = -1;
+    self->scalar = 0;
+    if (self->array) {
+        self->state = SPLIT_ARRAY_NEXT;
+    }
+    return rc;
+}
+
+static int
+splitter_scan(PySplitterObject *self, PyObject *result)
+{
+    const char *buf = self->buf;
+    Py_ssize_t i;
+
+    for (i = self->pos; i < self->len; i++) {
+        char c = buf[i];
+
+        if (self->start >= 0) {
+            if (self->in_string) {
+                if (self->escape) {
+                    self->escape = 0;
+                }
+                else if (c == '\\') {
+                    self->escape = 1;
+                }
+                else if (c == '"') {
+                    self->in_string = 0;
+                    if (self->depth == 0 && splitter_emit(self, result, i + 1) < 0) {
+                        return -1;
+                    }
+                }
+                continue;
+            }
+            if (!self->scalar) {
+                if (c == '"') {
+                    self->in_string = 1;
+                }
+                else if (c == '[' || c == '{') {
+                    self->depth++;
+                }
+                else if ((c == ']' || c == '}') && --self->depth == 0) {
+                    if (splitter_emit(self, result, i + 1) < 0) {
+                        return -1;
+                    }
+                }
+                continue;
+            }
+            /* A number or literal ends at the first byte that cannot be
+               part of it; that byte is examined again below. */
+            if (!(IS_JSON_WS(c) || c == ',' || c == ']' || c == '}' ||
+                  c == '[' || c == '{' || c == '"')) {
+                continue;
+            }
+            if (splitter_emit(self, result, i) < 0) {
+                return -1;
+            }
+        }
+
+        if (IS_JSON_WS(c)) {
+            continue;
+        }
+        switch (self->state) {
+            case SPLIT_ARRAY_START:
+                if (c != '[') {
+                    splitter_error(self, "Expecting '['", i);
+                    return -1;
+                }
+                self->state = SPLIT_ARRAY_FIRST;
+                continue;
+            case SPLIT_ARRAY_FIRST:
+                if (c == ']') {
+                    self->state = SPLIT_ARRAY_END;
+                    continue;
+                }
+                break;
+            case SPLIT_ARRAY_NEXT:
+                if (c == ',') {
+                    self->state = SPLIT_ARRAY_VALUE;
+                }
+                else if (c == ']') {
+                    self->state = SPLIT_ARRAY_END;
+                }
+                else {
+                    splitter_error(self, "Expecting ',' delimiter", i);
+                    return -1;
+                }
+                continue;
+            case SPLIT_ARRAY_VALUE:
+                if (c == ']') {
+                    splitter_error(self, "Expecting value", i);
+                    return -1;
+                }
+                break;
+            case SPLIT_ARRAY_END:
+                splitter_error(self, "Extra data", i);
+                return -1;
+            default:
+                break;
+        }
+
+        /* Start a new record. */
+        self->start = i;
+        if (c == '"') {
+            self->in_string = 1;
+        }
+        else if (c == '[' || c == '{') {
+            self->depth = 1;
+        }
+        else if (c == ']' || c == '}' || c == ',') {
+            splitter_error(self, "Expecting value", i);
+            return -1;
+        }
+        else {
+            self->scalar = 1;
+        }
+    }
+    self->pos = i;
+    return 0;
+}
+
+/* Drop the bytes that no longer belong to any record. */
+static void
+splitter_compact(PySplitterObject *self)
+{
+    Py_ssize_t keep = self->start >= 0 ? self->start : self->pos;
+
+    if (keep > 0) {
+        memmove(self->buf, self->buf + keep, self->len - keep);
+        self->len -= keep;
+        self->pos -= keep;
+        if (self->start >= 0) {
+            self->start = 0;
+        }
+    }
+}
+
+static PyObject *
+splitter_feed(PySplitterObject *self, PyObject *arg)
+{
+    Py_buffer view;
+    PyObject *result;
+
+    if (PyObject_GetBuffer(arg, &view, PyBUF_SIMPLE) < 0) {
+        return NULL;
+    }
+    if (view.len > PY_SSIZE_T_MAX - self->len) {
+        PyBuffer_Release(&view);
+        return PyErr_NoMemory();
+    }
+    if (self->len + view.len > self->allocated) {
+        /* Over-allocate, so that a long record fed in small chunks is
+           copied a bounded number of times. */
+        Py_ssize_t newsize = self->len + view.len;
+        char *newbuf;
+        if (newsize <= PY_SSIZE_T_MAX - (newsize >> 1)) {
+            newsize += newsize >> 1;
+        }
+        newbuf = PyMem_Realloc(self->buf, newsize);
+        if (newbuf == NULL) {
+            PyBuffer_Release(&view);
+            return PyErr_NoMemory();
+        }
+        self->buf = newbuf;
+        self->allocated = newsize;
+    }
+    memcpy(self->buf + self->len, view.buf, view.len);
+    self->len += view.len;
+    PyBuffer_Release(&view);
+
+    result = PyList_New(0);
+    if (result == NULL) {
+        return NULL;
+    }
+    if (!self->started) {
+        /* Skip a UTF-8 byte order mark, like json.loads() does. */
+        static const char bom[] = "\xef\xbb\xbf";
+        Py_ssize_t n = Py_MIN(self->len, 3);
+        if (memcmp(self->buf, bom, n) == 0) {
+            if (n < 3) {
+                return result;
+            }
+            self->pos = 3;
+        }
+        self->started = 1;
+    }
+    if (splitter_scan(self, result) < 0) {
+        Py_DECREF(result);
+        return NULL;
+    }
+    splitter_compact(self);
+    return result;
+}
+
+static PyObject *
+splitter_close(PySplitterObject *self, PyObject *Py_UNUSED(ignored))
+{
+    PyObject *result = PyList_New(0);
+    if (result == NULL) {
+        return NULL;
+    }
+    if (self->start >= 0) {
+        if (!self->scalar) {
+            splitter_error(self, self->in_string ? "Unterminated string"
+                                                 : "Unterminated value",
+                           self->len);
+            goto error;
+        }
+        if (splitter_emit(self, result, self->len) < 0) {
+            goto error;
+        }
+    }
+    if (self->array && self->state != SPLIT_ARRAY_END) {
+        splitter_error(self, self->state == SPLIT_ARRAY_START
+                                 ? "Expecting value" : "Unterminated array",
+                       self->len);
+        goto error;
+    }
+    self->len = self->pos = 0;
+    return result;
+
+error:
+    Py_DECREF(result);
+    return NULL;
+}
+
+static PyMethodDef splitter_methods[] = {
+    {"feed", (PyCFunction)splitter_feed, METH_O,
+     PyDoc_STR("feed(data) -> list of the records completed by data")},
+    {"close", (PyCFunction)splitter_close, METH_NOARGS,
+     PyDoc_STR("close() -> list of the remaining records")},
+    {NULL, NULL, 0, NULL}
+};
+
+PyDoc_STRVAR(splitter_doc, "JSON record splitter object");
+
+static PyType_Slot PySplitterType_slots[] = {
+    {Py_tp_doc, (void *)splitter_doc},
+    {Py_tp_dealloc, splitter_dealloc},
+    {Py_tp_methods, splitter_methods},
+    {Py_tp_new, splitter_new},
+    {0, 0}
+};
+
+static PyType_Spec PySplitterType_spec = {
+    .name = "_json.Splitter",
+    .basicsize = sizeof(PySplitterObject),
+    .itemsize = 0,
+    .flags = Py_TPFLAGS_DEFAULT,
+    .slots = PySplitterType_slots,
+};
+
 static PyObject *
 encoder_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 {
@@ -1733,6 +2085,584 @@ encoder_listencode_list(PyEncoderObject *s, _PyAccu *acc,
     return -1;
 }
 
+/* Direct UTF-8 output: encode_bytes() writes the JSON text into a bytes
+ * buffer instead of accumulating str fragments, optionally handing it to a
+ * write() callable in chunks of about JSON_WRITE_CHUNK bytes. */
+
+#define JSON_WRITE_CHUNK 65536
+/* Maximum number of dict keys whose encoded form is cached per call. */
+#define JSON_KEY_CACHE_SIZE 1024
+
+struct _JSONWriter {
+    PyObject *bytes;            /* output buffer, NULL until first use */
+    Py_ssize_t len;
+    Py_ssize_t flushed;         /* number of bytes passed to write() */
+    PyObject *write;            /* borrowed; NULL to build a single bytes */
+    PyObject *key_cache;        /* str key -> bytes of encoded key and ':' */
+    const char *key_separator;
+    Py_ssize_t key_separator_len;
+    const char *item_separator;
+    Py_ssize_t item_separator_len;
+};
+
+static int
+_jsonwriter_flush(_JSONWriter *w)
+{
+    PyObject *chunk, *res;
+
+    if (w->len == 0) {
+        return 0;
+    }
+    chunk = PyBytes_FromStringAndSize(PyBytes_AS_STRING(w->bytes), w->len);
+    if (chunk == NULL) {
+        return -1;
+    }
+    w->flushed += w->len;
+    w->len = 0;
+    res = PyObject_CallOneArg(w->write, chunk);
+    Py_DECREF(chunk);
+    if (res == NULL) {
+        return -1;
+    }
+    Py_DECREF(res);
+    return 0;
+}
+
+/* Make room for n more bytes and return a pointer to them. */
+static char *
+_jsonwriter_reserve(_JSONWriter *w, Py_ssize_t n)
+{
+    Py_ssize_t size;
+
+    if (w->write != NULL && w->len > 0 && w->len + n > JSON_WRITE_CHUNK) {
+        if (_jsonwriter_flush(w) < 0) {
+            return NULL;
+        }
+    }
+    if (w->bytes == NULL) {
+        size = Py_MAX(n, 256);
+        w->bytes = PyBytes_FromStringAndSize(NULL, size);
+        if (w->bytes == NULL) {
+            return NULL;
+        }
+    }
+    else if (w->len + n > (size = PyBytes_GET_SIZE(w->bytes))) {
+        if (n > PY_SSIZE_T_MAX - w->len) {
+            PyErr_NoMemory();
+            return NULL;
+        }
+        if (size <= PY_SSIZE_T_MAX / 2) {
+            size = Py_MAX(size * 2, w->len + n);
+        }
+        else {
+            size = w->len + n;
+        }
+        if (_PyBytes_Resize(&w->bytes, size) < 0) {
+            return NULL;
+        }
+    }
+    return PyBytes_AS_STRING(w->bytes) + w->len;
+}
+
+static int
+_jsonwriter_write(_JSONWriter *w, const char *data, Py_ssize_t n)
+{
+    char *p = _jsonwriter_reserve(w, n);
+    if (p == NULL) {
+        return -1;
+    }
+    memcpy(p, data, n);
+    w->len += n;
+    return 0;
+}
+
+static int
+_jsonwriter_write_str(_JSONWriter *w, PyObject *str)
+{
+    Py_ssize_t n;
+    const char *data = PyUnicode_AsUTF8AndSize(str, &n);
+    if (data == NULL) {
+        return -1;
+    }
+    return _jsonwriter_write(w, data, n);
+}
+
+static int
+_jsonwriter_steal_str(_JSONWriter *w, PyObject *stolen)
+{
+    int rval;
+    if (stolen == NULL) {
+        return -1;
+    }
+    rval = _jsonwriter_write_str(w, stolen);
+    Py_DECREF(stolen);
+    return rval;
+}
+
+/* Bit tricks to test eight bytes at once: HAS_ZERO_BYTE(v) is nonzero if
+   any byte of v is zero, HAS_BYTE_LESS(v, n) if any byte is below n. */
+#define ONES_64 UINT64_C(0x0101010101010101)
+#define HIGHS_64 UINT64_C(0x8080808080808080)
+#define HAS_ZERO_BYTE(v) (((v) - ONES_64) & ~(v) & HIGHS_64)
+#define HAS_BYTE_LESS(v, n) (((v) - ONES_64 * (n)) & ~(v) & HIGHS_64)
+
+static inline int
+_json_needs_escape(unsigned char c, int ascii_only)
+{
+    return c < ' ' || c == '"' || c == '\\' || (ascii_only && c == 0x7f);
+}
+
+/* Write the UTF-8 string data as a quoted JSON string.  Runs that need no
+   escaping, which is usually the whole string, are found eight bytes at a
+   time and copied with memcpy. */
+static int
+_jsonwriter_write_escaped(_JSONWriter *w, const char *data, Py_ssize_t n,
+                          int ascii_only)
+{
+    const unsigned char *s = (const unsigned char *)data;
+    Py_ssize_t i = 0, start = 0;
+
+    if (_jsonwriter_write(w, "\"", 1) < 0) {
+        return -1;
+    }
+    while (i < n) {
+        unsigned char c;
+        char esc[6];
+        Py_ssize_t esclen;
+
+        if (i + 8 <= n) {
+            uint64_t v;
+            memcpy(&v, s + i, 8);
+            if (!(HAS_BYTE_LESS(v, 0x20) ||
+                  HAS_ZERO_BYTE(v ^ (ONES_64 * '"')) ||
+                  HAS_ZERO_BYTE(v ^ (ONES_64 * '\\')) ||
+                  (ascii_only && HAS_ZERO_BYTE(v ^ (ONES_64 * 0x7f))))) {
+                i += 8;
+                continue;
+            }
+        }
+        if (!_json_needs_escape(s[i], ascii_only)) {
+            i++;
+            continue;
+        }
+        if (i > start && _jsonwriter_write(w, data + start, i - start) < 0) {
+            return -1;
+        }
+        c = s[i++];
+        start = i;
+        esc[0] = '\\';
+        esclen = 2;
+        switch (c) {
+            case '\\': esc[1] = '\\'; break;
+            case '"': esc[1] = '"'; break;
+            case '\b': esc[1] = 'b'; break;
+            case '\f': esc[1] = 'f'; break;
+            case '\n': esc[1] = 'n'; break;
+            case '\r': esc[1] = 'r'; break;
+            case '\t': esc[1] = 't'; break;
+            default:
+                esc[1] = 'u';
+                esc[2] = '0';
+                esc[3] = '0';
+                esc[4] = Py_hexdigits[(c >> 4) & 0xf];
+                esc[5] = Py_hexdigits[c & 0xf];
+                esclen = 6;
+        }
+        if (_jsonwriter_write(w, esc, esclen) < 0) {
+            return -1;
+        }
+    }
+    if (n > start && _jsonwriter_write(w, data + start, n - start) < 0) {
+        return -1;
+    }
+    return _jsonwriter_write(w, "\"", 1);
+}
+
+#undef ONES_64
+#undef HIGHS_64
+#undef HAS_ZERO_BYTE
+#undef HAS_BYTE_LESS
+
+static int
+encoder_write_string(PyEncoderObject *s, _JSONWriter *w, PyObject *obj)
+{
+    /* Write the JSON representation of a string */
+    const char *data;
+    Py_ssize_t n;
+
+    if (s->fast_encode == NULL) {
+        return _jsonwriter_steal_str(w, encoder_encode_string(s, obj));
+    }
+    if (PyUnicode_READY(obj) == -1) {
+        return -1;
+    }
+    if (s->fast_encode == (PyCFunction)py_encode_basestring_ascii &&
+            !PyUnicode_IS_ASCII(obj)) {
+        return _jsonwriter_steal_str(w, ascii_escape_unicode(obj));
+    }
+    data = PyUnicode_AsUTF8AndSize(obj, &n);
+    if (data == NULL) {
+        return -1;
+    }
+    return _jsonwriter_write_escaped(
+        w, data, n, s->fast_encode == (PyCFunction)py_encode_basestring_ascii);
+}
+
+static int
+encoder_write_key(PyEncoderObject *s, _JSONWriter *w, PyObject *key,
+                  PyObject *kstr)
+{
+    /* Write an encoded dict key followed by the key separator.  The output
+       for str keys is cached, as the same keys recur in most documents. */
+    PyObject *cached;
+    Py_ssize_t start, flushed;
+
+    if (w->key_cache != NULL && PyUnicode_CheckExact(key)) {
+        cached = PyDict_GetItemWithError(w->key_cache, key);
+        if (cached != NULL) {
+            return _jsonwriter_write(w, PyBytes_AS_STRING(cached),
+                                     PyBytes_GET_SIZE(cached));
+        }
+        if (PyErr_Occurred()) {
+            return -1;
+        }
+    }
+    start = w->len;
+    flushed = w->flushed;
+    if (encoder_write_string(s, w, kstr) < 0 ||
+        _jsonwriter_write(w, w->key_separator, w->key_separator_len) < 0) {
+        return -1;
+    }
+    /* Only cache a key that was not split by a flush. */
+    if (w->key_cache != NULL && PyUnicode_CheckExact(key) &&
+            w->flushed == flushed &&
+            PyDict_GET_SIZE(w->key_cache) < JSON_KEY_CACHE_SIZE) {
+        int rval;
+        cached = PyBytes_FromStringAndSize(PyBytes_AS_STRING(w->bytes) + start,
+                                           w->len - start);
+        if (cached == NULL) {
+            return -1;
+        }
+        rval = PyDict_SetItem(w->key_cache, key, cached);
+        Py_DECREF(cached);
+        return rval;
+    }
+    return 0;
+}
+
+static int
+encoder_write_obj(PyEncoderObject *s, _JSONWriter *w, PyObject *obj)
+{
+    /* Write Python object obj as a JSON term */
+    PyObject *newobj;
+    int rv;
+
+    if (obj == Py_None) {
+        return _jsonwriter_write(w, "null", 4);
+    }
+    else if (obj == Py_True) {
+        return _jsonwriter_write(w, "true", 4);
+    }
+    else if (obj == Py_False) {
+        return _jsonwriter_write(w, "false", 5);
+    }
+    else if (PyUnicode_Check(obj)) {
+        return encoder_write_string(s, w, obj);
+    }
+    else if (PyLong_Check(obj)) {
+        return _jsonwriter_steal_str(w, PyLong_Type.tp_repr(obj));
+    }
+    else if (PyFloat_Check(obj)) {
+        return _jsonwriter_steal_str(w, encoder_encode_float(s, obj));
+    }
+    else if (PyList_Check(obj) || PyTuple_Check(obj)) {
+        if (Py_EnterRecursiveCall(" while encoding a JSON object"))
+            return -1;
+        rv = encoder_write_list(s, w, obj);
+        Py_LeaveRecursiveCall();
+        return rv;
+    }
+    else if (PyDict_Check(obj)) {
+        if (Py_EnterRecursiveCall(" while encoding a JSON object"))
+            return -1;
+        rv = encoder_write_dict(s, w, obj);
+        Py_LeaveRecursiveCall();
+        return rv;
+    }
+    else {
+        PyObject *ident = NULL;
+        if (s->markers != Py_None) {
+            int has_key;
+            ident = PyLong_FromVoidPtr(obj);
+            if (ident == NULL)
+                return -1;
+            has_key = PyDict_Contains(s->markers, ident);
+            if (has_key) {
+                if (has_key != -1)
+                    PyErr_SetString(PyExc_ValueError, "Circular reference detected");
+                Py_DECREF(ident);
+                return -1;
+            }
+            if (PyDict_SetItem(s->markers, ident, obj)) {
+                Py_DECREF(ident);
+                return -1;
+            }
+        }
+        newobj = PyObject_CallOneArg(s->defaultfn, obj);
+        if (newobj == NULL) {
+            Py_XDECREF(ident);
+            return -1;
+        }
+
+        if (Py_EnterRecursiveCall(" while encoding a JSON object")) {
+            Py_DECREF(newobj);
+            Py_XDECREF(ident);
+            return -1;
+        }
+        rv = encoder_write_obj(s, w, newobj);
+        Py_LeaveRecursiveCall();
+
+        Py_DECREF(newobj);
+        if (rv) {
+            Py_XDECREF(ident);
+            return -1;
+        }
+        if (ident != NULL) {
+            if (PyDict_DelItem(s->markers, ident)) {
+                Py_XDECREF(ident);
+                return -1;
+            }
+            Py_XDECREF(ident);
+        }
+        return rv;
+    }
+}
+
+static int
+encoder_write_dict(PyEncoderObject *s, _JSONWriter *w, PyObject *dct)
+{
+    /* Write Python dict dct as a JSON term */
+    PyObject *kstr = NULL;
+    PyObject *ident = NULL;
+    PyObject *items = NULL;
+    Py_ssize_t i, idx;
+
+    if (PyDict_GET_SIZE(dct) == 0)  /* Fast path */
+        return _jsonwriter_write(w, "{}", 2);
+
+    if (s->markers != Py_None) {
+        int has_key;
+        ident = PyLong_FromVoidPtr(dct);
+        if (ident == NULL)
+            goto bail;
+        has_key = PyDict_Contains(s->markers, ident);
+        if (has_key) {
+            if (has_key != -1)
+                PyErr_SetString(PyExc_ValueError, "Circular reference detected");
+            goto bail;
+        }
+        if (PyDict_SetItem(s->markers, ident, dct)) {
+            goto bail;
+        }
+    }
+
+    if (_jsonwriter_write(w, "{", 1))
+        goto bail;
+
+    items = PyMapping_Items(dct);
+    if (items == NULL)
+        goto bail;
+    if (s->sort_keys && PyList_Sort(items) < 0)
+        goto bail;
+    idx = 0;
+    for (i = 0; i < PyList_GET_SIZE(items); i++) {
+        PyObject *item = PyList_GET_ITEM(items, i);
+        PyObject *key, *value;
+        if (!PyTuple_Check(item) || PyTuple_GET_SIZE(item) != 2) {
+            PyErr_SetString(PyExc_ValueError, "items must return 2-tuples");
+            goto bail;
+        }
+        key = PyTuple_GET_ITEM(item, 0);
+        if (PyUnicode_Check(key)) {
+            Py_INCREF(key);
+            kstr = key;
+        }
+        else if (PyFloat_Check(key)) {
+            kstr = encoder_encode_float(s, key);
+            if (kstr == NULL)
+                goto bail;
+        }
+        else if (key == Py_True || key == Py_False || key == Py_None) {
+                        /* This must come before the PyLong_Check because
+                           True and False are also 1 and 0.*/
+            kstr = _encoded_const(key);
+            if (kstr == NULL)
+                goto bail;
+        }
+        else if (PyLong_Check(key)) {
+            kstr = PyLong_Type.tp_repr(key);
+            if (kstr == NULL) {
+                goto bail;
+            }
+        }
+        else if (s->skipkeys) {
+            continue;
+        }
+        else {
+            PyErr_Format(PyExc_TypeError,
+                         "keys must be str, int, float, bool or None, "
+                         "not %.100s", Py_TYPE(key)->tp_name);
+            goto bail;
+        }
+
+        if (idx) {
+            if (_jsonwriter_write(w, w->item_separator, w->item_separator_len))
+                goto bail;
+        }
+        if (encoder_write_key(s, w, key, kstr))
+            goto bail;
+        Py_CLEAR(kstr);
+
+        value = PyTuple_GET_ITEM(item, 1);
+        if (encoder_write_obj(s, w, value))
+            goto bail;
+        idx += 1;
+    }
+    Py_CLEAR(items);
+
+    if (ident != NULL) {
+        if (PyDict_DelItem(s->markers, ident))
+            goto bail;
+        Py_CLEAR(ident);
+    }
+    if (_jsonwriter_write(w, "}", 1))
+        goto bail;
+    return 0;
+
+bail:
+    Py_XDECREF(items);
+    Py_XDECREF(kstr);
+    Py_XDECREF(ident);
+    return -1;
+}
+
+static int
+encoder_write_list(PyEncoderObject *s, _JSONWriter *w, PyObject *seq)
+{
+    /* Write Python list seq as a JSON term */
+    PyObject *ident = NULL;
+    PyObject *s_fast = NULL;
+    Py_ssize_t i;
+
+    s_fast = PySequence_Fast(seq, "_iterencode_list needs a sequence");
+    if (s_fast == NULL)
+        return -1;
+    if (PySequence_Fast_GET_SIZE(s_fast) == 0) {
+        Py_DECREF(s_fast);
+        return _jsonwriter_write(w, "[]", 2);
+    }
+
+    if (s->markers != Py_None) {
+        int has_key;
+        ident = PyLong_FromVoidPtr(seq);
+        if (ident == NULL)
+            goto bail;
+        has_key = PyDict_Contains(s->markers, ident);
+        if (has_key) {
+            if (has_key != -1)
+                PyErr_SetString(PyExc_ValueError, "Circular reference detected");
+            goto bail;
+        }
+        if (PyDict_SetItem(s->markers, ident, seq)) {
+            goto bail;
+        }
+    }
+
+    if (_jsonwriter_write(w, "[", 1))
+        goto bail;
+    for (i = 0; i < PySequence_Fast_GET_SIZE(s_fast); i++) {
+        PyObject *obj = PySequence_Fast_GET_ITEM(s_fast, i);
+        if (i) {
+            if (_jsonwriter_write(w, w->item_separator, w->item_separator_len))
+                goto bail;
+        }
+        if (encoder_write_obj(s, w, obj))
+            goto bail;
+    }
+    if (ident != NULL) {
+        if (PyDict_DelItem(s->markers, ident))
+            goto bail;
+        Py_CLEAR(ident);
+    }
+    if (_jsonwriter_write(w, "]", 1))
+        goto bail;
+    Py_DECREF(s_fast);
+    return 0;
+
+bail:
+    Py_XDECREF(ident);
+    Py_DECREF(s_fast);
+    return -1;
+}
+
+static PyObject *
+encoder_encode_bytes(PyEncoderObject *self, PyObject *args, PyObject *kwds)
+{
+    static char *kwlist[] = {"obj", "write", NULL};
+    PyObject *obj, *write = Py_None;
+    _JSONWriter w = {NULL};
+    PyObject *result = NULL;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O|O:encode_bytes", kwlist,
+                                     &obj, &write))
+        return NULL;
+    if (write != Py_None) {
+        w.write = write;
+    }
+    w.key_separator = PyUnicode_AsUTF8AndSize(self->key_separator,
+                                              &w.key_separator_len);
+    if (w.key_separator == NULL)
+        return NULL;
+    w.item_separator = PyUnicode_AsUTF8AndSize(self->item_separator,
+                                               &w.item_separator_len);
+    if (w.item_separator == NULL)
+        return NULL;
+    if (self->fast_encode != NULL) {
+        w.key_cache = PyDict_New();
+        if (w.key_cache == NULL)
+            return NULL;
+    }
+
+    if (encoder_write_obj(self, &w, obj) < 0)
+        goto done;
+    if (w.write != NULL) {
+        if (_jsonwriter_flush(&w) < 0)
+            goto done;
+        result = Py_NewRef(Py_None);
+    }
+    else if (w.bytes == NULL) {
+        result = PyBytes_FromStringAndSize(NULL, 0);
+    }
+    else if (_PyBytes_Resize(&w.bytes, w.len) == 0) {
+        result = w.bytes;
+        w.bytes = NULL;
+    }
+
+done:
+    Py_XDECREF(w.bytes);
+    Py_XDECREF(w.key_cache);
+    return result;
+}
+
+static PyMethodDef encoder_methods[] = {
+    {"encode_bytes", (PyCFunction)(void(*)(void))encoder_encode_bytes,
+     METH_VARARGS | METH_KEYWORDS,
+     PyDoc_STR("encode_bytes(obj, write=None) -> bytes or None\n\n"
+               "Encode obj as UTF-8 JSON text.  If write is given, call it\n"
+               "with successive chunks of the output and return None.")},
+    {NULL, NULL, 0, NULL}
+};
+
 static void
 encoder_dealloc(PyObject *self)
 {
@@ -1779,6 +2709,7 @@ static PyType_Slot PyEncoderType_slots[] = {
     {Py_tp_traverse, encoder_traverse},
     {Py_tp_clear, encoder_clear},
     {Py_tp_members, encoder_members},
+    {Py_tp_methods, encoder_methods},
     {Py_tp_new, encoder_new},
     {0, 0}
 };
@@ -1835,6 +2766,16 @@ _json_exec(PyObject *module)
         return -1;
     }
 
+    state->PySplitterType = PyType_FromSpec(&PySplitterType_spec);
+    if (state->PySplitterType == NULL) {
+        return -1;
+    }
+    Py_INCREF(state->PySplitterType);
+    if (PyModule_AddObject(module, "make_splitter", state->PySplitterType) < 0) {
+        Py_DECREF(state->PySplitterType);
+        return -1;
+    }
+
     return 0;
 }
 
@@ -1844,6 +2785,7 @@ _jsonmodule_traverse(PyObject *module, visitproc visit, void *arg)
     _jsonmodulestate *state = get_json_state(module);
     Py_VISIT(state->PyScannerType);
     Py_VISIT(state->PyEncoderType);
+    Py_VISIT(state->PySplitterType);
     return 0;
 }
 
@@ -1853,6 +2795,7 @@ _jsonmodule_clear(PyObject *module)
     _jsonmodulestate *state = get_json_state(module);
     Py_CLEAR(state->PyScannerType);
     Py_CLEAR(state->PyEncoderType);
+    Py_CLEAR(state->PySplitterType);
     return 0;
 }
 
@@ -110,7 +110,12 @@ enum opcode {
     /* Protocol 5 */
     BYTEARRAY8       = '\x96',
     NEXT_BUFFER      = '\x97',
-    READONLY_BUFFER  = '\x98'
+    READONLY_BUFFER  = '\x98',
+
+    /* Packed lists, protocol 5 extension */
+    PACKED_INT64     = '\x99',
+    PACKED_FLOAT64   = '\x9a',
+    PACKED_LATIN1    = '\x9b'
 };
 
 enum {
@@ -652,6 +657,8 @@ typedef struct PicklerObject {
                                    the name of globals for Python 2.x. */
     PyObject *fast_memo;
     PyObject *buffer_callback;  /* Callback for out-of-band buffers, or NULL */
+    int packed;                 /* Pickle homogeneous lists of scalars with
+                                   the packed opcodes, proto >= 5 */
 } PicklerObject;
 
 typedef struct UnpicklerObject {
@@ -694,6 +701,7 @@ typedef struct UnpicklerObject {
     int proto;                  /* Protocol of the pickle loaded. */
     int fix_imports;            /* Indicate whether Unpickler should fix
                                    the name of globals pickled by Python 2.x. */
+    int use_memo;               /* If false, the PUT opcodes are ignored. */
 } UnpicklerObject;
 
 typedef struct {
@@ -1114,6 +1122,7 @@ _Pickler_New(void)
     self->pers_func = NULL;
     self->dispatch_table = NULL;
     self->buffer_callback = NULL;
+    self->packed = 0;
     self->write = NULL;
     self->proto = 0;
     self->bin = 0;
@@ -1203,6 +1212,17 @@ _Pickler_SetBufferCallback(PicklerObject *self, PyObject *buffer_callback)
     return 0;
 }
 
+static int
+_Pickler_SetPacked(PicklerObject *self, int packed)
+{
+    if (packed && self->proto < 5) {
+        PyErr_SetString(PyExc_ValueError, "packed needs protocol >= 5");
+        return -1;
+    }
+    self->packed = packed;
+    return 0;
+}
+
 /* Returns the size of the input on success, -1 on failure. This takes its
    own reference to `input`. */
 static Py_ssize_t
@@ -1613,6 +1633,7 @@ _Unpickler_New(void)
     self->marks_size = 0;
     self->proto = 0;
     self->fix_imports = 0;
+    self->use_memo = 1;
     memset(&self->buffer, 0, sizeof(Py_buffer));
     self->memo_size = 32;
     self->memo_len = 0;
@@ -1647,10 +1668,18 @@ _Unpickler_SetInputStream(UnpicklerObject *self, PyObject *file)
     }
     (void)_PyObject_LookupAttrId(file, &PyId_read, &self->read);
     (void)_PyObject_LookupAttrId(file, &PyId_readline, &self->readline);
+    if (!self->read && !PyErr_Occurred() && PyObject_CheckBuffer(file)) {
+        /* Unpickle directly from the memory of a bytes-like object. */
+        Py_CLEAR(self->readinto);
+        Py_CLEAR(self->readline);
+        Py_CLEAR(self->peek);
+        return _Unpickler_SetStringInput(self, file) < 0 ? -1 : 0;
+    }
     if (!self->readline || !self->read) {
         if (!PyErr_Occurred()) {
             PyErr_SetString(PyExc_TypeError,
-                            "file must have 'read' and 'readline' attributes");
+                            "file must have 'read' and 'readline' attributes "
+                            "or support the buffer protocol");
         }
         Py_CLEAR(self->read);
         Py_CLEAR(self->readinto);
@@ -3034,6 +3063,122 @@ batch_list_exact(PicklerObject *self, PyObject *obj)
     return 0;
 }
 
+/* Minimum length of a list pickled with the packed opcodes. */
+#define PACKED_MIN_LEN 16
+
+static void
+_write_le64(unsigned char *p, uint64_t x)
+{
+    int i;
+    for (i = 0; i < 8; i++) {
+        p[i] = (unsigned char)(x >> (8 * i));
+    }
+}
+
+/* Pickle an exact list whose items are all exact ints that fit in 64 bits,
+   all floats, or all one-byte strings shorter than 256 characters, as a
+   single PACKED_INT64, PACKED_FLOAT64 or PACKED_LATIN1 opcode.  Returns 1
+   if the list was saved, 0 if it does not qualify and -1 on error. */
+static int
+save_packed_list(PicklerObject *self, PyObject *obj)
+{
+    Py_ssize_t i, n = PyList_GET_SIZE(obj);
+    Py_ssize_t size;
+    PyTypeObject *type;
+    unsigned char *data, *p;
+    char header[9];
+    int status;
+
+    if (n < PACKED_MIN_LEN) {
+        return 0;
+    }
+    type = Py_TYPE(PyList_GET_ITEM(obj, 0));
+    if (type == &PyLong_Type || type == &PyFloat_Type) {
+        if (n > PY_SSIZE_T_MAX / 8) {
+            return 0;
+        }
+        size = n * 8;
+    }
+    else if (type == &PyUnicode_Type) {
+        /* The lengths come first, then the characters. */
+        size = n;
+        for (i = 0; i < n; i++) {
+            PyObject *item = PyList_GET_ITEM(obj, i);
+            if (!PyUnicode_CheckExact(item)) {
+                return 0;
+            }
+            if (PyUnicode_READY(item) < 0) {
+                return -1;
+            }
+            if (PyUnicode_KIND(item) != PyUnicode_1BYTE_KIND ||
+                PyUnicode_GET_LENGTH(item) > 255) {
+                return 0;
+            }
+            size += PyUnicode_GET_LENGTH(item);
+        }
+    }
+    else {
+        return 0;
+    }
+
+    data = PyMem_Malloc(size ? size : 1);
+    if (data == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    if (type == &PyLong_Type) {
+        header[0] = PACKED_INT64;
+        for (i = 0, p = data; i < n; i++, p += 8) {
+            PyObject *item = PyList_GET_ITEM(obj, i);
+            long long x;
+            int overflow;
+            if (!PyLong_CheckExact(item)) {
+                goto not_packed;
+            }
+            x = PyLong_AsLongLongAndOverflow(item, &overflow);
+            if (overflow) {
+                goto not_packed;
+            }
+            _write_le64(p, (uint64_t)x);
+        }
+    }
+    else if (type == &PyFloat_Type) {
+        header[0] = PACKED_FLOAT64;
+        for (i = 0, p = data; i < n; i++, p += 8) {
+            PyObject *item = PyList_GET_ITEM(obj, i);
+            if (!PyFloat_CheckExact(item)) {
+                goto not_packed;
+            }
+            if (_PyFloat_Pack8(PyFloat_AS_DOUBLE(item), p, 1) < 0) {
+                goto error;
+            }
+        }
+    }
+    else {
+        header[0] = PACKED_LATIN1;
+        p = data + n;
+        for (i = 0; i < n; i++) {
+            PyObject *item = PyList_GET_ITEM(obj, i);
+            Py_ssize_t len = PyUnicode_GET_LENGTH(item);
+            data[i] = (unsigned char)len;
+            memcpy(p, PyUnicode_1BYTE_DATA(item), len);
+            p += len;
+        }
+    }
+
+    _write_le64((unsigned char *)header + 1, (uint64_t)n);
+    status = _Pickler_write_bytes(self, header, 9, (char *)data, size, NULL);
+    PyMem_Free(data);
+    return status < 0 ? -1 : 1;
+
+  not_packed:
+    PyMem_Free(data);
+    return 0;
+  error:
+    PyMem_Free(data);
+    return -1;
+}
+
 static int
 save_list(PicklerObject *self, PyObject *obj)
 {
@@ -3044,6 +3189,18 @@ save_list(PicklerObject *self, PyObject *obj)
     if (self->fast && !fast_save_enter(self, obj))
         goto error;
 
+    /* Packed elements bypass save(), so they are not shown to a
+       persistent_id() method. */
+    if (self->packed && self->pers_func == NULL && PyList_CheckExact(obj)) {
+        status = save_packed_list(self, obj);
+        if (status < 0)
+            goto error;
+        if (status > 0) {
+            status = memo_put(self, obj) < 0 ? -1 : 0;
+            goto done;
+        }
+    }
+
     /* Create an empty list. */
     if (self->bin) {
         header[0] = EMPTY_LIST;
@@ -3091,6 +3248,7 @@ save_list(PicklerObject *self, PyObject *obj)
         status = -1;
     }
 
+  done:
     if (self->fast && !fast_save_leave(self, obj))
         status = -1;
 
@@ -4684,6 +4842,7 @@ _pickle.Pickler.__init__
   protocol: object = None
   fix_imports: bool = True
   buffer_callback: object = None
+  packed: bool = False
 
 This takes a binary file for writing a pickle data stream.
 
@@ -4716,13 +4875,17 @@ buffer is serialized in-band, i.e. inside the pickle stream.
 It is an error if *buffer_callback* is not None and *protocol*
 is None or smaller than 5.
 
+If *packed* is true, lists of ints that fit in 64 bits, of floats,
+or of Latin-1 strings shorter than 256 characters are pickled with
+compact packed opcodes.  It requires protocol 5.
+
 [clinic start generated code]*/
 
 static int
 _pickle_Pickler___init___impl(PicklerObject *self, PyObject *file,
                               PyObject *protocol, int fix_imports,
-                              PyObject *buffer_callback)
-/*[clinic end generated code: output=0abedc50590d259b input=a7c969699bf5dad3]*/
+                              PyObject *buffer_callback, int packed)
+/*[clinic end generated code: output=3e27f1db0efd9429 input=c76b520a0ba8ead0]*/
 {
     _Py_IDENTIFIER(persistent_id);
     _Py_IDENTIFIER(dispatch_table);
@@ -4740,6 +4903,9 @@ _pickle_Pickler___init___impl(PicklerObject *self, PyObject *file,
     if (_Pickler_SetBufferCallback(self, buffer_callback) < 0)
         return -1;
 
+    if (_Pickler_SetPacked(self, packed) < 0)
+        return -1;
+
     /* memo and output_buffer may have already been created in _Pickler_New */
     if (self->memo == NULL) {
         self->memo = PyMemoTable_New();
@@ -5572,6 +5738,99 @@ load_counted_bytearray(UnpicklerObject *self)
     return 0;
 }
 
+static int
+load_packed_list(UnpicklerObject *self, char opcode)
+{
+    PyObject *list;
+    Py_ssize_t i, n, size;
+    char *s;
+    const unsigned char *p;
+
+    if (_Unpickler_Read(self, &s, 8) < 0) {
+        return -1;
+    }
+    n = calc_binsize(s, 8);
+    if (n < 0 || (opcode != PACKED_LATIN1 && n > PY_SSIZE_T_MAX / 8)) {
+        PyErr_Format(PyExc_OverflowError,
+                     "packed list exceeds system's maximum size of %zd bytes",
+                     PY_SSIZE_T_MAX);
+        return -1;
+    }
+    size = opcode == PACKED_LATIN1 ? n : n * 8;
+    if (_Unpickler_Read(self, &s, size) < 0) {
+        return -1;
+    }
+    p = (const unsigned char *)s;
+
+    if (opcode == PACKED_LATIN1) {
+        /* Copy the lengths, the next read may move the input buffer. */
+        unsigned char *lengths = PyMem_Malloc(n ? n : 1);
+        if (lengths == NULL) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        memcpy(lengths, p, n);
+        for (i = 0, size = 0; i < n; i++) {
+            size += lengths[i];
+        }
+        if (_Unpickler_Read(self, &s, size) < 0) {
+            PyMem_Free(lengths);
+            return -1;
+        }
+        p = (const unsigned char *)s;
+        list = PyList_New(n);
+        if (list == NULL) {
+            PyMem_Free(lengths);
+            return -1;
+        }
+        for (i = 0; i < n; i++) {
+            PyObject *item = PyUnicode_DecodeLatin1((const char *)p,
+                                                    lengths[i], NULL);
+            if (item == NULL) {
+                PyMem_Free(lengths);
+                Py_DECREF(list);
+                return -1;
+            }
+            PyList_SET_ITEM(list, i, item);
+            p += lengths[i];
+        }
+        PyMem_Free(lengths);
+    }
+    else {
+        list = PyList_New(n);
+        if (list == NULL) {
+            return -1;
+        }
+        for (i = 0; i < n; i++, p += 8) {
+            PyObject *item;
+            if (opcode == PACKED_INT64) {
+                uint64_t x = 0;
+                int j;
+                for (j = 7; j >= 0; j--) {
+                    x = (x << 8) | p[j];
+                }
+                item = PyLong_FromLongLong((long long)x);
+            }
+            else {
+                double x = _PyFloat_Unpack8(p, 1);
+                if (x == -1.0 && PyErr_Occurred()) {
+                    Py_DECREF(list);
+                    return -1;
+                }
+                item = PyFloat_FromDouble(x);
+            }
+            if (item == NULL) {
+                Py_DECREF(list);
+                return -1;
+            }
+            PyList_SET_ITEM(list, i, item);
+        }
+    }
+
+    PDATA_PUSH(self->stack, list, -1);
+    return 0;
+}
+
 static int
 load_next_buffer(UnpicklerObject *self)
 {
@@ -6373,6 +6632,8 @@ load_put(UnpicklerObject *self)
         return -1;
     }
 
+    if (!self->use_memo)
+        return 0;
     return _Unpickler_MemoPut(self, idx, value);
 }
 
@@ -6392,6 +6653,8 @@ load_binput(UnpicklerObject *self)
 
     idx = Py_CHARMASK(s[0]);
 
+    if (!self->use_memo)
+        return 0;
     return _Unpickler_MemoPut(self, idx, value);
 }
 
@@ -6416,6 +6679,8 @@ load_long_binput(UnpicklerObject *self)
         return -1;
     }
 
+    if (!self->use_memo)
+        return 0;
     return _Unpickler_MemoPut(self, idx, value);
 }
 
@@ -6428,6 +6693,8 @@ load_memoize(UnpicklerObject *self)
         return Pdata_stack_underflow(self->stack);
     value = self->stack->data[Py_SIZE(self->stack) - 1];
 
+    if (!self->use_memo)
+        return 0;
     return _Unpickler_MemoPut(self, self->memo_len, value);
 }
 
@@ -6888,6 +7155,9 @@ load(UnpicklerObject *self)
         OP(BYTEARRAY8, load_counted_bytearray)
         OP(NEXT_BUFFER, load_next_buffer)
         OP(READONLY_BUFFER, load_readonly_buffer)
+        OP_ARG(PACKED_INT64, load_packed_list, PACKED_INT64)
+        OP_ARG(PACKED_FLOAT64, load_packed_list, PACKED_FLOAT64)
+        OP_ARG(PACKED_LATIN1, load_packed_list, PACKED_LATIN1)
         OP_ARG(SHORT_BINSTRING, load_counted_binstring, 1)
         OP_ARG(BINSTRING, load_counted_binstring, 4)
         OP(STRING, load_string)
@@ -6973,6 +7243,56 @@ load(UnpicklerObject *self)
     return value;
 }
 
+/* Check whether the Unpickler was initialized correctly. This prevents
+   segfaulting if a subclass overridden __init__ with a function that does
+   not call Unpickler.__init__(). Here, we simply ensure that there is an
+   input stream or buffer. */
+static int
+_Unpickler_CheckInitialized(UnpicklerObject *self)
+{
+    if (self->read == NULL && self->buffer.obj == NULL) {
+        PickleState *st = _Pickle_GetGlobalState();
+        PyErr_Format(st->UnpicklingError,
+                     "Unpickler.__init__() was not called by %s.__init__()",
+                     Py_TYPE(self)->tp_name);
+        return -1;
+    }
+    return 0;
+}
+
+/* Return 1 if the input is exhausted, 0 if more data follows and -1 on
+   error. */
+static int
+_Unpickler_AtEOF(UnpicklerObject *self)
+{
+    Py_ssize_t n;
+
+    if (self->next_read_idx < self->input_len)
+        return 0;
+    if (self->read == NULL)
+        return 1;
+    n = _Unpickler_ReadFromFile(self, 1);
+    if (n < 0)
+        return -1;
+    self->next_read_idx = 0;
+    return n == 0;
+}
+
+static PyObject *
+Unpickler_iternext(UnpicklerObject *self)
+{
+    int eof;
+
+    if (_Unpickler_CheckInitialized(self) < 0)
+        return NULL;
+    eof = _Unpickler_AtEOF(self);
+    if (eof != 0)
+        return NULL;
+    /* The memo is kept, as by load(): a Pickler which dump()s several
+       objects keeps its memo between them. */
+    return load(self);
+}
+
 /*[clinic input]
 
 _pickle.Unpickler.load
@@ -6990,17 +7310,8 @@ _pickle_Unpickler_load_impl(UnpicklerObject *self)
 {
     UnpicklerObject *unpickler = (UnpicklerObject*)self;
 
-    /* Check whether the Unpickler was initialized correctly. This prevents
-       segfaulting if a subclass overridden __init__ with a function that does
-       not call Unpickler.__init__(). Here, we simply ensure that self->read
-       is not NULL. */
-    if (unpickler->read == NULL) {
-        PickleState *st = _Pickle_GetGlobalState();
-        PyErr_Format(st->UnpicklingError,
-                     "Unpickler.__init__() was not called by %s.__init__()",
-                     Py_TYPE(unpickler)->tp_name);
+    if (_Unpickler_CheckInitialized(unpickler) < 0)
         return NULL;
-    }
 
     return load(unpickler);
 }
@@ -7219,6 +7530,7 @@ _pickle.Unpickler.__init__
   encoding: str = 'ASCII'
   errors: str = 'strict'
   buffers: object(c_default="NULL") = ()
+  memo: bool = True
 
 This takes a binary file for reading a pickle data stream.
 
@@ -7230,7 +7542,15 @@ The argument *file* must have two methods, a read() method that takes
 an integer argument, and a readline() method that requires no
 arguments.  Both methods should return bytes.  Thus *file* can be a
 binary file object opened for reading, an io.BytesIO object, or any
-other custom object that meets this interface.
+other custom object that meets this interface.  *file* can also be a
+bytes-like object, such as a memoryview, which is then read in place.
+
+If *memo* is false, the memo is not maintained.  This is faster for
+pickles without shared or recursive references, but such references
+cannot be loaded.
+
+The Unpickler is an iterator over the successive pickles of the
+stream, which ends cleanly at the end of the input.
 
 Optional keyword arguments are *fix_imports*, *encoding* and *errors*,
 which are used to control compatibility support for pickle stream
@@ -7245,8 +7565,9 @@ string instances as bytes objects.
 static int
 _pickle_Unpickler___init___impl(UnpicklerObject *self, PyObject *file,
                                 int fix_imports, const char *encoding,
-                                const char *errors, PyObject *buffers)
-/*[clinic end generated code: output=09f0192649ea3f85 input=ca4c1faea9553121]*/
+                                const char *errors, PyObject *buffers,
+                                int memo)
+/*[clinic end generated code: output=d471c6d58c6f84fe input=15325032a801184d]*/
 {
     _Py_IDENTIFIER(persistent_load);
 
@@ -7264,6 +7585,7 @@ _pickle_Unpickler___init___impl(UnpicklerObject *self, PyObject *file,
         return -1;
 
     self->fix_imports = fix_imports;
+    self->use_memo = memo;
 
     if (init_method_ref((PyObject *)self, &PyId_persistent_load,
                         &self->pers_func, &self->pers_func_self) < 0)
@@ -7615,8 +7937,8 @@ static PyTypeObject Unpickler_Type = {
     (inquiry)Unpickler_clear,           /*tp_clear*/
     0,                                  /*tp_richcompare*/
     0,                                  /*tp_weaklistoffset*/
-    0,                                  /*tp_iter*/
-    0,                                  /*tp_iternext*/
+    PyObject_SelfIter,                  /*tp_iter*/
+    (iternextfunc)Unpickler_iternext,   /*tp_iternext*/
     Unpickler_methods,                  /*tp_methods*/
     0,                                  /*tp_members*/
     Unpickler_getsets,                  /*tp_getset*/
@@ -7642,6 +7964,7 @@ _pickle.dump
   *
   fix_imports: bool = True
   buffer_callback: object = None
+  packed: bool = False
 
 Write a pickled representation of obj to the open file object file.
 
@@ -7670,13 +7993,17 @@ If *buffer_callback* is None (the default), buffer views are serialized
 into *file* as part of the pickle stream.  It is an error if
 *buffer_callback* is not None and *protocol* is None or smaller than 5.
 
+If *packed* is true, homogeneous lists of ints, floats or short
+Latin-1 strings are pickled with compact packed opcodes.  It requires
+protocol 5.
+
 [clinic start generated code]*/
 
 static PyObject *
 _pickle_dump_impl(PyObject *module, PyObject *obj, PyObject *file,
                   PyObject *protocol, int fix_imports,
-                  PyObject *buffer_callback)
-/*[clinic end generated code: output=706186dba996490c input=5ed6653da99cd97c]*/
+                  PyObject *buffer_callback, int packed)
+/*[clinic end generated code: output=e33da138f3b8ca12 input=8e111be4e6f13550]*/
 {
     PicklerObject *pickler = _Pickler_New();
 
@@ -7692,6 +8019,9 @@ _pickle_dump_impl(PyObject *module, PyObject *obj, PyObject *file,
     if (_Pickler_SetBufferCallback(pickler, buffer_callback) < 0)
         goto error;
 
+    if (_Pickler_SetPacked(pickler, packed) < 0)
+        goto error;
+
     if (dump(pickler, obj) < 0)
         goto error;
 
@@ -7715,6 +8045,7 @@ _pickle.dumps
   *
   fix_imports: bool = True
   buffer_callback: object = None
+  packed: bool = False
 
 Return the pickled representation of the object as a bytes object.
 
@@ -7735,12 +8066,16 @@ If *buffer_callback* is None (the default), buffer views are serialized
 into *file* as part of the pickle stream.  It is an error if
 *buffer_callback* is not None and *protocol* is None or smaller than 5.
 
+If *packed* is true, homogeneous lists of ints, floats or short
+Latin-1 strings are pickled with compact packed opcodes.  It requires
+protocol 5.
+
 [clinic start generated code]*/
 
 static PyObject *
 _pickle_dumps_impl(PyObject *module, PyObject *obj, PyObject *protocol,
-                   int fix_imports, PyObject *buffer_callback)
-/*[clinic end generated code: output=fbab0093a5580fdf input=e543272436c6f987]*/
+                   int fix_imports, PyObject *buffer_callback, int packed)
+/*[clinic end generated code: output=739b86f7a69bc94d input=186fb03309410c15]*/
 {
     PyObject *result;
     PicklerObject *pickler = _Pickler_New();
@@ -7754,6 +8089,9 @@ _pickle_dumps_impl(PyObject *module, PyObject *obj, PyObject *protocol,
     if (_Pickler_SetBufferCallback(pickler, buffer_callback) < 0)
         goto error;
 
+    if (_Pickler_SetPacked(pickler, packed) < 0)
+        goto error;
+
     if (dump(pickler, obj) < 0)
         goto error;
 
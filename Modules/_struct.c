@@ -6,6 +6,7 @@
 #define PY_SSIZE_T_CLEAN
 
 #include "Python.h"
+#include "pycore_bitutils.h"      // _Py_bswap32()
 #include "pycore_moduleobject.h"  // _PyModule_GetState()
 #include "structmember.h"         // PyMemberDef
 #include <ctype.h>
@@ -1510,6 +1511,23 @@ s_dealloc(PyStructObject *s)
     Py_DECREF(tp);
 }
 
+static PyObject *
+s_unpack_item(const formatcode *code, const char *res,
+              _structmodulestate *state)
+{
+    const formatdef *e = code->fmtdef;
+    if (e->format == 's') {
+        return PyBytes_FromStringAndSize(res, code->size);
+    } else if (e->format == 'p') {
+        Py_ssize_t n = *(unsigned char*)res;
+        if (n >= code->size)
+            n = code->size - 1;
+        return PyBytes_FromStringAndSize(res + 1, n);
+    } else {
+        return e->unpack(state, res, e);
+    }
+}
+
 static PyObject *
 s_unpack_internal(PyStructObject *soself, const char *startfrom,
                   _structmodulestate *state) {
@@ -1520,21 +1538,10 @@ s_unpack_internal(PyStructObject *soself, const char *startfrom,
         return NULL;
 
     for (code = soself->s_codes; code->fmtdef != NULL; code++) {
-        const formatdef *e = code->fmtdef;
         const char *res = startfrom + code->offset;
         Py_ssize_t j = code->repeat;
         while (j--) {
-            PyObject *v;
-            if (e->format == 's') {
-                v = PyBytes_FromStringAndSize(res, code->size);
-            } else if (e->format == 'p') {
-                Py_ssize_t n = *(unsigned char*)res;
-                if (n >= code->size)
-                    n = code->size - 1;
-                v = PyBytes_FromStringAndSize(res + 1, n);
-            } else {
-                v = e->unpack(state, res, e);
-            }
+            PyObject *v = s_unpack_item(code, res, state);
             if (v == NULL)
                 goto fail;
             PyTuple_SET_ITEM(result, i++, v);
@@ -1780,6 +1787,71 @@ Struct_iter_unpack(PyStructObject *self, PyObject *buffer)
 }
 
 
+/* Pack a single value v for the format code into res, which must have been
+   zeroed.  Return 0 on success, -1 on error. */
+static int
+s_pack_item(const formatcode *code, char *res, PyObject *v,
+            _structmodulestate *state)
+{
+    const formatdef *e = code->fmtdef;
+    if (e->format == 's') {
+        Py_ssize_t n;
+        int isstring;
+        const void *p;
+        isstring = PyBytes_Check(v);
+        if (!isstring && !PyByteArray_Check(v)) {
+            PyErr_SetString(state->StructError,
+                            "argument for 's' must be a bytes object");
+            return -1;
+        }
+        if (isstring) {
+            n = PyBytes_GET_SIZE(v);
+            p = PyBytes_AS_STRING(v);
+        }
+        else {
+            n = PyByteArray_GET_SIZE(v);
+            p = PyByteArray_AS_STRING(v);
+        }
+        if (n > code->size)
+            n = code->size;
+        if (n > 0)
+            memcpy(res, p, n);
+    } else if (e->format == 'p') {
+        Py_ssize_t n;
+        int isstring;
+        const void *p;
+        isstring = PyBytes_Check(v);
+        if (!isstring && !PyByteArray_Check(v)) {
+            PyErr_SetString(state->StructError,
+                            "argument for 'p' must be a bytes object");
+            return -1;
+        }
+        if (isstring) {
+            n = PyBytes_GET_SIZE(v);
+            p = PyBytes_AS_STRING(v);
+        }
+        else {
+            n = PyByteArray_GET_SIZE(v);
+            p = PyByteArray_AS_STRING(v);
+        }
+        if (n > (code->size - 1))
+            n = code->size - 1;
+        if (n > 0)
+            memcpy(res + 1, p, n);
+        if (n > 255)
+            n = 255;
+        *res = Py_SAFE_DOWNCAST(n, Py_ssize_t, unsigned char);
+    } else {
+        if (e->pack(state, res, v, e) < 0) {
+            if (PyLong_Check(v) && PyErr_ExceptionMatches(PyExc_OverflowError))
+                PyErr_SetString(state->StructError,
+                                "int too large to convert");
+            return -1;
+        }
+    }
+    return 0;
+}
+
 /*
  * Guts of the pack function.
  *
@@ -1802,66 +1874,11 @@ s_pack_internal(PyStructObject *soself, PyObject *const *args, int offset,
     memset(buf, '\0', soself->s_size);
     i = offset;
     for (code = soself->s_codes; code->fmtdef != NULL; code++) {
-        const formatdef *e = code->fmtdef;
         char *res = buf + code->offset;
         Py_ssize_t j = code->repeat;
         while (j--) {
-            PyObject *v = args[i++];
-            if (e->format == 's') {
-                Py_ssize_t n;
-                int isstring;
-                const void *p;
-                isstring = PyBytes_Check(v);
-                if (!isstring && !PyByteArray_Check(v)) {
-                    PyErr_SetString(state->StructError,
-                                    "argument for 's' must be a bytes object");
-                    return -1;
-                }
-                if (isstring) {
-                    n = PyBytes_GET_SIZE(v);
-                    p = PyBytes_AS_STRING(v);
-                }
-                else {
-                    n = PyByteArray_GET_SIZE(v);
-                    p = PyByteArray_AS_STRING(v);
-                }
-                if (n > code->size)
-                    n = code->size;
-                if (n > 0)
-                    memcpy(res, p, n);
-            } else if (e->format == 'p') {
-                Py_ssize_t n;
-                int isstring;
-                const void *p;
-                isstring = PyBytes_Check(v);
-                if (!isstring && !PyByteArray_Check(v)) {
-                    PyErr_SetString(state->StructError,
-                                    "argument for 'p' must be a bytes object");
-                    return -1;
-                }
-                if (isstring) {
-                    n = PyBytes_GET_SIZE(v);
-                    p = PyBytes_AS_STRING(v);
-                }
-                else {
-                    n = PyByteArray_GET_SIZE(v);
-                    p = PyByteArray_AS_STRING(v);
-                }
-                if (n > (code->size - 1))
-                    n = code->size - 1;
-                if (n > 0)
-                    memcpy(res + 1, p, n);
-                if (n > 255)
-                    n = 255;
-                *res = Py_SAFE_DOWNCAST(n, Py_ssize_t, unsigned char);
-            } else {
-                if (e->pack(state, res, v, e) < 0) {
-                    if (PyLong_Check(v) && PyErr_ExceptionMatches(PyExc_OverflowError))
-                        PyErr_SetString(state->StructError,
-                                        "int too large to convert");
-                    return -1;
-                }
-            }
+            if (s_pack_item(code, res, args[i++], state) < 0)
+                return -1;
             res += code->size;
         }
     }
@@ -2016,6 +2033,562 @@ s_pack_into(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
     Py_RETURN_NONE;
 }
 
+
+/*
+ * Column-wise unpacking and packing.
+ *
+ * A buffer of records is converted to and from one column per field, so
+ * that no tuple or value object is created per record.  Numeric, '?' and
+ * 'c' columns are memoryviews over a bytearray of native values; 's' and
+ * 'p' columns are lists of bytes objects.
+ */
+
+typedef enum {
+    COLUMN_NATIVE,
+    COLUMN_LITTLE,
+    COLUMN_BIG
+} column_order;
+
+static column_order
+s_column_order(PyStructObject *self)
+{
+    const char *fmt = PyBytes_AS_STRING(self->s_format);
+    const formatdef *table = whichtable(&fmt);
+    if (table == native_table)
+        return COLUMN_NATIVE;
+    if (table == lilendian_table)
+        return COLUMN_LITTLE;
+    return COLUMN_BIG;
+}
+
+static int
+column_swapped(column_order order)
+{
+#if PY_LITTLE_ENDIAN
+    return order == COLUMN_BIG;
+#else
+    return order == COLUMN_LITTLE;
+#endif
+}
+
+/* Return the memoryview format of the column holding a field, or '\0' if
+   the column is a list of bytes objects.  Standard size integers use the
+   native integer type of the same size. */
+static char
+column_format(const formatdef *e, column_order order)
+{
+    int is_signed = Py_ISLOWER(e->format);
+
+    switch (e->format) {
+    case 's':
+    case 'p':
+        return '\0';
+    case 'e':
+        return 'f';
+    case 'c':
+    case '?':
+    case 'f':
+    case 'd':
+        return e->format;
+    }
+    if (order == COLUMN_NATIVE)
+        return e->format;
+    switch (e->size) {
+    case 1:
+        return is_signed ? 'b' : 'B';
+    case 2:
+        return is_signed ? 'h' : 'H';
+    case 4:
+        return is_signed ? 'i' : 'I';
+    default:
+        return is_signed ? 'q' : 'Q';
+    }
+}
+
+/* Copy n items of the given size from src to dst, with the given distances
+   in bytes between consecutive items, reversing their bytes if swap is
+   true. */
+static void
+copy_strided(char *dst, Py_ssize_t dst_stride,
+             const char *src, Py_ssize_t src_stride,
+             Py_ssize_t n, Py_ssize_t size, int swap)
+{
+    Py_ssize_t k, b;
+
+#define COPY_LOOP(TYPE, SWAP)                           \
+    for (k = 0; k < n; k++) {                           \
+        TYPE x;                                         \
+        memcpy(&x, src, sizeof(TYPE));                  \
+        x = SWAP(x);                                    \
+        memcpy(dst, &x, sizeof(TYPE));                  \
+        src += src_stride;                              \
+        dst += dst_stride;                              \
+    }
+#define NO_SWAP(x) (x)
+
+    switch (size) {
+    case 1:
+        for (k = 0; k < n; k++) {
+            *dst = *src;
+            src += src_stride;
+            dst += dst_stride;
+        }
+        return;
+    case 2:
+        if (swap)
+            COPY_LOOP(uint16_t, _Py_bswap16)
+        else
+            COPY_LOOP(uint16_t, NO_SWAP)
+        return;
+    case 4:
+        if (swap)
+            COPY_LOOP(uint32_t, _Py_bswap32)
+        else
+            COPY_LOOP(uint32_t, NO_SWAP)
+        return;
+    case 8:
+        if (swap)
+            COPY_LOOP(uint64_t, _Py_bswap64)
+        else
+            COPY_LOOP(uint64_t, NO_SWAP)
+        return;
+    }
+#undef COPY_LOOP
+#undef NO_SWAP
+
+    for (k = 0; k < n; k++) {
+        if (swap) {
+            for (b = 0; b < size; b++)
+                dst[b] = src[size - 1 - b];
+        }
+        else {
+            memcpy(dst, src, size);
+        }
+        src += src_stride;
+        dst += dst_stride;
+    }
+}
+
+static double
+unpack_float_item(const char *p, char format, column_order order)
+{
+    int le = order == COLUMN_LITTLE ||
+             (order == COLUMN_NATIVE && PY_LITTLE_ENDIAN);
+
+    switch (format) {
+    case 'e':
+        return _PyFloat_Unpack2((const unsigned char *)p, le);
+    case 'f':
+        if (order == COLUMN_NATIVE) {
+            float x;
+            memcpy(&x, p, sizeof x);
+            return x;
+        }
+        return _PyFloat_Unpack4((const unsigned char *)p, le);
+    default:
+        if (order == COLUMN_NATIVE) {
+            double x;
+            memcpy(&x, p, sizeof x);
+            return x;
+        }
+        return _PyFloat_Unpack8((const unsigned char *)p, le);
+    }
+}
+
+static int
+pack_float_item(char *p, double x, char format, column_order order)
+{
+    int le = order == COLUMN_LITTLE ||
+             (order == COLUMN_NATIVE && PY_LITTLE_ENDIAN);
+
+    switch (format) {
+    case 'e':
+        return _PyFloat_Pack2(x, (unsigned char *)p, le);
+    case 'f':
+        if (order == COLUMN_NATIVE) {
+            float y = (float)x;
+            if (Py_IS_INFINITY(y) && !Py_IS_INFINITY(x)) {
+                PyErr_SetString(PyExc_OverflowError,
+                                "float too large to pack with f format");
+                return -1;
+            }
+            memcpy(p, &y, sizeof y);
+            return 0;
+        }
+        return _PyFloat_Pack4(x, (unsigned char *)p, le);
+    default:
+        if (order == COLUMN_NATIVE) {
+            memcpy(p, &x, sizeof x);
+            return 0;
+        }
+        return _PyFloat_Pack8(x, (unsigned char *)p, le);
+    }
+}
+
+/* Unpack the column of n items of a field, starting at src and stride
+   bytes apart. */
+static PyObject *
+unpack_column(const formatcode *code, column_order order, const char *src,
+              Py_ssize_t stride, Py_ssize_t n, _structmodulestate *state)
+{
+    _Py_IDENTIFIER(cast);
+    const formatdef *e = code->fmtdef;
+    char fmt[2] = {column_format(e, order), '\0'};
+    Py_ssize_t k, itemsize;
+    PyObject *column, *view;
+    char *dst;
+
+    if (fmt[0] == '\0') {
+        column = PyList_New(n);
+        if (column == NULL)
+            return NULL;
+        for (k = 0; k < n; k++) {
+            PyObject *v = s_unpack_item(code, src + k * stride, state);
+            if (v == NULL) {
+                Py_DECREF(column);
+                return NULL;
+            }
+            PyList_SET_ITEM(column, k, v);
+        }
+        return column;
+    }
+
+    itemsize = (e->format == 'e') ? (Py_ssize_t)sizeof(float) : e->size;
+    if (n > PY_SSIZE_T_MAX / itemsize)
+        return PyErr_NoMemory();
+    column = PyByteArray_FromStringAndSize(NULL, n * itemsize);
+    if (column == NULL)
+        return NULL;
+    dst = PyByteArray_AS_STRING(column);
+
+    if (e->format == 'e' ||
+        (order != COLUMN_NATIVE && (e->format == 'f' || e->format == 'd')))
+    {
+        for (k = 0; k < n; k++) {
+            double x = unpack_float_item(src + k * stride, e->format, order);
+            if (x == -1.0 && PyErr_Occurred()) {
+                Py_DECREF(column);
+                return NULL;
+            }
+            if (fmt[0] == 'f') {
+                float y = (float)x;
+                memcpy(dst + k * sizeof(float), &y, sizeof(float));
+            }
+            else {
+                memcpy(dst + k * sizeof(double), &x, sizeof(double));
+            }
+        }
+    }
+    else if (e->format == '?' && e->size == 1) {
+        for (k = 0; k < n; k++)
+            dst[k] = src[k * stride] != 0;
+    }
+    else {
+        copy_strided(dst, itemsize, src, stride, n, itemsize,
+                     column_swapped(order));
+    }
+
+    view = PyMemoryView_FromObject(column);
+    Py_DECREF(column);
+    if (view == NULL || fmt[0] == 'B')
+        return view;
+    Py_SETREF(view, _PyObject_CallMethodId(view, &PyId_cast, "s", fmt));
+    return view;
+}
+
+/*[clinic input]
+Struct.unpack_columns
+
+    buffer: Py_buffer
+    /
+
+Return a tuple with one column per field of the records in buffer.
+
+The buffer's size in bytes must be a multiple of Struct.size.  Numeric,
+'?' and 'c' fields are returned as memoryviews of native values over a
+new bytearray, 's' and 'p' fields as lists of bytes objects.
+[clinic start generated code]*/
+
+static PyObject *
+Struct_unpack_columns_impl(PyStructObject *self, Py_buffer *buffer)
+/*[clinic end generated code: output=248511f7e13c1dba input=49cb0951a735e0e6]*/
+{
+    _structmodulestate *state = get_struct_state_structinst(self);
+    column_order order;
+    formatcode *code;
+    PyObject *result;
+    Py_ssize_t i, j, n;
+
+    assert(self->s_codes != NULL);
+    if (self->s_size == 0) {
+        PyErr_SetString(state->StructError,
+                        "cannot unpack columns with a struct of length 0");
+        return NULL;
+    }
+    if (buffer->len % self->s_size != 0) {
+        PyErr_Format(state->StructError,
+                     "unpack_columns requires a buffer of "
+                     "a multiple of %zd bytes",
+                     self->s_size);
+        return NULL;
+    }
+    n = buffer->len / self->s_size;
+    order = s_column_order(self);
+
+    result = PyTuple_New(self->s_len);
+    if (result == NULL)
+        return NULL;
+    i = 0;
+    for (code = self->s_codes; code->fmtdef != NULL; code++) {
+        for (j = 0; j < code->repeat; j++) {
+            const char *src = (const char *)buffer->buf + code->offset +
+                              j * code->size;
+            PyObject *column = unpack_column(code, order, src,
+                                             self->s_size, n, state);
+            if (column == NULL) {
+                Py_DECREF(result);
+                return NULL;
+            }
+            PyTuple_SET_ITEM(result, i++, column);
+        }
+    }
+    return result;
+}
+
+typedef struct {
+    Py_buffer view;    /* used if view.obj is not NULL */
+    PyObject *seq;     /* otherwise a tuple of values */
+} column_source;
+
+/* Like PySequence_Fast(), but always return a tuple: packing the values can
+   run Python code (__index__, __float__) which must not be able to change
+   the length of a list being iterated over. */
+static PyObject *
+sequence_tuple(PyObject *obj, const char *message)
+{
+    PyObject *seq = PySequence_Fast(obj, message);
+    if (seq == NULL || PyTuple_CheckExact(seq))
+        return seq;
+    Py_SETREF(seq, PyList_AsTuple(seq));
+    return seq;
+}
+
+/* Return the single character format of a one-dimensional buffer, or
+   '\0' if it has another shape or format. */
+static char
+column_buffer_format(Py_buffer *view)
+{
+    const char *f = view->format;
+
+    if (view->ndim != 1)
+        return '\0';
+    if (f == NULL)
+        return 'B';
+    if (*f == '@')
+        f++;
+    if (f[0] == '\0' || f[1] != '\0')
+        return '\0';
+    return f[0];
+}
+
+/* Return 1 if the values of the buffer can be packed into the field
+   without creating Python objects. */
+static int
+column_buffer_compatible(const formatdef *e, column_order order,
+                         Py_buffer *view)
+{
+    char fc = column_format(e, order);
+    char cf = column_buffer_format(view);
+
+    if (fc == '\0' || cf == '\0')
+        return 0;
+    switch (e->format) {
+    case 'e':
+    case 'f':
+    case 'd':
+        return cf == 'f' || cf == 'd';
+    case '?':
+        return cf == '?' && view->itemsize == e->size;
+    case 'c':
+        return cf == 'c' || cf == 'B';
+    }
+    if (view->itemsize != e->size)
+        return 0;
+    if (strchr("bhilqn", fc) != NULL)
+        return strchr("bhilqn", cf) != NULL;
+    return strchr("BHILQNP", cf) != NULL;
+}
+
+static int
+pack_column_buffer(const formatdef *e, column_order order, char *dst,
+                   Py_ssize_t stride, Py_buffer *view, Py_ssize_t n)
+{
+    const char *src = view->buf;
+    Py_ssize_t k;
+
+    switch (e->format) {
+    case 'e':
+    case 'f':
+    case 'd':
+        for (k = 0; k < n; k++) {
+            double x;
+            if (column_buffer_format(view) == 'f') {
+                float y;
+                memcpy(&y, src + k * sizeof(float), sizeof(float));
+                x = y;
+            }
+            else {
+                memcpy(&x, src + k * sizeof(double), sizeof(double));
+            }
+            if (pack_float_item(dst + k * stride, x, e->format, order) < 0)
+                return -1;
+        }
+        return 0;
+    case '?':
+        if (e->size == 1) {
+            for (k = 0; k < n; k++)
+                dst[k * stride] = src[k] != 0;
+            return 0;
+        }
+        break;
+    }
+    copy_strided(dst, stride, src, view->itemsize, n, e->size,
+                 column_swapped(order));
+    return 0;
+}
+
+/*[clinic input]
+Struct.pack_columns
+
+    columns: object
+    /
+
+Return a bytes object containing records packed from columns of values.
+
+columns is a sequence with one column per field, each holding the values
+of that field for all records; the columns must have the same length.
+Columns which are buffers with a matching native format, such as the ones
+returned by unpack_columns(), are packed without creating Python objects.
+[clinic start generated code]*/
+
+static PyObject *
+Struct_pack_columns(PyStructObject *self, PyObject *columns)
+/*[clinic end generated code: output=30f5559101613d1b input=2a944710f62da553]*/
+{
+    _structmodulestate *state = get_struct_state_structinst(self);
+    column_order order = s_column_order(self);
+    column_source *sources = NULL;
+    formatcode *code;
+    PyObject *seq, *result = NULL;
+    Py_ssize_t i, j, k, n = 0;
+    char *buf;
+
+    assert(self->s_codes != NULL);
+    seq = sequence_tuple(columns, "pack_columns() argument must be "
+                                  "a sequence of columns");
+    if (seq == NULL)
+        return NULL;
+    if (PyTuple_GET_SIZE(seq) != self->s_len) {
+        PyErr_Format(state->StructError,
+                     "pack_columns expected %zd columns (got %zd)",
+                     self->s_len, PyTuple_GET_SIZE(seq));
+        goto done;
+    }
+    sources = PyMem_Calloc(self->s_len + 1, sizeof(column_source));
+    if (sources == NULL) {
+        PyErr_NoMemory();
+        goto done;
+    }
+
+    i = 0;
+    for (code = self->s_codes; code->fmtdef != NULL; code++) {
+        for (j = 0; j < code->repeat; j++, i++) {
+            PyObject *column = PyTuple_GET_ITEM(seq, i);
+            column_source *src = &sources[i];
+            Py_ssize_t len;
+
+            if (column_format(code->fmtdef, order) != '\0' &&
+                PyObject_CheckBuffer(column))
+            {
+                if (PyObject_GetBuffer(column, &src->view,
+                                       PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) < 0) {
+                    if (!PyErr_ExceptionMatches(PyExc_BufferError))
+                        goto done;
+                    PyErr_Clear();
+                }
+                else if (!column_buffer_compatible(code->fmtdef, order,
+                                                   &src->view)) {
+                    PyBuffer_Release(&src->view);
+                }
+            }
+            if (src->view.obj != NULL) {
+                len = src->view.len / src->view.itemsize;
+            }
+            else {
+                src->seq = sequence_tuple(column, "pack_columns() columns "
+                                                  "must be sequences");
+                if (src->seq == NULL)
+                    goto done;
+                len = PyTuple_GET_SIZE(src->seq);
+            }
+            if (i == 0) {
+                n = len;
+            }
+            else if (len != n) {
+                PyErr_SetString(state->StructError,
+                                "pack_columns requires columns "
+                                "of the same length");
+                goto done;
+            }
+        }
+    }
+
+    if (n > 0 && self->s_size > PY_SSIZE_T_MAX / n) {
+        PyErr_NoMemory();
+        goto done;
+    }
+    result = PyBytes_FromStringAndSize(NULL, n * self->s_size);
+    if (result == NULL)
+        goto done;
+    buf = PyBytes_AS_STRING(result);
+    memset(buf, '\0', n * self->s_size);
+
+    i = 0;
+    for (code = self->s_codes; code->fmtdef != NULL; code++) {
+        for (j = 0; j < code->repeat; j++, i++) {
+            column_source *src = &sources[i];
+            char *dst = buf + code->offset + j * code->size;
+
+            if (src->view.obj != NULL) {
+                if (pack_column_buffer(code->fmtdef, order, dst,
+                                       self->s_size, &src->view, n) < 0)
+                    goto error;
+                continue;
+            }
+            for (k = 0; k < n; k++) {
+                PyObject *v = PyTuple_GET_ITEM(src->seq, k);
+                if (s_pack_item(code, dst + k * self->s_size, v, state) < 0)
+                    goto error;
+            }
+        }
+    }
+    goto done;
+
+error:
+    Py_CLEAR(result);
+done:
+    if (sources != NULL) {
+        for (i = 0; i < self->s_len; i++) {
+            if (sources[i].view.obj != NULL)
+                PyBuffer_Release(&sources[i].view);
+            Py_XDECREF(sources[i].seq);
+        }
+        PyMem_Free(sources);
+    }
+    Py_DECREF(seq);
+    return result;
+}
+
 static PyObject *
 s_get_format(PyStructObject *self, void *unused)
 {
@@ -2050,8 +2623,10 @@ static struct PyMethodDef s_methods[] = {
     STRUCT_ITER_UNPACK_METHODDEF
     {"pack",            (PyCFunction)(void(*)(void))s_pack, METH_FASTCALL, s_pack__doc__},
     {"pack_into",       (PyCFunction)(void(*)(void))s_pack_into, METH_FASTCALL, s_pack_into__doc__},
+    STRUCT_PACK_COLUMNS_METHODDEF
     STRUCT_UNPACK_METHODDEF
     STRUCT_UNPACK_FROM_METHODDEF
+    STRUCT_UNPACK_COLUMNS_METHODDEF
     {"__sizeof__",      (PyCFunction)s_sizeof, METH_NOARGS, s_sizeof__doc__},
     {NULL,       NULL}          /* sentinel */
 };
@@ -2295,14 +2870,58 @@ iter_unpack_impl(PyObject *module, PyStructObject *s_object,
     return Struct_iter_unpack(s_object, buffer);
 }
 
+/*[clinic input]
+unpack_columns
+
+    format as s_object: cache_struct
+    buffer: Py_buffer
+    /
+
+Return a tuple of columns unpacked according to the format string.
+
+The buffer's size in bytes must be a multiple of calcsize(format).
+
+See help(struct) for more on format strings.
+[clinic start generated code]*/
+
+static PyObject *
+unpack_columns_impl(PyObject *module, PyStructObject *s_object,
+                    Py_buffer *buffer)
+/*[clinic end generated code: output=f4087de29de91fc5 input=46d0d1c2ca845583]*/
+{
+    return Struct_unpack_columns_impl(s_object, buffer);
+}
+
+/*[clinic input]
+pack_columns
+
+    format as s_object: cache_struct
+    columns: object
+    /
+
+Return a bytes object containing records packed from columns of values.
+
+See help(struct) for more on format strings.
+[clinic start generated code]*/
+
+static PyObject *
+pack_columns_impl(PyObject *module, PyStructObject *s_object,
+                  PyObject *columns)
+/*[clinic end generated code: output=27441ef393f446d4 input=957dadc9ca7d6936]*/
+{
+    return Struct_pack_columns(s_object, columns);
+}
+
 static struct PyMethodDef module_functions[] = {
     _CLEARCACHE_METHODDEF
     CALCSIZE_METHODDEF
     ITER_UNPACK_METHODDEF
     {"pack",            (PyCFunction)(void(*)(void))pack, METH_FASTCALL,   pack_doc},
     {"pack_into",       (PyCFunction)(void(*)(void))pack_into, METH_FASTCALL,   pack_into_doc},
+    PACK_COLUMNS_METHODDEF
     UNPACK_METHODDEF
     UNPACK_FROM_METHODDEF
+    UNPACK_COLUMNS_METHODDEF
     {NULL,       NULL}          /* sentinel */
 };
 
@@ -0,0 +1,1276 @@
+/*
+ * Linux io_uring support for asyncio's UringProactor.
+ *
+ * A Ring owns one io_uring instance.  Submitting an operation only fills
+ * a submission queue entry; all queued entries are handed to the kernel
+ * by the next Ring.wait() call, in the same io_uring_enter() system call
+ * that waits for completions.  Every in-flight operation is an Operation
+ * object which keeps its target buffer alive until the kernel has posted
+ * its completion; its address is the entry's user_data.
+ */
+
+#include "Python.h"
+
+#include <errno.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <linux/io_uring.h>
+
+/* Rounds of cancellation attempted by Ring.close() before giving up on
+   operations the kernel refuses to complete. */
+#define CLOSE_MAX_ROUNDS 10
+
+enum {
+    OP_RECV,
+    OP_RECV_INTO,
+    OP_SEND,
+    OP_READ,
+    OP_WRITE,
+    OP_ACCEPT,
+    OP_POLL,
+    OP_TIMEOUT,
+};
+
+typedef struct {
+    PyTypeObject *ring_type;
+    PyTypeObject *operation_type;
+} _uring_state;
+
+static inline _uring_state *
+get_uring_state(PyObject *module)
+{
+    void *state = PyModule_GetState(module);
+    assert(state != NULL);
+    return (_uring_state *)state;
+}
+
+typedef struct RingObject RingObject;
+
+typedef struct OperationObject {
+    PyObject_HEAD
+    /* Doubly linked list of the ring's in-flight operations */
+    struct OperationObject *prev;
+    struct OperationObject *next;
+    /* Owning ring while in flight, NULL once completed */
+    RingObject *ring;
+    int kind;
+    PyObject *key;
+    /* bytes object filled by recv() and read() */
+    PyObject *value;
+    Py_buffer view;
+    int has_view;
+    /* Set once the cancellation has been requested */
+    int cancelled;
+    struct __kernel_timespec ts;
+    /* Copy of the submitted entry, to resubmit after EINTR */
+    struct io_uring_sqe sqe;
+} OperationObject;
+
+struct RingObject {
+    PyObject_HEAD
+    int fd;
+    unsigned sq_entries;
+    unsigned *sq_head;
+    unsigned *sq_tail;
+    unsigned *sq_mask;
+    struct io_uring_sqe *sqes;
+    unsigned *cq_head;
+    unsigned *cq_tail;
+    unsigned *cq_mask;
+    struct io_uring_cqe *cqes;
+    void *sq_map;
+    size_t sq_map_size;
+    void *cq_map;
+    size_t cq_map_size;
+    size_t sqes_size;
+    /* In-flight operations; the ring holds a reference to each */
+    OperationObject *ops;
+    Py_ssize_t pending;
+    PyTypeObject *operation_type;
+};
+
+/*[clinic input]
+module _uring
+class _uring.Ring "RingObject *" "&PyType_Type"
+[clinic start generated code]*/
+/*[clinic end generated code: output=da39a3ee5e6b4b0d input=fa3d285ddca7a693]*/
+
+#include "clinic/_uringmodule.c.h"
+
+
+/* Operation objects */
+
+static int
+operation_traverse(OperationObject *op, visitproc visit, void *arg)
+{
+    Py_VISIT(Py_TYPE(op));
+    Py_VISIT(op->key);
+    Py_VISIT(op->value);
+    if (op->has_view) {
+        Py_VISIT(op->view.obj);
+    }
+    return 0;
+}
+
+/* The buffers are deliberately left alone: the kernel may still be
+   writing into them. */
+static int
+operation_clear(OperationObject *op)
+{
+    Py_CLEAR(op->key);
+    return 0;
+}
+
+static void
+operation_release(OperationObject *op)
+{
+    Py_CLEAR(op->key);
+    Py_CLEAR(op->value);
+    if (op->has_view) {
+        op->has_view = 0;
+        PyBuffer_Release(&op->view);
+    }
+}
+
+static void
+operation_dealloc(OperationObject *op)
+{
+    PyTypeObject *tp = Py_TYPE(op);
+    /* The ring keeps a reference to every in-flight operation */
+    assert(op->ring == NULL);
+    PyObject_GC_UnTrack(op);
+    operation_release(op);
+    PyObject_GC_Del(op);
+    Py_DECREF(tp);
+}
+
+static PyType_Slot Operation_Type_slots[] = {
+    {Py_tp_dealloc, operation_dealloc},
+    {Py_tp_traverse, operation_traverse},
+    {Py_tp_clear, operation_clear},
+    {0, 0}
+};
+
+static PyType_Spec Operation_Type_spec = {
+    .name = "_uring.Operation",
+    .basicsize = sizeof(OperationObject),
+    .flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC,
+    .slots = Operation_Type_slots,
+};
+
+
+/* Ring helpers */
+
+static int
+ring_enter(RingObject *self, unsigned to_submit, unsigned min_complete,
+           unsigned flags, struct __kernel_timespec *ts)
+{
+    struct io_uring_getevents_arg arg;
+
+    memset(&arg, 0, sizeof(arg));
+    arg.ts = (uint64_t)(uintptr_t)ts;
+    return (int)syscall(__NR_io_uring_enter, self->fd, to_submit,
+                        min_complete, flags | IORING_ENTER_EXT_ARG,
+                        &arg, sizeof(arg));
+}
+
+static inline unsigned
+ring_unsubmitted(RingObject *self)
+{
+    return *self->sq_tail - __atomic_load_n(self->sq_head, __ATOMIC_ACQUIRE);
+}
+
+static void
+ring_unmap(RingObject *self)
+{
+    if (self->sqes != NULL) {
+        munmap(self->sqes, self->sqes_size);
+        self->sqes = NULL;
+    }
+    if (self->cq_map != NULL && self->cq_map != self->sq_map) {
+        munmap(self->cq_map, self->cq_map_size);
+    }
+    self->cq_map = NULL;
+    if (self->sq_map != NULL) {
+        munmap(self->sq_map, self->sq_map_size);
+        self->sq_map = NULL;
+    }
+}
+
+/* Return a zeroed submission queue entry, submitting the queued entries
+   first if the queue is full.  The entry is queued by ring_push_sqe(). */
+static struct io_uring_sqe *
+ring_get_sqe(RingObject *self)
+{
+    struct io_uring_sqe *sqe;
+    unsigned tail = *self->sq_tail;
+
+    if (ring_unsubmitted(self) >= self->sq_entries) {
+        if (ring_enter(self, ring_unsubmitted(self), 0, 0, NULL) < 0) {
+            PyErr_SetFromErrno(PyExc_OSError);
+            return NULL;
+        }
+        if (ring_unsubmitted(self) >= self->sq_entries) {
+            errno = EBUSY;
+            PyErr_SetFromErrno(PyExc_OSError);
+            return NULL;
+        }
+    }
+    sqe = &self->sqes[tail & *self->sq_mask];
+    memset(sqe, 0, sizeof(*sqe));
+    return sqe;
+}
+
+static inline void
+ring_push_sqe(RingObject *self)
+{
+    __atomic_store_n(self->sq_tail, *self->sq_tail + 1, __ATOMIC_RELEASE);
+}
+
+static int
+ring_check_open(RingObject *self)
+{
+    if (self->fd < 0) {
+        PyErr_SetString(PyExc_ValueError, "I/O operation on closed ring");
+        return -1;
+    }
+    return 0;
+}
+
+static OperationObject *
+ring_new_operation(RingObject *self, int kind, PyObject *key)
+{
+    OperationObject *op;
+
+    if (ring_check_open(self) < 0) {
+        return NULL;
+    }
+    op = PyObject_GC_New(OperationObject, self->operation_type);
+    if (op == NULL) {
+        return NULL;
+    }
+    op->prev = op->next = NULL;
+    op->ring = NULL;
+    op->kind = kind;
+    Py_INCREF(key);
+    op->key = key;
+    op->value = NULL;
+    op->has_view = 0;
+    op->cancelled = 0;
+    memset(&op->ts, 0, sizeof(op->ts));
+    PyObject_GC_Track(op);
+    return op;
+}
+
+/* Queue the entry filled for op and link op into the in-flight list.
+   Return op, whose reference is passed to the caller. */
+static PyObject *
+ring_queue(RingObject *self, OperationObject *op, struct io_uring_sqe *sqe)
+{
+    sqe->user_data = (uint64_t)(uintptr_t)op;
+    op->sqe = *sqe;
+    ring_push_sqe(self);
+
+    Py_INCREF(op);
+    op->ring = self;
+    op->prev = NULL;
+    op->next = self->ops;
+    if (self->ops != NULL) {
+        self->ops->prev = op;
+    }
+    self->ops = op;
+    self->pending++;
+    return (PyObject *)op;
+}
+
+static void
+ring_unlink(RingObject *self, OperationObject *op)
+{
+    if (op->prev != NULL) {
+        op->prev->next = op->next;
+    }
+    else {
+        self->ops = op->next;
+    }
+    if (op->next != NULL) {
+        op->next->prev = op->prev;
+    }
+    op->prev = op->next = NULL;
+    op->ring = NULL;
+    self->pending--;
+}
+
+static int
+ring_queue_cancel(RingObject *self, OperationObject *op)
+{
+    struct io_uring_sqe *sqe = ring_get_sqe(self);
+
+    if (sqe == NULL) {
+        return -1;
+    }
+    op->cancelled = 1;
+    sqe->opcode = IORING_OP_ASYNC_CANCEL;
+    sqe->fd = -1;
+    sqe->addr = (uint64_t)(uintptr_t)op;
+    /* Completions with a zero user_data are not reported */
+    sqe->user_data = 0;
+    ring_push_sqe(self);
+    return 0;
+}
+
+/* Build the (key, result, value) tuple of a completed operation and drop
+   the ring's reference to it. */
+static PyObject *
+ring_complete(RingObject *self, OperationObject *op, int res)
+{
+    PyObject *value = Py_None;
+    PyObject *item;
+
+    ring_unlink(self, op);
+    if (op->kind == OP_TIMEOUT && res == -ETIME) {
+        res = 0;
+    }
+    if ((op->kind == OP_RECV || op->kind == OP_READ) && res >= 0) {
+        if (res < PyBytes_GET_SIZE(op->value) &&
+            _PyBytes_Resize(&op->value, res) < 0)
+        {
+            operation_release(op);
+            Py_DECREF(op);
+            return NULL;
+        }
+        value = op->value;
+    }
+    item = Py_BuildValue("(OiO)", op->key, res, value);
+    operation_release(op);
+    Py_DECREF(op);
+    return item;
+}
+
+/* Move the posted completions into list.  Completions of operations
+   which are only known to the ring are skipped. */
+static int
+ring_reap(RingObject *self, PyObject *list)
+{
+    unsigned head = *self->cq_head;
+    unsigned tail = __atomic_load_n(self->cq_tail, __ATOMIC_ACQUIRE);
+    int ret = 0;
+
+    while (head != tail) {
+        struct io_uring_cqe *cqe = &self->cqes[head & *self->cq_mask];
+        OperationObject *op = (OperationObject *)(uintptr_t)cqe->user_data;
+        int res = cqe->res;
+        PyObject *item;
+
+        head++;
+        if (op == NULL) {
+            continue;
+        }
+        if (res == -EINTR && !op->cancelled && op->kind != OP_TIMEOUT) {
+            /* The operation was interrupted by a signal delivered to the
+               kernel worker running it: retry it (PEP 475). */
+            struct io_uring_sqe *sqe = ring_get_sqe(self);
+            if (sqe != NULL) {
+                *sqe = op->sqe;
+                ring_push_sqe(self);
+                continue;
+            }
+            /* Report the interruption instead */
+            PyErr_Clear();
+        }
+        item = ring_complete(self, op, res);
+        if (item == NULL || PyList_Append(list, item) < 0) {
+            Py_XDECREF(item);
+            ret = -1;
+            break;
+        }
+        Py_DECREF(item);
+    }
+    __atomic_store_n(self->cq_head, head, __ATOMIC_RELEASE);
+    return ret;
+}
+
+static inline int
+ring_has_completions(RingObject *self)
+{
+    return *self->cq_head != __atomic_load_n(self->cq_tail, __ATOMIC_ACQUIRE);
+}
+
+/* Cancel every in-flight operation and wait until the kernel has
+   released them, then tear down the ring.  The completions reaped on the
+   way are appended to list when it is not NULL. */
+static int
+ring_shutdown(RingObject *self, PyObject *list)
+{
+    struct __kernel_timespec ts = {.tv_sec = 1, .tv_nsec = 0};
+    int round;
+
+    if (self->fd < 0) {
+        return 0;
+    }
+    for (round = 0; self->pending > 0 && round < CLOSE_MAX_ROUNDS; round++) {
+        OperationObject *op;
+        PyObject *reaped;
+        int r;
+
+        for (op = self->ops; op != NULL; op = op->next) {
+            if (ring_queue_cancel(self, op) < 0) {
+                PyErr_Clear();
+                break;
+            }
+        }
+        Py_BEGIN_ALLOW_THREADS
+        r = ring_enter(self, ring_unsubmitted(self), 1,
+                       IORING_ENTER_GETEVENTS, &ts);
+        Py_END_ALLOW_THREADS
+        (void)r;
+
+        reaped = list != NULL ? list : PyList_New(0);
+        if (reaped == NULL || ring_reap(self, reaped) < 0) {
+            PyErr_Clear();
+        }
+        if (reaped != list) {
+            Py_XDECREF(reaped);
+        }
+    }
+    if (self->pending > 0) {
+        /* The kernel still owns these buffers: leak the operations
+           rather than let it write into freed memory. */
+        OperationObject *op = self->ops;
+        while (op != NULL) {
+            OperationObject *next = op->next;
+            op->prev = op->next = NULL;
+            op->ring = NULL;
+            Py_CLEAR(op->key);
+            op = next;
+        }
+        self->ops = NULL;
+        self->pending = 0;
+        ring_unmap(self);
+        close(self->fd);
+        self->fd = -1;
+        return 0;
+    }
+    ring_unmap(self);
+    close(self->fd);
+    self->fd = -1;
+    return 0;
+}
+
+
+/* Ring objects */
+
+/*[clinic input]
+@classmethod
+_uring.Ring.__new__ as ring_new
+
+    entries: unsigned_int(bitwise=False) = 256
+
+Create an io_uring instance with the given submission queue size.
+[clinic start generated code]*/
+
+static PyObject *
+ring_new_impl(PyTypeObject *type, unsigned int entries)
+/*[clinic end generated code: output=f848e982461875a8 input=81c5000231214d7f]*/
+{
+    struct io_uring_params p;
+    RingObject *self;
+    unsigned *sq_array;
+    unsigned i;
+    int fd;
+
+    if (entries == 0) {
+        PyErr_SetString(PyExc_ValueError, "entries must be positive");
+        return NULL;
+    }
+    memset(&p, 0, sizeof(p));
+    p.flags = IORING_SETUP_CQSIZE;
+    p.cq_entries = entries > UINT_MAX / 4 ? UINT_MAX : entries * 4;
+    fd = (int)syscall(__NR_io_uring_setup, entries, &p);
+    if (fd < 0) {
+        return PyErr_SetFromErrno(PyExc_OSError);
+    }
+    /* The waits rely on timeouts passed to io_uring_enter() (Linux 5.11) */
+    if (!(p.features & IORING_FEAT_EXT_ARG) ||
+        !(p.features & IORING_FEAT_NODROP))
+    {
+        close(fd);
+        errno = ENOSYS;
+        return PyErr_SetFromErrno(PyExc_OSError);
+    }
+
+    self = (RingObject *)type->tp_alloc(type, 0);
+    if (self == NULL) {
+        close(fd);
+        return NULL;
+    }
+    self->fd = fd;
+    self->sq_entries = p.sq_entries;
+    self->ops = NULL;
+    self->pending = 0;
+    self->operation_type =
+        get_uring_state(PyType_GetModule(type))->operation_type;
+    Py_INCREF(self->operation_type);
+
+    self->sq_map_size = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+    self->cq_map_size = p.cq_off.cqes +
+                        p.cq_entries * sizeof(struct io_uring_cqe);
+    if (p.features & IORING_FEAT_SINGLE_MMAP) {
+        self->sq_map_size = self->cq_map_size =
+            Py_MAX(self->sq_map_size, self->cq_map_size);
+    }
+    self->sq_map = mmap(NULL, self->sq_map_size, PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+    if (self->sq_map == MAP_FAILED) {
+        self->sq_map = NULL;
+        goto error;
+    }
+    if (p.features & IORING_FEAT_SINGLE_MMAP) {
+        self->cq_map = self->sq_map;
+    }
+    else {
+        self->cq_map = mmap(NULL, self->cq_map_size, PROT_READ | PROT_WRITE,
+                            MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+        if (self->cq_map == MAP_FAILED) {
+            self->cq_map = NULL;
+            goto error;
+        }
+    }
+    self->sqes_size = p.sq_entries * sizeof(struct io_uring_sqe);
+    self->sqes = mmap(NULL, self->sqes_size, PROT_READ | PROT_WRITE,
+                      MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+    if (self->sqes == MAP_FAILED) {
+        self->sqes = NULL;
+        goto error;
+    }
+
+    self->sq_head = (unsigned *)((char *)self->sq_map + p.sq_off.head);
+    self->sq_tail = (unsigned *)((char *)self->sq_map + p.sq_off.tail);
+    self->sq_mask = (unsigned *)((char *)self->sq_map + p.sq_off.ring_mask);
+    sq_array = (unsigned *)((char *)self->sq_map + p.sq_off.array);
+    /* Entries are always queued in slot order */
+    for (i = 0; i < p.sq_entries; i++) {
+        sq_array[i] = i;
+    }
+    self->cq_head = (unsigned *)((char *)self->cq_map + p.cq_off.head);
+    self->cq_tail = (unsigned *)((char *)self->cq_map + p.cq_off.tail);
+    self->cq_mask = (unsigned *)((char *)self->cq_map + p.cq_off.ring_mask);
+    self->cqes = (struct io_uring_cqe *)((char *)self->cq_map + p.cq_off.cqes);
+    return (PyObject *)self;
+
+error:
+    PyErr_SetFromErrno(PyExc_OSError);
+    Py_DECREF(self);
+    return NULL;
+}
+
+static int
+ring_traverse(RingObject *self, visitproc visit, void *arg)
+{
+    OperationObject *op;
+
+    Py_VISIT(Py_TYPE(self));
+    Py_VISIT(self->operation_type);
+    for (op = self->ops; op != NULL; op = op->next) {
+        Py_VISIT(op);
+    }
+    return 0;
+}
+
+static int
+ring_clear(RingObject *self)
+{
+    ring_shutdown(self, NULL);
+    return 0;
+}
+
+static void
+ring_dealloc(RingObject *self)
+{
+    PyTypeObject *tp = Py_TYPE(self);
+    PyObject_GC_UnTrack(self);
+    ring_shutdown(self, NULL);
+    Py_CLEAR(self->operation_type);
+    tp->tp_free((PyObject *)self);
+    Py_DECREF(tp);
+}
+
+static int
+check_nbytes(Py_ssize_t nbytes)
+{
+    if (nbytes < 0) {
+        PyErr_SetString(PyExc_ValueError, "negative buffersize");
+        return -1;
+    }
+    return 0;
+}
+
+/* The kernel transfers at most INT_MAX bytes per operation */
+static inline unsigned
+clamp_len(Py_ssize_t len)
+{
+    return (unsigned)Py_MIN(len, INT_MAX);
+}
+
+/*[clinic input]
+_uring.Ring.recv
+
+    key: object
+    fd: int
+    nbytes: Py_ssize_t
+    flags: int = 0
+    /
+
+Queue a recv() of up to nbytes bytes from the socket fd.
+
+The completion value is the received bytes object.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_recv_impl(RingObject *self, PyObject *key, int fd,
+                      Py_ssize_t nbytes, int flags)
+/*[clinic end generated code: output=7f9e4f473ba7ae46 input=b72939d10b1bbfcc]*/
+{
+    OperationObject *op;
+    struct io_uring_sqe *sqe;
+
+    if (check_nbytes(nbytes) < 0) {
+        return NULL;
+    }
+    op = ring_new_operation(self, OP_RECV, key);
+    if (op == NULL) {
+        return NULL;
+    }
+    op->value = PyBytes_FromStringAndSize(NULL, clamp_len(nbytes));
+    if (op->value == NULL || (sqe = ring_get_sqe(self)) == NULL) {
+        Py_DECREF(op);
+        return NULL;
+    }
+    sqe->opcode = IORING_OP_RECV;
+    sqe->fd = fd;
+    sqe->addr = (uint64_t)(uintptr_t)PyBytes_AS_STRING(op->value);
+    sqe->len = (unsigned)PyBytes_GET_SIZE(op->value);
+    sqe->msg_flags = flags;
+    return ring_queue(self, op, sqe);
+}
+
+/*[clinic input]
+_uring.Ring.recv_into
+
+    key: object
+    fd: int
+    buffer: object
+    flags: int = 0
+    /
+
+Queue a recv() from the socket fd into a writable buffer.
+
+The completion result is the number of bytes received.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_recv_into_impl(RingObject *self, PyObject *key, int fd,
+                           PyObject *buffer, int flags)
+/*[clinic end generated code: output=b0c6f6aad3341ef4 input=cfbcae3086fd8c7a]*/
+{
+    OperationObject *op;
+    struct io_uring_sqe *sqe;
+
+    op = ring_new_operation(self, OP_RECV_INTO, key);
+    if (op == NULL) {
+        return NULL;
+    }
+    if (PyObject_GetBuffer(buffer, &op->view, PyBUF_WRITABLE) < 0) {
+        Py_DECREF(op);
+        return NULL;
+    }
+    op->has_view = 1;
+    if ((sqe = ring_get_sqe(self)) == NULL) {
+        Py_DECREF(op);
+        return NULL;
+    }
+    sqe->opcode = IORING_OP_RECV;
+    sqe->fd = fd;
+    sqe->addr = (uint64_t)(uintptr_t)op->view.buf;
+    sqe->len = clamp_len(op->view.len);
+    sqe->msg_flags = flags;
+    return ring_queue(self, op, sqe);
+}
+
+/*[clinic input]
+_uring.Ring.send
+
+    key: object
+    fd: int
+    data: object
+    flags: int = 0
+    /
+
+Queue a send() of a bytes-like object to the socket fd.
+
+The completion result is the number of bytes sent.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_send_impl(RingObject *self, PyObject *key, int fd,
+                      PyObject *data, int flags)
+/*[clinic end generated code: output=06c45333db128264 input=7c1b7c190ca01bb7]*/
+{
+    OperationObject *op;
+    struct io_uring_sqe *sqe;
+
+    op = ring_new_operation(self, OP_SEND, key);
+    if (op == NULL) {
+        return NULL;
+    }
+    if (PyObject_GetBuffer(data, &op->view, PyBUF_SIMPLE) < 0) {
+        Py_DECREF(op);
+        return NULL;
+    }
+    op->has_view = 1;
+    if ((sqe = ring_get_sqe(self)) == NULL) {
+        Py_DECREF(op);
+        return NULL;
+    }
+    sqe->opcode = IORING_OP_SEND;
+    sqe->fd = fd;
+    sqe->addr = (uint64_t)(uintptr_t)op->view.buf;
+    sqe->len = clamp_len(op->view.len);
+    sqe->msg_flags = flags;
+    return ring_queue(self, op, sqe);
+}
+
+/*[clinic input]
+_uring.Ring.read
+
+    key: object
+    fd: int
+    nbytes: Py_ssize_t
+    offset: long_long = -1
+    /
+
+Queue a read() of up to nbytes bytes from fd.
+
+An offset of -1 reads from the current file position.  The completion
+value is the bytes object read.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_read_impl(RingObject *self, PyObject *key, int fd,
+                      Py_ssize_t nbytes, long long offset)
+/*[clinic end generated code: output=f9d26f77048d2c58 input=e267341c07143c16]*/
+{
+    OperationObject *op;
+    struct io_uring_sqe *sqe;
+
+    if (check_nbytes(nbytes) < 0) {
+        return NULL;
+    }
+    op = ring_new_operation(self, OP_READ, key);
+    if (op == NULL) {
+        return NULL;
+    }
+    op->value = PyBytes_FromStringAndSize(NULL, clamp_len(nbytes));
+    if (op->value == NULL || (sqe = ring_get_sqe(self)) == NULL) {
+        Py_DECREF(op);
+        return NULL;
+    }
+    sqe->opcode = IORING_OP_READ;
+    sqe->fd = fd;
+    sqe->off = (uint64_t)offset;
+    sqe->addr = (uint64_t)(uintptr_t)PyBytes_AS_STRING(op->value);
+    sqe->len = (unsigned)PyBytes_GET_SIZE(op->value);
+    return ring_queue(self, op, sqe);
+}
+
+/*[clinic input]
+_uring.Ring.write
+
+    key: object
+    fd: int
+    data: object
+    offset: long_long = -1
+    /
+
+Queue a write() of a bytes-like object to fd.
+
+An offset of -1 writes at the current file position.  The completion
+result is the number of bytes written.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_write_impl(RingObject *self, PyObject *key, int fd,
+                       PyObject *data, long long offset)
+/*[clinic end generated code: output=ba2331386df7b5eb input=a7a2220244b3377c]*/
+{
+    OperationObject *op;
+    struct io_uring_sqe *sqe;
+
+    op = ring_new_operation(self, OP_WRITE, key);
+    if (op == NULL) {
+        return NULL;
+    }
+    if (PyObject_GetBuffer(data, &op->view, PyBUF_SIMPLE) < 0) {
+        Py_DECREF(op);
+        return NULL;
+    }
+    op->has_view = 1;
+    if ((sqe = ring_get_sqe(self)) == NULL) {
+        Py_DECREF(op);
+        return NULL;
+    }
+    sqe->opcode = IORING_OP_WRITE;
+    sqe->fd = fd;
+    sqe->off = (uint64_t)offset;
+    sqe->addr = (uint64_t)(uintptr_t)op->view.buf;
+    sqe->len = clamp_len(op->view.len);
+    return ring_queue(self, op, sqe);
+}
+
+/*[clinic input]
+_uring.Ring.accept
+
+    key: object
+    fd: int
+    flags: int = 0
+    /
+
+Queue an accept4() on the listening socket fd.
+
+The completion result is the file descriptor of the new connection.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_accept_impl(RingObject *self, PyObject *key, int fd, int flags)
+/*[clinic end generated code: output=4e11dc687d8b862b input=6f8f819958e9a537]*/
+{
+    OperationObject *op;
+    struct io_uring_sqe *sqe;
+
+    op = ring_new_operation(self, OP_ACCEPT, key);
+    if (op == NULL) {
+        return NULL;
+    }
+    if ((sqe = ring_get_sqe(self)) == NULL) {
+        Py_DECREF(op);
+        return NULL;
+    }
+    sqe->opcode = IORING_OP_ACCEPT;
+    sqe->fd = fd;
+    sqe->accept_flags = (uint32_t)flags;
+    return ring_queue(self, op, sqe);
+}
+
+/*[clinic input]
+_uring.Ring.poll
+
+    key: object
+    fd: int
+    events: unsigned_int(bitwise=True)
+    /
+
+Queue a one-shot poll of fd for the given poll events.
+
+The completion result is the mask of events which are ready.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_poll_impl(RingObject *self, PyObject *key, int fd,
+                      unsigned int events)
+/*[clinic end generated code: output=96169bf88a62b325 input=3c709f57560f60b2]*/
+{
+    OperationObject *op;
+    struct io_uring_sqe *sqe;
+
+    op = ring_new_operation(self, OP_POLL, key);
+    if (op == NULL) {
+        return NULL;
+    }
+    if ((sqe = ring_get_sqe(self)) == NULL) {
+        Py_DECREF(op);
+        return NULL;
+    }
+    sqe->opcode = IORING_OP_POLL_ADD;
+    sqe->fd = fd;
+#if PY_BIG_ENDIAN
+    events = (events << 16) | (events >> 16);
+#endif
+    sqe->poll32_events = events;
+    return ring_queue(self, op, sqe);
+}
+
+/*[clinic input]
+_uring.Ring.timeout
+
+    key: object
+    seconds: object
+    /
+
+Queue a timer which completes after the given number of seconds.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_timeout_impl(RingObject *self, PyObject *key, PyObject *seconds)
+/*[clinic end generated code: output=72e97147cd88786d input=ae9eb20304e106b6]*/
+{
+    OperationObject *op;
+    struct io_uring_sqe *sqe;
+    _PyTime_t t;
+
+    if (_PyTime_FromSecondsObject(&t, seconds, _PyTime_ROUND_TIMEOUT) < 0) {
+        return NULL;
+    }
+    if (t < 0) {
+        t = 0;
+    }
+    op = ring_new_operation(self, OP_TIMEOUT, key);
+    if (op == NULL) {
+        return NULL;
+    }
+    op->ts.tv_sec = t / (1000 * 1000 * 1000);
+    op->ts.tv_nsec = t % (1000 * 1000 * 1000);
+    if ((sqe = ring_get_sqe(self)) == NULL) {
+        Py_DECREF(op);
+        return NULL;
+    }
+    sqe->opcode = IORING_OP_TIMEOUT;
+    sqe->fd = -1;
+    sqe->addr = (uint64_t)(uintptr_t)&op->ts;
+    sqe->len = 1;
+    return ring_queue(self, op, sqe);
+}
+
+/*[clinic input]
+_uring.Ring.cancel
+
+    operation: object
+    /
+
+Request the cancellation of an in-flight operation.
+
+The request is submitted immediately.  The operation still completes,
+usually with -ECANCELED as its result.  Operations which already
+completed are ignored.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_cancel(RingObject *self, PyObject *operation)
+/*[clinic end generated code: output=165cf8463ff90a0e input=03d474297ec59eb3]*/
+{
+    OperationObject *op;
+
+    if (!Py_IS_TYPE(operation, self->operation_type)) {
+        PyErr_Format(PyExc_TypeError,
+                     "expected an Operation object, got %.200s",
+                     Py_TYPE(operation)->tp_name);
+        return NULL;
+    }
+    op = (OperationObject *)operation;
+    if (self->fd < 0 || op->ring != self || op->cancelled) {
+        Py_RETURN_NONE;
+    }
+    if (ring_queue_cancel(self, op) < 0) {
+        return NULL;
+    }
+    /* Submit the request right away: entries sharing a batch with a
+       cancellation may otherwise only be issued by the next wait(). */
+    if (ring_enter(self, ring_unsubmitted(self), 0, 0, NULL) < 0 &&
+        errno != EBUSY && errno != EAGAIN && errno != EINTR)
+    {
+        return PyErr_SetFromErrno(PyExc_OSError);
+    }
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+_uring.Ring.submit
+
+Submit the queued operations without waiting for completions.
+
+Return the number of submitted operations.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_submit_impl(RingObject *self)
+/*[clinic end generated code: output=f8036e3d35cb13e9 input=fe9dadf6f00594ca]*/
+{
+    int r;
+
+    if (ring_check_open(self) < 0) {
+        return NULL;
+    }
+    if (ring_unsubmitted(self) == 0) {
+        return PyLong_FromLong(0);
+    }
+    r = ring_enter(self, ring_unsubmitted(self), 0, 0, NULL);
+    if (r < 0) {
+        if (errno != EBUSY && errno != EAGAIN && errno != EINTR) {
+            return PyErr_SetFromErrno(PyExc_OSError);
+        }
+        r = 0;
+    }
+    return PyLong_FromLong(r);
+}
+
+/*[clinic input]
+_uring.Ring.wait
+
+    timeout as timeout_obj: object = None
+    /
+
+Submit the queued operations and wait for completions.
+
+Wait at most timeout seconds, or forever if timeout is None, for at least
+one completion.  Return a list of (key, result, value) tuples; a negative
+result is a negated errno value.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_wait_impl(RingObject *self, PyObject *timeout_obj)
+/*[clinic end generated code: output=480a97563d86ffbc input=084e3a03df78b12a]*/
+{
+    struct __kernel_timespec ts, *tsp = NULL;
+    PyObject *list;
+    _PyTime_t timeout = -1;
+    int r;
+
+    if (ring_check_open(self) < 0) {
+        return NULL;
+    }
+    if (timeout_obj != Py_None) {
+        if (_PyTime_FromSecondsObject(&timeout, timeout_obj,
+                                      _PyTime_ROUND_TIMEOUT) < 0) {
+            if (PyErr_ExceptionMatches(PyExc_TypeError)) {
+                PyErr_SetString(PyExc_TypeError,
+                                "timeout must be a number or None");
+            }
+            return NULL;
+        }
+        if (timeout >= 0) {
+            ts.tv_sec = timeout / (1000 * 1000 * 1000);
+            ts.tv_nsec = timeout % (1000 * 1000 * 1000);
+            tsp = &ts;
+        }
+    }
+
+    list = PyList_New(0);
+    if (list == NULL) {
+        return NULL;
+    }
+    if (timeout == 0 || ring_has_completions(self)) {
+        if (ring_unsubmitted(self) > 0 &&
+            ring_enter(self, ring_unsubmitted(self), 0, 0, NULL) < 0 &&
+            errno != EBUSY && errno != EAGAIN && errno != EINTR)
+        {
+            goto error;
+        }
+    }
+    else {
+        unsigned to_submit = ring_unsubmitted(self);
+
+        Py_BEGIN_ALLOW_THREADS
+        r = ring_enter(self, to_submit, 1, IORING_ENTER_GETEVENTS, tsp);
+        Py_END_ALLOW_THREADS
+        if (r < 0) {
+            if (errno == EINTR) {
+                if (PyErr_CheckSignals() < 0) {
+                    Py_DECREF(list);
+                    return NULL;
+                }
+            }
+            else if (errno != ETIME && errno != EBUSY && errno != EAGAIN) {
+                goto error;
+            }
+        }
+    }
+    if (ring_reap(self, list) < 0) {
+        Py_DECREF(list);
+        return NULL;
+    }
+    return list;
+
+error:
+    PyErr_SetFromErrno(PyExc_OSError);
+    Py_DECREF(list);
+    return NULL;
+}
+
+/*[clinic input]
+_uring.Ring.close
+
+Cancel the in-flight operations and close the ring.
+
+Wait until the kernel has released the buffers of the in-flight
+operations and return their completions, like wait() does.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_close_impl(RingObject *self)
+/*[clinic end generated code: output=447415269da3419f input=e40ab340f52e8ff0]*/
+{
+    PyObject *list = PyList_New(0);
+
+    if (list == NULL) {
+        return NULL;
+    }
+    ring_shutdown(self, list);
+    return list;
+}
+
+/*[clinic input]
+_uring.Ring.fileno
+
+Return the file descriptor of the ring.
+[clinic start generated code]*/
+
+static PyObject *
+_uring_Ring_fileno_impl(RingObject *self)
+/*[clinic end generated code: output=773263c5ad53ca3d input=1d3b281a9c69238b]*/
+{
+    if (ring_check_open(self) < 0) {
+        return NULL;
+    }
+    return PyLong_FromLong(self->fd);
+}
+
+static PyObject *
+ring_get_closed(RingObject *self, void *Py_UNUSED(ignored))
+{
+    return PyBool_FromLong(self->fd < 0);
+}
+
+static PyObject *
+ring_get_pending(RingObject *self, void *Py_UNUSED(ignored))
+{
+    return PyLong_FromSsize_t(self->pending);
+}
+
+static PyMethodDef ring_methods[] = {
+    _URING_RING_RECV_METHODDEF
+    _URING_RING_RECV_INTO_METHODDEF
+    _URING_RING_SEND_METHODDEF
+    _URING_RING_READ_METHODDEF
+    _URING_RING_WRITE_METHODDEF
+    _URING_RING_ACCEPT_METHODDEF
+    _URING_RING_POLL_METHODDEF
+    _URING_RING_TIMEOUT_METHODDEF
+    _URING_RING_CANCEL_METHODDEF
+    _URING_RING_SUBMIT_METHODDEF
+    _URING_RING_WAIT_METHODDEF
+    _URING_RING_CLOSE_METHODDEF
+    _URING_RING_FILENO_METHODDEF
+    {NULL, NULL}
+};
+
+static PyGetSetDef ring_getsetlist[] = {
+    {"closed", (getter)ring_get_closed, NULL,
+     "True if the ring is closed."},
+    {"pending", (getter)ring_get_pending, NULL,
+     "Number of operations the kernel has not completed yet."},
+    {NULL}
+};
+
+static PyType_Slot Ring_Type_slots[] = {
+    {Py_tp_dealloc, ring_dealloc},
+    {Py_tp_traverse, ring_traverse},
+    {Py_tp_clear, ring_clear},
+    {Py_tp_methods, ring_methods},
+    {Py_tp_getset, ring_getsetlist},
+    {Py_tp_new, ring_new},
+    {Py_tp_doc, (char *)ring_new__doc__},
+    {0, 0}
+};
+
+static PyType_Spec Ring_Type_spec = {
+    .name = "_uring.Ring",
+    .basicsize = sizeof(RingObject),
+    .flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC,
+    .slots = Ring_Type_slots,
+};
+
+
+/* Module */
+
+static int
+_uring_traverse(PyObject *module, visitproc visit, void *arg)
+{
+    _uring_state *state = get_uring_state(module);
+    Py_VISIT(state->ring_type);
+    Py_VISIT(state->operation_type);
+    return 0;
+}
+
+static int
+_uring_clear(PyObject *module)
+{
+    _uring_state *state = get_uring_state(module);
+    Py_CLEAR(state->ring_type);
+    Py_CLEAR(state->operation_type);
+    return 0;
+}
+
+static void
+_uring_free(void *module)
+{
+    _uring_clear((PyObject *)module);
+}
+
+static int
+_uring_exec(PyObject *module)
+{
+    _uring_state *state = get_uring_state(module);
+
+    state->operation_type = (PyTypeObject *)PyType_FromModuleAndSpec(
+        module, &Operation_Type_spec, NULL);
+    if (state->operation_type == NULL) {
+        return -1;
+    }
+    if (PyModule_AddType(module, state->operation_type) < 0) {
+        return -1;
+    }
+    state->ring_type = (PyTypeObject *)PyType_FromModuleAndSpec(
+        module, &Ring_Type_spec, NULL);
+    if (state->ring_type == NULL) {
+        return -1;
+    }
+    if (PyModule_AddType(module, state->ring_type) < 0) {
+        return -1;
+    }
+#define ADD_INT_MACRO(macro)                                    \
+    if (PyModule_AddIntConstant(module, #macro, macro) < 0) {   \
+        return -1;                                              \
+    }
+    ADD_INT_MACRO(POLLIN);
+    ADD_INT_MACRO(POLLOUT);
+    ADD_INT_MACRO(POLLERR);
+    ADD_INT_MACRO(POLLHUP);
+#undef ADD_INT_MACRO
+    return 0;
+}
+
+static PyModuleDef_Slot _uring_slots[] = {
+    {Py_mod_exec, _uring_exec},
+    {0, NULL}
+};
+
+PyDoc_STRVAR(_uring_doc,
+"Linux io_uring support for asyncio.");
+
+static struct PyModuleDef _uringmodule = {
+    PyModuleDef_HEAD_INIT,
+    .m_name = "_uring",
+    .m_doc = _uring_doc,
+    .m_size = sizeof(_uring_state),
+    .m_slots = _uring_slots,
+    .m_traverse = _uring_traverse,
+    .m_clear = _uring_clear,
+    .m_free = _uring_free,
+};
+
+PyMODINIT_FUNC
+PyInit__uring(void)
+{
+    return PyModuleDef_Init(&_uringmodule);
+}
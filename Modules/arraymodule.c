@@ -5,6 +5,7 @@
 
 #define PY_SSIZE_T_CLEAN
 #include "Python.h"
+#include "pycore_bitutils.h"      // _Py_bswap32()
 #include "pycore_moduleobject.h"  // _PyModule_GetState()
 #include "structmember.h"         // PyMemberDef
 #include <stddef.h>               // offsetof()
@@ -570,6 +571,434 @@ static const struct arraydescr descriptors[] = {
     {'\0', 0, 0, 0, 0, 0, 0} /* Sentinel */
 };
 
+/****************************************************************************
+Typed loops for the numeric methods (sum, min, max, dot, add, mul, cumsum
+and astype).  Each loop works directly on the item type, so the compiler is
+free to vectorize it; overflow is accumulated into a flag instead of being
+checked with an early exit wherever the loop has no carried dependency.
+****************************************************************************/
+
+enum numeric_kind {
+    NUMERIC_SIGNED,
+    NUMERIC_UNSIGNED,
+    NUMERIC_FLOAT
+};
+
+/* A single item widened to the largest type of its kind. */
+typedef union {
+    long long s;
+    unsigned long long u;
+    double d;
+} numeric_value;
+
+/* Integer sums are kept exact by accumulating the high and low 32 bits of
+   every term separately; the caller limits each run to NUMERIC_BLOCK items
+   so that neither half can overflow, and folds the halves into a Python int
+   between runs.  Floating point sums use d. */
+typedef struct {
+    long long hi;
+    unsigned long long lo;
+    double d;
+} numeric_acc;
+
+#define NUMERIC_BLOCK ((Py_ssize_t)1 << 30)
+
+#define s_HI(v) Py_ARITHMETIC_RIGHT_SHIFT(long long, (long long)(v), 32)
+#define u_HI(v) ((long long)((unsigned long long)(v) >> 32))
+
+static inline int
+s_add_overflow(long long x, long long y, long long *r)
+{
+    *r = (long long)((unsigned long long)x + (unsigned long long)y);
+    return ((x ^ *r) & (y ^ *r)) < 0;
+}
+
+static inline int
+u_add_overflow(unsigned long long x, unsigned long long y,
+               unsigned long long *r)
+{
+    *r = x + y;
+    return *r < x;
+}
+
+static inline int
+s_mul_overflow(long long x, long long y, long long *r)
+{
+#if (defined(__GNUC__) && __GNUC__ >= 5) || _Py__has_builtin(__builtin_mul_overflow)
+    return __builtin_mul_overflow(x, y, r);
+#else
+    *r = (long long)((unsigned long long)x * (unsigned long long)y);
+    if (x == 0 || y == 0) {
+        return 0;
+    }
+    if ((x == -1 && y == LLONG_MIN) || (y == -1 && x == LLONG_MIN)) {
+        return 1;
+    }
+    return *r / y != x;
+#endif
+}
+
+static inline int
+u_mul_overflow(unsigned long long x, unsigned long long y,
+               unsigned long long *r)
+{
+#if (defined(__GNUC__) && __GNUC__ >= 5) || _Py__has_builtin(__builtin_mul_overflow)
+    return __builtin_mul_overflow(x, y, r);
+#else
+    *r = x * y;
+    return x != 0 && *r / x != y;
+#endif
+}
+
+/* Loops for an integer type T.  WIDE is long long or unsigned long long,
+   P is the matching prefix (s or u) of the helpers above and F the matching
+   numeric_value field.  Types narrower than WIDE compute in WIDE and detect
+   overflow by a round trip through T; 64-bit types use the helpers. */
+#define INTEGER_BINARY_LOOP(T, WIDE, P, OP, NAME)                           \
+    if (sizeof(T) < sizeof(WIDE)) {                                         \
+        if (scalar) {                                                       \
+            const WIDE y = b[0];                                            \
+            for (Py_ssize_t i = 0; i < n; i++) {                            \
+                WIDE r = (WIDE)a[i] OP y;                                   \
+                bad |= (WIDE)(T)r != r;                                     \
+                out[i] = (T)r;                                              \
+            }                                                               \
+        }                                                                   \
+        else {                                                              \
+            for (Py_ssize_t i = 0; i < n; i++) {                            \
+                WIDE r = (WIDE)a[i] OP (WIDE)b[i];                          \
+                bad |= (WIDE)(T)r != r;                                     \
+                out[i] = (T)r;                                              \
+            }                                                               \
+        }                                                                   \
+    }                                                                       \
+    else {                                                                  \
+        for (Py_ssize_t i = 0; i < n; i++) {                                \
+            WIDE r;                                                         \
+            bad |= P##_##NAME##_overflow(a[i], b[scalar ? 0 : i], &r);      \
+            out[i] = (T)r;                                                  \
+        }                                                                   \
+    }
+
+#define DEFINE_INTEGER_LOOPS(code, T, WIDE, P, F)                           \
+static void                                                                 \
+code##_sum(const char *items, Py_ssize_t n, numeric_acc *acc)               \
+{                                                                           \
+    const T *p = (const T *)items;                                          \
+    long long hi = 0;                                                       \
+    unsigned long long lo = 0;                                              \
+    for (Py_ssize_t i = 0; i < n; i++) {                                    \
+        hi += P##_HI(p[i]);                                                 \
+        lo += (unsigned long long)p[i] & 0xffffffffULL;                     \
+    }                                                                       \
+    acc->hi += hi;                                                          \
+    acc->lo += lo;                                                          \
+}                                                                           \
+                                                                            \
+static void                                                                 \
+code##_minmax(const char *items, Py_ssize_t n, int want_max,                \
+              numeric_value *res)                                           \
+{                                                                           \
+    const T *p = (const T *)items;                                          \
+    T m = p[0];                                                             \
+    if (want_max) {                                                         \
+        for (Py_ssize_t i = 1; i < n; i++) {                                \
+            m = p[i] > m ? p[i] : m;                                        \
+        }                                                                   \
+    }                                                                       \
+    else {                                                                  \
+        for (Py_ssize_t i = 1; i < n; i++) {                                \
+            m = p[i] < m ? p[i] : m;                                        \
+        }                                                                   \
+    }                                                                       \
+    res->F = m;                                                             \
+}                                                                           \
+                                                                            \
+static int                                                                  \
+code##_dot(const char *a_, const char *b_, Py_ssize_t n, numeric_acc *acc)  \
+{                                                                           \
+    const T *a = (const T *)a_;                                             \
+    const T *b = (const T *)b_;                                             \
+    long long hi = 0;                                                       \
+    unsigned long long lo = 0;                                              \
+    /* The product of two 64-bit items does not fit in WIDE. */             \
+    if (sizeof(T) > 4) {                                                    \
+        return -1;                                                          \
+    }                                                                       \
+    for (Py_ssize_t i = 0; i < n; i++) {                                    \
+        WIDE r = (WIDE)a[i] * (WIDE)b[i];                                   \
+        hi += P##_HI(r);                                                    \
+        lo += (unsigned long long)r & 0xffffffffULL;                        \
+    }                                                                       \
+    acc->hi += hi;                                                          \
+    acc->lo += lo;                                                          \
+    return 0;                                                               \
+}                                                                           \
+                                                                            \
+static int                                                                  \
+code##_add(const char *a_, const char *b_, int scalar, char *out_,          \
+           Py_ssize_t n)                                                    \
+{                                                                           \
+    const T *a = (const T *)a_;                                             \
+    const T *b = (const T *)b_;                                             \
+    T *out = (T *)out_;                                                     \
+    int bad = 0;                                                            \
+    INTEGER_BINARY_LOOP(T, WIDE, P, +, add)                                 \
+    return bad;                                                             \
+}                                                                           \
+                                                                            \
+static int                                                                  \
+code##_mul(const char *a_, const char *b_, int scalar, char *out_,          \
+           Py_ssize_t n)                                                    \
+{                                                                           \
+    const T *a = (const T *)a_;                                             \
+    const T *b = (const T *)b_;                                             \
+    T *out = (T *)out_;                                                     \
+    int bad = 0;                                                            \
+    INTEGER_BINARY_LOOP(T, WIDE, P, *, mul)                                 \
+    return bad;                                                             \
+}                                                                           \
+                                                                            \
+static int                                                                  \
+code##_cumsum(const char *a_, char *out_, Py_ssize_t n)                     \
+{                                                                           \
+    const T *a = (const T *)a_;                                             \
+    T *out = (T *)out_;                                                     \
+    WIDE acc = 0;                                                           \
+    for (Py_ssize_t i = 0; i < n; i++) {                                    \
+        if (P##_add_overflow(acc, a[i], &acc) || (WIDE)(T)acc != acc) {     \
+            return 1;                                                       \
+        }                                                                   \
+        out[i] = (T)acc;                                                    \
+    }                                                                       \
+    return 0;                                                               \
+}                                                                           \
+                                                                            \
+static void                                                                 \
+code##_load(const char *items, Py_ssize_t n, numeric_value *buf)            \
+{                                                                           \
+    const T *p = (const T *)items;                                          \
+    for (Py_ssize_t i = 0; i < n; i++) {                                    \
+        buf[i].F = p[i];                                                    \
+    }                                                                       \
+}                                                                           \
+                                                                            \
+static int                                                                  \
+code##_store(const numeric_value *buf, int kind, Py_ssize_t n, char *out_)  \
+{                                                                           \
+    T *out = (T *)out_;                                                     \
+    int bad = 0;                                                            \
+    if (kind == NUMERIC_SIGNED) {                                           \
+        for (Py_ssize_t i = 0; i < n; i++) {                                \
+            long long v = buf[i].s;                                         \
+            bad |= ((long long)(T)v != v) | (((T)v > 0) != (v > 0));      \
+            out[i] = (T)v;                                                  \
+        }                                                                   \
+    }                                                                       \
+    else if (kind == NUMERIC_UNSIGNED) {                                    \
+        for (Py_ssize_t i = 0; i < n; i++) {                                \
+            unsigned long long v = buf[i].u;                                \
+            bad |= ((unsigned long long)(T)v != v) | (((T)v > 0) != (v > 0)); \
+            out[i] = (T)v;                                                  \
+        }                                                                   \
+    }                                                                       \
+    else {                                                                  \
+        return -1;                                                          \
+    }                                                                       \
+    return bad;                                                             \
+}
+
+#define DEFINE_FLOAT_LOOPS(code, T)                                         \
+static void                                                                 \
+code##_sum(const char *items, Py_ssize_t n, numeric_acc *acc)               \
+{                                                                           \
+    const T *p = (const T *)items;                                          \
+    double d = 0.0;                                                         \
+    for (Py_ssize_t i = 0; i < n; i++) {                                    \
+        d += p[i];                                                          \
+    }                                                                       \
+    acc->d += d;                                                            \
+}                                                                           \
+                                                                            \
+static void                                                                 \
+code##_minmax(const char *items, Py_ssize_t n, int want_max,                \
+              numeric_value *res)                                           \
+{                                                                           \
+    const T *p = (const T *)items;                                          \
+    T m = p[0];                                                             \
+    if (want_max) {                                                         \
+        for (Py_ssize_t i = 1; i < n; i++) {                                \
+            m = p[i] > m ? p[i] : m;                                        \
+        }                                                                   \
+    }                                                                       \
+    else {                                                                  \
+        for (Py_ssize_t i = 1; i < n; i++) {                                \
+            m = p[i] < m ? p[i] : m;                                        \
+        }                                                                   \
+    }                                                                       \
+    res->d = m;                                                             \
+}                                                                           \
+                                                                            \
+static int                                                                  \
+code##_dot(const char *a_, const char *b_, Py_ssize_t n, numeric_acc *acc)  \
+{                                                                           \
+    const T *a = (const T *)a_;                                             \
+    const T *b = (const T *)b_;                                             \
+    double d = 0.0;                                                         \
+    for (Py_ssize_t i = 0; i < n; i++) {                                    \
+        d += (double)a[i] * (double)b[i];                                   \
+    }                                                                       \
+    acc->d += d;                                                            \
+    return 0;                                                               \
+}                                                                           \
+                                                                            \
+static int                                                                  \
+code##_add(const char *a_, const char *b_, int scalar, char *out_,          \
+           Py_ssize_t n)                                                    \
+{                                                                           \
+    const T *a = (const T *)a_;                                             \
+    const T *b = (const T *)b_;                                             \
+    T *out = (T *)out_;                                                     \
+    if (scalar) {                                                           \
+        const T y = b[0];                                                   \
+        for (Py_ssize_t i = 0; i < n; i++) {                                \
+            out[i] = a[i] + y;                                              \
+        }                                                                   \
+    }                                                                       \
+    else {                                                                  \
+        for (Py_ssize_t i = 0; i < n; i++) {                                \
+            out[i] = a[i] + b[i];                                           \
+        }                                                                   \
+    }                                                                       \
+    return 0;                                                               \
+}                                                                           \
+                                                                            \
+static int                                                                  \
+code##_mul(const char *a_, const char *b_, int scalar, char *out_,          \
+           Py_ssize_t n)                                                    \
+{                                                                           \
+    const T *a = (const T *)a_;                                             \
+    const T *b = (const T *)b_;                                             \
+    T *out = (T *)out_;                                                     \
+    if (scalar) {                                                           \
+        const T y = b[0];                                                   \
+        for (Py_ssize_t i = 0; i < n; i++) {                                \
+            out[i] = a[i] * y;                                              \
+        }                                                                   \
+    }                                                                       \
+    else {                                                                  \
+        for (Py_ssize_t i = 0; i < n; i++) {                                \
+            out[i] = a[i] * b[i];                                           \
+        }                                                                   \
+    }                                                                       \
+    return 0;                                                               \
+}                                                                           \
+                                                                            \
+static int                                                                  \
+code##_cumsum(const char *a_, char *out_, Py_ssize_t n)                     \
+{                                                                           \
+    const T *a = (const T *)a_;                                             \
+    T *out = (T *)out_;                                                     \
+    double acc = 0.0;                                                       \
+    for (Py_ssize_t i = 0; i < n; i++) {                                    \
+        acc += a[i];                                                        \
+        out[i] = (T)acc;                                                    \
+    }                                                                       \
+    return 0;                                                               \
+}                                                                           \
+                                                                            \
+static void                                                                 \
+code##_load(const char *items, Py_ssize_t n, numeric_value *buf)            \
+{                                                                           \
+    const T *p = (const T *)items;                                          \
+    for (Py_ssize_t i = 0; i < n; i++) {                                    \
+        buf[i].d = p[i];                                                    \
+    }                                                                       \
+}                                                                           \
+                                                                            \
+static int                                                                  \
+code##_store(const numeric_value *buf, int kind, Py_ssize_t n, char *out_)  \
+{                                                                           \
+    T *out = (T *)out_;                                                     \
+    if (kind == NUMERIC_SIGNED) {                                           \
+        for (Py_ssize_t i = 0; i < n; i++) {                                \
+            out[i] = (T)buf[i].s;                                           \
+        }                                                                   \
+    }                                                                       \
+    else if (kind == NUMERIC_UNSIGNED) {                                    \
+        for (Py_ssize_t i = 0; i < n; i++) {                                \
+            out[i] = (T)buf[i].u;                                           \
+        }                                                                   \
+    }                                                                       \
+    else {                                                                  \
+        for (Py_ssize_t i = 0; i < n; i++) {                                \
+            out[i] = (T)buf[i].d;                                           \
+        }                                                                   \
+    }                                                                       \
+    return 0;                                                               \
+}
+
+DEFINE_INTEGER_LOOPS(b, signed char, long long, s, s)
+DEFINE_INTEGER_LOOPS(BB, unsigned char, unsigned long long, u, u)
+DEFINE_INTEGER_LOOPS(h, short, long long, s, s)
+DEFINE_INTEGER_LOOPS(HH, unsigned short, unsigned long long, u, u)
+DEFINE_INTEGER_LOOPS(i, int, long long, s, s)
+DEFINE_INTEGER_LOOPS(II, unsigned int, unsigned long long, u, u)
+DEFINE_INTEGER_LOOPS(l, long, long long, s, s)
+DEFINE_INTEGER_LOOPS(LL, unsigned long, unsigned long long, u, u)
+DEFINE_INTEGER_LOOPS(q, long long, long long, s, s)
+DEFINE_INTEGER_LOOPS(QQ, unsigned long long, unsigned long long, u, u)
+DEFINE_FLOAT_LOOPS(f, float)
+DEFINE_FLOAT_LOOPS(d, double)
+
+struct numeric_loops {
+    char typecode;
+    int kind;
+    void (*sum)(const char *, Py_ssize_t, numeric_acc *);
+    void (*minmax)(const char *, Py_ssize_t, int, numeric_value *);
+    int (*dot)(const char *, const char *, Py_ssize_t, numeric_acc *);
+    int (*add)(const char *, const char *, int, char *, Py_ssize_t);
+    int (*mul)(const char *, const char *, int, char *, Py_ssize_t);
+    int (*cumsum)(const char *, char *, Py_ssize_t);
+    void (*load)(const char *, Py_ssize_t, numeric_value *);
+    int (*store)(const numeric_value *, int, Py_ssize_t, char *);
+};
+
+#define NUMERIC_LOOPS(code, typecode, kind) \
+    {typecode, kind, code##_sum, code##_minmax, code##_dot, code##_add, \
+     code##_mul, code##_cumsum, code##_load, code##_store}
+
+static const struct numeric_loops numeric_loops[] = {
+    NUMERIC_LOOPS(b, 'b', NUMERIC_SIGNED),
+    NUMERIC_LOOPS(BB, 'B', NUMERIC_UNSIGNED),
+    NUMERIC_LOOPS(h, 'h', NUMERIC_SIGNED),
+    NUMERIC_LOOPS(HH, 'H', NUMERIC_UNSIGNED),
+    NUMERIC_LOOPS(i, 'i', NUMERIC_SIGNED),
+    NUMERIC_LOOPS(II, 'I', NUMERIC_UNSIGNED),
+    NUMERIC_LOOPS(l, 'l', NUMERIC_SIGNED),
+    NUMERIC_LOOPS(LL, 'L', NUMERIC_UNSIGNED),
+    NUMERIC_LOOPS(q, 'q', NUMERIC_SIGNED),
+    NUMERIC_LOOPS(QQ, 'Q', NUMERIC_UNSIGNED),
+    NUMERIC_LOOPS(f, 'f', NUMERIC_FLOAT),
+    NUMERIC_LOOPS(d, 'd', NUMERIC_FLOAT),
+    {'\0', 0} /* Sentinel */
+};
+
+static const struct numeric_loops *
+find_numeric_loops(char typecode)
+{
+    const struct numeric_loops *loops;
+    for (loops = numeric_loops; loops->typecode != '\0'; loops++) {
+        if (loops->typecode == typecode) {
+            return loops;
+        }
+    }
+    PyErr_Format(PyExc_TypeError,
+                 "array with type code '%c' does not support arithmetic",
+                 typecode);
+    return NULL;
+}
+
 /****************************************************************************
 Implementations of array object methods.
 ****************************************************************************/
@@ -1374,45 +1803,32 @@ static PyObject *
 array_array_byteswap_impl(arrayobject *self)
 /*[clinic end generated code: output=5f8236cbdf0d90b5 input=6a85591b950a0186]*/
 {
-    char *p;
-    Py_ssize_t i;
+    Py_ssize_t i, n = Py_SIZE(self);
 
     switch (self->ob_descr->itemsize) {
     case 1:
         break;
-    case 2:
-        for (p = self->ob_item, i = Py_SIZE(self); --i >= 0; p += 2) {
-            char p0 = p[0];
-            p[0] = p[1];
-            p[1] = p0;
+    case 2: {
+        uint16_t *p = (uint16_t *)self->ob_item;
+        for (i = 0; i < n; i++) {
+            p[i] = _Py_bswap16(p[i]);
         }
         break;
-    case 4:
-        for (p = self->ob_item, i = Py_SIZE(self); --i >= 0; p += 4) {
-            char p0 = p[0];
-            char p1 = p[1];
-            p[0] = p[3];
-            p[1] = p[2];
-            p[2] = p1;
-            p[3] = p0;
+    }
+    case 4: {
+        uint32_t *p = (uint32_t *)self->ob_item;
+        for (i = 0; i < n; i++) {
+            p[i] = _Py_bswap32(p[i]);
         }
         break;
-    case 8:
-        for (p = self->ob_item, i = Py_SIZE(self); --i >= 0; p += 8) {
-            char p0 = p[0];
-            char p1 = p[1];
-            char p2 = p[2];
-            char p3 = p[3];
-            p[0] = p[7];
-            p[1] = p[6];
-            p[2] = p[5];
-            p[3] = p[4];
-            p[4] = p3;
-            p[5] = p2;
-            p[6] = p1;
-            p[7] = p0;
+    }
+    case 8: {
+        uint64_t *p = (uint64_t *)self->ob_item;
+        for (i = 0; i < n; i++) {
+            p[i] = _Py_bswap64(p[i]);
         }
         break;
+    }
     default:
         PyErr_SetString(PyExc_RuntimeError,
                    "don't know how to byteswap this array type");
@@ -1421,6 +1837,457 @@ array_array_byteswap_impl(arrayobject *self)
     Py_RETURN_NONE;
 }
 
+/* Fold the split accumulator of an integer reduction into *total. */
+static int
+numeric_acc_fold(numeric_acc *acc, PyObject **total)
+{
+    PyObject *hi, *lo, *v;
+
+    hi = PyLong_FromLongLong(acc->hi);
+    lo = PyLong_FromUnsignedLongLong(acc->lo);
+    acc->hi = 0;
+    acc->lo = 0;
+    if (hi == NULL || lo == NULL) {
+        goto error;
+    }
+    v = _PyLong_Lshift(hi, 32);
+    if (v == NULL) {
+        goto error;
+    }
+    Py_SETREF(hi, v);
+    v = PyNumber_Add(hi, lo);
+    if (v == NULL) {
+        goto error;
+    }
+    Py_DECREF(hi);
+    Py_DECREF(lo);
+    Py_SETREF(*total, PyNumber_Add(*total, v));
+    Py_DECREF(v);
+    return *total == NULL ? -1 : 0;
+
+  error:
+    Py_XDECREF(hi);
+    Py_XDECREF(lo);
+    Py_CLEAR(*total);
+    return -1;
+}
+
+static PyObject *
+numeric_value_to_object(const numeric_value *v, int kind)
+{
+    switch (kind) {
+    case NUMERIC_SIGNED:
+        return PyLong_FromLongLong(v->s);
+    case NUMERIC_UNSIGNED:
+        return PyLong_FromUnsignedLongLong(v->u);
+    default:
+        return PyFloat_FromDouble(v->d);
+    }
+}
+
+static PyObject *
+array_numeric_overflow(char typecode)
+{
+    PyErr_Format(PyExc_OverflowError,
+                 "result out of range for array type code '%c'",
+                 typecode);
+    return NULL;
+}
+
+/* Return the items of other as an array of the same type code and length as
+   self, converting a scalar into a one item array.  Set *scalar accordingly. */
+static arrayobject *
+array_numeric_operand(arrayobject *self, PyObject *other, int *scalar)
+{
+    array_state *state = find_array_state_by_type(Py_TYPE(self));
+    arrayobject *b;
+
+    if (array_Check(other, state)) {
+        b = (arrayobject *)other;
+        if (b->ob_descr != self->ob_descr) {
+            PyErr_Format(PyExc_TypeError,
+                         "array type codes differ: '%c' and '%c'",
+                         self->ob_descr->typecode, b->ob_descr->typecode);
+            return NULL;
+        }
+        if (Py_SIZE(b) != Py_SIZE(self)) {
+            PyErr_Format(PyExc_ValueError,
+                         "arrays have different lengths: %zd and %zd",
+                         Py_SIZE(self), Py_SIZE(b));
+            return NULL;
+        }
+        *scalar = 0;
+        Py_INCREF(b);
+        return b;
+    }
+    b = (arrayobject *)newarrayobject(state->ArrayType, 1, self->ob_descr);
+    if (b == NULL) {
+        return NULL;
+    }
+    if (b->ob_descr->setitem(b, 0, other) < 0) {
+        Py_DECREF(b);
+        return NULL;
+    }
+    *scalar = 1;
+    return b;
+}
+
+static PyObject *
+array_numeric_binary(arrayobject *self, PyObject *other, int is_mul)
+{
+    const struct numeric_loops *loops;
+    array_state *state;
+    arrayobject *b, *res;
+    int scalar, bad;
+
+    loops = find_numeric_loops(self->ob_descr->typecode);
+    if (loops == NULL) {
+        return NULL;
+    }
+    b = array_numeric_operand(self, other, &scalar);
+    if (b == NULL) {
+        return NULL;
+    }
+    state = find_array_state_by_type(Py_TYPE(self));
+    res = (arrayobject *)newarrayobject(state->ArrayType, Py_SIZE(self),
+                                        self->ob_descr);
+    if (res == NULL) {
+        Py_DECREF(b);
+        return NULL;
+    }
+    if (is_mul) {
+        bad = loops->mul(self->ob_item, b->ob_item, scalar, res->ob_item,
+                         Py_SIZE(self));
+    }
+    else {
+        bad = loops->add(self->ob_item, b->ob_item, scalar, res->ob_item,
+                         Py_SIZE(self));
+    }
+    Py_DECREF(b);
+    if (bad) {
+        Py_DECREF(res);
+        return array_numeric_overflow(self->ob_descr->typecode);
+    }
+    return (PyObject *)res;
+}
+
+/*[clinic input]
+array.array.sum
+
+Return the sum of the items of the array.
+
+The result is an int for integer arrays and a float for floating point
+arrays.  Floating point items are added in double precision.
+[clinic start generated code]*/
+
+static PyObject *
+array_array_sum_impl(arrayobject *self)
+/*[clinic end generated code: output=1fea0a058435b932 input=0ac907772a03a206]*/
+{
+    const struct numeric_loops *loops;
+    numeric_acc acc = {0, 0, 0.0};
+    Py_ssize_t i, n = Py_SIZE(self);
+    int itemsize = self->ob_descr->itemsize;
+    PyObject *total;
+
+    loops = find_numeric_loops(self->ob_descr->typecode);
+    if (loops == NULL) {
+        return NULL;
+    }
+    if (loops->kind == NUMERIC_FLOAT) {
+        loops->sum(self->ob_item, n, &acc);
+        return PyFloat_FromDouble(acc.d);
+    }
+    total = PyLong_FromLong(0);
+    if (total == NULL) {
+        return NULL;
+    }
+    for (i = 0; i < n; i += NUMERIC_BLOCK) {
+        loops->sum(self->ob_item + i * itemsize,
+                   Py_MIN(n - i, NUMERIC_BLOCK), &acc);
+        if (numeric_acc_fold(&acc, &total) < 0) {
+            return NULL;
+        }
+    }
+    return total;
+}
+
+static PyObject *
+array_numeric_minmax(arrayobject *self, int want_max)
+{
+    const struct numeric_loops *loops;
+    numeric_value v;
+
+    loops = find_numeric_loops(self->ob_descr->typecode);
+    if (loops == NULL) {
+        return NULL;
+    }
+    if (Py_SIZE(self) == 0) {
+        PyErr_Format(PyExc_ValueError, "%s() of an empty array",
+                     want_max ? "max" : "min");
+        return NULL;
+    }
+    loops->minmax(self->ob_item, Py_SIZE(self), want_max, &v);
+    return numeric_value_to_object(&v, loops->kind);
+}
+
+/*[clinic input]
+array.array.min
+
+Return the smallest item of the array.
+
+Raise ValueError if the array is empty.
+[clinic start generated code]*/
+
+static PyObject *
+array_array_min_impl(arrayobject *self)
+/*[clinic end generated code: output=f87ea946f2832bda input=94b18588905337e6]*/
+{
+    return array_numeric_minmax(self, 0);
+}
+
+/*[clinic input]
+array.array.max
+
+Return the largest item of the array.
+
+Raise ValueError if the array is empty.
+[clinic start generated code]*/
+
+static PyObject *
+array_array_max_impl(arrayobject *self)
+/*[clinic end generated code: output=a7d50dfabda245cf input=e51a8f4641b45e9c]*/
+{
+    return array_numeric_minmax(self, 1);
+}
+
+/*[clinic input]
+array.array.dot
+
+    other: object
+    /
+
+Return the sum of the products of corresponding items of two arrays.
+
+Both arrays must have the same type code and length.
+[clinic start generated code]*/
+
+static PyObject *
+array_array_dot(arrayobject *self, PyObject *other)
+/*[clinic end generated code: output=c1c62fba7af7aad8 input=6c664bf60daecd06]*/
+{
+    const struct numeric_loops *loops;
+    array_state *state = find_array_state_by_type(Py_TYPE(self));
+    numeric_acc acc = {0, 0, 0.0};
+    Py_ssize_t i, n = Py_SIZE(self);
+    int itemsize = self->ob_descr->itemsize;
+    arrayobject *b;
+    PyObject *total;
+    int scalar;
+
+    loops = find_numeric_loops(self->ob_descr->typecode);
+    if (loops == NULL) {
+        return NULL;
+    }
+    if (!array_Check(other, state)) {
+        PyErr_Format(PyExc_TypeError,
+                     "dot() argument must be an array, not %.200s",
+                     Py_TYPE(other)->tp_name);
+        return NULL;
+    }
+    b = array_numeric_operand(self, other, &scalar);
+    if (b == NULL) {
+        return NULL;
+    }
+    if (loops->kind == NUMERIC_FLOAT) {
+        loops->dot(self->ob_item, b->ob_item, n, &acc);
+        Py_DECREF(b);
+        return PyFloat_FromDouble(acc.d);
+    }
+    total = PyLong_FromLong(0);
+    if (total == NULL) {
+        goto error;
+    }
+    for (i = 0; i < n; i += NUMERIC_BLOCK) {
+        Py_ssize_t len = Py_MIN(n - i, NUMERIC_BLOCK);
+        if (loops->dot(self->ob_item + i * itemsize,
+                       b->ob_item + i * itemsize, len, &acc) == 0) {
+            if (numeric_acc_fold(&acc, &total) < 0) {
+                goto error;
+            }
+            continue;
+        }
+        /* 64-bit products are summed as Python ints. */
+        for (; i < n; i++) {
+            PyObject *x, *y, *p;
+            x = getarrayitem((PyObject *)self, i);
+            if (x == NULL) {
+                goto error;
+            }
+            y = getarrayitem((PyObject *)b, i);
+            if (y == NULL) {
+                Py_DECREF(x);
+                goto error;
+            }
+            p = PyNumber_Multiply(x, y);
+            Py_DECREF(x);
+            Py_DECREF(y);
+            if (p == NULL) {
+                goto error;
+            }
+            Py_SETREF(total, PyNumber_Add(total, p));
+            Py_DECREF(p);
+            if (total == NULL) {
+                goto error;
+            }
+        }
+    }
+    Py_DECREF(b);
+    return total;
+
+  error:
+    Py_XDECREF(total);
+    Py_DECREF(b);
+    return NULL;
+}
+
+/*[clinic input]
+array.array.add
+
+    other: object
+    /
+
+Return a new array with other added to each item.
+
+other may be a number, which is added to every item, or an array of the
+same type code and length, which is added item by item.  Raise OverflowError
+if a result does not fit the type code.
+[clinic start generated code]*/
+
+static PyObject *
+array_array_add(arrayobject *self, PyObject *other)
+/*[clinic end generated code: output=4db948a31a7faeff input=8755fcabd17af354]*/
+{
+    return array_numeric_binary(self, other, 0);
+}
+
+/*[clinic input]
+array.array.mul
+
+    other: object
+    /
+
+Return a new array with each item multiplied by other.
+
+other may be a number, which multiplies every item, or an array of the same
+type code and length, which is multiplied item by item.  Raise OverflowError
+if a result does not fit the type code.
+[clinic start generated code]*/
+
+static PyObject *
+array_array_mul(arrayobject *self, PyObject *other)
+/*[clinic end generated code: output=bb6720736e9bfbb7 input=c04f336ee2dcece4]*/
+{
+    return array_numeric_binary(self, other, 1);
+}
+
+/*[clinic input]
+array.array.cumsum
+
+Return a new array of the running totals of the items.
+
+Raise OverflowError if a total does not fit the type code.
+[clinic start generated code]*/
+
+static PyObject *
+array_array_cumsum_impl(arrayobject *self)
+/*[clinic end generated code: output=14b19937a019b15f input=4f54f180c40922b1]*/
+{
+    const struct numeric_loops *loops;
+    array_state *state;
+    arrayobject *res;
+
+    loops = find_numeric_loops(self->ob_descr->typecode);
+    if (loops == NULL) {
+        return NULL;
+    }
+    state = find_array_state_by_type(Py_TYPE(self));
+    res = (arrayobject *)newarrayobject(state->ArrayType, Py_SIZE(self),
+                                        self->ob_descr);
+    if (res == NULL) {
+        return NULL;
+    }
+    if (loops->cumsum(self->ob_item, res->ob_item, Py_SIZE(self))) {
+        Py_DECREF(res);
+        return array_numeric_overflow(self->ob_descr->typecode);
+    }
+    return (PyObject *)res;
+}
+
+/*[clinic input]
+array.array.astype
+
+    typecode: int(accept={str})
+    /
+
+Return a new array with the items converted to another type code.
+
+Raise OverflowError if an item does not fit the new type code, and TypeError
+when converting floating point items to an integer type code.
+[clinic start generated code]*/
+
+static PyObject *
+array_array_astype_impl(arrayobject *self, int typecode)
+/*[clinic end generated code: output=6c187d3dbaa22faa input=31298a0fb35fbd9d]*/
+{
+    const struct numeric_loops *src, *dst;
+    const struct arraydescr *descr;
+    array_state *state;
+    arrayobject *res;
+    numeric_value buf[256];
+    Py_ssize_t i, n = Py_SIZE(self);
+
+    src = find_numeric_loops(self->ob_descr->typecode);
+    if (src == NULL) {
+        return NULL;
+    }
+    for (descr = descriptors; descr->typecode != '\0'; descr++) {
+        if (descr->typecode == typecode) {
+            break;
+        }
+    }
+    if (descr->typecode == '\0') {
+        PyErr_SetString(PyExc_ValueError,
+                        "bad typecode (must be b, B, u, h, H, i, I, l, L, q, Q, f or d)");
+        return NULL;
+    }
+    dst = find_numeric_loops(descr->typecode);
+    if (dst == NULL) {
+        return NULL;
+    }
+    if (src->kind == NUMERIC_FLOAT && dst->kind != NUMERIC_FLOAT) {
+        PyErr_Format(PyExc_TypeError,
+                     "cannot convert array with type code '%c' to '%c'",
+                     src->typecode, dst->typecode);
+        return NULL;
+    }
+    state = find_array_state_by_type(Py_TYPE(self));
+    res = (arrayobject *)newarrayobject(state->ArrayType, n, descr);
+    if (res == NULL) {
+        return NULL;
+    }
+    for (i = 0; i < n; i += Py_ARRAY_LENGTH(buf)) {
+        Py_ssize_t len = Py_MIN(n - i, (Py_ssize_t)Py_ARRAY_LENGTH(buf));
+        src->load(self->ob_item + i * self->ob_descr->itemsize, len, buf);
+        if (dst->store(buf, src->kind, len,
+                       res->ob_item + i * descr->itemsize)) {
+            Py_DECREF(res);
+            return array_numeric_overflow(descr->typecode);
+        }
+    }
+    return (PyObject *)res;
+}
+
 /*[clinic input]
 array.array.reverse
 
@@ -2278,12 +3145,16 @@ static PyGetSetDef array_getsets [] = {
 };
 
 static PyMethodDef array_methods[] = {
+    ARRAY_ARRAY_ADD_METHODDEF
     ARRAY_ARRAY_APPEND_METHODDEF
+    ARRAY_ARRAY_ASTYPE_METHODDEF
     ARRAY_ARRAY_BUFFER_INFO_METHODDEF
     ARRAY_ARRAY_BYTESWAP_METHODDEF
     ARRAY_ARRAY___COPY___METHODDEF
     ARRAY_ARRAY_COUNT_METHODDEF
+    ARRAY_ARRAY_CUMSUM_METHODDEF
     ARRAY_ARRAY___DEEPCOPY___METHODDEF
+    ARRAY_ARRAY_DOT_METHODDEF
     ARRAY_ARRAY_EXTEND_METHODDEF
     ARRAY_ARRAY_FROMFILE_METHODDEF
     ARRAY_ARRAY_FROMLIST_METHODDEF
@@ -2291,10 +3162,14 @@ static PyMethodDef array_methods[] = {
     ARRAY_ARRAY_FROMUNICODE_METHODDEF
     ARRAY_ARRAY_INDEX_METHODDEF
     ARRAY_ARRAY_INSERT_METHODDEF
+    ARRAY_ARRAY_MAX_METHODDEF
+    ARRAY_ARRAY_MIN_METHODDEF
+    ARRAY_ARRAY_MUL_METHODDEF
     ARRAY_ARRAY_POP_METHODDEF
     ARRAY_ARRAY___REDUCE_EX___METHODDEF
     ARRAY_ARRAY_REMOVE_METHODDEF
     ARRAY_ARRAY_REVERSE_METHODDEF
+    ARRAY_ARRAY_SUM_METHODDEF
     ARRAY_ARRAY_TOFILE_METHODDEF
     ARRAY_ARRAY_TOLIST_METHODDEF
     ARRAY_ARRAY_TOBYTES_METHODDEF
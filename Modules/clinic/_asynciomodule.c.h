@@ -611,6 +611,609 @@ PyDoc_STRVAR(_asyncio_Task_set_name__doc__,
 #define _ASYNCIO_TASK_SET_NAME_METHODDEF    \
     {"set_name", (PyCFunction)_asyncio_Task_set_name, METH_O, _asyncio_Task_set_name__doc__},
 
+PyDoc_STRVAR(_asyncio_Handle___init____doc__,
+"Handle(callback, args, loop, context=None)\n"
+"--\n"
+"\n"
+"Object returned by callback registration methods.");
+
+static int
+_asyncio_Handle___init___impl(HandleObj *self, PyObject *callback,
+                              PyObject *cb_args, PyObject *loop,
+                              PyObject *context);
+
+static int
+_asyncio_Handle___init__(PyObject *self, PyObject *args, PyObject *kwargs)
+{
+    int return_value = -1;
+    static const char * const _keywords[] = {"callback", "args", "loop", "context", NULL};
+    static _PyArg_Parser _parser = {NULL, _keywords, "Handle", 0};
+    PyObject *argsbuf[4];
+    PyObject * const *fastargs;
+    Py_ssize_t nargs = PyTuple_GET_SIZE(args);
+    Py_ssize_t noptargs = nargs + (kwargs ? PyDict_GET_SIZE(kwargs) : 0) - 3;
+    PyObject *callback;
+    PyObject *cb_args;
+    PyObject *loop;
+    PyObject *context = Py_None;
+
+    fastargs = _PyArg_UnpackKeywords(_PyTuple_CAST(args)->ob_item, nargs, kwargs, NULL, &_parser, 3, 4, 0, argsbuf);
+    if (!fastargs) {
+        goto exit;
+    }
+    callback = fastargs[0];
+    cb_args = fastargs[1];
+    loop = fastargs[2];
+    if (!noptargs) {
+        goto skip_optional_pos;
+    }
+    context = fastargs[3];
+skip_optional_pos:
+    return_value = _asyncio_Handle___init___impl((HandleObj *)self, callback, cb_args, loop, context);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_asyncio_TimerHandle___init____doc__,
+"TimerHandle(when, callback, args, loop, context=None)\n"
+"--\n"
+"\n"
+"Object returned by timed callback registration methods.");
+
+static int
+_asyncio_TimerHandle___init___impl(TimerHandleObj *self, PyObject *when,
+                                   PyObject *callback, PyObject *cb_args,
+                                   PyObject *loop, PyObject *context);
+
+static int
+_asyncio_TimerHandle___init__(PyObject *self, PyObject *args, PyObject *kwargs)
+{
+    int return_value = -1;
+    static const char * const _keywords[] = {"when", "callback", "args", "loop", "context", NULL};
+    static _PyArg_Parser _parser = {NULL, _keywords, "TimerHandle", 0};
+    PyObject *argsbuf[5];
+    PyObject * const *fastargs;
+    Py_ssize_t nargs = PyTuple_GET_SIZE(args);
+    Py_ssize_t noptargs = nargs + (kwargs ? PyDict_GET_SIZE(kwargs) : 0) - 4;
+    PyObject *when;
+    PyObject *callback;
+    PyObject *cb_args;
+    PyObject *loop;
+    PyObject *context = Py_None;
+
+    fastargs = _PyArg_UnpackKeywords(_PyTuple_CAST(args)->ob_item, nargs, kwargs, NULL, &_parser, 4, 5, 0, argsbuf);
+    if (!fastargs) {
+        goto exit;
+    }
+    when = fastargs[0];
+    callback = fastargs[1];
+    cb_args = fastargs[2];
+    loop = fastargs[3];
+    if (!noptargs) {
+        goto skip_optional_pos;
+    }
+    context = fastargs[4];
+skip_optional_pos:
+    return_value = _asyncio_TimerHandle___init___impl((TimerHandleObj *)self, when, callback, cb_args, loop, context);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_asyncio_Handle_cancel__doc__,
+"cancel($self, /)\n"
+"--\n"
+"\n"
+"Cancel the callback.\n"
+"\n"
+"If the callback has already been canceled or executed,\n"
+"this method has no effect.");
+
+#define _ASYNCIO_HANDLE_CANCEL_METHODDEF    \
+    {"cancel", (PyCFunction)_asyncio_Handle_cancel, METH_NOARGS, _asyncio_Handle_cancel__doc__},
+
+static PyObject *
+_asyncio_Handle_cancel_impl(HandleObj *self);
+
+static PyObject *
+_asyncio_Handle_cancel(HandleObj *self, PyObject *Py_UNUSED(ignored))
+{
+    return _asyncio_Handle_cancel_impl(self);
+}
+
+PyDoc_STRVAR(_asyncio_Handle_cancelled__doc__,
+"cancelled($self, /)\n"
+"--\n"
+"\n"
+"Return True if the callback was cancelled.");
+
+#define _ASYNCIO_HANDLE_CANCELLED_METHODDEF    \
+    {"cancelled", (PyCFunction)_asyncio_Handle_cancelled, METH_NOARGS, _asyncio_Handle_cancelled__doc__},
+
+static PyObject *
+_asyncio_Handle_cancelled_impl(HandleObj *self);
+
+static PyObject *
+_asyncio_Handle_cancelled(HandleObj *self, PyObject *Py_UNUSED(ignored))
+{
+    return _asyncio_Handle_cancelled_impl(self);
+}
+
+PyDoc_STRVAR(_asyncio_Handle__run__doc__,
+"_run($self, /)\n"
+"--\n"
+"\n");
+
+#define _ASYNCIO_HANDLE__RUN_METHODDEF    \
+    {"_run", (PyCFunction)_asyncio_Handle__run, METH_NOARGS, _asyncio_Handle__run__doc__},
+
+static PyObject *
+_asyncio_Handle__run_impl(HandleObj *self);
+
+static PyObject *
+_asyncio_Handle__run(HandleObj *self, PyObject *Py_UNUSED(ignored))
+{
+    return _asyncio_Handle__run_impl(self);
+}
+
+PyDoc_STRVAR(_asyncio_Handle__repr_info__doc__,
+"_repr_info($self, /)\n"
+"--\n"
+"\n");
+
+#define _ASYNCIO_HANDLE__REPR_INFO_METHODDEF    \
+    {"_repr_info", (PyCFunction)_asyncio_Handle__repr_info, METH_NOARGS, _asyncio_Handle__repr_info__doc__},
+
+static PyObject *
+_asyncio_Handle__repr_info_impl(HandleObj *self);
+
+static PyObject *
+_asyncio_Handle__repr_info(HandleObj *self, PyObject *Py_UNUSED(ignored))
+{
+    return _asyncio_Handle__repr_info_impl(self);
+}
+
+PyDoc_STRVAR(_asyncio_TimerHandle_cancel__doc__,
+"cancel($self, /)\n"
+"--\n"
+"\n"
+"Cancel the callback.\n"
+"\n"
+"If the callback has already been canceled or executed,\n"
+"this method has no effect.");
+
+#define _ASYNCIO_TIMERHANDLE_CANCEL_METHODDEF    \
+    {"cancel", (PyCFunction)_asyncio_TimerHandle_cancel, METH_NOARGS, _asyncio_TimerHandle_cancel__doc__},
+
+static PyObject *
+_asyncio_TimerHandle_cancel_impl(TimerHandleObj *self);
+
+static PyObject *
+_asyncio_TimerHandle_cancel(TimerHandleObj *self, PyObject *Py_UNUSED(ignored))
+{
+    return _asyncio_TimerHandle_cancel_impl(self);
+}
+
+PyDoc_STRVAR(_asyncio_TimerHandle_when__doc__,
+"when($self, /)\n"
+"--\n"
+"\n"
+"Return a scheduled callback time.\n"
+"\n"
+"The time is an absolute timestamp, using the same time\n"
+"reference as loop.time().");
+
+#define _ASYNCIO_TIMERHANDLE_WHEN_METHODDEF    \
+    {"when", (PyCFunction)_asyncio_TimerHandle_when, METH_NOARGS, _asyncio_TimerHandle_when__doc__},
+
+static PyObject *
+_asyncio_TimerHandle_when_impl(TimerHandleObj *self);
+
+static PyObject *
+_asyncio_TimerHandle_when(TimerHandleObj *self, PyObject *Py_UNUSED(ignored))
+{
+    return _asyncio_TimerHandle_when_impl(self);
+}
+
+PyDoc_STRVAR(_asyncio_TimerHandle__repr_info__doc__,
+"_repr_info($self, /)\n"
+"--\n"
+"\n");
+
+#define _ASYNCIO_TIMERHANDLE__REPR_INFO_METHODDEF    \
+    {"_repr_info", (PyCFunction)_asyncio_TimerHandle__repr_info, METH_NOARGS, _asyncio_TimerHandle__repr_info__doc__},
+
+static PyObject *
+_asyncio_TimerHandle__repr_info_impl(TimerHandleObj *self);
+
+static PyObject *
+_asyncio_TimerHandle__repr_info(TimerHandleObj *self, PyObject *Py_UNUSED(ignored))
+{
+    return _asyncio_TimerHandle__repr_info_impl(self);
+}
+
+PyDoc_STRVAR(_asyncio__EventLoopCore__call_soon__doc__,
+"_call_soon($self, callback, args, context, /)\n"
+"--\n"
+"\n");
+
+#define _ASYNCIO__EVENTLOOPCORE__CALL_SOON_METHODDEF    \
+    {"_call_soon", (PyCFunction)(void(*)(void))_asyncio__EventLoopCore__call_soon, METH_FASTCALL, _asyncio__EventLoopCore__call_soon__doc__},
+
+static PyObject *
+_asyncio__EventLoopCore__call_soon_impl(PyObject *self, PyObject *callback,
+                                        PyObject *cb_args, PyObject *context);
+
+static PyObject *
+_asyncio__EventLoopCore__call_soon(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyObject *callback;
+    PyObject *cb_args;
+    PyObject *context;
+
+    if (!_PyArg_CheckPositional("_call_soon", nargs, 3, 3)) {
+        goto exit;
+    }
+    callback = args[0];
+    cb_args = args[1];
+    context = args[2];
+    return_value = _asyncio__EventLoopCore__call_soon_impl(self, callback, cb_args, context);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_asyncio__EventLoopCore__add_callback__doc__,
+"_add_callback($self, handle, /)\n"
+"--\n"
+"\n"
+"Add a Handle to _ready.");
+
+#define _ASYNCIO__EVENTLOOPCORE__ADD_CALLBACK_METHODDEF    \
+    {"_add_callback", (PyCFunction)_asyncio__EventLoopCore__add_callback, METH_O, _asyncio__EventLoopCore__add_callback__doc__},
+
+PyDoc_STRVAR(_asyncio__EventLoopCore__timer_handle_cancelled__doc__,
+"_timer_handle_cancelled($self, handle, /)\n"
+"--\n"
+"\n"
+"Notification that a TimerHandle has been cancelled.");
+
+#define _ASYNCIO__EVENTLOOPCORE__TIMER_HANDLE_CANCELLED_METHODDEF    \
+    {"_timer_handle_cancelled", (PyCFunction)_asyncio__EventLoopCore__timer_handle_cancelled, METH_O, _asyncio__EventLoopCore__timer_handle_cancelled__doc__},
+
+PyDoc_STRVAR(_asyncio__EventLoopCore__run_once__doc__,
+"_run_once($self, /)\n"
+"--\n"
+"\n"
+"Run one full iteration of the event loop.\n"
+"\n"
+"This calls all currently ready callbacks, polls for I/O,\n"
+"schedules the resulting callbacks, and finally schedules\n"
+"\'call_later\' callbacks.");
+
+#define _ASYNCIO__EVENTLOOPCORE__RUN_ONCE_METHODDEF    \
+    {"_run_once", (PyCFunction)_asyncio__EventLoopCore__run_once, METH_NOARGS, _asyncio__EventLoopCore__run_once__doc__},
+
+static PyObject *
+_asyncio__EventLoopCore__run_once_impl(PyObject *self);
+
+static PyObject *
+_asyncio__EventLoopCore__run_once(PyObject *self, PyObject *Py_UNUSED(ignored))
+{
+    return _asyncio__EventLoopCore__run_once_impl(self);
+}
+
+PyDoc_STRVAR(_asyncio__StreamBuffer_extend__doc__,
+"extend($self, data, /)\n"
+"--\n"
+"\n"
+"Append data to the buffer.");
+
+#define _ASYNCIO__STREAMBUFFER_EXTEND_METHODDEF    \
+    {"extend", (PyCFunction)_asyncio__StreamBuffer_extend, METH_O, _asyncio__StreamBuffer_extend__doc__},
+
+static PyObject *
+_asyncio__StreamBuffer_extend_impl(StreamBufferObj *self, Py_buffer *data);
+
+static PyObject *
+_asyncio__StreamBuffer_extend(StreamBufferObj *self, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    Py_buffer data = {NULL, NULL};
+
+    if (PyObject_GetBuffer(arg, &data, PyBUF_SIMPLE) != 0) {
+        goto exit;
+    }
+    if (!PyBuffer_IsContiguous(&data, 'C')) {
+        _PyArg_BadArgument("extend", "argument", "contiguous buffer", arg);
+        goto exit;
+    }
+    return_value = _asyncio__StreamBuffer_extend_impl(self, &data);
+
+exit:
+    /* Cleanup for data */
+    if (data.obj) {
+       PyBuffer_Release(&data);
+    }
+
+    return return_value;
+}
+
+PyDoc_STRVAR(_asyncio__StreamBuffer_get_buffer__doc__,
+"get_buffer($self, sizehint, /)\n"
+"--\n"
+"\n"
+"Return a writable memoryview of the free space.\n"
+"\n"
+"It is at least sizehint bytes long.  buffer_updated() must be\n"
+"called with the number of bytes written to it.");
+
+#define _ASYNCIO__STREAMBUFFER_GET_BUFFER_METHODDEF    \
+    {"get_buffer", (PyCFunction)_asyncio__StreamBuffer_get_buffer, METH_O, _asyncio__StreamBuffer_get_buffer__doc__},
+
+static PyObject *
+_asyncio__StreamBuffer_get_buffer_impl(StreamBufferObj *self,
+                                       Py_ssize_t sizehint);
+
+static PyObject *
+_asyncio__StreamBuffer_get_buffer(StreamBufferObj *self, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    Py_ssize_t sizehint;
+
+    {
+        Py_ssize_t ival = -1;
+        PyObject *iobj = _PyNumber_Index(arg);
+        if (iobj != NULL) {
+            ival = PyLong_AsSsize_t(iobj);
+            Py_DECREF(iobj);
+        }
+        if (ival == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        sizehint = ival;
+    }
+    return_value = _asyncio__StreamBuffer_get_buffer_impl(self, sizehint);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_asyncio__StreamBuffer_buffer_updated__doc__,
+"buffer_updated($self, nbytes, /)\n"
+"--\n"
+"\n"
+"Add nbytes bytes written to the last get_buffer() view.");
+
+#define _ASYNCIO__STREAMBUFFER_BUFFER_UPDATED_METHODDEF    \
+    {"buffer_updated", (PyCFunction)_asyncio__StreamBuffer_buffer_updated, METH_O, _asyncio__StreamBuffer_buffer_updated__doc__},
+
+static PyObject *
+_asyncio__StreamBuffer_buffer_updated_impl(StreamBufferObj *self,
+                                           Py_ssize_t nbytes);
+
+static PyObject *
+_asyncio__StreamBuffer_buffer_updated(StreamBufferObj *self, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    Py_ssize_t nbytes;
+
+    {
+        Py_ssize_t ival = -1;
+        PyObject *iobj = _PyNumber_Index(arg);
+        if (iobj != NULL) {
+            ival = PyLong_AsSsize_t(iobj);
+            Py_DECREF(iobj);
+        }
+        if (ival == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        nbytes = ival;
+    }
+    return_value = _asyncio__StreamBuffer_buffer_updated_impl(self, nbytes);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_asyncio__StreamBuffer_take__doc__,
+"take($self, n, /)\n"
+"--\n"
+"\n"
+"Remove up to n bytes from the front of the buffer and return them.");
+
+#define _ASYNCIO__STREAMBUFFER_TAKE_METHODDEF    \
+    {"take", (PyCFunction)_asyncio__StreamBuffer_take, METH_O, _asyncio__StreamBuffer_take__doc__},
+
+static PyObject *
+_asyncio__StreamBuffer_take_impl(StreamBufferObj *self, Py_ssize_t n);
+
+static PyObject *
+_asyncio__StreamBuffer_take(StreamBufferObj *self, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    Py_ssize_t n;
+
+    {
+        Py_ssize_t ival = -1;
+        PyObject *iobj = _PyNumber_Index(arg);
+        if (iobj != NULL) {
+            ival = PyLong_AsSsize_t(iobj);
+            Py_DECREF(iobj);
+        }
+        if (ival == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        n = ival;
+    }
+    return_value = _asyncio__StreamBuffer_take_impl(self, n);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_asyncio__StreamBuffer_discard__doc__,
+"discard($self, n, /)\n"
+"--\n"
+"\n"
+"Remove up to n bytes from the front of the buffer.");
+
+#define _ASYNCIO__STREAMBUFFER_DISCARD_METHODDEF    \
+    {"discard", (PyCFunction)_asyncio__StreamBuffer_discard, METH_O, _asyncio__StreamBuffer_discard__doc__},
+
+static PyObject *
+_asyncio__StreamBuffer_discard_impl(StreamBufferObj *self, Py_ssize_t n);
+
+static PyObject *
+_asyncio__StreamBuffer_discard(StreamBufferObj *self, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    Py_ssize_t n;
+
+    {
+        Py_ssize_t ival = -1;
+        PyObject *iobj = _PyNumber_Index(arg);
+        if (iobj != NULL) {
+            ival = PyLong_AsSsize_t(iobj);
+            Py_DECREF(iobj);
+        }
+        if (ival == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        n = ival;
+    }
+    return_value = _asyncio__StreamBuffer_discard_impl(self, n);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_asyncio__StreamBuffer_clear__doc__,
+"clear($self, /)\n"
+"--\n"
+"\n"
+"Remove all data from the buffer.");
+
+#define _ASYNCIO__STREAMBUFFER_CLEAR_METHODDEF    \
+    {"clear", (PyCFunction)_asyncio__StreamBuffer_clear, METH_NOARGS, _asyncio__StreamBuffer_clear__doc__},
+
+static PyObject *
+_asyncio__StreamBuffer_clear_impl(StreamBufferObj *self);
+
+static PyObject *
+_asyncio__StreamBuffer_clear(StreamBufferObj *self, PyObject *Py_UNUSED(ignored))
+{
+    return _asyncio__StreamBuffer_clear_impl(self);
+}
+
+PyDoc_STRVAR(_asyncio__StreamBuffer_startswith__doc__,
+"startswith($self, prefix, offset=0, /)\n"
+"--\n"
+"\n"
+"Return True if the data at offset starts with prefix.");
+
+#define _ASYNCIO__STREAMBUFFER_STARTSWITH_METHODDEF    \
+    {"startswith", (PyCFunction)(void(*)(void))_asyncio__StreamBuffer_startswith, METH_FASTCALL, _asyncio__StreamBuffer_startswith__doc__},
+
+static PyObject *
+_asyncio__StreamBuffer_startswith_impl(StreamBufferObj *self,
+                                       Py_buffer *prefix, Py_ssize_t offset);
+
+static PyObject *
+_asyncio__StreamBuffer_startswith(StreamBufferObj *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    Py_buffer prefix = {NULL, NULL};
+    Py_ssize_t offset = 0;
+
+    if (!_PyArg_CheckPositional("startswith", nargs, 1, 2)) {
+        goto exit;
+    }
+    if (PyObject_GetBuffer(args[0], &prefix, PyBUF_SIMPLE) != 0) {
+        goto exit;
+    }
+    if (!PyBuffer_IsContiguous(&prefix, 'C')) {
+        _PyArg_BadArgument("startswith", "argument 1", "contiguous buffer", args[0]);
+        goto exit;
+    }
+    if (nargs < 2) {
+        goto skip_optional;
+    }
+    {
+        Py_ssize_t ival = -1;
+        PyObject *iobj = _PyNumber_Index(args[1]);
+        if (iobj != NULL) {
+            ival = PyLong_AsSsize_t(iobj);
+            Py_DECREF(iobj);
+        }
+        if (ival == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        offset = ival;
+    }
+skip_optional:
+    return_value = _asyncio__StreamBuffer_startswith_impl(self, &prefix, offset);
+
+exit:
+    /* Cleanup for prefix */
+    if (prefix.obj) {
+       PyBuffer_Release(&prefix);
+    }
+
+    return return_value;
+}
+
+PyDoc_STRVAR(_asyncio__StreamBuffer_find__doc__,
+"find($self, separators, offset=0, /)\n"
+"--\n"
+"\n"
+"Find the match of separators which ends first.\n"
+"\n"
+"separators is a sequence of non-empty bytes objects sorted by\n"
+"length.  Return the (start, end) offsets of the match, or (-1, -1).");
+
+#define _ASYNCIO__STREAMBUFFER_FIND_METHODDEF    \
+    {"find", (PyCFunction)(void(*)(void))_asyncio__StreamBuffer_find, METH_FASTCALL, _asyncio__StreamBuffer_find__doc__},
+
+static PyObject *
+_asyncio__StreamBuffer_find_impl(StreamBufferObj *self, PyObject *separators,
+                                 Py_ssize_t offset);
+
+static PyObject *
+_asyncio__StreamBuffer_find(StreamBufferObj *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyObject *separators;
+    Py_ssize_t offset = 0;
+
+    if (!_PyArg_CheckPositional("find", nargs, 1, 2)) {
+        goto exit;
+    }
+    separators = args[0];
+    if (nargs < 2) {
+        goto skip_optional;
+    }
+    {
+        Py_ssize_t ival = -1;
+        PyObject *iobj = _PyNumber_Index(args[1]);
+        if (iobj != NULL) {
+            ival = PyLong_AsSsize_t(iobj);
+            Py_DECREF(iobj);
+        }
+        if (ival == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        offset = ival;
+    }
+skip_optional:
+    return_value = _asyncio__StreamBuffer_find_impl(self, separators, offset);
+
+exit:
+    return return_value;
+}
+
 PyDoc_STRVAR(_asyncio__get_running_loop__doc__,
 "_get_running_loop($module, /)\n"
 "--\n"
@@ -832,4 +1435,4 @@ _asyncio__leave_task(PyObject *module, PyObject *const *args, Py_ssize_t nargs,
 exit:
     return return_value;
 }
-/*[clinic end generated code: output=d0fc522bcbff9d61 input=a9049054013a1b77]*/
+/*[clinic end generated code: output=09452d0d1ddbdcbc input=a9049054013a1b77]*/
@@ -139,4 +139,62 @@ _bz2_BZ2Decompressor_decompress(BZ2Decompressor *self, PyObject *const *args, Py
 
     return return_value;
 }
-/*[clinic end generated code: output=ed10705d7a9fd598 input=a9049054013a1b77]*/
+
+PyDoc_STRVAR(_bz2_BZ2Decompressor_decompress_into__doc__,
+"decompress_into($self, data, buffer, /)\n"
+"--\n"
+"\n"
+"Decompress *data* into *buffer*, returning the number of bytes written.\n"
+"\n"
+"This behaves like decompress() with *max_length* set to the size of *buffer*,\n"
+"but writes the decompressed data directly into *buffer* instead of returning\n"
+"a new bytes object.");
+
+#define _BZ2_BZ2DECOMPRESSOR_DECOMPRESS_INTO_METHODDEF    \
+    {"decompress_into", (PyCFunction)(void(*)(void))_bz2_BZ2Decompressor_decompress_into, METH_FASTCALL, _bz2_BZ2Decompressor_decompress_into__doc__},
+
+static PyObject *
+_bz2_BZ2Decompressor_decompress_into_impl(BZ2Decompressor *self,
+                                          Py_buffer *data, Py_buffer *buffer);
+
+static PyObject *
+_bz2_BZ2Decompressor_decompress_into(BZ2Decompressor *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    Py_buffer data = {NULL, NULL};
+    Py_buffer buffer = {NULL, NULL};
+
+    if (!_PyArg_CheckPositional("decompress_into", nargs, 2, 2)) {
+        goto exit;
+    }
+    if (PyObject_GetBuffer(args[0], &data, PyBUF_SIMPLE) != 0) {
+        goto exit;
+    }
+    if (!PyBuffer_IsContiguous(&data, 'C')) {
+        _PyArg_BadArgument("decompress_into", "argument 1", "contiguous buffer", args[0]);
+        goto exit;
+    }
+    if (PyObject_GetBuffer(args[1], &buffer, PyBUF_WRITABLE) < 0) {
+        PyErr_Clear();
+        _PyArg_BadArgument("decompress_into", "argument 2", "read-write bytes-like object", args[1]);
+        goto exit;
+    }
+    if (!PyBuffer_IsContiguous(&buffer, 'C')) {
+        _PyArg_BadArgument("decompress_into", "argument 2", "contiguous buffer", args[1]);
+        goto exit;
+    }
+    return_value = _bz2_BZ2Decompressor_decompress_into_impl(self, &data, &buffer);
+
+exit:
+    /* Cleanup for data */
+    if (data.obj) {
+       PyBuffer_Release(&data);
+    }
+    /* Cleanup for buffer */
+    if (buffer.obj) {
+       PyBuffer_Release(&buffer);
+    }
+
+    return return_value;
+}
+/*[clinic end generated code: output=e6b9ddb0b0cc1cc5 input=a9049054013a1b77]*/
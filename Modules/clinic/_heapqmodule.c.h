@@ -265,4 +265,151 @@ _heapq__heapify_max(PyObject *module, PyObject *arg)
 exit:
     return return_value;
 }
-/*[clinic end generated code: output=9975cf51762878d5 input=a9049054013a1b77]*/
+
+PyDoc_STRVAR(_heapq_Heap_push__doc__,
+"push($self, item, /)\n"
+"--\n"
+"\n"
+"Push item onto the heap and return a handle to it.");
+
+#define _HEAPQ_HEAP_PUSH_METHODDEF    \
+    {"push", (PyCFunction)_heapq_Heap_push, METH_O, _heapq_Heap_push__doc__},
+
+PyDoc_STRVAR(_heapq_Heap_pushmany__doc__,
+"pushmany($self, iterable, /)\n"
+"--\n"
+"\n"
+"Push all items from iterable onto the heap.");
+
+#define _HEAPQ_HEAP_PUSHMANY_METHODDEF    \
+    {"pushmany", (PyCFunction)_heapq_Heap_pushmany, METH_O, _heapq_Heap_pushmany__doc__},
+
+PyDoc_STRVAR(_heapq_Heap_pop__doc__,
+"pop($self, /)\n"
+"--\n"
+"\n"
+"Pop the smallest item off the heap.");
+
+#define _HEAPQ_HEAP_POP_METHODDEF    \
+    {"pop", (PyCFunction)_heapq_Heap_pop, METH_NOARGS, _heapq_Heap_pop__doc__},
+
+static PyObject *
+_heapq_Heap_pop_impl(heapobject *self);
+
+static PyObject *
+_heapq_Heap_pop(heapobject *self, PyObject *Py_UNUSED(ignored))
+{
+    return _heapq_Heap_pop_impl(self);
+}
+
+PyDoc_STRVAR(_heapq_Heap_popmany__doc__,
+"popmany($self, n, /)\n"
+"--\n"
+"\n"
+"Pop up to n smallest items off the heap and return them as a sorted list.");
+
+#define _HEAPQ_HEAP_POPMANY_METHODDEF    \
+    {"popmany", (PyCFunction)_heapq_Heap_popmany, METH_O, _heapq_Heap_popmany__doc__},
+
+static PyObject *
+_heapq_Heap_popmany_impl(heapobject *self, Py_ssize_t n);
+
+static PyObject *
+_heapq_Heap_popmany(heapobject *self, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    Py_ssize_t n;
+
+    {
+        Py_ssize_t ival = -1;
+        PyObject *iobj = _PyNumber_Index(arg);
+        if (iobj != NULL) {
+            ival = PyLong_AsSsize_t(iobj);
+            Py_DECREF(iobj);
+        }
+        if (ival == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        n = ival;
+    }
+    return_value = _heapq_Heap_popmany_impl(self, n);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_heapq_Heap_peek__doc__,
+"peek($self, /)\n"
+"--\n"
+"\n"
+"Return the smallest item without removing it.");
+
+#define _HEAPQ_HEAP_PEEK_METHODDEF    \
+    {"peek", (PyCFunction)_heapq_Heap_peek, METH_NOARGS, _heapq_Heap_peek__doc__},
+
+static PyObject *
+_heapq_Heap_peek_impl(heapobject *self);
+
+static PyObject *
+_heapq_Heap_peek(heapobject *self, PyObject *Py_UNUSED(ignored))
+{
+    return _heapq_Heap_peek_impl(self);
+}
+
+PyDoc_STRVAR(_heapq_Heap_remove__doc__,
+"remove($self, handle, /)\n"
+"--\n"
+"\n"
+"Remove the item referred to by handle from the heap and return it.");
+
+#define _HEAPQ_HEAP_REMOVE_METHODDEF    \
+    {"remove", (PyCFunction)_heapq_Heap_remove, METH_O, _heapq_Heap_remove__doc__},
+
+PyDoc_STRVAR(_heapq_Heap_update__doc__,
+"update($self, handle, item, /)\n"
+"--\n"
+"\n"
+"Replace the item referred to by handle and restore the heap invariant.");
+
+#define _HEAPQ_HEAP_UPDATE_METHODDEF    \
+    {"update", (PyCFunction)(void(*)(void))_heapq_Heap_update, METH_FASTCALL, _heapq_Heap_update__doc__},
+
+static PyObject *
+_heapq_Heap_update_impl(heapobject *self, PyObject *handle, PyObject *item);
+
+static PyObject *
+_heapq_Heap_update(heapobject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyObject *handle;
+    PyObject *item;
+
+    if (!_PyArg_CheckPositional("update", nargs, 2, 2)) {
+        goto exit;
+    }
+    handle = args[0];
+    item = args[1];
+    return_value = _heapq_Heap_update_impl(self, handle, item);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_heapq_Heap_clear__doc__,
+"clear($self, /)\n"
+"--\n"
+"\n"
+"Remove all items from the heap.");
+
+#define _HEAPQ_HEAP_CLEAR_METHODDEF    \
+    {"clear", (PyCFunction)_heapq_Heap_clear, METH_NOARGS, _heapq_Heap_clear__doc__},
+
+static PyObject *
+_heapq_Heap_clear_impl(heapobject *self);
+
+static PyObject *
+_heapq_Heap_clear(heapobject *self, PyObject *Py_UNUSED(ignored))
+{
+    return _heapq_Heap_clear_impl(self);
+}
+/*[clinic end generated code: output=720f83a098bfcfdc input=a9049054013a1b77]*/
@@ -140,6 +140,65 @@ _lzma_LZMADecompressor_decompress(Decompressor *self, PyObject *const *args, Py_
     return return_value;
 }
 
+PyDoc_STRVAR(_lzma_LZMADecompressor_decompress_into__doc__,
+"decompress_into($self, data, buffer, /)\n"
+"--\n"
+"\n"
+"Decompress *data* into *buffer*, returning the number of bytes written.\n"
+"\n"
+"This behaves like decompress() with *max_length* set to the size of *buffer*,\n"
+"but writes the decompressed data directly into *buffer* instead of returning\n"
+"a new bytes object.");
+
+#define _LZMA_LZMADECOMPRESSOR_DECOMPRESS_INTO_METHODDEF    \
+    {"decompress_into", (PyCFunction)(void(*)(void))_lzma_LZMADecompressor_decompress_into, METH_FASTCALL, _lzma_LZMADecompressor_decompress_into__doc__},
+
+static PyObject *
+_lzma_LZMADecompressor_decompress_into_impl(Decompressor *self,
+                                            Py_buffer *data,
+                                            Py_buffer *buffer);
+
+static PyObject *
+_lzma_LZMADecompressor_decompress_into(Decompressor *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    Py_buffer data = {NULL, NULL};
+    Py_buffer buffer = {NULL, NULL};
+
+    if (!_PyArg_CheckPositional("decompress_into", nargs, 2, 2)) {
+        goto exit;
+    }
+    if (PyObject_GetBuffer(args[0], &data, PyBUF_SIMPLE) != 0) {
+        goto exit;
+    }
+    if (!PyBuffer_IsContiguous(&data, 'C')) {
+        _PyArg_BadArgument("decompress_into", "argument 1", "contiguous buffer", args[0]);
+        goto exit;
+    }
+    if (PyObject_GetBuffer(args[1], &buffer, PyBUF_WRITABLE) < 0) {
+        PyErr_Clear();
+        _PyArg_BadArgument("decompress_into", "argument 2", "read-write bytes-like object", args[1]);
+        goto exit;
+    }
+    if (!PyBuffer_IsContiguous(&buffer, 'C')) {
+        _PyArg_BadArgument("decompress_into", "argument 2", "contiguous buffer", args[1]);
+        goto exit;
+    }
+    return_value = _lzma_LZMADecompressor_decompress_into_impl(self, &data, &buffer);
+
+exit:
+    /* Cleanup for data */
+    if (data.obj) {
+       PyBuffer_Release(&data);
+    }
+    /* Cleanup for buffer */
+    if (buffer.obj) {
+       PyBuffer_Release(&buffer);
+    }
+
+    return return_value;
+}
+
 PyDoc_STRVAR(_lzma_LZMADecompressor___init____doc__,
 "LZMADecompressor(format=FORMAT_AUTO, memlimit=None, filters=None)\n"
 "--\n"
@@ -286,4 +345,4 @@ _lzma__decode_filter_properties(PyObject *module, PyObject *const *args, Py_ssiz
 
     return return_value;
 }
-/*[clinic end generated code: output=867b9e334053b679 input=a9049054013a1b77]*/
+/*[clinic end generated code: output=e5b99e1584dee9a7 input=a9049054013a1b77]*/
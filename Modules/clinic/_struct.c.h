@@ -162,6 +162,60 @@ PyDoc_STRVAR(Struct_iter_unpack__doc__,
 #define STRUCT_ITER_UNPACK_METHODDEF    \
     {"iter_unpack", (PyCFunction)Struct_iter_unpack, METH_O, Struct_iter_unpack__doc__},
 
+PyDoc_STRVAR(Struct_unpack_columns__doc__,
+"unpack_columns($self, buffer, /)\n"
+"--\n"
+"\n"
+"Return a tuple with one column per field of the records in buffer.\n"
+"\n"
+"The buffer\'s size in bytes must be a multiple of Struct.size.  Numeric,\n"
+"\'?\' and \'c\' fields are returned as memoryviews of native values over a\n"
+"new bytearray, \'s\' and \'p\' fields as lists of bytes objects.");
+
+#define STRUCT_UNPACK_COLUMNS_METHODDEF    \
+    {"unpack_columns", (PyCFunction)Struct_unpack_columns, METH_O, Struct_unpack_columns__doc__},
+
+static PyObject *
+Struct_unpack_columns_impl(PyStructObject *self, Py_buffer *buffer);
+
+static PyObject *
+Struct_unpack_columns(PyStructObject *self, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    Py_buffer buffer = {NULL, NULL};
+
+    if (PyObject_GetBuffer(arg, &buffer, PyBUF_SIMPLE) != 0) {
+        goto exit;
+    }
+    if (!PyBuffer_IsContiguous(&buffer, 'C')) {
+        _PyArg_BadArgument("unpack_columns", "argument", "contiguous buffer", arg);
+        goto exit;
+    }
+    return_value = Struct_unpack_columns_impl(self, &buffer);
+
+exit:
+    /* Cleanup for buffer */
+    if (buffer.obj) {
+       PyBuffer_Release(&buffer);
+    }
+
+    return return_value;
+}
+
+PyDoc_STRVAR(Struct_pack_columns__doc__,
+"pack_columns($self, columns, /)\n"
+"--\n"
+"\n"
+"Return a bytes object containing records packed from columns of values.\n"
+"\n"
+"columns is a sequence with one column per field, each holding the values\n"
+"of that field for all records; the columns must have the same length.\n"
+"Columns which are buffers with a matching native format, such as the ones\n"
+"returned by unpack_columns(), are packed without creating Python objects.");
+
+#define STRUCT_PACK_COLUMNS_METHODDEF    \
+    {"pack_columns", (PyCFunction)Struct_pack_columns, METH_O, Struct_pack_columns__doc__},
+
 PyDoc_STRVAR(_clearcache__doc__,
 "_clearcache($module, /)\n"
 "--\n"
@@ -376,4 +430,92 @@ iter_unpack(PyObject *module, PyObject *const *args, Py_ssize_t nargs)
 
     return return_value;
 }
-/*[clinic end generated code: output=a3d3cd900091cb1c input=a9049054013a1b77]*/
+
+PyDoc_STRVAR(unpack_columns__doc__,
+"unpack_columns($module, format, buffer, /)\n"
+"--\n"
+"\n"
+"Return a tuple of columns unpacked according to the format string.\n"
+"\n"
+"The buffer\'s size in bytes must be a multiple of calcsize(format).\n"
+"\n"
+"See help(struct) for more on format strings.");
+
+#define UNPACK_COLUMNS_METHODDEF    \
+    {"unpack_columns", (PyCFunction)(void(*)(void))unpack_columns, METH_FASTCALL, unpack_columns__doc__},
+
+static PyObject *
+unpack_columns_impl(PyObject *module, PyStructObject *s_object,
+                    Py_buffer *buffer);
+
+static PyObject *
+unpack_columns(PyObject *module, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyStructObject *s_object = NULL;
+    Py_buffer buffer = {NULL, NULL};
+
+    if (!_PyArg_CheckPositional("unpack_columns", nargs, 2, 2)) {
+        goto exit;
+    }
+    if (!cache_struct_converter(module, args[0], &s_object)) {
+        goto exit;
+    }
+    if (PyObject_GetBuffer(args[1], &buffer, PyBUF_SIMPLE) != 0) {
+        goto exit;
+    }
+    if (!PyBuffer_IsContiguous(&buffer, 'C')) {
+        _PyArg_BadArgument("unpack_columns", "argument 2", "contiguous buffer", args[1]);
+        goto exit;
+    }
+    return_value = unpack_columns_impl(module, s_object, &buffer);
+
+exit:
+    /* Cleanup for s_object */
+    Py_XDECREF(s_object);
+    /* Cleanup for buffer */
+    if (buffer.obj) {
+       PyBuffer_Release(&buffer);
+    }
+
+    return return_value;
+}
+
+PyDoc_STRVAR(pack_columns__doc__,
+"pack_columns($module, format, columns, /)\n"
+"--\n"
+"\n"
+"Return a bytes object containing records packed from columns of values.\n"
+"\n"
+"See help(struct) for more on format strings.");
+
+#define PACK_COLUMNS_METHODDEF    \
+    {"pack_columns", (PyCFunction)(void(*)(void))pack_columns, METH_FASTCALL, pack_columns__doc__},
+
+static PyObject *
+pack_columns_impl(PyObject *module, PyStructObject *s_object,
+                  PyObject *columns);
+
+static PyObject *
+pack_columns(PyObject *module, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyStructObject *s_object = NULL;
+    PyObject *columns;
+
+    if (!_PyArg_CheckPositional("pack_columns", nargs, 2, 2)) {
+        goto exit;
+    }
+    if (!cache_struct_converter(module, args[0], &s_object)) {
+        goto exit;
+    }
+    columns = args[1];
+    return_value = pack_columns_impl(module, s_object, columns);
+
+exit:
+    /* Cleanup for s_object */
+    Py_XDECREF(s_object);
+
+    return return_value;
+}
+/*[clinic end generated code: output=39a76c8f2f35f550 input=a9049054013a1b77]*/
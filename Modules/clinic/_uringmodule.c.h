@@ -0,0 +1,524 @@
+/*[clinic input]
+preserve
+[clinic start generated code]*/
+
+PyDoc_STRVAR(ring_new__doc__,
+"Ring(entries=256)\n"
+"--\n"
+"\n"
+"Create an io_uring instance with the given submission queue size.");
+
+static PyObject *
+ring_new_impl(PyTypeObject *type, unsigned int entries);
+
+static PyObject *
+ring_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+    PyObject *return_value = NULL;
+    static const char * const _keywords[] = {"entries", NULL};
+    static _PyArg_Parser _parser = {NULL, _keywords, "Ring", 0};
+    PyObject *argsbuf[1];
+    PyObject * const *fastargs;
+    Py_ssize_t nargs = PyTuple_GET_SIZE(args);
+    Py_ssize_t noptargs = nargs + (kwargs ? PyDict_GET_SIZE(kwargs) : 0) - 0;
+    unsigned int entries = 256;
+
+    fastargs = _PyArg_UnpackKeywords(_PyTuple_CAST(args)->ob_item, nargs, kwargs, NULL, &_parser, 0, 1, 0, argsbuf);
+    if (!fastargs) {
+        goto exit;
+    }
+    if (!noptargs) {
+        goto skip_optional_pos;
+    }
+    if (!_PyLong_UnsignedInt_Converter(fastargs[0], &entries)) {
+        goto exit;
+    }
+skip_optional_pos:
+    return_value = ring_new_impl(type, entries);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_Ring_recv__doc__,
+"recv($self, key, fd, nbytes, flags=0, /)\n"
+"--\n"
+"\n"
+"Queue a recv() of up to nbytes bytes from the socket fd.\n"
+"\n"
+"The completion value is the received bytes object.");
+
+#define _URING_RING_RECV_METHODDEF    \
+    {"recv", (PyCFunction)(void(*)(void))_uring_Ring_recv, METH_FASTCALL, _uring_Ring_recv__doc__},
+
+static PyObject *
+_uring_Ring_recv_impl(RingObject *self, PyObject *key, int fd,
+                      Py_ssize_t nbytes, int flags);
+
+static PyObject *
+_uring_Ring_recv(RingObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyObject *key;
+    int fd;
+    Py_ssize_t nbytes;
+    int flags = 0;
+
+    if (!_PyArg_CheckPositional("recv", nargs, 3, 4)) {
+        goto exit;
+    }
+    key = args[0];
+    fd = _PyLong_AsInt(args[1]);
+    if (fd == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    {
+        Py_ssize_t ival = -1;
+        PyObject *iobj = _PyNumber_Index(args[2]);
+        if (iobj != NULL) {
+            ival = PyLong_AsSsize_t(iobj);
+            Py_DECREF(iobj);
+        }
+        if (ival == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        nbytes = ival;
+    }
+    if (nargs < 4) {
+        goto skip_optional;
+    }
+    flags = _PyLong_AsInt(args[3]);
+    if (flags == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+skip_optional:
+    return_value = _uring_Ring_recv_impl(self, key, fd, nbytes, flags);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_Ring_recv_into__doc__,
+"recv_into($self, key, fd, buffer, flags=0, /)\n"
+"--\n"
+"\n"
+"Queue a recv() from the socket fd into a writable buffer.\n"
+"\n"
+"The completion result is the number of bytes received.");
+
+#define _URING_RING_RECV_INTO_METHODDEF    \
+    {"recv_into", (PyCFunction)(void(*)(void))_uring_Ring_recv_into, METH_FASTCALL, _uring_Ring_recv_into__doc__},
+
+static PyObject *
+_uring_Ring_recv_into_impl(RingObject *self, PyObject *key, int fd,
+                           PyObject *buffer, int flags);
+
+static PyObject *
+_uring_Ring_recv_into(RingObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyObject *key;
+    int fd;
+    PyObject *buffer;
+    int flags = 0;
+
+    if (!_PyArg_CheckPositional("recv_into", nargs, 3, 4)) {
+        goto exit;
+    }
+    key = args[0];
+    fd = _PyLong_AsInt(args[1]);
+    if (fd == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    buffer = args[2];
+    if (nargs < 4) {
+        goto skip_optional;
+    }
+    flags = _PyLong_AsInt(args[3]);
+    if (flags == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+skip_optional:
+    return_value = _uring_Ring_recv_into_impl(self, key, fd, buffer, flags);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_Ring_send__doc__,
+"send($self, key, fd, data, flags=0, /)\n"
+"--\n"
+"\n"
+"Queue a send() of a bytes-like object to the socket fd.\n"
+"\n"
+"The completion result is the number of bytes sent.");
+
+#define _URING_RING_SEND_METHODDEF    \
+    {"send", (PyCFunction)(void(*)(void))_uring_Ring_send, METH_FASTCALL, _uring_Ring_send__doc__},
+
+static PyObject *
+_uring_Ring_send_impl(RingObject *self, PyObject *key, int fd,
+                      PyObject *data, int flags);
+
+static PyObject *
+_uring_Ring_send(RingObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyObject *key;
+    int fd;
+    PyObject *data;
+    int flags = 0;
+
+    if (!_PyArg_CheckPositional("send", nargs, 3, 4)) {
+        goto exit;
+    }
+    key = args[0];
+    fd = _PyLong_AsInt(args[1]);
+    if (fd == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    data = args[2];
+    if (nargs < 4) {
+        goto skip_optional;
+    }
+    flags = _PyLong_AsInt(args[3]);
+    if (flags == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+skip_optional:
+    return_value = _uring_Ring_send_impl(self, key, fd, data, flags);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_Ring_read__doc__,
+"read($self, key, fd, nbytes, offset=-1, /)\n"
+"--\n"
+"\n"
+"Queue a read() of up to nbytes bytes from fd.\n"
+"\n"
+"An offset of -1 reads from the current file position.  The completion\n"
+"value is the bytes object read.");
+
+#define _URING_RING_READ_METHODDEF    \
+    {"read", (PyCFunction)(void(*)(void))_uring_Ring_read, METH_FASTCALL, _uring_Ring_read__doc__},
+
+static PyObject *
+_uring_Ring_read_impl(RingObject *self, PyObject *key, int fd,
+                      Py_ssize_t nbytes, long long offset);
+
+static PyObject *
+_uring_Ring_read(RingObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyObject *key;
+    int fd;
+    Py_ssize_t nbytes;
+    long long offset = -1;
+
+    if (!_PyArg_CheckPositional("read", nargs, 3, 4)) {
+        goto exit;
+    }
+    key = args[0];
+    fd = _PyLong_AsInt(args[1]);
+    if (fd == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    {
+        Py_ssize_t ival = -1;
+        PyObject *iobj = _PyNumber_Index(args[2]);
+        if (iobj != NULL) {
+            ival = PyLong_AsSsize_t(iobj);
+            Py_DECREF(iobj);
+        }
+        if (ival == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        nbytes = ival;
+    }
+    if (nargs < 4) {
+        goto skip_optional;
+    }
+    offset = PyLong_AsLongLong(args[3]);
+    if (offset == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+skip_optional:
+    return_value = _uring_Ring_read_impl(self, key, fd, nbytes, offset);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_Ring_write__doc__,
+"write($self, key, fd, data, offset=-1, /)\n"
+"--\n"
+"\n"
+"Queue a write() of a bytes-like object to fd.\n"
+"\n"
+"An offset of -1 writes at the current file position.  The completion\n"
+"result is the number of bytes written.");
+
+#define _URING_RING_WRITE_METHODDEF    \
+    {"write", (PyCFunction)(void(*)(void))_uring_Ring_write, METH_FASTCALL, _uring_Ring_write__doc__},
+
+static PyObject *
+_uring_Ring_write_impl(RingObject *self, PyObject *key, int fd,
+                       PyObject *data, long long offset);
+
+static PyObject *
+_uring_Ring_write(RingObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyObject *key;
+    int fd;
+    PyObject *data;
+    long long offset = -1;
+
+    if (!_PyArg_CheckPositional("write", nargs, 3, 4)) {
+        goto exit;
+    }
+    key = args[0];
+    fd = _PyLong_AsInt(args[1]);
+    if (fd == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    data = args[2];
+    if (nargs < 4) {
+        goto skip_optional;
+    }
+    offset = PyLong_AsLongLong(args[3]);
+    if (offset == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+skip_optional:
+    return_value = _uring_Ring_write_impl(self, key, fd, data, offset);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_Ring_accept__doc__,
+"accept($self, key, fd, flags=0, /)\n"
+"--\n"
+"\n"
+"Queue an accept4() on the listening socket fd.\n"
+"\n"
+"The completion result is the file descriptor of the new connection.");
+
+#define _URING_RING_ACCEPT_METHODDEF    \
+    {"accept", (PyCFunction)(void(*)(void))_uring_Ring_accept, METH_FASTCALL, _uring_Ring_accept__doc__},
+
+static PyObject *
+_uring_Ring_accept_impl(RingObject *self, PyObject *key, int fd, int flags);
+
+static PyObject *
+_uring_Ring_accept(RingObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyObject *key;
+    int fd;
+    int flags = 0;
+
+    if (!_PyArg_CheckPositional("accept", nargs, 2, 3)) {
+        goto exit;
+    }
+    key = args[0];
+    fd = _PyLong_AsInt(args[1]);
+    if (fd == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    if (nargs < 3) {
+        goto skip_optional;
+    }
+    flags = _PyLong_AsInt(args[2]);
+    if (flags == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+skip_optional:
+    return_value = _uring_Ring_accept_impl(self, key, fd, flags);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_Ring_poll__doc__,
+"poll($self, key, fd, events, /)\n"
+"--\n"
+"\n"
+"Queue a one-shot poll of fd for the given poll events.\n"
+"\n"
+"The completion result is the mask of events which are ready.");
+
+#define _URING_RING_POLL_METHODDEF    \
+    {"poll", (PyCFunction)(void(*)(void))_uring_Ring_poll, METH_FASTCALL, _uring_Ring_poll__doc__},
+
+static PyObject *
+_uring_Ring_poll_impl(RingObject *self, PyObject *key, int fd,
+                      unsigned int events);
+
+static PyObject *
+_uring_Ring_poll(RingObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyObject *key;
+    int fd;
+    unsigned int events;
+
+    if (!_PyArg_CheckPositional("poll", nargs, 3, 3)) {
+        goto exit;
+    }
+    key = args[0];
+    fd = _PyLong_AsInt(args[1]);
+    if (fd == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    events = (unsigned int)PyLong_AsUnsignedLongMask(args[2]);
+    if (events == (unsigned int)-1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = _uring_Ring_poll_impl(self, key, fd, events);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_Ring_timeout__doc__,
+"timeout($self, key, seconds, /)\n"
+"--\n"
+"\n"
+"Queue a timer which completes after the given number of seconds.");
+
+#define _URING_RING_TIMEOUT_METHODDEF    \
+    {"timeout", (PyCFunction)(void(*)(void))_uring_Ring_timeout, METH_FASTCALL, _uring_Ring_timeout__doc__},
+
+static PyObject *
+_uring_Ring_timeout_impl(RingObject *self, PyObject *key, PyObject *seconds);
+
+static PyObject *
+_uring_Ring_timeout(RingObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyObject *key;
+    PyObject *seconds;
+
+    if (!_PyArg_CheckPositional("timeout", nargs, 2, 2)) {
+        goto exit;
+    }
+    key = args[0];
+    seconds = args[1];
+    return_value = _uring_Ring_timeout_impl(self, key, seconds);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_Ring_cancel__doc__,
+"cancel($self, operation, /)\n"
+"--\n"
+"\n"
+"Request the cancellation of an in-flight operation.\n"
+"\n"
+"The request is submitted immediately.  The operation still completes,\n"
+"usually with -ECANCELED as its result.  Operations which already\n"
+"completed are ignored.");
+
+#define _URING_RING_CANCEL_METHODDEF    \
+    {"cancel", (PyCFunction)_uring_Ring_cancel, METH_O, _uring_Ring_cancel__doc__},
+
+PyDoc_STRVAR(_uring_Ring_submit__doc__,
+"submit($self, /)\n"
+"--\n"
+"\n"
+"Submit the queued operations without waiting for completions.\n"
+"\n"
+"Return the number of submitted operations.");
+
+#define _URING_RING_SUBMIT_METHODDEF    \
+    {"submit", (PyCFunction)_uring_Ring_submit, METH_NOARGS, _uring_Ring_submit__doc__},
+
+static PyObject *
+_uring_Ring_submit_impl(RingObject *self);
+
+static PyObject *
+_uring_Ring_submit(RingObject *self, PyObject *Py_UNUSED(ignored))
+{
+    return _uring_Ring_submit_impl(self);
+}
+
+PyDoc_STRVAR(_uring_Ring_wait__doc__,
+"wait($self, timeout=None, /)\n"
+"--\n"
+"\n"
+"Submit the queued operations and wait for completions.\n"
+"\n"
+"Wait at most timeout seconds, or forever if timeout is None, for at least\n"
+"one completion.  Return a list of (key, result, value) tuples; a negative\n"
+"result is a negated errno value.");
+
+#define _URING_RING_WAIT_METHODDEF    \
+    {"wait", (PyCFunction)(void(*)(void))_uring_Ring_wait, METH_FASTCALL, _uring_Ring_wait__doc__},
+
+static PyObject *
+_uring_Ring_wait_impl(RingObject *self, PyObject *timeout_obj);
+
+static PyObject *
+_uring_Ring_wait(RingObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyObject *timeout_obj = Py_None;
+
+    if (!_PyArg_CheckPositional("wait", nargs, 0, 1)) {
+        goto exit;
+    }
+    if (nargs < 1) {
+        goto skip_optional;
+    }
+    timeout_obj = args[0];
+skip_optional:
+    return_value = _uring_Ring_wait_impl(self, timeout_obj);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_uring_Ring_close__doc__,
+"close($self, /)\n"
+"--\n"
+"\n"
+"Cancel the in-flight operations and close the ring.\n"
+"\n"
+"Wait until the kernel has released the buffers of the in-flight\n"
+"operations and return their completions, like wait() does.");
+
+#define _URING_RING_CLOSE_METHODDEF    \
+    {"close", (PyCFunction)_uring_Ring_close, METH_NOARGS, _uring_Ring_close__doc__},
+
+static PyObject *
+_uring_Ring_close_impl(RingObject *self);
+
+static PyObject *
+_uring_Ring_close(RingObject *self, PyObject *Py_UNUSED(ignored))
+{
+    return _uring_Ring_close_impl(self);
+}
+
+PyDoc_STRVAR(_uring_Ring_fileno__doc__,
+"fileno($self, /)\n"
+"--\n"
+"\n"
+"Return the file descriptor of the ring.");
+
+#define _URING_RING_FILENO_METHODDEF    \
+    {"fileno", (PyCFunction)_uring_Ring_fileno, METH_NOARGS, _uring_Ring_fileno__doc__},
+
+static PyObject *
+_uring_Ring_fileno_impl(RingObject *self);
+
+static PyObject *
+_uring_Ring_fileno(RingObject *self, PyObject *Py_UNUSED(ignored))
+{
+    return _uring_Ring_fileno_impl(self);
+}
+/*[clinic end generated code: output=a70141e2396101b1 input=a9049054013a1b77]*/
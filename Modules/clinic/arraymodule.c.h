@@ -260,6 +260,163 @@ array_array_byteswap(arrayobject *self, PyObject *Py_UNUSED(ignored))
     return array_array_byteswap_impl(self);
 }
 
+PyDoc_STRVAR(array_array_sum__doc__,
+"sum($self, /)\n"
+"--\n"
+"\n"
+"Return the sum of the items of the array.\n"
+"\n"
+"The result is an int for integer arrays and a float for floating point\n"
+"arrays.  Floating point items are added in double precision.");
+
+#define ARRAY_ARRAY_SUM_METHODDEF    \
+    {"sum", (PyCFunction)array_array_sum, METH_NOARGS, array_array_sum__doc__},
+
+static PyObject *
+array_array_sum_impl(arrayobject *self);
+
+static PyObject *
+array_array_sum(arrayobject *self, PyObject *Py_UNUSED(ignored))
+{
+    return array_array_sum_impl(self);
+}
+
+PyDoc_STRVAR(array_array_min__doc__,
+"min($self, /)\n"
+"--\n"
+"\n"
+"Return the smallest item of the array.\n"
+"\n"
+"Raise ValueError if the array is empty.");
+
+#define ARRAY_ARRAY_MIN_METHODDEF    \
+    {"min", (PyCFunction)array_array_min, METH_NOARGS, array_array_min__doc__},
+
+static PyObject *
+array_array_min_impl(arrayobject *self);
+
+static PyObject *
+array_array_min(arrayobject *self, PyObject *Py_UNUSED(ignored))
+{
+    return array_array_min_impl(self);
+}
+
+PyDoc_STRVAR(array_array_max__doc__,
+"max($self, /)\n"
+"--\n"
+"\n"
+"Return the largest item of the array.\n"
+"\n"
+"Raise ValueError if the array is empty.");
+
+#define ARRAY_ARRAY_MAX_METHODDEF    \
+    {"max", (PyCFunction)array_array_max, METH_NOARGS, array_array_max__doc__},
+
+static PyObject *
+array_array_max_impl(arrayobject *self);
+
+static PyObject *
+array_array_max(arrayobject *self, PyObject *Py_UNUSED(ignored))
+{
+    return array_array_max_impl(self);
+}
+
+PyDoc_STRVAR(array_array_dot__doc__,
+"dot($self, other, /)\n"
+"--\n"
+"\n"
+"Return the sum of the products of corresponding items of two arrays.\n"
+"\n"
+"Both arrays must have the same type code and length.");
+
+#define ARRAY_ARRAY_DOT_METHODDEF    \
+    {"dot", (PyCFunction)array_array_dot, METH_O, array_array_dot__doc__},
+
+PyDoc_STRVAR(array_array_add__doc__,
+"add($self, other, /)\n"
+"--\n"
+"\n"
+"Return a new array with other added to each item.\n"
+"\n"
+"other may be a number, which is added to every item, or an array of the\n"
+"same type code and length, which is added item by item.  Raise OverflowError\n"
+"if a result does not fit the type code.");
+
+#define ARRAY_ARRAY_ADD_METHODDEF    \
+    {"add", (PyCFunction)array_array_add, METH_O, array_array_add__doc__},
+
+PyDoc_STRVAR(array_array_mul__doc__,
+"mul($self, other, /)\n"
+"--\n"
+"\n"
+"Return a new array with each item multiplied by other.\n"
+"\n"
+"other may be a number, which multiplies every item, or an array of the same\n"
+"type code and length, which is multiplied item by item.  Raise OverflowError\n"
+"if a result does not fit the type code.");
+
+#define ARRAY_ARRAY_MUL_METHODDEF    \
+    {"mul", (PyCFunction)array_array_mul, METH_O, array_array_mul__doc__},
+
+PyDoc_STRVAR(array_array_cumsum__doc__,
+"cumsum($self, /)\n"
+"--\n"
+"\n"
+"Return a new array of the running totals of the items.\n"
+"\n"
+"Raise OverflowError if a total does not fit the type code.");
+
+#define ARRAY_ARRAY_CUMSUM_METHODDEF    \
+    {"cumsum", (PyCFunction)array_array_cumsum, METH_NOARGS, array_array_cumsum__doc__},
+
+static PyObject *
+array_array_cumsum_impl(arrayobject *self);
+
+static PyObject *
+array_array_cumsum(arrayobject *self, PyObject *Py_UNUSED(ignored))
+{
+    return array_array_cumsum_impl(self);
+}
+
+PyDoc_STRVAR(array_array_astype__doc__,
+"astype($self, typecode, /)\n"
+"--\n"
+"\n"
+"Return a new array with the items converted to another type code.\n"
+"\n"
+"Raise OverflowError if an item does not fit the new type code, and TypeError\n"
+"when converting floating point items to an integer type code.");
+
+#define ARRAY_ARRAY_ASTYPE_METHODDEF    \
+    {"astype", (PyCFunction)array_array_astype, METH_O, array_array_astype__doc__},
+
+static PyObject *
+array_array_astype_impl(arrayobject *self, int typecode);
+
+static PyObject *
+array_array_astype(arrayobject *self, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    int typecode;
+
+    if (!PyUnicode_Check(arg)) {
+        _PyArg_BadArgument("astype", "argument", "a unicode character", arg);
+        goto exit;
+    }
+    if (PyUnicode_READY(arg)) {
+        goto exit;
+    }
+    if (PyUnicode_GET_LENGTH(arg) != 1) {
+        _PyArg_BadArgument("astype", "argument", "a unicode character", arg);
+        goto exit;
+    }
+    typecode = PyUnicode_READ_CHAR(arg, 0);
+    return_value = array_array_astype_impl(self, typecode);
+
+exit:
+    return return_value;
+}
+
 PyDoc_STRVAR(array_array_reverse__doc__,
 "reverse($self, /)\n"
 "--\n"
@@ -572,4 +729,4 @@ PyDoc_STRVAR(array_arrayiterator___setstate____doc__,
 
 #define ARRAY_ARRAYITERATOR___SETSTATE___METHODDEF    \
     {"__setstate__", (PyCFunction)array_arrayiterator___setstate__, METH_O, array_arrayiterator___setstate____doc__},
-/*[clinic end generated code: output=376001addedc67ee input=a9049054013a1b77]*/
+/*[clinic end generated code: output=6216442f1aa298ce input=a9049054013a1b77]*/
@@ -8412,7 +8412,7 @@ os_DirEntry___fspath__(DirEntry *self, PyObject *Py_UNUSED(ignored))
 }
 
 PyDoc_STRVAR(os_scandir__doc__,
-"scandir($module, /, path=None)\n"
+"scandir($module, /, path=None, *, stat=False)\n"
 "--\n"
 "\n"
 "Return an iterator of DirEntry objects for given path.\n"
@@ -8421,23 +8421,27 @@ PyDoc_STRVAR(os_scandir__doc__,
 "is bytes, the names of yielded DirEntry objects will also be bytes; in\n"
 "all other circumstances they will be str.\n"
 "\n"
-"If path is None, uses the path=\'.\'.");
+"If path is None, uses the path=\'.\'.\n"
+"\n"
+"If stat is true, the entries are stat\'ed as the directory is read, so that\n"
+"DirEntry.stat() does not need a system call for them.");
 
 #define OS_SCANDIR_METHODDEF    \
     {"scandir", (PyCFunction)(void(*)(void))os_scandir, METH_FASTCALL|METH_KEYWORDS, os_scandir__doc__},
 
 static PyObject *
-os_scandir_impl(PyObject *module, path_t *path);
+os_scandir_impl(PyObject *module, path_t *path, int prefetch_stat);
 
 static PyObject *
 os_scandir(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
 {
     PyObject *return_value = NULL;
-    static const char * const _keywords[] = {"path", NULL};
+    static const char * const _keywords[] = {"path", "stat", NULL};
     static _PyArg_Parser _parser = {NULL, _keywords, "scandir", 0};
-    PyObject *argsbuf[1];
+    PyObject *argsbuf[2];
     Py_ssize_t noptargs = nargs + (kwnames ? PyTuple_GET_SIZE(kwnames) : 0) - 0;
     path_t path = PATH_T_INITIALIZE("scandir", "path", 1, PATH_HAVE_FDOPENDIR);
+    int prefetch_stat = 0;
 
     args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser, 0, 1, 0, argsbuf);
     if (!args) {
@@ -8446,11 +8450,24 @@ os_scandir(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObject *
     if (!noptargs) {
         goto skip_optional_pos;
     }
-    if (!path_converter(args[0], &path)) {
-        goto exit;
+    if (args[0]) {
+        if (!path_converter(args[0], &path)) {
+            goto exit;
+        }
+        if (!--noptargs) {
+            goto skip_optional_pos;
+        }
     }
 skip_optional_pos:
-    return_value = os_scandir_impl(module, &path);
+    if (!noptargs) {
+        goto skip_optional_kwonly;
+    }
+    prefetch_stat = PyObject_IsTrue(args[1]);
+    if (prefetch_stat < 0) {
+        goto exit;
+    }
+skip_optional_kwonly:
+    return_value = os_scandir_impl(module, &path, prefetch_stat);
 
 exit:
     /* Cleanup for path */
@@ -9263,4 +9280,4 @@ os_waitstatus_to_exitcode(PyObject *module, PyObject *const *args, Py_ssize_t na
 #ifndef OS_WAITSTATUS_TO_EXITCODE_METHODDEF
     #define OS_WAITSTATUS_TO_EXITCODE_METHODDEF
 #endif /* !defined(OS_WAITSTATUS_TO_EXITCODE_METHODDEF) */
-/*[clinic end generated code: output=65a85d7d3f2c487e input=a9049054013a1b77]*/
+/*[clinic end generated code: output=d2a8eefb0a6f4b31 input=a9049054013a1b77]*/
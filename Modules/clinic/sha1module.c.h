@@ -126,4 +126,15 @@ _sha1_sha1(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObject *
 exit:
     return return_value;
 }
-/*[clinic end generated code: output=abf1ab2545cea5a2 input=a9049054013a1b77]*/
+
+PyDoc_STRVAR(_sha1_sha1_many__doc__,
+"sha1_many($module, messages, /)\n"
+"--\n"
+"\n"
+"Return a list of the SHA1 digests of each bytes-like object in messages.\n"
+"\n"
+"The GIL is released once while all of the messages are hashed.");
+
+#define _SHA1_SHA1_MANY_METHODDEF    \
+    {"sha1_many", (PyCFunction)_sha1_sha1_many, METH_O, _sha1_sha1_many__doc__},
+/*[clinic end generated code: output=88fa560e5b0cd3c2 input=a9049054013a1b77]*/
@@ -177,4 +177,26 @@ _sha256_sha224(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObje
 exit:
     return return_value;
 }
-/*[clinic end generated code: output=b7283f75c9d08f30 input=a9049054013a1b77]*/
+
+PyDoc_STRVAR(_sha256_sha256_many__doc__,
+"sha256_many($module, messages, /)\n"
+"--\n"
+"\n"
+"Return a list of the SHA-256 digests of each bytes-like object in messages.\n"
+"\n"
+"The GIL is released once while all of the messages are hashed.");
+
+#define _SHA256_SHA256_MANY_METHODDEF    \
+    {"sha256_many", (PyCFunction)_sha256_sha256_many, METH_O, _sha256_sha256_many__doc__},
+
+PyDoc_STRVAR(_sha256_sha224_many__doc__,
+"sha224_many($module, messages, /)\n"
+"--\n"
+"\n"
+"Return a list of the SHA-224 digests of each bytes-like object in messages.\n"
+"\n"
+"The GIL is released once while all of the messages are hashed.");
+
+#define _SHA256_SHA224_MANY_METHODDEF    \
+    {"sha224_many", (PyCFunction)_sha256_sha224_many, METH_O, _sha256_sha224_many__doc__},
+/*[clinic end generated code: output=a8918ee276be8466 input=a9049054013a1b77]*/
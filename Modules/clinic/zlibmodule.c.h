@@ -60,6 +60,140 @@ zlib_compress(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObjec
     return return_value;
 }
 
+PyDoc_STRVAR(zlib_deflate_parallel__doc__,
+"deflate_parallel($module, data, /, level=Z_DEFAULT_COMPRESSION, *,\n"
+"                 threads=1, blocksize=131072, zdict=None, finish=True)\n"
+"--\n"
+"\n"
+"Compress data into a raw deflate stream using multiple threads.\n"
+"\n"
+"  data\n"
+"    Binary data to be compressed.\n"
+"  level\n"
+"    Compression level, in 0-9 or -1.\n"
+"  threads\n"
+"    Number of threads to compress with, including the calling thread.\n"
+"  blocksize\n"
+"    Size of the independently compressed blocks of input.\n"
+"  zdict\n"
+"    Data preceding *data* in the stream; its last 32 KiB are used as the\n"
+"    preset dictionary of the first block.\n"
+"  finish\n"
+"    If true, end the stream; otherwise end with a sync flush so that\n"
+"    more data can be appended with another call.\n"
+"\n"
+"The result has no zlib or gzip header or trailer.  It can be decompressed\n"
+"with wbits=-15, and concatenating the results of consecutive calls with\n"
+"finish=False, followed by one call with finish=True, forms a single stream.");
+
+#define ZLIB_DEFLATE_PARALLEL_METHODDEF    \
+    {"deflate_parallel", (PyCFunction)(void(*)(void))zlib_deflate_parallel, METH_FASTCALL|METH_KEYWORDS, zlib_deflate_parallel__doc__},
+
+static PyObject *
+zlib_deflate_parallel_impl(PyObject *module, Py_buffer *data, int level,
+                           int threads, Py_ssize_t blocksize,
+                           Py_buffer *zdict, int finish);
+
+static PyObject *
+zlib_deflate_parallel(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    static const char * const _keywords[] = {"", "level", "threads", "blocksize", "zdict", "finish", NULL};
+    static _PyArg_Parser _parser = {NULL, _keywords, "deflate_parallel", 0};
+    PyObject *argsbuf[6];
+    Py_ssize_t noptargs = nargs + (kwnames ? PyTuple_GET_SIZE(kwnames) : 0) - 1;
+    Py_buffer data = {NULL, NULL};
+    int level = Z_DEFAULT_COMPRESSION;
+    int threads = 1;
+    Py_ssize_t blocksize = PARALLEL_BLOCK_SIZE;
+    Py_buffer zdict = {NULL, NULL};
+    int finish = 1;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser, 1, 2, 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    if (PyObject_GetBuffer(args[0], &data, PyBUF_SIMPLE) != 0) {
+        goto exit;
+    }
+    if (!PyBuffer_IsContiguous(&data, 'C')) {
+        _PyArg_BadArgument("deflate_parallel", "argument 1", "contiguous buffer", args[0]);
+        goto exit;
+    }
+    if (!noptargs) {
+        goto skip_optional_pos;
+    }
+    if (args[1]) {
+        level = _PyLong_AsInt(args[1]);
+        if (level == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        if (!--noptargs) {
+            goto skip_optional_pos;
+        }
+    }
+skip_optional_pos:
+    if (!noptargs) {
+        goto skip_optional_kwonly;
+    }
+    if (args[2]) {
+        threads = _PyLong_AsInt(args[2]);
+        if (threads == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        if (!--noptargs) {
+            goto skip_optional_kwonly;
+        }
+    }
+    if (args[3]) {
+        {
+            Py_ssize_t ival = -1;
+            PyObject *iobj = _PyNumber_Index(args[3]);
+            if (iobj != NULL) {
+                ival = PyLong_AsSsize_t(iobj);
+                Py_DECREF(iobj);
+            }
+            if (ival == -1 && PyErr_Occurred()) {
+                goto exit;
+            }
+            blocksize = ival;
+        }
+        if (!--noptargs) {
+            goto skip_optional_kwonly;
+        }
+    }
+    if (args[4]) {
+        if (PyObject_GetBuffer(args[4], &zdict, PyBUF_SIMPLE) != 0) {
+            goto exit;
+        }
+        if (!PyBuffer_IsContiguous(&zdict, 'C')) {
+            _PyArg_BadArgument("deflate_parallel", "argument 'zdict'", "contiguous buffer", args[4]);
+            goto exit;
+        }
+        if (!--noptargs) {
+            goto skip_optional_kwonly;
+        }
+    }
+    finish = _PyLong_AsInt(args[5]);
+    if (finish == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+skip_optional_kwonly:
+    return_value = zlib_deflate_parallel_impl(module, &data, level, threads, blocksize, &zdict, finish);
+
+exit:
+    /* Cleanup for data */
+    if (data.obj) {
+       PyBuffer_Release(&data);
+    }
+    /* Cleanup for zdict */
+    if (zdict.obj) {
+       PyBuffer_Release(&zdict);
+    }
+
+    return return_value;
+}
+
 PyDoc_STRVAR(zlib_decompress__doc__,
 "decompress($module, data, /, wbits=MAX_WBITS, bufsize=DEF_BUF_SIZE)\n"
 "--\n"
@@ -406,6 +540,56 @@ zlib_Decompress_decompress(compobject *self, PyTypeObject *cls, PyObject *const
     return return_value;
 }
 
+PyDoc_STRVAR(zlib_Decompress_decompress_into__doc__,
+"decompress_into($self, data, buffer, /)\n"
+"--\n"
+"\n"
+"Decompress data into buffer and return the number of bytes written.\n"
+"\n"
+"  data\n"
+"    The binary data to decompress.\n"
+"  buffer\n"
+"    A writable buffer that receives the decompressed data.\n"
+"\n"
+"Decompression stops when buffer is full, in which case unconsumed input\n"
+"data is stored in the unconsumed_tail attribute, as for decompress() with\n"
+"max_length set to the size of buffer.");
+
+#define ZLIB_DECOMPRESS_DECOMPRESS_INTO_METHODDEF    \
+    {"decompress_into", (PyCFunction)(void(*)(void))zlib_Decompress_decompress_into, METH_METHOD|METH_FASTCALL|METH_KEYWORDS, zlib_Decompress_decompress_into__doc__},
+
+static PyObject *
+zlib_Decompress_decompress_into_impl(compobject *self, PyTypeObject *cls,
+                                     Py_buffer *data, Py_buffer *buffer);
+
+static PyObject *
+zlib_Decompress_decompress_into(compobject *self, PyTypeObject *cls, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    static const char * const _keywords[] = {"", "", NULL};
+    static _PyArg_Parser _parser = {"y*w*:decompress_into", _keywords, 0};
+    Py_buffer data = {NULL, NULL};
+    Py_buffer buffer = {NULL, NULL};
+
+    if (!_PyArg_ParseStackAndKeywords(args, nargs, kwnames, &_parser,
+        &data, &buffer)) {
+        goto exit;
+    }
+    return_value = zlib_Decompress_decompress_into_impl(self, cls, &data, &buffer);
+
+exit:
+    /* Cleanup for data */
+    if (data.obj) {
+       PyBuffer_Release(&data);
+    }
+    /* Cleanup for buffer */
+    if (buffer.obj) {
+       PyBuffer_Release(&buffer);
+    }
+
+    return return_value;
+}
+
 PyDoc_STRVAR(zlib_Compress_flush__doc__,
 "flush($self, mode=zlib.Z_FINISH, /)\n"
 "--\n"
@@ -803,4 +987,4 @@ zlib_crc32(PyObject *module, PyObject *const *args, Py_ssize_t nargs)
 #ifndef ZLIB_DECOMPRESS___DEEPCOPY___METHODDEF
     #define ZLIB_DECOMPRESS___DEEPCOPY___METHODDEF
 #endif /* !defined(ZLIB_DECOMPRESS___DEEPCOPY___METHODDEF) */
-/*[clinic end generated code: output=6736bae59fab268b input=a9049054013a1b77]*/
+/*[clinic end generated code: output=f8131aa22d33e131 input=a9049054013a1b77]*/
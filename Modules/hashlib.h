@@ -57,3 +57,107 @@
  * to allow the user to optimize based on the platform they're using. */
 #define HASHLIB_GIL_MINSIZE 2048
 
+
+/*
+ * The x86 SHA extensions.  Functions using them are compiled with
+ * HASHLIB_SHANI_TARGET and must only be called if hashlib_cpu_has_shani()
+ * returned true, so the rest of the module still runs on any CPU.
+ */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) \
+    && (defined(__clang__) || __GNUC__ >= 5)
+#include <cpuid.h>
+#include <immintrin.h>
+#define HASHLIB_HAVE_SHANI 1
+#define HASHLIB_SHANI_TARGET __attribute__((target("sha,sse4.1")))
+
+static inline int
+hashlib_cpu_has_shani(void)
+{
+    unsigned int eax, ebx, ecx, edx;
+
+    if (__get_cpuid_max(0, NULL) < 7) {
+        return 0;
+    }
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    if (!(ebx & (1 << 29))) {
+        return 0;
+    }
+    __cpuid(1, eax, ebx, ecx, edx);
+    return (ecx & bit_SSSE3) && (ecx & bit_SSE4_1);
+}
+#endif
+
+/*
+ * Hash each bytes-like object of the iterable messages with digest(), which
+ * writes digest_size bytes, and return a list of the digests as bytes.  All
+ * buffers are acquired up front so that the GIL is released only once.
+ */
+typedef void (*hashlib_digest_func)(const unsigned char *buf, Py_ssize_t len,
+                                    unsigned char *digest);
+
+static inline PyObject *
+hashlib_hash_many(PyObject *messages, Py_ssize_t digest_size,
+                  hashlib_digest_func digest)
+{
+    PyObject *seq, *result = NULL;
+    Py_buffer *views = NULL;
+    unsigned char *digests = NULL;
+    Py_ssize_t n, i, acquired = 0, total = 0;
+
+    seq = PySequence_Fast(messages, "messages must be iterable");
+    if (seq == NULL) {
+        return NULL;
+    }
+    n = PySequence_Fast_GET_SIZE(seq);
+    if (n > PY_SSIZE_T_MAX / digest_size) {
+        PyErr_NoMemory();
+        goto error;
+    }
+    views = PyMem_New(Py_buffer, n);
+    digests = PyMem_Malloc(n * digest_size);
+    if (views == NULL || digests == NULL) {
+        PyErr_NoMemory();
+        goto error;
+    }
+    for (; acquired < n; acquired++) {
+        PyObject *obj = PySequence_Fast_GET_ITEM(seq, acquired);
+        GET_BUFFER_VIEW_OR_ERROR(obj, &views[acquired], goto error);
+        total += views[acquired].len;
+    }
+
+    if (total >= HASHLIB_GIL_MINSIZE) {
+        Py_BEGIN_ALLOW_THREADS
+        for (i = 0; i < n; i++) {
+            digest(views[i].buf, views[i].len, digests + i * digest_size);
+        }
+        Py_END_ALLOW_THREADS
+    }
+    else {
+        for (i = 0; i < n; i++) {
+            digest(views[i].buf, views[i].len, digests + i * digest_size);
+        }
+    }
+
+    result = PyList_New(n);
+    if (result == NULL) {
+        goto error;
+    }
+    for (i = 0; i < n; i++) {
+        PyObject *item = PyBytes_FromStringAndSize(
+            (char *)digests + i * digest_size, digest_size);
+        if (item == NULL) {
+            Py_CLEAR(result);
+            goto error;
+        }
+        PyList_SET_ITEM(result, i, item);
+    }
+
+  error:
+    for (i = 0; i < acquired; i++) {
+        PyBuffer_Release(&views[i]);
+    }
+    PyMem_Free(views);
+    PyMem_Free(digests);
+    Py_DECREF(seq);
+    return result;
+}
@@ -116,8 +116,11 @@ typedef struct {
 
 typedef struct {
     PyTypeObject *mmap_object_type;
+    PyTypeObject *mmap_lines_type;
 } mmap_state;
 
+static struct PyModuleDef mmapmodule;
+
 static mmap_state *
 get_mmap_state(PyObject *module)
 {
@@ -303,10 +306,7 @@ mmap_gfind(mmap_object *self,
                           &view, &start, &end)) {
         return NULL;
     } else {
-        const char *p, *start_p, *end_p;
-        int sign = reverse ? -1 : 1;
-        const char *needle = view.buf;
-        Py_ssize_t len = view.len;
+        Py_ssize_t res;
 
         if (start < 0)
             start += self->size;
@@ -322,21 +322,21 @@ mmap_gfind(mmap_object *self,
         else if (end > self->size)
             end = self->size;
 
-        start_p = self->data + start;
-        end_p = self->data + end;
-
-        for (p = (reverse ? end_p - len : start_p);
-             (p >= start_p) && (p + len <= end_p); p += sign) {
-            Py_ssize_t i;
-            for (i = 0; i < len && needle[i] == p[i]; ++i)
-                /* nothing */;
-            if (i == len) {
-                PyBuffer_Release(&view);
-                return PyLong_FromSsize_t(p - self->data);
-            }
+        if (end < start) {
+            res = -1;
+        }
+        else if (reverse) {
+            res = _PyBytes_ReverseFind(
+                self->data + start, end - start,
+                view.buf, view.len, start);
+        }
+        else {
+            res = _PyBytes_Find(
+                self->data + start, end - start,
+                view.buf, view.len, start);
         }
         PyBuffer_Release(&view);
-        return PyLong_FromLong(-1);
+        return PyLong_FromSsize_t(res);
     }
 }
 
@@ -809,6 +809,198 @@ mmap_madvise_method(mmap_object *self, PyObject *args)
 }
 #endif // HAVE_MADVISE
 
+/* Iterator returned by mmap.iterlines() */
+
+typedef struct {
+    PyObject_HEAD
+    mmap_object *mmap;
+    PyObject *view;         /* memoryview of the map, sliced for each line,
+                               or NULL when lines are decoded */
+    PyObject *separator;    /* bytes */
+    PyObject *encoding;     /* str or NULL */
+    PyObject *errors;       /* str or NULL */
+    Py_ssize_t prefetch;    /* MADV_WILLNEED window size, or 0 */
+    Py_ssize_t prefetched;  /* end of the range advised so far */
+} mmap_lines_object;
+
+static void
+mmap_lines_dealloc(mmap_lines_object *it)
+{
+    PyTypeObject *tp = Py_TYPE(it);
+
+    Py_XDECREF(it->view);
+    Py_XDECREF(it->mmap);
+    Py_XDECREF(it->separator);
+    Py_XDECREF(it->encoding);
+    Py_XDECREF(it->errors);
+    PyObject_Free(it);
+    Py_DECREF(tp);
+}
+
+#if defined(HAVE_MADVISE) && defined(MADV_WILLNEED)
+/* Ask the kernel to read ahead the window after pos, once per window. */
+static void
+mmap_lines_prefetch(mmap_lines_object *it, Py_ssize_t pos)
+{
+    mmap_object *self = it->mmap;
+    Py_ssize_t start, end;
+
+    if (pos + it->prefetch <= it->prefetched)
+        return;
+    start = pos - pos % my_getpagesize();
+    end = self->size - pos > 2 * it->prefetch ? pos + 2 * it->prefetch
+                                              : self->size;
+    /* This is only a hint: ignore errors. */
+    (void)madvise(self->data + start, end - start, MADV_WILLNEED);
+    it->prefetched = end;
+}
+#endif
+
+static PyObject *
+mmap_lines_next(mmap_lines_object *it)
+{
+    mmap_object *self = it->mmap;
+    const char *sep = PyBytes_AS_STRING(it->separator);
+    Py_ssize_t seplen = PyBytes_GET_SIZE(it->separator);
+    Py_ssize_t start, end;
+    PyObject *result;
+
+    CHECK_VALID(NULL);
+    start = self->pos;
+    if (start >= self->size)
+        return NULL;
+
+#if defined(HAVE_MADVISE) && defined(MADV_WILLNEED)
+    if (it->prefetch > 0)
+        mmap_lines_prefetch(it, start);
+#endif
+
+    if (seplen == 1) {
+        const char *eol = memchr(self->data + start, sep[0],
+                                 self->size - start);
+        end = eol ? eol - self->data + 1 : self->size;
+    }
+    else {
+        end = _PyBytes_Find(self->data + start, self->size - start,
+                            sep, seplen, start);
+        end = end >= 0 ? end + seplen : self->size;
+    }
+
+    if (it->view != NULL) {
+        result = PySequence_GetSlice(it->view, start, end);
+    }
+    else {
+        const char *encoding, *errors = NULL;
+        Py_buffer view;
+        encoding = PyUnicode_AsUTF8(it->encoding);
+        if (encoding == NULL)
+            return NULL;
+        if (it->errors != NULL) {
+            errors = PyUnicode_AsUTF8(it->errors);
+            if (errors == NULL)
+                return NULL;
+        }
+        /* A codec written in Python could close or resize the map: export
+           the buffer while decoding so that these raise BufferError. */
+        if (PyObject_GetBuffer((PyObject *)self, &view, PyBUF_SIMPLE) < 0)
+            return NULL;
+        result = PyUnicode_Decode((char *)view.buf + start, end - start,
+                                  encoding, errors);
+        PyBuffer_Release(&view);
+    }
+    if (result == NULL)
+        return NULL;
+    self->pos = end;
+    return result;
+}
+
+static PyObject *
+mmap_iterlines_method(mmap_object *self, PyObject *args, PyObject *kwargs)
+{
+    static char *keywords[] = {"separator", "encoding", "errors",
+                               "prefetch", NULL};
+    PyObject *separator = NULL;
+    const char *encoding = NULL, *errors = NULL;
+    Py_ssize_t prefetch = 0;
+    PyObject *module;
+    mmap_lines_object *it;
+
+    CHECK_VALID(NULL);
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|O$zzn:iterlines",
+                                     keywords, &separator, &encoding,
+                                     &errors, &prefetch)) {
+        return NULL;
+    }
+    if (prefetch < 0) {
+        PyErr_SetString(PyExc_ValueError, "prefetch must not be negative");
+        return NULL;
+    }
+
+    module = _PyType_GetModuleByDef(Py_TYPE(self), &mmapmodule);
+    if (module == NULL)
+        return NULL;
+    it = PyObject_New(mmap_lines_object,
+                      get_mmap_state(module)->mmap_lines_type);
+    if (it == NULL)
+        return NULL;
+    Py_INCREF(self);
+    it->mmap = self;
+    it->view = NULL;
+    it->separator = NULL;
+    it->encoding = NULL;
+    it->errors = NULL;
+    it->prefetch = Py_MIN(prefetch, self->size);
+    it->prefetched = 0;
+
+    if (separator == NULL)
+        it->separator = PyBytes_FromStringAndSize("\n", 1);
+    else
+        it->separator = PyBytes_FromObject(separator);
+    if (it->separator == NULL)
+        goto error;
+    if (PyBytes_GET_SIZE(it->separator) == 0) {
+        PyErr_SetString(PyExc_ValueError, "empty separator");
+        goto error;
+    }
+
+    if (encoding != NULL) {
+        it->encoding = PyUnicode_FromString(encoding);
+        if (it->encoding == NULL)
+            goto error;
+        if (errors != NULL) {
+            it->errors = PyUnicode_FromString(errors);
+            if (it->errors == NULL)
+                goto error;
+        }
+    }
+    else {
+        if (errors != NULL) {
+            PyErr_SetString(PyExc_ValueError,
+                            "errors requires an encoding");
+            goto error;
+        }
+        /* The view keeps the map from being closed or resized while the
+           iterator or any of the lines are alive. */
+        it->view = PyMemoryView_FromObject((PyObject *)self);
+        if (it->view == NULL)
+            goto error;
+    }
+
+#if defined(HAVE_MADVISE) && defined(MADV_SEQUENTIAL)
+    if (it->prefetch > 0 && self->pos < self->size) {
+        Py_ssize_t start = self->pos - self->pos % my_getpagesize();
+        /* This is only a hint: ignore errors. */
+        (void)madvise(self->data + start, self->size - start,
+                      MADV_SEQUENTIAL);
+    }
+#endif
+    return (PyObject *)it;
+
+error:
+    Py_DECREF(it);
+    return NULL;
+}
+
 static struct PyMemberDef mmap_object_members[] = {
     {"__weaklistoffset__", T_PYSSIZET, offsetof(mmap_object, weakreflist), READONLY},
     {NULL},
@@ -819,6 +1011,8 @@ static struct PyMethodDef mmap_object_methods[] = {
     {"find",            (PyCFunction) mmap_find_method,         METH_VARARGS},
     {"rfind",           (PyCFunction) mmap_rfind_method,        METH_VARARGS},
     {"flush",           (PyCFunction) mmap_flush_method,        METH_VARARGS},
+    {"iterlines",       (PyCFunction)(void(*)(void)) mmap_iterlines_method,
+                        METH_VARARGS | METH_KEYWORDS},
 #ifdef HAVE_MADVISE
     {"madvise",         (PyCFunction) mmap_madvise_method,      METH_VARARGS},
 #endif
@@ -1118,6 +1312,20 @@ static PyType_Spec mmap_object_spec = {
     .slots = mmap_object_slots,
 };
 
+static PyType_Slot mmap_lines_slots[] = {
+    {Py_tp_dealloc, mmap_lines_dealloc},
+    {Py_tp_iter, PyObject_SelfIter},
+    {Py_tp_iternext, mmap_lines_next},
+    {0, NULL},
+};
+
+static PyType_Spec mmap_lines_spec = {
+    .name = "mmap.mmap_lines_iterator",
+    .basicsize = sizeof(mmap_lines_object),
+    .flags = Py_TPFLAGS_DEFAULT,
+    .slots = mmap_lines_slots,
+};
+
 
 #ifdef UNIX
 #ifdef HAVE_LARGEFILE_SUPPORT
@@ -1503,6 +1711,7 @@ mmap_traverse(PyObject *module, visitproc visit, void *arg)
 {
     mmap_state *state = get_mmap_state(module);
     Py_VISIT(state->mmap_object_type);
+    Py_VISIT(state->mmap_lines_type);
     return 0;
 }
 
@@ -1511,6 +1720,7 @@ mmap_clear(PyObject *module)
 {
     mmap_state *state = get_mmap_state(module);
     Py_CLEAR(state->mmap_object_type);
+    Py_CLEAR(state->mmap_lines_type);
     return 0;
 }
 
@@ -1541,6 +1751,13 @@ mmap_exec(PyObject *module)
         return -1;
     }
 
+    state->mmap_lines_type = (PyTypeObject *)PyType_FromModuleAndSpec(
+        module, &mmap_lines_spec, NULL);
+    if (state->mmap_lines_type == NULL) {
+        return -1;
+    }
+    state->mmap_lines_type->tp_new = NULL;
+
 #define ADD_INT_MACRO(module, constant)                                     \
     do {                                                                    \
         if (PyModule_AddIntConstant(module, #constant, constant) < 0) {     \
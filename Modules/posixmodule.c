@@ -13994,6 +13994,18 @@ typedef struct {
     int first_time;
 #else /* POSIX */
     DIR *dirp;
+    /* Entries read ahead by ScandirIterator_fill() */
+    struct scandir_entry *batch;
+    char *names;
+    size_t names_size;
+    int batch_len;
+    int batch_pos;
+    int batch_errno;
+    int eof;
+    int prefetch_stat;
+    /* Set while ScandirIterator_fill() runs without the GIL */
+    int in_fill;
+    int close_pending;
 #endif
 #ifdef HAVE_FDOPENDIR
     int fd;
@@ -14068,6 +14080,26 @@ ScandirIterator_iternext(ScandirIterator *iterator)
 
 #else /* POSIX */
 
+/* Number of directory entries read (and optionally stat'ed) per release of
+   the GIL.  Threads walking different directories then contend for the GIL
+   once per batch rather than once per entry. */
+#define SCANDIR_BATCH_SIZE 64
+
+#if defined(HAVE_FSTATAT) && defined(HAVE_DIRFD)
+#  define SCANDIR_PREFETCH_STAT
+#endif
+
+struct scandir_entry {
+    size_t name_offset;
+    Py_ssize_t name_len;
+    ino_t d_ino;
+#ifdef HAVE_DIRENT_D_TYPE
+    unsigned char d_type;
+#endif
+    int has_lstat;
+    STRUCT_STAT lstat;
+};
+
 static int
 ScandirIterator_is_closed(ScandirIterator *iterator)
 {
@@ -14081,6 +14113,12 @@ ScandirIterator_closedir(ScandirIterator *iterator)
 
     if (!dirp)
         return;
+    if (iterator->in_fill) {
+        /* Another thread is reading a batch: it closes the iterator once
+           it is done with dirp and the buffers. */
+        iterator->close_pending = 1;
+        return;
+    }
 
     iterator->dirp = NULL;
     Py_BEGIN_ALLOW_THREADS
@@ -14090,31 +14128,49 @@ ScandirIterator_closedir(ScandirIterator *iterator)
 #endif
     closedir(dirp);
     Py_END_ALLOW_THREADS
+
+    PyMem_RawFree(iterator->batch);
+    PyMem_RawFree(iterator->names);
+    iterator->batch = NULL;
+    iterator->names = NULL;
+    iterator->names_size = 0;
+    iterator->batch_len = iterator->batch_pos = 0;
+    iterator->close_pending = 0;
     return;
 }
 
-static PyObject *
-ScandirIterator_iternext(ScandirIterator *iterator)
+/* Read the next batch of entries, skipping . and .., without holding the
+   GIL.  Sets iterator->eof when readdir() fails or reaches the end of the
+   directory; the errno of a failure is kept in iterator->batch_errno and
+   reported once the entries read before it have been consumed.  The
+   iterator is marked in_fill meanwhile, so that no other thread uses or
+   frees its buffers. */
+static void
+ScandirIterator_fill(ScandirIterator *iterator)
 {
     struct dirent *direntp;
+    struct scandir_entry *e;
+    size_t names_len = 0;
     Py_ssize_t name_len;
-    int is_dot;
-    PyObject *entry;
-
-    /* Happens if the iterator is iterated twice, or closed explicitly */
-    if (!iterator->dirp)
-        return NULL;
+    int is_dot, n = 0;
 
-    while (1) {
+    iterator->in_fill = 1;
+    Py_BEGIN_ALLOW_THREADS
+    if (iterator->batch == NULL) {
+        iterator->batch = PyMem_RawMalloc(
+            SCANDIR_BATCH_SIZE * sizeof(struct scandir_entry));
+        if (iterator->batch == NULL) {
+            iterator->batch_errno = ENOMEM;
+            iterator->eof = 1;
+        }
+    }
+    while (!iterator->eof && n < SCANDIR_BATCH_SIZE) {
         errno = 0;
-        Py_BEGIN_ALLOW_THREADS
         direntp = readdir(iterator->dirp);
-        Py_END_ALLOW_THREADS
-
         if (!direntp) {
             /* Error or no more files */
-            if (errno != 0)
-                path_error(&iterator->path);
+            iterator->batch_errno = errno;
+            iterator->eof = 1;
             break;
         }
 
@@ -14122,26 +14178,107 @@ ScandirIterator_iternext(ScandirIterator *iterator)
         name_len = NAMLEN(direntp);
         is_dot = direntp->d_name[0] == '.' &&
                  (name_len == 1 || (direntp->d_name[1] == '.' && name_len == 2));
-        if (!is_dot) {
-            PyObject *module = PyType_GetModule(Py_TYPE(iterator));
-            entry = DirEntry_from_posix_info(module,
-                                             &iterator->path, direntp->d_name,
-                                             name_len, direntp->d_ino
+        if (is_dot)
+            continue;
+
+        if (names_len + name_len + 1 > iterator->names_size) {
+            size_t size = Py_MAX(iterator->names_size * 2,
+                                 names_len + name_len + 1);
+            char *names = PyMem_RawRealloc(iterator->names, size);
+            if (names == NULL) {
+                iterator->batch_errno = ENOMEM;
+                iterator->eof = 1;
+                break;
+            }
+            iterator->names = names;
+            iterator->names_size = size;
+        }
+        memcpy(iterator->names + names_len, direntp->d_name, name_len + 1);
+
+        e = &iterator->batch[n++];
+        e->name_offset = names_len;
+        e->name_len = name_len;
+        e->d_ino = direntp->d_ino;
 #ifdef HAVE_DIRENT_D_TYPE
-                                             , direntp->d_type
+        e->d_type = direntp->d_type;
 #endif
-                                            );
-            if (!entry)
-                break;
-            return entry;
+        e->has_lstat = 0;
+        names_len += name_len + 1;
+    }
+
+#ifdef SCANDIR_PREFETCH_STAT
+    if (iterator->prefetch_stat && HAVE_FSTATAT_RUNTIME) {
+        int dir_fd = dirfd(iterator->dirp);
+        for (int i = 0; i < n; i++) {
+            e = &iterator->batch[i];
+            /* On failure, DirEntry.stat() retries and reports the error. */
+            e->has_lstat = fstatat(dir_fd, iterator->names + e->name_offset,
+                                   &e->lstat, AT_SYMLINK_NOFOLLOW) == 0;
         }
+    }
+#endif
+    Py_END_ALLOW_THREADS
+    iterator->in_fill = 0;
 
-        /* Loop till we get a non-dot directory or finish iterating */
+    iterator->batch_len = n;
+    iterator->batch_pos = 0;
+}
+
+static PyObject *
+ScandirIterator_iternext(ScandirIterator *iterator)
+{
+    struct scandir_entry *e;
+    PyObject *module;
+    DirEntry *entry;
+
+    /* Happens if the iterator is iterated twice, or closed explicitly */
+    if (!iterator->dirp)
+        return NULL;
+
+    if (iterator->in_fill) {
+        PyErr_SetString(PyExc_RuntimeError,
+                        "scandir iterator is being read by another thread");
+        return NULL;
     }
 
-    /* Error or no more files */
-    ScandirIterator_closedir(iterator);
-    return NULL;
+    if (iterator->batch_pos == iterator->batch_len) {
+        if (!iterator->eof) {
+            ScandirIterator_fill(iterator);
+            if (iterator->close_pending) {
+                /* Closed by another thread during the fill */
+                ScandirIterator_closedir(iterator);
+                return NULL;
+            }
+        }
+        if (iterator->batch_pos == iterator->batch_len) {
+            /* Error or no more files */
+            if (iterator->batch_errno != 0) {
+                errno = iterator->batch_errno;
+                path_error(&iterator->path);
+            }
+            ScandirIterator_closedir(iterator);
+            return NULL;
+        }
+    }
+
+    e = &iterator->batch[iterator->batch_pos++];
+    module = PyType_GetModule(Py_TYPE(iterator));
+    entry = (DirEntry *)DirEntry_from_posix_info(module,
+                                     &iterator->path,
+                                     iterator->names + e->name_offset,
+                                     e->name_len, e->d_ino
+#ifdef HAVE_DIRENT_D_TYPE
+                                     , e->d_type
+#endif
+                                    );
+    if (entry && e->has_lstat) {
+        entry->lstat = _pystat_fromstructstat(module, &e->lstat);
+        if (!entry->lstat)
+            Py_CLEAR(entry);
+    }
+    if (!entry)
+        ScandirIterator_closedir(iterator);
+    return (PyObject *)entry;
 }
 
 #endif
@@ -14236,6 +14373,8 @@ static PyType_Spec ScandirIteratorType_spec = {
 os.scandir
 
     path : path_t(nullable=True, allow_fd='PATH_HAVE_FDOPENDIR') = None
+    *
+    stat as prefetch_stat: bool = False
 
 Return an iterator of DirEntry objects for given path.
 
@@ -14244,11 +14383,14 @@ is bytes, the names of yielded DirEntry objects will also be bytes; in
 all other circumstances they will be str.
 
 If path is None, uses the path='.'.
+
+If stat is true, the entries are stat'ed as the directory is read, so that
+DirEntry.stat() does not need a system call for them.
 [clinic start generated code]*/
 
 static PyObject *
-os_scandir_impl(PyObject *module, path_t *path)
-/*[clinic end generated code: output=6eb2668b675ca89e input=6bdd312708fc3bb0]*/
+os_scandir_impl(PyObject *module, path_t *path, int prefetch_stat)
+/*[clinic end generated code: output=48f6652d6828a3f1 input=46939a6d7b7e4aa9]*/
 {
     ScandirIterator *iterator;
 #ifdef MS_WINDOWS
@@ -14274,6 +14416,14 @@ os_scandir_impl(PyObject *module, path_t *path)
     iterator->handle = INVALID_HANDLE_VALUE;
 #else
     iterator->dirp = NULL;
+    iterator->batch = NULL;
+    iterator->names = NULL;
+    iterator->names_size = 0;
+    iterator->batch_len = iterator->batch_pos = 0;
+    iterator->batch_errno = 0;
+    iterator->eof = 0;
+    iterator->prefetch_stat = prefetch_stat;
+    iterator->in_fill = iterator->close_pending = 0;
 #endif
 
     /* Move the ownership to iterator->path */
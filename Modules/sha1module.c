@@ -183,6 +183,103 @@ static void sha1_compress(struct sha1_state *sha1, unsigned char *buf)
     sha1->state[4] = sha1->state[4] + e;
 }
 
+static void
+sha1_blocks_c(struct sha1_state *sha1, const unsigned char *in,
+              Py_ssize_t nblocks)
+{
+    for (; nblocks > 0; nblocks--, in += SHA1_BLOCKSIZE) {
+        sha1_compress(sha1, (unsigned char *)in);
+    }
+}
+
+#ifdef HASHLIB_HAVE_SHANI
+/* SHA-1 using the x86 SHA extensions.  E is carried in the top lane of
+   E0/E1, which alternate between the groups of four rounds, and the message
+   schedule for later groups is interleaved with the rounds. */
+
+/* Rounds 4*g to 4*g+3.  m0 holds the message words of this group, m1, m2
+   and m3 those of the groups g+1, g+2 and g-1 (modulo 4). */
+#define SHANI_QROUND(g, Ein, Eout, m0, m1, m2, m3)                        \
+    if ((g) == 0) {                                                       \
+        Ein = _mm_add_epi32(Ein, m0);                                     \
+    }                                                                     \
+    else {                                                                \
+        Ein = _mm_sha1nexte_epu32(Ein, m0);                               \
+    }                                                                     \
+    Eout = ABCD;                                                          \
+    if (3 <= (g) && (g) <= 18) {                                          \
+        m1 = _mm_sha1msg2_epu32(m1, m0);                                  \
+    }                                                                     \
+    ABCD = _mm_sha1rnds4_epu32(ABCD, Ein, (g) / 5);                       \
+    if (1 <= (g) && (g) <= 16) {                                          \
+        m3 = _mm_sha1msg1_epu32(m3, m0);                                  \
+    }                                                                     \
+    if (2 <= (g) && (g) <= 17) {                                          \
+        m2 = _mm_xor_si128(m2, m0);                                       \
+    }
+
+#define SHANI_LOAD(m, i)                                                  \
+    m = _mm_shuffle_epi8(                                                 \
+        _mm_loadu_si128((const __m128i *)(in + 16*(i))), MASK)
+
+HASHLIB_SHANI_TARGET static void
+sha1_blocks_shani(struct sha1_state *sha1, const unsigned char *in,
+                  Py_ssize_t nblocks)
+{
+    __m128i ABCD, ABCD_SAVE, E0, E0_SAVE, E1, M0, M1, M2, M3;
+    const __m128i MASK = _mm_set_epi64x(0x0001020304050607ULL,
+                                        0x08090a0b0c0d0e0fULL);
+
+    ABCD = _mm_loadu_si128((const __m128i *)sha1->state);
+    ABCD = _mm_shuffle_epi32(ABCD, 0x1B);
+    E0 = _mm_set_epi32((int)sha1->state[4], 0, 0, 0);
+
+    for (; nblocks > 0; nblocks--, in += SHA1_BLOCKSIZE) {
+        ABCD_SAVE = ABCD;
+        E0_SAVE = E0;
+
+        SHANI_LOAD(M0, 0);
+        SHANI_QROUND(0, E0, E1, M0, M1, M2, M3);
+        SHANI_LOAD(M1, 1);
+        SHANI_QROUND(1, E1, E0, M1, M2, M3, M0);
+        SHANI_LOAD(M2, 2);
+        SHANI_QROUND(2, E0, E1, M2, M3, M0, M1);
+        SHANI_LOAD(M3, 3);
+        SHANI_QROUND(3, E1, E0, M3, M0, M1, M2);
+        SHANI_QROUND(4, E0, E1, M0, M1, M2, M3);
+        SHANI_QROUND(5, E1, E0, M1, M2, M3, M0);
+        SHANI_QROUND(6, E0, E1, M2, M3, M0, M1);
+        SHANI_QROUND(7, E1, E0, M3, M0, M1, M2);
+        SHANI_QROUND(8, E0, E1, M0, M1, M2, M3);
+        SHANI_QROUND(9, E1, E0, M1, M2, M3, M0);
+        SHANI_QROUND(10, E0, E1, M2, M3, M0, M1);
+        SHANI_QROUND(11, E1, E0, M3, M0, M1, M2);
+        SHANI_QROUND(12, E0, E1, M0, M1, M2, M3);
+        SHANI_QROUND(13, E1, E0, M1, M2, M3, M0);
+        SHANI_QROUND(14, E0, E1, M2, M3, M0, M1);
+        SHANI_QROUND(15, E1, E0, M3, M0, M1, M2);
+        SHANI_QROUND(16, E0, E1, M0, M1, M2, M3);
+        SHANI_QROUND(17, E1, E0, M1, M2, M3, M0);
+        SHANI_QROUND(18, E0, E1, M2, M3, M0, M1);
+        SHANI_QROUND(19, E1, E0, M3, M0, M1, M2);
+
+        E0 = _mm_sha1nexte_epu32(E0, E0_SAVE);
+        ABCD = _mm_add_epi32(ABCD, ABCD_SAVE);
+    }
+
+    ABCD = _mm_shuffle_epi32(ABCD, 0x1B);
+    _mm_storeu_si128((__m128i *)sha1->state, ABCD);
+    sha1->state[4] = (SHA1_INT32)_mm_extract_epi32(E0, 3);
+}
+
+#undef SHANI_QROUND
+#undef SHANI_LOAD
+#endif /* HASHLIB_HAVE_SHANI */
+
+/* Selected when the module is loaded, depending on the CPU. */
+static void (*sha1_blocks)(struct sha1_state *sha1, const unsigned char *in,
+                           Py_ssize_t nblocks) = sha1_blocks_c;
+
 /**
    Initialize the hash state
    @param sha1   The hash state you wish to initialize
@@ -218,10 +315,11 @@ sha1_process(struct sha1_state *sha1,
 
     while (inlen > 0) {
         if (sha1->curlen == 0 && inlen >= SHA1_BLOCKSIZE) {
-           sha1_compress(sha1, (unsigned char *)in);
-           sha1->length   += SHA1_BLOCKSIZE * 8;
-           in             += SHA1_BLOCKSIZE;
-           inlen          -= SHA1_BLOCKSIZE;
+           n = inlen / SHA1_BLOCKSIZE;
+           sha1_blocks(sha1, in, n);
+           sha1->length   += n * SHA1_BLOCKSIZE * 8;
+           in             += n * SHA1_BLOCKSIZE;
+           inlen          -= n * SHA1_BLOCKSIZE;
         } else {
            n = Py_MIN(inlen, (Py_ssize_t)(SHA1_BLOCKSIZE - sha1->curlen));
            memcpy(sha1->buf + sha1->curlen, in, (size_t)n);
@@ -229,7 +327,7 @@ sha1_process(struct sha1_state *sha1,
            in             += n;
            inlen          -= n;
            if (sha1->curlen == SHA1_BLOCKSIZE) {
-              sha1_compress(sha1, sha1->buf);
+              sha1_blocks(sha1, sha1->buf, 1);
               sha1->length += 8*SHA1_BLOCKSIZE;
               sha1->curlen = 0;
            }
@@ -265,7 +363,7 @@ sha1_done(struct sha1_state *sha1, unsigned char *out)
         while (sha1->curlen < 64) {
             sha1->buf[sha1->curlen++] = (unsigned char)0;
         }
-        sha1_compress(sha1, sha1->buf);
+        sha1_blocks(sha1, sha1->buf, 1);
         sha1->curlen = 0;
     }
 
@@ -276,7 +374,7 @@ sha1_done(struct sha1_state *sha1, unsigned char *out)
 
     /* store length */
     STORE64H(sha1->length, sha1->buf+56);
-    sha1_compress(sha1, sha1->buf);
+    sha1_blocks(sha1, sha1->buf, 1);
 
     /* copy output */
     for (i = 0; i < 5; i++) {
@@ -512,10 +610,40 @@ _sha1_sha1_impl(PyObject *module, PyObject *string, int usedforsecurity)
 }
 
 
+static void
+sha1_digest(const unsigned char *buf, Py_ssize_t len, unsigned char *digest)
+{
+    struct sha1_state temp;
+
+    sha1_init(&temp);
+    sha1_process(&temp, buf, len);
+    sha1_done(&temp, digest);
+}
+
+/*[clinic input]
+_sha1.sha1_many
+
+    messages: object
+    /
+
+Return a list of the SHA1 digests of each bytes-like object in messages.
+
+The GIL is released once while all of the messages are hashed.
+[clinic start generated code]*/
+
+static PyObject *
+_sha1_sha1_many(PyObject *module, PyObject *messages)
+/*[clinic end generated code: output=a3607d8ee99f78d5 input=b656f59de57cbc3c]*/
+{
+    return hashlib_hash_many(messages, SHA1_DIGESTSIZE, sha1_digest);
+}
+
+
 /* List of functions exported by this module */
 
 static struct PyMethodDef SHA1_functions[] = {
     _SHA1_SHA1_METHODDEF
+    _SHA1_SHA1_MANY_METHODDEF
     {NULL,      NULL}            /* Sentinel */
 };
 
@@ -546,6 +674,12 @@ _sha1_exec(PyObject *module)
 {
     SHA1State* st = sha1_get_state(module);
 
+#ifdef HASHLIB_HAVE_SHANI
+    if (hashlib_cpu_has_shani()) {
+        sha1_blocks = sha1_blocks_shani;
+    }
+#endif
+
     st->sha1_type = (PyTypeObject *)PyType_FromModuleAndSpec(
         module, &sha1_type_spec, NULL);
 
@@ -127,21 +127,21 @@ static void SHAcopy(SHAobject *src, SHAobject *dest)
 
 
 static void
-sha_transform(SHAobject *sha_info)
+sha256_compress_c(SHA_INT32 digest[8], const SHA_BYTE *data)
 {
     int i;
         SHA_INT32 S[8], W[64], t0, t1;
 
-    memcpy(W, sha_info->data, sizeof(sha_info->data));
+    memcpy(W, data, SHA_BLOCKSIZE);
 #if PY_LITTLE_ENDIAN
-    longReverse(W, (int)sizeof(sha_info->data));
+    longReverse(W, SHA_BLOCKSIZE);
 #endif
 
     for (i = 16; i < 64; ++i) {
                 W[i] = Gamma1(W[i - 2]) + W[i - 7] + Gamma0(W[i - 15]) + W[i - 16];
     }
     for (i = 0; i < 8; ++i) {
-        S[i] = sha_info->digest[i];
+        S[i] = digest[i];
     }
 
     /* Compress */
@@ -220,9 +220,122 @@ sha_transform(SHAobject *sha_info)
 
     /* feedback */
     for (i = 0; i < 8; i++) {
-        sha_info->digest[i] = sha_info->digest[i] + S[i];
+        digest[i] = digest[i] + S[i];
+    }
+
+}
+
+static void
+sha256_blocks_c(SHA_INT32 digest[8], const SHA_BYTE *data, Py_ssize_t nblocks)
+{
+    for (; nblocks > 0; nblocks--, data += SHA_BLOCKSIZE) {
+        sha256_compress_c(digest, data);
+    }
+}
+
+#ifdef HASHLIB_HAVE_SHANI
+/* SHA-256 using the x86 SHA extensions.  The state is kept as the ABEF and
+   CDGH halves expected by sha256rnds2, and each group of four rounds also
+   schedules the message words needed four groups later. */
+
+static const SHA_INT32 K256[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1,
+    0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786,
+    0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147,
+    0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+    0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a,
+    0x5b9cca4f, 0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+/* Rounds 4*g to 4*g+3.  m0 holds the message words of this group, m1, m2
+   and m3 those of the groups g+1, g+2 and g-1 (modulo 4). */
+#define SHANI_QROUND(g, m0, m1, m2, m3)                                     \
+    MSG = _mm_add_epi32(m0, _mm_loadu_si128((const __m128i *)&K256[4*(g)])); \
+    STATE1 = _mm_sha256rnds2_epu32(STATE1, STATE0, MSG);                  \
+    if (3 <= (g) && (g) <= 14) {                                          \
+        TMP = _mm_alignr_epi8(m0, m3, 4);                                 \
+        m1 = _mm_add_epi32(m1, TMP);                                      \
+        m1 = _mm_sha256msg2_epu32(m1, m0);                                \
+    }                                                                     \
+    MSG = _mm_shuffle_epi32(MSG, 0x0E);                                   \
+    STATE0 = _mm_sha256rnds2_epu32(STATE0, STATE1, MSG);                  \
+    if (1 <= (g) && (g) <= 12) {                                          \
+        m3 = _mm_sha256msg1_epu32(m3, m0);                                \
+    }
+
+#define SHANI_LOAD(m, i)                                                  \
+    m = _mm_shuffle_epi8(                                                 \
+        _mm_loadu_si128((const __m128i *)(data + 16*(i))), MASK)
+
+HASHLIB_SHANI_TARGET static void
+sha256_blocks_shani(SHA_INT32 digest[8], const SHA_BYTE *data,
+                    Py_ssize_t nblocks)
+{
+    __m128i STATE0, STATE1, MSG, TMP, M0, M1, M2, M3, ABEF_SAVE, CDGH_SAVE;
+    const __m128i MASK = _mm_set_epi64x(0x0c0d0e0f08090a0bULL,
+                                        0x0405060700010203ULL);
+
+    TMP = _mm_loadu_si128((const __m128i *)&digest[0]);
+    STATE1 = _mm_loadu_si128((const __m128i *)&digest[4]);
+    TMP = _mm_shuffle_epi32(TMP, 0xB1);            /* CDAB */
+    STATE1 = _mm_shuffle_epi32(STATE1, 0x1B);      /* EFGH */
+    STATE0 = _mm_alignr_epi8(TMP, STATE1, 8);      /* ABEF */
+    STATE1 = _mm_blend_epi16(STATE1, TMP, 0xF0);   /* CDGH */
+
+    for (; nblocks > 0; nblocks--, data += SHA_BLOCKSIZE) {
+        ABEF_SAVE = STATE0;
+        CDGH_SAVE = STATE1;
+
+        SHANI_LOAD(M0, 0);
+        SHANI_QROUND(0, M0, M1, M2, M3);
+        SHANI_LOAD(M1, 1);
+        SHANI_QROUND(1, M1, M2, M3, M0);
+        SHANI_LOAD(M2, 2);
+        SHANI_QROUND(2, M2, M3, M0, M1);
+        SHANI_LOAD(M3, 3);
+        SHANI_QROUND(3, M3, M0, M1, M2);
+        SHANI_QROUND(4, M0, M1, M2, M3);
+        SHANI_QROUND(5, M1, M2, M3, M0);
+        SHANI_QROUND(6, M2, M3, M0, M1);
+        SHANI_QROUND(7, M3, M0, M1, M2);
+        SHANI_QROUND(8, M0, M1, M2, M3);
+        SHANI_QROUND(9, M1, M2, M3, M0);
+        SHANI_QROUND(10, M2, M3, M0, M1);
+        SHANI_QROUND(11, M3, M0, M1, M2);
+        SHANI_QROUND(12, M0, M1, M2, M3);
+        SHANI_QROUND(13, M1, M2, M3, M0);
+        SHANI_QROUND(14, M2, M3, M0, M1);
+        SHANI_QROUND(15, M3, M0, M1, M2);
+
+        STATE0 = _mm_add_epi32(STATE0, ABEF_SAVE);
+        STATE1 = _mm_add_epi32(STATE1, CDGH_SAVE);
     }
 
+    TMP = _mm_shuffle_epi32(STATE0, 0x1B);         /* FEBA */
+    STATE1 = _mm_shuffle_epi32(STATE1, 0xB1);      /* DCHG */
+    STATE0 = _mm_blend_epi16(TMP, STATE1, 0xF0);   /* DCBA */
+    STATE1 = _mm_alignr_epi8(STATE1, TMP, 8);      /* ABEF */
+    _mm_storeu_si128((__m128i *)&digest[0], STATE0);
+    _mm_storeu_si128((__m128i *)&digest[4], STATE1);
+}
+
+#undef SHANI_QROUND
+#undef SHANI_LOAD
+#endif /* HASHLIB_HAVE_SHANI */
+
+/* Selected when the module is loaded, depending on the CPU. */
+static void (*sha256_blocks)(SHA_INT32 digest[8], const SHA_BYTE *data,
+                             Py_ssize_t nblocks) = sha256_blocks_c;
+
+static void
+sha_transform(SHAobject *sha_info)
+{
+    sha256_blocks(sha_info->digest, sha_info->data, 1);
 }
 
 
@@ -294,11 +407,11 @@ sha_update(SHAobject *sha_info, SHA_BYTE *buffer, Py_ssize_t count)
             return;
         }
     }
-    while (count >= SHA_BLOCKSIZE) {
-        memcpy(sha_info->data, buffer, SHA_BLOCKSIZE);
-        buffer += SHA_BLOCKSIZE;
-        count -= SHA_BLOCKSIZE;
-        sha_transform(sha_info);
+    if (count >= SHA_BLOCKSIZE) {
+        Py_ssize_t nblocks = count / SHA_BLOCKSIZE;
+        sha256_blocks(sha_info->digest, buffer, nblocks);
+        buffer += nblocks * SHA_BLOCKSIZE;
+        count -= nblocks * SHA_BLOCKSIZE;
     }
     memcpy(sha_info->data, buffer, count);
     sha_info->local = (int)count;
@@ -650,11 +763,72 @@ _sha256_sha224_impl(PyObject *module, PyObject *string, int usedforsecurity)
 }
 
 
+static void
+sha256_digest(const unsigned char *buf, Py_ssize_t len, unsigned char *digest)
+{
+    SHAobject temp;
+
+    sha_init(&temp);
+    sha_update(&temp, (SHA_BYTE *)buf, len);
+    sha_final(digest, &temp);
+}
+
+static void
+sha224_digest(const unsigned char *buf, Py_ssize_t len, unsigned char *digest)
+{
+    unsigned char full[SHA_DIGESTSIZE];
+    SHAobject temp;
+
+    sha224_init(&temp);
+    sha_update(&temp, (SHA_BYTE *)buf, len);
+    sha_final(full, &temp);
+    memcpy(digest, full, 28);
+}
+
+/*[clinic input]
+_sha256.sha256_many
+
+    messages: object
+    /
+
+Return a list of the SHA-256 digests of each bytes-like object in messages.
+
+The GIL is released once while all of the messages are hashed.
+[clinic start generated code]*/
+
+static PyObject *
+_sha256_sha256_many(PyObject *module, PyObject *messages)
+/*[clinic end generated code: output=16929a02d3fe0ce5 input=15ccd9c812e8130a]*/
+{
+    return hashlib_hash_many(messages, SHA_DIGESTSIZE, sha256_digest);
+}
+
+/*[clinic input]
+_sha256.sha224_many
+
+    messages: object
+    /
+
+Return a list of the SHA-224 digests of each bytes-like object in messages.
+
+The GIL is released once while all of the messages are hashed.
+[clinic start generated code]*/
+
+static PyObject *
+_sha256_sha224_many(PyObject *module, PyObject *messages)
+/*[clinic end generated code: output=9a79bbddc78e876b input=e5c9fcbbbedee043]*/
+{
+    return hashlib_hash_many(messages, 28, sha224_digest);
+}
+
+
 /* List of functions exported by this module */
 
 static struct PyMethodDef SHA_functions[] = {
     _SHA256_SHA256_METHODDEF
     _SHA256_SHA224_METHODDEF
+    _SHA256_SHA256_MANY_METHODDEF
+    _SHA256_SHA224_MANY_METHODDEF
     {NULL,      NULL}            /* Sentinel */
 };
 
@@ -686,6 +860,12 @@ static int sha256_exec(PyObject *module)
 {
     _sha256_state *state = _sha256_get_state(module);
 
+#ifdef HASHLIB_HAVE_SHANI
+    if (hashlib_cpu_has_shani()) {
+        sha256_blocks = sha256_blocks_shani;
+    }
+#endif
+
     state->sha224_type = (PyTypeObject *)PyType_FromModuleAndSpec(
         module, &sha224_type_spec, NULL);
 
@@ -4109,6 +4109,147 @@ it will first attempt to close any file descriptors received via the\n\
 SCM_RIGHTS mechanism.");
 #endif    /* CMSG_LEN */
 
+#ifdef HAVE_RECVMMSG
+struct sock_recvmmsg {
+    struct mmsghdr *msgvec;
+    unsigned int vlen;
+    int flags;
+    int result;
+};
+
+static int
+sock_recvmmsg_impl(PySocketSockObject *s, void *data)
+{
+    struct sock_recvmmsg *ctx = data;
+
+    ctx->result = recvmmsg(s->sock_fd, ctx->msgvec, ctx->vlen, ctx->flags,
+                           NULL);
+    return (ctx->result >= 0);
+}
+
+/* s.recvmmsg_into(buffers[, flags]) method */
+
+static PyObject *
+sock_recvmmsg_into(PySocketSockObject *s, PyObject *args)
+{
+    int flags = 0;
+    socklen_t addrbuflen;
+    struct iovec *iovs = NULL;
+    struct mmsghdr *msgvec = NULL;
+    sock_addr_t *addrbufs = NULL;
+    Py_ssize_t i, nitems, nbufs = 0;
+    Py_buffer *bufs = NULL;
+    PyObject *buffers_arg, *fast, *retval = NULL;
+    struct sock_recvmmsg ctx;
+
+    if (!PyArg_ParseTuple(args, "O|i:recvmmsg_into", &buffers_arg, &flags))
+        return NULL;
+
+    if (!getsockaddrlen(s, &addrbuflen))
+        return NULL;
+
+    if (!IS_SELECTABLE(s))
+        return select_error();
+
+    if ((fast = PySequence_Fast(buffers_arg,
+                                "recvmmsg_into() argument 1 must be an "
+                                "iterable")) == NULL)
+        return NULL;
+    nitems = PySequence_Fast_GET_SIZE(fast);
+    if (nitems > INT_MAX) {
+        PyErr_SetString(PyExc_OSError,
+                        "recvmmsg_into() argument 1 is too long");
+        goto finally;
+    }
+    if (nitems == 0) {
+        retval = PyList_New(0);
+        goto finally;
+    }
+
+    /* Each buffer receives one datagram: give every message header its
+       own iovec and address buffer, and save the Py_buffer structs to
+       release afterwards. */
+    if ((iovs = PyMem_New(struct iovec, nitems)) == NULL ||
+        (bufs = PyMem_New(Py_buffer, nitems)) == NULL ||
+        (msgvec = PyMem_Calloc(nitems, sizeof(struct mmsghdr))) == NULL ||
+        (addrbufs = PyMem_Calloc(nitems, sizeof(sock_addr_t))) == NULL) {
+        PyErr_NoMemory();
+        goto finally;
+    }
+    for (; nbufs < nitems; nbufs++) {
+        if (!PyArg_Parse(PySequence_Fast_GET_ITEM(fast, nbufs),
+                         "w*;recvmmsg_into() argument 1 must be an iterable "
+                         "of single-segment read-write buffers",
+                         &bufs[nbufs]))
+            goto finally;
+        iovs[nbufs].iov_base = bufs[nbufs].buf;
+        iovs[nbufs].iov_len = bufs[nbufs].len;
+        msgvec[nbufs].msg_hdr.msg_name = SAS2SA(&addrbufs[nbufs]);
+        msgvec[nbufs].msg_hdr.msg_namelen = addrbuflen;
+        msgvec[nbufs].msg_hdr.msg_iov = &iovs[nbufs];
+        msgvec[nbufs].msg_hdr.msg_iovlen = 1;
+    }
+
+    ctx.msgvec = msgvec;
+    ctx.vlen = (unsigned int)nitems;
+    ctx.flags = flags;
+#ifdef MSG_WAITFORONE
+    /* Only wait for the first datagram; return whatever else is already
+       queued without blocking again. */
+    ctx.flags |= MSG_WAITFORONE;
+#endif
+    if (sock_call(s, 0, sock_recvmmsg_impl, &ctx) < 0)
+        goto finally;
+
+    retval = PyList_New(ctx.result);
+    if (retval == NULL)
+        goto finally;
+    for (i = 0; i < ctx.result; i++) {
+        struct msghdr *hdr = &msgvec[i].msg_hdr;
+        PyObject *addr, *item;
+
+        addr = makesockaddr(s->sock_fd, hdr->msg_name,
+                            ((hdr->msg_namelen > addrbuflen) ?
+                             addrbuflen : hdr->msg_namelen),
+                            s->sock_proto);
+        if (addr == NULL) {
+            Py_CLEAR(retval);
+            goto finally;
+        }
+        item = Py_BuildValue("IN", msgvec[i].msg_len, addr);
+        if (item == NULL) {
+            Py_CLEAR(retval);
+            goto finally;
+        }
+        PyList_SET_ITEM(retval, i, item);
+    }
+
+finally:
+    for (i = 0; i < nbufs; i++)
+        PyBuffer_Release(&bufs[i]);
+    PyMem_Free(addrbufs);
+    PyMem_Free(msgvec);
+    PyMem_Free(bufs);
+    PyMem_Free(iovs);
+    Py_DECREF(fast);
+    return retval;
+}
+
+PyDoc_STRVAR(recvmmsg_into_doc,
+"recvmmsg_into(buffers[, flags]) -> [(nbytes, address), ...]\n\
+\n\
+Receive several datagrams from the socket with a single system call.\n\
+The buffers argument must be an iterable of objects that export\n\
+writable buffers (e.g. bytearray objects); each buffer receives at\n\
+most one datagram.  The call waits only for the first datagram and\n\
+then returns the ones that are already queued, so fewer datagrams than\n\
+buffers may be returned.  The flags argument defaults to 0 and has the\n\
+same meaning as for recv().\n\
+\n\
+The return value is a list with one (nbytes, address) pair per\n\
+received datagram, in the order of the buffers they were written to.");
+#endif    /* HAVE_RECVMMSG */
+
 
 struct sock_send {
     char *buf;
@@ -4168,6 +4309,11 @@ argument, see the Unix manual.  Return the number of bytes\n\
 sent; this may be less than len(data) if the network is busy.");
 
 
+#ifdef CMSG_LEN
+static PyObject *sock_sendall_iovec(PySocketSockObject *s, PyObject *data_arg,
+                                    int flags);
+#endif
+
 /* s.sendall(data [,flags]) method */
 
 static PyObject *
@@ -4182,9 +4328,29 @@ sock_sendall(PySocketSockObject *s, PyObject *args)
     _PyTime_t interval = s->sock_timeout;
     _PyTime_t deadline = 0;
     int deadline_initialized = 0;
-    PyObject *res = NULL;
+    PyObject *data_arg, *res = NULL;
 
-    if (!PyArg_ParseTuple(args, "y*|i:sendall", &pbuf, &flags))
+    if (!PyArg_ParseTuple(args, "O|i:sendall", &data_arg, &flags))
+        return NULL;
+    if (PyList_Check(data_arg) || PyTuple_Check(data_arg)) {
+#ifdef CMSG_LEN
+        /* Gather the buffers with sendmsg() instead of joining them. */
+        return sock_sendall_iovec(s, data_arg, flags);
+#else
+        PyObject *empty = PyBytes_FromStringAndSize(NULL, 0);
+        if (empty == NULL)
+            return NULL;
+        data_arg = _PyBytes_Join(empty, data_arg);
+        Py_DECREF(empty);
+        if (data_arg == NULL)
+            return NULL;
+        res = PyObject_CallMethod((PyObject *)s, "sendall", "Oi",
+                                  data_arg, flags);
+        Py_DECREF(data_arg);
+        return res;
+#endif
+    }
+    if (PyObject_GetBuffer(data_arg, &pbuf, PyBUF_SIMPLE) < 0)
         return NULL;
     buf = pbuf.buf;
     len = pbuf.len;
@@ -4244,7 +4410,8 @@ PyDoc_STRVAR(sendall_doc,
 Send a data string to the socket.  For the optional flags\n\
 argument, see the Unix manual.  This calls send() repeatedly\n\
 until all data is sent.  If an error occurs, it's impossible\n\
-to tell how much data has been sent.");
+to tell how much data has been sent.  data may also be a list or\n\
+tuple of bytes-like objects, which are sent as if concatenated.");
 
 
 struct sock_sendto {
@@ -4619,8 +4786,230 @@ argument defaults to 0 and has the same meaning as for send().  If\n\
 address is supplied and not None, it sets a destination address for\n\
 the message.  The return value is the number of bytes of non-ancillary\n\
 data sent.");
+
+#ifdef IOV_MAX
+#  define SOCK_IOV_MAX IOV_MAX
+#else
+#  define SOCK_IOV_MAX 16
+#endif
+
+/* s.sendall([data, ...] [,flags]): send a list of buffers with sendmsg()
+   until everything is sent, without concatenating them first. */
+
+static PyObject *
+sock_sendall_iovec(PySocketSockObject *s, PyObject *data_arg, int flags)
+{
+    Py_ssize_t i, n, niov, ndatabufs = 0;
+    Py_buffer *databufs = NULL;
+    struct iovec *iovs;
+    struct msghdr msg;
+    struct sock_sendmsg ctx;
+    int has_timeout = (s->sock_timeout > 0);
+    _PyTime_t interval = s->sock_timeout;
+    _PyTime_t deadline = 0;
+    int deadline_initialized = 0, result;
+    PyObject *res = NULL;
+
+    memset(&msg, 0, sizeof(msg));
+    result = sock_sendmsg_iovec(s, data_arg, &msg, &databufs, &ndatabufs);
+    /* msg.msg_iov is advanced while sending; keep the start to free it. */
+    iovs = msg.msg_iov;
+    if (result == -1)
+        goto done;
+
+    if (!IS_SELECTABLE(s)) {
+        select_error();
+        goto done;
+    }
+
+    niov = msg.msg_iovlen;
+    while (niov > 0 && msg.msg_iov->iov_len == 0) {
+        msg.msg_iov++;
+        niov--;
+    }
+    while (niov > 0) {
+        if (has_timeout) {
+            if (deadline_initialized) {
+                /* recompute the timeout */
+                interval = deadline - _PyTime_GetMonotonicClock();
+            }
+            else {
+                deadline_initialized = 1;
+                deadline = _PyTime_GetMonotonicClock() + s->sock_timeout;
+            }
+
+            if (interval <= 0) {
+                PyErr_SetString(PyExc_TimeoutError, "timed out");
+                goto done;
+            }
+        }
+
+        msg.msg_iovlen = Py_MIN(niov, SOCK_IOV_MAX);
+        ctx.msg = &msg;
+        ctx.flags = flags;
+        if (sock_call_ex(s, 1, sock_sendmsg_impl, &ctx, 0, NULL, interval) < 0)
+            goto done;
+        n = ctx.result;
+        assert(n >= 0);
+
+        /* Skip what was sent, and any empty buffers after it. */
+        while (niov > 0 && (size_t)n >= msg.msg_iov->iov_len) {
+            n -= msg.msg_iov->iov_len;
+            msg.msg_iov++;
+            niov--;
+        }
+        if (n > 0) {
+            msg.msg_iov->iov_base = (char *)msg.msg_iov->iov_base + n;
+            msg.msg_iov->iov_len -= n;
+        }
+
+        /* We must run our signal handlers before looping again.
+           sendmsg() can return a successful partial write when it is
+           interrupted, so we can't restrict ourselves to EINTR. */
+        if (PyErr_CheckSignals())
+            goto done;
+    }
+
+    Py_INCREF(Py_None);
+    res = Py_None;
+
+done:
+    PyMem_Free(iovs);
+    for (i = 0; i < ndatabufs; i++) {
+        PyBuffer_Release(&databufs[i]);
+    }
+    PyMem_Free(databufs);
+    return res;
+}
 #endif    /* CMSG_LEN */
 
+#ifdef HAVE_SENDMMSG
+struct sock_sendmmsg {
+    struct mmsghdr *msgvec;
+    unsigned int vlen;
+    int flags;
+    int result;
+};
+
+static int
+sock_sendmmsg_impl(PySocketSockObject *s, void *data)
+{
+    struct sock_sendmmsg *ctx = data;
+
+    ctx->result = sendmmsg(s->sock_fd, ctx->msgvec, ctx->vlen, ctx->flags);
+    return (ctx->result >= 0);
+}
+
+/* s.sendmmsg(messages[, flags]) method */
+
+static PyObject *
+sock_sendmmsg(PySocketSockObject *s, PyObject *args)
+{
+    int flags = 0;
+    struct iovec *iovs = NULL;
+    struct mmsghdr *msgvec = NULL;
+    sock_addr_t *addrbufs = NULL;
+    Py_ssize_t i, nitems, nbufs = 0;
+    Py_buffer *bufs = NULL;
+    PyObject *messages_arg, *fast, *retval = NULL;
+    struct sock_sendmmsg ctx;
+
+    if (!PyArg_ParseTuple(args, "O|i:sendmmsg", &messages_arg, &flags))
+        return NULL;
+
+    if (!IS_SELECTABLE(s))
+        return select_error();
+
+    if ((fast = PySequence_Fast(messages_arg,
+                                "sendmmsg() argument 1 must be an "
+                                "iterable")) == NULL)
+        return NULL;
+    nitems = PySequence_Fast_GET_SIZE(fast);
+    if (nitems > INT_MAX) {
+        PyErr_SetString(PyExc_OSError, "sendmmsg() argument 1 is too long");
+        goto finally;
+    }
+    if (nitems == 0) {
+        retval = PyLong_FromLong(0);
+        goto finally;
+    }
+
+    if ((iovs = PyMem_New(struct iovec, nitems)) == NULL ||
+        (bufs = PyMem_New(Py_buffer, nitems)) == NULL ||
+        (msgvec = PyMem_Calloc(nitems, sizeof(struct mmsghdr))) == NULL ||
+        (addrbufs = PyMem_New(sock_addr_t, nitems)) == NULL) {
+        PyErr_NoMemory();
+        goto finally;
+    }
+
+    /* Each item is either a bytes-like object, sent to the connected
+       peer, or a (data, address) pair. */
+    for (; nbufs < nitems; nbufs++) {
+        PyObject *item = PySequence_Fast_GET_ITEM(fast, nbufs);
+        PyObject *addr_arg = Py_None;
+        int addrlen;
+
+        if (PyTuple_Check(item)) {
+            if (!PyArg_ParseTuple(item,
+                                  "y*O;sendmmsg() items must be bytes-like "
+                                  "objects or (data, address) pairs",
+                                  &bufs[nbufs], &addr_arg))
+                goto finally;
+            if (!getsockaddrarg(s, addr_arg, &addrbufs[nbufs], &addrlen,
+                                "sendmmsg"))
+            {
+                PyBuffer_Release(&bufs[nbufs]);
+                goto finally;
+            }
+            msgvec[nbufs].msg_hdr.msg_name = SAS2SA(&addrbufs[nbufs]);
+            msgvec[nbufs].msg_hdr.msg_namelen = addrlen;
+        }
+        else if (!PyArg_Parse(item,
+                              "y*;sendmmsg() items must be bytes-like "
+                              "objects or (data, address) pairs",
+                              &bufs[nbufs])) {
+            goto finally;
+        }
+        if (PySys_Audit("socket.sendmmsg", "OO", s, addr_arg) < 0) {
+            PyBuffer_Release(&bufs[nbufs]);
+            goto finally;
+        }
+        iovs[nbufs].iov_base = bufs[nbufs].buf;
+        iovs[nbufs].iov_len = bufs[nbufs].len;
+        msgvec[nbufs].msg_hdr.msg_iov = &iovs[nbufs];
+        msgvec[nbufs].msg_hdr.msg_iovlen = 1;
+    }
+
+    ctx.msgvec = msgvec;
+    ctx.vlen = (unsigned int)nitems;
+    ctx.flags = flags;
+    if (sock_call(s, 1, sock_sendmmsg_impl, &ctx) < 0)
+        goto finally;
+
+    retval = PyLong_FromLong(ctx.result);
+
+finally:
+    for (i = 0; i < nbufs; i++)
+        PyBuffer_Release(&bufs[i]);
+    PyMem_Free(addrbufs);
+    PyMem_Free(msgvec);
+    PyMem_Free(bufs);
+    PyMem_Free(iovs);
+    Py_DECREF(fast);
+    return retval;
+}
+
+PyDoc_STRVAR(sendmmsg_doc,
+"sendmmsg(messages[, flags]) -> count\n\
+\n\
+Send several datagrams to the socket with a single system call.  Each\n\
+item of the messages iterable is either a bytes-like object, sent to\n\
+the connected peer, or a (data, address) pair.  The flags argument\n\
+defaults to 0 and has the same meaning as for send().  The return\n\
+value is the number of messages sent, which may be less than the\n\
+number of items if the socket buffer fills up.");
+#endif    /* HAVE_SENDMMSG */
+
 #ifdef HAVE_SOCKADDR_ALG
 static PyObject*
 sock_sendmsg_afalg(PySocketSockObject *self, PyObject *args, PyObject *kwds)
@@ -4966,6 +5355,14 @@ static PyMethodDef sock_methods[] = {
     {"sendmsg",           (PyCFunction)sock_sendmsg, METH_VARARGS,
                       sendmsg_doc},
 #endif
+#ifdef HAVE_RECVMMSG
+    {"recvmmsg_into",     (PyCFunction)sock_recvmmsg_into, METH_VARARGS,
+                      recvmmsg_into_doc,},
+#endif
+#ifdef HAVE_SENDMMSG
+    {"sendmmsg",          (PyCFunction)sock_sendmmsg, METH_VARARGS,
+                      sendmmsg_doc},
+#endif
 #ifdef HAVE_SOCKADDR_ALG
     {"sendmsg_afalg",     (PyCFunction)(void(*)(void))sock_sendmsg_afalg, METH_VARARGS | METH_KEYWORDS,
                       sendmsg_afalg_doc},
@@ -7514,6 +7911,9 @@ PyInit__socket(void)
     PyModule_AddIntMacro(m, SO_REUSEPORT);
 #endif
 #endif
+#ifdef  SO_ZEROCOPY
+    PyModule_AddIntMacro(m, SO_ZEROCOPY);
+#endif
 #ifdef  SO_SNDBUF
     PyModule_AddIntMacro(m, SO_SNDBUF);
 #endif
@@ -7651,6 +8051,9 @@ PyInit__socket(void)
 #ifdef MSG_FASTOPEN
     PyModule_AddIntMacro(m, MSG_FASTOPEN);
 #endif
+#ifdef MSG_ZEROCOPY
+    PyModule_AddIntMacro(m, MSG_ZEROCOPY);
+#endif
 
     /* Protocol level and numbers, usable for [gs]etsockopt */
 #ifdef  SOL_SOCKET
@@ -9,6 +9,77 @@
 #include "structmember.h"         // PyMemberDef
 #include "zlib.h"
 
+// Blocks output buffer wrappers
+#include "pycore_blocks_output_buffer.h"
+
+#if OUTPUT_BUFFER_MAX_BLOCK_SIZE > UINT32_MAX
+    #error "The maximum block size accepted by zlib is UINT32_MAX."
+#endif
+
+/* On success, return value >= 0
+   On failure, return -1 */
+static inline Py_ssize_t
+OutputBuffer_InitAndGrow(_BlocksOutputBuffer *buffer, Py_ssize_t max_length,
+                         Bytef **next_out, uInt *avail_out)
+{
+    Py_ssize_t allocated;
+
+    allocated = _BlocksOutputBuffer_InitAndGrow(
+                    buffer, max_length, (void**) next_out);
+    *avail_out = (uInt) allocated;
+    return allocated;
+}
+
+/* On success, return value >= 0
+   On failure, return -1 */
+static inline Py_ssize_t
+OutputBuffer_InitWithSize(_BlocksOutputBuffer *buffer, Py_ssize_t init_size,
+                          Bytef **next_out, uInt *avail_out)
+{
+    Py_ssize_t allocated;
+
+    if (init_size > UINT32_MAX) {
+        init_size = UINT32_MAX;
+    }
+
+    allocated = _BlocksOutputBuffer_InitWithSize(
+                    buffer, init_size, (void**) next_out);
+    *avail_out = (uInt) allocated;
+    return allocated;
+}
+
+/* On success, return value >= 0
+   On failure, return -1 */
+static inline Py_ssize_t
+OutputBuffer_Grow(_BlocksOutputBuffer *buffer,
+                  Bytef **next_out, uInt *avail_out)
+{
+    Py_ssize_t allocated;
+
+    allocated = _BlocksOutputBuffer_Grow(
+                    buffer, (void**) next_out, (Py_ssize_t) *avail_out);
+    *avail_out = (uInt) allocated;
+    return allocated;
+}
+
+static inline Py_ssize_t
+OutputBuffer_GetDataSize(_BlocksOutputBuffer *buffer, uInt avail_out)
+{
+    return _BlocksOutputBuffer_GetDataSize(buffer, (Py_ssize_t) avail_out);
+}
+
+static inline PyObject *
+OutputBuffer_Finish(_BlocksOutputBuffer *buffer, uInt avail_out)
+{
+    return _BlocksOutputBuffer_Finish(buffer, (Py_ssize_t) avail_out);
+}
+
+static inline void
+OutputBuffer_OnError(_BlocksOutputBuffer *buffer)
+{
+    _BlocksOutputBuffer_OnError(buffer);
+}
+
 
 #define ENTER_ZLIB(obj) \
     Py_BEGIN_ALLOW_THREADS; \
@@ -147,56 +218,6 @@ arrange_input_buffer(z_stream *zst, Py_ssize_t *remains)
     *remains -= zst->avail_in;
 }
 
-static Py_ssize_t
-arrange_output_buffer_with_maximum(z_stream *zst, PyObject **buffer,
-                                   Py_ssize_t length,
-                                   Py_ssize_t max_length)
-{
-    Py_ssize_t occupied;
-
-    if (*buffer == NULL) {
-        if (!(*buffer = PyBytes_FromStringAndSize(NULL, length)))
-            return -1;
-        occupied = 0;
-    }
-    else {
-        occupied = zst->next_out - (Byte *)PyBytes_AS_STRING(*buffer);
-
-        if (length == occupied) {
-            Py_ssize_t new_length;
-            assert(length <= max_length);
-            /* can not scale the buffer over max_length */
-            if (length == max_length)
-                return -2;
-            if (length <= (max_length >> 1))
-                new_length = length << 1;
-            else
-                new_length = max_length;
-            if (_PyBytes_Resize(buffer, new_length) < 0)
-                return -1;
-            length = new_length;
-        }
-    }
-
-    zst->avail_out = (uInt)Py_MIN((size_t)(length - occupied), UINT_MAX);
-    zst->next_out = (Byte *)PyBytes_AS_STRING(*buffer) + occupied;
-
-    return length;
-}
-
-static Py_ssize_t
-arrange_output_buffer(z_stream *zst, PyObject **buffer, Py_ssize_t length)
-{
-    Py_ssize_t ret;
-
-    ret = arrange_output_buffer_with_maximum(zst, buffer, length,
-                                             PY_SSIZE_T_MAX);
-    if (ret == -2)
-        PyErr_NoMemory();
-
-    return ret;
-}
-
 /*[clinic input]
 zlib.compress
 
@@ -213,16 +234,20 @@ static PyObject *
 zlib_compress_impl(PyObject *module, Py_buffer *data, int level)
 /*[clinic end generated code: output=d80906d73f6294c8 input=638d54b6315dbed3]*/
 {
-    PyObject *RetVal = NULL;
-    Py_ssize_t obuflen = DEF_BUF_SIZE;
+    PyObject *RetVal;
     int flush;
     z_stream zst;
+    _BlocksOutputBuffer buffer = {.list = NULL};
 
     zlibstate *state = get_zlib_state(module);
 
     Byte *ibuf = data->buf;
     Py_ssize_t ibuflen = data->len;
 
+    if (OutputBuffer_InitAndGrow(&buffer, -1, &zst.next_out, &zst.avail_out) < 0) {
+        goto error;
+    }
+
     zst.opaque = NULL;
     zst.zalloc = PyZlib_Malloc;
     zst.zfree = PyZlib_Free;
@@ -250,10 +275,11 @@ zlib_compress_impl(PyObject *module, Py_buffer *data, int level)
         flush = ibuflen == 0 ? Z_FINISH : Z_NO_FLUSH;
 
         do {
-            obuflen = arrange_output_buffer(&zst, &RetVal, obuflen);
-            if (obuflen < 0) {
-                deflateEnd(&zst);
-                goto error;
+            if (zst.avail_out == 0) {
+                if (OutputBuffer_Grow(&buffer, &zst.next_out, &zst.avail_out) < 0) {
+                    deflateEnd(&zst);
+                    goto error;
+                }
             }
 
             Py_BEGIN_ALLOW_THREADS
@@ -274,18 +300,294 @@ zlib_compress_impl(PyObject *module, Py_buffer *data, int level)
 
     err = deflateEnd(&zst);
     if (err == Z_OK) {
-        if (_PyBytes_Resize(&RetVal, zst.next_out -
-                            (Byte *)PyBytes_AS_STRING(RetVal)) < 0)
+        RetVal = OutputBuffer_Finish(&buffer, zst.avail_out);
+        if (RetVal == NULL) {
             goto error;
+        }
         return RetVal;
     }
     else
         zlib_error(state, zst, err, "while finishing compression");
  error:
-    Py_XDECREF(RetVal);
+    OutputBuffer_OnError(&buffer);
     return NULL;
 }
 
+/* Parallel raw deflate.
+
+   The input is split into blocks that are compressed independently by a pool
+   of native threads that never touch Python objects.  Each block is primed
+   with the 32 KiB of input preceding it as a preset dictionary and ends with
+   a sync flush, so the concatenated blocks form a single valid raw deflate
+   stream that any inflater can decode, in the manner of pigz. */
+
+#define PARALLEL_WINDOW_SIZE (1 << MAX_WBITS)
+#define PARALLEL_BLOCK_SIZE (128*1024)
+
+typedef struct {
+    Byte *out;
+    size_t outlen;
+    int err;
+} deflate_block;
+
+typedef struct {
+    const Byte *data;
+    Py_ssize_t len;
+    const Byte *zdict;
+    Py_ssize_t zdict_len;
+    int level;
+    int finish;
+    Py_ssize_t blocksize;
+    Py_ssize_t nblocks;
+    deflate_block *blocks;
+    /* next and running are protected by lock.  done is held until the last
+       participating thread has finished. */
+    Py_ssize_t next;
+    int running;
+    PyThread_type_lock lock;
+    PyThread_type_lock done;
+} deflate_job;
+
+static void
+deflate_one_block(deflate_job *job, Py_ssize_t i)
+{
+    deflate_block *b = &job->blocks[i];
+    Py_ssize_t start = i * job->blocksize;
+    Py_ssize_t len = Py_MIN(job->blocksize, job->len - start);
+    int last = (i == job->nblocks - 1);
+    int flush = (last && job->finish) ? Z_FINISH : Z_SYNC_FLUSH;
+    const Byte *dict;
+    Py_ssize_t dict_len;
+    z_stream zst;
+    uLong bound;
+    int err;
+
+    if (i == 0) {
+        dict = job->zdict;
+        dict_len = job->zdict_len;
+    }
+    else {
+        dict_len = Py_MIN(start, PARALLEL_WINDOW_SIZE);
+        dict = job->data + start - dict_len;
+    }
+    if (dict_len > PARALLEL_WINDOW_SIZE) {
+        dict += dict_len - PARALLEL_WINDOW_SIZE;
+        dict_len = PARALLEL_WINDOW_SIZE;
+    }
+
+    zst.opaque = NULL;
+    zst.zalloc = PyZlib_Malloc;
+    zst.zfree = PyZlib_Free;
+    zst.next_in = NULL;
+    zst.avail_in = 0;
+    err = deflateInit2(&zst, job->level, DEFLATED, -MAX_WBITS,
+                       DEF_MEM_LEVEL, Z_DEFAULT_STRATEGY);
+    if (err != Z_OK) {
+        b->err = err;
+        return;
+    }
+    if (dict_len > 0) {
+        err = deflateSetDictionary(&zst, dict, (uInt)dict_len);
+        if (err != Z_OK) {
+            goto done;
+        }
+    }
+
+    /* deflateBound() covers Z_FINISH; leave room for the empty stored
+       block emitted by Z_SYNC_FLUSH as well. */
+    bound = deflateBound(&zst, (uLong)len) + 16;
+    b->out = PyMem_RawMalloc(bound);
+    if (b->out == NULL) {
+        err = Z_MEM_ERROR;
+        goto done;
+    }
+    zst.next_in = (Byte *)job->data + start;
+    zst.avail_in = (uInt)len;
+    zst.next_out = b->out;
+    zst.avail_out = (uInt)bound;
+    err = deflate(&zst, flush);
+    if (err == Z_OK || err == Z_STREAM_END) {
+        if (zst.avail_in != 0 || zst.avail_out == 0 ||
+            (flush == Z_FINISH && err != Z_STREAM_END)) {
+            err = Z_BUF_ERROR;
+        }
+        else {
+            b->outlen = bound - zst.avail_out;
+            err = Z_OK;
+        }
+    }
+
+ done:
+    deflateEnd(&zst);
+    b->err = err;
+}
+
+static void
+deflate_worker(void *arg)
+{
+    deflate_job *job = (deflate_job *)arg;
+    int last;
+
+    for (;;) {
+        Py_ssize_t i;
+        PyThread_acquire_lock(job->lock, WAIT_LOCK);
+        i = job->next++;
+        PyThread_release_lock(job->lock);
+        if (i >= job->nblocks) {
+            break;
+        }
+        deflate_one_block(job, i);
+    }
+
+    PyThread_acquire_lock(job->lock, WAIT_LOCK);
+    last = (--job->running == 0);
+    PyThread_release_lock(job->lock);
+    /* The job may be freed as soon as done is released. */
+    if (last) {
+        PyThread_release_lock(job->done);
+    }
+}
+
+/*[clinic input]
+zlib.deflate_parallel
+
+    data: Py_buffer
+        Binary data to be compressed.
+    /
+    level: int(c_default="Z_DEFAULT_COMPRESSION") = Z_DEFAULT_COMPRESSION
+        Compression level, in 0-9 or -1.
+    *
+    threads: int = 1
+        Number of threads to compress with, including the calling thread.
+    blocksize: Py_ssize_t(c_default="PARALLEL_BLOCK_SIZE") = 131072
+        Size of the independently compressed blocks of input.
+    zdict: Py_buffer = None
+        Data preceding *data* in the stream; its last 32 KiB are used as the
+        preset dictionary of the first block.
+    finish: bool(accept={int}) = True
+        If true, end the stream; otherwise end with a sync flush so that
+        more data can be appended with another call.
+
+Compress data into a raw deflate stream using multiple threads.
+
+The result has no zlib or gzip header or trailer.  It can be decompressed
+with wbits=-15, and concatenating the results of consecutive calls with
+finish=False, followed by one call with finish=True, forms a single stream.
+[clinic start generated code]*/
+
+static PyObject *
+zlib_deflate_parallel_impl(PyObject *module, Py_buffer *data, int level,
+                           int threads, Py_ssize_t blocksize,
+                           Py_buffer *zdict, int finish)
+/*[clinic end generated code: output=4be8736222ae3ad1 input=87b985eeb2733d60]*/
+{
+    zlibstate *state = get_zlib_state(module);
+    deflate_job job;
+    PyObject *RetVal = NULL;
+    Py_ssize_t i, total;
+    int nthreads;
+
+    if (level < Z_DEFAULT_COMPRESSION || level > Z_BEST_COMPRESSION) {
+        PyErr_SetString(state->ZlibError, "Bad compression level");
+        return NULL;
+    }
+    if (threads < 1) {
+        PyErr_SetString(PyExc_ValueError, "threads must be at least 1");
+        return NULL;
+    }
+    if (blocksize < 1 || (size_t)blocksize > UINT_MAX / 2) {
+        PyErr_SetString(PyExc_ValueError, "blocksize out of range");
+        return NULL;
+    }
+
+    memset(&job, 0, sizeof(job));
+    job.data = data->buf;
+    job.len = data->len;
+    if (zdict->buf != NULL) {
+        job.zdict = zdict->buf;
+        job.zdict_len = zdict->len;
+    }
+    job.level = level;
+    job.finish = finish;
+    job.blocksize = blocksize;
+    /* Empty input still needs one block for the final or sync flush. */
+    job.nblocks = data->len == 0 ? 1 : (data->len - 1) / blocksize + 1;
+    job.blocks = PyMem_Calloc(job.nblocks, sizeof(deflate_block));
+    if (job.blocks == NULL) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+    job.lock = PyThread_allocate_lock();
+    job.done = PyThread_allocate_lock();
+    if (job.lock == NULL || job.done == NULL) {
+        PyErr_SetString(PyExc_MemoryError, "Unable to allocate lock");
+        goto done;
+    }
+    PyThread_acquire_lock(job.done, WAIT_LOCK);
+
+    /* The calling thread takes part too; threads that cannot be started
+       just leave more blocks for the others. */
+    nthreads = (int)Py_MIN(threads, job.nblocks);
+    job.running = 1;
+    for (i = 1; i < nthreads; i++) {
+        PyThread_acquire_lock(job.lock, WAIT_LOCK);
+        job.running++;
+        PyThread_release_lock(job.lock);
+        if (PyThread_start_new_thread(deflate_worker, &job) ==
+                PYTHREAD_INVALID_THREAD_ID) {
+            PyThread_acquire_lock(job.lock, WAIT_LOCK);
+            job.running--;
+            PyThread_release_lock(job.lock);
+            break;
+        }
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    deflate_worker(&job);
+    PyThread_acquire_lock(job.done, WAIT_LOCK);
+    Py_END_ALLOW_THREADS
+    PyThread_release_lock(job.done);
+
+    total = 0;
+    for (i = 0; i < job.nblocks; i++) {
+        int err = job.blocks[i].err;
+        if (err == Z_MEM_ERROR) {
+            PyErr_SetString(PyExc_MemoryError,
+                            "Out of memory while compressing data");
+            goto done;
+        }
+        if (err != Z_OK) {
+            PyErr_Format(state->ZlibError,
+                         "Error %d while compressing data", err);
+            goto done;
+        }
+        total += job.blocks[i].outlen;
+    }
+
+    RetVal = PyBytes_FromStringAndSize(NULL, total);
+    if (RetVal == NULL) {
+        goto done;
+    }
+    Byte *p = (Byte *)PyBytes_AS_STRING(RetVal);
+    for (i = 0; i < job.nblocks; i++) {
+        memcpy(p, job.blocks[i].out, job.blocks[i].outlen);
+        p += job.blocks[i].outlen;
+    }
+
+ done:
+    for (i = 0; i < job.nblocks; i++) {
+        PyMem_RawFree(job.blocks[i].out);
+    }
+    PyMem_Free(job.blocks);
+    if (job.lock != NULL) {
+        PyThread_free_lock(job.lock);
+    }
+    if (job.done != NULL) {
+        PyThread_free_lock(job.done);
+    }
+    return RetVal;
+}
+
 /*[clinic input]
 zlib.decompress
 
@@ -305,11 +607,12 @@ zlib_decompress_impl(PyObject *module, Py_buffer *data, int wbits,
                      Py_ssize_t bufsize)
 /*[clinic end generated code: output=77c7e35111dc8c42 input=a9ac17beff1f893f]*/
 {
-    PyObject *RetVal = NULL;
+    PyObject *RetVal;
     Byte *ibuf;
     Py_ssize_t ibuflen;
     int err, flush;
     z_stream zst;
+    _BlocksOutputBuffer buffer = {.list = NULL};
 
     zlibstate *state = get_zlib_state(module);
 
@@ -320,6 +623,10 @@ zlib_decompress_impl(PyObject *module, Py_buffer *data, int wbits,
         bufsize = 1;
     }
 
+    if (OutputBuffer_InitWithSize(&buffer, bufsize, &zst.next_out, &zst.avail_out) < 0) {
+        goto error;
+    }
+
     ibuf = data->buf;
     ibuflen = data->len;
 
@@ -348,10 +655,11 @@ zlib_decompress_impl(PyObject *module, Py_buffer *data, int wbits,
         flush = ibuflen == 0 ? Z_FINISH : Z_NO_FLUSH;
 
         do {
-            bufsize = arrange_output_buffer(&zst, &RetVal, bufsize);
-            if (bufsize < 0) {
-                inflateEnd(&zst);
-                goto error;
+            if (zst.avail_out == 0) {
+                if (OutputBuffer_Grow(&buffer, &zst.next_out, &zst.avail_out) < 0) {
+                    inflateEnd(&zst);
+                    goto error;
+                }
             }
 
             Py_BEGIN_ALLOW_THREADS
@@ -391,14 +699,13 @@ zlib_decompress_impl(PyObject *module, Py_buffer *data, int wbits,
         goto error;
     }
 
-    if (_PyBytes_Resize(&RetVal, zst.next_out -
-                        (Byte *)PyBytes_AS_STRING(RetVal)) < 0)
-        goto error;
-
-    return RetVal;
+    RetVal = OutputBuffer_Finish(&buffer, zst.avail_out);
+    if (RetVal != NULL) {
+        return RetVal;
+    }
 
  error:
-    Py_XDECREF(RetVal);
+    OutputBuffer_OnError(&buffer);
     return NULL;
 }
 
@@ -631,24 +938,30 @@ zlib_Compress_compress_impl(compobject *self, PyTypeObject *cls,
                             Py_buffer *data)
 /*[clinic end generated code: output=6731b3f0ff357ca6 input=04d00f65ab01d260]*/
 {
-    PyObject *RetVal = NULL;
-    Py_ssize_t obuflen = DEF_BUF_SIZE;
+    PyObject *RetVal;
     int err;
+    _BlocksOutputBuffer buffer = {.list = NULL};
 
     zlibstate *state = PyType_GetModuleState(cls);
 
+    ENTER_ZLIB(self);
+
     self->zst.next_in = data->buf;
     Py_ssize_t ibuflen = data->len;
 
-    ENTER_ZLIB(self);
+    if (OutputBuffer_InitAndGrow(&buffer, -1, &self->zst.next_out, &self->zst.avail_out) < 0) {
+        goto error;
+    }
 
     do {
         arrange_input_buffer(&self->zst, &ibuflen);
 
         do {
-            obuflen = arrange_output_buffer(&self->zst, &RetVal, obuflen);
-            if (obuflen < 0)
-                goto error;
+            if (self->zst.avail_out == 0) {
+                if (OutputBuffer_Grow(&buffer, &self->zst.next_out, &self->zst.avail_out) < 0) {
+                    goto error;
+                }
+            }
 
             Py_BEGIN_ALLOW_THREADS
             err = deflate(&self->zst, Z_NO_FLUSH);
@@ -664,12 +977,14 @@ zlib_Compress_compress_impl(compobject *self, PyTypeObject *cls,
 
     } while (ibuflen != 0);
 
-    if (_PyBytes_Resize(&RetVal, self->zst.next_out -
-                        (Byte *)PyBytes_AS_STRING(RetVal)) == 0)
+    RetVal = OutputBuffer_Finish(&buffer, self->zst.avail_out);
+    if (RetVal != NULL) {
         goto success;
+    }
 
  error:
-    Py_CLEAR(RetVal);
+    OutputBuffer_OnError(&buffer);
+    RetVal = NULL;
  success:
     LEAVE_ZLIB(self);
     return RetVal;
@@ -745,8 +1060,9 @@ zlib_Decompress_decompress_impl(compobject *self, PyTypeObject *cls,
 /*[clinic end generated code: output=b024a93c2c922d57 input=bfb37b3864cfb606]*/
 {
     int err = Z_OK;
-    Py_ssize_t ibuflen, obuflen = DEF_BUF_SIZE, hard_limit;
-    PyObject *RetVal = NULL;
+    Py_ssize_t ibuflen;
+    PyObject *RetVal;
+    _BlocksOutputBuffer buffer = {.list = NULL};
 
     PyObject *module = PyType_GetModule(cls);
     if (module == NULL)
@@ -756,34 +1072,30 @@ zlib_Decompress_decompress_impl(compobject *self, PyTypeObject *cls,
     if (max_length < 0) {
         PyErr_SetString(PyExc_ValueError, "max_length must be non-negative");
         return NULL;
-    } else if (max_length == 0)
-        hard_limit = PY_SSIZE_T_MAX;
-    else
-        hard_limit = max_length;
+    } else if (max_length == 0) {
+        max_length = -1;
+    }
+
+    ENTER_ZLIB(self);
 
     self->zst.next_in = data->buf;
     ibuflen = data->len;
 
-    /* limit amount of data allocated to max_length */
-    if (max_length && obuflen > max_length)
-        obuflen = max_length;
-
-    ENTER_ZLIB(self);
+    if (OutputBuffer_InitAndGrow(&buffer, max_length, &self->zst.next_out, &self->zst.avail_out) < 0) {
+        goto abort;
+    }
 
     do {
         arrange_input_buffer(&self->zst, &ibuflen);
 
         do {
-            obuflen = arrange_output_buffer_with_maximum(&self->zst, &RetVal,
-                                                         obuflen, hard_limit);
-            if (obuflen == -2) {
-                if (max_length > 0) {
+            if (self->zst.avail_out == 0) {
+                if (OutputBuffer_GetDataSize(&buffer, self->zst.avail_out) == max_length) {
                     goto save;
                 }
-                PyErr_NoMemory();
-            }
-            if (obuflen < 0) {
-                goto abort;
+                if (OutputBuffer_Grow(&buffer, &self->zst.next_out, &self->zst.avail_out) < 0) {
+                    goto abort;
+                }
             }
 
             Py_BEGIN_ALLOW_THREADS
@@ -827,17 +1139,114 @@ zlib_Decompress_decompress_impl(compobject *self, PyTypeObject *cls,
         goto abort;
     }
 
-    if (_PyBytes_Resize(&RetVal, self->zst.next_out -
-                        (Byte *)PyBytes_AS_STRING(RetVal)) == 0)
+    RetVal = OutputBuffer_Finish(&buffer, self->zst.avail_out);
+    if (RetVal != NULL) {
         goto success;
+    }
 
  abort:
-    Py_CLEAR(RetVal);
+    OutputBuffer_OnError(&buffer);
+    RetVal = NULL;
  success:
     LEAVE_ZLIB(self);
     return RetVal;
 }
 
+/*[clinic input]
+zlib.Decompress.decompress_into
+
+    cls: defining_class
+    data: Py_buffer
+        The binary data to decompress.
+    buffer: Py_buffer(accept={rwbuffer})
+        A writable buffer that receives the decompressed data.
+    /
+
+Decompress data into buffer and return the number of bytes written.
+
+Decompression stops when buffer is full, in which case unconsumed input
+data is stored in the unconsumed_tail attribute, as for decompress() with
+max_length set to the size of buffer.
+[clinic start generated code]*/
+
+static PyObject *
+zlib_Decompress_decompress_into_impl(compobject *self, PyTypeObject *cls,
+                                     Py_buffer *data, Py_buffer *buffer)
+/*[clinic end generated code: output=eb2bb6ac5bcdb0bb input=0c6edf802f513ea4]*/
+{
+    int err = Z_OK;
+    Py_ssize_t ibuflen, obuflen;
+    PyObject *RetVal = NULL;
+
+    PyObject *module = PyType_GetModule(cls);
+    if (module == NULL)
+        return NULL;
+
+    zlibstate *state = get_zlib_state(module);
+
+    ENTER_ZLIB(self);
+
+    self->zst.next_in = data->buf;
+    ibuflen = data->len;
+    self->zst.next_out = buffer->buf;
+    self->zst.avail_out = 0;
+    obuflen = buffer->len;
+
+    do {
+        arrange_input_buffer(&self->zst, &ibuflen);
+
+        do {
+            if (self->zst.avail_out == 0) {
+                if (obuflen == 0) {
+                    goto save;
+                }
+                self->zst.avail_out = (uInt)Py_MIN((size_t)obuflen, UINT_MAX);
+                obuflen -= self->zst.avail_out;
+            }
+
+            Py_BEGIN_ALLOW_THREADS
+            err = inflate(&self->zst, Z_SYNC_FLUSH);
+            Py_END_ALLOW_THREADS
+
+            switch (err) {
+            case Z_OK:            /* fall through */
+            case Z_BUF_ERROR:     /* fall through */
+            case Z_STREAM_END:
+                break;
+            default:
+                if (err == Z_NEED_DICT && self->zdict != NULL) {
+                    if (set_inflate_zdict(state, self) < 0) {
+                        goto done;
+                    }
+                    else
+                        break;
+                }
+                goto save;
+            }
+
+        } while (self->zst.avail_out == 0 || err == Z_NEED_DICT);
+
+    } while (err != Z_STREAM_END && ibuflen != 0);
+
+ save:
+    if (save_unconsumed_input(self, data, err) < 0)
+        goto done;
+
+    if (err == Z_STREAM_END) {
+        self->eof = 1;
+    } else if (err != Z_OK && err != Z_BUF_ERROR) {
+        zlib_error(state, self->zst, err, "while decompressing data");
+        goto done;
+    }
+
+    RetVal = PyLong_FromSsize_t((Byte *)self->zst.next_out -
+                                (Byte *)buffer->buf);
+
+ done:
+    LEAVE_ZLIB(self);
+    return RetVal;
+}
+
 /*[clinic input]
 zlib.Compress.flush
 
@@ -857,8 +1266,8 @@ zlib_Compress_flush_impl(compobject *self, PyTypeObject *cls, int mode)
 /*[clinic end generated code: output=c7efd13efd62add2 input=286146e29442eb6c]*/
 {
     int err;
-    Py_ssize_t length = DEF_BUF_SIZE;
-    PyObject *RetVal = NULL;
+    PyObject *RetVal;
+    _BlocksOutputBuffer buffer = {.list = NULL};
 
     zlibstate *state = PyType_GetModuleState(cls);
     /* Flushing with Z_NO_FLUSH is a no-op, so there's no point in
@@ -871,11 +1280,15 @@ zlib_Compress_flush_impl(compobject *self, PyTypeObject *cls, int mode)
 
     self->zst.avail_in = 0;
 
+    if (OutputBuffer_InitAndGrow(&buffer, -1, &self->zst.next_out, &self->zst.avail_out) < 0) {
+        goto error;
+    }
+
     do {
-        length = arrange_output_buffer(&self->zst, &RetVal, length);
-        if (length < 0) {
-            Py_CLEAR(RetVal);
-            goto error;
+        if (self->zst.avail_out == 0) {
+            if (OutputBuffer_Grow(&buffer, &self->zst.next_out, &self->zst.avail_out) < 0) {
+                goto error;
+            }
         }
 
         Py_BEGIN_ALLOW_THREADS
@@ -884,7 +1297,6 @@ zlib_Compress_flush_impl(compobject *self, PyTypeObject *cls, int mode)
 
         if (err == Z_STREAM_ERROR) {
             zlib_error(state, self->zst, err, "while flushing");
-            Py_CLEAR(RetVal);
             goto error;
         }
     } while (self->zst.avail_out == 0);
@@ -897,7 +1309,6 @@ zlib_Compress_flush_impl(compobject *self, PyTypeObject *cls, int mode)
         err = deflateEnd(&self->zst);
         if (err != Z_OK) {
             zlib_error(state, self->zst, err, "while finishing compression");
-            Py_CLEAR(RetVal);
             goto error;
         }
         else
@@ -909,15 +1320,18 @@ zlib_Compress_flush_impl(compobject *self, PyTypeObject *cls, int mode)
         */
     } else if (err != Z_OK && err != Z_BUF_ERROR) {
         zlib_error(state, self->zst, err, "while flushing");
-        Py_CLEAR(RetVal);
         goto error;
     }
 
-    if (_PyBytes_Resize(&RetVal, self->zst.next_out -
-                        (Byte *)PyBytes_AS_STRING(RetVal)) < 0)
-        Py_CLEAR(RetVal);
+    RetVal = OutputBuffer_Finish(&buffer, self->zst.avail_out);
+    if (RetVal != NULL) {
+        goto success;
+    }
 
  error:
+    OutputBuffer_OnError(&buffer);
+    RetVal = NULL;
+ success:
     LEAVE_ZLIB(self);
     return RetVal;
 }
@@ -1119,8 +1533,9 @@ zlib_Decompress_flush_impl(compobject *self, PyTypeObject *cls,
 {
     int err, flush;
     Py_buffer data;
-    PyObject *RetVal = NULL;
+    PyObject *RetVal;
     Py_ssize_t ibuflen;
+    _BlocksOutputBuffer buffer = {.list = NULL};
 
     PyObject *module = PyType_GetModule(cls);
     if (module == NULL) {
@@ -1143,14 +1558,20 @@ zlib_Decompress_flush_impl(compobject *self, PyTypeObject *cls,
     self->zst.next_in = data.buf;
     ibuflen = data.len;
 
+    if (OutputBuffer_InitWithSize(&buffer, length, &self->zst.next_out, &self->zst.avail_out) < 0) {
+        goto abort;
+    }
+
     do {
         arrange_input_buffer(&self->zst, &ibuflen);
         flush = ibuflen == 0 ? Z_FINISH : Z_NO_FLUSH;
 
         do {
-            length = arrange_output_buffer(&self->zst, &RetVal, length);
-            if (length < 0)
-                goto abort;
+            if (self->zst.avail_out == 0) {
+                if (OutputBuffer_Grow(&buffer, &self->zst.next_out, &self->zst.avail_out) < 0) {
+                    goto abort;
+                }
+            }
 
             Py_BEGIN_ALLOW_THREADS
             err = inflate(&self->zst, flush);
@@ -1192,13 +1613,14 @@ zlib_Decompress_flush_impl(compobject *self, PyTypeObject *cls,
         }
     }
 
-    if (_PyBytes_Resize(&RetVal, self->zst.next_out -
-                        (Byte *)PyBytes_AS_STRING(RetVal)) == 0) {
+    RetVal = OutputBuffer_Finish(&buffer, self->zst.avail_out);
+    if (RetVal != NULL) {
         goto success;
     }
 
  abort:
-    Py_CLEAR(RetVal);
+    OutputBuffer_OnError(&buffer);
+    RetVal = NULL;
  success:
     PyBuffer_Release(&data);
     LEAVE_ZLIB(self);
@@ -1220,6 +1642,7 @@ static PyMethodDef comp_methods[] =
 static PyMethodDef Decomp_methods[] =
 {
     ZLIB_DECOMPRESS_DECOMPRESS_METHODDEF
+    ZLIB_DECOMPRESS_DECOMPRESS_INTO_METHODDEF
     ZLIB_DECOMPRESS_FLUSH_METHODDEF
     ZLIB_DECOMPRESS_COPY_METHODDEF
     ZLIB_DECOMPRESS___COPY___METHODDEF
@@ -1322,6 +1745,7 @@ static PyMethodDef zlib_methods[] =
     ZLIB_COMPRESS_METHODDEF
     ZLIB_COMPRESSOBJ_METHODDEF
     ZLIB_CRC32_METHODDEF
+    ZLIB_DEFLATE_PARALLEL_METHODDEF
     ZLIB_DECOMPRESS_METHODDEF
     ZLIB_DECOMPRESSOBJ_METHODDEF
     {NULL, NULL}
@@ -61,6 +61,9 @@ struct _dictkeysobject {
        Dynamically sized, SIZEOF_VOID_P is minimum. */
     char dk_indices[];  /* char is required to avoid strict aliasing. */
 
+    /* "uint8_t dk_tags[dk_size];" array of hash fingerprints follows:
+       see the DK_TAGS() macro */
+
     /* "PyDictKeyEntry dk_entries[dk_usable];" array follows:
        see the DK_ENTRIES() macro */
 };
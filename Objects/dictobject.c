@@ -26,6 +26,8 @@ As of Python 3.6, this is compact and ordered. Basic idea is described here:
 | dk_indices    |
 |               |
 +---------------+
+| dk_tags       |
++---------------+
 | dk_entries    |
 |               |
 +---------------+
@@ -39,6 +41,13 @@ Size of indices is dk_size.  Type of each index in indices is vary on dk_size:
 * int32 for 2**16 <= dk_size <= 2**31
 * int64 for 2**32 <= dk_size
 
+dk_tags is array of uint8_t parallel to dk_indices.  When dk_indices[i] >= 0,
+dk_tags[i] holds a one byte fingerprint of the hash of the entry it points to
+(see DK_HASH_TAG).  Lookups compare the fingerprint before touching the entry,
+so colliding slots can usually be skipped without loading dk_entries, which is
+a cache miss per probe in large dicts.  Slots holding DKIX_EMPTY or DKIX_DUMMY
+have undefined tags.  DK_TAGS(dk) can be used to get pointer to tags.
+
 dk_entries is array of PyDictKeyEntry.  Its size is USABLE_FRACTION(dk_size).
 DK_ENTRIES(dk) can be used to get pointer to entries.
 
@@ -309,8 +318,22 @@ _PyDict_DebugMallocStats(FILE *out)
         1 : DK_SIZE(dk) <= 0xffff ?            \
             2 : sizeof(int32_t))
 #endif
+#define DK_TAGS(dk) \
+    ((uint8_t*)(&((int8_t*)((dk)->dk_indices))[DK_SIZE(dk) * DK_IXSIZE(dk)]))
 #define DK_ENTRIES(dk) \
-    ((PyDictKeyEntry*)(&((int8_t*)((dk)->dk_indices))[DK_SIZE(dk) * DK_IXSIZE(dk)]))
+    ((PyDictKeyEntry*)(&((int8_t*)((dk)->dk_indices))[DK_SIZE(dk) * (DK_IXSIZE(dk) + 1)]))
+
+/* One byte fingerprint of a hash, stored in dk_tags.  The low bits of the
+ * hash select the first slot, so the tag is taken from the high bits of a
+ * multiplicative mix; that keeps it useful for small ints, whose hashes
+ * have no high bits set. */
+#if SIZEOF_SIZE_T > 4
+#define DK_HASH_TAG(hash) \
+    ((uint8_t)(((size_t)(hash) * (size_t)0x9E3779B97F4A7C15ULL) >> 56))
+#else
+#define DK_HASH_TAG(hash) \
+    ((uint8_t)(((size_t)(hash) * (size_t)0x9E3779B9UL) >> 24))
+#endif
 
 #define DK_MASK(dk) (((dk)->dk_size)-1)
 #define IS_POWER_OF_2(x) (((x) & (x-1)) == 0)
@@ -399,6 +422,17 @@ dictkeys_set_index(PyDictKeysObject *keys, Py_ssize_t i, Py_ssize_t ix)
 }
 
 
+/* write an index >= 0 together with the tag of its hash. */
+static inline void
+dictkeys_set_entry_index(PyDictKeysObject *keys, Py_ssize_t i, Py_ssize_t ix,
+                         Py_hash_t hash)
+{
+    assert(ix >= 0);
+    dictkeys_set_index(keys, i, ix);
+    DK_TAGS(keys)[i] = DK_HASH_TAG(hash);
+}
+
+
 /* USABLE_FRACTION is the maximum dictionary load.
  * Increasing this ratio makes dictionaries more dense resulting in more
  * collisions.  Decreasing it improves sparseness at the expense of spreading
@@ -598,7 +632,7 @@ new_keys_object(Py_ssize_t size)
     else
     {
         dk = PyObject_Malloc(sizeof(PyDictKeysObject)
-                             + es * size
+                             + (es + 1) * size
                              + sizeof(PyDictKeyEntry) * usable);
         if (dk == NULL) {
             PyErr_NoMemory();
@@ -798,9 +832,12 @@ lookdict(PyDictObject *mp, PyObject *key,
     size_t i, mask, perturb;
     PyDictKeysObject *dk;
     PyDictKeyEntry *ep0;
+    const uint8_t *tags;
+    const uint8_t tag = DK_HASH_TAG(hash);
 
 top:
     dk = mp->ma_keys;
+    tags = DK_TAGS(dk);
     ep0 = DK_ENTRIES(dk);
     mask = DK_MASK(dk);
     perturb = hash;
@@ -812,7 +849,7 @@ lookdict(PyDictObject *mp, PyObject *key,
             *value_addr = NULL;
             return ix;
         }
-        if (ix >= 0) {
+        if (ix >= 0 && tags[i] == tag) {
             PyDictKeyEntry *ep = &ep0[ix];
             assert(ep->me_key != NULL);
             if (ep->me_key == key) {
@@ -861,6 +898,8 @@ lookdict_unicode(PyDictObject *mp, PyObject *key,
         return lookdict(mp, key, hash, value_addr);
     }
 
+    const uint8_t *tags = DK_TAGS(mp->ma_keys);
+    const uint8_t tag = DK_HASH_TAG(hash);
     PyDictKeyEntry *ep0 = DK_ENTRIES(mp->ma_keys);
     size_t mask = DK_MASK(mp->ma_keys);
     size_t perturb = (size_t)hash;
@@ -872,7 +911,7 @@ lookdict_unicode(PyDictObject *mp, PyObject *key,
             *value_addr = NULL;
             return DKIX_EMPTY;
         }
-        if (ix >= 0) {
+        if (ix >= 0 && tags[i] == tag) {
             PyDictKeyEntry *ep = &ep0[ix];
             assert(ep->me_key != NULL);
             assert(PyUnicode_CheckExact(ep->me_key));
@@ -904,6 +943,8 @@ lookdict_unicode_nodummy(PyDictObject *mp, PyObject *key,
         return lookdict(mp, key, hash, value_addr);
     }
 
+    const uint8_t *tags = DK_TAGS(mp->ma_keys);
+    const uint8_t tag = DK_HASH_TAG(hash);
     PyDictKeyEntry *ep0 = DK_ENTRIES(mp->ma_keys);
     size_t mask = DK_MASK(mp->ma_keys);
     size_t perturb = (size_t)hash;
@@ -916,13 +957,15 @@ lookdict_unicode_nodummy(PyDictObject *mp, PyObject *key,
             *value_addr = NULL;
             return DKIX_EMPTY;
         }
-        PyDictKeyEntry *ep = &ep0[ix];
-        assert(ep->me_key != NULL);
-        assert(PyUnicode_CheckExact(ep->me_key));
-        if (ep->me_key == key ||
-            (ep->me_hash == hash && unicode_eq(ep->me_key, key))) {
-            *value_addr = ep->me_value;
-            return ix;
+        if (tags[i] == tag) {
+            PyDictKeyEntry *ep = &ep0[ix];
+            assert(ep->me_key != NULL);
+            assert(PyUnicode_CheckExact(ep->me_key));
+            if (ep->me_key == key ||
+                (ep->me_hash == hash && unicode_eq(ep->me_key, key))) {
+                *value_addr = ep->me_value;
+                return ix;
+            }
         }
         perturb >>= PERTURB_SHIFT;
         i = mask & (i*5 + perturb + 1);
@@ -949,6 +992,8 @@ lookdict_split(PyDictObject *mp, PyObject *key,
         return ix;
     }
 
+    const uint8_t *tags = DK_TAGS(mp->ma_keys);
+    const uint8_t tag = DK_HASH_TAG(hash);
     PyDictKeyEntry *ep0 = DK_ENTRIES(mp->ma_keys);
     size_t mask = DK_MASK(mp->ma_keys);
     size_t perturb = (size_t)hash;
@@ -961,13 +1006,15 @@ lookdict_split(PyDictObject *mp, PyObject *key,
             *value_addr = NULL;
             return DKIX_EMPTY;
         }
-        PyDictKeyEntry *ep = &ep0[ix];
-        assert(ep->me_key != NULL);
-        assert(PyUnicode_CheckExact(ep->me_key));
-        if (ep->me_key == key ||
-            (ep->me_hash == hash && unicode_eq(ep->me_key, key))) {
-            *value_addr = mp->ma_values[ix];
-            return ix;
+        if (tags[i] == tag) {
+            PyDictKeyEntry *ep = &ep0[ix];
+            assert(ep->me_key != NULL);
+            assert(PyUnicode_CheckExact(ep->me_key));
+            if (ep->me_key == key ||
+                (ep->me_hash == hash && unicode_eq(ep->me_key, key))) {
+                *value_addr = mp->ma_values[ix];
+                return ix;
+            }
         }
         perturb >>= PERTURB_SHIFT;
         i = mask & (i*5 + perturb + 1);
@@ -1108,7 +1155,8 @@ insertdict(PyDictObject *mp, PyObject *key, Py_hash_t hash, PyObject *value)
         }
         Py_ssize_t hashpos = find_empty_slot(mp->ma_keys, hash);
         ep = &DK_ENTRIES(mp->ma_keys)[mp->ma_keys->dk_nentries];
-        dictkeys_set_index(mp->ma_keys, hashpos, mp->ma_keys->dk_nentries);
+        dictkeys_set_entry_index(mp->ma_keys, hashpos,
+                                 mp->ma_keys->dk_nentries, hash);
         ep->me_key = key;
         ep->me_hash = hash;
         if (mp->ma_values) {
@@ -1177,7 +1225,7 @@ insert_to_emptydict(PyDictObject *mp, PyObject *key, Py_hash_t hash,
 
     size_t hashpos = (size_t)hash & (PyDict_MINSIZE-1);
     PyDictKeyEntry *ep = DK_ENTRIES(mp->ma_keys);
-    dictkeys_set_index(mp->ma_keys, hashpos, 0);
+    dictkeys_set_entry_index(mp->ma_keys, hashpos, 0, hash);
     ep->me_key = key;
     ep->me_hash = hash;
     ep->me_value = value;
@@ -1202,7 +1250,7 @@ build_indices(PyDictKeysObject *keys, PyDictKeyEntry *ep, Py_ssize_t n)
             perturb >>= PERTURB_SHIFT;
             i = mask & (i*5 + perturb + 1);
         }
-        dictkeys_set_index(keys, i, ix);
+        dictkeys_set_entry_index(keys, i, ix, hash);
     }
 }
 
@@ -3071,7 +3119,8 @@ PyDict_SetDefault(PyObject *d, PyObject *key, PyObject *defaultobj)
         Py_ssize_t hashpos = find_empty_slot(mp->ma_keys, hash);
         ep0 = DK_ENTRIES(mp->ma_keys);
         ep = &ep0[mp->ma_keys->dk_nentries];
-        dictkeys_set_index(mp->ma_keys, hashpos, mp->ma_keys->dk_nentries);
+        dictkeys_set_entry_index(mp->ma_keys, hashpos,
+                                 mp->ma_keys->dk_nentries, hash);
         Py_INCREF(key);
         Py_INCREF(value);
         MAINTAIN_TRACKING(mp, key, value);
@@ -3280,7 +3329,7 @@ _PyDict_SizeOf(PyDictObject *mp)
        in the type object. */
     if (mp->ma_keys->dk_refcnt == 1)
         res += (sizeof(PyDictKeysObject)
-                + DK_IXSIZE(mp->ma_keys) * size
+                + (DK_IXSIZE(mp->ma_keys) + 1) * size
                 + sizeof(PyDictKeyEntry) * usable);
     return res;
 }
@@ -3289,7 +3338,7 @@ Py_ssize_t
 _PyDict_KeysSize(PyDictKeysObject *keys)
 {
     return (sizeof(PyDictKeysObject)
-            + DK_IXSIZE(keys) * DK_SIZE(keys)
+            + (DK_IXSIZE(keys) + 1) * DK_SIZE(keys)
             + USABLE_FRACTION(DK_SIZE(keys)) * sizeof(PyDictKeyEntry));
 }
 
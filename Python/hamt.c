@@ -239,6 +239,24 @@ There are three fundamental operations on an immutable dictionary:
         hamt_node_array_without, hamt_node_collision_without
 
 
+Transient Mutations
+===================
+
+Building a large mapping with a series of assoc() calls copies the
+path from the root to the modified leaf on every step, although all but
+the last version of the tree are immediately thrown away.
+
+To avoid that, "assoc" and "without" accept a mutation ID.  Every node
+created while the ID is in effect is tagged with it.  Such a node is
+reachable only from the tree of the mutation that created it, so when
+a later step of the same mutation needs to modify it, the node is
+updated in place instead of being copied.  Nodes with a different tag
+(including 0, used by all persistent operations) are always copied.
+
+Once a frozenmap is returned from a mutation, the mutation switches to
+a fresh ID: nodes shared with that frozenmap are never modified again.
+
+
 Further Reading
 ===============
 
@@ -253,8 +271,8 @@ Further Reading
 Debug
 =====
 
-The HAMT datatype is accessible for testing purposes under the
-`_testcapi` module:
+The HAMT datatype is exposed as `collections.frozenmap`, and is also
+accessible for testing purposes under the `_testcapi` module:
 
     >>> from _testcapi import hamt
     >>> h = hamt()
@@ -315,12 +333,14 @@ typedef struct {
     PyObject_HEAD
     PyHamtNode *a_array[HAMT_ARRAY_NODE_SIZE];
     Py_ssize_t a_count;
+    uint64_t a_mutid;
 } PyHamtNode_Array;
 
 
 typedef struct {
     PyObject_VAR_HEAD
     uint32_t b_bitmap;
+    uint64_t b_mutid;
     PyObject *b_array[1];
 } PyHamtNode_Bitmap;
 
@@ -328,10 +348,16 @@ typedef struct {
 typedef struct {
     PyObject_VAR_HEAD
     int32_t c_hash;
+    uint64_t c_mutid;
     PyObject *c_array[1];
 } PyHamtNode_Collision;
 
 
+/* A node can be modified in place by the mutation that created it. */
+#define HAMT_NODE_OWNED(mutid, node_mutid) \
+    ((mutid) != 0 && (mutid) == (node_mutid))
+
+
 static PyHamtNode_Bitmap *_empty_bitmap_node;
 static PyHamtObject *_empty_hamt;
 
@@ -342,13 +368,15 @@ hamt_alloc(void);
 static PyHamtNode *
 hamt_node_assoc(PyHamtNode *node,
                 uint32_t shift, int32_t hash,
-                PyObject *key, PyObject *val, int* added_leaf);
+                PyObject *key, PyObject *val, int* added_leaf,
+                uint64_t mutid);
 
 static hamt_without_t
 hamt_node_without(PyHamtNode *node,
                   uint32_t shift, int32_t hash,
                   PyObject *key,
-                  PyHamtNode **new_node);
+                  PyHamtNode **new_node,
+                  uint64_t mutid);
 
 static hamt_find_t
 hamt_node_find(PyHamtNode *node,
@@ -362,10 +390,10 @@ hamt_node_dump(PyHamtNode *node,
 #endif
 
 static PyHamtNode *
-hamt_node_array_new(Py_ssize_t);
+hamt_node_array_new(Py_ssize_t, uint64_t mutid);
 
 static PyHamtNode *
-hamt_node_collision_new(int32_t hash, Py_ssize_t size);
+hamt_node_collision_new(int32_t hash, Py_ssize_t size, uint64_t mutid);
 
 static inline Py_ssize_t
 hamt_node_collision_count(PyHamtNode_Collision *node);
@@ -394,20 +422,13 @@ _hamt_node_array_validate(void *obj_raw)
 #endif
 
 
-/* Returns -1 on error */
+/* Reduce a Python hash to the 32 bits used to index the tree. */
 static inline int32_t
-hamt_hash(PyObject *o)
+hamt_hash_reduce(Py_hash_t hash)
 {
-    Py_hash_t hash = PyObject_Hash(o);
-
 #if SIZEOF_PY_HASH_T <= 4
     return hash;
 #else
-    if (hash == -1) {
-        /* exception */
-        return -1;
-    }
-
     /* While it's suboptimal to reduce Python's 64 bit hash to
        32 bits via XOR, it seems that the resulting hash function
        is good enough (this is also how Long type is hashed in Java.)
@@ -422,6 +443,18 @@ hamt_hash(PyObject *o)
 #endif
 }
 
+/* Returns -1 on error */
+static inline int32_t
+hamt_hash(PyObject *o)
+{
+    Py_hash_t hash = PyObject_Hash(o);
+    if (hash == -1) {
+        /* exception */
+        return -1;
+    }
+    return hamt_hash_reduce(hash);
+}
+
 static inline uint32_t
 hamt_mask(int32_t hash, uint32_t shift)
 {
@@ -509,7 +542,7 @@ _hamt_dump_format(_PyUnicodeWriter *writer, const char *format, ...)
 
 
 static PyHamtNode *
-hamt_node_bitmap_new(Py_ssize_t size)
+hamt_node_bitmap_new(Py_ssize_t size, uint64_t mutid)
 {
     /* Create a new bitmap node of size 'size' */
 
@@ -538,6 +571,7 @@ hamt_node_bitmap_new(Py_ssize_t size)
     }
 
     node->b_bitmap = 0;
+    node->b_mutid = size ? mutid : 0;
 
     _PyObject_GC_TRACK(node);
 
@@ -559,14 +593,14 @@ hamt_node_bitmap_count(PyHamtNode_Bitmap *node)
 }
 
 static PyHamtNode_Bitmap *
-hamt_node_bitmap_clone(PyHamtNode_Bitmap *node)
+hamt_node_bitmap_clone(PyHamtNode_Bitmap *node, uint64_t mutid)
 {
     /* Clone a bitmap node; return a new one with the same child notes. */
 
     PyHamtNode_Bitmap *clone;
     Py_ssize_t i;
 
-    clone = (PyHamtNode_Bitmap *)hamt_node_bitmap_new(Py_SIZE(node));
+    clone = (PyHamtNode_Bitmap *)hamt_node_bitmap_new(Py_SIZE(node), mutid);
     if (clone == NULL) {
         return NULL;
     }
@@ -581,22 +615,39 @@ hamt_node_bitmap_clone(PyHamtNode_Bitmap *node)
 }
 
 static PyHamtNode_Bitmap *
-hamt_node_bitmap_clone_without(PyHamtNode_Bitmap *o, uint32_t bit)
+hamt_node_bitmap_clone_without(PyHamtNode_Bitmap *o, uint32_t bit,
+                               uint64_t mutid)
 {
     assert(bit & o->b_bitmap);
     assert(hamt_node_bitmap_count(o) > 1);
 
-    PyHamtNode_Bitmap *new = (PyHamtNode_Bitmap *)hamt_node_bitmap_new(
-        Py_SIZE(o) - 2);
-    if (new == NULL) {
-        return NULL;
-    }
-
     uint32_t idx = hamt_bitindex(o->b_bitmap, bit);
     uint32_t key_idx = 2 * idx;
     uint32_t val_idx = key_idx + 1;
     uint32_t i;
 
+    if (HAMT_NODE_OWNED(mutid, o->b_mutid)) {
+        /* Shrink the node in place; the unused tail of the allocation
+           is simply left alone. */
+        PyObject *key = o->b_array[key_idx];
+        PyObject *val = o->b_array[val_idx];
+        for (i = val_idx + 1; i < (uint32_t)Py_SIZE(o); i++) {
+            o->b_array[i - 2] = o->b_array[i];
+        }
+        Py_SET_SIZE(o, Py_SIZE(o) - 2);
+        o->b_bitmap &= ~bit;
+        Py_XDECREF(key);
+        Py_DECREF(val);
+        Py_INCREF(o);
+        return o;
+    }
+
+    PyHamtNode_Bitmap *new = (PyHamtNode_Bitmap *)hamt_node_bitmap_new(
+        Py_SIZE(o) - 2, mutid);
+    if (new == NULL) {
+        return NULL;
+    }
+
     for (i = 0; i < key_idx; i++) {
         Py_XINCREF(o->b_array[i]);
         new->b_array[i] = o->b_array[i];
@@ -616,7 +667,8 @@ static PyHamtNode *
 hamt_node_new_bitmap_or_collision(uint32_t shift,
                                   PyObject *key1, PyObject *val1,
                                   int32_t key2_hash,
-                                  PyObject *key2, PyObject *val2)
+                                  PyObject *key2, PyObject *val2,
+                                  uint64_t mutid)
 {
     /* Helper method.  Creates a new node for key1/val and key2/val2
        pairs.
@@ -633,7 +685,8 @@ hamt_node_new_bitmap_or_collision(uint32_t shift,
 
     if (key1_hash == key2_hash) {
         PyHamtNode_Collision *n;
-        n = (PyHamtNode_Collision *)hamt_node_collision_new(key1_hash, 4);
+        n = (PyHamtNode_Collision *)hamt_node_collision_new(
+            key1_hash, 4, mutid);
         if (n == NULL) {
             return NULL;
         }
@@ -652,19 +705,20 @@ hamt_node_new_bitmap_or_collision(uint32_t shift,
     }
     else {
         int added_leaf = 0;
-        PyHamtNode *n = hamt_node_bitmap_new(0);
+        PyHamtNode *n = hamt_node_bitmap_new(0, mutid);
         if (n == NULL) {
             return NULL;
         }
 
         PyHamtNode *n2 = hamt_node_assoc(
-            n, shift, key1_hash, key1, val1, &added_leaf);
+            n, shift, key1_hash, key1, val1, &added_leaf, mutid);
         Py_DECREF(n);
         if (n2 == NULL) {
             return NULL;
         }
 
-        n = hamt_node_assoc(n2, shift, key2_hash, key2, val2, &added_leaf);
+        n = hamt_node_assoc(n2, shift, key2_hash, key2, val2, &added_leaf,
+                            mutid);
         Py_DECREF(n2);
         if (n == NULL) {
             return NULL;
@@ -677,7 +731,8 @@ hamt_node_new_bitmap_or_collision(uint32_t shift,
 static PyHamtNode *
 hamt_node_bitmap_assoc(PyHamtNode_Bitmap *self,
                        uint32_t shift, int32_t hash,
-                       PyObject *key, PyObject *val, int* added_leaf)
+                       PyObject *key, PyObject *val, int* added_leaf,
+                       uint64_t mutid)
 {
     /* assoc operation for bitmap nodes.
 
@@ -724,7 +779,7 @@ hamt_node_bitmap_assoc(PyHamtNode_Bitmap *self,
 
             PyHamtNode *sub_node = hamt_node_assoc(
                 (PyHamtNode *)val_or_node,
-                shift + 5, hash, key, val, added_leaf);
+                shift + 5, hash, key, val, added_leaf, mutid);
             if (sub_node == NULL) {
                 return NULL;
             }
@@ -735,7 +790,13 @@ hamt_node_bitmap_assoc(PyHamtNode_Bitmap *self,
                 return (PyHamtNode *)self;
             }
 
-            PyHamtNode_Bitmap *ret = hamt_node_bitmap_clone(self);
+            if (HAMT_NODE_OWNED(mutid, self->b_mutid)) {
+                Py_SETREF(self->b_array[val_idx], (PyObject*)sub_node);
+                Py_INCREF(self);
+                return (PyHamtNode *)self;
+            }
+
+            PyHamtNode_Bitmap *ret = hamt_node_bitmap_clone(self, mutid);
             if (ret == NULL) {
                 return NULL;
             }
@@ -760,7 +821,14 @@ hamt_node_bitmap_assoc(PyHamtNode_Bitmap *self,
 
             /* We're setting a new value for the key we had before.
                Make a new bitmap node with a replaced value, and return it. */
-            PyHamtNode_Bitmap *ret = hamt_node_bitmap_clone(self);
+            if (HAMT_NODE_OWNED(mutid, self->b_mutid)) {
+                Py_INCREF(val);
+                Py_SETREF(self->b_array[val_idx], val);
+                Py_INCREF(self);
+                return (PyHamtNode *)self;
+            }
+
+            PyHamtNode_Bitmap *ret = hamt_node_bitmap_clone(self, mutid);
             if (ret == NULL) {
                 return NULL;
             }
@@ -781,21 +849,28 @@ hamt_node_bitmap_assoc(PyHamtNode_Bitmap *self,
             shift + 5,
             key_or_null, val_or_node,  /* existing key/val */
             hash,
-            key, val  /* new key/val */
+            key, val,  /* new key/val */
+            mutid
         );
         if (sub_node == NULL) {
             return NULL;
         }
 
-        PyHamtNode_Bitmap *ret = hamt_node_bitmap_clone(self);
+        *added_leaf = 1;
+        if (HAMT_NODE_OWNED(mutid, self->b_mutid)) {
+            Py_SETREF(self->b_array[key_idx], NULL);
+            Py_SETREF(self->b_array[val_idx], (PyObject *)sub_node);
+            Py_INCREF(self);
+            return (PyHamtNode *)self;
+        }
+
+        PyHamtNode_Bitmap *ret = hamt_node_bitmap_clone(self, mutid);
         if (ret == NULL) {
             Py_DECREF(sub_node);
             return NULL;
         }
         Py_SETREF(ret->b_array[key_idx], NULL);
         Py_SETREF(ret->b_array[val_idx], (PyObject *)sub_node);
-
-        *added_leaf = 1;
         return (PyHamtNode *)ret;
     }
     else {
@@ -828,14 +903,14 @@ hamt_node_bitmap_assoc(PyHamtNode_Bitmap *self,
             PyHamtNode *res = NULL;
 
             /* Create a new Array node. */
-            new_node = (PyHamtNode_Array *)hamt_node_array_new(n + 1);
+            new_node = (PyHamtNode_Array *)hamt_node_array_new(n + 1, mutid);
             if (new_node == NULL) {
                 goto fin;
             }
 
             /* Create an empty bitmap node for the next
                hamt_node_assoc call. */
-            empty = hamt_node_bitmap_new(0);
+            empty = hamt_node_bitmap_new(0, mutid);
             if (empty == NULL) {
                 goto fin;
             }
@@ -843,7 +918,7 @@ hamt_node_bitmap_assoc(PyHamtNode_Bitmap *self,
             /* Make a new bitmap node for the key/val we're adding.
                Set that bitmap node to new-array-node[jdx]. */
             new_node->a_array[jdx] = hamt_node_assoc(
-                empty, shift + 5, hash, key, val, added_leaf);
+                empty, shift + 5, hash, key, val, added_leaf, mutid);
             if (new_node->a_array[jdx] == NULL) {
                 goto fin;
             }
@@ -874,7 +949,7 @@ hamt_node_bitmap_assoc(PyHamtNode_Bitmap *self,
                             rehash,
                             self->b_array[j],
                             self->b_array[j + 1],
-                            added_leaf);
+                            added_leaf, mutid);
 
                         if (new_node->a_array[i] == NULL) {
                             goto fin;
@@ -910,7 +985,7 @@ hamt_node_bitmap_assoc(PyHamtNode_Bitmap *self,
             /* Allocate new Bitmap node which can have one more key/val
                pair in addition to what we have already. */
             PyHamtNode_Bitmap *new_node =
-                (PyHamtNode_Bitmap *)hamt_node_bitmap_new(2 * (n + 1));
+                (PyHamtNode_Bitmap *)hamt_node_bitmap_new(2 * (n + 1), mutid);
             if (new_node == NULL) {
                 return NULL;
             }
@@ -946,7 +1021,8 @@ static hamt_without_t
 hamt_node_bitmap_without(PyHamtNode_Bitmap *self,
                          uint32_t shift, int32_t hash,
                          PyObject *key,
-                         PyHamtNode **new_node)
+                         PyHamtNode **new_node,
+                         uint64_t mutid)
 {
     uint32_t bit = hamt_bitpos(hash, shift);
     if ((self->b_bitmap & bit) == 0) {
@@ -968,7 +1044,7 @@ hamt_node_bitmap_without(PyHamtNode_Bitmap *self,
 
         hamt_without_t res = hamt_node_without(
             (PyHamtNode *)val_or_node,
-            shift + 5, hash, key, &sub_node);
+            shift + 5, hash, key, &sub_node, mutid);
 
         switch (res) {
             case W_EMPTY:
@@ -1005,7 +1081,14 @@ hamt_node_bitmap_without(PyHamtNode_Bitmap *self,
                            up or down.
                         */
 
-                        PyHamtNode_Bitmap *clone = hamt_node_bitmap_clone(self);
+                        PyHamtNode_Bitmap *clone;
+                        if (HAMT_NODE_OWNED(mutid, self->b_mutid)) {
+                            Py_INCREF(self);
+                            clone = self;
+                        }
+                        else {
+                            clone = hamt_node_bitmap_clone(self, mutid);
+                        }
                         if (clone == NULL) {
                             Py_DECREF(sub_node);
                             return W_ERROR;
@@ -1036,8 +1119,16 @@ hamt_node_bitmap_without(PyHamtNode_Bitmap *self,
                 }
 #endif
 
-                PyHamtNode_Bitmap *clone = hamt_node_bitmap_clone(self);
+                PyHamtNode_Bitmap *clone;
+                if (HAMT_NODE_OWNED(mutid, self->b_mutid)) {
+                    Py_INCREF(self);
+                    clone = self;
+                }
+                else {
+                    clone = hamt_node_bitmap_clone(self, mutid);
+                }
                 if (clone == NULL) {
+                    Py_DECREF(sub_node);
                     return W_ERROR;
                 }
 
@@ -1073,7 +1164,7 @@ hamt_node_bitmap_without(PyHamtNode_Bitmap *self,
         }
 
         *new_node = (PyHamtNode *)
-            hamt_node_bitmap_clone_without(self, bit);
+            hamt_node_bitmap_clone_without(self, bit, mutid);
         if (*new_node == NULL) {
             return W_ERROR;
         }
@@ -1248,7 +1339,7 @@ hamt_node_bitmap_dump(PyHamtNode_Bitmap *node,
 
 
 static PyHamtNode *
-hamt_node_collision_new(int32_t hash, Py_ssize_t size)
+hamt_node_collision_new(int32_t hash, Py_ssize_t size, uint64_t mutid)
 {
     /* Create a new Collision node. */
 
@@ -1270,6 +1361,7 @@ hamt_node_collision_new(int32_t hash, Py_ssize_t size)
 
     Py_SET_SIZE(node, size);
     node->c_hash = hash;
+    node->c_mutid = mutid;
 
     _PyObject_GC_TRACK(node);
 
@@ -1306,7 +1398,8 @@ hamt_node_collision_find_index(PyHamtNode_Collision *self, PyObject *key,
 static PyHamtNode *
 hamt_node_collision_assoc(PyHamtNode_Collision *self,
                           uint32_t shift, int32_t hash,
-                          PyObject *key, PyObject *val, int* added_leaf)
+                          PyObject *key, PyObject *val, int* added_leaf,
+                          uint64_t mutid)
 {
     /* Set a new key to this level (currently a Collision node)
        of the tree. */
@@ -1332,7 +1425,7 @@ hamt_node_collision_assoc(PyHamtNode_Collision *self,
                    add a new key/value to the cloned node. */
 
                 new_node = (PyHamtNode_Collision *)hamt_node_collision_new(
-                    self->c_hash, Py_SIZE(self) + 2);
+                    self->c_hash, Py_SIZE(self) + 2, mutid);
                 if (new_node == NULL) {
                     return NULL;
                 }
@@ -1363,10 +1456,17 @@ hamt_node_collision_assoc(PyHamtNode_Collision *self,
                     return (PyHamtNode *)self;
                 }
 
+                if (HAMT_NODE_OWNED(mutid, self->c_mutid)) {
+                    Py_INCREF(val);
+                    Py_SETREF(self->c_array[val_idx], val);
+                    Py_INCREF(self);
+                    return (PyHamtNode *)self;
+                }
+
                 /* We need to replace old value for the key
                    with a new value.  Create a new Collision node.*/
                 new_node = (PyHamtNode_Collision *)hamt_node_collision_new(
-                    self->c_hash, Py_SIZE(self));
+                    self->c_hash, Py_SIZE(self), mutid);
                 if (new_node == NULL) {
                     return NULL;
                 }
@@ -1400,7 +1500,7 @@ hamt_node_collision_assoc(PyHamtNode_Collision *self,
         PyHamtNode_Bitmap *new_node;
         PyHamtNode *assoc_res;
 
-        new_node = (PyHamtNode_Bitmap *)hamt_node_bitmap_new(2);
+        new_node = (PyHamtNode_Bitmap *)hamt_node_bitmap_new(2, mutid);
         if (new_node == NULL) {
             return NULL;
         }
@@ -1409,7 +1509,7 @@ hamt_node_collision_assoc(PyHamtNode_Collision *self,
         new_node->b_array[1] = (PyObject*) self;
 
         assoc_res = hamt_node_bitmap_assoc(
-            new_node, shift, hash, key, val, added_leaf);
+            new_node, shift, hash, key, val, added_leaf, mutid);
         Py_DECREF(new_node);
         return assoc_res;
     }
@@ -1425,7 +1525,8 @@ static hamt_without_t
 hamt_node_collision_without(PyHamtNode_Collision *self,
                             uint32_t shift, int32_t hash,
                             PyObject *key,
-                            PyHamtNode **new_node)
+                            PyHamtNode **new_node,
+                            uint64_t mutid)
 {
     if (hash != self->c_hash) {
         return W_NOT_FOUND;
@@ -1462,7 +1563,7 @@ hamt_node_collision_without(PyHamtNode_Collision *self,
                    Bitmap node.
                 */
                 PyHamtNode_Bitmap *node = (PyHamtNode_Bitmap *)
-                    hamt_node_bitmap_new(2);
+                    hamt_node_bitmap_new(2, mutid);
                 if (node == NULL) {
                     return W_ERROR;
                 }
@@ -1487,17 +1588,33 @@ hamt_node_collision_without(PyHamtNode_Collision *self,
                 return W_NEWNODE;
             }
 
+            Py_ssize_t i;
+
+            if (HAMT_NODE_OWNED(mutid, self->c_mutid)) {
+                /* Shrink the node in place. */
+                PyObject *old_key = self->c_array[key_idx];
+                PyObject *old_val = self->c_array[key_idx + 1];
+                for (i = key_idx + 2; i < Py_SIZE(self); i++) {
+                    self->c_array[i - 2] = self->c_array[i];
+                }
+                Py_SET_SIZE(self, Py_SIZE(self) - 2);
+                Py_DECREF(old_key);
+                Py_DECREF(old_val);
+                Py_INCREF(self);
+                *new_node = (PyHamtNode*)self;
+                return W_NEWNODE;
+            }
+
             /* Allocate a new Collision node with capacity for one
                less key/value pair */
             PyHamtNode_Collision *new = (PyHamtNode_Collision *)
                 hamt_node_collision_new(
-                    self->c_hash, Py_SIZE(self) - 2);
+                    self->c_hash, Py_SIZE(self) - 2, mutid);
             if (new == NULL) {
                 return W_ERROR;
             }
 
             /* Copy all other keys from `self` to `new` */
-            Py_ssize_t i;
             for (i = 0; i < key_idx; i++) {
                 Py_INCREF(self->c_array[i]);
                 new->c_array[i] = self->c_array[i];
@@ -1620,7 +1737,7 @@ hamt_node_collision_dump(PyHamtNode_Collision *node,
 
 
 static PyHamtNode *
-hamt_node_array_new(Py_ssize_t count)
+hamt_node_array_new(Py_ssize_t count, uint64_t mutid)
 {
     Py_ssize_t i;
 
@@ -1635,13 +1752,14 @@ hamt_node_array_new(Py_ssize_t count)
     }
 
     node->a_count = count;
+    node->a_mutid = mutid;
 
     _PyObject_GC_TRACK(node);
     return (PyHamtNode *)node;
 }
 
 static PyHamtNode_Array *
-hamt_node_array_clone(PyHamtNode_Array *node)
+hamt_node_array_clone(PyHamtNode_Array *node, uint64_t mutid)
 {
     PyHamtNode_Array *clone;
     Py_ssize_t i;
@@ -1649,7 +1767,7 @@ hamt_node_array_clone(PyHamtNode_Array *node)
     VALIDATE_ARRAY_NODE(node)
 
     /* Create a new Array node. */
-    clone = (PyHamtNode_Array *)hamt_node_array_new(node->a_count);
+    clone = (PyHamtNode_Array *)hamt_node_array_new(node->a_count, mutid);
     if (clone == NULL) {
         return NULL;
     }
@@ -1667,7 +1785,8 @@ hamt_node_array_clone(PyHamtNode_Array *node)
 static PyHamtNode *
 hamt_node_array_assoc(PyHamtNode_Array *self,
                       uint32_t shift, int32_t hash,
-                      PyObject *key, PyObject *val, int* added_leaf)
+                      PyObject *key, PyObject *val, int* added_leaf,
+                      uint64_t mutid)
 {
     /* Set a new key to this level (currently a Collision node)
        of the tree.
@@ -1689,7 +1808,7 @@ hamt_node_array_assoc(PyHamtNode_Array *self,
         PyHamtNode_Bitmap *empty = NULL;
 
         /* Get an empty Bitmap node to work with. */
-        empty = (PyHamtNode_Bitmap *)hamt_node_bitmap_new(0);
+        empty = (PyHamtNode_Bitmap *)hamt_node_bitmap_new(0, mutid);
         if (empty == NULL) {
             return NULL;
         }
@@ -1698,14 +1817,24 @@ hamt_node_array_assoc(PyHamtNode_Array *self,
            creating a new Bitmap node with our key/value pair. */
         child_node = hamt_node_bitmap_assoc(
             empty,
-            shift + 5, hash, key, val, added_leaf);
+            shift + 5, hash, key, val, added_leaf, mutid);
         Py_DECREF(empty);
         if (child_node == NULL) {
             return NULL;
         }
 
+        if (HAMT_NODE_OWNED(mutid, self->a_mutid)) {
+            assert(self->a_array[idx] == NULL);
+            self->a_array[idx] = child_node;  /* borrow */
+            self->a_count++;
+            VALIDATE_ARRAY_NODE(self)
+            Py_INCREF(self);
+            return (PyHamtNode *)self;
+        }
+
         /* Create a new Array node. */
-        new_node = (PyHamtNode_Array *)hamt_node_array_new(self->a_count + 1);
+        new_node = (PyHamtNode_Array *)hamt_node_array_new(
+            self->a_count + 1, mutid);
         if (new_node == NULL) {
             Py_DECREF(child_node);
             return NULL;
@@ -1726,16 +1855,23 @@ hamt_node_array_assoc(PyHamtNode_Array *self,
         /* There's a child node for the given hash.
            Set the key to it./ */
         child_node = hamt_node_assoc(
-            node, shift + 5, hash, key, val, added_leaf);
+            node, shift + 5, hash, key, val, added_leaf, mutid);
         if (child_node == NULL) {
             return NULL;
         }
-        else if (child_node == (PyHamtNode *)self) {
+        else if (child_node == node) {
             Py_DECREF(child_node);
+            Py_INCREF(self);
+            return (PyHamtNode *)self;
+        }
+
+        if (HAMT_NODE_OWNED(mutid, self->a_mutid)) {
+            Py_SETREF(self->a_array[idx], child_node);  /* borrow */
+            Py_INCREF(self);
             return (PyHamtNode *)self;
         }
 
-        new_node = hamt_node_array_clone(self);
+        new_node = hamt_node_array_clone(self, mutid);
         if (new_node == NULL) {
             Py_DECREF(child_node);
             return NULL;
@@ -1752,7 +1888,8 @@ static hamt_without_t
 hamt_node_array_without(PyHamtNode_Array *self,
                         uint32_t shift, int32_t hash,
                         PyObject *key,
-                        PyHamtNode **new_node)
+                        PyHamtNode **new_node,
+                        uint64_t mutid)
 {
     uint32_t idx = hamt_mask(hash, shift);
     PyHamtNode *node = self->a_array[idx];
@@ -1764,7 +1901,7 @@ hamt_node_array_without(PyHamtNode_Array *self,
     PyHamtNode *sub_node = NULL;
     hamt_without_t res = hamt_node_without(
         (PyHamtNode *)node,
-        shift + 5, hash, key, &sub_node);
+        shift + 5, hash, key, &sub_node, mutid);
 
     switch (res) {
         case W_NOT_FOUND:
@@ -1778,7 +1915,14 @@ hamt_node_array_without(PyHamtNode_Array *self,
             */
             assert(sub_node != NULL);
 
-            PyHamtNode_Array *clone = hamt_node_array_clone(self);
+            PyHamtNode_Array *clone;
+            if (HAMT_NODE_OWNED(mutid, self->a_mutid)) {
+                Py_INCREF(self);
+                clone = self;
+            }
+            else {
+                clone = hamt_node_array_clone(self, mutid);
+            }
             if (clone == NULL) {
                 Py_DECREF(sub_node);
                 return W_ERROR;
@@ -1808,7 +1952,14 @@ hamt_node_array_without(PyHamtNode_Array *self,
                    greater than 15.
                 */
 
-                PyHamtNode_Array *new = hamt_node_array_clone(self);
+                PyHamtNode_Array *new;
+                if (HAMT_NODE_OWNED(mutid, self->a_mutid)) {
+                    Py_INCREF(self);
+                    new = self;
+                }
+                else {
+                    new = hamt_node_array_clone(self, mutid);
+                }
                 if (new == NULL) {
                     return W_ERROR;
                 }
@@ -1826,7 +1977,7 @@ hamt_node_array_without(PyHamtNode_Array *self,
             uint32_t bitmap = 0;
 
             PyHamtNode_Bitmap *new = (PyHamtNode_Bitmap *)
-                hamt_node_bitmap_new(bitmap_size);
+                hamt_node_bitmap_new(bitmap_size, mutid);
             if (new == NULL) {
                 return W_ERROR;
             }
@@ -2011,7 +2162,8 @@ hamt_node_array_dump(PyHamtNode_Array *node,
 static PyHamtNode *
 hamt_node_assoc(PyHamtNode *node,
                 uint32_t shift, int32_t hash,
-                PyObject *key, PyObject *val, int* added_leaf)
+                PyObject *key, PyObject *val, int* added_leaf,
+                uint64_t mutid)
 {
     /* Set key/value to the 'node' starting with the given shift/hash.
        Return a new node, or the same node if key/value already
@@ -2027,18 +2179,18 @@ hamt_node_assoc(PyHamtNode *node,
     if (IS_BITMAP_NODE(node)) {
         return hamt_node_bitmap_assoc(
             (PyHamtNode_Bitmap *)node,
-            shift, hash, key, val, added_leaf);
+            shift, hash, key, val, added_leaf, mutid);
     }
     else if (IS_ARRAY_NODE(node)) {
         return hamt_node_array_assoc(
             (PyHamtNode_Array *)node,
-            shift, hash, key, val, added_leaf);
+            shift, hash, key, val, added_leaf, mutid);
     }
     else {
         assert(IS_COLLISION_NODE(node));
         return hamt_node_collision_assoc(
             (PyHamtNode_Collision *)node,
-            shift, hash, key, val, added_leaf);
+            shift, hash, key, val, added_leaf, mutid);
     }
 }
 
@@ -2046,26 +2198,27 @@ static hamt_without_t
 hamt_node_without(PyHamtNode *node,
                   uint32_t shift, int32_t hash,
                   PyObject *key,
-                  PyHamtNode **new_node)
+                  PyHamtNode **new_node,
+                  uint64_t mutid)
 {
     if (IS_BITMAP_NODE(node)) {
         return hamt_node_bitmap_without(
             (PyHamtNode_Bitmap *)node,
             shift, hash, key,
-            new_node);
+            new_node, mutid);
     }
     else if (IS_ARRAY_NODE(node)) {
         return hamt_node_array_without(
             (PyHamtNode_Array *)node,
             shift, hash, key,
-            new_node);
+            new_node, mutid);
     }
     else {
         assert(IS_COLLISION_NODE(node));
         return hamt_node_collision_without(
             (PyHamtNode_Collision *)node,
             shift, hash, key,
-            new_node);
+            new_node, mutid);
     }
 }
 
@@ -2299,7 +2452,7 @@ _PyHamt_Assoc(PyHamtObject *o, PyObject *key, PyObject *val)
 
     new_root = hamt_node_assoc(
         (PyHamtNode *)(o->h_root),
-        0, key_hash, key, val, &added_leaf);
+        0, key_hash, key, val, &added_leaf, 0);
     if (new_root == NULL) {
         return NULL;
     }
@@ -2335,7 +2488,7 @@ _PyHamt_Without(PyHamtObject *o, PyObject *key)
     hamt_without_t res = hamt_node_without(
         (PyHamtNode *)(o->h_root),
         0, key_hash, key,
-        &new_root);
+        &new_root, 0);
 
     switch (res) {
         case W_ERROR:
@@ -2461,6 +2614,7 @@ hamt_alloc(void)
     o->h_count = 0;
     o->h_root = NULL;
     o->h_weakreflist = NULL;
+    o->h_hash = -1;
     PyObject_GC_Track(o);
     return o;
 }
@@ -2480,7 +2634,7 @@ _PyHamt_New(void)
         return NULL;
     }
 
-    o->h_root = hamt_node_bitmap_new(0);
+    o->h_root = hamt_node_bitmap_new(0, 0);
     if (o->h_root == NULL) {
         Py_DECREF(o);
         return NULL;
@@ -2679,6 +2833,336 @@ _PyHamt_NewIterValues(PyHamtObject *o)
 }
 
 
+/////////////////////////////////// Mutations
+
+
+/* A mutable view of a tree under construction.
+
+   m_mutid tags every node the mutation creates (see "Transient
+   Mutations" above); it is 0 once the mutation has been closed.
+   m_busy guards against the mutation being modified re-entrantly,
+   from the __hash__() or __eq__() of a key, while a node is being
+   updated in place.
+*/
+typedef struct {
+    PyObject_HEAD
+    PyHamtNode *m_root;
+    Py_ssize_t m_count;
+    uint64_t m_mutid;
+    int m_busy;
+} PyHamtMutationObject;
+
+static uint64_t hamt_mutid_counter;
+
+static inline uint64_t
+hamt_new_mutid(void)
+{
+    return ++hamt_mutid_counter;
+}
+
+static PyHamtMutationObject *
+hamt_mutation_new(PyHamtObject *o)
+{
+    PyHamtMutationObject *m = PyObject_GC_New(
+        PyHamtMutationObject, &_PyHamtMutation_Type);
+    if (m == NULL) {
+        return NULL;
+    }
+    Py_INCREF(o->h_root);
+    m->m_root = o->h_root;
+    m->m_count = o->h_count;
+    m->m_mutid = hamt_new_mutid();
+    m->m_busy = 0;
+    PyObject_GC_Track(m);
+    return m;
+}
+
+static int
+hamt_mutation_assoc(PyHamtMutationObject *m,
+                    PyObject *key, int32_t key_hash, PyObject *val)
+{
+    int added_leaf = 0;
+    PyHamtNode *new_root;
+
+    assert(m->m_mutid != 0);
+    m->m_busy++;
+    new_root = hamt_node_assoc(
+        m->m_root, 0, key_hash, key, val, &added_leaf, m->m_mutid);
+    m->m_busy--;
+    if (new_root == NULL) {
+        return -1;
+    }
+    Py_SETREF(m->m_root, new_root);
+    if (added_leaf) {
+        m->m_count++;
+    }
+    return 0;
+}
+
+/* Return 1 if the key was deleted, 0 if it was not found,
+   -1 on error. */
+static int
+hamt_mutation_without(PyHamtMutationObject *m, PyObject *key)
+{
+    PyHamtNode *new_root = NULL;
+    hamt_without_t res;
+
+    int32_t key_hash = hamt_hash(key);
+    if (key_hash == -1) {
+        return -1;
+    }
+
+    assert(m->m_mutid != 0);
+    m->m_busy++;
+    res = hamt_node_without(
+        m->m_root, 0, key_hash, key, &new_root, m->m_mutid);
+    m->m_busy--;
+
+    switch (res) {
+        case W_ERROR:
+            return -1;
+        case W_NOT_FOUND:
+            return 0;
+        case W_EMPTY:
+            new_root = hamt_node_bitmap_new(0, 0);
+            if (new_root == NULL) {
+                return -1;
+            }
+            Py_SETREF(m->m_root, new_root);
+            m->m_count = 0;
+            return 1;
+        case W_NEWNODE:
+            assert(new_root != NULL);
+            Py_SETREF(m->m_root, new_root);
+            m->m_count--;
+            assert(m->m_count >= 0);
+            return 1;
+        default:
+            Py_UNREACHABLE();
+    }
+}
+
+static hamt_find_t
+hamt_mutation_find(PyHamtMutationObject *m, PyObject *key, PyObject **val)
+{
+    if (m->m_count == 0) {
+        return F_NOT_FOUND;
+    }
+
+    int32_t key_hash = hamt_hash(key);
+    if (key_hash == -1) {
+        return F_ERROR;
+    }
+
+    return hamt_node_find(m->m_root, 0, key_hash, key, val);
+}
+
+static int
+hamt_mutation_update_pairs(PyHamtMutationObject *m, PyObject *seq)
+{
+    PyObject *it, *item, *fast;
+    Py_ssize_t i;
+
+    it = PyObject_GetIter(seq);
+    if (it == NULL) {
+        return -1;
+    }
+
+    for (i = 0; ; i++) {
+        item = PyIter_Next(it);
+        if (item == NULL) {
+            break;
+        }
+        fast = PySequence_Fast(item, "");
+        Py_DECREF(item);
+        if (fast == NULL) {
+            if (PyErr_ExceptionMatches(PyExc_TypeError)) {
+                PyErr_Format(PyExc_TypeError,
+                    "cannot convert frozenmap update "
+                    "sequence element #%zd to a sequence", i);
+            }
+            goto error;
+        }
+        if (PySequence_Fast_GET_SIZE(fast) != 2) {
+            PyErr_Format(PyExc_ValueError,
+                         "frozenmap update sequence element #%zd "
+                         "has length %zd; 2 is required",
+                         i, PySequence_Fast_GET_SIZE(fast));
+            Py_DECREF(fast);
+            goto error;
+        }
+
+        PyObject *key = PySequence_Fast_GET_ITEM(fast, 0);
+        PyObject *val = PySequence_Fast_GET_ITEM(fast, 1);
+        int32_t key_hash = hamt_hash(key);
+        if (key_hash == -1 ||
+            hamt_mutation_assoc(m, key, key_hash, val) < 0)
+        {
+            Py_DECREF(fast);
+            goto error;
+        }
+        Py_DECREF(fast);
+    }
+
+    Py_DECREF(it);
+    return PyErr_Occurred() ? -1 : 0;
+
+error:
+    Py_DECREF(it);
+    return -1;
+}
+
+static int
+hamt_mutation_update(PyHamtMutationObject *m, PyObject *src)
+{
+    if (PyHamt_Check(src)) {
+        PyHamtObject *o = (PyHamtObject *)src;
+        if (m->m_count == 0) {
+            /* Share the whole tree; its nodes are never ours. */
+            Py_INCREF(o->h_root);
+            Py_SETREF(m->m_root, o->h_root);
+            m->m_count = o->h_count;
+            return 0;
+        }
+
+        PyHamtIteratorState iter;
+        PyObject *key, *val;
+        int res = 0;
+
+        Py_INCREF(o);
+        hamt_iterator_init(&iter, o->h_root);
+        while (hamt_iterator_next(&iter, &key, &val) == I_ITEM) {
+            int32_t key_hash = hamt_hash(key);
+            if (key_hash == -1 ||
+                hamt_mutation_assoc(m, key, key_hash, val) < 0)
+            {
+                res = -1;
+                break;
+            }
+        }
+        Py_DECREF(o);
+        return res;
+    }
+
+    if (PyDict_CheckExact(src)) {
+        /* Reuse the hashes cached in the dict. */
+        Py_ssize_t pos = 0, size = PyDict_GET_SIZE(src);
+        PyObject *key, *val;
+        Py_hash_t hash;
+
+        while (_PyDict_Next(src, &pos, &key, &val, &hash)) {
+            Py_INCREF(key);
+            Py_INCREF(val);
+            int res = hamt_mutation_assoc(
+                m, key, hamt_hash_reduce(hash), val);
+            Py_DECREF(key);
+            Py_DECREF(val);
+            if (res < 0) {
+                return -1;
+            }
+            if (size != PyDict_GET_SIZE(src)) {
+                PyErr_SetString(PyExc_RuntimeError,
+                                "dict changed size during iteration");
+                return -1;
+            }
+        }
+        return 0;
+    }
+
+    _Py_IDENTIFIER(keys);
+    PyObject *func;
+    if (_PyObject_LookupAttrId(src, &PyId_keys, &func) < 0) {
+        return -1;
+    }
+    if (func == NULL) {
+        return hamt_mutation_update_pairs(m, src);
+    }
+    Py_DECREF(func);
+
+    PyObject *keys = PyMapping_Keys(src);
+    if (keys == NULL) {
+        return -1;
+    }
+    PyObject *it = PyObject_GetIter(keys);
+    Py_DECREF(keys);
+    if (it == NULL) {
+        return -1;
+    }
+
+    PyObject *key;
+    while ((key = PyIter_Next(it)) != NULL) {
+        PyObject *val = PyObject_GetItem(src, key);
+        int32_t key_hash = val == NULL ? -1 : hamt_hash(key);
+        if (key_hash == -1 ||
+            hamt_mutation_assoc(m, key, key_hash, val) < 0)
+        {
+            Py_XDECREF(val);
+            Py_DECREF(key);
+            Py_DECREF(it);
+            return -1;
+        }
+        Py_DECREF(val);
+        Py_DECREF(key);
+    }
+    Py_DECREF(it);
+    return PyErr_Occurred() ? -1 : 0;
+}
+
+/* Return a frozenmap sharing the mutation's current tree.  The mutation
+   switches to a fresh ID so the shared nodes stay immutable. */
+static PyHamtObject *
+hamt_mutation_finish(PyHamtMutationObject *m)
+{
+    PyHamtObject *o;
+
+    if (m->m_count == 0) {
+        return _PyHamt_New();
+    }
+
+    o = hamt_alloc();
+    if (o == NULL) {
+        return NULL;
+    }
+    Py_INCREF(m->m_root);
+    o->h_root = m->m_root;
+    o->h_count = m->m_count;
+
+    if (m->m_mutid != 0) {
+        m->m_mutid = hamt_new_mutid();
+    }
+    return o;
+}
+
+/* Return a copy of 'o' updated from 'src' and the 'kwds' dict, either
+   of which may be NULL. */
+static PyObject *
+hamt_update_from(PyHamtObject *o, PyObject *src, PyObject *kwds)
+{
+    PyHamtMutationObject *m;
+    PyHamtObject *res;
+
+    m = hamt_mutation_new(o);
+    if (m == NULL) {
+        return NULL;
+    }
+    if ((src != NULL && hamt_mutation_update(m, src) < 0) ||
+        (kwds != NULL && hamt_mutation_update(m, kwds) < 0))
+    {
+        Py_DECREF(m);
+        return NULL;
+    }
+    if (m->m_root == o->h_root) {
+        /* Nothing has changed. */
+        Py_DECREF(m);
+        Py_INCREF(o);
+        return (PyObject *)o;
+    }
+    res = hamt_mutation_finish(m);
+    Py_DECREF(m);
+    return (PyObject *)res;
+}
+
+
 /////////////////////////////////// _PyHamt_Type
 
 
@@ -2691,7 +3175,29 @@ hamt_dump(PyHamtObject *self);
 static PyObject *
 hamt_tp_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 {
-    return (PyObject*)_PyHamt_New();
+    PyObject *arg = NULL;
+
+    if (!PyArg_UnpackTuple(args, "frozenmap", 0, 1, &arg)) {
+        return NULL;
+    }
+    if (kwds != NULL && PyDict_GET_SIZE(kwds) == 0) {
+        kwds = NULL;
+    }
+    if (kwds == NULL && (arg == NULL || PyHamt_Check(arg))) {
+        if (arg != NULL) {
+            Py_INCREF(arg);
+            return arg;
+        }
+        return (PyObject*)_PyHamt_New();
+    }
+
+    PyHamtObject *empty = _PyHamt_New();
+    if (empty == NULL) {
+        return NULL;
+    }
+    PyObject *res = hamt_update_from(empty, arg, kwds);
+    Py_DECREF(empty);
+    return res;
 }
 
 static int
@@ -2745,6 +3251,102 @@ hamt_tp_richcompare(PyObject *v, PyObject *w, int op)
     }
 }
 
+static Py_hash_t
+hamt_tp_hash(PyHamtObject *self)
+{
+    /* Combine the hashes of all items in an order-independent way,
+       using the same bit mixing as frozenset. */
+    PyHamtIteratorState iter;
+    PyObject *key, *val;
+    Py_uhash_t hash = 0;
+
+    if (self->h_hash != -1) {
+        return self->h_hash;
+    }
+
+    hamt_iterator_init(&iter, self->h_root);
+    while (hamt_iterator_next(&iter, &key, &val) == I_ITEM) {
+        Py_hash_t key_hash = PyObject_Hash(key);
+        if (key_hash == -1) {
+            return -1;
+        }
+        Py_hash_t val_hash = PyObject_Hash(val);
+        if (val_hash == -1) {
+            return -1;
+        }
+        Py_uhash_t entry = (Py_uhash_t)key_hash * 1000003UL
+                           ^ (Py_uhash_t)val_hash;
+        hash ^= ((entry ^ 89869747UL) ^ (entry << 16)) * 3644798167UL;
+    }
+
+    hash ^= ((Py_uhash_t)self->h_count + 1) * 1927868237UL;
+    hash ^= (hash >> 11) ^ (hash >> 25);
+    hash = hash * 69069U + 907133923UL;
+    if (hash == (Py_uhash_t)-1) {
+        hash = 590923713UL;
+    }
+    self->h_hash = (Py_hash_t)hash;
+    return self->h_hash;
+}
+
+static PyObject *
+hamt_tp_repr(PyHamtObject *self)
+{
+    PyHamtIteratorState iter;
+    PyObject *key, *val;
+    _PyUnicodeWriter writer;
+    int first = 1;
+
+    int r = Py_ReprEnter((PyObject *)self);
+    if (r != 0) {
+        return r > 0 ? PyUnicode_FromString("frozenmap({...})") : NULL;
+    }
+
+    _PyUnicodeWriter_Init(&writer);
+    writer.overallocate = 1;
+    if (_PyUnicodeWriter_WriteASCIIString(&writer, "frozenmap({", 11) < 0) {
+        goto error;
+    }
+
+    hamt_iterator_init(&iter, self->h_root);
+    while (hamt_iterator_next(&iter, &key, &val) == I_ITEM) {
+        PyObject *s;
+        if (!first &&
+            _PyUnicodeWriter_WriteASCIIString(&writer, ", ", 2) < 0)
+        {
+            goto error;
+        }
+        first = 0;
+
+        s = PyObject_Repr(key);
+        if (s == NULL || _PyUnicodeWriter_WriteStr(&writer, s) < 0) {
+            Py_XDECREF(s);
+            goto error;
+        }
+        Py_DECREF(s);
+        if (_PyUnicodeWriter_WriteASCIIString(&writer, ": ", 2) < 0) {
+            goto error;
+        }
+        s = PyObject_Repr(val);
+        if (s == NULL || _PyUnicodeWriter_WriteStr(&writer, s) < 0) {
+            Py_XDECREF(s);
+            goto error;
+        }
+        Py_DECREF(s);
+    }
+
+    if (_PyUnicodeWriter_WriteASCIIString(&writer, "})", 2) < 0) {
+        goto error;
+    }
+    Py_ReprLeave((PyObject *)self);
+    return _PyUnicodeWriter_Finish(&writer);
+
+error:
+    Py_ReprLeave((PyObject *)self);
+    _PyUnicodeWriter_Dealloc(&writer);
+    return NULL;
+}
+
 static int
 hamt_tp_contains(PyHamtObject *self, PyObject *key)
 {
@@ -2849,6 +3451,55 @@ hamt_py_keys(PyHamtObject *self, PyObject *args)
     return _PyHamt_NewIterKeys(self);
 }
 
+static PyObject *
+hamt_py_update(PyHamtObject *self, PyObject *args, PyObject *kwds)
+{
+    PyObject *arg = NULL;
+
+    if (!PyArg_UnpackTuple(args, "update", 0, 1, &arg)) {
+        return NULL;
+    }
+    if (kwds != NULL && PyDict_GET_SIZE(kwds) == 0) {
+        kwds = NULL;
+    }
+    return hamt_update_from(self, arg, kwds);
+}
+
+static PyObject *
+hamt_py_mutate(PyHamtObject *self, PyObject *Py_UNUSED(args))
+{
+    return (PyObject *)hamt_mutation_new(self);
+}
+
+static PyObject *
+hamt_py_copy(PyHamtObject *self, PyObject *Py_UNUSED(args))
+{
+    Py_INCREF(self);
+    return (PyObject *)self;
+}
+
+static PyObject *
+hamt_py_reduce(PyHamtObject *self, PyObject *Py_UNUSED(args))
+{
+    PyHamtIteratorState iter;
+    PyObject *key, *val;
+
+    PyObject *dict = PyDict_New();
+    if (dict == NULL) {
+        return NULL;
+    }
+
+    hamt_iterator_init(&iter, self->h_root);
+    while (hamt_iterator_next(&iter, &key, &val) == I_ITEM) {
+        if (PyDict_SetItem(dict, key, val) < 0) {
+            Py_DECREF(dict);
+            return NULL;
+        }
+    }
+
+    return Py_BuildValue("O(N)", Py_TYPE(self), dict);
+}
+
 #ifdef Py_DEBUG
 static PyObject *
 hamt_py_dump(PyHamtObject *self, PyObject *args)
@@ -2865,6 +3516,13 @@ static PyMethodDef PyHamt_methods[] = {
     {"items", (PyCFunction)hamt_py_items, METH_NOARGS, NULL},
     {"keys", (PyCFunction)hamt_py_keys, METH_NOARGS, NULL},
     {"values", (PyCFunction)hamt_py_values, METH_NOARGS, NULL},
+    {"update", (PyCFunction)(void(*)(void))hamt_py_update,
+     METH_VARARGS | METH_KEYWORDS, NULL},
+    {"mutate", (PyCFunction)hamt_py_mutate, METH_NOARGS, NULL},
+    {"__copy__", (PyCFunction)hamt_py_copy, METH_NOARGS, NULL},
+    {"__reduce__", (PyCFunction)hamt_py_reduce, METH_NOARGS, NULL},
+    {"__class_getitem__", (PyCFunction)Py_GenericAlias,
+     METH_O | METH_CLASS, PyDoc_STR("See PEP 585")},
 #ifdef Py_DEBUG
     {"__dump__", (PyCFunction)hamt_py_dump, METH_NOARGS, NULL},
 #endif
@@ -2889,9 +3547,19 @@ static PyMappingMethods PyHamt_as_mapping = {
     (binaryfunc)hamt_tp_subscript,    /* mp_subscript */
 };
 
+PyDoc_STRVAR(hamt_doc,
+"frozenmap(mapping=(), /, **kwargs)\n\
+--\n\
+\n\
+Immutable mapping with structural sharing.\n\
+\n\
+set(), delete() and update() return new frozenmaps that share most of\n\
+their structure with the original.  mutate() returns a mutation object\n\
+that applies a batch of changes without copying on every step.");
+
 PyTypeObject _PyHamt_Type = {
     PyVarObject_HEAD_INIT(&PyType_Type, 0)
-    "hamt",
+    "collections.frozenmap",
     sizeof(PyHamtObject),
     .tp_methods = PyHamt_methods,
     .tp_as_mapping = &PyHamt_as_mapping,
@@ -2905,6 +3573,280 @@ PyTypeObject _PyHamt_Type = {
     .tp_clear = (inquiry)hamt_tp_clear,
     .tp_new = hamt_tp_new,
     .tp_weaklistoffset = offsetof(PyHamtObject, h_weakreflist),
+    .tp_hash = (hashfunc)hamt_tp_hash,
+    .tp_repr = (reprfunc)hamt_tp_repr,
+    .tp_doc = hamt_doc,
+};
+
+
+/////////////////////////////////// _PyHamtMutation_Type
+
+
+static int
+hamt_mutation_check(PyHamtMutationObject *self)
+{
+    if (self->m_mutid == 0) {
+        PyErr_SetString(PyExc_ValueError, "mutation is closed");
+        return -1;
+    }
+    if (self->m_busy) {
+        PyErr_SetString(PyExc_RuntimeError,
+                        "frozenmap mutation modified during a key "
+                        "comparison");
+        return -1;
+    }
+    return 0;
+}
+
+static int
+hamt_mutation_tp_clear(PyHamtMutationObject *self)
+{
+    Py_CLEAR(self->m_root);
+    return 0;
+}
+
+static int
+hamt_mutation_tp_traverse(PyHamtMutationObject *self,
+                          visitproc visit, void *arg)
+{
+    Py_VISIT(self->m_root);
+    return 0;
+}
+
+static void
+hamt_mutation_tp_dealloc(PyHamtMutationObject *self)
+{
+    PyObject_GC_UnTrack(self);
+    (void)hamt_mutation_tp_clear(self);
+    Py_TYPE(self)->tp_free(self);
+}
+
+static Py_ssize_t
+hamt_mutation_tp_len(PyHamtMutationObject *self)
+{
+    return self->m_count;
+}
+
+static int
+hamt_mutation_tp_contains(PyHamtMutationObject *self, PyObject *key)
+{
+    PyObject *val;
+    switch (hamt_mutation_find(self, key, &val)) {
+        case F_ERROR:
+            return -1;
+        case F_NOT_FOUND:
+            return 0;
+        case F_FOUND:
+            return 1;
+        default:
+            Py_UNREACHABLE();
+    }
+}
+
+static PyObject *
+hamt_mutation_tp_subscript(PyHamtMutationObject *self, PyObject *key)
+{
+    PyObject *val;
+    switch (hamt_mutation_find(self, key, &val)) {
+        case F_ERROR:
+            return NULL;
+        case F_FOUND:
+            Py_INCREF(val);
+            return val;
+        case F_NOT_FOUND:
+            PyErr_SetObject(PyExc_KeyError, key);
+            return NULL;
+        default:
+            Py_UNREACHABLE();
+    }
+}
+
+static int
+hamt_mutation_tp_ass_subscript(PyHamtMutationObject *self,
+                               PyObject *key, PyObject *val)
+{
+    if (hamt_mutation_check(self) < 0) {
+        return -1;
+    }
+
+    if (val == NULL) {
+        int res = hamt_mutation_without(self, key);
+        if (res == 0) {
+            PyErr_SetObject(PyExc_KeyError, key);
+            return -1;
+        }
+        return res < 0 ? -1 : 0;
+    }
+
+    int32_t key_hash = hamt_hash(key);
+    if (key_hash == -1) {
+        return -1;
+    }
+    return hamt_mutation_assoc(self, key, key_hash, val);
+}
+
+static PyObject *
+hamt_mutation_py_set(PyHamtMutationObject *self, PyObject *args)
+{
+    PyObject *key;
+    PyObject *val;
+
+    if (!PyArg_UnpackTuple(args, "set", 2, 2, &key, &val)) {
+        return NULL;
+    }
+    if (hamt_mutation_tp_ass_subscript(self, key, val) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+hamt_mutation_py_get(PyHamtMutationObject *self, PyObject *args)
+{
+    PyObject *key;
+    PyObject *def = Py_None;
+    PyObject *val;
+
+    if (!PyArg_UnpackTuple(args, "get", 1, 2, &key, &def)) {
+        return NULL;
+    }
+
+    switch (hamt_mutation_find(self, key, &val)) {
+        case F_ERROR:
+            return NULL;
+        case F_FOUND:
+            Py_INCREF(val);
+            return val;
+        case F_NOT_FOUND:
+            Py_INCREF(def);
+            return def;
+        default:
+            Py_UNREACHABLE();
+    }
+}
+
+static PyObject *
+hamt_mutation_py_pop(PyHamtMutationObject *self, PyObject *args)
+{
+    PyObject *key;
+    PyObject *def = NULL;
+    PyObject *val;
+
+    if (!PyArg_UnpackTuple(args, "pop", 1, 2, &key, &def)) {
+        return NULL;
+    }
+    if (hamt_mutation_check(self) < 0) {
+        return NULL;
+    }
+
+    switch (hamt_mutation_find(self, key, &val)) {
+        case F_ERROR:
+            return NULL;
+        case F_FOUND:
+            /* Keep the value alive: the tree drops its reference. */
+            Py_INCREF(val);
+            if (hamt_mutation_check(self) < 0 ||
+                hamt_mutation_without(self, key) < 0)
+            {
+                Py_DECREF(val);
+                return NULL;
+            }
+            return val;
+        case F_NOT_FOUND:
+            if (def == NULL) {
+                PyErr_SetObject(PyExc_KeyError, key);
+                return NULL;
+            }
+            Py_INCREF(def);
+            return def;
+        default:
+            Py_UNREACHABLE();
+    }
+}
+
+static PyObject *
+hamt_mutation_py_update(PyHamtMutationObject *self,
+                        PyObject *args, PyObject *kwds)
+{
+    PyObject *arg = NULL;
+
+    if (!PyArg_UnpackTuple(args, "update", 0, 1, &arg)) {
+        return NULL;
+    }
+    if (hamt_mutation_check(self) < 0) {
+        return NULL;
+    }
+    if ((arg != NULL && hamt_mutation_update(self, arg) < 0) ||
+        (kwds != NULL && hamt_mutation_update(self, kwds) < 0))
+    {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+hamt_mutation_py_finish(PyHamtMutationObject *self,
+                        PyObject *Py_UNUSED(args))
+{
+    if (self->m_busy) {
+        PyErr_SetString(PyExc_RuntimeError,
+                        "frozenmap mutation modified during a key "
+                        "comparison");
+        return NULL;
+    }
+    return (PyObject *)hamt_mutation_finish(self);
+}
+
+static PyObject *
+hamt_mutation_py_enter(PyHamtMutationObject *self,
+                       PyObject *Py_UNUSED(args))
+{
+    Py_INCREF(self);
+    return (PyObject *)self;
+}
+
+static PyObject *
+hamt_mutation_py_exit(PyHamtMutationObject *self, PyObject *args)
+{
+    self->m_mutid = 0;
+    Py_RETURN_FALSE;
+}
+
+
+static PyMethodDef PyHamtMutation_methods[] = {
+    {"set", (PyCFunction)hamt_mutation_py_set, METH_VARARGS, NULL},
+    {"get", (PyCFunction)hamt_mutation_py_get, METH_VARARGS, NULL},
+    {"pop", (PyCFunction)hamt_mutation_py_pop, METH_VARARGS, NULL},
+    {"update", (PyCFunction)(void(*)(void))hamt_mutation_py_update,
+     METH_VARARGS | METH_KEYWORDS, NULL},
+    {"finish", (PyCFunction)hamt_mutation_py_finish, METH_NOARGS, NULL},
+    {"__enter__", (PyCFunction)hamt_mutation_py_enter, METH_NOARGS, NULL},
+    {"__exit__", (PyCFunction)hamt_mutation_py_exit, METH_VARARGS, NULL},
+    {NULL, NULL}
+};
+
+static PySequenceMethods PyHamtMutation_as_sequence = {
+    .sq_contains = (objobjproc)hamt_mutation_tp_contains,
+};
+
+static PyMappingMethods PyHamtMutation_as_mapping = {
+    (lenfunc)hamt_mutation_tp_len,                  /* mp_length */
+    (binaryfunc)hamt_mutation_tp_subscript,         /* mp_subscript */
+    (objobjargproc)hamt_mutation_tp_ass_subscript,  /* mp_ass_subscript */
+};
+
+PyTypeObject _PyHamtMutation_Type = {
+    PyVarObject_HEAD_INIT(&PyType_Type, 0)
+    "collections.frozenmapmutation",
+    sizeof(PyHamtMutationObject),
+    .tp_methods = PyHamtMutation_methods,
+    .tp_as_mapping = &PyHamtMutation_as_mapping,
+    .tp_as_sequence = &PyHamtMutation_as_sequence,
+    .tp_dealloc = (destructor)hamt_mutation_tp_dealloc,
+    .tp_getattro = PyObject_GenericGetAttr,
+    .tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC,
+    .tp_traverse = (traverseproc)hamt_mutation_tp_traverse,
+    .tp_clear = (inquiry)hamt_mutation_tp_clear,
     .tp_hash = PyObject_HashNotImplemented,
 };
 
@@ -2961,7 +3903,8 @@ _PyHamt_Init(void)
         (PyType_Ready(&_PyHamt_CollisionNode_Type) < 0) ||
         (PyType_Ready(&_PyHamtKeys_Type) < 0) ||
         (PyType_Ready(&_PyHamtValues_Type) < 0) ||
-        (PyType_Ready(&_PyHamtItems_Type) < 0))
+        (PyType_Ready(&_PyHamtItems_Type) < 0) ||
+        (PyType_Ready(&_PyHamtMutation_Type) < 0))
     {
         return 0;
     }
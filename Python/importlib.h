@@ -1,168 +1,68 @@
 /* Auto-generated by Programs/_freeze_importlib.c */
 const unsigned char _Py_M__importlib_bootstrap[] = {
-    99,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,4,0,0,0,64,0,0,0,115,214,1,0,0,100,0,
-    90,0,100,1,100,2,132,0,90,1,100,3,90,2,100,3,
-    90,3,100,3,90,4,100,3,97,5,100,4,100,5,132,0,
-    90,6,100,6,100,7,132,0,90,7,105,0,90,8,105,0,
-    90,9,71,0,100,8,100,9,132,0,100,9,101,10,131,3,
-    90,11,71,0,100,10,100,11,132,0,100,11,131,2,90,12,
-    71,0,100,12,100,13,132,0,100,13,131,2,90,13,71,0,
-    100,14,100,15,132,0,100,15,131,2,90,14,100,16,100,17,
-    132,0,90,15,100,18,100,19,132,0,90,16,100,20,100,21,
-    132,0,90,17,100,22,100,23,156,1,100,24,100,25,132,2,
-    90,18,100,26,100,27,132,0,90,19,100,28,100,29,132,0,
-    90,20,100,30,100,31,132,0,90,21,100,32,100,33,132,0,
-    90,22,71,0,100,34,100,35,132,0,100,35,131,2,90,23,
-    100,3,100,3,100,36,156,2,100,37,100,38,132,2,90,24,
-    100,96,100,39,100,40,132,1,90,25,100,41,100,42,156,1,
-    100,43,100,44,132,2,90,26,100,45,100,46,132,0,90,27,
-    100,47,100,48,132,0,90,28,100,49,100,50,132,0,90,29,
-    100,51,100,52,132,0,90,30,100,53,100,54,132,0,90,31,
-    100,55,100,56,132,0,90,32,71,0,100,57,100,58,132,0,
-    100,58,131,2,90,33,71,0,100,59,100,60,132,0,100,60,
-    131,2,90,34,71,0,100,61,100,62,132,0,100,62,131,2,
-    90,35,100,63,100,64,132,0,90,36,100,65,100,66,132,0,
-    90,37,100,97,100,67,100,68,132,1,90,38,100,69,100,70,
-    132,0,90,39,100,71,90,40,101,40,100,72,23,0,90,41,
-    100,73,100,74,132,0,90,42,101,43,131,0,90,44,100,75,
-    100,76,132,0,90,45,100,98,100,78,100,79,132,1,90,46,
-    100,41,100,80,156,1,100,81,100,82,132,2,90,47,100,83,
-    100,84,132,0,90,48,100,99,100,86,100,87,132,1,90,49,
-    100,88,100,89,132,0,90,50,100,90,100,91,132,0,90,51,
-    100,92,100,93,132,0,90,52,100,94,100,95,132,0,90,53,
-    100,3,83,0,41,100,97,83,1,0,0,67,111,114,101,32,
-    105,109,112,108,101,109,101,110,116,97,116,105,111,110,32,111,
-    102,32,105,109,112,111,114,116,46,10,10,84,104,105,115,32,
-    109,111,100,117,108,101,32,105,115,32,78,79,84,32,109,101,
-    97,110,116,32,116,111,32,98,101,32,100,105,114,101,99,116,
-    108,121,32,105,109,112,111,114,116,101,100,33,32,73,116,32,
-    104,97,115,32,98,101,101,110,32,100,101,115,105,103,110,101,
-    100,32,115,117,99,104,10,116,104,97,116,32,105,116,32,99,
-    97,110,32,98,101,32,98,111,111,116,115,116,114,97,112,112,
-    101,100,32,105,110,116,111,32,80,121,116,104,111,110,32,97,
-    115,32,116,104,101,32,105,109,112,108,101,109,101,110,116,97,
-    116,105,111,110,32,111,102,32,105,109,112,111,114,116,46,32,
-    65,115,10,115,117,99,104,32,105,116,32,114,101,113,117,105,
-    114,101,115,32,116,104,101,32,105,110,106,101,99,116,105,111,
-    110,32,111,102,32,115,112,101,99,105,102,105,99,32,109,111,
-    100,117,108,101,115,32,97,110,100,32,97,116,116,114,105,98,
-    117,116,101,115,32,105,110,32,111,114,100,101,114,32,116,111,
-    10,119,111,114,107,46,32,79,110,101,32,115,104,111,117,108,
-    100,32,117,115,101,32,105,109,112,111,114,116,108,105,98,32,
-    97,115,32,116,104,101,32,112,117,98,108,105,99,45,102,97,
-    99,105,110,103,32,118,101,114,115,105,111,110,32,111,102,32,
-    116,104,105,115,32,109,111,100,117,108,101,46,10,10,99,1,
-    0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,8,
-    0,0,0,67,0,0,0,115,38,0,0,0,122,4,124,0,
-    106,0,87,0,83,0,4,0,116,1,121,18,1,0,1,0,
-    1,0,116,2,124,0,131,1,106,0,6,0,89,0,83,0,
-    119,0,169,1,78,41,3,218,12,95,95,113,117,97,108,110,
-    97,109,101,95,95,218,14,65,116,116,114,105,98,117,116,101,
-    69,114,114,111,114,218,4,116,121,112,101,41,1,218,3,111,
-    98,106,169,0,114,5,0,0,0,250,29,60,102,114,111,122,
-    101,110,32,105,109,112,111,114,116,108,105,98,46,95,98,111,
-    111,116,115,116,114,97,112,62,218,12,95,111,98,106,101,99,
-    116,95,110,97,109,101,23,0,0,0,115,12,0,0,0,2,
-    1,8,1,12,1,14,1,2,255,255,128,114,7,0,0,0,
-    78,99,2,0,0,0,0,0,0,0,0,0,0,0,3,0,
-    0,0,7,0,0,0,67,0,0,0,115,56,0,0,0,100,
-    1,68,0,93,16,125,2,116,0,124,1,124,2,131,2,114,
-    18,116,1,124,0,124,2,116,2,124,1,124,2,131,2,131,
-    3,1,0,113,2,124,0,106,3,160,4,124,1,106,3,161,
-    1,1,0,100,2,83,0,41,3,122,47,83,105,109,112,108,
-    101,32,115,117,98,115,116,105,116,117,116,101,32,102,111,114,
-    32,102,117,110,99,116,111,111,108,115,46,117,112,100,97,116,
-    101,95,119,114,97,112,112,101,114,46,41,4,218,10,95,95,
-    109,111,100,117,108,101,95,95,218,8,95,95,110,97,109,101,
-    95,95,114,1,0,0,0,218,7,95,95,100,111,99,95,95,
-    78,41,5,218,7,104,97,115,97,116,116,114,218,7,115,101,
-    116,97,116,116,114,218,7,103,101,116,97,116,116,114,218,8,
-    95,95,100,105,99,116,95,95,218,6,117,112,100,97,116,101,
-    41,3,90,3,110,101,119,90,3,111,108,100,218,7,114,101,
-    112,108,97,99,101,114,5,0,0,0,114,5,0,0,0,114,
-    6,0,0,0,218,5,95,119,114,97,112,40,0,0,0,115,
-    12,0,0,0,8,2,10,1,18,1,2,128,18,1,255,128,
-    114,17,0,0,0,99,1,0,0,0,0,0,0,0,0,0,
-    0,0,1,0,0,0,2,0,0,0,67,0,0,0,115,12,
-    0,0,0,116,0,116,1,131,1,124,0,131,1,83,0,114,
-    0,0,0,0,41,2,114,3,0,0,0,218,3,115,121,115,
-    169,1,218,4,110,97,109,101,114,5,0,0,0,114,5,0,
-    0,0,114,6,0,0,0,218,11,95,110,101,119,95,109,111,
-    100,117,108,101,48,0,0,0,115,4,0,0,0,12,1,255,
-    128,114,21,0,0,0,99,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,1,0,0,0,64,0,0,0,115,
-    12,0,0,0,101,0,90,1,100,0,90,2,100,1,83,0,
-    41,2,218,14,95,68,101,97,100,108,111,99,107,69,114,114,
-    111,114,78,41,3,114,9,0,0,0,114,8,0,0,0,114,
-    1,0,0,0,114,5,0,0,0,114,5,0,0,0,114,5,
-    0,0,0,114,6,0,0,0,114,22,0,0,0,61,0,0,
-    0,115,6,0,0,0,8,0,4,1,255,128,114,22,0,0,
-    0,99,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,0,2,0,0,0,64,0,0,0,115,56,0,0,0,101,
-    0,90,1,100,0,90,2,100,1,90,3,100,2,100,3,132,
-    0,90,4,100,4,100,5,132,0,90,5,100,6,100,7,132,
-    0,90,6,100,8,100,9,132,0,90,7,100,10,100,11,132,
-    0,90,8,100,12,83,0,41,13,218,11,95,77,111,100,117,
-    108,101,76,111,99,107,122,169,65,32,114,101,99,117,114,115,
-    105,118,101,32,108,111,99,107,32,105,109,112,108,101,109,101,
-    110,116,97,116,105,111,110,32,119,104,105,99,104,32,105,115,
-    32,97,98,108,101,32,116,111,32,100,101,116,101,99,116,32,
-    100,101,97,100,108,111,99,107,115,10,32,32,32,32,40,101,
-    46,103,46,32,116,104,114,101,97,100,32,49,32,116,114,121,
-    105,110,103,32,116,111,32,116,97,107,101,32,108,111,99,107,
-    115,32,65,32,116,104,101,110,32,66,44,32,97,110,100,32,
-    116,104,114,101,97,100,32,50,32,116,114,121,105,110,103,32,
-    116,111,10,32,32,32,32,116,97,107,101,32,108,111,99,107,
-    115,32,66,32,116,104,101,110,32,65,41,46,10,32,32,32,
-    32,99,2,0,0,0,0,0,0,0,0,0,0,0,2,0,
-    0,0,2,0,0,0,67,0,0,0,115,48,0,0,0,116,
-    0,160,1,161,0,124,0,95,2,116,0,160,1,161,0,124,
-    0,95,3,124,1,124,0,95,4,100,0,124,0,95,5,100,
-    1,124,0,95,6,100,1,124,0,95,7,100,0,83,0,169,
-    2,78,233,0,0,0,0,41,8,218,7,95,116,104,114,101,
-    97,100,90,13,97,108,108,111,99,97,116,101,95,108,111,99,
-    107,218,4,108,111,99,107,218,6,119,97,107,101,117,112,114,
-    20,0,0,0,218,5,111,119,110,101,114,218,5,99,111,117,
-    110,116,218,7,119,97,105,116,101,114,115,169,2,218,4,115,
-    101,108,102,114,20,0,0,0,114,5,0,0,0,114,5,0,
-    0,0,114,6,0,0,0,218,8,95,95,105,110,105,116,95,
-    95,71,0,0,0,115,14,0,0,0,10,1,10,1,6,1,
-    6,1,6,1,10,1,255,128,122,20,95,77,111,100,117,108,
-    101,76,111,99,107,46,95,95,105,110,105,116,95,95,99,1,
-    0,0,0,0,0,0,0,0,0,0,0,5,0,0,0,3,
-    0,0,0,67,0,0,0,115,86,0,0,0,116,0,160,1,
-    161,0,125,1,124,0,106,2,125,2,116,3,131,0,125,3,
-    9,0,116,4,160,5,124,2,161,1,125,4,124,4,100,0,
-    117,0,114,22,100,2,83,0,124,4,106,2,125,2,124,2,
-    124,1,107,2,114,31,100,1,83,0,124,2,124,3,118,0,
-    114,37,100,2,83,0,124,3,160,6,124,2,161,1,1,0,
-    113,11,41,3,78,84,70,41,7,114,26,0,0,0,218,9,
-    103,101,116,95,105,100,101,110,116,114,29,0,0,0,218,3,
-    115,101,116,218,12,95,98,108,111,99,107,105,110,103,95,111,
-    110,218,3,103,101,116,218,3,97,100,100,41,5,114,33,0,
-    0,0,90,2,109,101,218,3,116,105,100,90,4,115,101,101,
-    110,114,27,0,0,0,114,5,0,0,0,114,5,0,0,0,
-    114,6,0,0,0,218,12,104,97,115,95,100,101,97,100,108,
-    111,99,107,79,0,0,0,115,30,0,0,0,8,2,6,1,
-    6,1,2,1,10,1,8,1,4,1,6,1,8,1,4,1,
-    8,1,4,6,10,1,2,242,255,128,122,24,95,77,111,100,
-    117,108,101,76,111,99,107,46,104,97,115,95,100,101,97,100,
-    108,111,99,107,99,1,0,0,0,0,0,0,0,0,0,0,
-    0,2,0,0,0,8,0,0,0,67,0,0,0,115,198,0,
-    0,0,116,0,160,1,161,0,125,1,124,0,116,2,124,1,
-    60,0,122,86,9,0,124,0,106,3,143,63,1,0,124,0,
-    106,4,100,2,107,2,115,24,124,0,106,5,124,1,107,2,
-    114,46,124,1,124,0,95,5,124,0,4,0,106,4,100,3,
-    55,0,2,0,95,4,87,0,100,4,4,0,4,0,131,3,
-    1,0,87,0,116,2,124,1,61,0,100,1,83,0,124,0,
-    160,6,161,0,114,56,116,7,100,5,124,0,22,0,131,1,
-    130,1,124,0,106,8,160,9,100,6,161,1,114,69,124,0,
-    4,0,106,10,100,3,55,0,2,0,95,10,87,0,100,4,
-    4,0,4,0,131,3,1,0,110,8,49,0,115,79,119,1,
-    1,0,1,0,1,0,89,0,1,0,124,0,106,8,160,9,
-    161,0,1,0,124,0,106,8,160,11,161,0,1,0,113,10,
-    116,2,124,1,61,0,119,0,41,7,122,185,10,32,32,32,
+    88,130,3,2,211,2,67,111,114,101,32,105,109,112,108,101,
+    109,101,110,116,97,116,105,111,110,32,111,102,32,105,109,112,
+    111,114,116,46,10,10,84,104,105,115,32,109,111,100,117,108,
+    101,32,105,115,32,78,79,84,32,109,101,97,110,116,32,116,
+    111,32,98,101,32,100,105,114,101,99,116,108,121,32,105,109,
+    112,111,114,116,101,100,33,32,73,116,32,104,97,115,32,98,
+    101,101,110,32,100,101,115,105,103,110,101,100,32,115,117,99,
+    104,10,116,104,97,116,32,105,116,32,99,97,110,32,98,101,
+    32,98,111,111,116,115,116,114,97,112,112,101,100,32,105,110,
+    116,111,32,80,121,116,104,111,110,32,97,115,32,116,104,101,
+    32,105,109,112,108,101,109,101,110,116,97,116,105,111,110,32,
+    111,102,32,105,109,112,111,114,116,46,32,65,115,10,115,117,
+    99,104,32,105,116,32,114,101,113,117,105,114,101,115,32,116,
+    104,101,32,105,110,106,101,99,116,105,111,110,32,111,102,32,
+    115,112,101,99,105,102,105,99,32,109,111,100,117,108,101,115,
+    32,97,110,100,32,97,116,116,114,105,98,117,116,101,115,32,
+    105,110,32,111,114,100,101,114,32,116,111,10,119,111,114,107,
+    46,32,79,110,101,32,115,104,111,117,108,100,32,117,115,101,
+    32,105,109,112,111,114,116,108,105,98,32,97,115,32,116,104,
+    101,32,112,117,98,108,105,99,45,102,97,99,105,110,103,32,
+    118,101,114,115,105,111,110,32,111,102,32,116,104,105,115,32,
+    109,111,100,117,108,101,46,10,10,3,12,95,95,113,117,97,
+    108,110,97,109,101,95,95,3,14,65,116,116,114,105,98,117,
+    116,101,69,114,114,111,114,3,4,116,121,112,101,3,3,111,
+    98,106,2,29,60,102,114,111,122,101,110,32,105,109,112,111,
+    114,116,108,105,98,46,95,98,111,111,116,115,116,114,97,112,
+    62,3,12,95,111,98,106,101,99,116,95,110,97,109,101,2,
+    47,83,105,109,112,108,101,32,115,117,98,115,116,105,116,117,
+    116,101,32,102,111,114,32,102,117,110,99,116,111,111,108,115,
+    46,117,112,100,97,116,101,95,119,114,97,112,112,101,114,46,
+    3,10,95,95,109,111,100,117,108,101,95,95,3,8,95,95,
+    110,97,109,101,95,95,3,7,95,95,100,111,99,95,95,3,
+    7,104,97,115,97,116,116,114,3,7,115,101,116,97,116,116,
+    114,3,7,103,101,116,97,116,116,114,3,8,95,95,100,105,
+    99,116,95,95,3,6,117,112,100,97,116,101,3,3,110,101,
+    119,3,3,111,108,100,3,7,114,101,112,108,97,99,101,3,
+    5,95,119,114,97,112,3,3,115,121,115,3,4,110,97,109,
+    101,3,11,95,110,101,119,95,109,111,100,117,108,101,3,14,
+    95,68,101,97,100,108,111,99,107,69,114,114,111,114,3,11,
+    95,77,111,100,117,108,101,76,111,99,107,2,169,1,65,32,
+    114,101,99,117,114,115,105,118,101,32,108,111,99,107,32,105,
+    109,112,108,101,109,101,110,116,97,116,105,111,110,32,119,104,
+    105,99,104,32,105,115,32,97,98,108,101,32,116,111,32,100,
+    101,116,101,99,116,32,100,101,97,100,108,111,99,107,115,10,
+    32,32,32,32,40,101,46,103,46,32,116,104,114,101,97,100,
+    32,49,32,116,114,121,105,110,103,32,116,111,32,116,97,107,
+    101,32,108,111,99,107,115,32,65,32,116,104,101,110,32,66,
+    44,32,97,110,100,32,116,104,114,101,97,100,32,50,32,116,
+    114,121,105,110,103,32,116,111,10,32,32,32,32,116,97,107,
+    101,32,108,111,99,107,115,32,66,32,116,104,101,110,32,65,
+    41,46,10,32,32,32,32,3,7,95,116,104,114,101,97,100,
+    3,13,97,108,108,111,99,97,116,101,95,108,111,99,107,3,
+    4,108,111,99,107,3,6,119,97,107,101,117,112,3,5,111,
+    119,110,101,114,3,5,99,111,117,110,116,3,7,119,97,105,
+    116,101,114,115,3,4,115,101,108,102,3,8,95,95,105,110,
+    105,116,95,95,2,20,95,77,111,100,117,108,101,76,111,99,
+    107,46,95,95,105,110,105,116,95,95,3,9,103,101,116,95,
+    105,100,101,110,116,3,3,115,101,116,3,12,95,98,108,111,
+    99,107,105,110,103,95,111,110,3,3,103,101,116,3,3,97,
+    100,100,3,2,109,101,3,3,116,105,100,3,4,115,101,101,
+    110,3,12,104,97,115,95,100,101,97,100,108,111,99,107,2,
+    24,95,77,111,100,117,108,101,76,111,99,107,46,104,97,115,
+    95,100,101,97,100,108,111,99,107,2,185,1,10,32,32,32,
     32,32,32,32,32,65,99,113,117,105,114,101,32,116,104,101,
     32,109,111,100,117,108,101,32,108,111,99,107,46,32,32,73,
     102,32,97,32,112,111,116,101,110,116,105,97,108,32,100,101,
@@ -174,883 +74,342 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     111,99,107,32,105,115,32,97,108,119,97,121,115,32,97,99,
     113,117,105,114,101,100,32,97,110,100,32,84,114,117,101,32,
     105,115,32,114,101,116,117,114,110,101,100,46,10,32,32,32,
-    32,32,32,32,32,84,114,25,0,0,0,233,1,0,0,0,
-    78,122,23,100,101,97,100,108,111,99,107,32,100,101,116,101,
-    99,116,101,100,32,98,121,32,37,114,70,41,12,114,26,0,
-    0,0,114,35,0,0,0,114,37,0,0,0,114,27,0,0,
-    0,114,30,0,0,0,114,29,0,0,0,114,41,0,0,0,
-    114,22,0,0,0,114,28,0,0,0,218,7,97,99,113,117,
-    105,114,101,114,31,0,0,0,218,7,114,101,108,101,97,115,
-    101,169,2,114,33,0,0,0,114,40,0,0,0,114,5,0,
-    0,0,114,5,0,0,0,114,6,0,0,0,114,43,0,0,
-    0,100,0,0,0,115,40,0,0,0,8,6,8,1,2,1,
-    2,1,8,1,20,1,6,1,14,1,14,1,10,9,8,248,
-    12,1,12,1,14,1,30,128,10,2,10,1,2,244,8,14,
-    255,128,122,19,95,77,111,100,117,108,101,76,111,99,107,46,
-    97,99,113,117,105,114,101,99,1,0,0,0,0,0,0,0,
-    0,0,0,0,2,0,0,0,8,0,0,0,67,0,0,0,
-    115,144,0,0,0,116,0,160,1,161,0,125,1,124,0,106,
-    2,143,55,1,0,124,0,106,3,124,1,107,3,114,17,116,
-    4,100,1,131,1,130,1,124,0,106,5,100,2,107,4,115,
-    24,74,0,130,1,124,0,4,0,106,5,100,3,56,0,2,
-    0,95,5,124,0,106,5,100,2,107,2,114,54,100,0,124,
-    0,95,3,124,0,106,6,114,54,124,0,4,0,106,6,100,
-    3,56,0,2,0,95,6,124,0,106,7,160,8,161,0,1,
-    0,87,0,100,0,4,0,4,0,131,3,1,0,100,0,83,
-    0,49,0,115,65,119,1,1,0,1,0,1,0,89,0,1,
-    0,100,0,83,0,41,4,78,250,31,99,97,110,110,111,116,
-    32,114,101,108,101,97,115,101,32,117,110,45,97,99,113,117,
-    105,114,101,100,32,108,111,99,107,114,25,0,0,0,114,42,
-    0,0,0,41,9,114,26,0,0,0,114,35,0,0,0,114,
-    27,0,0,0,114,29,0,0,0,218,12,82,117,110,116,105,
-    109,101,69,114,114,111,114,114,30,0,0,0,114,31,0,0,
-    0,114,28,0,0,0,114,44,0,0,0,114,45,0,0,0,
-    114,5,0,0,0,114,5,0,0,0,114,6,0,0,0,114,
-    44,0,0,0,125,0,0,0,115,26,0,0,0,8,1,8,
-    1,10,1,8,1,14,1,14,1,10,1,6,1,6,1,14,
-    1,10,1,36,128,255,128,122,19,95,77,111,100,117,108,101,
-    76,111,99,107,46,114,101,108,101,97,115,101,99,1,0,0,
-    0,0,0,0,0,0,0,0,0,1,0,0,0,5,0,0,
-    0,67,0,0,0,243,18,0,0,0,100,1,160,0,124,0,
-    106,1,116,2,124,0,131,1,161,2,83,0,41,2,78,122,
-    23,95,77,111,100,117,108,101,76,111,99,107,40,123,33,114,
-    125,41,32,97,116,32,123,125,169,3,218,6,102,111,114,109,
-    97,116,114,20,0,0,0,218,2,105,100,169,1,114,33,0,
-    0,0,114,5,0,0,0,114,5,0,0,0,114,6,0,0,
-    0,218,8,95,95,114,101,112,114,95,95,138,0,0,0,243,
-    4,0,0,0,18,1,255,128,122,20,95,77,111,100,117,108,
-    101,76,111,99,107,46,95,95,114,101,112,114,95,95,78,41,
-    9,114,9,0,0,0,114,8,0,0,0,114,1,0,0,0,
-    114,10,0,0,0,114,34,0,0,0,114,41,0,0,0,114,
-    43,0,0,0,114,44,0,0,0,114,53,0,0,0,114,5,
-    0,0,0,114,5,0,0,0,114,5,0,0,0,114,6,0,
-    0,0,114,23,0,0,0,65,0,0,0,115,16,0,0,0,
-    8,0,4,1,8,5,8,8,8,21,8,25,12,13,255,128,
-    114,23,0,0,0,99,0,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,2,0,0,0,64,0,0,0,115,48,
-    0,0,0,101,0,90,1,100,0,90,2,100,1,90,3,100,
-    2,100,3,132,0,90,4,100,4,100,5,132,0,90,5,100,
-    6,100,7,132,0,90,6,100,8,100,9,132,0,90,7,100,
-    10,83,0,41,11,218,16,95,68,117,109,109,121,77,111,100,
-    117,108,101,76,111,99,107,122,86,65,32,115,105,109,112,108,
-    101,32,95,77,111,100,117,108,101,76,111,99,107,32,101,113,
-    117,105,118,97,108,101,110,116,32,102,111,114,32,80,121,116,
-    104,111,110,32,98,117,105,108,100,115,32,119,105,116,104,111,
-    117,116,10,32,32,32,32,109,117,108,116,105,45,116,104,114,
-    101,97,100,105,110,103,32,115,117,112,112,111,114,116,46,99,
-    2,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,
-    2,0,0,0,67,0,0,0,115,16,0,0,0,124,1,124,
-    0,95,0,100,1,124,0,95,1,100,0,83,0,114,24,0,
-    0,0,41,2,114,20,0,0,0,114,30,0,0,0,114,32,
-    0,0,0,114,5,0,0,0,114,5,0,0,0,114,6,0,
-    0,0,114,34,0,0,0,146,0,0,0,243,6,0,0,0,
-    6,1,10,1,255,128,122,25,95,68,117,109,109,121,77,111,
-    100,117,108,101,76,111,99,107,46,95,95,105,110,105,116,95,
-    95,99,1,0,0,0,0,0,0,0,0,0,0,0,1,0,
-    0,0,3,0,0,0,67,0,0,0,115,18,0,0,0,124,
-    0,4,0,106,0,100,1,55,0,2,0,95,0,100,2,83,
-    0,41,3,78,114,42,0,0,0,84,41,1,114,30,0,0,
-    0,114,52,0,0,0,114,5,0,0,0,114,5,0,0,0,
-    114,6,0,0,0,114,43,0,0,0,150,0,0,0,115,6,
-    0,0,0,14,1,4,1,255,128,122,24,95,68,117,109,109,
-    121,77,111,100,117,108,101,76,111,99,107,46,97,99,113,117,
-    105,114,101,99,1,0,0,0,0,0,0,0,0,0,0,0,
-    1,0,0,0,3,0,0,0,67,0,0,0,115,36,0,0,
-    0,124,0,106,0,100,1,107,2,114,9,116,1,100,2,131,
-    1,130,1,124,0,4,0,106,0,100,3,56,0,2,0,95,
-    0,100,0,83,0,41,4,78,114,25,0,0,0,114,46,0,
-    0,0,114,42,0,0,0,41,2,114,30,0,0,0,114,47,
-    0,0,0,114,52,0,0,0,114,5,0,0,0,114,5,0,
-    0,0,114,6,0,0,0,114,44,0,0,0,154,0,0,0,
-    115,8,0,0,0,10,1,8,1,18,1,255,128,122,24,95,
+    32,32,32,32,32,2,23,100,101,97,100,108,111,99,107,32,
+    100,101,116,101,99,116,101,100,32,98,121,32,37,114,3,7,
+    97,99,113,117,105,114,101,3,7,114,101,108,101,97,115,101,
+    2,19,95,77,111,100,117,108,101,76,111,99,107,46,97,99,
+    113,117,105,114,101,2,31,99,97,110,110,111,116,32,114,101,
+    108,101,97,115,101,32,117,110,45,97,99,113,117,105,114,101,
+    100,32,108,111,99,107,3,12,82,117,110,116,105,109,101,69,
+    114,114,111,114,2,19,95,77,111,100,117,108,101,76,111,99,
+    107,46,114,101,108,101,97,115,101,2,23,95,77,111,100,117,
+    108,101,76,111,99,107,40,123,33,114,125,41,32,97,116,32,
+    123,125,3,6,102,111,114,109,97,116,3,2,105,100,3,8,
+    95,95,114,101,112,114,95,95,2,20,95,77,111,100,117,108,
+    101,76,111,99,107,46,95,95,114,101,112,114,95,95,3,16,
+    95,68,117,109,109,121,77,111,100,117,108,101,76,111,99,107,
+    2,86,65,32,115,105,109,112,108,101,32,95,77,111,100,117,
+    108,101,76,111,99,107,32,101,113,117,105,118,97,108,101,110,
+    116,32,102,111,114,32,80,121,116,104,111,110,32,98,117,105,
+    108,100,115,32,119,105,116,104,111,117,116,10,32,32,32,32,
+    109,117,108,116,105,45,116,104,114,101,97,100,105,110,103,32,
+    115,117,112,112,111,114,116,46,2,25,95,68,117,109,109,121,
+    77,111,100,117,108,101,76,111,99,107,46,95,95,105,110,105,
+    116,95,95,2,24,95,68,117,109,109,121,77,111,100,117,108,
+    101,76,111,99,107,46,97,99,113,117,105,114,101,2,24,95,
     68,117,109,109,121,77,111,100,117,108,101,76,111,99,107,46,
-    114,101,108,101,97,115,101,99,1,0,0,0,0,0,0,0,
-    0,0,0,0,1,0,0,0,5,0,0,0,67,0,0,0,
-    114,48,0,0,0,41,2,78,122,28,95,68,117,109,109,121,
-    77,111,100,117,108,101,76,111,99,107,40,123,33,114,125,41,
-    32,97,116,32,123,125,114,49,0,0,0,114,52,0,0,0,
-    114,5,0,0,0,114,5,0,0,0,114,6,0,0,0,114,
-    53,0,0,0,159,0,0,0,114,54,0,0,0,122,25,95,
-    68,117,109,109,121,77,111,100,117,108,101,76,111,99,107,46,
-    95,95,114,101,112,114,95,95,78,41,8,114,9,0,0,0,
-    114,8,0,0,0,114,1,0,0,0,114,10,0,0,0,114,
-    34,0,0,0,114,43,0,0,0,114,44,0,0,0,114,53,
-    0,0,0,114,5,0,0,0,114,5,0,0,0,114,5,0,
-    0,0,114,6,0,0,0,114,55,0,0,0,142,0,0,0,
-    115,14,0,0,0,8,0,4,1,8,3,8,4,8,4,12,
-    5,255,128,114,55,0,0,0,99,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,0,0,2,0,0,0,64,0,0,
-    0,115,36,0,0,0,101,0,90,1,100,0,90,2,100,1,
-    100,2,132,0,90,3,100,3,100,4,132,0,90,4,100,5,
-    100,6,132,0,90,5,100,7,83,0,41,8,218,18,95,77,
+    114,101,108,101,97,115,101,2,28,95,68,117,109,109,121,77,
+    111,100,117,108,101,76,111,99,107,40,123,33,114,125,41,32,
+    97,116,32,123,125,2,25,95,68,117,109,109,121,77,111,100,
+    117,108,101,76,111,99,107,46,95,95,114,101,112,114,95,95,
+    3,18,95,77,111,100,117,108,101,76,111,99,107,77,97,110,
+    97,103,101,114,3,5,95,110,97,109,101,3,5,95,108,111,
+    99,107,2,27,95,77,111,100,117,108,101,76,111,99,107,77,
+    97,110,97,103,101,114,46,95,95,105,110,105,116,95,95,3,
+    16,95,103,101,116,95,109,111,100,117,108,101,95,108,111,99,
+    107,3,9,95,95,101,110,116,101,114,95,95,2,28,95,77,
     111,100,117,108,101,76,111,99,107,77,97,110,97,103,101,114,
-    99,2,0,0,0,0,0,0,0,0,0,0,0,2,0,0,
-    0,2,0,0,0,67,0,0,0,115,16,0,0,0,124,1,
-    124,0,95,0,100,0,124,0,95,1,100,0,83,0,114,0,
-    0,0,0,41,2,218,5,95,110,97,109,101,218,5,95,108,
-    111,99,107,114,32,0,0,0,114,5,0,0,0,114,5,0,
-    0,0,114,6,0,0,0,114,34,0,0,0,165,0,0,0,
-    114,56,0,0,0,122,27,95,77,111,100,117,108,101,76,111,
-    99,107,77,97,110,97,103,101,114,46,95,95,105,110,105,116,
-    95,95,99,1,0,0,0,0,0,0,0,0,0,0,0,1,
-    0,0,0,2,0,0,0,67,0,0,0,115,26,0,0,0,
-    116,0,124,0,106,1,131,1,124,0,95,2,124,0,106,2,
-    160,3,161,0,1,0,100,0,83,0,114,0,0,0,0,41,
-    4,218,16,95,103,101,116,95,109,111,100,117,108,101,95,108,
-    111,99,107,114,58,0,0,0,114,59,0,0,0,114,43,0,
-    0,0,114,52,0,0,0,114,5,0,0,0,114,5,0,0,
-    0,114,6,0,0,0,218,9,95,95,101,110,116,101,114,95,
-    95,169,0,0,0,115,6,0,0,0,12,1,14,1,255,128,
-    122,28,95,77,111,100,117,108,101,76,111,99,107,77,97,110,
-    97,103,101,114,46,95,95,101,110,116,101,114,95,95,99,1,
-    0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,2,
-    0,0,0,79,0,0,0,115,14,0,0,0,124,0,106,0,
-    160,1,161,0,1,0,100,0,83,0,114,0,0,0,0,41,
-    2,114,59,0,0,0,114,44,0,0,0,41,3,114,33,0,
-    0,0,218,4,97,114,103,115,90,6,107,119,97,114,103,115,
-    114,5,0,0,0,114,5,0,0,0,114,6,0,0,0,218,
-    8,95,95,101,120,105,116,95,95,173,0,0,0,115,4,0,
-    0,0,14,1,255,128,122,27,95,77,111,100,117,108,101,76,
-    111,99,107,77,97,110,97,103,101,114,46,95,95,101,120,105,
-    116,95,95,78,41,6,114,9,0,0,0,114,8,0,0,0,
-    114,1,0,0,0,114,34,0,0,0,114,61,0,0,0,114,
-    63,0,0,0,114,5,0,0,0,114,5,0,0,0,114,5,
-    0,0,0,114,6,0,0,0,114,57,0,0,0,163,0,0,
-    0,115,10,0,0,0,8,0,8,2,8,4,12,4,255,128,
-    114,57,0,0,0,99,1,0,0,0,0,0,0,0,0,0,
-    0,0,3,0,0,0,8,0,0,0,67,0,0,0,115,132,
-    0,0,0,116,0,160,1,161,0,1,0,122,55,122,7,116,
-    2,124,0,25,0,131,0,125,1,87,0,110,9,4,0,116,
-    3,121,65,1,0,1,0,1,0,100,1,125,1,89,0,124,
-    1,100,1,117,0,114,53,116,4,100,1,117,0,114,35,116,
-    5,124,0,131,1,125,1,110,4,116,6,124,0,131,1,125,
-    1,124,0,102,1,100,2,100,3,132,1,125,2,116,7,160,
-    8,124,1,124,2,161,2,116,2,124,0,60,0,87,0,116,
-    0,160,9,161,0,1,0,124,1,83,0,116,0,160,9,161,
-    0,1,0,119,0,119,0,41,4,122,139,71,101,116,32,111,
-    114,32,99,114,101,97,116,101,32,116,104,101,32,109,111,100,
-    117,108,101,32,108,111,99,107,32,102,111,114,32,97,32,103,
-    105,118,101,110,32,109,111,100,117,108,101,32,110,97,109,101,
-    46,10,10,32,32,32,32,65,99,113,117,105,114,101,47,114,
-    101,108,101,97,115,101,32,105,110,116,101,114,110,97,108,108,
-    121,32,116,104,101,32,103,108,111,98,97,108,32,105,109,112,
-    111,114,116,32,108,111,99,107,32,116,111,32,112,114,111,116,
-    101,99,116,10,32,32,32,32,95,109,111,100,117,108,101,95,
-    108,111,99,107,115,46,78,99,2,0,0,0,0,0,0,0,
-    0,0,0,0,2,0,0,0,8,0,0,0,83,0,0,0,
-    115,54,0,0,0,116,0,160,1,161,0,1,0,122,17,116,
-    2,160,3,124,1,161,1,124,0,117,0,114,15,116,2,124,
-    1,61,0,87,0,116,0,160,4,161,0,1,0,100,0,83,
-    0,116,0,160,4,161,0,1,0,119,0,114,0,0,0,0,
-    41,5,218,4,95,105,109,112,218,12,97,99,113,117,105,114,
-    101,95,108,111,99,107,218,13,95,109,111,100,117,108,101,95,
-    108,111,99,107,115,114,38,0,0,0,218,12,114,101,108,101,
-    97,115,101,95,108,111,99,107,41,2,218,3,114,101,102,114,
-    20,0,0,0,114,5,0,0,0,114,5,0,0,0,114,6,
-    0,0,0,218,2,99,98,198,0,0,0,115,14,0,0,0,
-    8,1,2,1,14,4,6,1,2,128,22,2,255,128,122,28,
-    95,103,101,116,95,109,111,100,117,108,101,95,108,111,99,107,
-    46,60,108,111,99,97,108,115,62,46,99,98,41,10,114,64,
-    0,0,0,114,65,0,0,0,114,66,0,0,0,218,8,75,
-    101,121,69,114,114,111,114,114,26,0,0,0,114,55,0,0,
-    0,114,23,0,0,0,218,8,95,119,101,97,107,114,101,102,
-    114,68,0,0,0,114,67,0,0,0,41,3,114,20,0,0,
-    0,114,27,0,0,0,114,69,0,0,0,114,5,0,0,0,
-    114,5,0,0,0,114,6,0,0,0,114,60,0,0,0,179,
-    0,0,0,115,36,0,0,0,8,6,2,1,2,1,14,1,
-    12,1,6,1,8,2,8,1,10,1,8,2,12,2,16,11,
-    2,128,8,2,4,2,10,254,2,234,255,128,114,60,0,0,
-    0,99,1,0,0,0,0,0,0,0,0,0,0,0,2,0,
-    0,0,8,0,0,0,67,0,0,0,115,54,0,0,0,116,
-    0,124,0,131,1,125,1,122,6,124,1,160,1,161,0,1,
-    0,87,0,110,9,4,0,116,2,121,26,1,0,1,0,1,
-    0,89,0,100,1,83,0,124,1,160,3,161,0,1,0,100,
-    1,83,0,119,0,41,2,122,189,65,99,113,117,105,114,101,
-    115,32,116,104,101,110,32,114,101,108,101,97,115,101,115,32,
+    46,95,95,101,110,116,101,114,95,95,3,4,97,114,103,115,
+    3,6,107,119,97,114,103,115,3,8,95,95,101,120,105,116,
+    95,95,2,27,95,77,111,100,117,108,101,76,111,99,107,77,
+    97,110,97,103,101,114,46,95,95,101,120,105,116,95,95,2,
+    139,1,71,101,116,32,111,114,32,99,114,101,97,116,101,32,
     116,104,101,32,109,111,100,117,108,101,32,108,111,99,107,32,
     102,111,114,32,97,32,103,105,118,101,110,32,109,111,100,117,
-    108,101,32,110,97,109,101,46,10,10,32,32,32,32,84,104,
-    105,115,32,105,115,32,117,115,101,100,32,116,111,32,101,110,
-    115,117,114,101,32,97,32,109,111,100,117,108,101,32,105,115,
-    32,99,111,109,112,108,101,116,101,108,121,32,105,110,105,116,
-    105,97,108,105,122,101,100,44,32,105,110,32,116,104,101,10,
-    32,32,32,32,101,118,101,110,116,32,105,116,32,105,115,32,
-    98,101,105,110,103,32,105,109,112,111,114,116,101,100,32,98,
-    121,32,97,110,111,116,104,101,114,32,116,104,114,101,97,100,
-    46,10,32,32,32,32,78,41,4,114,60,0,0,0,114,43,
-    0,0,0,114,22,0,0,0,114,44,0,0,0,41,2,114,
-    20,0,0,0,114,27,0,0,0,114,5,0,0,0,114,5,
-    0,0,0,114,6,0,0,0,218,19,95,108,111,99,107,95,
-    117,110,108,111,99,107,95,109,111,100,117,108,101,216,0,0,
-    0,115,16,0,0,0,8,6,2,1,12,1,12,1,6,3,
-    12,2,2,251,255,128,114,72,0,0,0,99,1,0,0,0,
-    0,0,0,0,0,0,0,0,3,0,0,0,4,0,0,0,
-    79,0,0,0,115,14,0,0,0,124,0,124,1,105,0,124,
-    2,164,1,142,1,83,0,41,2,97,46,1,0,0,114,101,
-    109,111,118,101,95,105,109,112,111,114,116,108,105,98,95,102,
-    114,97,109,101,115,32,105,110,32,105,109,112,111,114,116,46,
-    99,32,119,105,108,108,32,97,108,119,97,121,115,32,114,101,
-    109,111,118,101,32,115,101,113,117,101,110,99,101,115,10,32,
-    32,32,32,111,102,32,105,109,112,111,114,116,108,105,98,32,
-    102,114,97,109,101,115,32,116,104,97,116,32,101,110,100,32,
-    119,105,116,104,32,97,32,99,97,108,108,32,116,111,32,116,
-    104,105,115,32,102,117,110,99,116,105,111,110,10,10,32,32,
-    32,32,85,115,101,32,105,116,32,105,110,115,116,101,97,100,
-    32,111,102,32,97,32,110,111,114,109,97,108,32,99,97,108,
-    108,32,105,110,32,112,108,97,99,101,115,32,119,104,101,114,
-    101,32,105,110,99,108,117,100,105,110,103,32,116,104,101,32,
-    105,109,112,111,114,116,108,105,98,10,32,32,32,32,102,114,
-    97,109,101,115,32,105,110,116,114,111,100,117,99,101,115,32,
-    117,110,119,97,110,116,101,100,32,110,111,105,115,101,32,105,
-    110,116,111,32,116,104,101,32,116,114,97,99,101,98,97,99,
-    107,32,40,101,46,103,46,32,119,104,101,110,32,101,120,101,
-    99,117,116,105,110,103,10,32,32,32,32,109,111,100,117,108,
-    101,32,99,111,100,101,41,10,32,32,32,32,78,114,5,0,
-    0,0,41,3,218,1,102,114,62,0,0,0,90,4,107,119,
-    100,115,114,5,0,0,0,114,5,0,0,0,114,6,0,0,
-    0,218,25,95,99,97,108,108,95,119,105,116,104,95,102,114,
-    97,109,101,115,95,114,101,109,111,118,101,100,233,0,0,0,
-    115,4,0,0,0,14,8,255,128,114,74,0,0,0,114,42,
-    0,0,0,41,1,218,9,118,101,114,98,111,115,105,116,121,
-    99,1,0,0,0,0,0,0,0,1,0,0,0,3,0,0,
-    0,4,0,0,0,71,0,0,0,115,58,0,0,0,116,0,
-    106,1,106,2,124,1,107,5,114,27,124,0,160,3,100,1,
-    161,1,115,15,100,2,124,0,23,0,125,0,116,4,124,0,
-    106,5,124,2,142,0,116,0,106,6,100,3,141,2,1,0,
-    100,4,83,0,100,4,83,0,41,5,122,61,80,114,105,110,
-    116,32,116,104,101,32,109,101,115,115,97,103,101,32,116,111,
-    32,115,116,100,101,114,114,32,105,102,32,45,118,47,80,89,
-    84,72,79,78,86,69,82,66,79,83,69,32,105,115,32,116,
-    117,114,110,101,100,32,111,110,46,41,2,250,1,35,122,7,
-    105,109,112,111,114,116,32,122,2,35,32,41,1,90,4,102,
-    105,108,101,78,41,7,114,18,0,0,0,218,5,102,108,97,
-    103,115,218,7,118,101,114,98,111,115,101,218,10,115,116,97,
-    114,116,115,119,105,116,104,218,5,112,114,105,110,116,114,50,
-    0,0,0,218,6,115,116,100,101,114,114,41,3,218,7,109,
-    101,115,115,97,103,101,114,75,0,0,0,114,62,0,0,0,
-    114,5,0,0,0,114,5,0,0,0,114,6,0,0,0,218,
-    16,95,118,101,114,98,111,115,101,95,109,101,115,115,97,103,
-    101,244,0,0,0,115,12,0,0,0,12,2,10,1,8,1,
-    24,1,4,253,255,128,114,83,0,0,0,99,1,0,0,0,
-    0,0,0,0,0,0,0,0,2,0,0,0,3,0,0,0,
-    3,0,0,0,243,26,0,0,0,135,0,102,1,100,1,100,
-    2,132,8,125,1,116,0,124,1,136,0,131,2,1,0,124,
-    1,83,0,41,4,122,49,68,101,99,111,114,97,116,111,114,
-    32,116,111,32,118,101,114,105,102,121,32,116,104,101,32,110,
-    97,109,101,100,32,109,111,100,117,108,101,32,105,115,32,98,
-    117,105,108,116,45,105,110,46,99,2,0,0,0,0,0,0,
-    0,0,0,0,0,2,0,0,0,4,0,0,0,19,0,0,
-    0,115,38,0,0,0,124,1,116,0,106,1,118,1,114,14,
-    116,2,100,1,160,3,124,1,161,1,124,1,100,2,141,2,
-    130,1,136,0,124,0,124,1,131,2,83,0,41,3,78,250,
-    29,123,33,114,125,32,105,115,32,110,111,116,32,97,32,98,
-    117,105,108,116,45,105,110,32,109,111,100,117,108,101,114,19,
-    0,0,0,41,4,114,18,0,0,0,218,20,98,117,105,108,
-    116,105,110,95,109,111,100,117,108,101,95,110,97,109,101,115,
-    218,11,73,109,112,111,114,116,69,114,114,111,114,114,50,0,
-    0,0,169,2,114,33,0,0,0,218,8,102,117,108,108,110,
-    97,109,101,169,1,218,3,102,120,110,114,5,0,0,0,114,
-    6,0,0,0,218,25,95,114,101,113,117,105,114,101,115,95,
-    98,117,105,108,116,105,110,95,119,114,97,112,112,101,114,254,
-    0,0,0,243,12,0,0,0,10,1,10,1,2,1,6,255,
-    10,2,255,128,122,52,95,114,101,113,117,105,114,101,115,95,
-    98,117,105,108,116,105,110,46,60,108,111,99,97,108,115,62,
-    46,95,114,101,113,117,105,114,101,115,95,98,117,105,108,116,
-    105,110,95,119,114,97,112,112,101,114,78,169,1,114,17,0,
-    0,0,41,2,114,91,0,0,0,114,92,0,0,0,114,5,
-    0,0,0,114,90,0,0,0,114,6,0,0,0,218,17,95,
+    108,101,32,110,97,109,101,46,10,10,32,32,32,32,65,99,
+    113,117,105,114,101,47,114,101,108,101,97,115,101,32,105,110,
+    116,101,114,110,97,108,108,121,32,116,104,101,32,103,108,111,
+    98,97,108,32,105,109,112,111,114,116,32,108,111,99,107,32,
+    116,111,32,112,114,111,116,101,99,116,10,32,32,32,32,95,
+    109,111,100,117,108,101,95,108,111,99,107,115,46,3,4,95,
+    105,109,112,3,12,97,99,113,117,105,114,101,95,108,111,99,
+    107,3,13,95,109,111,100,117,108,101,95,108,111,99,107,115,
+    3,12,114,101,108,101,97,115,101,95,108,111,99,107,3,3,
+    114,101,102,3,2,99,98,2,28,95,103,101,116,95,109,111,
+    100,117,108,101,95,108,111,99,107,46,60,108,111,99,97,108,
+    115,62,46,99,98,3,8,75,101,121,69,114,114,111,114,3,
+    8,95,119,101,97,107,114,101,102,2,189,1,65,99,113,117,
+    105,114,101,115,32,116,104,101,110,32,114,101,108,101,97,115,
+    101,115,32,116,104,101,32,109,111,100,117,108,101,32,108,111,
+    99,107,32,102,111,114,32,97,32,103,105,118,101,110,32,109,
+    111,100,117,108,101,32,110,97,109,101,46,10,10,32,32,32,
+    32,84,104,105,115,32,105,115,32,117,115,101,100,32,116,111,
+    32,101,110,115,117,114,101,32,97,32,109,111,100,117,108,101,
+    32,105,115,32,99,111,109,112,108,101,116,101,108,121,32,105,
+    110,105,116,105,97,108,105,122,101,100,44,32,105,110,32,116,
+    104,101,10,32,32,32,32,101,118,101,110,116,32,105,116,32,
+    105,115,32,98,101,105,110,103,32,105,109,112,111,114,116,101,
+    100,32,98,121,32,97,110,111,116,104,101,114,32,116,104,114,
+    101,97,100,46,10,32,32,32,32,3,19,95,108,111,99,107,
+    95,117,110,108,111,99,107,95,109,111,100,117,108,101,2,174,
+    2,114,101,109,111,118,101,95,105,109,112,111,114,116,108,105,
+    98,95,102,114,97,109,101,115,32,105,110,32,105,109,112,111,
+    114,116,46,99,32,119,105,108,108,32,97,108,119,97,121,115,
+    32,114,101,109,111,118,101,32,115,101,113,117,101,110,99,101,
+    115,10,32,32,32,32,111,102,32,105,109,112,111,114,116,108,
+    105,98,32,102,114,97,109,101,115,32,116,104,97,116,32,101,
+    110,100,32,119,105,116,104,32,97,32,99,97,108,108,32,116,
+    111,32,116,104,105,115,32,102,117,110,99,116,105,111,110,10,
+    10,32,32,32,32,85,115,101,32,105,116,32,105,110,115,116,
+    101,97,100,32,111,102,32,97,32,110,111,114,109,97,108,32,
+    99,97,108,108,32,105,110,32,112,108,97,99,101,115,32,119,
+    104,101,114,101,32,105,110,99,108,117,100,105,110,103,32,116,
+    104,101,32,105,109,112,111,114,116,108,105,98,10,32,32,32,
+    32,102,114,97,109,101,115,32,105,110,116,114,111,100,117,99,
+    101,115,32,117,110,119,97,110,116,101,100,32,110,111,105,115,
+    101,32,105,110,116,111,32,116,104,101,32,116,114,97,99,101,
+    98,97,99,107,32,40,101,46,103,46,32,119,104,101,110,32,
+    101,120,101,99,117,116,105,110,103,10,32,32,32,32,109,111,
+    100,117,108,101,32,99,111,100,101,41,10,32,32,32,32,3,
+    1,102,3,4,107,119,100,115,3,25,95,99,97,108,108,95,
+    119,105,116,104,95,102,114,97,109,101,115,95,114,101,109,111,
+    118,101,100,3,9,118,101,114,98,111,115,105,116,121,2,61,
+    80,114,105,110,116,32,116,104,101,32,109,101,115,115,97,103,
+    101,32,116,111,32,115,116,100,101,114,114,32,105,102,32,45,
+    118,47,80,89,84,72,79,78,86,69,82,66,79,83,69,32,
+    105,115,32,116,117,114,110,101,100,32,111,110,46,2,1,35,
+    2,7,105,109,112,111,114,116,32,2,2,35,32,3,4,102,
+    105,108,101,3,5,102,108,97,103,115,3,7,118,101,114,98,
+    111,115,101,3,10,115,116,97,114,116,115,119,105,116,104,3,
+    5,112,114,105,110,116,3,6,115,116,100,101,114,114,3,7,
+    109,101,115,115,97,103,101,3,16,95,118,101,114,98,111,115,
+    101,95,109,101,115,115,97,103,101,2,49,68,101,99,111,114,
+    97,116,111,114,32,116,111,32,118,101,114,105,102,121,32,116,
+    104,101,32,110,97,109,101,100,32,109,111,100,117,108,101,32,
+    105,115,32,98,117,105,108,116,45,105,110,46,2,29,123,33,
+    114,125,32,105,115,32,110,111,116,32,97,32,98,117,105,108,
+    116,45,105,110,32,109,111,100,117,108,101,3,20,98,117,105,
+    108,116,105,110,95,109,111,100,117,108,101,95,110,97,109,101,
+    115,3,11,73,109,112,111,114,116,69,114,114,111,114,3,8,
+    102,117,108,108,110,97,109,101,3,3,102,120,110,3,25,95,
     114,101,113,117,105,114,101,115,95,98,117,105,108,116,105,110,
-    252,0,0,0,243,8,0,0,0,12,2,10,5,4,1,255,
-    128,114,95,0,0,0,99,1,0,0,0,0,0,0,0,0,
-    0,0,0,2,0,0,0,3,0,0,0,3,0,0,0,114,
-    84,0,0,0,41,4,122,47,68,101,99,111,114,97,116,111,
-    114,32,116,111,32,118,101,114,105,102,121,32,116,104,101,32,
-    110,97,109,101,100,32,109,111,100,117,108,101,32,105,115,32,
-    102,114,111,122,101,110,46,99,2,0,0,0,0,0,0,0,
-    0,0,0,0,2,0,0,0,4,0,0,0,19,0,0,0,
-    115,38,0,0,0,116,0,160,1,124,1,161,1,115,14,116,
-    2,100,1,160,3,124,1,161,1,124,1,100,2,141,2,130,
-    1,136,0,124,0,124,1,131,2,83,0,169,3,78,122,27,
-    123,33,114,125,32,105,115,32,110,111,116,32,97,32,102,114,
-    111,122,101,110,32,109,111,100,117,108,101,114,19,0,0,0,
-    41,4,114,64,0,0,0,218,9,105,115,95,102,114,111,122,
-    101,110,114,87,0,0,0,114,50,0,0,0,114,88,0,0,
-    0,114,90,0,0,0,114,5,0,0,0,114,6,0,0,0,
-    218,24,95,114,101,113,117,105,114,101,115,95,102,114,111,122,
-    101,110,95,119,114,97,112,112,101,114,9,1,0,0,114,93,
-    0,0,0,122,50,95,114,101,113,117,105,114,101,115,95,102,
-    114,111,122,101,110,46,60,108,111,99,97,108,115,62,46,95,
-    114,101,113,117,105,114,101,115,95,102,114,111,122,101,110,95,
-    119,114,97,112,112,101,114,78,114,94,0,0,0,41,2,114,
-    91,0,0,0,114,99,0,0,0,114,5,0,0,0,114,90,
-    0,0,0,114,6,0,0,0,218,16,95,114,101,113,117,105,
-    114,101,115,95,102,114,111,122,101,110,7,1,0,0,114,96,
-    0,0,0,114,100,0,0,0,99,2,0,0,0,0,0,0,
-    0,0,0,0,0,5,0,0,0,4,0,0,0,67,0,0,
-    0,115,74,0,0,0,100,1,125,2,116,0,160,1,124,2,
-    116,2,161,2,1,0,116,3,124,1,124,0,131,2,125,3,
-    124,1,116,4,106,5,118,0,114,33,116,4,106,5,124,1,
-    25,0,125,4,116,6,124,3,124,4,131,2,1,0,116,4,
-    106,5,124,1,25,0,83,0,116,7,124,3,131,1,83,0,
-    41,3,122,130,76,111,97,100,32,116,104,101,32,115,112,101,
-    99,105,102,105,101,100,32,109,111,100,117,108,101,32,105,110,
-    116,111,32,115,121,115,46,109,111,100,117,108,101,115,32,97,
-    110,100,32,114,101,116,117,114,110,32,105,116,46,10,10,32,
-    32,32,32,84,104,105,115,32,109,101,116,104,111,100,32,105,
-    115,32,100,101,112,114,101,99,97,116,101,100,46,32,32,85,
-    115,101,32,108,111,97,100,101,114,46,101,120,101,99,95,109,
-    111,100,117,108,101,40,41,32,105,110,115,116,101,97,100,46,
-    10,10,32,32,32,32,122,103,116,104,101,32,108,111,97,100,
-    95,109,111,100,117,108,101,40,41,32,109,101,116,104,111,100,
-    32,105,115,32,100,101,112,114,101,99,97,116,101,100,32,97,
-    110,100,32,115,108,97,116,101,100,32,102,111,114,32,114,101,
-    109,111,118,97,108,32,105,110,32,80,121,116,104,111,110,32,
-    51,46,49,50,59,32,117,115,101,32,101,120,101,99,95,109,
-    111,100,117,108,101,40,41,32,105,110,115,116,101,97,100,78,
-    41,8,218,9,95,119,97,114,110,105,110,103,115,218,4,119,
-    97,114,110,218,18,68,101,112,114,101,99,97,116,105,111,110,
-    87,97,114,110,105,110,103,218,16,115,112,101,99,95,102,114,
-    111,109,95,108,111,97,100,101,114,114,18,0,0,0,218,7,
-    109,111,100,117,108,101,115,218,5,95,101,120,101,99,218,5,
-    95,108,111,97,100,41,5,114,33,0,0,0,114,89,0,0,
-    0,218,3,109,115,103,218,4,115,112,101,99,218,6,109,111,
-    100,117,108,101,114,5,0,0,0,114,5,0,0,0,114,6,
-    0,0,0,218,17,95,108,111,97,100,95,109,111,100,117,108,
-    101,95,115,104,105,109,19,1,0,0,115,18,0,0,0,4,
-    6,12,2,10,1,10,1,10,1,10,1,10,1,8,2,255,
-    128,114,111,0,0,0,99,1,0,0,0,0,0,0,0,0,
-    0,0,0,5,0,0,0,8,0,0,0,67,0,0,0,115,
-    184,0,0,0,116,0,124,0,100,1,100,2,131,3,125,1,
-    116,0,124,0,100,3,100,2,131,3,4,0,125,2,114,18,
-    116,1,124,2,131,1,83,0,116,2,124,1,100,4,131,2,
-    114,37,122,6,124,1,160,3,124,0,161,1,87,0,83,0,
-    4,0,116,4,121,91,1,0,1,0,1,0,89,0,122,5,
-    124,0,106,5,125,3,87,0,110,9,4,0,116,6,121,90,
-    1,0,1,0,1,0,100,5,125,3,89,0,122,5,124,0,
-    106,7,125,4,87,0,110,25,4,0,116,6,121,89,1,0,
-    1,0,1,0,124,1,100,2,117,0,114,75,100,6,160,8,
-    124,3,161,1,6,0,89,0,83,0,100,7,160,8,124,3,
-    124,1,161,2,6,0,89,0,83,0,100,8,160,8,124,3,
-    124,4,161,2,83,0,119,0,119,0,119,0,41,9,122,44,
-    84,104,101,32,105,109,112,108,101,109,101,110,116,97,116,105,
-    111,110,32,111,102,32,77,111,100,117,108,101,84,121,112,101,
-    46,95,95,114,101,112,114,95,95,40,41,46,218,10,95,95,
-    108,111,97,100,101,114,95,95,78,218,8,95,95,115,112,101,
-    99,95,95,218,11,109,111,100,117,108,101,95,114,101,112,114,
-    250,1,63,250,13,60,109,111,100,117,108,101,32,123,33,114,
-    125,62,250,20,60,109,111,100,117,108,101,32,123,33,114,125,
-    32,40,123,33,114,125,41,62,250,23,60,109,111,100,117,108,
-    101,32,123,33,114,125,32,102,114,111,109,32,123,33,114,125,
-    62,41,9,114,13,0,0,0,218,22,95,109,111,100,117,108,
-    101,95,114,101,112,114,95,102,114,111,109,95,115,112,101,99,
-    114,11,0,0,0,114,114,0,0,0,218,9,69,120,99,101,
-    112,116,105,111,110,114,9,0,0,0,114,2,0,0,0,218,
-    8,95,95,102,105,108,101,95,95,114,50,0,0,0,41,5,
-    114,110,0,0,0,218,6,108,111,97,100,101,114,114,109,0,
-    0,0,114,20,0,0,0,218,8,102,105,108,101,110,97,109,
-    101,114,5,0,0,0,114,5,0,0,0,114,6,0,0,0,
-    218,12,95,109,111,100,117,108,101,95,114,101,112,114,38,1,
-    0,0,115,46,0,0,0,12,2,16,1,8,1,10,1,2,
-    1,12,1,12,1,2,1,2,2,10,1,12,1,6,1,2,
-    1,10,1,12,1,8,1,14,1,16,2,12,2,2,250,2,
-    252,2,251,255,128,114,124,0,0,0,99,0,0,0,0,0,
-    0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,64,
-    0,0,0,115,114,0,0,0,101,0,90,1,100,0,90,2,
-    100,1,90,3,100,2,100,2,100,2,100,3,156,3,100,4,
-    100,5,132,2,90,4,100,6,100,7,132,0,90,5,100,8,
-    100,9,132,0,90,6,101,7,100,10,100,11,132,0,131,1,
-    90,8,101,8,106,9,100,12,100,11,132,0,131,1,90,8,
-    101,7,100,13,100,14,132,0,131,1,90,10,101,7,100,15,
-    100,16,132,0,131,1,90,11,101,11,106,9,100,17,100,16,
-    132,0,131,1,90,11,100,2,83,0,41,18,218,10,77,111,
-    100,117,108,101,83,112,101,99,97,208,5,0,0,84,104,101,
-    32,115,112,101,99,105,102,105,99,97,116,105,111,110,32,102,
-    111,114,32,97,32,109,111,100,117,108,101,44,32,117,115,101,
-    100,32,102,111,114,32,108,111,97,100,105,110,103,46,10,10,
-    32,32,32,32,65,32,109,111,100,117,108,101,39,115,32,115,
-    112,101,99,32,105,115,32,116,104,101,32,115,111,117,114,99,
-    101,32,102,111,114,32,105,110,102,111,114,109,97,116,105,111,
-    110,32,97,98,111,117,116,32,116,104,101,32,109,111,100,117,
-    108,101,46,32,32,70,111,114,10,32,32,32,32,100,97,116,
-    97,32,97,115,115,111,99,105,97,116,101,100,32,119,105,116,
-    104,32,116,104,101,32,109,111,100,117,108,101,44,32,105,110,
-    99,108,117,100,105,110,103,32,115,111,117,114,99,101,44,32,
-    117,115,101,32,116,104,101,32,115,112,101,99,39,115,10,32,
-    32,32,32,108,111,97,100,101,114,46,10,10,32,32,32,32,
-    96,110,97,109,101,96,32,105,115,32,116,104,101,32,97,98,
-    115,111,108,117,116,101,32,110,97,109,101,32,111,102,32,116,
-    104,101,32,109,111,100,117,108,101,46,32,32,96,108,111,97,
-    100,101,114,96,32,105,115,32,116,104,101,32,108,111,97,100,
-    101,114,10,32,32,32,32,116,111,32,117,115,101,32,119,104,
-    101,110,32,108,111,97,100,105,110,103,32,116,104,101,32,109,
-    111,100,117,108,101,46,32,32,96,112,97,114,101,110,116,96,
-    32,105,115,32,116,104,101,32,110,97,109,101,32,111,102,32,
-    116,104,101,10,32,32,32,32,112,97,99,107,97,103,101,32,
-    116,104,101,32,109,111,100,117,108,101,32,105,115,32,105,110,
-    46,32,32,84,104,101,32,112,97,114,101,110,116,32,105,115,
-    32,100,101,114,105,118,101,100,32,102,114,111,109,32,116,104,
-    101,32,110,97,109,101,46,10,10,32,32,32,32,96,105,115,
-    95,112,97,99,107,97,103,101,96,32,100,101,116,101,114,109,
-    105,110,101,115,32,105,102,32,116,104,101,32,109,111,100,117,
-    108,101,32,105,115,32,99,111,110,115,105,100,101,114,101,100,
-    32,97,32,112,97,99,107,97,103,101,32,111,114,10,32,32,
-    32,32,110,111,116,46,32,32,79,110,32,109,111,100,117,108,
-    101,115,32,116,104,105,115,32,105,115,32,114,101,102,108,101,
-    99,116,101,100,32,98,121,32,116,104,101,32,96,95,95,112,
-    97,116,104,95,95,96,32,97,116,116,114,105,98,117,116,101,
-    46,10,10,32,32,32,32,96,111,114,105,103,105,110,96,32,
-    105,115,32,116,104,101,32,115,112,101,99,105,102,105,99,32,
-    108,111,99,97,116,105,111,110,32,117,115,101,100,32,98,121,
-    32,116,104,101,32,108,111,97,100,101,114,32,102,114,111,109,
-    32,119,104,105,99,104,32,116,111,10,32,32,32,32,108,111,
-    97,100,32,116,104,101,32,109,111,100,117,108,101,44,32,105,
-    102,32,116,104,97,116,32,105,110,102,111,114,109,97,116,105,
-    111,110,32,105,115,32,97,118,97,105,108,97,98,108,101,46,
-    32,32,87,104,101,110,32,102,105,108,101,110,97,109,101,32,
-    105,115,10,32,32,32,32,115,101,116,44,32,111,114,105,103,
-    105,110,32,119,105,108,108,32,109,97,116,99,104,46,10,10,
-    32,32,32,32,96,104,97,115,95,108,111,99,97,116,105,111,
-    110,96,32,105,110,100,105,99,97,116,101,115,32,116,104,97,
-    116,32,97,32,115,112,101,99,39,115,32,34,111,114,105,103,
-    105,110,34,32,114,101,102,108,101,99,116,115,32,97,32,108,
-    111,99,97,116,105,111,110,46,10,32,32,32,32,87,104,101,
-    110,32,116,104,105,115,32,105,115,32,84,114,117,101,44,32,
-    96,95,95,102,105,108,101,95,95,96,32,97,116,116,114,105,
-    98,117,116,101,32,111,102,32,116,104,101,32,109,111,100,117,
-    108,101,32,105,115,32,115,101,116,46,10,10,32,32,32,32,
-    96,99,97,99,104,101,100,96,32,105,115,32,116,104,101,32,
-    108,111,99,97,116,105,111,110,32,111,102,32,116,104,101,32,
-    99,97,99,104,101,100,32,98,121,116,101,99,111,100,101,32,
-    102,105,108,101,44,32,105,102,32,97,110,121,46,32,32,73,
-    116,10,32,32,32,32,99,111,114,114,101,115,112,111,110,100,
-    115,32,116,111,32,116,104,101,32,96,95,95,99,97,99,104,
-    101,100,95,95,96,32,97,116,116,114,105,98,117,116,101,46,
-    10,10,32,32,32,32,96,115,117,98,109,111,100,117,108,101,
-    95,115,101,97,114,99,104,95,108,111,99,97,116,105,111,110,
-    115,96,32,105,115,32,116,104,101,32,115,101,113,117,101,110,
-    99,101,32,111,102,32,112,97,116,104,32,101,110,116,114,105,
-    101,115,32,116,111,10,32,32,32,32,115,101,97,114,99,104,
-    32,119,104,101,110,32,105,109,112,111,114,116,105,110,103,32,
-    115,117,98,109,111,100,117,108,101,115,46,32,32,73,102,32,
-    115,101,116,44,32,105,115,95,112,97,99,107,97,103,101,32,
-    115,104,111,117,108,100,32,98,101,10,32,32,32,32,84,114,
-    117,101,45,45,97,110,100,32,70,97,108,115,101,32,111,116,
-    104,101,114,119,105,115,101,46,10,10,32,32,32,32,80,97,
-    99,107,97,103,101,115,32,97,114,101,32,115,105,109,112,108,
-    121,32,109,111,100,117,108,101,115,32,116,104,97,116,32,40,
-    109,97,121,41,32,104,97,118,101,32,115,117,98,109,111,100,
-    117,108,101,115,46,32,32,73,102,32,97,32,115,112,101,99,
-    10,32,32,32,32,104,97,115,32,97,32,110,111,110,45,78,
-    111,110,101,32,118,97,108,117,101,32,105,110,32,96,115,117,
+    95,119,114,97,112,112,101,114,2,52,95,114,101,113,117,105,
+    114,101,115,95,98,117,105,108,116,105,110,46,60,108,111,99,
+    97,108,115,62,46,95,114,101,113,117,105,114,101,115,95,98,
+    117,105,108,116,105,110,95,119,114,97,112,112,101,114,3,17,
+    95,114,101,113,117,105,114,101,115,95,98,117,105,108,116,105,
+    110,2,47,68,101,99,111,114,97,116,111,114,32,116,111,32,
+    118,101,114,105,102,121,32,116,104,101,32,110,97,109,101,100,
+    32,109,111,100,117,108,101,32,105,115,32,102,114,111,122,101,
+    110,46,2,27,123,33,114,125,32,105,115,32,110,111,116,32,
+    97,32,102,114,111,122,101,110,32,109,111,100,117,108,101,3,
+    9,105,115,95,102,114,111,122,101,110,3,24,95,114,101,113,
+    117,105,114,101,115,95,102,114,111,122,101,110,95,119,114,97,
+    112,112,101,114,2,50,95,114,101,113,117,105,114,101,115,95,
+    102,114,111,122,101,110,46,60,108,111,99,97,108,115,62,46,
+    95,114,101,113,117,105,114,101,115,95,102,114,111,122,101,110,
+    95,119,114,97,112,112,101,114,3,16,95,114,101,113,117,105,
+    114,101,115,95,102,114,111,122,101,110,2,130,1,76,111,97,
+    100,32,116,104,101,32,115,112,101,99,105,102,105,101,100,32,
+    109,111,100,117,108,101,32,105,110,116,111,32,115,121,115,46,
+    109,111,100,117,108,101,115,32,97,110,100,32,114,101,116,117,
+    114,110,32,105,116,46,10,10,32,32,32,32,84,104,105,115,
+    32,109,101,116,104,111,100,32,105,115,32,100,101,112,114,101,
+    99,97,116,101,100,46,32,32,85,115,101,32,108,111,97,100,
+    101,114,46,101,120,101,99,95,109,111,100,117,108,101,40,41,
+    32,105,110,115,116,101,97,100,46,10,10,32,32,32,32,2,
+    103,116,104,101,32,108,111,97,100,95,109,111,100,117,108,101,
+    40,41,32,109,101,116,104,111,100,32,105,115,32,100,101,112,
+    114,101,99,97,116,101,100,32,97,110,100,32,115,108,97,116,
+    101,100,32,102,111,114,32,114,101,109,111,118,97,108,32,105,
+    110,32,80,121,116,104,111,110,32,51,46,49,50,59,32,117,
+    115,101,32,101,120,101,99,95,109,111,100,117,108,101,40,41,
+    32,105,110,115,116,101,97,100,3,9,95,119,97,114,110,105,
+    110,103,115,3,4,119,97,114,110,3,18,68,101,112,114,101,
+    99,97,116,105,111,110,87,97,114,110,105,110,103,3,16,115,
+    112,101,99,95,102,114,111,109,95,108,111,97,100,101,114,3,
+    7,109,111,100,117,108,101,115,3,5,95,101,120,101,99,3,
+    5,95,108,111,97,100,3,3,109,115,103,3,4,115,112,101,
+    99,3,6,109,111,100,117,108,101,3,17,95,108,111,97,100,
+    95,109,111,100,117,108,101,95,115,104,105,109,2,44,84,104,
+    101,32,105,109,112,108,101,109,101,110,116,97,116,105,111,110,
+    32,111,102,32,77,111,100,117,108,101,84,121,112,101,46,95,
+    95,114,101,112,114,95,95,40,41,46,3,10,95,95,108,111,
+    97,100,101,114,95,95,3,8,95,95,115,112,101,99,95,95,
+    3,11,109,111,100,117,108,101,95,114,101,112,114,2,1,63,
+    2,13,60,109,111,100,117,108,101,32,123,33,114,125,62,2,
+    20,60,109,111,100,117,108,101,32,123,33,114,125,32,40,123,
+    33,114,125,41,62,2,23,60,109,111,100,117,108,101,32,123,
+    33,114,125,32,102,114,111,109,32,123,33,114,125,62,3,22,
+    95,109,111,100,117,108,101,95,114,101,112,114,95,102,114,111,
+    109,95,115,112,101,99,3,9,69,120,99,101,112,116,105,111,
+    110,3,8,95,95,102,105,108,101,95,95,3,6,108,111,97,
+    100,101,114,3,8,102,105,108,101,110,97,109,101,3,12,95,
+    109,111,100,117,108,101,95,114,101,112,114,3,10,77,111,100,
+    117,108,101,83,112,101,99,2,208,11,84,104,101,32,115,112,
+    101,99,105,102,105,99,97,116,105,111,110,32,102,111,114,32,
+    97,32,109,111,100,117,108,101,44,32,117,115,101,100,32,102,
+    111,114,32,108,111,97,100,105,110,103,46,10,10,32,32,32,
+    32,65,32,109,111,100,117,108,101,39,115,32,115,112,101,99,
+    32,105,115,32,116,104,101,32,115,111,117,114,99,101,32,102,
+    111,114,32,105,110,102,111,114,109,97,116,105,111,110,32,97,
+    98,111,117,116,32,116,104,101,32,109,111,100,117,108,101,46,
+    32,32,70,111,114,10,32,32,32,32,100,97,116,97,32,97,
+    115,115,111,99,105,97,116,101,100,32,119,105,116,104,32,116,
+    104,101,32,109,111,100,117,108,101,44,32,105,110,99,108,117,
+    100,105,110,103,32,115,111,117,114,99,101,44,32,117,115,101,
+    32,116,104,101,32,115,112,101,99,39,115,10,32,32,32,32,
+    108,111,97,100,101,114,46,10,10,32,32,32,32,96,110,97,
+    109,101,96,32,105,115,32,116,104,101,32,97,98,115,111,108,
+    117,116,101,32,110,97,109,101,32,111,102,32,116,104,101,32,
+    109,111,100,117,108,101,46,32,32,96,108,111,97,100,101,114,
+    96,32,105,115,32,116,104,101,32,108,111,97,100,101,114,10,
+    32,32,32,32,116,111,32,117,115,101,32,119,104,101,110,32,
+    108,111,97,100,105,110,103,32,116,104,101,32,109,111,100,117,
+    108,101,46,32,32,96,112,97,114,101,110,116,96,32,105,115,
+    32,116,104,101,32,110,97,109,101,32,111,102,32,116,104,101,
+    10,32,32,32,32,112,97,99,107,97,103,101,32,116,104,101,
+    32,109,111,100,117,108,101,32,105,115,32,105,110,46,32,32,
+    84,104,101,32,112,97,114,101,110,116,32,105,115,32,100,101,
+    114,105,118,101,100,32,102,114,111,109,32,116,104,101,32,110,
+    97,109,101,46,10,10,32,32,32,32,96,105,115,95,112,97,
+    99,107,97,103,101,96,32,100,101,116,101,114,109,105,110,101,
+    115,32,105,102,32,116,104,101,32,109,111,100,117,108,101,32,
+    105,115,32,99,111,110,115,105,100,101,114,101,100,32,97,32,
+    112,97,99,107,97,103,101,32,111,114,10,32,32,32,32,110,
+    111,116,46,32,32,79,110,32,109,111,100,117,108,101,115,32,
+    116,104,105,115,32,105,115,32,114,101,102,108,101,99,116,101,
+    100,32,98,121,32,116,104,101,32,96,95,95,112,97,116,104,
+    95,95,96,32,97,116,116,114,105,98,117,116,101,46,10,10,
+    32,32,32,32,96,111,114,105,103,105,110,96,32,105,115,32,
+    116,104,101,32,115,112,101,99,105,102,105,99,32,108,111,99,
+    97,116,105,111,110,32,117,115,101,100,32,98,121,32,116,104,
+    101,32,108,111,97,100,101,114,32,102,114,111,109,32,119,104,
+    105,99,104,32,116,111,10,32,32,32,32,108,111,97,100,32,
+    116,104,101,32,109,111,100,117,108,101,44,32,105,102,32,116,
+    104,97,116,32,105,110,102,111,114,109,97,116,105,111,110,32,
+    105,115,32,97,118,97,105,108,97,98,108,101,46,32,32,87,
+    104,101,110,32,102,105,108,101,110,97,109,101,32,105,115,10,
+    32,32,32,32,115,101,116,44,32,111,114,105,103,105,110,32,
+    119,105,108,108,32,109,97,116,99,104,46,10,10,32,32,32,
+    32,96,104,97,115,95,108,111,99,97,116,105,111,110,96,32,
+    105,110,100,105,99,97,116,101,115,32,116,104,97,116,32,97,
+    32,115,112,101,99,39,115,32,34,111,114,105,103,105,110,34,
+    32,114,101,102,108,101,99,116,115,32,97,32,108,111,99,97,
+    116,105,111,110,46,10,32,32,32,32,87,104,101,110,32,116,
+    104,105,115,32,105,115,32,84,114,117,101,44,32,96,95,95,
+    102,105,108,101,95,95,96,32,97,116,116,114,105,98,117,116,
+    101,32,111,102,32,116,104,101,32,109,111,100,117,108,101,32,
+    105,115,32,115,101,116,46,10,10,32,32,32,32,96,99,97,
+    99,104,101,100,96,32,105,115,32,116,104,101,32,108,111,99,
+    97,116,105,111,110,32,111,102,32,116,104,101,32,99,97,99,
+    104,101,100,32,98,121,116,101,99,111,100,101,32,102,105,108,
+    101,44,32,105,102,32,97,110,121,46,32,32,73,116,10,32,
+    32,32,32,99,111,114,114,101,115,112,111,110,100,115,32,116,
+    111,32,116,104,101,32,96,95,95,99,97,99,104,101,100,95,
+    95,96,32,97,116,116,114,105,98,117,116,101,46,10,10,32,
+    32,32,32,96,115,117,98,109,111,100,117,108,101,95,115,101,
+    97,114,99,104,95,108,111,99,97,116,105,111,110,115,96,32,
+    105,115,32,116,104,101,32,115,101,113,117,101,110,99,101,32,
+    111,102,32,112,97,116,104,32,101,110,116,114,105,101,115,32,
+    116,111,10,32,32,32,32,115,101,97,114,99,104,32,119,104,
+    101,110,32,105,109,112,111,114,116,105,110,103,32,115,117,98,
+    109,111,100,117,108,101,115,46,32,32,73,102,32,115,101,116,
+    44,32,105,115,95,112,97,99,107,97,103,101,32,115,104,111,
+    117,108,100,32,98,101,10,32,32,32,32,84,114,117,101,45,
+    45,97,110,100,32,70,97,108,115,101,32,111,116,104,101,114,
+    119,105,115,101,46,10,10,32,32,32,32,80,97,99,107,97,
+    103,101,115,32,97,114,101,32,115,105,109,112,108,121,32,109,
+    111,100,117,108,101,115,32,116,104,97,116,32,40,109,97,121,
+    41,32,104,97,118,101,32,115,117,98,109,111,100,117,108,101,
+    115,46,32,32,73,102,32,97,32,115,112,101,99,10,32,32,
+    32,32,104,97,115,32,97,32,110,111,110,45,78,111,110,101,
+    32,118,97,108,117,101,32,105,110,32,96,115,117,98,109,111,
+    100,117,108,101,95,115,101,97,114,99,104,95,108,111,99,97,
+    116,105,111,110,115,96,44,32,116,104,101,32,105,109,112,111,
+    114,116,10,32,32,32,32,115,121,115,116,101,109,32,119,105,
+    108,108,32,99,111,110,115,105,100,101,114,32,109,111,100,117,
+    108,101,115,32,108,111,97,100,101,100,32,102,114,111,109,32,
+    116,104,101,32,115,112,101,99,32,97,115,32,112,97,99,107,
+    97,103,101,115,46,10,10,32,32,32,32,79,110,108,121,32,
+    102,105,110,100,101,114,115,32,40,115,101,101,32,105,109,112,
+    111,114,116,108,105,98,46,97,98,99,46,77,101,116,97,80,
+    97,116,104,70,105,110,100,101,114,32,97,110,100,10,32,32,
+    32,32,105,109,112,111,114,116,108,105,98,46,97,98,99,46,
+    80,97,116,104,69,110,116,114,121,70,105,110,100,101,114,41,
+    32,115,104,111,117,108,100,32,109,111,100,105,102,121,32,77,
+    111,100,117,108,101,83,112,101,99,32,105,110,115,116,97,110,
+    99,101,115,46,10,10,32,32,32,32,3,6,111,114,105,103,
+    105,110,3,12,108,111,97,100,101,114,95,115,116,97,116,101,
+    3,10,105,115,95,112,97,99,107,97,103,101,3,26,115,117,
     98,109,111,100,117,108,101,95,115,101,97,114,99,104,95,108,
-    111,99,97,116,105,111,110,115,96,44,32,116,104,101,32,105,
-    109,112,111,114,116,10,32,32,32,32,115,121,115,116,101,109,
-    32,119,105,108,108,32,99,111,110,115,105,100,101,114,32,109,
-    111,100,117,108,101,115,32,108,111,97,100,101,100,32,102,114,
-    111,109,32,116,104,101,32,115,112,101,99,32,97,115,32,112,
-    97,99,107,97,103,101,115,46,10,10,32,32,32,32,79,110,
-    108,121,32,102,105,110,100,101,114,115,32,40,115,101,101,32,
-    105,109,112,111,114,116,108,105,98,46,97,98,99,46,77,101,
-    116,97,80,97,116,104,70,105,110,100,101,114,32,97,110,100,
-    10,32,32,32,32,105,109,112,111,114,116,108,105,98,46,97,
-    98,99,46,80,97,116,104,69,110,116,114,121,70,105,110,100,
-    101,114,41,32,115,104,111,117,108,100,32,109,111,100,105,102,
-    121,32,77,111,100,117,108,101,83,112,101,99,32,105,110,115,
-    116,97,110,99,101,115,46,10,10,32,32,32,32,78,41,3,
-    218,6,111,114,105,103,105,110,218,12,108,111,97,100,101,114,
-    95,115,116,97,116,101,218,10,105,115,95,112,97,99,107,97,
-    103,101,99,3,0,0,0,0,0,0,0,3,0,0,0,6,
-    0,0,0,2,0,0,0,67,0,0,0,115,54,0,0,0,
-    124,1,124,0,95,0,124,2,124,0,95,1,124,3,124,0,
-    95,2,124,4,124,0,95,3,124,5,114,16,103,0,110,1,
-    100,0,124,0,95,4,100,1,124,0,95,5,100,0,124,0,
-    95,6,100,0,83,0,41,2,78,70,41,7,114,20,0,0,
-    0,114,122,0,0,0,114,126,0,0,0,114,127,0,0,0,
-    218,26,115,117,98,109,111,100,117,108,101,95,115,101,97,114,
-    99,104,95,108,111,99,97,116,105,111,110,115,218,13,95,115,
-    101,116,95,102,105,108,101,97,116,116,114,218,7,95,99,97,
-    99,104,101,100,41,6,114,33,0,0,0,114,20,0,0,0,
-    114,122,0,0,0,114,126,0,0,0,114,127,0,0,0,114,
-    128,0,0,0,114,5,0,0,0,114,5,0,0,0,114,6,
-    0,0,0,114,34,0,0,0,101,1,0,0,115,16,0,0,
-    0,6,2,6,1,6,1,6,1,14,1,6,3,10,1,255,
-    128,122,19,77,111,100,117,108,101,83,112,101,99,46,95,95,
-    105,110,105,116,95,95,99,1,0,0,0,0,0,0,0,0,
-    0,0,0,2,0,0,0,6,0,0,0,67,0,0,0,115,
-    102,0,0,0,100,1,160,0,124,0,106,1,161,1,100,2,
-    160,0,124,0,106,2,161,1,103,2,125,1,124,0,106,3,
-    100,0,117,1,114,26,124,1,160,4,100,3,160,0,124,0,
-    106,3,161,1,161,1,1,0,124,0,106,5,100,0,117,1,
-    114,40,124,1,160,4,100,4,160,0,124,0,106,5,161,1,
-    161,1,1,0,100,5,160,0,124,0,106,6,106,7,100,6,
-    160,8,124,1,161,1,161,2,83,0,41,7,78,122,9,110,
-    97,109,101,61,123,33,114,125,122,11,108,111,97,100,101,114,
-    61,123,33,114,125,122,11,111,114,105,103,105,110,61,123,33,
-    114,125,122,29,115,117,98,109,111,100,117,108,101,95,115,101,
-    97,114,99,104,95,108,111,99,97,116,105,111,110,115,61,123,
-    125,122,6,123,125,40,123,125,41,122,2,44,32,41,9,114,
-    50,0,0,0,114,20,0,0,0,114,122,0,0,0,114,126,
-    0,0,0,218,6,97,112,112,101,110,100,114,129,0,0,0,
-    218,9,95,95,99,108,97,115,115,95,95,114,9,0,0,0,
-    218,4,106,111,105,110,41,2,114,33,0,0,0,114,62,0,
-    0,0,114,5,0,0,0,114,5,0,0,0,114,6,0,0,
-    0,114,53,0,0,0,113,1,0,0,115,22,0,0,0,10,
-    1,10,1,4,255,10,2,18,1,10,1,6,1,8,1,4,
-    255,22,2,255,128,122,19,77,111,100,117,108,101,83,112,101,
-    99,46,95,95,114,101,112,114,95,95,99,2,0,0,0,0,
-    0,0,0,0,0,0,0,3,0,0,0,8,0,0,0,67,
-    0,0,0,115,102,0,0,0,124,0,106,0,125,2,122,36,
-    124,0,106,1,124,1,106,1,107,2,111,38,124,0,106,2,
-    124,1,106,2,107,2,111,38,124,0,106,3,124,1,106,3,
-    107,2,111,38,124,2,124,1,106,0,107,2,111,38,124,0,
-    106,4,124,1,106,4,107,2,111,38,124,0,106,5,124,1,
-    106,5,107,2,87,0,83,0,4,0,116,6,121,50,1,0,
-    1,0,1,0,116,7,6,0,89,0,83,0,119,0,114,0,
-    0,0,0,41,8,114,129,0,0,0,114,20,0,0,0,114,
-    122,0,0,0,114,126,0,0,0,218,6,99,97,99,104,101,
-    100,218,12,104,97,115,95,108,111,99,97,116,105,111,110,114,
-    2,0,0,0,218,14,78,111,116,73,109,112,108,101,109,101,
-    110,116,101,100,41,3,114,33,0,0,0,90,5,111,116,104,
-    101,114,90,4,115,109,115,108,114,5,0,0,0,114,5,0,
-    0,0,114,6,0,0,0,218,6,95,95,101,113,95,95,123,
-    1,0,0,115,34,0,0,0,6,1,2,1,12,1,10,1,
-    2,255,10,2,2,254,8,3,2,253,10,4,2,252,10,5,
-    4,251,12,6,8,1,2,255,255,128,122,17,77,111,100,117,
-    108,101,83,112,101,99,46,95,95,101,113,95,95,99,1,0,
-    0,0,0,0,0,0,0,0,0,0,1,0,0,0,3,0,
-    0,0,67,0,0,0,115,58,0,0,0,124,0,106,0,100,
-    0,117,0,114,26,124,0,106,1,100,0,117,1,114,26,124,
-    0,106,2,114,26,116,3,100,0,117,0,114,19,116,4,130,
-    1,116,3,160,5,124,0,106,1,161,1,124,0,95,0,124,
-    0,106,0,83,0,114,0,0,0,0,41,6,114,131,0,0,
-    0,114,126,0,0,0,114,130,0,0,0,218,19,95,98,111,
-    111,116,115,116,114,97,112,95,101,120,116,101,114,110,97,108,
-    218,19,78,111,116,73,109,112,108,101,109,101,110,116,101,100,
-    69,114,114,111,114,90,11,95,103,101,116,95,99,97,99,104,
-    101,100,114,52,0,0,0,114,5,0,0,0,114,5,0,0,
-    0,114,6,0,0,0,114,135,0,0,0,135,1,0,0,115,
-    14,0,0,0,10,2,16,1,8,1,4,1,14,1,6,1,
-    255,128,122,17,77,111,100,117,108,101,83,112,101,99,46,99,
-    97,99,104,101,100,99,2,0,0,0,0,0,0,0,0,0,
-    0,0,2,0,0,0,2,0,0,0,67,0,0,0,115,10,
-    0,0,0,124,1,124,0,95,0,100,0,83,0,114,0,0,
-    0,0,41,1,114,131,0,0,0,41,2,114,33,0,0,0,
-    114,135,0,0,0,114,5,0,0,0,114,5,0,0,0,114,
-    6,0,0,0,114,135,0,0,0,144,1,0,0,115,4,0,
-    0,0,10,2,255,128,99,1,0,0,0,0,0,0,0,0,
-    0,0,0,1,0,0,0,3,0,0,0,67,0,0,0,115,
-    32,0,0,0,124,0,106,0,100,1,117,0,114,13,124,0,
-    106,1,160,2,100,2,161,1,100,3,25,0,83,0,124,0,
-    106,1,83,0,41,4,122,32,84,104,101,32,110,97,109,101,
-    32,111,102,32,116,104,101,32,109,111,100,117,108,101,39,115,
-    32,112,97,114,101,110,116,46,78,218,1,46,114,25,0,0,
-    0,41,3,114,129,0,0,0,114,20,0,0,0,218,10,114,
-    112,97,114,116,105,116,105,111,110,114,52,0,0,0,114,5,
-    0,0,0,114,5,0,0,0,114,6,0,0,0,218,6,112,
-    97,114,101,110,116,148,1,0,0,115,8,0,0,0,10,3,
-    16,1,6,2,255,128,122,17,77,111,100,117,108,101,83,112,
-    101,99,46,112,97,114,101,110,116,99,1,0,0,0,0,0,
-    0,0,0,0,0,0,1,0,0,0,1,0,0,0,67,0,
-    0,0,115,6,0,0,0,124,0,106,0,83,0,114,0,0,
-    0,0,41,1,114,130,0,0,0,114,52,0,0,0,114,5,
-    0,0,0,114,5,0,0,0,114,6,0,0,0,114,136,0,
-    0,0,156,1,0,0,115,4,0,0,0,6,2,255,128,122,
-    23,77,111,100,117,108,101,83,112,101,99,46,104,97,115,95,
-    108,111,99,97,116,105,111,110,99,2,0,0,0,0,0,0,
-    0,0,0,0,0,2,0,0,0,2,0,0,0,67,0,0,
-    0,115,14,0,0,0,116,0,124,1,131,1,124,0,95,1,
-    100,0,83,0,114,0,0,0,0,41,2,218,4,98,111,111,
-    108,114,130,0,0,0,41,2,114,33,0,0,0,218,5,118,
-    97,108,117,101,114,5,0,0,0,114,5,0,0,0,114,6,
-    0,0,0,114,136,0,0,0,160,1,0,0,115,4,0,0,
-    0,14,2,255,128,41,12,114,9,0,0,0,114,8,0,0,
-    0,114,1,0,0,0,114,10,0,0,0,114,34,0,0,0,
-    114,53,0,0,0,114,138,0,0,0,218,8,112,114,111,112,
-    101,114,116,121,114,135,0,0,0,218,6,115,101,116,116,101,
-    114,114,143,0,0,0,114,136,0,0,0,114,5,0,0,0,
-    114,5,0,0,0,114,5,0,0,0,114,6,0,0,0,114,
-    125,0,0,0,64,1,0,0,115,36,0,0,0,8,0,4,
-    1,4,36,2,1,12,255,8,12,8,10,2,12,10,1,4,
-    8,10,1,2,3,10,1,2,7,10,1,4,3,14,1,255,
-    128,114,125,0,0,0,169,2,114,126,0,0,0,114,128,0,
-    0,0,99,2,0,0,0,0,0,0,0,2,0,0,0,6,
-    0,0,0,8,0,0,0,67,0,0,0,115,150,0,0,0,
-    116,0,124,1,100,1,131,2,114,37,116,1,100,2,117,0,
-    114,11,116,2,130,1,116,1,106,3,125,4,124,3,100,2,
-    117,0,114,24,124,4,124,0,124,1,100,3,141,2,83,0,
-    124,3,114,28,103,0,110,1,100,2,125,5,124,4,124,0,
-    124,1,124,5,100,4,141,3,83,0,124,3,100,2,117,0,
-    114,66,116,0,124,1,100,5,131,2,114,64,122,7,124,1,
-    160,4,124,0,161,1,125,3,87,0,110,12,4,0,116,5,
-    121,74,1,0,1,0,1,0,100,2,125,3,89,0,110,2,
-    100,6,125,3,116,6,124,0,124,1,124,2,124,3,100,7,
-    141,4,83,0,119,0,41,8,122,53,82,101,116,117,114,110,
-    32,97,32,109,111,100,117,108,101,32,115,112,101,99,32,98,
-    97,115,101,100,32,111,110,32,118,97,114,105,111,117,115,32,
-    108,111,97,100,101,114,32,109,101,116,104,111,100,115,46,90,
-    12,103,101,116,95,102,105,108,101,110,97,109,101,78,41,1,
-    114,122,0,0,0,41,2,114,122,0,0,0,114,129,0,0,
-    0,114,128,0,0,0,70,114,148,0,0,0,41,7,114,11,
-    0,0,0,114,139,0,0,0,114,140,0,0,0,218,23,115,
-    112,101,99,95,102,114,111,109,95,102,105,108,101,95,108,111,
-    99,97,116,105,111,110,114,128,0,0,0,114,87,0,0,0,
-    114,125,0,0,0,41,6,114,20,0,0,0,114,122,0,0,
-    0,114,126,0,0,0,114,128,0,0,0,114,149,0,0,0,
-    90,6,115,101,97,114,99,104,114,5,0,0,0,114,5,0,
-    0,0,114,6,0,0,0,114,104,0,0,0,165,1,0,0,
-    115,40,0,0,0,10,2,8,1,4,1,6,1,8,2,12,
-    1,12,1,6,1,2,1,6,255,8,3,10,1,2,1,14,
-    1,12,1,8,1,4,3,16,2,2,250,255,128,114,104,0,
-    0,0,99,3,0,0,0,0,0,0,0,0,0,0,0,8,
-    0,0,0,8,0,0,0,67,0,0,0,115,30,1,0,0,
-    122,5,124,0,106,0,125,3,87,0,110,8,4,0,116,1,
-    121,142,1,0,1,0,1,0,89,0,110,6,124,3,100,0,
-    117,1,114,20,124,3,83,0,124,0,106,2,125,4,124,1,
-    100,0,117,0,114,40,122,5,124,0,106,3,125,1,87,0,
-    110,7,4,0,116,1,121,141,1,0,1,0,1,0,89,0,
-    122,5,124,0,106,4,125,5,87,0,110,9,4,0,116,1,
-    121,140,1,0,1,0,1,0,100,0,125,5,89,0,124,2,
-    100,0,117,0,114,81,124,5,100,0,117,0,114,79,122,5,
-    124,1,106,5,125,2,87,0,110,12,4,0,116,1,121,139,
-    1,0,1,0,1,0,100,0,125,2,89,0,110,2,124,5,
-    125,2,122,5,124,0,106,6,125,6,87,0,110,9,4,0,
-    116,1,121,138,1,0,1,0,1,0,100,0,125,6,89,0,
-    122,7,116,7,124,0,106,8,131,1,125,7,87,0,110,9,
-    4,0,116,1,121,137,1,0,1,0,1,0,100,0,125,7,
-    89,0,116,9,124,4,124,1,124,2,100,1,141,3,125,3,
-    124,5,100,0,117,0,114,126,100,2,110,1,100,3,124,3,
-    95,10,124,6,124,3,95,11,124,7,124,3,95,12,124,3,
-    83,0,119,0,119,0,119,0,119,0,119,0,119,0,41,4,
-    78,169,1,114,126,0,0,0,70,84,41,13,114,113,0,0,
-    0,114,2,0,0,0,114,9,0,0,0,114,112,0,0,0,
-    114,121,0,0,0,218,7,95,79,82,73,71,73,78,218,10,
-    95,95,99,97,99,104,101,100,95,95,218,4,108,105,115,116,
-    218,8,95,95,112,97,116,104,95,95,114,125,0,0,0,114,
-    130,0,0,0,114,135,0,0,0,114,129,0,0,0,41,8,
-    114,110,0,0,0,114,122,0,0,0,114,126,0,0,0,114,
-    109,0,0,0,114,20,0,0,0,90,8,108,111,99,97,116,
-    105,111,110,114,135,0,0,0,114,129,0,0,0,114,5,0,
-    0,0,114,5,0,0,0,114,6,0,0,0,218,17,95,115,
-    112,101,99,95,102,114,111,109,95,109,111,100,117,108,101,191,
-    1,0,0,115,86,0,0,0,2,2,10,1,12,1,4,1,
-    8,2,4,1,6,2,8,1,2,1,10,1,12,1,2,2,
-    2,1,10,1,12,1,6,1,8,1,8,1,2,1,10,1,
-    12,1,8,1,4,2,2,1,10,1,12,1,6,1,2,1,
-    14,1,12,1,6,1,14,2,18,1,6,1,6,1,4,1,
-    2,249,2,252,2,250,2,250,2,251,2,246,255,128,114,155,
-    0,0,0,70,169,1,218,8,111,118,101,114,114,105,100,101,
-    99,2,0,0,0,0,0,0,0,1,0,0,0,5,0,0,
-    0,8,0,0,0,67,0,0,0,115,178,1,0,0,124,2,
-    115,10,116,0,124,1,100,1,100,0,131,3,100,0,117,0,
-    114,24,122,6,124,0,106,1,124,1,95,2,87,0,110,7,
-    4,0,116,3,121,216,1,0,1,0,1,0,89,0,124,2,
-    115,34,116,0,124,1,100,2,100,0,131,3,100,0,117,0,
-    114,83,124,0,106,4,125,3,124,3,100,0,117,0,114,70,
-    124,0,106,5,100,0,117,1,114,70,116,6,100,0,117,0,
-    114,52,116,7,130,1,116,6,106,8,125,4,124,4,160,9,
-    124,4,161,1,125,3,124,0,106,5,124,3,95,10,124,3,
-    124,0,95,4,100,0,124,1,95,11,122,5,124,3,124,1,
-    95,12,87,0,110,7,4,0,116,3,121,215,1,0,1,0,
-    1,0,89,0,124,2,115,93,116,0,124,1,100,3,100,0,
-    131,3,100,0,117,0,114,107,122,6,124,0,106,13,124,1,
-    95,14,87,0,110,7,4,0,116,3,121,214,1,0,1,0,
-    1,0,89,0,122,5,124,0,124,1,95,15,87,0,110,7,
-    4,0,116,3,121,213,1,0,1,0,1,0,89,0,124,2,
-    115,130,116,0,124,1,100,4,100,0,131,3,100,0,117,0,
-    114,149,124,0,106,5,100,0,117,1,114,149,122,6,124,0,
-    106,5,124,1,95,16,87,0,110,7,4,0,116,3,121,212,
-    1,0,1,0,1,0,89,0,124,0,106,17,114,208,124,2,
-    115,162,116,0,124,1,100,5,100,0,131,3,100,0,117,0,
-    114,176,122,6,124,0,106,18,124,1,95,11,87,0,110,7,
-    4,0,116,3,121,211,1,0,1,0,1,0,89,0,124,2,
-    115,186,116,0,124,1,100,6,100,0,131,3,100,0,117,0,
-    114,208,124,0,106,19,100,0,117,1,114,208,122,7,124,0,
-    106,19,124,1,95,20,87,0,124,1,83,0,4,0,116,3,
-    121,210,1,0,1,0,1,0,89,0,124,1,83,0,124,1,
-    83,0,119,0,119,0,119,0,119,0,119,0,119,0,119,0,
-    41,7,78,114,9,0,0,0,114,112,0,0,0,218,11,95,
-    95,112,97,99,107,97,103,101,95,95,114,154,0,0,0,114,
-    121,0,0,0,114,152,0,0,0,41,21,114,13,0,0,0,
-    114,20,0,0,0,114,9,0,0,0,114,2,0,0,0,114,
-    122,0,0,0,114,129,0,0,0,114,139,0,0,0,114,140,
-    0,0,0,218,16,95,78,97,109,101,115,112,97,99,101,76,
-    111,97,100,101,114,218,7,95,95,110,101,119,95,95,90,5,
-    95,112,97,116,104,114,121,0,0,0,114,112,0,0,0,114,
-    143,0,0,0,114,158,0,0,0,114,113,0,0,0,114,154,
-    0,0,0,114,136,0,0,0,114,126,0,0,0,114,135,0,
-    0,0,114,152,0,0,0,41,5,114,109,0,0,0,114,110,
-    0,0,0,114,157,0,0,0,114,122,0,0,0,114,159,0,
-    0,0,114,5,0,0,0,114,5,0,0,0,114,6,0,0,
-    0,218,18,95,105,110,105,116,95,109,111,100,117,108,101,95,
-    97,116,116,114,115,236,1,0,0,115,114,0,0,0,20,4,
-    2,1,12,1,12,1,2,1,20,2,6,1,8,1,10,2,
-    8,1,4,1,6,1,10,2,8,1,6,1,6,11,2,1,
-    10,1,12,1,2,1,20,2,2,1,12,1,12,1,2,1,
-    2,2,10,1,12,1,2,1,20,2,10,1,2,1,12,1,
-    12,1,2,1,6,2,20,1,2,1,12,1,12,1,2,1,
-    20,2,10,1,2,1,10,1,4,3,12,254,2,1,8,1,
-    2,254,2,249,2,249,2,249,2,251,2,250,2,228,255,128,
-    114,161,0,0,0,99,1,0,0,0,0,0,0,0,0,0,
-    0,0,2,0,0,0,3,0,0,0,67,0,0,0,115,82,
-    0,0,0,100,1,125,1,116,0,124,0,106,1,100,2,131,
-    2,114,15,124,0,106,1,160,2,124,0,161,1,125,1,110,
-    10,116,0,124,0,106,1,100,3,131,2,114,25,116,3,100,
-    4,131,1,130,1,124,1,100,1,117,0,114,34,116,4,124,
-    0,106,5,131,1,125,1,116,6,124,0,124,1,131,2,1,
-    0,124,1,83,0,41,5,122,43,67,114,101,97,116,101,32,
-    97,32,109,111,100,117,108,101,32,98,97,115,101,100,32,111,
-    110,32,116,104,101,32,112,114,111,118,105,100,101,100,32,115,
-    112,101,99,46,78,218,13,99,114,101,97,116,101,95,109,111,
-    100,117,108,101,218,11,101,120,101,99,95,109,111,100,117,108,
-    101,122,66,108,111,97,100,101,114,115,32,116,104,97,116,32,
-    100,101,102,105,110,101,32,101,120,101,99,95,109,111,100,117,
-    108,101,40,41,32,109,117,115,116,32,97,108,115,111,32,100,
-    101,102,105,110,101,32,99,114,101,97,116,101,95,109,111,100,
-    117,108,101,40,41,41,7,114,11,0,0,0,114,122,0,0,
-    0,114,162,0,0,0,114,87,0,0,0,114,21,0,0,0,
-    114,20,0,0,0,114,161,0,0,0,169,2,114,109,0,0,
-    0,114,110,0,0,0,114,5,0,0,0,114,5,0,0,0,
-    114,6,0,0,0,218,16,109,111,100,117,108,101,95,102,114,
-    111,109,95,115,112,101,99,52,2,0,0,115,20,0,0,0,
-    4,3,12,1,14,3,12,1,8,1,8,2,10,1,10,1,
-    4,1,255,128,114,165,0,0,0,99,1,0,0,0,0,0,
-    0,0,0,0,0,0,2,0,0,0,4,0,0,0,67,0,
-    0,0,115,100,0,0,0,124,0,106,0,100,1,117,0,114,
-    7,100,2,110,2,124,0,106,0,125,1,124,0,106,1,100,
-    1,117,0,114,32,124,0,106,2,100,1,117,0,114,25,100,
-    3,160,3,124,1,161,1,83,0,100,4,160,3,124,1,124,
-    0,106,2,161,2,83,0,124,0,106,4,114,42,100,5,160,
-    3,124,1,124,0,106,1,161,2,83,0,100,6,160,3,124,
-    0,106,0,124,0,106,1,161,2,83,0,41,7,122,38,82,
-    101,116,117,114,110,32,116,104,101,32,114,101,112,114,32,116,
-    111,32,117,115,101,32,102,111,114,32,116,104,101,32,109,111,
-    100,117,108,101,46,78,114,115,0,0,0,114,116,0,0,0,
-    114,117,0,0,0,114,118,0,0,0,250,18,60,109,111,100,
-    117,108,101,32,123,33,114,125,32,40,123,125,41,62,41,5,
-    114,20,0,0,0,114,126,0,0,0,114,122,0,0,0,114,
-    50,0,0,0,114,136,0,0,0,41,2,114,109,0,0,0,
-    114,20,0,0,0,114,5,0,0,0,114,5,0,0,0,114,
-    6,0,0,0,114,119,0,0,0,69,2,0,0,115,18,0,
-    0,0,20,3,10,1,10,1,10,1,14,2,6,2,14,1,
-    16,2,255,128,114,119,0,0,0,99,2,0,0,0,0,0,
-    0,0,0,0,0,0,4,0,0,0,10,0,0,0,67,0,
-    0,0,115,24,1,0,0,124,0,106,0,125,2,116,1,124,
-    2,131,1,143,123,1,0,116,2,106,3,160,4,124,2,161,
-    1,124,1,117,1,114,27,100,1,160,5,124,2,161,1,125,
-    3,116,6,124,3,124,2,100,2,141,2,130,1,122,80,124,
-    0,106,7,100,3,117,0,114,53,124,0,106,8,100,3,117,
-    0,114,45,116,6,100,4,124,0,106,0,100,2,141,2,130,
-    1,116,9,124,0,124,1,100,5,100,6,141,3,1,0,110,
-    40,116,9,124,0,124,1,100,5,100,6,141,3,1,0,116,
-    10,124,0,106,7,100,7,131,2,115,87,116,11,124,0,106,
-    7,131,1,155,0,100,8,157,2,125,3,116,12,160,13,124,
-    3,116,14,161,2,1,0,124,0,106,7,160,15,124,2,161,
-    1,1,0,110,6,124,0,106,7,160,16,124,1,161,1,1,
-    0,87,0,116,2,106,3,160,17,124,0,106,0,161,1,125,
-    1,124,1,116,2,106,3,124,0,106,0,60,0,110,14,116,
-    2,106,3,160,17,124,0,106,0,161,1,125,1,124,1,116,
-    2,106,3,124,0,106,0,60,0,119,0,87,0,100,3,4,
-    0,4,0,131,3,1,0,124,1,83,0,49,0,115,133,119,
-    1,1,0,1,0,1,0,89,0,1,0,124,1,83,0,41,
-    9,122,70,69,120,101,99,117,116,101,32,116,104,101,32,115,
-    112,101,99,39,115,32,115,112,101,99,105,102,105,101,100,32,
-    109,111,100,117,108,101,32,105,110,32,97,110,32,101,120,105,
-    115,116,105,110,103,32,109,111,100,117,108,101,39,115,32,110,
-    97,109,101,115,112,97,99,101,46,122,30,109,111,100,117,108,
-    101,32,123,33,114,125,32,110,111,116,32,105,110,32,115,121,
-    115,46,109,111,100,117,108,101,115,114,19,0,0,0,78,250,
-    14,109,105,115,115,105,110,103,32,108,111,97,100,101,114,84,
-    114,156,0,0,0,114,163,0,0,0,250,55,46,101,120,101,
-    99,95,109,111,100,117,108,101,40,41,32,110,111,116,32,102,
-    111,117,110,100,59,32,102,97,108,108,105,110,103,32,98,97,
-    99,107,32,116,111,32,108,111,97,100,95,109,111,100,117,108,
-    101,40,41,41,18,114,20,0,0,0,114,57,0,0,0,114,
-    18,0,0,0,114,105,0,0,0,114,38,0,0,0,114,50,
-    0,0,0,114,87,0,0,0,114,122,0,0,0,114,129,0,
-    0,0,114,161,0,0,0,114,11,0,0,0,114,7,0,0,
-    0,114,101,0,0,0,114,102,0,0,0,218,13,73,109,112,
-    111,114,116,87,97,114,110,105,110,103,218,11,108,111,97,100,
-    95,109,111,100,117,108,101,114,163,0,0,0,218,3,112,111,
-    112,41,4,114,109,0,0,0,114,110,0,0,0,114,20,0,
-    0,0,114,108,0,0,0,114,5,0,0,0,114,5,0,0,
-    0,114,6,0,0,0,114,106,0,0,0,86,2,0,0,115,
-    50,0,0,0,6,2,10,1,16,1,10,1,12,1,2,1,
-    10,1,10,1,14,1,16,2,14,2,12,1,16,1,12,2,
-    14,1,12,2,2,128,14,4,14,1,14,255,26,1,4,1,
-    16,128,4,0,255,128,114,106,0,0,0,99,1,0,0,0,
-    0,0,0,0,0,0,0,0,2,0,0,0,8,0,0,0,
-    67,0,0,0,115,10,1,0,0,122,9,124,0,106,0,160,
-    1,124,0,106,2,161,1,1,0,87,0,110,23,1,0,1,
-    0,1,0,124,0,106,2,116,3,106,4,118,0,114,32,116,
-    3,106,4,160,5,124,0,106,2,161,1,125,1,124,1,116,
-    3,106,4,124,0,106,2,60,0,130,0,116,3,106,4,160,
-    5,124,0,106,2,161,1,125,1,124,1,116,3,106,4,124,
-    0,106,2,60,0,116,6,124,1,100,1,100,0,131,3,100,
-    0,117,0,114,68,122,6,124,0,106,0,124,1,95,7,87,
-    0,110,7,4,0,116,8,121,132,1,0,1,0,1,0,89,
-    0,116,6,124,1,100,2,100,0,131,3,100,0,117,0,114,
-    104,122,20,124,1,106,9,124,1,95,10,116,11,124,1,100,
-    3,131,2,115,95,124,0,106,2,160,12,100,4,161,1,100,
-    5,25,0,124,1,95,10,87,0,110,7,4,0,116,8,121,
-    131,1,0,1,0,1,0,89,0,116,6,124,1,100,6,100,
-    0,131,3,100,0,117,0,114,128,122,6,124,0,124,1,95,
-    13,87,0,124,1,83,0,4,0,116,8,121,130,1,0,1,
-    0,1,0,89,0,124,1,83,0,124,1,83,0,119,0,119,
-    0,119,0,41,7,78,114,112,0,0,0,114,158,0,0,0,
-    114,154,0,0,0,114,141,0,0,0,114,25,0,0,0,114,
-    113,0,0,0,41,14,114,122,0,0,0,114,170,0,0,0,
-    114,20,0,0,0,114,18,0,0,0,114,105,0,0,0,114,
-    171,0,0,0,114,13,0,0,0,114,112,0,0,0,114,2,
-    0,0,0,114,9,0,0,0,114,158,0,0,0,114,11,0,
-    0,0,114,142,0,0,0,114,113,0,0,0,114,164,0,0,
-    0,114,5,0,0,0,114,5,0,0,0,114,6,0,0,0,
-    218,25,95,108,111,97,100,95,98,97,99,107,119,97,114,100,
-    95,99,111,109,112,97,116,105,98,108,101,116,2,0,0,115,
-    66,0,0,0,2,3,18,1,6,1,12,1,14,1,12,1,
-    2,1,14,3,12,1,16,1,2,1,12,1,12,1,2,1,
-    16,1,2,1,8,4,10,1,18,1,4,128,12,1,2,1,
-    16,1,2,1,8,1,4,3,12,254,2,1,8,1,2,254,
-    2,251,2,246,255,128,114,172,0,0,0,99,1,0,0,0,
-    0,0,0,0,0,0,0,0,3,0,0,0,11,0,0,0,
-    67,0,0,0,115,242,0,0,0,124,0,106,0,100,0,117,
-    1,114,29,116,1,124,0,106,0,100,1,131,2,115,29,116,
-    2,124,0,106,0,131,1,155,0,100,2,157,2,125,1,116,
-    3,160,4,124,1,116,5,161,2,1,0,116,6,124,0,131,
-    1,83,0,116,7,124,0,131,1,125,2,100,3,124,0,95,
-    8,122,79,124,2,116,9,106,10,124,0,106,11,60,0,122,
-    26,124,0,106,0,100,0,117,0,114,62,124,0,106,12,100,
-    0,117,0,114,61,116,13,100,4,124,0,106,11,100,5,141,
-    2,130,1,110,6,124,0,106,0,160,14,124,2,161,1,1,
-    0,87,0,110,19,1,0,1,0,1,0,122,7,116,9,106,
-    10,124,0,106,11,61,0,87,0,130,0,4,0,116,15,121,
-    120,1,0,1,0,1,0,89,0,130,0,116,9,106,10,160,
-    16,124,0,106,11,161,1,125,2,124,2,116,9,106,10,124,
-    0,106,11,60,0,116,17,100,6,124,0,106,11,124,0,106,
-    0,131,3,1,0,87,0,100,7,124,0,95,8,124,2,83,
-    0,100,7,124,0,95,8,119,0,119,0,41,8,78,114,163,
-    0,0,0,114,168,0,0,0,84,114,167,0,0,0,114,19,
-    0,0,0,122,18,105,109,112,111,114,116,32,123,33,114,125,
-    32,35,32,123,33,114,125,70,41,18,114,122,0,0,0,114,
-    11,0,0,0,114,7,0,0,0,114,101,0,0,0,114,102,
-    0,0,0,114,169,0,0,0,114,172,0,0,0,114,165,0,
-    0,0,90,13,95,105,110,105,116,105,97,108,105,122,105,110,
-    103,114,18,0,0,0,114,105,0,0,0,114,20,0,0,0,
-    114,129,0,0,0,114,87,0,0,0,114,163,0,0,0,114,
-    70,0,0,0,114,171,0,0,0,114,83,0,0,0,41,3,
-    114,109,0,0,0,114,108,0,0,0,114,110,0,0,0,114,
-    5,0,0,0,114,5,0,0,0,114,6,0,0,0,218,14,
-    95,108,111,97,100,95,117,110,108,111,99,107,101,100,152,2,
-    0,0,115,62,0,0,0,10,2,12,2,16,1,12,2,8,
-    1,8,2,6,5,2,1,12,1,2,1,10,1,10,1,14,
-    1,2,255,12,4,4,128,6,1,2,1,12,1,2,3,12,
-    254,2,1,2,1,14,5,12,1,18,1,6,2,4,2,8,
-    254,2,245,255,128,114,173,0,0,0,99,1,0,0,0,0,
-    0,0,0,0,0,0,0,1,0,0,0,8,0,0,0,67,
-    0,0,0,115,54,0,0,0,116,0,124,0,106,1,131,1,
-    143,12,1,0,116,2,124,0,131,1,87,0,2,0,100,1,
-    4,0,4,0,131,3,1,0,83,0,49,0,115,20,119,1,
-    1,0,1,0,1,0,89,0,1,0,100,1,83,0,41,2,
-    122,191,82,101,116,117,114,110,32,97,32,110,101,119,32,109,
+    111,99,97,116,105,111,110,115,3,13,95,115,101,116,95,102,
+    105,108,101,97,116,116,114,3,7,95,99,97,99,104,101,100,
+    2,19,77,111,100,117,108,101,83,112,101,99,46,95,95,105,
+    110,105,116,95,95,2,9,110,97,109,101,61,123,33,114,125,
+    2,11,108,111,97,100,101,114,61,123,33,114,125,2,11,111,
+    114,105,103,105,110,61,123,33,114,125,2,29,115,117,98,109,
+    111,100,117,108,101,95,115,101,97,114,99,104,95,108,111,99,
+    97,116,105,111,110,115,61,123,125,2,6,123,125,40,123,125,
+    41,2,2,44,32,3,6,97,112,112,101,110,100,3,9,95,
+    95,99,108,97,115,115,95,95,3,4,106,111,105,110,2,19,
+    77,111,100,117,108,101,83,112,101,99,46,95,95,114,101,112,
+    114,95,95,3,6,99,97,99,104,101,100,3,12,104,97,115,
+    95,108,111,99,97,116,105,111,110,3,14,78,111,116,73,109,
+    112,108,101,109,101,110,116,101,100,3,5,111,116,104,101,114,
+    3,4,115,109,115,108,3,6,95,95,101,113,95,95,2,17,
+    77,111,100,117,108,101,83,112,101,99,46,95,95,101,113,95,
+    95,3,19,95,98,111,111,116,115,116,114,97,112,95,101,120,
+    116,101,114,110,97,108,3,19,78,111,116,73,109,112,108,101,
+    109,101,110,116,101,100,69,114,114,111,114,3,11,95,103,101,
+    116,95,99,97,99,104,101,100,2,17,77,111,100,117,108,101,
+    83,112,101,99,46,99,97,99,104,101,100,2,32,84,104,101,
+    32,110,97,109,101,32,111,102,32,116,104,101,32,109,111,100,
+    117,108,101,39,115,32,112,97,114,101,110,116,46,3,1,46,
+    3,10,114,112,97,114,116,105,116,105,111,110,3,6,112,97,
+    114,101,110,116,2,17,77,111,100,117,108,101,83,112,101,99,
+    46,112,97,114,101,110,116,2,23,77,111,100,117,108,101,83,
+    112,101,99,46,104,97,115,95,108,111,99,97,116,105,111,110,
+    3,4,98,111,111,108,3,5,118,97,108,117,101,3,8,112,
+    114,111,112,101,114,116,121,3,6,115,101,116,116,101,114,2,
+    53,82,101,116,117,114,110,32,97,32,109,111,100,117,108,101,
+    32,115,112,101,99,32,98,97,115,101,100,32,111,110,32,118,
+    97,114,105,111,117,115,32,108,111,97,100,101,114,32,109,101,
+    116,104,111,100,115,46,3,12,103,101,116,95,102,105,108,101,
+    110,97,109,101,3,23,115,112,101,99,95,102,114,111,109,95,
+    102,105,108,101,95,108,111,99,97,116,105,111,110,3,6,115,
+    101,97,114,99,104,3,7,95,79,82,73,71,73,78,3,10,
+    95,95,99,97,99,104,101,100,95,95,3,4,108,105,115,116,
+    3,8,95,95,112,97,116,104,95,95,3,8,108,111,99,97,
+    116,105,111,110,3,17,95,115,112,101,99,95,102,114,111,109,
+    95,109,111,100,117,108,101,3,8,111,118,101,114,114,105,100,
+    101,3,11,95,95,112,97,99,107,97,103,101,95,95,3,16,
+    95,78,97,109,101,115,112,97,99,101,76,111,97,100,101,114,
+    3,7,95,95,110,101,119,95,95,3,5,95,112,97,116,104,
+    3,18,95,105,110,105,116,95,109,111,100,117,108,101,95,97,
+    116,116,114,115,2,43,67,114,101,97,116,101,32,97,32,109,
+    111,100,117,108,101,32,98,97,115,101,100,32,111,110,32,116,
+    104,101,32,112,114,111,118,105,100,101,100,32,115,112,101,99,
+    46,3,13,99,114,101,97,116,101,95,109,111,100,117,108,101,
+    3,11,101,120,101,99,95,109,111,100,117,108,101,2,66,108,
+    111,97,100,101,114,115,32,116,104,97,116,32,100,101,102,105,
+    110,101,32,101,120,101,99,95,109,111,100,117,108,101,40,41,
+    32,109,117,115,116,32,97,108,115,111,32,100,101,102,105,110,
+    101,32,99,114,101,97,116,101,95,109,111,100,117,108,101,40,
+    41,3,16,109,111,100,117,108,101,95,102,114,111,109,95,115,
+    112,101,99,2,38,82,101,116,117,114,110,32,116,104,101,32,
+    114,101,112,114,32,116,111,32,117,115,101,32,102,111,114,32,
+    116,104,101,32,109,111,100,117,108,101,46,2,18,60,109,111,
+    100,117,108,101,32,123,33,114,125,32,40,123,125,41,62,2,
+    70,69,120,101,99,117,116,101,32,116,104,101,32,115,112,101,
+    99,39,115,32,115,112,101,99,105,102,105,101,100,32,109,111,
+    100,117,108,101,32,105,110,32,97,110,32,101,120,105,115,116,
+    105,110,103,32,109,111,100,117,108,101,39,115,32,110,97,109,
+    101,115,112,97,99,101,46,2,30,109,111,100,117,108,101,32,
+    123,33,114,125,32,110,111,116,32,105,110,32,115,121,115,46,
+    109,111,100,117,108,101,115,2,14,109,105,115,115,105,110,103,
+    32,108,111,97,100,101,114,2,55,46,101,120,101,99,95,109,
+    111,100,117,108,101,40,41,32,110,111,116,32,102,111,117,110,
+    100,59,32,102,97,108,108,105,110,103,32,98,97,99,107,32,
+    116,111,32,108,111,97,100,95,109,111,100,117,108,101,40,41,
+    3,13,73,109,112,111,114,116,87,97,114,110,105,110,103,3,
+    11,108,111,97,100,95,109,111,100,117,108,101,3,3,112,111,
+    112,3,25,95,108,111,97,100,95,98,97,99,107,119,97,114,
+    100,95,99,111,109,112,97,116,105,98,108,101,2,18,105,109,
+    112,111,114,116,32,123,33,114,125,32,35,32,123,33,114,125,
+    3,13,95,105,110,105,116,105,97,108,105,122,105,110,103,3,
+    14,95,108,111,97,100,95,117,110,108,111,99,107,101,100,2,
+    191,1,82,101,116,117,114,110,32,97,32,110,101,119,32,109,
     111,100,117,108,101,32,111,98,106,101,99,116,44,32,108,111,
     97,100,101,100,32,98,121,32,116,104,101,32,115,112,101,99,
     39,115,32,108,111,97,100,101,114,46,10,10,32,32,32,32,
@@ -1062,36 +421,17 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     115,44,32,116,104,97,116,32,101,120,105,115,116,105,110,103,
     32,109,111,100,117,108,101,32,103,101,116,115,10,32,32,32,
     32,99,108,111,98,98,101,114,101,100,46,10,10,32,32,32,
-    32,78,41,3,114,57,0,0,0,114,20,0,0,0,114,173,
-    0,0,0,169,1,114,109,0,0,0,114,5,0,0,0,114,
-    5,0,0,0,114,6,0,0,0,114,107,0,0,0,197,2,
-    0,0,115,8,0,0,0,12,9,22,1,20,128,255,128,114,
-    107,0,0,0,99,0,0,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,4,0,0,0,64,0,0,0,115,140,0,
-    0,0,101,0,90,1,100,0,90,2,100,1,90,3,100,2,
-    90,4,101,5,100,3,100,4,132,0,131,1,90,6,101,7,
-    100,20,100,6,100,7,132,1,131,1,90,8,101,7,100,21,
-    100,8,100,9,132,1,131,1,90,9,101,5,100,10,100,11,
-    132,0,131,1,90,10,101,5,100,12,100,13,132,0,131,1,
-    90,11,101,7,101,12,100,14,100,15,132,0,131,1,131,1,
-    90,13,101,7,101,12,100,16,100,17,132,0,131,1,131,1,
-    90,14,101,7,101,12,100,18,100,19,132,0,131,1,131,1,
-    90,15,101,7,101,16,131,1,90,17,100,5,83,0,41,22,
-    218,15,66,117,105,108,116,105,110,73,109,112,111,114,116,101,
-    114,122,144,77,101,116,97,32,112,97,116,104,32,105,109,112,
-    111,114,116,32,102,111,114,32,98,117,105,108,116,45,105,110,
-    32,109,111,100,117,108,101,115,46,10,10,32,32,32,32,65,
-    108,108,32,109,101,116,104,111,100,115,32,97,114,101,32,101,
-    105,116,104,101,114,32,99,108,97,115,115,32,111,114,32,115,
-    116,97,116,105,99,32,109,101,116,104,111,100,115,32,116,111,
-    32,97,118,111,105,100,32,116,104,101,32,110,101,101,100,32,
-    116,111,10,32,32,32,32,105,110,115,116,97,110,116,105,97,
-    116,101,32,116,104,101,32,99,108,97,115,115,46,10,10,32,
-    32,32,32,122,8,98,117,105,108,116,45,105,110,99,1,0,
-    0,0,0,0,0,0,0,0,0,0,1,0,0,0,5,0,
-    0,0,67,0,0,0,115,34,0,0,0,116,0,160,1,100,
-    1,116,2,161,2,1,0,100,2,124,0,106,3,155,2,100,
-    3,116,4,106,5,155,0,100,4,157,5,83,0,41,6,250,
+    32,3,15,66,117,105,108,116,105,110,73,109,112,111,114,116,
+    101,114,2,144,1,77,101,116,97,32,112,97,116,104,32,105,
+    109,112,111,114,116,32,102,111,114,32,98,117,105,108,116,45,
+    105,110,32,109,111,100,117,108,101,115,46,10,10,32,32,32,
+    32,65,108,108,32,109,101,116,104,111,100,115,32,97,114,101,
+    32,101,105,116,104,101,114,32,99,108,97,115,115,32,111,114,
+    32,115,116,97,116,105,99,32,109,101,116,104,111,100,115,32,
+    116,111,32,97,118,111,105,100,32,116,104,101,32,110,101,101,
+    100,32,116,111,10,32,32,32,32,105,110,115,116,97,110,116,
+    105,97,116,101,32,116,104,101,32,99,108,97,115,115,46,10,
+    10,32,32,32,32,2,8,98,117,105,108,116,45,105,110,2,
     115,82,101,116,117,114,110,32,114,101,112,114,32,102,111,114,
     32,116,104,101,32,109,111,100,117,108,101,46,10,10,32,32,
     32,32,32,32,32,32,84,104,101,32,109,101,116,104,111,100,
@@ -1099,529 +439,1113 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     32,84,104,101,32,105,109,112,111,114,116,32,109,97,99,104,
     105,110,101,114,121,32,100,111,101,115,32,116,104,101,32,106,
     111,98,32,105,116,115,101,108,102,46,10,10,32,32,32,32,
-    32,32,32,32,122,81,66,117,105,108,116,105,110,73,109,112,
+    32,32,32,32,2,81,66,117,105,108,116,105,110,73,109,112,
     111,114,116,101,114,46,109,111,100,117,108,101,95,114,101,112,
     114,40,41,32,105,115,32,100,101,112,114,101,99,97,116,101,
     100,32,97,110,100,32,115,108,97,116,101,100,32,102,111,114,
     32,114,101,109,111,118,97,108,32,105,110,32,80,121,116,104,
-    111,110,32,51,46,49,50,122,8,60,109,111,100,117,108,101,
-    32,122,2,32,40,122,2,41,62,78,41,6,114,101,0,0,
-    0,114,102,0,0,0,114,103,0,0,0,114,9,0,0,0,
-    114,175,0,0,0,114,151,0,0,0,169,1,114,110,0,0,
-    0,114,5,0,0,0,114,5,0,0,0,114,6,0,0,0,
-    114,114,0,0,0,223,2,0,0,115,10,0,0,0,6,7,
-    2,1,4,255,22,2,255,128,122,27,66,117,105,108,116,105,
-    110,73,109,112,111,114,116,101,114,46,109,111,100,117,108,101,
-    95,114,101,112,114,78,99,4,0,0,0,0,0,0,0,0,
-    0,0,0,4,0,0,0,5,0,0,0,67,0,0,0,115,
-    42,0,0,0,124,2,100,0,117,1,114,6,100,0,83,0,
-    116,0,160,1,124,1,161,1,114,19,116,2,124,1,124,0,
-    124,0,106,3,100,1,141,3,83,0,100,0,83,0,169,2,
-    78,114,150,0,0,0,41,4,114,64,0,0,0,90,10,105,
-    115,95,98,117,105,108,116,105,110,114,104,0,0,0,114,151,
-    0,0,0,169,4,218,3,99,108,115,114,89,0,0,0,218,
-    4,112,97,116,104,218,6,116,97,114,103,101,116,114,5,0,
-    0,0,114,5,0,0,0,114,6,0,0,0,218,9,102,105,
-    110,100,95,115,112,101,99,234,2,0,0,115,12,0,0,0,
-    8,2,4,1,10,1,16,1,4,2,255,128,122,25,66,117,
-    105,108,116,105,110,73,109,112,111,114,116,101,114,46,102,105,
-    110,100,95,115,112,101,99,99,3,0,0,0,0,0,0,0,
-    0,0,0,0,4,0,0,0,4,0,0,0,67,0,0,0,
-    115,42,0,0,0,116,0,160,1,100,1,116,2,161,2,1,
-    0,124,0,160,3,124,1,124,2,161,2,125,3,124,3,100,
-    2,117,1,114,19,124,3,106,4,83,0,100,2,83,0,41,
-    3,122,175,70,105,110,100,32,116,104,101,32,98,117,105,108,
-    116,45,105,110,32,109,111,100,117,108,101,46,10,10,32,32,
-    32,32,32,32,32,32,73,102,32,39,112,97,116,104,39,32,
-    105,115,32,101,118,101,114,32,115,112,101,99,105,102,105,101,
-    100,32,116,104,101,110,32,116,104,101,32,115,101,97,114,99,
-    104,32,105,115,32,99,111,110,115,105,100,101,114,101,100,32,
-    97,32,102,97,105,108,117,114,101,46,10,10,32,32,32,32,
-    32,32,32,32,84,104,105,115,32,109,101,116,104,111,100,32,
-    105,115,32,100,101,112,114,101,99,97,116,101,100,46,32,32,
-    85,115,101,32,102,105,110,100,95,115,112,101,99,40,41,32,
-    105,110,115,116,101,97,100,46,10,10,32,32,32,32,32,32,
-    32,32,122,106,66,117,105,108,116,105,110,73,109,112,111,114,
-    116,101,114,46,102,105,110,100,95,109,111,100,117,108,101,40,
-    41,32,105,115,32,100,101,112,114,101,99,97,116,101,100,32,
-    97,110,100,32,115,108,97,116,101,100,32,102,111,114,32,114,
-    101,109,111,118,97,108,32,105,110,32,80,121,116,104,111,110,
-    32,51,46,49,50,59,32,117,115,101,32,102,105,110,100,95,
-    115,112,101,99,40,41,32,105,110,115,116,101,97,100,78,41,
-    5,114,101,0,0,0,114,102,0,0,0,114,103,0,0,0,
-    114,183,0,0,0,114,122,0,0,0,41,4,114,180,0,0,
-    0,114,89,0,0,0,114,181,0,0,0,114,109,0,0,0,
-    114,5,0,0,0,114,5,0,0,0,114,6,0,0,0,218,
-    11,102,105,110,100,95,109,111,100,117,108,101,243,2,0,0,
-    115,12,0,0,0,6,9,2,2,4,254,12,3,18,1,255,
-    128,122,27,66,117,105,108,116,105,110,73,109,112,111,114,116,
-    101,114,46,102,105,110,100,95,109,111,100,117,108,101,99,1,
-    0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,4,
-    0,0,0,67,0,0,0,115,46,0,0,0,124,0,106,0,
-    116,1,106,2,118,1,114,17,116,3,100,1,160,4,124,0,
-    106,0,161,1,124,0,106,0,100,2,141,2,130,1,116,5,
-    116,6,106,7,124,0,131,2,83,0,41,4,122,24,67,114,
-    101,97,116,101,32,97,32,98,117,105,108,116,45,105,110,32,
-    109,111,100,117,108,101,114,85,0,0,0,114,19,0,0,0,
-    78,41,8,114,20,0,0,0,114,18,0,0,0,114,86,0,
-    0,0,114,87,0,0,0,114,50,0,0,0,114,74,0,0,
-    0,114,64,0,0,0,90,14,99,114,101,97,116,101,95,98,
-    117,105,108,116,105,110,114,174,0,0,0,114,5,0,0,0,
-    114,5,0,0,0,114,6,0,0,0,114,162,0,0,0,2,
-    3,0,0,115,12,0,0,0,12,3,12,1,4,1,6,255,
-    12,2,255,128,122,29,66,117,105,108,116,105,110,73,109,112,
-    111,114,116,101,114,46,99,114,101,97,116,101,95,109,111,100,
-    117,108,101,99,1,0,0,0,0,0,0,0,0,0,0,0,
-    1,0,0,0,3,0,0,0,67,0,0,0,115,16,0,0,
-    0,116,0,116,1,106,2,124,0,131,2,1,0,100,1,83,
-    0,41,2,122,22,69,120,101,99,32,97,32,98,117,105,108,
-    116,45,105,110,32,109,111,100,117,108,101,78,41,3,114,74,
-    0,0,0,114,64,0,0,0,90,12,101,120,101,99,95,98,
-    117,105,108,116,105,110,114,177,0,0,0,114,5,0,0,0,
-    114,5,0,0,0,114,6,0,0,0,114,163,0,0,0,10,
-    3,0,0,115,4,0,0,0,16,3,255,128,122,27,66,117,
-    105,108,116,105,110,73,109,112,111,114,116,101,114,46,101,120,
-    101,99,95,109,111,100,117,108,101,99,2,0,0,0,0,0,
-    0,0,0,0,0,0,2,0,0,0,1,0,0,0,67,0,
-    0,0,243,4,0,0,0,100,1,83,0,41,2,122,57,82,
-    101,116,117,114,110,32,78,111,110,101,32,97,115,32,98,117,
-    105,108,116,45,105,110,32,109,111,100,117,108,101,115,32,100,
-    111,32,110,111,116,32,104,97,118,101,32,99,111,100,101,32,
-    111,98,106,101,99,116,115,46,78,114,5,0,0,0,169,2,
-    114,180,0,0,0,114,89,0,0,0,114,5,0,0,0,114,
-    5,0,0,0,114,6,0,0,0,218,8,103,101,116,95,99,
-    111,100,101,15,3,0,0,243,4,0,0,0,4,4,255,128,
-    122,24,66,117,105,108,116,105,110,73,109,112,111,114,116,101,
-    114,46,103,101,116,95,99,111,100,101,99,2,0,0,0,0,
-    0,0,0,0,0,0,0,2,0,0,0,1,0,0,0,67,
-    0,0,0,114,185,0,0,0,41,2,122,56,82,101,116,117,
-    114,110,32,78,111,110,101,32,97,115,32,98,117,105,108,116,
-    45,105,110,32,109,111,100,117,108,101,115,32,100,111,32,110,
-    111,116,32,104,97,118,101,32,115,111,117,114,99,101,32,99,
-    111,100,101,46,78,114,5,0,0,0,114,186,0,0,0,114,
-    5,0,0,0,114,5,0,0,0,114,6,0,0,0,218,10,
-    103,101,116,95,115,111,117,114,99,101,21,3,0,0,114,188,
-    0,0,0,122,26,66,117,105,108,116,105,110,73,109,112,111,
-    114,116,101,114,46,103,101,116,95,115,111,117,114,99,101,99,
-    2,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,
-    1,0,0,0,67,0,0,0,114,185,0,0,0,41,3,122,
-    52,82,101,116,117,114,110,32,70,97,108,115,101,32,97,115,
-    32,98,117,105,108,116,45,105,110,32,109,111,100,117,108,101,
-    115,32,97,114,101,32,110,101,118,101,114,32,112,97,99,107,
-    97,103,101,115,46,70,78,114,5,0,0,0,114,186,0,0,
-    0,114,5,0,0,0,114,5,0,0,0,114,6,0,0,0,
-    114,128,0,0,0,27,3,0,0,114,188,0,0,0,122,26,
-    66,117,105,108,116,105,110,73,109,112,111,114,116,101,114,46,
-    105,115,95,112,97,99,107,97,103,101,169,2,78,78,114,0,
-    0,0,0,41,18,114,9,0,0,0,114,8,0,0,0,114,
-    1,0,0,0,114,10,0,0,0,114,151,0,0,0,218,12,
-    115,116,97,116,105,99,109,101,116,104,111,100,114,114,0,0,
-    0,218,11,99,108,97,115,115,109,101,116,104,111,100,114,183,
-    0,0,0,114,184,0,0,0,114,162,0,0,0,114,163,0,
-    0,0,114,95,0,0,0,114,187,0,0,0,114,189,0,0,
-    0,114,128,0,0,0,114,111,0,0,0,114,170,0,0,0,
-    114,5,0,0,0,114,5,0,0,0,114,5,0,0,0,114,
-    6,0,0,0,114,175,0,0,0,212,2,0,0,115,48,0,
-    0,0,8,0,4,2,4,7,2,2,10,1,2,10,12,1,
-    2,8,12,1,2,14,10,1,2,7,10,1,2,4,2,1,
-    12,1,2,4,2,1,12,1,2,4,2,1,12,1,12,4,
-    255,128,114,175,0,0,0,99,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,0,4,0,0,0,64,0,0,0,
-    115,144,0,0,0,101,0,90,1,100,0,90,2,100,1,90,
-    3,100,2,90,4,101,5,100,3,100,4,132,0,131,1,90,
-    6,101,7,100,22,100,6,100,7,132,1,131,1,90,8,101,
-    7,100,23,100,8,100,9,132,1,131,1,90,9,101,5,100,
-    10,100,11,132,0,131,1,90,10,101,5,100,12,100,13,132,
-    0,131,1,90,11,101,7,100,14,100,15,132,0,131,1,90,
-    12,101,7,101,13,100,16,100,17,132,0,131,1,131,1,90,
-    14,101,7,101,13,100,18,100,19,132,0,131,1,131,1,90,
-    15,101,7,101,13,100,20,100,21,132,0,131,1,131,1,90,
-    16,100,5,83,0,41,24,218,14,70,114,111,122,101,110,73,
-    109,112,111,114,116,101,114,122,142,77,101,116,97,32,112,97,
-    116,104,32,105,109,112,111,114,116,32,102,111,114,32,102,114,
-    111,122,101,110,32,109,111,100,117,108,101,115,46,10,10,32,
-    32,32,32,65,108,108,32,109,101,116,104,111,100,115,32,97,
-    114,101,32,101,105,116,104,101,114,32,99,108,97,115,115,32,
-    111,114,32,115,116,97,116,105,99,32,109,101,116,104,111,100,
-    115,32,116,111,32,97,118,111,105,100,32,116,104,101,32,110,
-    101,101,100,32,116,111,10,32,32,32,32,105,110,115,116,97,
-    110,116,105,97,116,101,32,116,104,101,32,99,108,97,115,115,
-    46,10,10,32,32,32,32,90,6,102,114,111,122,101,110,99,
-    1,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,
-    4,0,0,0,67,0,0,0,115,28,0,0,0,116,0,160,
-    1,100,1,116,2,161,2,1,0,100,2,160,3,124,0,106,
-    4,116,5,106,6,161,2,83,0,41,4,114,176,0,0,0,
-    122,80,70,114,111,122,101,110,73,109,112,111,114,116,101,114,
-    46,109,111,100,117,108,101,95,114,101,112,114,40,41,32,105,
-    115,32,100,101,112,114,101,99,97,116,101,100,32,97,110,100,
-    32,115,108,97,116,101,100,32,102,111,114,32,114,101,109,111,
-    118,97,108,32,105,110,32,80,121,116,104,111,110,32,51,46,
-    49,50,114,166,0,0,0,78,41,7,114,101,0,0,0,114,
-    102,0,0,0,114,103,0,0,0,114,50,0,0,0,114,9,
-    0,0,0,114,193,0,0,0,114,151,0,0,0,41,1,218,
-    1,109,114,5,0,0,0,114,5,0,0,0,114,6,0,0,
-    0,114,114,0,0,0,47,3,0,0,115,10,0,0,0,6,
-    7,2,1,4,255,16,2,255,128,122,26,70,114,111,122,101,
-    110,73,109,112,111,114,116,101,114,46,109,111,100,117,108,101,
-    95,114,101,112,114,78,99,4,0,0,0,0,0,0,0,0,
-    0,0,0,4,0,0,0,5,0,0,0,67,0,0,0,115,
-    30,0,0,0,116,0,160,1,124,1,161,1,114,13,116,2,
-    124,1,124,0,124,0,106,3,100,1,141,3,83,0,100,0,
-    83,0,114,178,0,0,0,41,4,114,64,0,0,0,114,98,
-    0,0,0,114,104,0,0,0,114,151,0,0,0,114,179,0,
-    0,0,114,5,0,0,0,114,5,0,0,0,114,6,0,0,
-    0,114,183,0,0,0,58,3,0,0,115,8,0,0,0,10,
-    2,16,1,4,2,255,128,122,24,70,114,111,122,101,110,73,
-    109,112,111,114,116,101,114,46,102,105,110,100,95,115,112,101,
-    99,99,3,0,0,0,0,0,0,0,0,0,0,0,3,0,
-    0,0,4,0,0,0,67,0,0,0,115,30,0,0,0,116,
-    0,160,1,100,1,116,2,161,2,1,0,116,3,160,4,124,
-    1,161,1,114,13,124,0,83,0,100,2,83,0,41,3,122,
-    93,70,105,110,100,32,97,32,102,114,111,122,101,110,32,109,
-    111,100,117,108,101,46,10,10,32,32,32,32,32,32,32,32,
-    84,104,105,115,32,109,101,116,104,111,100,32,105,115,32,100,
-    101,112,114,101,99,97,116,101,100,46,32,32,85,115,101,32,
-    102,105,110,100,95,115,112,101,99,40,41,32,105,110,115,116,
-    101,97,100,46,10,10,32,32,32,32,32,32,32,32,122,105,
-    70,114,111,122,101,110,73,109,112,111,114,116,101,114,46,102,
+    111,110,32,51,46,49,50,2,8,60,109,111,100,117,108,101,
+    32,2,2,32,40,2,2,41,62,2,27,66,117,105,108,116,
+    105,110,73,109,112,111,114,116,101,114,46,109,111,100,117,108,
+    101,95,114,101,112,114,3,10,105,115,95,98,117,105,108,116,
+    105,110,3,3,99,108,115,3,4,112,97,116,104,3,6,116,
+    97,114,103,101,116,3,9,102,105,110,100,95,115,112,101,99,
+    2,25,66,117,105,108,116,105,110,73,109,112,111,114,116,101,
+    114,46,102,105,110,100,95,115,112,101,99,2,175,1,70,105,
+    110,100,32,116,104,101,32,98,117,105,108,116,45,105,110,32,
+    109,111,100,117,108,101,46,10,10,32,32,32,32,32,32,32,
+    32,73,102,32,39,112,97,116,104,39,32,105,115,32,101,118,
+    101,114,32,115,112,101,99,105,102,105,101,100,32,116,104,101,
+    110,32,116,104,101,32,115,101,97,114,99,104,32,105,115,32,
+    99,111,110,115,105,100,101,114,101,100,32,97,32,102,97,105,
+    108,117,114,101,46,10,10,32,32,32,32,32,32,32,32,84,
+    104,105,115,32,109,101,116,104,111,100,32,105,115,32,100,101,
+    112,114,101,99,97,116,101,100,46,32,32,85,115,101,32,102,
+    105,110,100,95,115,112,101,99,40,41,32,105,110,115,116,101,
+    97,100,46,10,10,32,32,32,32,32,32,32,32,2,106,66,
+    117,105,108,116,105,110,73,109,112,111,114,116,101,114,46,102,
     105,110,100,95,109,111,100,117,108,101,40,41,32,105,115,32,
     100,101,112,114,101,99,97,116,101,100,32,97,110,100,32,115,
     108,97,116,101,100,32,102,111,114,32,114,101,109,111,118,97,
     108,32,105,110,32,80,121,116,104,111,110,32,51,46,49,50,
     59,32,117,115,101,32,102,105,110,100,95,115,112,101,99,40,
-    41,32,105,110,115,116,101,97,100,78,41,5,114,101,0,0,
-    0,114,102,0,0,0,114,103,0,0,0,114,64,0,0,0,
-    114,98,0,0,0,41,3,114,180,0,0,0,114,89,0,0,
-    0,114,181,0,0,0,114,5,0,0,0,114,5,0,0,0,
-    114,6,0,0,0,114,184,0,0,0,65,3,0,0,115,10,
-    0,0,0,6,7,2,2,4,254,18,3,255,128,122,26,70,
-    114,111,122,101,110,73,109,112,111,114,116,101,114,46,102,105,
-    110,100,95,109,111,100,117,108,101,99,1,0,0,0,0,0,
-    0,0,0,0,0,0,1,0,0,0,1,0,0,0,67,0,
-    0,0,114,185,0,0,0,41,2,122,42,85,115,101,32,100,
-    101,102,97,117,108,116,32,115,101,109,97,110,116,105,99,115,
-    32,102,111,114,32,109,111,100,117,108,101,32,99,114,101,97,
-    116,105,111,110,46,78,114,5,0,0,0,114,174,0,0,0,
-    114,5,0,0,0,114,5,0,0,0,114,6,0,0,0,114,
-    162,0,0,0,77,3,0,0,115,4,0,0,0,4,0,255,
-    128,122,28,70,114,111,122,101,110,73,109,112,111,114,116,101,
-    114,46,99,114,101,97,116,101,95,109,111,100,117,108,101,99,
-    1,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,
-    4,0,0,0,67,0,0,0,115,64,0,0,0,124,0,106,
-    0,106,1,125,1,116,2,160,3,124,1,161,1,115,18,116,
-    4,100,1,160,5,124,1,161,1,124,1,100,2,141,2,130,
-    1,116,6,116,2,106,7,124,1,131,2,125,2,116,8,124,
-    2,124,0,106,9,131,2,1,0,100,0,83,0,114,97,0,
-    0,0,41,10,114,113,0,0,0,114,20,0,0,0,114,64,
-    0,0,0,114,98,0,0,0,114,87,0,0,0,114,50,0,
-    0,0,114,74,0,0,0,218,17,103,101,116,95,102,114,111,
-    122,101,110,95,111,98,106,101,99,116,218,4,101,120,101,99,
-    114,14,0,0,0,41,3,114,110,0,0,0,114,20,0,0,
-    0,218,4,99,111,100,101,114,5,0,0,0,114,5,0,0,
-    0,114,6,0,0,0,114,163,0,0,0,81,3,0,0,115,
-    16,0,0,0,8,2,10,1,10,1,2,1,6,255,12,2,
-    16,1,255,128,122,26,70,114,111,122,101,110,73,109,112,111,
-    114,116,101,114,46,101,120,101,99,95,109,111,100,117,108,101,
-    99,2,0,0,0,0,0,0,0,0,0,0,0,2,0,0,
-    0,3,0,0,0,67,0,0,0,115,10,0,0,0,116,0,
-    124,0,124,1,131,2,83,0,41,2,122,95,76,111,97,100,
-    32,97,32,102,114,111,122,101,110,32,109,111,100,117,108,101,
-    46,10,10,32,32,32,32,32,32,32,32,84,104,105,115,32,
-    109,101,116,104,111,100,32,105,115,32,100,101,112,114,101,99,
-    97,116,101,100,46,32,32,85,115,101,32,101,120,101,99,95,
-    109,111,100,117,108,101,40,41,32,105,110,115,116,101,97,100,
-    46,10,10,32,32,32,32,32,32,32,32,78,41,1,114,111,
-    0,0,0,114,186,0,0,0,114,5,0,0,0,114,5,0,
-    0,0,114,6,0,0,0,114,170,0,0,0,90,3,0,0,
-    115,4,0,0,0,10,8,255,128,122,26,70,114,111,122,101,
-    110,73,109,112,111,114,116,101,114,46,108,111,97,100,95,109,
-    111,100,117,108,101,99,2,0,0,0,0,0,0,0,0,0,
-    0,0,2,0,0,0,3,0,0,0,67,0,0,0,243,10,
-    0,0,0,116,0,160,1,124,1,161,1,83,0,41,2,122,
-    45,82,101,116,117,114,110,32,116,104,101,32,99,111,100,101,
-    32,111,98,106,101,99,116,32,102,111,114,32,116,104,101,32,
-    102,114,111,122,101,110,32,109,111,100,117,108,101,46,78,41,
-    2,114,64,0,0,0,114,195,0,0,0,114,186,0,0,0,
-    114,5,0,0,0,114,5,0,0,0,114,6,0,0,0,114,
-    187,0,0,0,100,3,0,0,243,4,0,0,0,10,4,255,
-    128,122,23,70,114,111,122,101,110,73,109,112,111,114,116,101,
-    114,46,103,101,116,95,99,111,100,101,99,2,0,0,0,0,
-    0,0,0,0,0,0,0,2,0,0,0,1,0,0,0,67,
-    0,0,0,114,185,0,0,0,41,2,122,54,82,101,116,117,
-    114,110,32,78,111,110,101,32,97,115,32,102,114,111,122,101,
-    110,32,109,111,100,117,108,101,115,32,100,111,32,110,111,116,
-    32,104,97,118,101,32,115,111,117,114,99,101,32,99,111,100,
-    101,46,78,114,5,0,0,0,114,186,0,0,0,114,5,0,
-    0,0,114,5,0,0,0,114,6,0,0,0,114,189,0,0,
-    0,106,3,0,0,114,188,0,0,0,122,25,70,114,111,122,
-    101,110,73,109,112,111,114,116,101,114,46,103,101,116,95,115,
-    111,117,114,99,101,99,2,0,0,0,0,0,0,0,0,0,
-    0,0,2,0,0,0,3,0,0,0,67,0,0,0,114,198,
-    0,0,0,41,2,122,46,82,101,116,117,114,110,32,84,114,
-    117,101,32,105,102,32,116,104,101,32,102,114,111,122,101,110,
-    32,109,111,100,117,108,101,32,105,115,32,97,32,112,97,99,
-    107,97,103,101,46,78,41,2,114,64,0,0,0,90,17,105,
-    115,95,102,114,111,122,101,110,95,112,97,99,107,97,103,101,
-    114,186,0,0,0,114,5,0,0,0,114,5,0,0,0,114,
-    6,0,0,0,114,128,0,0,0,112,3,0,0,114,199,0,
-    0,0,122,25,70,114,111,122,101,110,73,109,112,111,114,116,
-    101,114,46,105,115,95,112,97,99,107,97,103,101,114,190,0,
-    0,0,114,0,0,0,0,41,17,114,9,0,0,0,114,8,
-    0,0,0,114,1,0,0,0,114,10,0,0,0,114,151,0,
-    0,0,114,191,0,0,0,114,114,0,0,0,114,192,0,0,
-    0,114,183,0,0,0,114,184,0,0,0,114,162,0,0,0,
-    114,163,0,0,0,114,170,0,0,0,114,100,0,0,0,114,
-    187,0,0,0,114,189,0,0,0,114,128,0,0,0,114,5,
-    0,0,0,114,5,0,0,0,114,5,0,0,0,114,6,0,
-    0,0,114,193,0,0,0,36,3,0,0,115,50,0,0,0,
-    8,0,4,2,4,7,2,2,10,1,2,10,12,1,2,6,
-    12,1,2,11,10,1,2,3,10,1,2,8,10,1,2,9,
-    2,1,12,1,2,4,2,1,12,1,2,4,2,1,16,1,
-    255,128,114,193,0,0,0,99,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,0,2,0,0,0,64,0,0,0,
-    115,32,0,0,0,101,0,90,1,100,0,90,2,100,1,90,
-    3,100,2,100,3,132,0,90,4,100,4,100,5,132,0,90,
-    5,100,6,83,0,41,7,218,18,95,73,109,112,111,114,116,
-    76,111,99,107,67,111,110,116,101,120,116,122,36,67,111,110,
-    116,101,120,116,32,109,97,110,97,103,101,114,32,102,111,114,
-    32,116,104,101,32,105,109,112,111,114,116,32,108,111,99,107,
-    46,99,1,0,0,0,0,0,0,0,0,0,0,0,1,0,
-    0,0,2,0,0,0,67,0,0,0,243,12,0,0,0,116,
-    0,160,1,161,0,1,0,100,1,83,0,41,2,122,24,65,
-    99,113,117,105,114,101,32,116,104,101,32,105,109,112,111,114,
-    116,32,108,111,99,107,46,78,41,2,114,64,0,0,0,114,
-    65,0,0,0,114,52,0,0,0,114,5,0,0,0,114,5,
-    0,0,0,114,6,0,0,0,114,61,0,0,0,125,3,0,
-    0,243,4,0,0,0,12,2,255,128,122,28,95,73,109,112,
-    111,114,116,76,111,99,107,67,111,110,116,101,120,116,46,95,
-    95,101,110,116,101,114,95,95,99,4,0,0,0,0,0,0,
-    0,0,0,0,0,4,0,0,0,2,0,0,0,67,0,0,
-    0,114,201,0,0,0,41,2,122,60,82,101,108,101,97,115,
-    101,32,116,104,101,32,105,109,112,111,114,116,32,108,111,99,
-    107,32,114,101,103,97,114,100,108,101,115,115,32,111,102,32,
-    97,110,121,32,114,97,105,115,101,100,32,101,120,99,101,112,
-    116,105,111,110,115,46,78,41,2,114,64,0,0,0,114,67,
-    0,0,0,41,4,114,33,0,0,0,218,8,101,120,99,95,
-    116,121,112,101,218,9,101,120,99,95,118,97,108,117,101,218,
-    13,101,120,99,95,116,114,97,99,101,98,97,99,107,114,5,
-    0,0,0,114,5,0,0,0,114,6,0,0,0,114,63,0,
-    0,0,129,3,0,0,114,202,0,0,0,122,27,95,73,109,
-    112,111,114,116,76,111,99,107,67,111,110,116,101,120,116,46,
-    95,95,101,120,105,116,95,95,78,41,6,114,9,0,0,0,
-    114,8,0,0,0,114,1,0,0,0,114,10,0,0,0,114,
-    61,0,0,0,114,63,0,0,0,114,5,0,0,0,114,5,
-    0,0,0,114,5,0,0,0,114,6,0,0,0,114,200,0,
-    0,0,121,3,0,0,115,10,0,0,0,8,0,4,2,8,
-    2,12,4,255,128,114,200,0,0,0,99,3,0,0,0,0,
-    0,0,0,0,0,0,0,5,0,0,0,5,0,0,0,67,
-    0,0,0,115,64,0,0,0,124,1,160,0,100,1,124,2,
-    100,2,24,0,161,2,125,3,116,1,124,3,131,1,124,2,
-    107,0,114,18,116,2,100,3,131,1,130,1,124,3,100,4,
-    25,0,125,4,124,0,114,30,100,5,160,3,124,4,124,0,
-    161,2,83,0,124,4,83,0,41,7,122,50,82,101,115,111,
-    108,118,101,32,97,32,114,101,108,97,116,105,118,101,32,109,
-    111,100,117,108,101,32,110,97,109,101,32,116,111,32,97,110,
-    32,97,98,115,111,108,117,116,101,32,111,110,101,46,114,141,
-    0,0,0,114,42,0,0,0,122,50,97,116,116,101,109,112,
-    116,101,100,32,114,101,108,97,116,105,118,101,32,105,109,112,
-    111,114,116,32,98,101,121,111,110,100,32,116,111,112,45,108,
-    101,118,101,108,32,112,97,99,107,97,103,101,114,25,0,0,
-    0,250,5,123,125,46,123,125,78,41,4,218,6,114,115,112,
-    108,105,116,218,3,108,101,110,114,87,0,0,0,114,50,0,
-    0,0,41,5,114,20,0,0,0,218,7,112,97,99,107,97,
-    103,101,218,5,108,101,118,101,108,90,4,98,105,116,115,90,
-    4,98,97,115,101,114,5,0,0,0,114,5,0,0,0,114,
-    6,0,0,0,218,13,95,114,101,115,111,108,118,101,95,110,
-    97,109,101,134,3,0,0,115,12,0,0,0,16,2,12,1,
-    8,1,8,1,20,1,255,128,114,211,0,0,0,99,3,0,
-    0,0,0,0,0,0,0,0,0,0,5,0,0,0,4,0,
-    0,0,67,0,0,0,115,60,0,0,0,116,0,124,0,131,
-    1,155,0,100,1,157,2,125,3,116,1,160,2,124,3,116,
-    3,161,2,1,0,124,0,160,4,124,1,124,2,161,2,125,
-    4,124,4,100,0,117,0,114,25,100,0,83,0,116,5,124,
-    1,124,4,131,2,83,0,41,2,78,122,53,46,102,105,110,
+    41,32,105,110,115,116,101,97,100,3,11,102,105,110,100,95,
+    109,111,100,117,108,101,2,27,66,117,105,108,116,105,110,73,
+    109,112,111,114,116,101,114,46,102,105,110,100,95,109,111,100,
+    117,108,101,2,24,67,114,101,97,116,101,32,97,32,98,117,
+    105,108,116,45,105,110,32,109,111,100,117,108,101,3,14,99,
+    114,101,97,116,101,95,98,117,105,108,116,105,110,2,29,66,
+    117,105,108,116,105,110,73,109,112,111,114,116,101,114,46,99,
+    114,101,97,116,101,95,109,111,100,117,108,101,2,22,69,120,
+    101,99,32,97,32,98,117,105,108,116,45,105,110,32,109,111,
+    100,117,108,101,3,12,101,120,101,99,95,98,117,105,108,116,
+    105,110,2,27,66,117,105,108,116,105,110,73,109,112,111,114,
+    116,101,114,46,101,120,101,99,95,109,111,100,117,108,101,2,
+    57,82,101,116,117,114,110,32,78,111,110,101,32,97,115,32,
+    98,117,105,108,116,45,105,110,32,109,111,100,117,108,101,115,
+    32,100,111,32,110,111,116,32,104,97,118,101,32,99,111,100,
+    101,32,111,98,106,101,99,116,115,46,3,8,103,101,116,95,
+    99,111,100,101,2,24,66,117,105,108,116,105,110,73,109,112,
+    111,114,116,101,114,46,103,101,116,95,99,111,100,101,2,56,
+    82,101,116,117,114,110,32,78,111,110,101,32,97,115,32,98,
+    117,105,108,116,45,105,110,32,109,111,100,117,108,101,115,32,
+    100,111,32,110,111,116,32,104,97,118,101,32,115,111,117,114,
+    99,101,32,99,111,100,101,46,3,10,103,101,116,95,115,111,
+    117,114,99,101,2,26,66,117,105,108,116,105,110,73,109,112,
+    111,114,116,101,114,46,103,101,116,95,115,111,117,114,99,101,
+    2,52,82,101,116,117,114,110,32,70,97,108,115,101,32,97,
+    115,32,98,117,105,108,116,45,105,110,32,109,111,100,117,108,
+    101,115,32,97,114,101,32,110,101,118,101,114,32,112,97,99,
+    107,97,103,101,115,46,2,26,66,117,105,108,116,105,110,73,
+    109,112,111,114,116,101,114,46,105,115,95,112,97,99,107,97,
+    103,101,3,12,115,116,97,116,105,99,109,101,116,104,111,100,
+    3,11,99,108,97,115,115,109,101,116,104,111,100,3,14,70,
+    114,111,122,101,110,73,109,112,111,114,116,101,114,2,142,1,
+    77,101,116,97,32,112,97,116,104,32,105,109,112,111,114,116,
+    32,102,111,114,32,102,114,111,122,101,110,32,109,111,100,117,
+    108,101,115,46,10,10,32,32,32,32,65,108,108,32,109,101,
+    116,104,111,100,115,32,97,114,101,32,101,105,116,104,101,114,
+    32,99,108,97,115,115,32,111,114,32,115,116,97,116,105,99,
+    32,109,101,116,104,111,100,115,32,116,111,32,97,118,111,105,
+    100,32,116,104,101,32,110,101,101,100,32,116,111,10,32,32,
+    32,32,105,110,115,116,97,110,116,105,97,116,101,32,116,104,
+    101,32,99,108,97,115,115,46,10,10,32,32,32,32,3,6,
+    102,114,111,122,101,110,2,80,70,114,111,122,101,110,73,109,
+    112,111,114,116,101,114,46,109,111,100,117,108,101,95,114,101,
+    112,114,40,41,32,105,115,32,100,101,112,114,101,99,97,116,
+    101,100,32,97,110,100,32,115,108,97,116,101,100,32,102,111,
+    114,32,114,101,109,111,118,97,108,32,105,110,32,80,121,116,
+    104,111,110,32,51,46,49,50,3,1,109,2,26,70,114,111,
+    122,101,110,73,109,112,111,114,116,101,114,46,109,111,100,117,
+    108,101,95,114,101,112,114,2,24,70,114,111,122,101,110,73,
+    109,112,111,114,116,101,114,46,102,105,110,100,95,115,112,101,
+    99,2,93,70,105,110,100,32,97,32,102,114,111,122,101,110,
+    32,109,111,100,117,108,101,46,10,10,32,32,32,32,32,32,
+    32,32,84,104,105,115,32,109,101,116,104,111,100,32,105,115,
+    32,100,101,112,114,101,99,97,116,101,100,46,32,32,85,115,
+    101,32,102,105,110,100,95,115,112,101,99,40,41,32,105,110,
+    115,116,101,97,100,46,10,10,32,32,32,32,32,32,32,32,
+    2,105,70,114,111,122,101,110,73,109,112,111,114,116,101,114,
+    46,102,105,110,100,95,109,111,100,117,108,101,40,41,32,105,
+    115,32,100,101,112,114,101,99,97,116,101,100,32,97,110,100,
+    32,115,108,97,116,101,100,32,102,111,114,32,114,101,109,111,
+    118,97,108,32,105,110,32,80,121,116,104,111,110,32,51,46,
+    49,50,59,32,117,115,101,32,102,105,110,100,95,115,112,101,
+    99,40,41,32,105,110,115,116,101,97,100,2,26,70,114,111,
+    122,101,110,73,109,112,111,114,116,101,114,46,102,105,110,100,
+    95,109,111,100,117,108,101,2,42,85,115,101,32,100,101,102,
+    97,117,108,116,32,115,101,109,97,110,116,105,99,115,32,102,
+    111,114,32,109,111,100,117,108,101,32,99,114,101,97,116,105,
+    111,110,46,2,28,70,114,111,122,101,110,73,109,112,111,114,
+    116,101,114,46,99,114,101,97,116,101,95,109,111,100,117,108,
+    101,3,17,103,101,116,95,102,114,111,122,101,110,95,111,98,
+    106,101,99,116,3,4,101,120,101,99,3,4,99,111,100,101,
+    2,26,70,114,111,122,101,110,73,109,112,111,114,116,101,114,
+    46,101,120,101,99,95,109,111,100,117,108,101,2,95,76,111,
+    97,100,32,97,32,102,114,111,122,101,110,32,109,111,100,117,
+    108,101,46,10,10,32,32,32,32,32,32,32,32,84,104,105,
+    115,32,109,101,116,104,111,100,32,105,115,32,100,101,112,114,
+    101,99,97,116,101,100,46,32,32,85,115,101,32,101,120,101,
+    99,95,109,111,100,117,108,101,40,41,32,105,110,115,116,101,
+    97,100,46,10,10,32,32,32,32,32,32,32,32,2,26,70,
+    114,111,122,101,110,73,109,112,111,114,116,101,114,46,108,111,
+    97,100,95,109,111,100,117,108,101,2,45,82,101,116,117,114,
+    110,32,116,104,101,32,99,111,100,101,32,111,98,106,101,99,
+    116,32,102,111,114,32,116,104,101,32,102,114,111,122,101,110,
+    32,109,111,100,117,108,101,46,2,23,70,114,111,122,101,110,
+    73,109,112,111,114,116,101,114,46,103,101,116,95,99,111,100,
+    101,2,54,82,101,116,117,114,110,32,78,111,110,101,32,97,
+    115,32,102,114,111,122,101,110,32,109,111,100,117,108,101,115,
+    32,100,111,32,110,111,116,32,104,97,118,101,32,115,111,117,
+    114,99,101,32,99,111,100,101,46,2,25,70,114,111,122,101,
+    110,73,109,112,111,114,116,101,114,46,103,101,116,95,115,111,
+    117,114,99,101,2,46,82,101,116,117,114,110,32,84,114,117,
+    101,32,105,102,32,116,104,101,32,102,114,111,122,101,110,32,
+    109,111,100,117,108,101,32,105,115,32,97,32,112,97,99,107,
+    97,103,101,46,3,17,105,115,95,102,114,111,122,101,110,95,
+    112,97,99,107,97,103,101,2,25,70,114,111,122,101,110,73,
+    109,112,111,114,116,101,114,46,105,115,95,112,97,99,107,97,
+    103,101,3,18,95,73,109,112,111,114,116,76,111,99,107,67,
+    111,110,116,101,120,116,2,36,67,111,110,116,101,120,116,32,
+    109,97,110,97,103,101,114,32,102,111,114,32,116,104,101,32,
+    105,109,112,111,114,116,32,108,111,99,107,46,2,24,65,99,
+    113,117,105,114,101,32,116,104,101,32,105,109,112,111,114,116,
+    32,108,111,99,107,46,2,28,95,73,109,112,111,114,116,76,
+    111,99,107,67,111,110,116,101,120,116,46,95,95,101,110,116,
+    101,114,95,95,2,60,82,101,108,101,97,115,101,32,116,104,
+    101,32,105,109,112,111,114,116,32,108,111,99,107,32,114,101,
+    103,97,114,100,108,101,115,115,32,111,102,32,97,110,121,32,
+    114,97,105,115,101,100,32,101,120,99,101,112,116,105,111,110,
+    115,46,3,8,101,120,99,95,116,121,112,101,3,9,101,120,
+    99,95,118,97,108,117,101,3,13,101,120,99,95,116,114,97,
+    99,101,98,97,99,107,2,27,95,73,109,112,111,114,116,76,
+    111,99,107,67,111,110,116,101,120,116,46,95,95,101,120,105,
+    116,95,95,2,50,82,101,115,111,108,118,101,32,97,32,114,
+    101,108,97,116,105,118,101,32,109,111,100,117,108,101,32,110,
+    97,109,101,32,116,111,32,97,110,32,97,98,115,111,108,117,
+    116,101,32,111,110,101,46,2,50,97,116,116,101,109,112,116,
+    101,100,32,114,101,108,97,116,105,118,101,32,105,109,112,111,
+    114,116,32,98,101,121,111,110,100,32,116,111,112,45,108,101,
+    118,101,108,32,112,97,99,107,97,103,101,2,5,123,125,46,
+    123,125,3,6,114,115,112,108,105,116,3,3,108,101,110,3,
+    7,112,97,99,107,97,103,101,3,5,108,101,118,101,108,3,
+    4,98,105,116,115,3,4,98,97,115,101,3,13,95,114,101,
+    115,111,108,118,101,95,110,97,109,101,2,53,46,102,105,110,
     100,95,115,112,101,99,40,41,32,110,111,116,32,102,111,117,
     110,100,59,32,102,97,108,108,105,110,103,32,98,97,99,107,
     32,116,111,32,102,105,110,100,95,109,111,100,117,108,101,40,
-    41,41,6,114,7,0,0,0,114,101,0,0,0,114,102,0,
-    0,0,114,169,0,0,0,114,184,0,0,0,114,104,0,0,
-    0,41,5,218,6,102,105,110,100,101,114,114,20,0,0,0,
-    114,181,0,0,0,114,108,0,0,0,114,122,0,0,0,114,
-    5,0,0,0,114,5,0,0,0,114,6,0,0,0,218,17,
-    95,102,105,110,100,95,115,112,101,99,95,108,101,103,97,99,
-    121,143,3,0,0,115,14,0,0,0,14,1,12,2,12,1,
-    8,1,4,1,10,1,255,128,114,213,0,0,0,99,3,0,
-    0,0,0,0,0,0,0,0,0,0,10,0,0,0,10,0,
-    0,0,67,0,0,0,115,24,1,0,0,116,0,106,1,125,
-    3,124,3,100,1,117,0,114,11,116,2,100,2,131,1,130,
-    1,124,3,115,19,116,3,160,4,100,3,116,5,161,2,1,
-    0,124,0,116,0,106,6,118,0,125,4,124,3,68,0,93,
-    109,125,5,116,7,131,0,143,46,1,0,122,5,124,5,106,
-    8,125,6,87,0,110,26,4,0,116,9,121,139,1,0,1,
-    0,1,0,116,10,124,5,124,0,124,1,131,3,125,7,124,
-    7,100,1,117,0,114,62,89,0,87,0,100,1,4,0,4,
-    0,131,3,1,0,113,26,89,0,110,6,124,6,124,0,124,
-    1,124,2,131,3,125,7,87,0,100,1,4,0,4,0,131,
-    3,1,0,110,8,49,0,115,80,119,1,1,0,1,0,1,
-    0,89,0,1,0,124,7,100,1,117,1,114,135,124,4,115,
-    131,124,0,116,0,106,6,118,0,114,131,116,0,106,6,124,
-    0,25,0,125,8,122,5,124,8,106,11,125,9,87,0,110,
-    12,4,0,116,9,121,138,1,0,1,0,1,0,124,7,6,
-    0,89,0,2,0,1,0,83,0,124,9,100,1,117,0,114,
-    127,124,7,2,0,1,0,83,0,124,9,2,0,1,0,83,
-    0,124,7,2,0,1,0,83,0,113,26,100,1,83,0,119,
-    0,119,0,41,4,122,21,70,105,110,100,32,97,32,109,111,
-    100,117,108,101,39,115,32,115,112,101,99,46,78,122,53,115,
-    121,115,46,109,101,116,97,95,112,97,116,104,32,105,115,32,
-    78,111,110,101,44,32,80,121,116,104,111,110,32,105,115,32,
-    108,105,107,101,108,121,32,115,104,117,116,116,105,110,103,32,
-    100,111,119,110,122,22,115,121,115,46,109,101,116,97,95,112,
-    97,116,104,32,105,115,32,101,109,112,116,121,41,12,114,18,
-    0,0,0,218,9,109,101,116,97,95,112,97,116,104,114,87,
-    0,0,0,114,101,0,0,0,114,102,0,0,0,114,169,0,
-    0,0,114,105,0,0,0,114,200,0,0,0,114,183,0,0,
-    0,114,2,0,0,0,114,213,0,0,0,114,113,0,0,0,
-    41,10,114,20,0,0,0,114,181,0,0,0,114,182,0,0,
-    0,114,214,0,0,0,90,9,105,115,95,114,101,108,111,97,
-    100,114,212,0,0,0,114,183,0,0,0,114,109,0,0,0,
-    114,110,0,0,0,114,113,0,0,0,114,5,0,0,0,114,
-    5,0,0,0,114,6,0,0,0,218,10,95,102,105,110,100,
-    95,115,112,101,99,153,3,0,0,115,66,0,0,0,6,2,
-    8,1,8,2,4,3,12,1,10,5,8,1,8,1,2,1,
-    10,1,12,1,12,1,8,1,16,1,4,255,12,3,30,128,
-    8,1,14,2,10,1,2,1,10,1,12,1,12,4,8,2,
-    8,1,8,2,8,2,2,239,4,19,2,243,2,244,255,128,
-    114,215,0,0,0,99,3,0,0,0,0,0,0,0,0,0,
-    0,0,3,0,0,0,5,0,0,0,67,0,0,0,115,110,
-    0,0,0,116,0,124,0,116,1,131,2,115,14,116,2,100,
-    1,160,3,116,4,124,0,131,1,161,1,131,1,130,1,124,
-    2,100,2,107,0,114,22,116,5,100,3,131,1,130,1,124,
-    2,100,2,107,4,114,41,116,0,124,1,116,1,131,2,115,
-    35,116,2,100,4,131,1,130,1,124,1,115,41,116,6,100,
-    5,131,1,130,1,124,0,115,53,124,2,100,2,107,2,114,
-    51,116,5,100,6,131,1,130,1,100,7,83,0,100,7,83,
-    0,41,8,122,28,86,101,114,105,102,121,32,97,114,103,117,
-    109,101,110,116,115,32,97,114,101,32,34,115,97,110,101,34,
-    46,122,31,109,111,100,117,108,101,32,110,97,109,101,32,109,
-    117,115,116,32,98,101,32,115,116,114,44,32,110,111,116,32,
-    123,125,114,25,0,0,0,122,18,108,101,118,101,108,32,109,
-    117,115,116,32,98,101,32,62,61,32,48,122,31,95,95,112,
-    97,99,107,97,103,101,95,95,32,110,111,116,32,115,101,116,
-    32,116,111,32,97,32,115,116,114,105,110,103,122,54,97,116,
-    116,101,109,112,116,101,100,32,114,101,108,97,116,105,118,101,
-    32,105,109,112,111,114,116,32,119,105,116,104,32,110,111,32,
-    107,110,111,119,110,32,112,97,114,101,110,116,32,112,97,99,
-    107,97,103,101,122,17,69,109,112,116,121,32,109,111,100,117,
-    108,101,32,110,97,109,101,78,41,7,218,10,105,115,105,110,
-    115,116,97,110,99,101,218,3,115,116,114,218,9,84,121,112,
-    101,69,114,114,111,114,114,50,0,0,0,114,3,0,0,0,
-    218,10,86,97,108,117,101,69,114,114,111,114,114,87,0,0,
-    0,169,3,114,20,0,0,0,114,209,0,0,0,114,210,0,
-    0,0,114,5,0,0,0,114,5,0,0,0,114,6,0,0,
-    0,218,13,95,115,97,110,105,116,121,95,99,104,101,99,107,
-    200,3,0,0,115,26,0,0,0,10,2,18,1,8,1,8,
-    1,8,1,10,1,8,1,4,1,8,1,12,2,8,1,8,
-    255,255,128,114,221,0,0,0,122,16,78,111,32,109,111,100,
-    117,108,101,32,110,97,109,101,100,32,122,4,123,33,114,125,
-    99,2,0,0,0,0,0,0,0,0,0,0,0,9,0,0,
-    0,8,0,0,0,67,0,0,0,115,16,1,0,0,100,0,
-    125,2,124,0,160,0,100,1,161,1,100,2,25,0,125,3,
-    124,3,114,63,124,3,116,1,106,2,118,1,114,21,116,3,
-    124,1,124,3,131,2,1,0,124,0,116,1,106,2,118,0,
-    114,31,116,1,106,2,124,0,25,0,83,0,116,1,106,2,
-    124,3,25,0,125,4,122,5,124,4,106,4,125,2,87,0,
-    110,21,4,0,116,5,121,135,1,0,1,0,1,0,116,6,
-    100,3,23,0,160,7,124,0,124,3,161,2,125,5,116,8,
-    124,5,124,0,100,4,141,2,100,0,130,2,116,9,124,0,
-    124,2,131,2,125,6,124,6,100,0,117,0,114,81,116,8,
-    116,6,160,7,124,0,161,1,124,0,100,4,141,2,130,1,
-    116,10,124,6,131,1,125,7,124,3,114,132,116,1,106,2,
-    124,3,25,0,125,4,124,0,160,0,100,1,161,1,100,5,
-    25,0,125,8,122,9,116,11,124,4,124,8,124,7,131,3,
-    1,0,87,0,124,7,83,0,4,0,116,5,121,134,1,0,
-    1,0,1,0,100,6,124,3,155,2,100,7,124,8,155,2,
-    157,4,125,5,116,12,160,13,124,5,116,14,161,2,1,0,
-    89,0,124,7,83,0,124,7,83,0,119,0,119,0,41,8,
-    78,114,141,0,0,0,114,25,0,0,0,122,23,59,32,123,
-    33,114,125,32,105,115,32,110,111,116,32,97,32,112,97,99,
-    107,97,103,101,114,19,0,0,0,233,2,0,0,0,122,27,
-    67,97,110,110,111,116,32,115,101,116,32,97,110,32,97,116,
-    116,114,105,98,117,116,101,32,111,110,32,122,18,32,102,111,
-    114,32,99,104,105,108,100,32,109,111,100,117,108,101,32,41,
-    15,114,142,0,0,0,114,18,0,0,0,114,105,0,0,0,
-    114,74,0,0,0,114,154,0,0,0,114,2,0,0,0,218,
-    8,95,69,82,82,95,77,83,71,114,50,0,0,0,218,19,
-    77,111,100,117,108,101,78,111,116,70,111,117,110,100,69,114,
-    114,111,114,114,215,0,0,0,114,173,0,0,0,114,12,0,
-    0,0,114,101,0,0,0,114,102,0,0,0,114,169,0,0,
-    0,41,9,114,20,0,0,0,218,7,105,109,112,111,114,116,
-    95,114,181,0,0,0,114,143,0,0,0,90,13,112,97,114,
-    101,110,116,95,109,111,100,117,108,101,114,108,0,0,0,114,
-    109,0,0,0,114,110,0,0,0,90,5,99,104,105,108,100,
-    114,5,0,0,0,114,5,0,0,0,114,6,0,0,0,218,
-    23,95,102,105,110,100,95,97,110,100,95,108,111,97,100,95,
-    117,110,108,111,99,107,101,100,219,3,0,0,115,60,0,0,
-    0,4,1,14,1,4,1,10,1,10,1,10,2,10,1,10,
-    1,2,1,10,1,12,1,16,1,14,1,10,1,8,1,18,
-    1,8,2,4,1,10,2,14,1,2,1,14,1,4,4,12,
-    253,16,1,14,1,8,1,2,253,2,242,255,128,114,226,0,
-    0,0,99,2,0,0,0,0,0,0,0,0,0,0,0,4,
-    0,0,0,8,0,0,0,67,0,0,0,115,128,0,0,0,
-    116,0,124,0,131,1,143,31,1,0,116,1,106,2,160,3,
-    124,0,116,4,161,2,125,2,124,2,116,4,117,0,114,28,
-    116,5,124,0,124,1,131,2,87,0,2,0,100,1,4,0,
-    4,0,131,3,1,0,83,0,87,0,100,1,4,0,4,0,
-    131,3,1,0,110,8,49,0,115,38,119,1,1,0,1,0,
-    1,0,89,0,1,0,124,2,100,1,117,0,114,58,100,2,
-    160,6,124,0,161,1,125,3,116,7,124,3,124,0,100,3,
-    141,2,130,1,116,8,124,0,131,1,1,0,124,2,83,0,
-    41,4,122,25,70,105,110,100,32,97,110,100,32,108,111,97,
-    100,32,116,104,101,32,109,111,100,117,108,101,46,78,122,40,
+    41,3,6,102,105,110,100,101,114,3,17,95,102,105,110,100,
+    95,115,112,101,99,95,108,101,103,97,99,121,2,21,70,105,
+    110,100,32,97,32,109,111,100,117,108,101,39,115,32,115,112,
+    101,99,46,2,53,115,121,115,46,109,101,116,97,95,112,97,
+    116,104,32,105,115,32,78,111,110,101,44,32,80,121,116,104,
+    111,110,32,105,115,32,108,105,107,101,108,121,32,115,104,117,
+    116,116,105,110,103,32,100,111,119,110,2,22,115,121,115,46,
+    109,101,116,97,95,112,97,116,104,32,105,115,32,101,109,112,
+    116,121,3,9,109,101,116,97,95,112,97,116,104,3,9,105,
+    115,95,114,101,108,111,97,100,3,10,95,102,105,110,100,95,
+    115,112,101,99,2,28,86,101,114,105,102,121,32,97,114,103,
+    117,109,101,110,116,115,32,97,114,101,32,34,115,97,110,101,
+    34,46,2,31,109,111,100,117,108,101,32,110,97,109,101,32,
+    109,117,115,116,32,98,101,32,115,116,114,44,32,110,111,116,
+    32,123,125,2,18,108,101,118,101,108,32,109,117,115,116,32,
+    98,101,32,62,61,32,48,2,31,95,95,112,97,99,107,97,
+    103,101,95,95,32,110,111,116,32,115,101,116,32,116,111,32,
+    97,32,115,116,114,105,110,103,2,54,97,116,116,101,109,112,
+    116,101,100,32,114,101,108,97,116,105,118,101,32,105,109,112,
+    111,114,116,32,119,105,116,104,32,110,111,32,107,110,111,119,
+    110,32,112,97,114,101,110,116,32,112,97,99,107,97,103,101,
+    2,17,69,109,112,116,121,32,109,111,100,117,108,101,32,110,
+    97,109,101,3,10,105,115,105,110,115,116,97,110,99,101,3,
+    3,115,116,114,3,9,84,121,112,101,69,114,114,111,114,3,
+    10,86,97,108,117,101,69,114,114,111,114,3,13,95,115,97,
+    110,105,116,121,95,99,104,101,99,107,2,16,78,111,32,109,
+    111,100,117,108,101,32,110,97,109,101,100,32,2,4,123,33,
+    114,125,2,23,59,32,123,33,114,125,32,105,115,32,110,111,
+    116,32,97,32,112,97,99,107,97,103,101,2,27,67,97,110,
+    110,111,116,32,115,101,116,32,97,110,32,97,116,116,114,105,
+    98,117,116,101,32,111,110,32,2,18,32,102,111,114,32,99,
+    104,105,108,100,32,109,111,100,117,108,101,32,3,8,95,69,
+    82,82,95,77,83,71,3,19,77,111,100,117,108,101,78,111,
+    116,70,111,117,110,100,69,114,114,111,114,3,7,105,109,112,
+    111,114,116,95,3,13,112,97,114,101,110,116,95,109,111,100,
+    117,108,101,3,5,99,104,105,108,100,3,23,95,102,105,110,
+    100,95,97,110,100,95,108,111,97,100,95,117,110,108,111,99,
+    107,101,100,2,25,70,105,110,100,32,97,110,100,32,108,111,
+    97,100,32,116,104,101,32,109,111,100,117,108,101,46,2,40,
     105,109,112,111,114,116,32,111,102,32,123,125,32,104,97,108,
     116,101,100,59,32,78,111,110,101,32,105,110,32,115,121,115,
-    46,109,111,100,117,108,101,115,114,19,0,0,0,41,9,114,
-    57,0,0,0,114,18,0,0,0,114,105,0,0,0,114,38,
-    0,0,0,218,14,95,78,69,69,68,83,95,76,79,65,68,
-    73,78,71,114,226,0,0,0,114,50,0,0,0,114,224,0,
-    0,0,114,72,0,0,0,41,4,114,20,0,0,0,114,225,
-    0,0,0,114,110,0,0,0,114,82,0,0,0,114,5,0,
-    0,0,114,5,0,0,0,114,6,0,0,0,218,14,95,102,
-    105,110,100,95,97,110,100,95,108,111,97,100,254,3,0,0,
-    115,28,0,0,0,10,2,14,1,8,1,24,1,14,255,16,
-    128,8,3,2,1,6,1,2,255,12,2,8,2,4,1,255,
-    128,114,228,0,0,0,114,25,0,0,0,99,3,0,0,0,
-    0,0,0,0,0,0,0,0,3,0,0,0,4,0,0,0,
-    67,0,0,0,115,42,0,0,0,116,0,124,0,124,1,124,
-    2,131,3,1,0,124,2,100,1,107,4,114,16,116,1,124,
-    0,124,1,124,2,131,3,125,0,116,2,124,0,116,3,131,
-    2,83,0,41,3,97,50,1,0,0,73,109,112,111,114,116,
-    32,97,110,100,32,114,101,116,117,114,110,32,116,104,101,32,
-    109,111,100,117,108,101,32,98,97,115,101,100,32,111,110,32,
-    105,116,115,32,110,97,109,101,44,32,116,104,101,32,112,97,
-    99,107,97,103,101,32,116,104,101,32,99,97,108,108,32,105,
-    115,10,32,32,32,32,98,101,105,110,103,32,109,97,100,101,
-    32,102,114,111,109,44,32,97,110,100,32,116,104,101,32,108,
-    101,118,101,108,32,97,100,106,117,115,116,109,101,110,116,46,
-    10,10,32,32,32,32,84,104,105,115,32,102,117,110,99,116,
-    105,111,110,32,114,101,112,114,101,115,101,110,116,115,32,116,
-    104,101,32,103,114,101,97,116,101,115,116,32,99,111,109,109,
-    111,110,32,100,101,110,111,109,105,110,97,116,111,114,32,111,
-    102,32,102,117,110,99,116,105,111,110,97,108,105,116,121,10,
-    32,32,32,32,98,101,116,119,101,101,110,32,105,109,112,111,
-    114,116,95,109,111,100,117,108,101,32,97,110,100,32,95,95,
-    105,109,112,111,114,116,95,95,46,32,84,104,105,115,32,105,
-    110,99,108,117,100,101,115,32,115,101,116,116,105,110,103,32,
-    95,95,112,97,99,107,97,103,101,95,95,32,105,102,10,32,
-    32,32,32,116,104,101,32,108,111,97,100,101,114,32,100,105,
-    100,32,110,111,116,46,10,10,32,32,32,32,114,25,0,0,
-    0,78,41,4,114,221,0,0,0,114,211,0,0,0,114,228,
-    0,0,0,218,11,95,103,99,100,95,105,109,112,111,114,116,
-    114,220,0,0,0,114,5,0,0,0,114,5,0,0,0,114,
-    6,0,0,0,114,229,0,0,0,14,4,0,0,115,10,0,
-    0,0,12,9,8,1,12,1,10,1,255,128,114,229,0,0,
-    0,169,1,218,9,114,101,99,117,114,115,105,118,101,99,3,
-    0,0,0,0,0,0,0,1,0,0,0,8,0,0,0,11,
-    0,0,0,67,0,0,0,115,218,0,0,0,124,1,68,0,
+    46,109,111,100,117,108,101,115,3,14,95,78,69,69,68,83,
+    95,76,79,65,68,73,78,71,3,14,95,102,105,110,100,95,
+    97,110,100,95,108,111,97,100,2,178,2,73,109,112,111,114,
+    116,32,97,110,100,32,114,101,116,117,114,110,32,116,104,101,
+    32,109,111,100,117,108,101,32,98,97,115,101,100,32,111,110,
+    32,105,116,115,32,110,97,109,101,44,32,116,104,101,32,112,
+    97,99,107,97,103,101,32,116,104,101,32,99,97,108,108,32,
+    105,115,10,32,32,32,32,98,101,105,110,103,32,109,97,100,
+    101,32,102,114,111,109,44,32,97,110,100,32,116,104,101,32,
+    108,101,118,101,108,32,97,100,106,117,115,116,109,101,110,116,
+    46,10,10,32,32,32,32,84,104,105,115,32,102,117,110,99,
+    116,105,111,110,32,114,101,112,114,101,115,101,110,116,115,32,
+    116,104,101,32,103,114,101,97,116,101,115,116,32,99,111,109,
+    109,111,110,32,100,101,110,111,109,105,110,97,116,111,114,32,
+    111,102,32,102,117,110,99,116,105,111,110,97,108,105,116,121,
+    10,32,32,32,32,98,101,116,119,101,101,110,32,105,109,112,
+    111,114,116,95,109,111,100,117,108,101,32,97,110,100,32,95,
+    95,105,109,112,111,114,116,95,95,46,32,84,104,105,115,32,
+    105,110,99,108,117,100,101,115,32,115,101,116,116,105,110,103,
+    32,95,95,112,97,99,107,97,103,101,95,95,32,105,102,10,
+    32,32,32,32,116,104,101,32,108,111,97,100,101,114,32,100,
+    105,100,32,110,111,116,46,10,10,32,32,32,32,3,11,95,
+    103,99,100,95,105,109,112,111,114,116,3,9,114,101,99,117,
+    114,115,105,118,101,2,238,1,70,105,103,117,114,101,32,111,
+    117,116,32,119,104,97,116,32,95,95,105,109,112,111,114,116,
+    95,95,32,115,104,111,117,108,100,32,114,101,116,117,114,110,
+    46,10,10,32,32,32,32,84,104,101,32,105,109,112,111,114,
+    116,95,32,112,97,114,97,109,101,116,101,114,32,105,115,32,
+    97,32,99,97,108,108,97,98,108,101,32,119,104,105,99,104,
+    32,116,97,107,101,115,32,116,104,101,32,110,97,109,101,32,
+    111,102,32,109,111,100,117,108,101,32,116,111,10,32,32,32,
+    32,105,109,112,111,114,116,46,32,73,116,32,105,115,32,114,
+    101,113,117,105,114,101,100,32,116,111,32,100,101,99,111,117,
+    112,108,101,32,116,104,101,32,102,117,110,99,116,105,111,110,
+    32,102,114,111,109,32,97,115,115,117,109,105,110,103,32,105,
+    109,112,111,114,116,108,105,98,39,115,10,32,32,32,32,105,
+    109,112,111,114,116,32,105,109,112,108,101,109,101,110,116,97,
+    116,105,111,110,32,105,115,32,100,101,115,105,114,101,100,46,
+    10,10,32,32,32,32,2,8,46,95,95,97,108,108,95,95,
+    2,13,96,96,102,114,111,109,32,108,105,115,116,39,39,2,
+    8,73,116,101,109,32,105,110,32,2,18,32,109,117,115,116,
+    32,98,101,32,115,116,114,44,32,110,111,116,32,2,1,42,
+    3,7,95,95,97,108,108,95,95,3,16,95,104,97,110,100,
+    108,101,95,102,114,111,109,108,105,115,116,3,8,102,114,111,
+    109,108,105,115,116,3,1,120,3,5,119,104,101,114,101,3,
+    9,102,114,111,109,95,110,97,109,101,3,3,101,120,99,2,
+    167,1,67,97,108,99,117,108,97,116,101,32,119,104,97,116,
+    32,95,95,112,97,99,107,97,103,101,95,95,32,115,104,111,
+    117,108,100,32,98,101,46,10,10,32,32,32,32,95,95,112,
+    97,99,107,97,103,101,95,95,32,105,115,32,110,111,116,32,
+    103,117,97,114,97,110,116,101,101,100,32,116,111,32,98,101,
+    32,100,101,102,105,110,101,100,32,111,114,32,99,111,117,108,
+    100,32,98,101,32,115,101,116,32,116,111,32,78,111,110,101,
+    10,32,32,32,32,116,111,32,114,101,112,114,101,115,101,110,
+    116,32,116,104,97,116,32,105,116,115,32,112,114,111,112,101,
+    114,32,118,97,108,117,101,32,105,115,32,117,110,107,110,111,
+    119,110,46,10,10,32,32,32,32,2,32,95,95,112,97,99,
+    107,97,103,101,95,95,32,33,61,32,95,95,115,112,101,99,
+    95,95,46,112,97,114,101,110,116,32,40,2,4,32,33,61,
+    32,2,1,41,3,10,115,116,97,99,107,108,101,118,101,108,
+    2,89,99,97,110,39,116,32,114,101,115,111,108,118,101,32,
+    112,97,99,107,97,103,101,32,102,114,111,109,32,95,95,115,
+    112,101,99,95,95,32,111,114,32,95,95,112,97,99,107,97,
+    103,101,95,95,44,32,102,97,108,108,105,110,103,32,98,97,
+    99,107,32,111,110,32,95,95,110,97,109,101,95,95,32,97,
+    110,100,32,95,95,112,97,116,104,95,95,3,7,103,108,111,
+    98,97,108,115,3,17,95,99,97,108,99,95,95,95,112,97,
+    99,107,97,103,101,95,95,2,215,3,73,109,112,111,114,116,
+    32,97,32,109,111,100,117,108,101,46,10,10,32,32,32,32,
+    84,104,101,32,39,103,108,111,98,97,108,115,39,32,97,114,
+    103,117,109,101,110,116,32,105,115,32,117,115,101,100,32,116,
+    111,32,105,110,102,101,114,32,119,104,101,114,101,32,116,104,
+    101,32,105,109,112,111,114,116,32,105,115,32,111,99,99,117,
+    114,114,105,110,103,32,102,114,111,109,10,32,32,32,32,116,
+    111,32,104,97,110,100,108,101,32,114,101,108,97,116,105,118,
+    101,32,105,109,112,111,114,116,115,46,32,84,104,101,32,39,
+    108,111,99,97,108,115,39,32,97,114,103,117,109,101,110,116,
+    32,105,115,32,105,103,110,111,114,101,100,46,32,84,104,101,
+    10,32,32,32,32,39,102,114,111,109,108,105,115,116,39,32,
+    97,114,103,117,109,101,110,116,32,115,112,101,99,105,102,105,
+    101,115,32,119,104,97,116,32,115,104,111,117,108,100,32,101,
+    120,105,115,116,32,97,115,32,97,116,116,114,105,98,117,116,
+    101,115,32,111,110,32,116,104,101,32,109,111,100,117,108,101,
+    10,32,32,32,32,98,101,105,110,103,32,105,109,112,111,114,
+    116,101,100,32,40,101,46,103,46,32,96,96,102,114,111,109,
+    32,109,111,100,117,108,101,32,105,109,112,111,114,116,32,60,
+    102,114,111,109,108,105,115,116,62,96,96,41,46,32,32,84,
+    104,101,32,39,108,101,118,101,108,39,10,32,32,32,32,97,
+    114,103,117,109,101,110,116,32,114,101,112,114,101,115,101,110,
+    116,115,32,116,104,101,32,112,97,99,107,97,103,101,32,108,
+    111,99,97,116,105,111,110,32,116,111,32,105,109,112,111,114,
+    116,32,102,114,111,109,32,105,110,32,97,32,114,101,108,97,
+    116,105,118,101,10,32,32,32,32,105,109,112,111,114,116,32,
+    40,101,46,103,46,32,96,96,102,114,111,109,32,46,46,112,
+    107,103,32,105,109,112,111,114,116,32,109,111,100,96,96,32,
+    119,111,117,108,100,32,104,97,118,101,32,97,32,39,108,101,
+    118,101,108,39,32,111,102,32,50,41,46,10,10,32,32,32,
+    32,3,9,112,97,114,116,105,116,105,111,110,3,6,108,111,
+    99,97,108,115,3,8,103,108,111,98,97,108,115,95,3,7,
+    99,117,116,95,111,102,102,3,10,95,95,105,109,112,111,114,
+    116,95,95,2,25,110,111,32,98,117,105,108,116,45,105,110,
+    32,109,111,100,117,108,101,32,110,97,109,101,100,32,3,18,
+    95,98,117,105,108,116,105,110,95,102,114,111,109,95,110,97,
+    109,101,2,250,1,83,101,116,117,112,32,105,109,112,111,114,
+    116,108,105,98,32,98,121,32,105,109,112,111,114,116,105,110,
+    103,32,110,101,101,100,101,100,32,98,117,105,108,116,45,105,
+    110,32,109,111,100,117,108,101,115,32,97,110,100,32,105,110,
+    106,101,99,116,105,110,103,32,116,104,101,109,10,32,32,32,
+    32,105,110,116,111,32,116,104,101,32,103,108,111,98,97,108,
+    32,110,97,109,101,115,112,97,99,101,46,10,10,32,32,32,
+    32,65,115,32,115,121,115,32,105,115,32,110,101,101,100,101,
+    100,32,102,111,114,32,115,121,115,46,109,111,100,117,108,101,
+    115,32,97,99,99,101,115,115,32,97,110,100,32,95,105,109,
+    112,32,105,115,32,110,101,101,100,101,100,32,116,111,32,108,
+    111,97,100,32,98,117,105,108,116,45,105,110,10,32,32,32,
+    32,109,111,100,117,108,101,115,44,32,116,104,111,115,101,32,
+    116,119,111,32,109,111,100,117,108,101,115,32,109,117,115,116,
+    32,98,101,32,101,120,112,108,105,99,105,116,108,121,32,112,
+    97,115,115,101,100,32,105,110,46,10,10,32,32,32,32,3,
+    5,105,116,101,109,115,3,10,115,121,115,95,109,111,100,117,
+    108,101,3,11,95,105,109,112,95,109,111,100,117,108,101,3,
+    11,109,111,100,117,108,101,95,116,121,112,101,3,11,115,101,
+    108,102,95,109,111,100,117,108,101,3,12,98,117,105,108,116,
+    105,110,95,110,97,109,101,3,14,98,117,105,108,116,105,110,
+    95,109,111,100,117,108,101,3,6,95,115,101,116,117,112,2,
+    48,73,110,115,116,97,108,108,32,105,109,112,111,114,116,101,
+    114,115,32,102,111,114,32,98,117,105,108,116,105,110,32,97,
+    110,100,32,102,114,111,122,101,110,32,109,111,100,117,108,101,
+    115,3,8,95,105,110,115,116,97,108,108,2,57,73,110,115,
+    116,97,108,108,32,105,109,112,111,114,116,101,114,115,32,116,
+    104,97,116,32,114,101,113,117,105,114,101,32,101,120,116,101,
+    114,110,97,108,32,102,105,108,101,115,121,115,116,101,109,32,
+    97,99,99,101,115,115,3,26,95,102,114,111,122,101,110,95,
+    105,109,112,111,114,116,108,105,98,95,101,120,116,101,114,110,
+    97,108,3,27,95,105,110,115,116,97,108,108,95,101,120,116,
+    101,114,110,97,108,95,105,109,112,111,114,116,101,114,115,3,
+    15,95,69,82,82,95,77,83,71,95,80,82,69,70,73,88,
+    3,6,111,98,106,101,99,116,3,8,60,109,111,100,117,108,
+    101,62,67,0,0,0,0,8,128,1,115,214,1,0,0,100,
+    0,90,0,100,1,100,2,132,0,90,1,100,3,90,2,100,
+    3,90,3,100,3,90,4,100,3,97,5,100,4,100,5,132,
+    0,90,6,100,6,100,7,132,0,90,7,105,0,90,8,105,
+    0,90,9,71,0,100,8,100,9,132,0,100,9,101,10,131,
+    3,90,11,71,0,100,10,100,11,132,0,100,11,131,2,90,
+    12,71,0,100,12,100,13,132,0,100,13,131,2,90,13,71,
+    0,100,14,100,15,132,0,100,15,131,2,90,14,100,16,100,
+    17,132,0,90,15,100,18,100,19,132,0,90,16,100,20,100,
+    21,132,0,90,17,100,22,100,23,156,1,100,24,100,25,132,
+    2,90,18,100,26,100,27,132,0,90,19,100,28,100,29,132,
+    0,90,20,100,30,100,31,132,0,90,21,100,32,100,33,132,
+    0,90,22,71,0,100,34,100,35,132,0,100,35,131,2,90,
+    23,100,3,100,3,100,36,156,2,100,37,100,38,132,2,90,
+    24,100,96,100,39,100,40,132,1,90,25,100,41,100,42,156,
+    1,100,43,100,44,132,2,90,26,100,45,100,46,132,0,90,
+    27,100,47,100,48,132,0,90,28,100,49,100,50,132,0,90,
+    29,100,51,100,52,132,0,90,30,100,53,100,54,132,0,90,
+    31,100,55,100,56,132,0,90,32,71,0,100,57,100,58,132,
+    0,100,58,131,2,90,33,71,0,100,59,100,60,132,0,100,
+    60,131,2,90,34,71,0,100,61,100,62,132,0,100,62,131,
+    2,90,35,100,63,100,64,132,0,90,36,100,65,100,66,132,
+    0,90,37,100,97,100,67,100,68,132,1,90,38,100,69,100,
+    70,132,0,90,39,100,71,90,40,101,40,100,72,23,0,90,
+    41,100,73,100,74,132,0,90,42,101,43,131,0,90,44,100,
+    75,100,76,132,0,90,45,100,98,100,78,100,79,132,1,90,
+    46,100,41,100,80,156,1,100,81,100,82,132,2,90,47,100,
+    83,100,84,132,0,90,48,100,99,100,86,100,87,132,1,90,
+    49,100,88,100,89,132,0,90,50,100,90,100,91,132,0,90,
+    51,100,92,100,93,132,0,90,52,100,94,100,95,132,0,90,
+    53,100,3,83,0,41,100,113,0,67,2,0,0,2,16,134,
+    1,115,38,0,0,0,122,4,124,0,106,0,87,0,83,0,
+    4,0,116,1,121,18,1,0,1,0,1,0,116,2,124,0,
+    131,1,106,0,6,0,89,0,83,0,119,0,169,1,78,41,
+    3,113,1,113,2,113,3,41,1,113,4,169,0,82,1,113,
+    5,113,6,46,115,12,0,0,0,2,1,8,1,12,1,14,
+    1,2,255,255,128,113,6,78,67,4,0,0,6,14,134,1,
+    115,56,0,0,0,100,1,68,0,93,16,125,2,116,0,124,
+    1,124,2,131,2,114,18,116,1,124,0,124,2,116,2,124,
+    1,124,2,131,2,131,3,1,0,113,2,124,0,106,3,160,
+    4,124,1,106,3,161,1,1,0,100,2,83,0,41,3,113,
+    7,41,4,113,8,113,9,113,1,113,10,78,41,5,113,11,
+    113,12,113,13,113,14,113,15,41,3,113,16,113,17,113,18,
+    82,1,82,1,113,5,113,19,80,115,12,0,0,0,8,2,
+    10,1,18,1,2,128,18,1,255,128,113,19,67,2,0,0,
+    2,4,134,1,115,12,0,0,0,116,0,116,1,131,1,124,
+    0,131,1,83,0,82,0,41,2,113,3,113,20,169,1,113,
+    21,82,1,82,1,113,5,113,22,96,115,4,0,0,0,12,
+    1,255,128,113,22,67,0,0,0,0,2,128,1,115,12,0,
+    0,0,101,0,90,1,100,0,90,2,100,1,83,0,41,2,
+    113,23,78,41,3,113,9,113,8,113,1,82,1,82,1,82,
+    1,113,5,113,23,122,115,6,0,0,0,8,0,4,1,255,
+    128,113,23,67,0,0,0,0,4,128,1,115,56,0,0,0,
+    101,0,90,1,100,0,90,2,100,1,90,3,100,2,100,3,
+    132,0,90,4,100,4,100,5,132,0,90,5,100,6,100,7,
+    132,0,90,6,100,8,100,9,132,0,90,7,100,10,100,11,
+    132,0,90,8,100,12,83,0,41,13,113,24,113,25,67,4,
+    0,0,4,4,134,1,115,48,0,0,0,116,0,160,1,161,
+    0,124,0,95,2,116,0,160,1,161,0,124,0,95,3,124,
+    1,124,0,95,4,100,0,124,0,95,5,100,1,124,0,95,
+    6,100,1,124,0,95,7,100,0,83,0,169,2,78,246,0,
+    41,8,113,26,113,27,113,28,113,29,113,21,113,30,113,31,
+    113,32,169,2,113,33,113,21,82,1,82,1,113,5,113,34,
+    142,1,115,14,0,0,0,10,1,10,1,6,1,6,1,6,
+    1,10,1,255,128,113,35,67,2,0,0,10,6,134,1,115,
+    86,0,0,0,116,0,160,1,161,0,125,1,124,0,106,2,
+    125,2,116,3,131,0,125,3,9,0,116,4,160,5,124,2,
+    161,1,125,4,124,4,100,0,117,0,114,22,100,2,83,0,
+    124,4,106,2,125,2,124,2,124,1,107,2,114,31,100,1,
+    83,0,124,2,124,3,118,0,114,37,100,2,83,0,124,3,
+    160,6,124,2,161,1,1,0,113,11,41,3,78,84,70,41,
+    7,113,26,113,36,113,30,113,37,113,38,113,39,113,40,41,
+    5,113,33,113,41,113,42,113,43,113,28,82,1,82,1,113,
+    5,113,44,158,1,115,30,0,0,0,8,2,6,1,6,1,
+    2,1,10,1,8,1,4,1,6,1,8,1,4,1,8,1,
+    4,6,10,1,2,242,255,128,113,45,67,2,0,0,4,16,
+    134,1,115,198,0,0,0,116,0,160,1,161,0,125,1,124,
+    0,116,2,124,1,60,0,122,86,9,0,124,0,106,3,143,
+    63,1,0,124,0,106,4,100,2,107,2,115,24,124,0,106,
+    5,124,1,107,2,114,46,124,1,124,0,95,5,124,0,4,
+    0,106,4,100,3,55,0,2,0,95,4,87,0,100,4,4,
+    0,4,0,131,3,1,0,87,0,116,2,124,1,61,0,100,
+    1,83,0,124,0,160,6,161,0,114,56,116,7,100,5,124,
+    0,22,0,131,1,130,1,124,0,106,8,160,9,100,6,161,
+    1,114,69,124,0,4,0,106,10,100,3,55,0,2,0,95,
+    10,87,0,100,4,4,0,4,0,131,3,1,0,110,8,49,
+    0,115,79,119,1,1,0,1,0,1,0,89,0,1,0,124,
+    0,106,8,160,9,161,0,1,0,124,0,106,8,160,11,161,
+    0,1,0,113,10,116,2,124,1,61,0,119,0,41,7,113,
+    46,84,82,4,246,2,78,113,47,70,41,12,113,26,113,36,
+    113,38,113,28,113,31,113,30,113,44,113,23,113,29,113,48,
+    113,32,113,49,169,2,113,33,113,42,82,1,82,1,113,5,
+    113,48,200,1,115,40,0,0,0,8,6,8,1,2,1,2,
+    1,8,1,20,1,6,1,14,1,14,1,10,9,8,248,12,
+    1,12,1,14,1,30,128,10,2,10,1,2,244,8,14,255,
+    128,113,50,67,2,0,0,4,16,134,1,115,144,0,0,0,
+    116,0,160,1,161,0,125,1,124,0,106,2,143,55,1,0,
+    124,0,106,3,124,1,107,3,114,17,116,4,100,1,131,1,
+    130,1,124,0,106,5,100,2,107,4,115,24,74,0,130,1,
+    124,0,4,0,106,5,100,3,56,0,2,0,95,5,124,0,
+    106,5,100,2,107,2,114,54,100,0,124,0,95,3,124,0,
+    106,6,114,54,124,0,4,0,106,6,100,3,56,0,2,0,
+    95,6,124,0,106,7,160,8,161,0,1,0,87,0,100,0,
+    4,0,4,0,131,3,1,0,100,0,83,0,49,0,115,65,
+    119,1,1,0,1,0,1,0,89,0,1,0,100,0,83,0,
+    41,4,78,113,51,82,4,82,6,41,9,113,26,113,36,113,
+    28,113,30,113,52,113,31,113,32,113,29,113,49,82,7,82,
+    1,82,1,113,5,113,49,250,1,115,26,0,0,0,8,1,
+    8,1,10,1,8,1,14,1,14,1,10,1,6,1,6,1,
+    14,1,10,1,36,128,255,128,113,53,67,2,0,0,2,10,
+    134,1,243,18,0,0,0,100,1,160,0,124,0,106,1,116,
+    2,124,0,131,1,161,2,83,0,41,2,78,113,54,169,3,
+    113,55,113,21,113,56,169,1,113,33,82,1,82,1,113,5,
+    113,57,148,2,243,4,0,0,0,18,1,255,128,113,58,78,
+    41,9,113,9,113,8,113,1,113,10,113,34,113,44,113,48,
+    113,49,113,57,82,1,82,1,82,1,113,5,113,24,130,1,
+    115,16,0,0,0,8,0,4,1,8,5,8,8,8,21,8,
+    25,12,13,255,128,113,24,67,0,0,0,0,4,128,1,115,
+    48,0,0,0,101,0,90,1,100,0,90,2,100,1,90,3,
+    100,2,100,3,132,0,90,4,100,4,100,5,132,0,90,5,
+    100,6,100,7,132,0,90,6,100,8,100,9,132,0,90,7,
+    100,10,83,0,41,11,113,59,113,60,67,4,0,0,4,4,
+    134,1,115,16,0,0,0,124,1,124,0,95,0,100,1,124,
+    0,95,1,100,0,83,0,82,3,41,2,113,21,113,31,82,
+    5,82,1,82,1,113,5,113,34,164,2,243,6,0,0,0,
+    6,1,10,1,255,128,113,61,67,2,0,0,2,6,134,1,
+    115,18,0,0,0,124,0,4,0,106,0,100,1,55,0,2,
+    0,95,0,100,2,83,0,41,3,78,82,6,84,41,1,113,
+    31,82,10,82,1,82,1,113,5,113,48,172,2,115,6,0,
+    0,0,14,1,4,1,255,128,113,62,67,2,0,0,2,6,
+    134,1,115,36,0,0,0,124,0,106,0,100,1,107,2,114,
+    9,116,1,100,2,131,1,130,1,124,0,4,0,106,0,100,
+    3,56,0,2,0,95,0,100,0,83,0,41,4,78,82,4,
+    113,51,82,6,41,2,113,31,113,52,82,10,82,1,82,1,
+    113,5,113,49,180,2,115,8,0,0,0,10,1,8,1,18,
+    1,255,128,113,63,67,2,0,0,2,10,134,1,82,8,41,
+    2,78,113,64,82,9,82,10,82,1,82,1,113,5,113,57,
+    190,2,82,11,113,65,78,41,8,113,9,113,8,113,1,113,
+    10,113,34,113,48,113,49,113,57,82,1,82,1,82,1,113,
+    5,113,59,156,2,115,14,0,0,0,8,0,4,1,8,3,
+    8,4,8,4,12,5,255,128,113,59,67,0,0,0,0,4,
+    128,1,115,36,0,0,0,101,0,90,1,100,0,90,2,100,
+    1,100,2,132,0,90,3,100,3,100,4,132,0,90,4,100,
+    5,100,6,132,0,90,5,100,7,83,0,41,8,113,66,67,
+    4,0,0,4,4,134,1,115,16,0,0,0,124,1,124,0,
+    95,0,100,0,124,0,95,1,100,0,83,0,82,0,41,2,
+    113,67,113,68,82,5,82,1,82,1,113,5,113,34,202,2,
+    82,12,113,69,67,2,0,0,2,4,134,1,115,26,0,0,
+    0,116,0,124,0,106,1,131,1,124,0,95,2,124,0,106,
+    2,160,3,161,0,1,0,100,0,83,0,82,0,41,4,113,
+    70,113,67,113,68,113,48,82,10,82,1,82,1,113,5,113,
+    71,210,2,115,6,0,0,0,12,1,14,1,255,128,113,72,
+    67,2,0,0,6,4,158,1,115,14,0,0,0,124,0,106,
+    0,160,1,161,0,1,0,100,0,83,0,82,0,41,2,113,
+    68,113,49,41,3,113,33,113,73,113,74,82,1,82,1,113,
+    5,113,75,218,2,115,4,0,0,0,14,1,255,128,113,76,
+    78,41,6,113,9,113,8,113,1,113,34,113,71,113,75,82,
+    1,82,1,82,1,113,5,113,66,198,2,115,10,0,0,0,
+    8,0,8,2,8,4,12,4,255,128,113,66,67,2,0,0,
+    6,16,134,1,115,132,0,0,0,116,0,160,1,161,0,1,
+    0,122,55,122,7,116,2,124,0,25,0,131,0,125,1,87,
+    0,110,9,4,0,116,3,121,65,1,0,1,0,1,0,100,
+    1,125,1,89,0,124,1,100,1,117,0,114,53,116,4,100,
+    1,117,0,114,35,116,5,124,0,131,1,125,1,110,4,116,
+    6,124,0,131,1,125,1,124,0,102,1,100,2,100,3,132,
+    1,125,2,116,7,160,8,124,1,124,2,161,2,116,2,124,
+    0,60,0,87,0,116,0,160,9,161,0,1,0,124,1,83,
+    0,116,0,160,9,161,0,1,0,119,0,119,0,41,4,113,
+    77,78,67,4,0,0,4,16,166,1,115,54,0,0,0,116,
+    0,160,1,161,0,1,0,122,17,116,2,160,3,124,1,161,
+    1,124,0,117,0,114,15,116,2,124,1,61,0,87,0,116,
+    0,160,4,161,0,1,0,100,0,83,0,116,0,160,4,161,
+    0,1,0,119,0,82,0,41,5,113,78,113,79,113,80,113,
+    39,113,81,41,2,113,82,113,21,82,1,82,1,113,5,113,
+    83,140,3,115,14,0,0,0,8,1,2,1,14,4,6,1,
+    2,128,22,2,255,128,113,84,41,10,113,78,113,79,113,80,
+    113,85,113,26,113,59,113,24,113,86,113,82,113,81,41,3,
+    113,21,113,28,113,83,82,1,82,1,113,5,113,70,230,2,
+    115,36,0,0,0,8,6,2,1,2,1,14,1,12,1,6,
+    1,8,2,8,1,10,1,8,2,12,2,16,11,2,128,8,
+    2,4,2,10,254,2,234,255,128,113,70,67,2,0,0,4,
+    16,134,1,115,54,0,0,0,116,0,124,0,131,1,125,1,
+    122,6,124,1,160,1,161,0,1,0,87,0,110,9,4,0,
+    116,2,121,26,1,0,1,0,1,0,89,0,100,1,83,0,
+    124,1,160,3,161,0,1,0,100,1,83,0,119,0,41,2,
+    113,87,78,41,4,113,70,113,48,113,23,113,49,41,2,113,
+    21,113,28,82,1,82,1,113,5,113,88,176,3,115,16,0,
+    0,0,8,6,2,1,12,1,12,1,6,3,12,2,2,251,
+    255,128,113,88,67,2,0,0,6,8,158,1,115,14,0,0,
+    0,124,0,124,1,105,0,124,2,164,1,142,1,83,0,41,
+    2,113,89,78,82,1,41,3,113,90,113,73,113,91,82,1,
+    82,1,113,5,113,92,210,3,115,4,0,0,0,14,8,255,
+    128,113,92,82,6,41,1,113,93,67,2,0,2,6,8,142,
+    1,115,58,0,0,0,116,0,106,1,106,2,124,1,107,5,
+    114,27,124,0,160,3,100,1,161,1,115,15,100,2,124,0,
+    23,0,125,0,116,4,124,0,106,5,124,2,142,0,116,0,
+    106,6,100,3,141,2,1,0,100,4,83,0,100,4,83,0,
+    41,5,113,94,41,2,113,95,113,96,113,97,41,1,113,98,
+    78,41,7,113,20,113,99,113,100,113,101,113,102,113,55,113,
+    103,41,3,113,104,113,93,113,73,82,1,82,1,113,5,113,
+    105,232,3,115,12,0,0,0,12,2,10,1,8,1,24,1,
+    4,253,255,128,113,105,67,2,0,0,4,6,6,243,26,0,
+    0,0,135,0,102,1,100,1,100,2,132,8,125,1,116,0,
+    124,1,136,0,131,2,1,0,124,1,83,0,41,4,113,106,
+    67,4,0,0,4,8,38,115,38,0,0,0,124,1,116,0,
+    106,1,118,1,114,14,116,2,100,1,160,3,124,1,161,1,
+    124,1,100,2,141,2,130,1,136,0,124,0,124,1,131,2,
+    83,0,41,3,78,113,107,82,2,41,4,113,20,113,108,113,
+    109,113,55,169,2,113,33,113,110,169,1,113,111,82,1,113,
+    5,113,112,252,3,243,12,0,0,0,10,1,10,1,2,1,
+    6,255,10,2,255,128,113,113,78,169,1,113,19,41,2,113,
+    111,113,112,82,1,82,15,113,5,113,114,248,3,243,8,0,
+    0,0,12,2,10,5,4,1,255,128,113,114,67,2,0,0,
+    4,6,6,82,13,41,4,113,115,67,4,0,0,4,8,38,
+    115,38,0,0,0,116,0,160,1,124,1,161,1,115,14,116,
+    2,100,1,160,3,124,1,161,1,124,1,100,2,141,2,130,
+    1,136,0,124,0,124,1,131,2,83,0,169,3,78,113,116,
+    82,2,41,4,113,78,113,117,113,109,113,55,82,14,82,15,
+    82,1,113,5,113,118,146,4,82,16,113,119,78,82,17,41,
+    2,113,111,113,118,82,1,82,15,113,5,113,120,142,4,82,
+    18,113,120,67,4,0,0,10,8,134,1,115,74,0,0,0,
+    100,1,125,2,116,0,160,1,124,2,116,2,161,2,1,0,
+    116,3,124,1,124,0,131,2,125,3,124,1,116,4,106,5,
+    118,0,114,33,116,4,106,5,124,1,25,0,125,4,116,6,
+    124,3,124,4,131,2,1,0,116,4,106,5,124,1,25,0,
+    83,0,116,7,124,3,131,1,83,0,41,3,113,121,113,122,
+    78,41,8,113,123,113,124,113,125,113,126,113,20,113,127,113,
+    128,1,113,129,1,41,5,113,33,113,110,113,130,1,113,131,
+    1,113,132,1,82,1,82,1,113,5,113,133,1,166,4,115,
+    18,0,0,0,4,6,12,2,10,1,10,1,10,1,10,1,
+    10,1,8,2,255,128,113,133,1,67,2,0,0,10,16,134,
+    1,115,184,0,0,0,116,0,124,0,100,1,100,2,131,3,
+    125,1,116,0,124,0,100,3,100,2,131,3,4,0,125,2,
+    114,18,116,1,124,2,131,1,83,0,116,2,124,1,100,4,
+    131,2,114,37,122,6,124,1,160,3,124,0,161,1,87,0,
+    83,0,4,0,116,4,121,91,1,0,1,0,1,0,89,0,
+    122,5,124,0,106,5,125,3,87,0,110,9,4,0,116,6,
+    121,90,1,0,1,0,1,0,100,5,125,3,89,0,122,5,
+    124,0,106,7,125,4,87,0,110,25,4,0,116,6,121,89,
+    1,0,1,0,1,0,124,1,100,2,117,0,114,75,100,6,
+    160,8,124,3,161,1,6,0,89,0,83,0,100,7,160,8,
+    124,3,124,1,161,2,6,0,89,0,83,0,100,8,160,8,
+    124,3,124,4,161,2,83,0,119,0,119,0,119,0,41,9,
+    113,134,1,113,135,1,78,113,136,1,113,137,1,113,138,1,
+    113,139,1,113,140,1,113,141,1,41,9,113,13,113,142,1,
+    113,11,113,137,1,113,143,1,113,9,113,2,113,144,1,113,
+    55,41,5,113,132,1,113,145,1,113,131,1,113,21,113,146,
+    1,82,1,82,1,113,5,113,147,1,204,4,115,46,0,0,
+    0,12,2,16,1,8,1,10,1,2,1,12,1,12,1,2,
+    1,2,2,10,1,12,1,6,1,2,1,10,1,12,1,8,
+    1,14,1,16,2,12,2,2,250,2,252,2,251,255,128,113,
+    147,1,67,0,0,0,0,8,128,1,115,114,0,0,0,101,
+    0,90,1,100,0,90,2,100,1,90,3,100,2,100,2,100,
+    2,100,3,156,3,100,4,100,5,132,2,90,4,100,6,100,
+    7,132,0,90,5,100,8,100,9,132,0,90,6,101,7,100,
+    10,100,11,132,0,131,1,90,8,101,8,106,9,100,12,100,
+    11,132,0,131,1,90,8,101,7,100,13,100,14,132,0,131,
+    1,90,10,101,7,100,15,100,16,132,0,131,1,90,11,101,
+    11,106,9,100,17,100,16,132,0,131,1,90,11,100,2,83,
+    0,41,18,113,148,1,113,149,1,78,41,3,113,150,1,113,
+    151,1,113,152,1,67,6,0,6,12,4,134,1,115,54,0,
+    0,0,124,1,124,0,95,0,124,2,124,0,95,1,124,3,
+    124,0,95,2,124,4,124,0,95,3,124,5,114,16,103,0,
+    110,1,100,0,124,0,95,4,100,1,124,0,95,5,100,0,
+    124,0,95,6,100,0,83,0,41,2,78,70,41,7,113,21,
+    113,145,1,113,150,1,113,151,1,113,153,1,113,154,1,113,
+    155,1,41,6,113,33,113,21,113,145,1,113,150,1,113,151,
+    1,113,152,1,82,1,82,1,113,5,113,34,202,5,115,16,
+    0,0,0,6,2,6,1,6,1,6,1,14,1,6,3,10,
+    1,255,128,113,156,1,67,2,0,0,4,12,134,1,115,102,
+    0,0,0,100,1,160,0,124,0,106,1,161,1,100,2,160,
+    0,124,0,106,2,161,1,103,2,125,1,124,0,106,3,100,
+    0,117,1,114,26,124,1,160,4,100,3,160,0,124,0,106,
+    3,161,1,161,1,1,0,124,0,106,5,100,0,117,1,114,
+    40,124,1,160,4,100,4,160,0,124,0,106,5,161,1,161,
+    1,1,0,100,5,160,0,124,0,106,6,106,7,100,6,160,
+    8,124,1,161,1,161,2,83,0,41,7,78,113,157,1,113,
+    158,1,113,159,1,113,160,1,113,161,1,113,162,1,41,9,
+    113,55,113,21,113,145,1,113,150,1,113,163,1,113,153,1,
+    113,164,1,113,9,113,165,1,41,2,113,33,113,73,82,1,
+    82,1,113,5,113,57,226,5,115,22,0,0,0,10,1,10,
+    1,4,255,10,2,18,1,10,1,6,1,8,1,4,255,22,
+    2,255,128,113,166,1,67,4,0,0,6,16,134,1,115,102,
+    0,0,0,124,0,106,0,125,2,122,36,124,0,106,1,124,
+    1,106,1,107,2,111,38,124,0,106,2,124,1,106,2,107,
+    2,111,38,124,0,106,3,124,1,106,3,107,2,111,38,124,
+    2,124,1,106,0,107,2,111,38,124,0,106,4,124,1,106,
+    4,107,2,111,38,124,0,106,5,124,1,106,5,107,2,87,
+    0,83,0,4,0,116,6,121,50,1,0,1,0,1,0,116,
+    7,6,0,89,0,83,0,119,0,82,0,41,8,113,153,1,
+    113,21,113,145,1,113,150,1,113,167,1,113,168,1,113,2,
+    113,169,1,41,3,113,33,113,170,1,113,171,1,82,1,82,
+    1,113,5,113,172,1,246,5,115,34,0,0,0,6,1,2,
+    1,12,1,10,1,2,255,10,2,2,254,8,3,2,253,10,
+    4,2,252,10,5,4,251,12,6,8,1,2,255,255,128,113,
+    173,1,67,2,0,0,2,6,134,1,115,58,0,0,0,124,
+    0,106,0,100,0,117,0,114,26,124,0,106,1,100,0,117,
+    1,114,26,124,0,106,2,114,26,116,3,100,0,117,0,114,
+    19,116,4,130,1,116,3,160,5,124,0,106,1,161,1,124,
+    0,95,0,124,0,106,0,83,0,82,0,41,6,113,155,1,
+    113,150,1,113,154,1,113,174,1,113,175,1,113,176,1,82,
+    10,82,1,82,1,113,5,113,167,1,142,6,115,14,0,0,
+    0,10,2,16,1,8,1,4,1,14,1,6,1,255,128,113,
+    177,1,67,4,0,0,4,4,134,1,115,10,0,0,0,124,
+    1,124,0,95,0,100,0,83,0,82,0,41,1,113,155,1,
+    41,2,113,33,113,167,1,82,1,82,1,113,5,113,167,1,
+    160,6,115,4,0,0,0,10,2,255,128,67,2,0,0,2,
+    6,134,1,115,32,0,0,0,124,0,106,0,100,1,117,0,
+    114,13,124,0,106,1,160,2,100,2,161,1,100,3,25,0,
+    83,0,124,0,106,1,83,0,41,4,113,178,1,78,113,179,
+    1,82,4,41,3,113,153,1,113,21,113,180,1,82,10,82,
+    1,82,1,113,5,113,181,1,168,6,115,8,0,0,0,10,
+    3,16,1,6,2,255,128,113,182,1,67,2,0,0,2,2,
+    134,1,115,6,0,0,0,124,0,106,0,83,0,82,0,41,
+    1,113,154,1,82,10,82,1,82,1,113,5,113,168,1,184,
+    6,115,4,0,0,0,6,2,255,128,113,183,1,67,4,0,
+    0,4,4,134,1,115,14,0,0,0,116,0,124,1,131,1,
+    124,0,95,1,100,0,83,0,82,0,41,2,113,184,1,113,
+    154,1,41,2,113,33,113,185,1,82,1,82,1,113,5,113,
+    168,1,192,6,115,4,0,0,0,14,2,255,128,41,12,113,
+    9,113,8,113,1,113,10,113,34,113,57,113,172,1,113,186,
+    1,113,167,1,113,187,1,113,181,1,113,168,1,82,1,82,
+    1,82,1,113,5,113,148,1,128,5,115,36,0,0,0,8,
+    0,4,1,4,36,2,1,12,255,8,12,8,10,2,12,10,
+    1,4,8,10,1,2,3,10,1,2,7,10,1,4,3,14,
+    1,255,128,113,148,1,169,2,113,150,1,113,152,1,67,4,
+    0,4,12,16,134,1,115,150,0,0,0,116,0,124,1,100,
+    1,131,2,114,37,116,1,100,2,117,0,114,11,116,2,130,
+    1,116,1,106,3,125,4,124,3,100,2,117,0,114,24,124,
+    4,124,0,124,1,100,3,141,2,83,0,124,3,114,28,103,
+    0,110,1,100,2,125,5,124,4,124,0,124,1,124,5,100,
+    4,141,3,83,0,124,3,100,2,117,0,114,66,116,0,124,
+    1,100,5,131,2,114,64,122,7,124,1,160,4,124,0,161,
+    1,125,3,87,0,110,12,4,0,116,5,121,74,1,0,1,
+    0,1,0,100,2,125,3,89,0,110,2,100,6,125,3,116,
+    6,124,0,124,1,124,2,124,3,100,7,141,4,83,0,119,
+    0,41,8,113,188,1,113,189,1,78,41,1,113,145,1,41,
+    2,113,145,1,113,153,1,113,152,1,70,82,20,41,7,113,
+    11,113,174,1,113,175,1,113,190,1,113,152,1,113,109,113,
+    148,1,41,6,113,21,113,145,1,113,150,1,113,152,1,113,
+    190,1,113,191,1,82,1,82,1,113,5,113,126,202,6,115,
+    40,0,0,0,10,2,8,1,4,1,6,1,8,2,12,1,
+    12,1,6,1,2,1,6,255,8,3,10,1,2,1,14,1,
+    12,1,8,1,4,3,16,2,2,250,255,128,113,126,67,6,
+    0,0,16,16,134,1,115,30,1,0,0,122,5,124,0,106,
+    0,125,3,87,0,110,8,4,0,116,1,121,142,1,0,1,
+    0,1,0,89,0,110,6,124,3,100,0,117,1,114,20,124,
+    3,83,0,124,0,106,2,125,4,124,1,100,0,117,0,114,
+    40,122,5,124,0,106,3,125,1,87,0,110,7,4,0,116,
+    1,121,141,1,0,1,0,1,0,89,0,122,5,124,0,106,
+    4,125,5,87,0,110,9,4,0,116,1,121,140,1,0,1,
+    0,1,0,100,0,125,5,89,0,124,2,100,0,117,0,114,
+    81,124,5,100,0,117,0,114,79,122,5,124,1,106,5,125,
+    2,87,0,110,12,4,0,116,1,121,139,1,0,1,0,1,
+    0,100,0,125,2,89,0,110,2,124,5,125,2,122,5,124,
+    0,106,6,125,6,87,0,110,9,4,0,116,1,121,138,1,
+    0,1,0,1,0,100,0,125,6,89,0,122,7,116,7,124,
+    0,106,8,131,1,125,7,87,0,110,9,4,0,116,1,121,
+    137,1,0,1,0,1,0,100,0,125,7,89,0,116,9,124,
+    4,124,1,124,2,100,1,141,3,125,3,124,5,100,0,117,
+    0,114,126,100,2,110,1,100,3,124,3,95,10,124,6,124,
+    3,95,11,124,7,124,3,95,12,124,3,83,0,119,0,119,
+    0,119,0,119,0,119,0,119,0,41,4,78,169,1,113,150,
+    1,70,84,41,13,113,136,1,113,2,113,9,113,135,1,113,
+    144,1,113,192,1,113,193,1,113,194,1,113,195,1,113,148,
+    1,113,154,1,113,167,1,113,153,1,41,8,113,132,1,113,
+    145,1,113,150,1,113,131,1,113,21,113,196,1,113,167,1,
+    113,153,1,82,1,82,1,113,5,113,197,1,254,6,115,86,
+    0,0,0,2,2,10,1,12,1,4,1,8,2,4,1,6,
+    2,8,1,2,1,10,1,12,1,2,2,2,1,10,1,12,
+    1,6,1,8,1,8,1,2,1,10,1,12,1,8,1,4,
+    2,2,1,10,1,12,1,6,1,2,1,14,1,12,1,6,
+    1,14,2,18,1,6,1,6,1,4,1,2,249,2,252,2,
+    250,2,250,2,251,2,246,255,128,113,197,1,70,169,1,113,
+    198,1,67,4,0,2,10,16,134,1,115,178,1,0,0,124,
+    2,115,10,116,0,124,1,100,1,100,0,131,3,100,0,117,
+    0,114,24,122,6,124,0,106,1,124,1,95,2,87,0,110,
+    7,4,0,116,3,121,216,1,0,1,0,1,0,89,0,124,
+    2,115,34,116,0,124,1,100,2,100,0,131,3,100,0,117,
+    0,114,83,124,0,106,4,125,3,124,3,100,0,117,0,114,
+    70,124,0,106,5,100,0,117,1,114,70,116,6,100,0,117,
+    0,114,52,116,7,130,1,116,6,106,8,125,4,124,4,160,
+    9,124,4,161,1,125,3,124,0,106,5,124,3,95,10,124,
+    3,124,0,95,4,100,0,124,1,95,11,122,5,124,3,124,
+    1,95,12,87,0,110,7,4,0,116,3,121,215,1,0,1,
+    0,1,0,89,0,124,2,115,93,116,0,124,1,100,3,100,
+    0,131,3,100,0,117,0,114,107,122,6,124,0,106,13,124,
+    1,95,14,87,0,110,7,4,0,116,3,121,214,1,0,1,
+    0,1,0,89,0,122,5,124,0,124,1,95,15,87,0,110,
+    7,4,0,116,3,121,213,1,0,1,0,1,0,89,0,124,
+    2,115,130,116,0,124,1,100,4,100,0,131,3,100,0,117,
+    0,114,149,124,0,106,5,100,0,117,1,114,149,122,6,124,
+    0,106,5,124,1,95,16,87,0,110,7,4,0,116,3,121,
+    212,1,0,1,0,1,0,89,0,124,0,106,17,114,208,124,
+    2,115,162,116,0,124,1,100,5,100,0,131,3,100,0,117,
+    0,114,176,122,6,124,0,106,18,124,1,95,11,87,0,110,
+    7,4,0,116,3,121,211,1,0,1,0,1,0,89,0,124,
+    2,115,186,116,0,124,1,100,6,100,0,131,3,100,0,117,
+    0,114,208,124,0,106,19,100,0,117,1,114,208,122,7,124,
+    0,106,19,124,1,95,20,87,0,124,1,83,0,4,0,116,
+    3,121,210,1,0,1,0,1,0,89,0,124,1,83,0,124,
+    1,83,0,119,0,119,0,119,0,119,0,119,0,119,0,119,
+    0,41,7,78,113,9,113,135,1,113,199,1,113,195,1,113,
+    144,1,113,193,1,41,21,113,13,113,21,113,9,113,2,113,
+    145,1,113,153,1,113,174,1,113,175,1,113,200,1,113,201,
+    1,113,202,1,113,144,1,113,135,1,113,181,1,113,199,1,
+    113,136,1,113,195,1,113,168,1,113,150,1,113,167,1,113,
+    193,1,41,5,113,131,1,113,132,1,113,198,1,113,145,1,
+    113,200,1,82,1,82,1,113,5,113,203,1,216,7,115,114,
+    0,0,0,20,4,2,1,12,1,12,1,2,1,20,2,6,
+    1,8,1,10,2,8,1,4,1,6,1,10,2,8,1,6,
+    1,6,11,2,1,10,1,12,1,2,1,20,2,2,1,12,
+    1,12,1,2,1,2,2,10,1,12,1,2,1,20,2,10,
+    1,2,1,12,1,12,1,2,1,6,2,20,1,2,1,12,
+    1,12,1,2,1,20,2,10,1,2,1,10,1,4,3,12,
+    254,2,1,8,1,2,254,2,249,2,249,2,249,2,251,2,
+    250,2,228,255,128,113,203,1,67,2,0,0,4,6,134,1,
+    115,82,0,0,0,100,1,125,1,116,0,124,0,106,1,100,
+    2,131,2,114,15,124,0,106,1,160,2,124,0,161,1,125,
+    1,110,10,116,0,124,0,106,1,100,3,131,2,114,25,116,
+    3,100,4,131,1,130,1,124,1,100,1,117,0,114,34,116,
+    4,124,0,106,5,131,1,125,1,116,6,124,0,124,1,131,
+    2,1,0,124,1,83,0,41,5,113,204,1,78,113,205,1,
+    113,206,1,113,207,1,41,7,113,11,113,145,1,113,205,1,
+    113,109,113,22,113,21,113,203,1,169,2,113,131,1,113,132,
+    1,82,1,82,1,113,5,113,208,1,232,8,115,20,0,0,
+    0,4,3,12,1,14,3,12,1,8,1,8,2,10,1,10,
+    1,4,1,255,128,113,208,1,67,2,0,0,4,8,134,1,
+    115,100,0,0,0,124,0,106,0,100,1,117,0,114,7,100,
+    2,110,2,124,0,106,0,125,1,124,0,106,1,100,1,117,
+    0,114,32,124,0,106,2,100,1,117,0,114,25,100,3,160,
+    3,124,1,161,1,83,0,100,4,160,3,124,1,124,0,106,
+    2,161,2,83,0,124,0,106,4,114,42,100,5,160,3,124,
+    1,124,0,106,1,161,2,83,0,100,6,160,3,124,0,106,
+    0,124,0,106,1,161,2,83,0,41,7,113,209,1,78,113,
+    138,1,113,139,1,113,140,1,113,141,1,113,210,1,41,5,
+    113,21,113,150,1,113,145,1,113,55,113,168,1,41,2,113,
+    131,1,113,21,82,1,82,1,113,5,113,142,1,138,9,115,
+    18,0,0,0,20,3,10,1,10,1,10,1,14,2,6,2,
+    14,1,16,2,255,128,113,142,1,67,4,0,0,8,20,134,
+    1,115,24,1,0,0,124,0,106,0,125,2,116,1,124,2,
+    131,1,143,123,1,0,116,2,106,3,160,4,124,2,161,1,
+    124,1,117,1,114,27,100,1,160,5,124,2,161,1,125,3,
+    116,6,124,3,124,2,100,2,141,2,130,1,122,80,124,0,
+    106,7,100,3,117,0,114,53,124,0,106,8,100,3,117,0,
+    114,45,116,6,100,4,124,0,106,0,100,2,141,2,130,1,
+    116,9,124,0,124,1,100,5,100,6,141,3,1,0,110,40,
+    116,9,124,0,124,1,100,5,100,6,141,3,1,0,116,10,
+    124,0,106,7,100,7,131,2,115,87,116,11,124,0,106,7,
+    131,1,155,0,100,8,157,2,125,3,116,12,160,13,124,3,
+    116,14,161,2,1,0,124,0,106,7,160,15,124,2,161,1,
+    1,0,110,6,124,0,106,7,160,16,124,1,161,1,1,0,
+    87,0,116,2,106,3,160,17,124,0,106,0,161,1,125,1,
+    124,1,116,2,106,3,124,0,106,0,60,0,110,14,116,2,
+    106,3,160,17,124,0,106,0,161,1,125,1,124,1,116,2,
+    106,3,124,0,106,0,60,0,119,0,87,0,100,3,4,0,
+    4,0,131,3,1,0,124,1,83,0,49,0,115,133,119,1,
+    1,0,1,0,1,0,89,0,1,0,124,1,83,0,41,9,
+    113,211,1,113,212,1,82,2,78,113,213,1,84,82,22,113,
+    206,1,113,214,1,41,18,113,21,113,66,113,20,113,127,113,
+    39,113,55,113,109,113,145,1,113,153,1,113,203,1,113,11,
+    113,6,113,123,113,124,113,215,1,113,216,1,113,206,1,113,
+    217,1,41,4,113,131,1,113,132,1,113,21,113,130,1,82,
+    1,82,1,113,5,113,128,1,172,9,115,50,0,0,0,6,
+    2,10,1,16,1,10,1,12,1,2,1,10,1,10,1,14,
+    1,16,2,14,2,12,1,16,1,12,2,14,1,12,2,2,
+    128,14,4,14,1,14,255,26,1,4,1,16,128,4,0,255,
+    128,113,128,1,67,2,0,0,4,16,134,1,115,10,1,0,
+    0,122,9,124,0,106,0,160,1,124,0,106,2,161,1,1,
+    0,87,0,110,23,1,0,1,0,1,0,124,0,106,2,116,
+    3,106,4,118,0,114,32,116,3,106,4,160,5,124,0,106,
+    2,161,1,125,1,124,1,116,3,106,4,124,0,106,2,60,
+    0,130,0,116,3,106,4,160,5,124,0,106,2,161,1,125,
+    1,124,1,116,3,106,4,124,0,106,2,60,0,116,6,124,
+    1,100,1,100,0,131,3,100,0,117,0,114,68,122,6,124,
+    0,106,0,124,1,95,7,87,0,110,7,4,0,116,8,121,
+    132,1,0,1,0,1,0,89,0,116,6,124,1,100,2,100,
+    0,131,3,100,0,117,0,114,104,122,20,124,1,106,9,124,
+    1,95,10,116,11,124,1,100,3,131,2,115,95,124,0,106,
+    2,160,12,100,4,161,1,100,5,25,0,124,1,95,10,87,
+    0,110,7,4,0,116,8,121,131,1,0,1,0,1,0,89,
+    0,116,6,124,1,100,6,100,0,131,3,100,0,117,0,114,
+    128,122,6,124,0,124,1,95,13,87,0,124,1,83,0,4,
+    0,116,8,121,130,1,0,1,0,1,0,89,0,124,1,83,
+    0,124,1,83,0,119,0,119,0,119,0,41,7,78,113,135,
+    1,113,199,1,113,195,1,113,179,1,82,4,113,136,1,41,
+    14,113,145,1,113,216,1,113,21,113,20,113,127,113,217,1,
+    113,13,113,135,1,113,2,113,9,113,199,1,113,11,113,180,
+    1,113,136,1,82,23,82,1,82,1,113,5,113,218,1,232,
+    9,115,66,0,0,0,2,3,18,1,6,1,12,1,14,1,
+    12,1,2,1,14,3,12,1,16,1,2,1,12,1,12,1,
+    2,1,16,1,2,1,8,4,10,1,18,1,4,128,12,1,
+    2,1,16,1,2,1,8,1,4,3,12,254,2,1,8,1,
+    2,254,2,251,2,246,255,128,113,218,1,67,2,0,0,6,
+    22,134,1,115,242,0,0,0,124,0,106,0,100,0,117,1,
+    114,29,116,1,124,0,106,0,100,1,131,2,115,29,116,2,
+    124,0,106,0,131,1,155,0,100,2,157,2,125,1,116,3,
+    160,4,124,1,116,5,161,2,1,0,116,6,124,0,131,1,
+    83,0,116,7,124,0,131,1,125,2,100,3,124,0,95,8,
+    122,79,124,2,116,9,106,10,124,0,106,11,60,0,122,26,
+    124,0,106,0,100,0,117,0,114,62,124,0,106,12,100,0,
+    117,0,114,61,116,13,100,4,124,0,106,11,100,5,141,2,
+    130,1,110,6,124,0,106,0,160,14,124,2,161,1,1,0,
+    87,0,110,19,1,0,1,0,1,0,122,7,116,9,106,10,
+    124,0,106,11,61,0,87,0,130,0,4,0,116,15,121,120,
+    1,0,1,0,1,0,89,0,130,0,116,9,106,10,160,16,
+    124,0,106,11,161,1,125,2,124,2,116,9,106,10,124,0,
+    106,11,60,0,116,17,100,6,124,0,106,11,124,0,106,0,
+    131,3,1,0,87,0,100,7,124,0,95,8,124,2,83,0,
+    100,7,124,0,95,8,119,0,119,0,41,8,78,113,206,1,
+    113,214,1,84,113,213,1,82,2,113,219,1,70,41,18,113,
+    145,1,113,11,113,6,113,123,113,124,113,215,1,113,218,1,
+    113,208,1,113,220,1,113,20,113,127,113,21,113,153,1,113,
+    109,113,206,1,113,85,113,217,1,113,105,41,3,113,131,1,
+    113,130,1,113,132,1,82,1,82,1,113,5,113,221,1,176,
+    10,115,62,0,0,0,10,2,12,2,16,1,12,2,8,1,
+    8,2,6,5,2,1,12,1,2,1,10,1,10,1,14,1,
+    2,255,12,4,4,128,6,1,2,1,12,1,2,3,12,254,
+    2,1,2,1,14,5,12,1,18,1,6,2,4,2,8,254,
+    2,245,255,128,113,221,1,67,2,0,0,2,16,134,1,115,
+    54,0,0,0,116,0,124,0,106,1,131,1,143,12,1,0,
+    116,2,124,0,131,1,87,0,2,0,100,1,4,0,4,0,
+    131,3,1,0,83,0,49,0,115,20,119,1,1,0,1,0,
+    1,0,89,0,1,0,100,1,83,0,41,2,113,222,1,78,
+    41,3,113,66,113,21,113,221,1,169,1,113,131,1,82,1,
+    82,1,113,5,113,129,1,138,11,115,8,0,0,0,12,9,
+    22,1,20,128,255,128,113,129,1,67,0,0,0,0,8,128,
+    1,115,140,0,0,0,101,0,90,1,100,0,90,2,100,1,
+    90,3,100,2,90,4,101,5,100,3,100,4,132,0,131,1,
+    90,6,101,7,100,20,100,6,100,7,132,1,131,1,90,8,
+    101,7,100,21,100,8,100,9,132,1,131,1,90,9,101,5,
+    100,10,100,11,132,0,131,1,90,10,101,5,100,12,100,13,
+    132,0,131,1,90,11,101,7,101,12,100,14,100,15,132,0,
+    131,1,131,1,90,13,101,7,101,12,100,16,100,17,132,0,
+    131,1,131,1,90,14,101,7,101,12,100,18,100,19,132,0,
+    131,1,131,1,90,15,101,7,101,16,131,1,90,17,100,5,
+    83,0,41,22,113,223,1,113,224,1,113,225,1,67,2,0,
+    0,2,10,134,1,115,34,0,0,0,116,0,160,1,100,1,
+    116,2,161,2,1,0,100,2,124,0,106,3,155,2,100,3,
+    116,4,106,5,155,0,100,4,157,5,83,0,41,6,113,226,
+    1,113,227,1,113,228,1,113,229,1,113,230,1,78,41,6,
+    113,123,113,124,113,125,113,9,113,223,1,113,192,1,169,1,
+    113,132,1,82,1,82,1,113,5,113,137,1,190,11,115,10,
+    0,0,0,6,7,2,1,4,255,22,2,255,128,113,231,1,
+    78,67,8,0,0,8,10,134,1,115,42,0,0,0,124,2,
+    100,0,117,1,114,6,100,0,83,0,116,0,160,1,124,1,
+    161,1,114,19,116,2,124,1,124,0,124,0,106,3,100,1,
+    141,3,83,0,100,0,83,0,169,2,78,82,21,41,4,113,
+    78,113,232,1,113,126,113,192,1,169,4,113,233,1,113,110,
+    113,234,1,113,235,1,82,1,82,1,113,5,113,236,1,212,
+    11,115,12,0,0,0,8,2,4,1,10,1,16,1,4,2,
+    255,128,113,237,1,67,6,0,0,8,8,134,1,115,42,0,
+    0,0,116,0,160,1,100,1,116,2,161,2,1,0,124,0,
+    160,3,124,1,124,2,161,2,125,3,124,3,100,2,117,1,
+    114,19,124,3,106,4,83,0,100,2,83,0,41,3,113,238,
+    1,113,239,1,78,41,5,113,123,113,124,113,125,113,236,1,
+    113,145,1,41,4,113,233,1,113,110,113,234,1,113,131,1,
+    82,1,82,1,113,5,113,240,1,230,11,115,12,0,0,0,
+    6,9,2,2,4,254,12,3,18,1,255,128,113,241,1,67,
+    2,0,0,2,8,134,1,115,46,0,0,0,124,0,106,0,
+    116,1,106,2,118,1,114,17,116,3,100,1,160,4,124,0,
+    106,0,161,1,124,0,106,0,100,2,141,2,130,1,116,5,
+    116,6,106,7,124,0,131,2,83,0,41,4,113,242,1,113,
+    107,82,2,78,41,8,113,21,113,20,113,108,113,109,113,55,
+    113,92,113,78,113,243,1,82,24,82,1,82,1,113,5,113,
+    205,1,132,12,115,12,0,0,0,12,3,12,1,4,1,6,
+    255,12,2,255,128,113,244,1,67,2,0,0,2,6,134,1,
+    115,16,0,0,0,116,0,116,1,106,2,124,0,131,2,1,
+    0,100,1,83,0,41,2,113,245,1,78,41,3,113,92,113,
+    78,113,246,1,82,25,82,1,82,1,113,5,113,206,1,148,
+    12,115,4,0,0,0,16,3,255,128,113,247,1,67,4,0,
+    0,4,2,134,1,243,4,0,0,0,100,1,83,0,41,2,
+    113,248,1,78,82,1,169,2,113,233,1,113,110,82,1,82,
+    1,113,5,113,249,1,158,12,243,4,0,0,0,4,4,255,
+    128,113,250,1,67,4,0,0,4,2,134,1,82,28,41,2,
+    113,251,1,78,82,1,82,29,82,1,82,1,113,5,113,252,
+    1,170,12,82,30,113,253,1,67,4,0,0,4,2,134,1,
+    82,28,41,3,113,254,1,70,78,82,1,82,29,82,1,82,
+    1,113,5,113,152,1,182,12,82,30,113,255,1,169,2,78,
+    78,82,0,41,18,113,9,113,8,113,1,113,10,113,192,1,
+    113,128,2,113,137,1,113,129,2,113,236,1,113,240,1,113,
+    205,1,113,206,1,113,114,113,249,1,113,252,1,113,152,1,
+    113,133,1,113,216,1,82,1,82,1,82,1,113,5,113,223,
+    1,168,11,115,48,0,0,0,8,0,4,2,4,7,2,2,
+    10,1,2,10,12,1,2,8,12,1,2,14,10,1,2,7,
+    10,1,2,4,2,1,12,1,2,4,2,1,12,1,2,4,
+    2,1,12,1,12,4,255,128,113,223,1,67,0,0,0,0,
+    8,128,1,115,144,0,0,0,101,0,90,1,100,0,90,2,
+    100,1,90,3,100,2,90,4,101,5,100,3,100,4,132,0,
+    131,1,90,6,101,7,100,22,100,6,100,7,132,1,131,1,
+    90,8,101,7,100,23,100,8,100,9,132,1,131,1,90,9,
+    101,5,100,10,100,11,132,0,131,1,90,10,101,5,100,12,
+    100,13,132,0,131,1,90,11,101,7,100,14,100,15,132,0,
+    131,1,90,12,101,7,101,13,100,16,100,17,132,0,131,1,
+    131,1,90,14,101,7,101,13,100,18,100,19,132,0,131,1,
+    131,1,90,15,101,7,101,13,100,20,100,21,132,0,131,1,
+    131,1,90,16,100,5,83,0,41,24,113,130,2,113,131,2,
+    113,132,2,67,2,0,0,2,8,134,1,115,28,0,0,0,
+    116,0,160,1,100,1,116,2,161,2,1,0,100,2,160,3,
+    124,0,106,4,116,5,106,6,161,2,83,0,41,4,113,226,
+    1,113,133,2,113,210,1,78,41,7,113,123,113,124,113,125,
+    113,55,113,9,113,130,2,113,192,1,41,1,113,134,2,82,
+    1,82,1,113,5,113,137,1,222,12,115,10,0,0,0,6,
+    7,2,1,4,255,16,2,255,128,113,135,2,78,67,8,0,
+    0,8,10,134,1,115,30,0,0,0,116,0,160,1,124,1,
+    161,1,114,13,116,2,124,1,124,0,124,0,106,3,100,1,
+    141,3,83,0,100,0,83,0,82,26,41,4,113,78,113,117,
+    113,126,113,192,1,82,27,82,1,82,1,113,5,113,236,1,
+    244,12,115,8,0,0,0,10,2,16,1,4,2,255,128,113,
+    136,2,67,6,0,0,6,8,134,1,115,30,0,0,0,116,
+    0,160,1,100,1,116,2,161,2,1,0,116,3,160,4,124,
+    1,161,1,114,13,124,0,83,0,100,2,83,0,41,3,113,
+    137,2,113,138,2,78,41,5,113,123,113,124,113,125,113,78,
+    113,117,41,3,113,233,1,113,110,113,234,1,82,1,82,1,
+    113,5,113,240,1,130,13,115,10,0,0,0,6,7,2,2,
+    4,254,18,3,255,128,113,139,2,67,2,0,0,2,2,134,
+    1,82,28,41,2,113,140,2,78,82,1,82,24,82,1,82,
+    1,113,5,113,205,1,154,13,115,4,0,0,0,4,0,255,
+    128,113,141,2,67,2,0,0,6,8,134,1,115,64,0,0,
+    0,124,0,106,0,106,1,125,1,116,2,160,3,124,1,161,
+    1,115,18,116,4,100,1,160,5,124,1,161,1,124,1,100,
+    2,141,2,130,1,116,6,116,2,106,7,124,1,131,2,125,
+    2,116,8,124,2,124,0,106,9,131,2,1,0,100,0,83,
+    0,82,19,41,10,113,136,1,113,21,113,78,113,117,113,109,
+    113,55,113,92,113,142,2,113,143,2,113,14,41,3,113,132,
+    1,113,21,113,144,2,82,1,82,1,113,5,113,206,1,162,
+    13,115,16,0,0,0,8,2,10,1,10,1,2,1,6,255,
+    12,2,16,1,255,128,113,145,2,67,4,0,0,4,6,134,
+    1,115,10,0,0,0,116,0,124,0,124,1,131,2,83,0,
+    41,2,113,146,2,78,41,1,113,133,1,82,29,82,1,82,
+    1,113,5,113,216,1,180,13,115,4,0,0,0,10,8,255,
+    128,113,147,2,67,4,0,0,4,6,134,1,243,10,0,0,
+    0,116,0,160,1,124,1,161,1,83,0,41,2,113,148,2,
+    78,41,2,113,78,113,142,2,82,29,82,1,82,1,113,5,
+    113,249,1,200,13,243,4,0,0,0,10,4,255,128,113,149,
+    2,67,4,0,0,4,2,134,1,82,28,41,2,113,150,2,
+    78,82,1,82,29,82,1,82,1,113,5,113,252,1,212,13,
+    82,30,113,151,2,67,4,0,0,4,6,134,1,82,32,41,
+    2,113,152,2,78,41,2,113,78,113,153,2,82,29,82,1,
+    82,1,113,5,113,152,1,224,13,82,33,113,154,2,82,31,
+    82,0,41,17,113,9,113,8,113,1,113,10,113,192,1,113,
+    128,2,113,137,1,113,129,2,113,236,1,113,240,1,113,205,
+    1,113,206,1,113,216,1,113,120,113,249,1,113,252,1,113,
+    152,1,82,1,82,1,82,1,113,5,113,130,2,200,12,115,
+    50,0,0,0,8,0,4,2,4,7,2,2,10,1,2,10,
+    12,1,2,6,12,1,2,11,10,1,2,3,10,1,2,8,
+    10,1,2,9,2,1,12,1,2,4,2,1,12,1,2,4,
+    2,1,16,1,255,128,113,130,2,67,0,0,0,0,4,128,
+    1,115,32,0,0,0,101,0,90,1,100,0,90,2,100,1,
+    90,3,100,2,100,3,132,0,90,4,100,4,100,5,132,0,
+    90,5,100,6,83,0,41,7,113,155,2,113,156,2,67,2,
+    0,0,2,4,134,1,243,12,0,0,0,116,0,160,1,161,
+    0,1,0,100,1,83,0,41,2,113,157,2,78,41,2,113,
+    78,113,79,82,10,82,1,82,1,113,5,113,71,250,13,243,
+    4,0,0,0,12,2,255,128,113,158,2,67,8,0,0,8,
+    4,134,1,82,34,41,2,113,159,2,78,41,2,113,78,113,
+    81,41,4,113,33,113,160,2,113,161,2,113,162,2,82,1,
+    82,1,113,5,113,75,130,14,82,35,113,163,2,78,41,6,
+    113,9,113,8,113,1,113,10,113,71,113,75,82,1,82,1,
+    82,1,113,5,113,155,2,242,13,115,10,0,0,0,8,0,
+    4,2,8,2,12,4,255,128,113,155,2,67,6,0,0,10,
+    10,134,1,115,64,0,0,0,124,1,160,0,100,1,124,2,
+    100,2,24,0,161,2,125,3,116,1,124,3,131,1,124,2,
+    107,0,114,18,116,2,100,3,131,1,130,1,124,3,100,4,
+    25,0,125,4,124,0,114,30,100,5,160,3,124,4,124,0,
+    161,2,83,0,124,4,83,0,41,7,113,164,2,113,179,1,
+    82,6,113,165,2,82,4,113,166,2,78,41,4,113,167,2,
+    113,168,2,113,109,113,55,41,5,113,21,113,169,2,113,170,
+    2,113,171,2,113,172,2,82,1,82,1,113,5,113,173,2,
+    140,14,115,12,0,0,0,16,2,12,1,8,1,8,1,20,
+    1,255,128,113,173,2,67,6,0,0,10,8,134,1,115,60,
+    0,0,0,116,0,124,0,131,1,155,0,100,1,157,2,125,
+    3,116,1,160,2,124,3,116,3,161,2,1,0,124,0,160,
+    4,124,1,124,2,161,2,125,4,124,4,100,0,117,0,114,
+    25,100,0,83,0,116,5,124,1,124,4,131,2,83,0,41,
+    2,78,113,174,2,41,6,113,6,113,123,113,124,113,215,1,
+    113,240,1,113,126,41,5,113,175,2,113,21,113,234,1,113,
+    130,1,113,145,1,82,1,82,1,113,5,113,176,2,158,14,
+    115,14,0,0,0,14,1,12,2,12,1,8,1,4,1,10,
+    1,255,128,113,176,2,67,6,0,0,20,20,134,1,115,24,
+    1,0,0,116,0,106,1,125,3,124,3,100,1,117,0,114,
+    11,116,2,100,2,131,1,130,1,124,3,115,19,116,3,160,
+    4,100,3,116,5,161,2,1,0,124,0,116,0,106,6,118,
+    0,125,4,124,3,68,0,93,109,125,5,116,7,131,0,143,
+    46,1,0,122,5,124,5,106,8,125,6,87,0,110,26,4,
+    0,116,9,121,139,1,0,1,0,1,0,116,10,124,5,124,
+    0,124,1,131,3,125,7,124,7,100,1,117,0,114,62,89,
+    0,87,0,100,1,4,0,4,0,131,3,1,0,113,26,89,
+    0,110,6,124,6,124,0,124,1,124,2,131,3,125,7,87,
+    0,100,1,4,0,4,0,131,3,1,0,110,8,49,0,115,
+    80,119,1,1,0,1,0,1,0,89,0,1,0,124,7,100,
+    1,117,1,114,135,124,4,115,131,124,0,116,0,106,6,118,
+    0,114,131,116,0,106,6,124,0,25,0,125,8,122,5,124,
+    8,106,11,125,9,87,0,110,12,4,0,116,9,121,138,1,
+    0,1,0,1,0,124,7,6,0,89,0,2,0,1,0,83,
+    0,124,9,100,1,117,0,114,127,124,7,2,0,1,0,83,
+    0,124,9,2,0,1,0,83,0,124,7,2,0,1,0,83,
+    0,113,26,100,1,83,0,119,0,119,0,41,4,113,177,2,
+    78,113,178,2,113,179,2,41,12,113,20,113,180,2,113,109,
+    113,123,113,124,113,215,1,113,127,113,155,2,113,236,1,113,
+    2,113,176,2,113,136,1,41,10,113,21,113,234,1,113,235,
+    1,113,180,2,113,181,2,113,175,2,113,236,1,113,131,1,
+    113,132,1,113,136,1,82,1,82,1,113,5,113,182,2,178,
+    14,115,66,0,0,0,6,2,8,1,8,2,4,3,12,1,
+    10,5,8,1,8,1,2,1,10,1,12,1,12,1,8,1,
+    16,1,4,255,12,3,30,128,8,1,14,2,10,1,2,1,
+    10,1,12,1,12,4,8,2,8,1,8,2,8,2,2,239,
+    4,19,2,243,2,244,255,128,113,182,2,67,6,0,0,6,
+    10,134,1,115,110,0,0,0,116,0,124,0,116,1,131,2,
+    115,14,116,2,100,1,160,3,116,4,124,0,131,1,161,1,
+    131,1,130,1,124,2,100,2,107,0,114,22,116,5,100,3,
+    131,1,130,1,124,2,100,2,107,4,114,41,116,0,124,1,
+    116,1,131,2,115,35,116,2,100,4,131,1,130,1,124,1,
+    115,41,116,6,100,5,131,1,130,1,124,0,115,53,124,2,
+    100,2,107,2,114,51,116,5,100,6,131,1,130,1,100,7,
+    83,0,100,7,83,0,41,8,113,183,2,113,184,2,82,4,
+    113,185,2,113,186,2,113,187,2,113,188,2,78,41,7,113,
+    189,2,113,190,2,113,191,2,113,55,113,3,113,192,2,113,
+    109,169,3,113,21,113,169,2,113,170,2,82,1,82,1,113,
+    5,113,193,2,144,15,115,26,0,0,0,10,2,18,1,8,
+    1,8,1,8,1,10,1,8,1,4,1,8,1,12,2,8,
+    1,8,255,255,128,113,193,2,113,194,2,113,195,2,67,4,
+    0,0,18,16,134,1,115,16,1,0,0,100,0,125,2,124,
+    0,160,0,100,1,161,1,100,2,25,0,125,3,124,3,114,
+    63,124,3,116,1,106,2,118,1,114,21,116,3,124,1,124,
+    3,131,2,1,0,124,0,116,1,106,2,118,0,114,31,116,
+    1,106,2,124,0,25,0,83,0,116,1,106,2,124,3,25,
+    0,125,4,122,5,124,4,106,4,125,2,87,0,110,21,4,
+    0,116,5,121,135,1,0,1,0,1,0,116,6,100,3,23,
+    0,160,7,124,0,124,3,161,2,125,5,116,8,124,5,124,
+    0,100,4,141,2,100,0,130,2,116,9,124,0,124,2,131,
+    2,125,6,124,6,100,0,117,0,114,81,116,8,116,6,160,
+    7,124,0,161,1,124,0,100,4,141,2,130,1,116,10,124,
+    6,131,1,125,7,124,3,114,132,116,1,106,2,124,3,25,
+    0,125,4,124,0,160,0,100,1,161,1,100,5,25,0,125,
+    8,122,9,116,11,124,4,124,8,124,7,131,3,1,0,87,
+    0,124,7,83,0,4,0,116,5,121,134,1,0,1,0,1,
+    0,100,6,124,3,155,2,100,7,124,8,155,2,157,4,125,
+    5,116,12,160,13,124,5,116,14,161,2,1,0,89,0,124,
+    7,83,0,124,7,83,0,119,0,119,0,41,8,78,113,179,
+    1,82,4,113,196,2,82,2,246,4,113,197,2,113,198,2,
+    41,15,113,180,1,113,20,113,127,113,92,113,195,1,113,2,
+    113,199,2,113,55,113,200,2,113,182,2,113,221,1,113,12,
+    113,123,113,124,113,215,1,41,9,113,21,113,201,2,113,234,
+    1,113,181,1,113,202,2,113,130,1,113,131,1,113,132,1,
+    113,203,2,82,1,82,1,113,5,113,204,2,182,15,115,60,
+    0,0,0,4,1,14,1,4,1,10,1,10,1,10,2,10,
+    1,10,1,2,1,10,1,12,1,16,1,14,1,10,1,8,
+    1,18,1,8,2,4,1,10,2,14,1,2,1,14,1,4,
+    4,12,253,16,1,14,1,8,1,2,253,2,242,255,128,113,
+    204,2,67,4,0,0,8,16,134,1,115,128,0,0,0,116,
+    0,124,0,131,1,143,31,1,0,116,1,106,2,160,3,124,
+    0,116,4,161,2,125,2,124,2,116,4,117,0,114,28,116,
+    5,124,0,124,1,131,2,87,0,2,0,100,1,4,0,4,
+    0,131,3,1,0,83,0,87,0,100,1,4,0,4,0,131,
+    3,1,0,110,8,49,0,115,38,119,1,1,0,1,0,1,
+    0,89,0,1,0,124,2,100,1,117,0,114,58,100,2,160,
+    6,124,0,161,1,125,3,116,7,124,3,124,0,100,3,141,
+    2,130,1,116,8,124,0,131,1,1,0,124,2,83,0,41,
+    4,113,205,2,78,113,206,2,82,2,41,9,113,66,113,20,
+    113,127,113,39,113,207,2,113,204,2,113,55,113,200,2,113,
+    88,41,4,113,21,113,201,2,113,132,1,113,104,82,1,82,
+    1,113,5,113,208,2,252,15,115,28,0,0,0,10,2,14,
+    1,8,1,24,1,14,255,16,128,8,3,2,1,6,1,2,
+    255,12,2,8,2,4,1,255,128,113,208,2,82,4,67,6,
+    0,0,6,8,134,1,115,42,0,0,0,116,0,124,0,124,
+    1,124,2,131,3,1,0,124,2,100,1,107,4,114,16,116,
+    1,124,0,124,1,124,2,131,3,125,0,116,2,124,0,116,
+    3,131,2,83,0,41,3,113,209,2,82,4,78,41,4,113,
+    193,2,113,173,2,113,208,2,113,210,2,82,36,82,1,82,
+    1,113,5,113,210,2,156,16,115,10,0,0,0,12,9,8,
+    1,12,1,10,1,255,128,113,210,2,169,1,113,211,2,67,
+    6,0,2,16,22,134,1,115,218,0,0,0,124,1,68,0,
     93,103,125,4,116,0,124,4,116,1,131,2,115,32,124,3,
     114,17,124,0,106,2,100,1,23,0,125,5,110,2,100,2,
     125,5,116,3,100,3,124,5,155,0,100,4,116,4,124,4,
@@ -1635,253 +1559,111 @@ const unsigned char _Py_M__importlib_bootstrap[] = {
     124,6,107,2,114,100,116,12,106,13,160,14,124,6,116,15,
     161,2,100,10,117,1,114,100,87,0,89,0,100,10,125,7,
     126,7,113,2,130,0,100,10,125,7,126,7,119,1,113,2,
-    124,0,83,0,119,0,41,11,122,238,70,105,103,117,114,101,
-    32,111,117,116,32,119,104,97,116,32,95,95,105,109,112,111,
-    114,116,95,95,32,115,104,111,117,108,100,32,114,101,116,117,
-    114,110,46,10,10,32,32,32,32,84,104,101,32,105,109,112,
-    111,114,116,95,32,112,97,114,97,109,101,116,101,114,32,105,
-    115,32,97,32,99,97,108,108,97,98,108,101,32,119,104,105,
-    99,104,32,116,97,107,101,115,32,116,104,101,32,110,97,109,
-    101,32,111,102,32,109,111,100,117,108,101,32,116,111,10,32,
-    32,32,32,105,109,112,111,114,116,46,32,73,116,32,105,115,
-    32,114,101,113,117,105,114,101,100,32,116,111,32,100,101,99,
-    111,117,112,108,101,32,116,104,101,32,102,117,110,99,116,105,
-    111,110,32,102,114,111,109,32,97,115,115,117,109,105,110,103,
-    32,105,109,112,111,114,116,108,105,98,39,115,10,32,32,32,
-    32,105,109,112,111,114,116,32,105,109,112,108,101,109,101,110,
-    116,97,116,105,111,110,32,105,115,32,100,101,115,105,114,101,
-    100,46,10,10,32,32,32,32,122,8,46,95,95,97,108,108,
-    95,95,122,13,96,96,102,114,111,109,32,108,105,115,116,39,
-    39,122,8,73,116,101,109,32,105,110,32,122,18,32,109,117,
-    115,116,32,98,101,32,115,116,114,44,32,110,111,116,32,250,
-    1,42,218,7,95,95,97,108,108,95,95,84,114,230,0,0,
-    0,114,206,0,0,0,78,41,16,114,216,0,0,0,114,217,
-    0,0,0,114,9,0,0,0,114,218,0,0,0,114,3,0,
-    0,0,114,11,0,0,0,218,16,95,104,97,110,100,108,101,
-    95,102,114,111,109,108,105,115,116,114,233,0,0,0,114,50,
-    0,0,0,114,74,0,0,0,114,224,0,0,0,114,20,0,
-    0,0,114,18,0,0,0,114,105,0,0,0,114,38,0,0,
-    0,114,227,0,0,0,41,8,114,110,0,0,0,218,8,102,
-    114,111,109,108,105,115,116,114,225,0,0,0,114,231,0,0,
-    0,218,1,120,90,5,119,104,101,114,101,90,9,102,114,111,
-    109,95,110,97,109,101,90,3,101,120,99,114,5,0,0,0,
-    114,5,0,0,0,114,6,0,0,0,114,234,0,0,0,29,
-    4,0,0,115,58,0,0,0,8,10,10,1,4,1,12,1,
-    4,2,10,1,8,1,8,255,8,2,14,1,10,1,2,1,
-    6,255,2,128,10,2,14,1,2,1,14,1,14,1,10,4,
-    16,1,2,255,12,2,2,1,8,128,2,245,4,12,2,248,
-    255,128,114,234,0,0,0,99,1,0,0,0,0,0,0,0,
-    0,0,0,0,3,0,0,0,6,0,0,0,67,0,0,0,
-    115,146,0,0,0,124,0,160,0,100,1,161,1,125,1,124,
-    0,160,0,100,2,161,1,125,2,124,1,100,3,117,1,114,
-    41,124,2,100,3,117,1,114,39,124,1,124,2,106,1,107,
-    3,114,39,116,2,106,3,100,4,124,1,155,2,100,5,124,
-    2,106,1,155,2,100,6,157,5,116,4,100,7,100,8,141,
-    3,1,0,124,1,83,0,124,2,100,3,117,1,114,48,124,
-    2,106,1,83,0,116,2,106,3,100,9,116,4,100,7,100,
-    8,141,3,1,0,124,0,100,10,25,0,125,1,100,11,124,
-    0,118,1,114,71,124,1,160,5,100,12,161,1,100,13,25,
-    0,125,1,124,1,83,0,41,14,122,167,67,97,108,99,117,
-    108,97,116,101,32,119,104,97,116,32,95,95,112,97,99,107,
-    97,103,101,95,95,32,115,104,111,117,108,100,32,98,101,46,
-    10,10,32,32,32,32,95,95,112,97,99,107,97,103,101,95,
-    95,32,105,115,32,110,111,116,32,103,117,97,114,97,110,116,
-    101,101,100,32,116,111,32,98,101,32,100,101,102,105,110,101,
-    100,32,111,114,32,99,111,117,108,100,32,98,101,32,115,101,
-    116,32,116,111,32,78,111,110,101,10,32,32,32,32,116,111,
-    32,114,101,112,114,101,115,101,110,116,32,116,104,97,116,32,
-    105,116,115,32,112,114,111,112,101,114,32,118,97,108,117,101,
-    32,105,115,32,117,110,107,110,111,119,110,46,10,10,32,32,
-    32,32,114,158,0,0,0,114,113,0,0,0,78,122,32,95,
-    95,112,97,99,107,97,103,101,95,95,32,33,61,32,95,95,
-    115,112,101,99,95,95,46,112,97,114,101,110,116,32,40,122,
-    4,32,33,61,32,250,1,41,233,3,0,0,0,41,1,90,
-    10,115,116,97,99,107,108,101,118,101,108,122,89,99,97,110,
-    39,116,32,114,101,115,111,108,118,101,32,112,97,99,107,97,
-    103,101,32,102,114,111,109,32,95,95,115,112,101,99,95,95,
-    32,111,114,32,95,95,112,97,99,107,97,103,101,95,95,44,
-    32,102,97,108,108,105,110,103,32,98,97,99,107,32,111,110,
-    32,95,95,110,97,109,101,95,95,32,97,110,100,32,95,95,
-    112,97,116,104,95,95,114,9,0,0,0,114,154,0,0,0,
-    114,141,0,0,0,114,25,0,0,0,41,6,114,38,0,0,
-    0,114,143,0,0,0,114,101,0,0,0,114,102,0,0,0,
-    114,169,0,0,0,114,142,0,0,0,41,3,218,7,103,108,
-    111,98,97,108,115,114,209,0,0,0,114,109,0,0,0,114,
-    5,0,0,0,114,5,0,0,0,114,6,0,0,0,218,17,
-    95,99,97,108,99,95,95,95,112,97,99,107,97,103,101,95,
-    95,66,4,0,0,115,44,0,0,0,10,7,10,1,8,1,
-    18,1,6,1,2,1,4,255,4,1,6,255,4,2,6,254,
-    4,3,8,1,6,1,6,2,4,2,6,254,8,3,8,1,
-    14,1,4,1,255,128,114,240,0,0,0,114,5,0,0,0,
-    99,5,0,0,0,0,0,0,0,0,0,0,0,9,0,0,
-    0,5,0,0,0,67,0,0,0,115,174,0,0,0,124,4,
-    100,1,107,2,114,9,116,0,124,0,131,1,125,5,110,18,
-    124,1,100,2,117,1,114,15,124,1,110,1,105,0,125,6,
-    116,1,124,6,131,1,125,7,116,0,124,0,124,7,124,4,
-    131,3,125,5,124,3,115,74,124,4,100,1,107,2,114,42,
-    116,0,124,0,160,2,100,3,161,1,100,1,25,0,131,1,
-    83,0,124,0,115,46,124,5,83,0,116,3,124,0,131,1,
-    116,3,124,0,160,2,100,3,161,1,100,1,25,0,131,1,
-    24,0,125,8,116,4,106,5,124,5,106,6,100,2,116,3,
-    124,5,106,6,131,1,124,8,24,0,133,2,25,0,25,0,
-    83,0,116,7,124,5,100,4,131,2,114,85,116,8,124,5,
-    124,3,116,0,131,3,83,0,124,5,83,0,41,5,97,215,
-    1,0,0,73,109,112,111,114,116,32,97,32,109,111,100,117,
-    108,101,46,10,10,32,32,32,32,84,104,101,32,39,103,108,
-    111,98,97,108,115,39,32,97,114,103,117,109,101,110,116,32,
-    105,115,32,117,115,101,100,32,116,111,32,105,110,102,101,114,
-    32,119,104,101,114,101,32,116,104,101,32,105,109,112,111,114,
-    116,32,105,115,32,111,99,99,117,114,114,105,110,103,32,102,
-    114,111,109,10,32,32,32,32,116,111,32,104,97,110,100,108,
-    101,32,114,101,108,97,116,105,118,101,32,105,109,112,111,114,
-    116,115,46,32,84,104,101,32,39,108,111,99,97,108,115,39,
-    32,97,114,103,117,109,101,110,116,32,105,115,32,105,103,110,
-    111,114,101,100,46,32,84,104,101,10,32,32,32,32,39,102,
-    114,111,109,108,105,115,116,39,32,97,114,103,117,109,101,110,
-    116,32,115,112,101,99,105,102,105,101,115,32,119,104,97,116,
-    32,115,104,111,117,108,100,32,101,120,105,115,116,32,97,115,
-    32,97,116,116,114,105,98,117,116,101,115,32,111,110,32,116,
-    104,101,32,109,111,100,117,108,101,10,32,32,32,32,98,101,
-    105,110,103,32,105,109,112,111,114,116,101,100,32,40,101,46,
-    103,46,32,96,96,102,114,111,109,32,109,111,100,117,108,101,
-    32,105,109,112,111,114,116,32,60,102,114,111,109,108,105,115,
-    116,62,96,96,41,46,32,32,84,104,101,32,39,108,101,118,
-    101,108,39,10,32,32,32,32,97,114,103,117,109,101,110,116,
-    32,114,101,112,114,101,115,101,110,116,115,32,116,104,101,32,
-    112,97,99,107,97,103,101,32,108,111,99,97,116,105,111,110,
-    32,116,111,32,105,109,112,111,114,116,32,102,114,111,109,32,
-    105,110,32,97,32,114,101,108,97,116,105,118,101,10,32,32,
-    32,32,105,109,112,111,114,116,32,40,101,46,103,46,32,96,
-    96,102,114,111,109,32,46,46,112,107,103,32,105,109,112,111,
-    114,116,32,109,111,100,96,96,32,119,111,117,108,100,32,104,
-    97,118,101,32,97,32,39,108,101,118,101,108,39,32,111,102,
-    32,50,41,46,10,10,32,32,32,32,114,25,0,0,0,78,
-    114,141,0,0,0,114,154,0,0,0,41,9,114,229,0,0,
-    0,114,240,0,0,0,218,9,112,97,114,116,105,116,105,111,
-    110,114,208,0,0,0,114,18,0,0,0,114,105,0,0,0,
-    114,9,0,0,0,114,11,0,0,0,114,234,0,0,0,41,
-    9,114,20,0,0,0,114,239,0,0,0,218,6,108,111,99,
-    97,108,115,114,235,0,0,0,114,210,0,0,0,114,110,0,
-    0,0,90,8,103,108,111,98,97,108,115,95,114,209,0,0,
-    0,90,7,99,117,116,95,111,102,102,114,5,0,0,0,114,
-    5,0,0,0,114,6,0,0,0,218,10,95,95,105,109,112,
-    111,114,116,95,95,93,4,0,0,115,32,0,0,0,8,11,
-    10,1,16,2,8,1,12,1,4,1,8,3,18,1,4,1,
-    4,1,26,4,30,3,10,1,12,1,4,2,255,128,114,243,
-    0,0,0,99,1,0,0,0,0,0,0,0,0,0,0,0,
-    2,0,0,0,3,0,0,0,67,0,0,0,115,38,0,0,
-    0,116,0,160,1,124,0,161,1,125,1,124,1,100,0,117,
-    0,114,15,116,2,100,1,124,0,23,0,131,1,130,1,116,
-    3,124,1,131,1,83,0,41,2,78,122,25,110,111,32,98,
-    117,105,108,116,45,105,110,32,109,111,100,117,108,101,32,110,
-    97,109,101,100,32,41,4,114,175,0,0,0,114,183,0,0,
-    0,114,87,0,0,0,114,173,0,0,0,41,2,114,20,0,
-    0,0,114,109,0,0,0,114,5,0,0,0,114,5,0,0,
-    0,114,6,0,0,0,218,18,95,98,117,105,108,116,105,110,
-    95,102,114,111,109,95,110,97,109,101,130,4,0,0,115,10,
-    0,0,0,10,1,8,1,12,1,8,1,255,128,114,244,0,
-    0,0,99,2,0,0,0,0,0,0,0,0,0,0,0,10,
-    0,0,0,5,0,0,0,67,0,0,0,115,166,0,0,0,
-    124,1,97,0,124,0,97,1,116,2,116,1,131,1,125,2,
-    116,1,106,3,160,4,161,0,68,0,93,36,92,2,125,3,
-    125,4,116,5,124,4,124,2,131,2,114,49,124,3,116,1,
-    106,6,118,0,114,30,116,7,125,5,110,9,116,0,160,8,
-    124,3,161,1,114,38,116,9,125,5,110,1,113,13,116,10,
-    124,4,124,5,131,2,125,6,116,11,124,6,124,4,131,2,
-    1,0,113,13,116,1,106,3,116,12,25,0,125,7,100,1,
-    68,0,93,23,125,8,124,8,116,1,106,3,118,1,114,69,
-    116,13,124,8,131,1,125,9,110,5,116,1,106,3,124,8,
-    25,0,125,9,116,14,124,7,124,8,124,9,131,3,1,0,
-    113,57,100,2,83,0,41,3,122,250,83,101,116,117,112,32,
-    105,109,112,111,114,116,108,105,98,32,98,121,32,105,109,112,
-    111,114,116,105,110,103,32,110,101,101,100,101,100,32,98,117,
-    105,108,116,45,105,110,32,109,111,100,117,108,101,115,32,97,
-    110,100,32,105,110,106,101,99,116,105,110,103,32,116,104,101,
-    109,10,32,32,32,32,105,110,116,111,32,116,104,101,32,103,
-    108,111,98,97,108,32,110,97,109,101,115,112,97,99,101,46,
-    10,10,32,32,32,32,65,115,32,115,121,115,32,105,115,32,
-    110,101,101,100,101,100,32,102,111,114,32,115,121,115,46,109,
-    111,100,117,108,101,115,32,97,99,99,101,115,115,32,97,110,
-    100,32,95,105,109,112,32,105,115,32,110,101,101,100,101,100,
-    32,116,111,32,108,111,97,100,32,98,117,105,108,116,45,105,
-    110,10,32,32,32,32,109,111,100,117,108,101,115,44,32,116,
-    104,111,115,101,32,116,119,111,32,109,111,100,117,108,101,115,
-    32,109,117,115,116,32,98,101,32,101,120,112,108,105,99,105,
-    116,108,121,32,112,97,115,115,101,100,32,105,110,46,10,10,
-    32,32,32,32,41,3,114,26,0,0,0,114,101,0,0,0,
-    114,71,0,0,0,78,41,15,114,64,0,0,0,114,18,0,
-    0,0,114,3,0,0,0,114,105,0,0,0,218,5,105,116,
-    101,109,115,114,216,0,0,0,114,86,0,0,0,114,175,0,
-    0,0,114,98,0,0,0,114,193,0,0,0,114,155,0,0,
-    0,114,161,0,0,0,114,9,0,0,0,114,244,0,0,0,
-    114,12,0,0,0,41,10,218,10,115,121,115,95,109,111,100,
-    117,108,101,218,11,95,105,109,112,95,109,111,100,117,108,101,
-    90,11,109,111,100,117,108,101,95,116,121,112,101,114,20,0,
-    0,0,114,110,0,0,0,114,122,0,0,0,114,109,0,0,
-    0,90,11,115,101,108,102,95,109,111,100,117,108,101,90,12,
-    98,117,105,108,116,105,110,95,110,97,109,101,90,14,98,117,
-    105,108,116,105,110,95,109,111,100,117,108,101,114,5,0,0,
-    0,114,5,0,0,0,114,6,0,0,0,218,6,95,115,101,
-    116,117,112,137,4,0,0,115,42,0,0,0,4,9,4,1,
-    8,3,18,1,10,1,10,1,6,1,10,1,6,1,2,2,
-    10,1,10,1,2,128,10,3,8,1,10,1,10,1,10,2,
-    14,1,4,251,255,128,114,248,0,0,0,99,2,0,0,0,
-    0,0,0,0,0,0,0,0,2,0,0,0,3,0,0,0,
-    67,0,0,0,115,38,0,0,0,116,0,124,0,124,1,131,
-    2,1,0,116,1,106,2,160,3,116,4,161,1,1,0,116,
-    1,106,2,160,3,116,5,161,1,1,0,100,1,83,0,41,
-    2,122,48,73,110,115,116,97,108,108,32,105,109,112,111,114,
-    116,101,114,115,32,102,111,114,32,98,117,105,108,116,105,110,
-    32,97,110,100,32,102,114,111,122,101,110,32,109,111,100,117,
-    108,101,115,78,41,6,114,248,0,0,0,114,18,0,0,0,
-    114,214,0,0,0,114,132,0,0,0,114,175,0,0,0,114,
-    193,0,0,0,41,2,114,246,0,0,0,114,247,0,0,0,
-    114,5,0,0,0,114,5,0,0,0,114,6,0,0,0,218,
-    8,95,105,110,115,116,97,108,108,172,4,0,0,115,8,0,
-    0,0,10,2,12,2,16,1,255,128,114,249,0,0,0,99,
-    0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,
-    4,0,0,0,67,0,0,0,115,32,0,0,0,100,1,100,
-    2,108,0,125,0,124,0,97,1,124,0,160,2,116,3,106,
-    4,116,5,25,0,161,1,1,0,100,2,83,0,41,3,122,
-    57,73,110,115,116,97,108,108,32,105,109,112,111,114,116,101,
-    114,115,32,116,104,97,116,32,114,101,113,117,105,114,101,32,
-    101,120,116,101,114,110,97,108,32,102,105,108,101,115,121,115,
-    116,101,109,32,97,99,99,101,115,115,114,25,0,0,0,78,
-    41,6,218,26,95,102,114,111,122,101,110,95,105,109,112,111,
-    114,116,108,105,98,95,101,120,116,101,114,110,97,108,114,139,
-    0,0,0,114,249,0,0,0,114,18,0,0,0,114,105,0,
-    0,0,114,9,0,0,0,41,1,114,250,0,0,0,114,5,
-    0,0,0,114,5,0,0,0,114,6,0,0,0,218,27,95,
-    105,110,115,116,97,108,108,95,101,120,116,101,114,110,97,108,
-    95,105,109,112,111,114,116,101,114,115,180,4,0,0,115,8,
-    0,0,0,8,3,4,1,20,1,255,128,114,251,0,0,0,
-    114,190,0,0,0,114,0,0,0,0,114,24,0,0,0,41,
-    4,78,78,114,5,0,0,0,114,25,0,0,0,41,54,114,
-    10,0,0,0,114,7,0,0,0,114,26,0,0,0,114,101,
-    0,0,0,114,71,0,0,0,114,139,0,0,0,114,17,0,
-    0,0,114,21,0,0,0,114,66,0,0,0,114,37,0,0,
-    0,114,47,0,0,0,114,22,0,0,0,114,23,0,0,0,
-    114,55,0,0,0,114,57,0,0,0,114,60,0,0,0,114,
-    72,0,0,0,114,74,0,0,0,114,83,0,0,0,114,95,
-    0,0,0,114,100,0,0,0,114,111,0,0,0,114,124,0,
-    0,0,114,125,0,0,0,114,104,0,0,0,114,155,0,0,
-    0,114,161,0,0,0,114,165,0,0,0,114,119,0,0,0,
-    114,106,0,0,0,114,172,0,0,0,114,173,0,0,0,114,
-    107,0,0,0,114,175,0,0,0,114,193,0,0,0,114,200,
-    0,0,0,114,211,0,0,0,114,213,0,0,0,114,215,0,
-    0,0,114,221,0,0,0,90,15,95,69,82,82,95,77,83,
-    71,95,80,82,69,70,73,88,114,223,0,0,0,114,226,0,
-    0,0,218,6,111,98,106,101,99,116,114,227,0,0,0,114,
-    228,0,0,0,114,229,0,0,0,114,234,0,0,0,114,240,
-    0,0,0,114,243,0,0,0,114,244,0,0,0,114,248,0,
-    0,0,114,249,0,0,0,114,251,0,0,0,114,5,0,0,
-    0,114,5,0,0,0,114,5,0,0,0,114,6,0,0,0,
-    218,8,60,109,111,100,117,108,101,62,1,0,0,0,115,106,
-    0,0,0,4,0,8,22,4,9,4,1,4,1,4,3,8,
-    3,8,8,4,8,4,2,16,3,14,4,14,77,14,21,8,
-    16,8,37,8,17,14,11,8,8,8,11,8,12,8,19,14,
-    26,16,101,10,26,14,45,8,72,8,17,8,17,8,30,8,
-    36,8,45,14,15,14,80,14,85,8,13,8,9,10,10,8,
-    47,4,16,8,1,8,2,6,32,8,3,10,16,14,15,8,
-    37,10,27,8,37,8,7,8,35,12,8,255,128,
+    124,0,83,0,119,0,41,11,113,212,2,113,213,2,113,214,
+    2,113,215,2,113,216,2,113,217,2,113,218,2,84,82,38,
+    113,166,2,78,41,16,113,189,2,113,190,2,113,9,113,191,
+    2,113,3,113,11,113,219,2,113,218,2,113,55,113,92,113,
+    200,2,113,21,113,20,113,127,113,39,113,207,2,41,8,113,
+    132,1,113,220,2,113,201,2,113,211,2,113,221,2,113,222,
+    2,113,223,2,113,224,2,82,1,82,1,113,5,113,219,2,
+    186,16,115,58,0,0,0,8,10,10,1,4,1,12,1,4,
+    2,10,1,8,1,8,255,8,2,14,1,10,1,2,1,6,
+    255,2,128,10,2,14,1,2,1,14,1,14,1,10,4,16,
+    1,2,255,12,2,2,1,8,128,2,245,4,12,2,248,255,
+    128,113,219,2,67,2,0,0,6,12,134,1,115,146,0,0,
+    0,124,0,160,0,100,1,161,1,125,1,124,0,160,0,100,
+    2,161,1,125,2,124,1,100,3,117,1,114,41,124,2,100,
+    3,117,1,114,39,124,1,124,2,106,1,107,3,114,39,116,
+    2,106,3,100,4,124,1,155,2,100,5,124,2,106,1,155,
+    2,100,6,157,5,116,4,100,7,100,8,141,3,1,0,124,
+    1,83,0,124,2,100,3,117,1,114,48,124,2,106,1,83,
+    0,116,2,106,3,100,9,116,4,100,7,100,8,141,3,1,
+    0,124,0,100,10,25,0,125,1,100,11,124,0,118,1,114,
+    71,124,1,160,5,100,12,161,1,100,13,25,0,125,1,124,
+    1,83,0,41,14,113,225,2,113,199,1,113,136,1,78,113,
+    226,2,113,227,2,113,228,2,246,6,41,1,113,229,2,113,
+    230,2,113,9,113,195,1,113,179,1,82,4,41,6,113,39,
+    113,181,1,113,123,113,124,113,215,1,113,180,1,41,3,113,
+    231,2,113,169,2,113,131,1,82,1,82,1,113,5,113,232,
+    2,132,17,115,44,0,0,0,10,7,10,1,8,1,18,1,
+    6,1,2,1,4,255,4,1,6,255,4,2,6,254,4,3,
+    8,1,6,1,6,2,4,2,6,254,8,3,8,1,14,1,
+    4,1,255,128,113,232,2,82,1,67,10,0,0,18,10,134,
+    1,115,174,0,0,0,124,4,100,1,107,2,114,9,116,0,
+    124,0,131,1,125,5,110,18,124,1,100,2,117,1,114,15,
+    124,1,110,1,105,0,125,6,116,1,124,6,131,1,125,7,
+    116,0,124,0,124,7,124,4,131,3,125,5,124,3,115,74,
+    124,4,100,1,107,2,114,42,116,0,124,0,160,2,100,3,
+    161,1,100,1,25,0,131,1,83,0,124,0,115,46,124,5,
+    83,0,116,3,124,0,131,1,116,3,124,0,160,2,100,3,
+    161,1,100,1,25,0,131,1,24,0,125,8,116,4,106,5,
+    124,5,106,6,100,2,116,3,124,5,106,6,131,1,124,8,
+    24,0,133,2,25,0,25,0,83,0,116,7,124,5,100,4,
+    131,2,114,85,116,8,124,5,124,3,116,0,131,3,83,0,
+    124,5,83,0,41,5,113,233,2,82,4,78,113,179,1,113,
+    195,1,41,9,113,210,2,113,232,2,113,234,2,113,168,2,
+    113,20,113,127,113,9,113,11,113,219,2,41,9,113,21,113,
+    231,2,113,235,2,113,220,2,113,170,2,113,132,1,113,236,
+    2,113,169,2,113,237,2,82,1,82,1,113,5,113,238,2,
+    186,17,115,32,0,0,0,8,11,10,1,16,2,8,1,12,
+    1,4,1,8,3,18,1,4,1,4,1,26,4,30,3,10,
+    1,12,1,4,2,255,128,113,238,2,67,2,0,0,4,6,
+    134,1,115,38,0,0,0,116,0,160,1,124,0,161,1,125,
+    1,124,1,100,0,117,0,114,15,116,2,100,1,124,0,23,
+    0,131,1,130,1,116,3,124,1,131,1,83,0,41,2,78,
+    113,239,2,41,4,113,223,1,113,236,1,113,109,113,221,1,
+    41,2,113,21,113,131,1,82,1,82,1,113,5,113,240,2,
+    132,18,115,10,0,0,0,10,1,8,1,12,1,8,1,255,
+    128,113,240,2,67,4,0,0,20,10,134,1,115,166,0,0,
+    0,124,1,97,0,124,0,97,1,116,2,116,1,131,1,125,
+    2,116,1,106,3,160,4,161,0,68,0,93,36,92,2,125,
+    3,125,4,116,5,124,4,124,2,131,2,114,49,124,3,116,
+    1,106,6,118,0,114,30,116,7,125,5,110,9,116,0,160,
+    8,124,3,161,1,114,38,116,9,125,5,110,1,113,13,116,
+    10,124,4,124,5,131,2,125,6,116,11,124,6,124,4,131,
+    2,1,0,113,13,116,1,106,3,116,12,25,0,125,7,100,
+    1,68,0,93,23,125,8,124,8,116,1,106,3,118,1,114,
+    69,116,13,124,8,131,1,125,9,110,5,116,1,106,3,124,
+    8,25,0,125,9,116,14,124,7,124,8,124,9,131,3,1,
+    0,113,57,100,2,83,0,41,3,113,241,2,41,3,113,26,
+    113,123,113,86,78,41,15,113,78,113,20,113,3,113,127,113,
+    242,2,113,189,2,113,108,113,223,1,113,117,113,130,2,113,
+    197,1,113,203,1,113,9,113,240,2,113,12,41,10,113,243,
+    2,113,244,2,113,245,2,113,21,113,132,1,113,145,1,113,
+    131,1,113,246,2,113,247,2,113,248,2,82,1,82,1,113,
+    5,113,249,2,146,18,115,42,0,0,0,4,9,4,1,8,
+    3,18,1,10,1,10,1,6,1,10,1,6,1,2,2,10,
+    1,10,1,2,128,10,3,8,1,10,1,10,1,10,2,14,
+    1,4,251,255,128,113,249,2,67,4,0,0,4,6,134,1,
+    115,38,0,0,0,116,0,124,0,124,1,131,2,1,0,116,
+    1,106,2,160,3,116,4,161,1,1,0,116,1,106,2,160,
+    3,116,5,161,1,1,0,100,1,83,0,41,2,113,250,2,
+    78,41,6,113,249,2,113,20,113,180,2,113,163,1,113,223,
+    1,113,130,2,41,2,113,243,2,113,244,2,82,1,82,1,
+    113,5,113,251,2,216,18,115,8,0,0,0,10,2,12,2,
+    16,1,255,128,113,251,2,67,0,0,0,2,8,134,1,115,
+    32,0,0,0,100,1,100,2,108,0,125,0,124,0,97,1,
+    124,0,160,2,116,3,106,4,116,5,25,0,161,1,1,0,
+    100,2,83,0,41,3,113,252,2,82,4,78,41,6,113,253,
+    2,113,174,1,113,251,2,113,20,113,127,113,9,41,1,113,
+    253,2,82,1,82,1,113,5,113,254,2,232,18,115,8,0,
+    0,0,8,3,4,1,20,1,255,128,113,254,2,82,31,82,
+    0,82,3,41,4,78,78,82,1,82,4,41,54,113,10,113,
+    6,113,26,113,123,113,86,113,174,1,113,19,113,22,113,80,
+    113,38,113,52,113,23,113,24,113,59,113,66,113,70,113,88,
+    113,92,113,105,113,114,113,120,113,133,1,113,147,1,113,148,
+    1,113,126,113,197,1,113,203,1,113,208,1,113,142,1,113,
+    128,1,113,218,1,113,221,1,113,129,1,113,223,1,113,130,
+    2,113,155,2,113,173,2,113,176,2,113,182,2,113,193,2,
+    113,255,2,113,199,2,113,204,2,113,128,3,113,207,2,113,
+    208,2,113,210,2,113,219,2,113,232,2,113,238,2,113,240,
+    2,113,249,2,113,251,2,113,254,2,82,1,82,1,82,1,
+    113,5,113,129,3,2,115,106,0,0,0,4,0,8,22,4,
+    9,4,1,4,1,4,3,8,3,8,8,4,8,4,2,16,
+    3,14,4,14,77,14,21,8,16,8,37,8,17,14,11,8,
+    8,8,11,8,12,8,19,14,26,16,101,10,26,14,45,8,
+    72,8,17,8,17,8,30,8,36,8,45,14,15,14,80,14,
+    85,8,13,8,9,10,10,8,47,4,16,8,1,8,2,6,
+    32,8,3,10,16,14,15,8,37,10,27,8,37,8,7,8,
+    35,12,8,255,128,
 };
@@ -1,737 +1,345 @@
 /* Auto-generated by Programs/_freeze_importlib.c */
 const unsigned char _Py_M__importlib_bootstrap_external[] = {
-    99,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,5,0,0,0,64,0,0,0,115,250,2,0,0,100,0,
-    90,0,100,1,97,1,100,2,100,1,108,2,90,2,100,2,
-    100,1,108,3,90,3,100,2,100,1,108,4,90,4,100,2,
-    100,1,108,5,90,5,100,2,100,1,108,6,90,6,101,4,
-    106,7,100,3,107,2,90,8,101,8,114,40,100,2,100,1,
-    108,9,90,10,100,2,100,1,108,11,90,11,110,4,100,2,
-    100,1,108,12,90,10,101,8,114,51,100,4,100,5,103,2,
-    90,13,110,3,100,5,103,1,90,13,101,14,100,6,100,7,
-    132,0,101,13,68,0,131,1,131,1,115,65,74,0,130,1,
-    101,13,100,2,25,0,90,15,101,16,101,13,131,1,90,17,
-    100,8,160,18,101,13,161,1,90,13,100,9,100,10,132,0,
-    101,13,68,0,131,1,90,19,100,11,90,20,100,12,90,21,
-    101,21,101,20,23,0,90,22,100,13,100,14,132,0,90,23,
-    101,23,131,0,90,24,100,15,100,16,132,0,90,25,100,17,
-    100,18,132,0,90,26,100,19,100,20,132,0,90,27,101,8,
-    114,119,100,21,100,22,132,0,90,28,110,4,100,23,100,22,
-    132,0,90,28,100,24,100,25,132,0,90,29,100,26,100,27,
-    132,0,90,30,100,28,100,29,132,0,90,31,100,30,100,31,
-    132,0,90,32,100,32,100,33,132,0,90,33,101,8,114,150,
-    100,34,100,35,132,0,90,34,110,4,100,36,100,35,132,0,
-    90,34,100,112,100,38,100,39,132,1,90,35,101,36,101,35,
-    106,37,131,1,90,38,100,40,160,39,100,41,100,42,161,2,
-    100,43,23,0,90,40,101,41,160,42,101,40,100,42,161,2,
-    90,43,100,44,90,44,100,45,90,45,100,46,103,1,90,46,
-    101,8,114,192,101,46,160,47,100,47,161,1,1,0,101,2,
-    160,48,161,0,90,49,100,48,103,1,90,50,101,50,4,0,
-    90,51,90,52,100,113,100,1,100,49,156,1,100,50,100,51,
-    132,3,90,53,100,52,100,53,132,0,90,54,100,54,100,55,
-    132,0,90,55,100,56,100,57,132,0,90,56,100,58,100,59,
-    132,0,90,57,100,60,100,61,132,0,90,58,100,62,100,63,
-    132,0,90,59,100,64,100,65,132,0,90,60,100,66,100,67,
-    132,0,90,61,100,68,100,69,132,0,90,62,100,114,100,70,
-    100,71,132,1,90,63,100,115,100,72,100,73,132,1,90,64,
-    100,116,100,75,100,76,132,1,90,65,100,77,100,78,132,0,
-    90,66,101,67,131,0,90,68,100,113,100,1,101,68,100,79,
-    156,2,100,80,100,81,132,3,90,69,71,0,100,82,100,83,
-    132,0,100,83,131,2,90,70,71,0,100,84,100,85,132,0,
-    100,85,131,2,90,71,71,0,100,86,100,87,132,0,100,87,
-    101,71,131,3,90,72,71,0,100,88,100,89,132,0,100,89,
-    131,2,90,73,71,0,100,90,100,91,132,0,100,91,101,73,
-    101,72,131,4,90,74,71,0,100,92,100,93,132,0,100,93,
-    101,73,101,71,131,4,90,75,71,0,100,94,100,95,132,0,
-    100,95,101,73,101,71,131,4,90,76,71,0,100,96,100,97,
-    132,0,100,97,131,2,90,77,71,0,100,98,100,99,132,0,
-    100,99,131,2,90,78,71,0,100,100,100,101,132,0,100,101,
-    131,2,90,79,71,0,100,102,100,103,132,0,100,103,131,2,
-    90,80,100,113,100,104,100,105,132,1,90,81,100,106,100,107,
-    132,0,90,82,100,108,100,109,132,0,90,83,100,110,100,111,
-    132,0,90,84,100,1,83,0,41,117,97,94,1,0,0,67,
-    111,114,101,32,105,109,112,108,101,109,101,110,116,97,116,105,
-    111,110,32,111,102,32,112,97,116,104,45,98,97,115,101,100,
-    32,105,109,112,111,114,116,46,10,10,84,104,105,115,32,109,
-    111,100,117,108,101,32,105,115,32,78,79,84,32,109,101,97,
-    110,116,32,116,111,32,98,101,32,100,105,114,101,99,116,108,
-    121,32,105,109,112,111,114,116,101,100,33,32,73,116,32,104,
-    97,115,32,98,101,101,110,32,100,101,115,105,103,110,101,100,
-    32,115,117,99,104,10,116,104,97,116,32,105,116,32,99,97,
-    110,32,98,101,32,98,111,111,116,115,116,114,97,112,112,101,
-    100,32,105,110,116,111,32,80,121,116,104,111,110,32,97,115,
-    32,116,104,101,32,105,109,112,108,101,109,101,110,116,97,116,
-    105,111,110,32,111,102,32,105,109,112,111,114,116,46,32,65,
-    115,10,115,117,99,104,32,105,116,32,114,101,113,117,105,114,
-    101,115,32,116,104,101,32,105,110,106,101,99,116,105,111,110,
-    32,111,102,32,115,112,101,99,105,102,105,99,32,109,111,100,
-    117,108,101,115,32,97,110,100,32,97,116,116,114,105,98,117,
-    116,101,115,32,105,110,32,111,114,100,101,114,32,116,111,10,
-    119,111,114,107,46,32,79,110,101,32,115,104,111,117,108,100,
-    32,117,115,101,32,105,109,112,111,114,116,108,105,98,32,97,
-    115,32,116,104,101,32,112,117,98,108,105,99,45,102,97,99,
-    105,110,103,32,118,101,114,115,105,111,110,32,111,102,32,116,
-    104,105,115,32,109,111,100,117,108,101,46,10,10,78,233,0,
-    0,0,0,90,5,119,105,110,51,50,250,1,92,250,1,47,
-    99,1,0,0,0,0,0,0,0,0,0,0,0,2,0,0,
-    0,3,0,0,0,99,0,0,0,115,28,0,0,0,129,0,
-    124,0,93,9,125,1,116,0,124,1,131,1,100,0,107,2,
-    86,0,1,0,113,2,100,1,83,0,41,2,233,1,0,0,
-    0,78,41,1,218,3,108,101,110,41,2,218,2,46,48,218,
-    3,115,101,112,169,0,114,7,0,0,0,250,38,60,102,114,
-    111,122,101,110,32,105,109,112,111,114,116,108,105,98,46,95,
-    98,111,111,116,115,116,114,97,112,95,101,120,116,101,114,110,
-    97,108,62,218,9,60,103,101,110,101,120,112,114,62,46,0,
-    0,0,115,6,0,0,0,6,128,22,0,255,128,114,9,0,
-    0,0,218,0,99,1,0,0,0,0,0,0,0,0,0,0,
-    0,2,0,0,0,4,0,0,0,67,0,0,0,115,22,0,
-    0,0,104,0,124,0,93,7,125,1,100,0,124,1,155,0,
-    157,2,146,2,113,2,83,0,41,1,250,1,58,114,7,0,
-    0,0,41,2,114,5,0,0,0,218,1,115,114,7,0,0,
-    0,114,7,0,0,0,114,8,0,0,0,218,9,60,115,101,
-    116,99,111,109,112,62,50,0,0,0,115,4,0,0,0,22,
-    0,255,128,114,13,0,0,0,41,1,218,3,119,105,110,41,
-    2,90,6,99,121,103,119,105,110,90,6,100,97,114,119,105,
-    110,99,0,0,0,0,0,0,0,0,0,0,0,0,1,0,
-    0,0,3,0,0,0,3,0,0,0,115,62,0,0,0,116,
-    0,106,1,160,2,116,3,161,1,114,25,116,0,106,1,160,
-    2,116,4,161,1,114,15,100,1,137,0,110,2,100,2,137,
-    0,135,0,102,1,100,3,100,4,132,8,125,0,124,0,83,
-    0,100,5,100,4,132,0,125,0,124,0,83,0,41,6,78,
-    90,12,80,89,84,72,79,78,67,65,83,69,79,75,115,12,
-    0,0,0,80,89,84,72,79,78,67,65,83,69,79,75,99,
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    2,0,0,0,19,0,0,0,115,20,0,0,0,116,0,106,
-    1,106,2,12,0,111,9,136,0,116,3,106,4,118,0,83,
-    0,41,2,122,94,84,114,117,101,32,105,102,32,102,105,108,
-    101,110,97,109,101,115,32,109,117,115,116,32,98,101,32,99,
-    104,101,99,107,101,100,32,99,97,115,101,45,105,110,115,101,
-    110,115,105,116,105,118,101,108,121,32,97,110,100,32,105,103,
-    110,111,114,101,32,101,110,118,105,114,111,110,109,101,110,116,
-    32,102,108,97,103,115,32,97,114,101,32,110,111,116,32,115,
-    101,116,46,78,41,5,218,3,115,121,115,218,5,102,108,97,
-    103,115,218,18,105,103,110,111,114,101,95,101,110,118,105,114,
-    111,110,109,101,110,116,218,3,95,111,115,90,7,101,110,118,
-    105,114,111,110,114,7,0,0,0,169,1,218,3,107,101,121,
-    114,7,0,0,0,114,8,0,0,0,218,11,95,114,101,108,
-    97,120,95,99,97,115,101,67,0,0,0,243,4,0,0,0,
-    20,2,255,128,122,37,95,109,97,107,101,95,114,101,108,97,
-    120,95,99,97,115,101,46,60,108,111,99,97,108,115,62,46,
-    95,114,101,108,97,120,95,99,97,115,101,99,0,0,0,0,
-    0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,
-    83,0,0,0,243,4,0,0,0,100,1,83,0,41,3,122,
+    88,251,4,2,222,2,67,111,114,101,32,105,109,112,108,101,
+    109,101,110,116,97,116,105,111,110,32,111,102,32,112,97,116,
+    104,45,98,97,115,101,100,32,105,109,112,111,114,116,46,10,
+    10,84,104,105,115,32,109,111,100,117,108,101,32,105,115,32,
+    78,79,84,32,109,101,97,110,116,32,116,111,32,98,101,32,
+    100,105,114,101,99,116,108,121,32,105,109,112,111,114,116,101,
+    100,33,32,73,116,32,104,97,115,32,98,101,101,110,32,100,
+    101,115,105,103,110,101,100,32,115,117,99,104,10,116,104,97,
+    116,32,105,116,32,99,97,110,32,98,101,32,98,111,111,116,
+    115,116,114,97,112,112,101,100,32,105,110,116,111,32,80,121,
+    116,104,111,110,32,97,115,32,116,104,101,32,105,109,112,108,
+    101,109,101,110,116,97,116,105,111,110,32,111,102,32,105,109,
+    112,111,114,116,46,32,65,115,10,115,117,99,104,32,105,116,
+    32,114,101,113,117,105,114,101,115,32,116,104,101,32,105,110,
+    106,101,99,116,105,111,110,32,111,102,32,115,112,101,99,105,
+    102,105,99,32,109,111,100,117,108,101,115,32,97,110,100,32,
+    97,116,116,114,105,98,117,116,101,115,32,105,110,32,111,114,
+    100,101,114,32,116,111,10,119,111,114,107,46,32,79,110,101,
+    32,115,104,111,117,108,100,32,117,115,101,32,105,109,112,111,
+    114,116,108,105,98,32,97,115,32,116,104,101,32,112,117,98,
+    108,105,99,45,102,97,99,105,110,103,32,118,101,114,115,105,
+    111,110,32,111,102,32,116,104,105,115,32,109,111,100,117,108,
+    101,46,10,10,3,5,119,105,110,51,50,2,1,92,2,1,
+    47,3,3,108,101,110,3,2,46,48,3,3,115,101,112,2,
+    38,60,102,114,111,122,101,110,32,105,109,112,111,114,116,108,
+    105,98,46,95,98,111,111,116,115,116,114,97,112,95,101,120,
+    116,101,114,110,97,108,62,3,9,60,103,101,110,101,120,112,
+    114,62,3,0,2,1,58,3,1,115,3,9,60,115,101,116,
+    99,111,109,112,62,3,3,119,105,110,3,6,99,121,103,119,
+    105,110,3,6,100,97,114,119,105,110,3,12,80,89,84,72,
+    79,78,67,65,83,69,79,75,2,94,84,114,117,101,32,105,
+    102,32,102,105,108,101,110,97,109,101,115,32,109,117,115,116,
+    32,98,101,32,99,104,101,99,107,101,100,32,99,97,115,101,
+    45,105,110,115,101,110,115,105,116,105,118,101,108,121,32,97,
+    110,100,32,105,103,110,111,114,101,32,101,110,118,105,114,111,
+    110,109,101,110,116,32,102,108,97,103,115,32,97,114,101,32,
+    110,111,116,32,115,101,116,46,3,3,115,121,115,3,5,102,
+    108,97,103,115,3,18,105,103,110,111,114,101,95,101,110,118,
+    105,114,111,110,109,101,110,116,3,3,95,111,115,3,7,101,
+    110,118,105,114,111,110,3,3,107,101,121,3,11,95,114,101,
+    108,97,120,95,99,97,115,101,2,37,95,109,97,107,101,95,
+    114,101,108,97,120,95,99,97,115,101,46,60,108,111,99,97,
+    108,115,62,46,95,114,101,108,97,120,95,99,97,115,101,2,
     53,84,114,117,101,32,105,102,32,102,105,108,101,110,97,109,
     101,115,32,109,117,115,116,32,98,101,32,99,104,101,99,107,
     101,100,32,99,97,115,101,45,105,110,115,101,110,115,105,116,
-    105,118,101,108,121,46,70,78,114,7,0,0,0,114,7,0,
-    0,0,114,7,0,0,0,114,7,0,0,0,114,8,0,0,
-    0,114,21,0,0,0,71,0,0,0,243,4,0,0,0,4,
-    2,255,128,41,5,114,15,0,0,0,218,8,112,108,97,116,
-    102,111,114,109,218,10,115,116,97,114,116,115,119,105,116,104,
-    218,27,95,67,65,83,69,95,73,78,83,69,78,83,73,84,
-    73,86,69,95,80,76,65,84,70,79,82,77,83,218,35,95,
-    67,65,83,69,95,73,78,83,69,78,83,73,84,73,86,69,
-    95,80,76,65,84,70,79,82,77,83,95,83,84,82,95,75,
-    69,89,41,1,114,21,0,0,0,114,7,0,0,0,114,19,
-    0,0,0,114,8,0,0,0,218,16,95,109,97,107,101,95,
-    114,101,108,97,120,95,99,97,115,101,60,0,0,0,115,18,
-    0,0,0,12,1,12,1,6,1,4,2,12,2,4,7,8,
-    253,4,3,255,128,114,29,0,0,0,99,1,0,0,0,0,
-    0,0,0,0,0,0,0,1,0,0,0,4,0,0,0,67,
-    0,0,0,115,20,0,0,0,116,0,124,0,131,1,100,1,
-    64,0,160,1,100,2,100,3,161,2,83,0,41,5,122,42,
-    67,111,110,118,101,114,116,32,97,32,51,50,45,98,105,116,
-    32,105,110,116,101,103,101,114,32,116,111,32,108,105,116,116,
-    108,101,45,101,110,100,105,97,110,46,236,3,0,0,0,255,
-    127,255,127,3,0,233,4,0,0,0,218,6,108,105,116,116,
-    108,101,78,41,2,218,3,105,110,116,218,8,116,111,95,98,
-    121,116,101,115,41,1,218,1,120,114,7,0,0,0,114,7,
-    0,0,0,114,8,0,0,0,218,12,95,112,97,99,107,95,
-    117,105,110,116,51,50,79,0,0,0,114,22,0,0,0,114,
-    36,0,0,0,99,1,0,0,0,0,0,0,0,0,0,0,
-    0,1,0,0,0,4,0,0,0,67,0,0,0,243,28,0,
-    0,0,116,0,124,0,131,1,100,1,107,2,115,8,74,0,
-    130,1,116,1,160,2,124,0,100,2,161,2,83,0,41,4,
-    122,47,67,111,110,118,101,114,116,32,52,32,98,121,116,101,
-    115,32,105,110,32,108,105,116,116,108,101,45,101,110,100,105,
-    97,110,32,116,111,32,97,110,32,105,110,116,101,103,101,114,
-    46,114,31,0,0,0,114,32,0,0,0,78,169,3,114,4,
-    0,0,0,114,33,0,0,0,218,10,102,114,111,109,95,98,
-    121,116,101,115,169,1,218,4,100,97,116,97,114,7,0,0,
-    0,114,7,0,0,0,114,8,0,0,0,218,14,95,117,110,
-    112,97,99,107,95,117,105,110,116,51,50,84,0,0,0,243,
-    6,0,0,0,16,2,12,1,255,128,114,42,0,0,0,99,
-    1,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,
-    4,0,0,0,67,0,0,0,114,37,0,0,0,41,4,122,
-    47,67,111,110,118,101,114,116,32,50,32,98,121,116,101,115,
-    32,105,110,32,108,105,116,116,108,101,45,101,110,100,105,97,
-    110,32,116,111,32,97,110,32,105,110,116,101,103,101,114,46,
-    233,2,0,0,0,114,32,0,0,0,78,114,38,0,0,0,
-    114,40,0,0,0,114,7,0,0,0,114,7,0,0,0,114,
-    8,0,0,0,218,14,95,117,110,112,97,99,107,95,117,105,
-    110,116,49,54,89,0,0,0,114,43,0,0,0,114,45,0,
-    0,0,99,0,0,0,0,0,0,0,0,0,0,0,0,5,
-    0,0,0,4,0,0,0,71,0,0,0,115,228,0,0,0,
-    124,0,115,4,100,1,83,0,116,0,124,0,131,1,100,2,
-    107,2,114,14,124,0,100,3,25,0,83,0,100,1,125,1,
-    103,0,125,2,116,1,116,2,106,3,124,0,131,2,68,0,
-    93,61,92,2,125,3,125,4,124,3,160,4,116,5,161,1,
-    115,38,124,3,160,6,116,5,161,1,114,51,124,3,160,7,
-    116,8,161,1,112,44,124,1,125,1,116,9,124,4,23,0,
-    103,1,125,2,113,24,124,3,160,6,100,4,161,1,114,76,
-    124,1,160,10,161,0,124,3,160,10,161,0,107,3,114,70,
-    124,3,125,1,124,4,103,1,125,2,113,24,124,2,160,11,
-    124,4,161,1,1,0,113,24,124,3,112,79,124,1,125,1,
-    124,2,160,11,124,4,161,1,1,0,113,24,100,5,100,6,
-    132,0,124,2,68,0,131,1,125,2,116,0,124,2,131,1,
-    100,2,107,2,114,107,124,2,100,3,25,0,115,107,124,1,
-    116,9,23,0,83,0,124,1,116,9,160,12,124,2,161,1,
-    23,0,83,0,41,8,250,31,82,101,112,108,97,99,101,109,
-    101,110,116,32,102,111,114,32,111,115,46,112,97,116,104,46,
-    106,111,105,110,40,41,46,114,10,0,0,0,114,3,0,0,
-    0,114,0,0,0,0,114,11,0,0,0,99,1,0,0,0,
-    0,0,0,0,0,0,0,0,2,0,0,0,5,0,0,0,
-    83,0,0,0,243,26,0,0,0,103,0,124,0,93,9,125,
-    1,124,1,114,2,124,1,160,0,116,1,161,1,145,2,113,
-    2,83,0,114,7,0,0,0,169,2,218,6,114,115,116,114,
-    105,112,218,15,112,97,116,104,95,115,101,112,97,114,97,116,
-    111,114,115,169,2,114,5,0,0,0,218,1,112,114,7,0,
-    0,0,114,7,0,0,0,114,8,0,0,0,218,10,60,108,
-    105,115,116,99,111,109,112,62,119,0,0,0,115,4,0,0,
-    0,26,0,255,128,250,30,95,112,97,116,104,95,106,111,105,
-    110,46,60,108,111,99,97,108,115,62,46,60,108,105,115,116,
-    99,111,109,112,62,78,41,13,114,4,0,0,0,218,3,109,
-    97,112,114,18,0,0,0,218,15,95,112,97,116,104,95,115,
-    112,108,105,116,114,111,111,116,114,26,0,0,0,218,14,112,
-    97,116,104,95,115,101,112,95,116,117,112,108,101,218,8,101,
-    110,100,115,119,105,116,104,114,49,0,0,0,114,50,0,0,
-    0,218,8,112,97,116,104,95,115,101,112,218,8,99,97,115,
-    101,102,111,108,100,218,6,97,112,112,101,110,100,218,4,106,
-    111,105,110,41,5,218,10,112,97,116,104,95,112,97,114,116,
-    115,218,4,114,111,111,116,218,4,112,97,116,104,90,8,110,
-    101,119,95,114,111,111,116,218,4,116,97,105,108,114,7,0,
-    0,0,114,7,0,0,0,114,8,0,0,0,218,10,95,112,
-    97,116,104,95,106,111,105,110,96,0,0,0,115,44,0,0,
-    0,4,2,4,1,12,1,8,1,4,1,4,1,20,1,20,
-    1,14,1,12,1,10,1,16,1,4,3,8,1,12,2,8,
-    2,12,1,14,1,20,1,8,2,14,1,255,128,114,67,0,
-    0,0,99,0,0,0,0,0,0,0,0,0,0,0,0,1,
-    0,0,0,4,0,0,0,71,0,0,0,115,20,0,0,0,
-    116,0,160,1,100,1,100,2,132,0,124,0,68,0,131,1,
-    161,1,83,0,41,4,114,46,0,0,0,99,1,0,0,0,
-    0,0,0,0,0,0,0,0,2,0,0,0,5,0,0,0,
-    83,0,0,0,114,47,0,0,0,114,7,0,0,0,114,48,
-    0,0,0,41,2,114,5,0,0,0,218,4,112,97,114,116,
-    114,7,0,0,0,114,7,0,0,0,114,8,0,0,0,114,
-    53,0,0,0,128,0,0,0,115,8,0,0,0,6,0,6,
-    1,14,255,255,128,114,54,0,0,0,78,41,2,114,59,0,
-    0,0,114,62,0,0,0,41,1,114,63,0,0,0,114,7,
-    0,0,0,114,7,0,0,0,114,8,0,0,0,114,67,0,
-    0,0,126,0,0,0,115,8,0,0,0,10,2,2,1,8,
-    255,255,128,99,1,0,0,0,0,0,0,0,0,0,0,0,
-    2,0,0,0,4,0,0,0,3,0,0,0,115,66,0,0,
-    0,116,0,135,0,102,1,100,1,100,2,132,8,116,1,68,
-    0,131,1,131,1,125,1,124,1,100,3,107,0,114,19,100,
-    4,136,0,102,2,83,0,136,0,100,5,124,1,133,2,25,
-    0,136,0,124,1,100,6,23,0,100,5,133,2,25,0,102,
-    2,83,0,41,7,122,32,82,101,112,108,97,99,101,109,101,
-    110,116,32,102,111,114,32,111,115,46,112,97,116,104,46,115,
-    112,108,105,116,40,41,46,99,1,0,0,0,0,0,0,0,
-    0,0,0,0,2,0,0,0,4,0,0,0,51,0,0,0,
-    115,26,0,0,0,129,0,124,0,93,8,125,1,136,0,160,
-    0,124,1,161,1,86,0,1,0,113,2,100,0,83,0,169,
-    1,78,41,1,218,5,114,102,105,110,100,114,51,0,0,0,
-    169,1,114,65,0,0,0,114,7,0,0,0,114,8,0,0,
-    0,114,9,0,0,0,134,0,0,0,115,6,0,0,0,6,
-    128,20,0,255,128,122,30,95,112,97,116,104,95,115,112,108,
-    105,116,46,60,108,111,99,97,108,115,62,46,60,103,101,110,
-    101,120,112,114,62,114,0,0,0,0,114,10,0,0,0,78,
-    114,3,0,0,0,41,2,218,3,109,97,120,114,50,0,0,
-    0,41,2,114,65,0,0,0,218,1,105,114,7,0,0,0,
-    114,71,0,0,0,114,8,0,0,0,218,11,95,112,97,116,
-    104,95,115,112,108,105,116,132,0,0,0,115,10,0,0,0,
-    22,2,8,1,8,1,28,1,255,128,114,74,0,0,0,99,
-    1,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,
-    3,0,0,0,67,0,0,0,115,10,0,0,0,116,0,160,
-    1,124,0,161,1,83,0,41,2,122,126,83,116,97,116,32,
-    116,104,101,32,112,97,116,104,46,10,10,32,32,32,32,77,
-    97,100,101,32,97,32,115,101,112,97,114,97,116,101,32,102,
-    117,110,99,116,105,111,110,32,116,111,32,109,97,107,101,32,
-    105,116,32,101,97,115,105,101,114,32,116,111,32,111,118,101,
-    114,114,105,100,101,32,105,110,32,101,120,112,101,114,105,109,
-    101,110,116,115,10,32,32,32,32,40,101,46,103,46,32,99,
-    97,99,104,101,32,115,116,97,116,32,114,101,115,117,108,116,
-    115,41,46,10,10,32,32,32,32,78,41,2,114,18,0,0,
-    0,90,4,115,116,97,116,114,71,0,0,0,114,7,0,0,
-    0,114,7,0,0,0,114,8,0,0,0,218,10,95,112,97,
-    116,104,95,115,116,97,116,140,0,0,0,115,4,0,0,0,
-    10,7,255,128,114,75,0,0,0,99,2,0,0,0,0,0,
-    0,0,0,0,0,0,3,0,0,0,8,0,0,0,67,0,
-    0,0,115,48,0,0,0,122,6,116,0,124,0,131,1,125,
-    2,87,0,110,9,4,0,116,1,121,23,1,0,1,0,1,
-    0,89,0,100,1,83,0,124,2,106,2,100,2,64,0,124,
-    1,107,2,83,0,119,0,41,4,122,49,84,101,115,116,32,
-    119,104,101,116,104,101,114,32,116,104,101,32,112,97,116,104,
-    32,105,115,32,116,104,101,32,115,112,101,99,105,102,105,101,
-    100,32,109,111,100,101,32,116,121,112,101,46,70,105,0,240,
-    0,0,78,41,3,114,75,0,0,0,218,7,79,83,69,114,
-    114,111,114,218,7,115,116,95,109,111,100,101,41,3,114,65,
-    0,0,0,218,4,109,111,100,101,90,9,115,116,97,116,95,
-    105,110,102,111,114,7,0,0,0,114,7,0,0,0,114,8,
-    0,0,0,218,18,95,112,97,116,104,95,105,115,95,109,111,
-    100,101,95,116,121,112,101,150,0,0,0,115,14,0,0,0,
-    2,2,12,1,12,1,6,1,14,1,2,254,255,128,114,79,
-    0,0,0,99,1,0,0,0,0,0,0,0,0,0,0,0,
-    1,0,0,0,3,0,0,0,67,0,0,0,115,10,0,0,
-    0,116,0,124,0,100,1,131,2,83,0,41,3,122,31,82,
+    105,118,101,108,121,46,3,8,112,108,97,116,102,111,114,109,
+    3,10,115,116,97,114,116,115,119,105,116,104,3,27,95,67,
+    65,83,69,95,73,78,83,69,78,83,73,84,73,86,69,95,
+    80,76,65,84,70,79,82,77,83,3,35,95,67,65,83,69,
+    95,73,78,83,69,78,83,73,84,73,86,69,95,80,76,65,
+    84,70,79,82,77,83,95,83,84,82,95,75,69,89,3,16,
+    95,109,97,107,101,95,114,101,108,97,120,95,99,97,115,101,
+    2,42,67,111,110,118,101,114,116,32,97,32,51,50,45,98,
+    105,116,32,105,110,116,101,103,101,114,32,116,111,32,108,105,
+    116,116,108,101,45,101,110,100,105,97,110,46,3,6,108,105,
+    116,116,108,101,3,3,105,110,116,3,8,116,111,95,98,121,
+    116,101,115,3,1,120,3,12,95,112,97,99,107,95,117,105,
+    110,116,51,50,2,47,67,111,110,118,101,114,116,32,52,32,
+    98,121,116,101,115,32,105,110,32,108,105,116,116,108,101,45,
+    101,110,100,105,97,110,32,116,111,32,97,110,32,105,110,116,
+    101,103,101,114,46,3,10,102,114,111,109,95,98,121,116,101,
+    115,3,4,100,97,116,97,3,14,95,117,110,112,97,99,107,
+    95,117,105,110,116,51,50,2,47,67,111,110,118,101,114,116,
+    32,50,32,98,121,116,101,115,32,105,110,32,108,105,116,116,
+    108,101,45,101,110,100,105,97,110,32,116,111,32,97,110,32,
+    105,110,116,101,103,101,114,46,3,14,95,117,110,112,97,99,
+    107,95,117,105,110,116,49,54,2,31,82,101,112,108,97,99,
+    101,109,101,110,116,32,102,111,114,32,111,115,46,112,97,116,
+    104,46,106,111,105,110,40,41,46,3,6,114,115,116,114,105,
+    112,3,15,112,97,116,104,95,115,101,112,97,114,97,116,111,
+    114,115,3,1,112,3,10,60,108,105,115,116,99,111,109,112,
+    62,2,30,95,112,97,116,104,95,106,111,105,110,46,60,108,
+    111,99,97,108,115,62,46,60,108,105,115,116,99,111,109,112,
+    62,3,3,109,97,112,3,15,95,112,97,116,104,95,115,112,
+    108,105,116,114,111,111,116,3,14,112,97,116,104,95,115,101,
+    112,95,116,117,112,108,101,3,8,101,110,100,115,119,105,116,
+    104,3,8,112,97,116,104,95,115,101,112,3,8,99,97,115,
+    101,102,111,108,100,3,6,97,112,112,101,110,100,3,4,106,
+    111,105,110,3,10,112,97,116,104,95,112,97,114,116,115,3,
+    4,114,111,111,116,3,4,112,97,116,104,3,8,110,101,119,
+    95,114,111,111,116,3,4,116,97,105,108,3,10,95,112,97,
+    116,104,95,106,111,105,110,3,4,112,97,114,116,2,32,82,
     101,112,108,97,99,101,109,101,110,116,32,102,111,114,32,111,
-    115,46,112,97,116,104,46,105,115,102,105,108,101,46,105,0,
-    128,0,0,78,41,1,114,79,0,0,0,114,71,0,0,0,
-    114,7,0,0,0,114,7,0,0,0,114,8,0,0,0,218,
-    12,95,112,97,116,104,95,105,115,102,105,108,101,159,0,0,
-    0,243,4,0,0,0,10,2,255,128,114,80,0,0,0,99,
-    1,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,
-    3,0,0,0,67,0,0,0,115,22,0,0,0,124,0,115,
-    6,116,0,160,1,161,0,125,0,116,2,124,0,100,1,131,
-    2,83,0,41,3,122,30,82,101,112,108,97,99,101,109,101,
-    110,116,32,102,111,114,32,111,115,46,112,97,116,104,46,105,
-    115,100,105,114,46,105,0,64,0,0,78,41,3,114,18,0,
-    0,0,218,6,103,101,116,99,119,100,114,79,0,0,0,114,
-    71,0,0,0,114,7,0,0,0,114,7,0,0,0,114,8,
-    0,0,0,218,11,95,112,97,116,104,95,105,115,100,105,114,
-    164,0,0,0,115,8,0,0,0,4,2,8,1,10,1,255,
-    128,114,83,0,0,0,99,1,0,0,0,0,0,0,0,0,
-    0,0,0,2,0,0,0,4,0,0,0,67,0,0,0,115,
-    62,0,0,0,124,0,115,4,100,1,83,0,116,0,160,1,
-    124,0,161,1,100,2,25,0,160,2,100,3,100,4,161,2,
-    125,1,116,3,124,1,131,1,100,5,107,4,111,30,124,1,
-    160,4,100,6,161,1,112,30,124,1,160,5,100,4,161,1,
-    83,0,41,8,250,30,82,101,112,108,97,99,101,109,101,110,
-    116,32,102,111,114,32,111,115,46,112,97,116,104,46,105,115,
-    97,98,115,46,70,114,0,0,0,0,114,2,0,0,0,114,
-    1,0,0,0,114,3,0,0,0,122,2,92,92,78,41,6,
-    114,18,0,0,0,114,56,0,0,0,218,7,114,101,112,108,
-    97,99,101,114,4,0,0,0,114,26,0,0,0,114,58,0,
-    0,0,41,2,114,65,0,0,0,114,64,0,0,0,114,7,
-    0,0,0,114,7,0,0,0,114,8,0,0,0,218,11,95,
-    112,97,116,104,95,105,115,97,98,115,172,0,0,0,115,10,
-    0,0,0,4,2,4,1,22,1,32,1,255,128,114,86,0,
-    0,0,99,1,0,0,0,0,0,0,0,0,0,0,0,1,
-    0,0,0,3,0,0,0,67,0,0,0,115,10,0,0,0,
-    124,0,160,0,116,1,161,1,83,0,41,2,114,84,0,0,
-    0,78,41,2,114,26,0,0,0,114,50,0,0,0,114,71,
-    0,0,0,114,7,0,0,0,114,7,0,0,0,114,8,0,
-    0,0,114,86,0,0,0,180,0,0,0,114,81,0,0,0,
-    233,182,1,0,0,99,3,0,0,0,0,0,0,0,0,0,
-    0,0,6,0,0,0,11,0,0,0,67,0,0,0,115,170,
-    0,0,0,100,1,160,0,124,0,116,1,124,0,131,1,161,
-    2,125,3,116,2,160,3,124,3,116,2,106,4,116,2,106,
-    5,66,0,116,2,106,6,66,0,124,2,100,2,64,0,161,
-    3,125,4,122,36,116,7,160,8,124,4,100,3,161,2,143,
-    13,125,5,124,5,160,9,124,1,161,1,1,0,87,0,100,
-    4,4,0,4,0,131,3,1,0,110,8,49,0,115,47,119,
-    1,1,0,1,0,1,0,89,0,1,0,116,2,160,10,124,
-    3,124,0,161,2,1,0,87,0,100,4,83,0,4,0,116,
-    11,121,84,1,0,1,0,1,0,122,7,116,2,160,12,124,
-    3,161,1,1,0,87,0,130,0,4,0,116,11,121,83,1,
-    0,1,0,1,0,89,0,130,0,119,0,119,0,41,5,122,
-    162,66,101,115,116,45,101,102,102,111,114,116,32,102,117,110,
-    99,116,105,111,110,32,116,111,32,119,114,105,116,101,32,100,
-    97,116,97,32,116,111,32,97,32,112,97,116,104,32,97,116,
-    111,109,105,99,97,108,108,121,46,10,32,32,32,32,66,101,
-    32,112,114,101,112,97,114,101,100,32,116,111,32,104,97,110,
-    100,108,101,32,97,32,70,105,108,101,69,120,105,115,116,115,
-    69,114,114,111,114,32,105,102,32,99,111,110,99,117,114,114,
-    101,110,116,32,119,114,105,116,105,110,103,32,111,102,32,116,
-    104,101,10,32,32,32,32,116,101,109,112,111,114,97,114,121,
-    32,102,105,108,101,32,105,115,32,97,116,116,101,109,112,116,
-    101,100,46,250,5,123,125,46,123,125,114,87,0,0,0,90,
-    2,119,98,78,41,13,218,6,102,111,114,109,97,116,218,2,
-    105,100,114,18,0,0,0,90,4,111,112,101,110,90,6,79,
-    95,69,88,67,76,90,7,79,95,67,82,69,65,84,90,8,
-    79,95,87,82,79,78,76,89,218,3,95,105,111,218,6,70,
-    105,108,101,73,79,218,5,119,114,105,116,101,114,85,0,0,
-    0,114,76,0,0,0,90,6,117,110,108,105,110,107,41,6,
-    114,65,0,0,0,114,41,0,0,0,114,78,0,0,0,90,
-    8,112,97,116,104,95,116,109,112,90,2,102,100,218,4,102,
-    105,108,101,114,7,0,0,0,114,7,0,0,0,114,8,0,
-    0,0,218,13,95,119,114,105,116,101,95,97,116,111,109,105,
-    99,185,0,0,0,115,38,0,0,0,16,5,6,1,22,1,
-    4,255,2,2,14,3,24,1,16,128,18,1,12,1,2,1,
-    12,1,2,3,12,254,2,1,2,1,2,254,2,253,255,128,
-    114,95,0,0,0,105,109,13,0,0,114,44,0,0,0,114,
-    32,0,0,0,115,2,0,0,0,13,10,90,11,95,95,112,
-    121,99,97,99,104,101,95,95,122,4,111,112,116,45,122,3,
-    46,112,121,122,4,46,112,121,119,122,4,46,112,121,99,41,
-    1,218,12,111,112,116,105,109,105,122,97,116,105,111,110,99,
-    2,0,0,0,0,0,0,0,1,0,0,0,12,0,0,0,
-    5,0,0,0,67,0,0,0,115,80,1,0,0,124,1,100,
-    1,117,1,114,26,116,0,160,1,100,2,116,2,161,2,1,
-    0,124,2,100,1,117,1,114,20,100,3,125,3,116,3,124,
-    3,131,1,130,1,124,1,114,24,100,4,110,1,100,5,125,
-    2,116,4,160,5,124,0,161,1,125,0,116,6,124,0,131,
-    1,92,2,125,4,125,5,124,5,160,7,100,6,161,1,92,
-    3,125,6,125,7,125,8,116,8,106,9,106,10,125,9,124,
-    9,100,1,117,0,114,57,116,11,100,7,131,1,130,1,100,
-    4,160,12,124,6,114,63,124,6,110,1,124,8,124,7,124,
-    9,103,3,161,1,125,10,124,2,100,1,117,0,114,86,116,
-    8,106,13,106,14,100,8,107,2,114,82,100,4,125,2,110,
-    4,116,8,106,13,106,14,125,2,116,15,124,2,131,1,125,
-    2,124,2,100,4,107,3,114,112,124,2,160,16,161,0,115,
-    105,116,17,100,9,160,18,124,2,161,1,131,1,130,1,100,
-    10,160,18,124,10,116,19,124,2,161,3,125,10,124,10,116,
-    20,100,8,25,0,23,0,125,11,116,8,106,21,100,1,117,
-    1,114,162,116,22,124,4,131,1,115,134,116,23,116,4,160,
-    24,161,0,124,4,131,2,125,4,124,4,100,5,25,0,100,
-    11,107,2,114,152,124,4,100,8,25,0,116,25,118,1,114,
-    152,124,4,100,12,100,1,133,2,25,0,125,4,116,23,116,
-    8,106,21,124,4,160,26,116,25,161,1,124,11,131,3,83,
-    0,116,23,124,4,116,27,124,11,131,3,83,0,41,13,97,
-    254,2,0,0,71,105,118,101,110,32,116,104,101,32,112,97,
-    116,104,32,116,111,32,97,32,46,112,121,32,102,105,108,101,
-    44,32,114,101,116,117,114,110,32,116,104,101,32,112,97,116,
-    104,32,116,111,32,105,116,115,32,46,112,121,99,32,102,105,
-    108,101,46,10,10,32,32,32,32,84,104,101,32,46,112,121,
-    32,102,105,108,101,32,100,111,101,115,32,110,111,116,32,110,
-    101,101,100,32,116,111,32,101,120,105,115,116,59,32,116,104,
-    105,115,32,115,105,109,112,108,121,32,114,101,116,117,114,110,
-    115,32,116,104,101,32,112,97,116,104,32,116,111,32,116,104,
-    101,10,32,32,32,32,46,112,121,99,32,102,105,108,101,32,
-    99,97,108,99,117,108,97,116,101,100,32,97,115,32,105,102,
-    32,116,104,101,32,46,112,121,32,102,105,108,101,32,119,101,
-    114,101,32,105,109,112,111,114,116,101,100,46,10,10,32,32,
-    32,32,84,104,101,32,39,111,112,116,105,109,105,122,97,116,
-    105,111,110,39,32,112,97,114,97,109,101,116,101,114,32,99,
-    111,110,116,114,111,108,115,32,116,104,101,32,112,114,101,115,
-    117,109,101,100,32,111,112,116,105,109,105,122,97,116,105,111,
-    110,32,108,101,118,101,108,32,111,102,10,32,32,32,32,116,
-    104,101,32,98,121,116,101,99,111,100,101,32,102,105,108,101,
-    46,32,73,102,32,39,111,112,116,105,109,105,122,97,116,105,
-    111,110,39,32,105,115,32,110,111,116,32,78,111,110,101,44,
-    32,116,104,101,32,115,116,114,105,110,103,32,114,101,112,114,
-    101,115,101,110,116,97,116,105,111,110,10,32,32,32,32,111,
-    102,32,116,104,101,32,97,114,103,117,109,101,110,116,32,105,
-    115,32,116,97,107,101,110,32,97,110,100,32,118,101,114,105,
-    102,105,101,100,32,116,111,32,98,101,32,97,108,112,104,97,
-    110,117,109,101,114,105,99,32,40,101,108,115,101,32,86,97,
-    108,117,101,69,114,114,111,114,10,32,32,32,32,105,115,32,
-    114,97,105,115,101,100,41,46,10,10,32,32,32,32,84,104,
-    101,32,100,101,98,117,103,95,111,118,101,114,114,105,100,101,
-    32,112,97,114,97,109,101,116,101,114,32,105,115,32,100,101,
-    112,114,101,99,97,116,101,100,46,32,73,102,32,100,101,98,
-    117,103,95,111,118,101,114,114,105,100,101,32,105,115,32,110,
-    111,116,32,78,111,110,101,44,10,32,32,32,32,97,32,84,
-    114,117,101,32,118,97,108,117,101,32,105,115,32,116,104,101,
-    32,115,97,109,101,32,97,115,32,115,101,116,116,105,110,103,
-    32,39,111,112,116,105,109,105,122,97,116,105,111,110,39,32,
-    116,111,32,116,104,101,32,101,109,112,116,121,32,115,116,114,
-    105,110,103,10,32,32,32,32,119,104,105,108,101,32,97,32,
-    70,97,108,115,101,32,118,97,108,117,101,32,105,115,32,101,
-    113,117,105,118,97,108,101,110,116,32,116,111,32,115,101,116,
-    116,105,110,103,32,39,111,112,116,105,109,105,122,97,116,105,
-    111,110,39,32,116,111,32,39,49,39,46,10,10,32,32,32,
-    32,73,102,32,115,121,115,46,105,109,112,108,101,109,101,110,
-    116,97,116,105,111,110,46,99,97,99,104,101,95,116,97,103,
-    32,105,115,32,78,111,110,101,32,116,104,101,110,32,78,111,
-    116,73,109,112,108,101,109,101,110,116,101,100,69,114,114,111,
-    114,32,105,115,32,114,97,105,115,101,100,46,10,10,32,32,
-    32,32,78,122,70,116,104,101,32,100,101,98,117,103,95,111,
-    118,101,114,114,105,100,101,32,112,97,114,97,109,101,116,101,
-    114,32,105,115,32,100,101,112,114,101,99,97,116,101,100,59,
-    32,117,115,101,32,39,111,112,116,105,109,105,122,97,116,105,
-    111,110,39,32,105,110,115,116,101,97,100,122,50,100,101,98,
-    117,103,95,111,118,101,114,114,105,100,101,32,111,114,32,111,
-    112,116,105,109,105,122,97,116,105,111,110,32,109,117,115,116,
-    32,98,101,32,115,101,116,32,116,111,32,78,111,110,101,114,
-    10,0,0,0,114,3,0,0,0,218,1,46,250,36,115,121,
-    115,46,105,109,112,108,101,109,101,110,116,97,116,105,111,110,
-    46,99,97,99,104,101,95,116,97,103,32,105,115,32,78,111,
-    110,101,114,0,0,0,0,122,24,123,33,114,125,32,105,115,
-    32,110,111,116,32,97,108,112,104,97,110,117,109,101,114,105,
-    99,122,7,123,125,46,123,125,123,125,114,11,0,0,0,114,
-    44,0,0,0,41,28,218,9,95,119,97,114,110,105,110,103,
-    115,218,4,119,97,114,110,218,18,68,101,112,114,101,99,97,
-    116,105,111,110,87,97,114,110,105,110,103,218,9,84,121,112,
-    101,69,114,114,111,114,114,18,0,0,0,218,6,102,115,112,
-    97,116,104,114,74,0,0,0,218,10,114,112,97,114,116,105,
-    116,105,111,110,114,15,0,0,0,218,14,105,109,112,108,101,
-    109,101,110,116,97,116,105,111,110,218,9,99,97,99,104,101,
-    95,116,97,103,218,19,78,111,116,73,109,112,108,101,109,101,
-    110,116,101,100,69,114,114,111,114,114,62,0,0,0,114,16,
-    0,0,0,218,8,111,112,116,105,109,105,122,101,218,3,115,
-    116,114,218,7,105,115,97,108,110,117,109,218,10,86,97,108,
-    117,101,69,114,114,111,114,114,89,0,0,0,218,4,95,79,
-    80,84,218,17,66,89,84,69,67,79,68,69,95,83,85,70,
-    70,73,88,69,83,218,14,112,121,99,97,99,104,101,95,112,
-    114,101,102,105,120,114,86,0,0,0,114,67,0,0,0,114,
-    82,0,0,0,114,50,0,0,0,218,6,108,115,116,114,105,
-    112,218,8,95,80,89,67,65,67,72,69,41,12,114,65,0,
-    0,0,90,14,100,101,98,117,103,95,111,118,101,114,114,105,
-    100,101,114,96,0,0,0,218,7,109,101,115,115,97,103,101,
-    218,4,104,101,97,100,114,66,0,0,0,90,4,98,97,115,
-    101,114,6,0,0,0,218,4,114,101,115,116,90,3,116,97,
-    103,90,15,97,108,109,111,115,116,95,102,105,108,101,110,97,
-    109,101,218,8,102,105,108,101,110,97,109,101,114,7,0,0,
-    0,114,7,0,0,0,114,8,0,0,0,218,17,99,97,99,
-    104,101,95,102,114,111,109,95,115,111,117,114,99,101,122,1,
-    0,0,115,74,0,0,0,8,18,6,1,2,1,4,255,8,
-    2,4,1,8,1,12,1,10,1,12,1,16,1,8,1,8,
-    1,8,1,24,1,8,1,12,1,6,1,8,2,8,1,8,
-    1,8,1,14,1,14,1,12,1,10,1,8,9,14,1,24,
-    5,12,1,2,4,4,1,8,1,2,1,4,253,12,5,255,
-    128,114,121,0,0,0,99,1,0,0,0,0,0,0,0,0,
-    0,0,0,10,0,0,0,5,0,0,0,67,0,0,0,115,
-    40,1,0,0,116,0,106,1,106,2,100,1,117,0,114,10,
-    116,3,100,2,131,1,130,1,116,4,160,5,124,0,161,1,
-    125,0,116,6,124,0,131,1,92,2,125,1,125,2,100,3,
-    125,3,116,0,106,7,100,1,117,1,114,51,116,0,106,7,
-    160,8,116,9,161,1,125,4,124,1,160,10,124,4,116,11,
-    23,0,161,1,114,51,124,1,116,12,124,4,131,1,100,1,
-    133,2,25,0,125,1,100,4,125,3,124,3,115,72,116,6,
-    124,1,131,1,92,2,125,1,125,5,124,5,116,13,107,3,
-    114,72,116,14,116,13,155,0,100,5,124,0,155,2,157,3,
-    131,1,130,1,124,2,160,15,100,6,161,1,125,6,124,6,
-    100,7,118,1,114,88,116,14,100,8,124,2,155,2,157,2,
-    131,1,130,1,124,6,100,9,107,2,114,132,124,2,160,16,
-    100,6,100,10,161,2,100,11,25,0,125,7,124,7,160,10,
-    116,17,161,1,115,112,116,14,100,12,116,17,155,2,157,2,
-    131,1,130,1,124,7,116,12,116,17,131,1,100,1,133,2,
-    25,0,125,8,124,8,160,18,161,0,115,132,116,14,100,13,
-    124,7,155,2,100,14,157,3,131,1,130,1,124,2,160,19,
-    100,6,161,1,100,15,25,0,125,9,116,20,124,1,124,9,
-    116,21,100,15,25,0,23,0,131,2,83,0,41,16,97,110,
-    1,0,0,71,105,118,101,110,32,116,104,101,32,112,97,116,
-    104,32,116,111,32,97,32,46,112,121,99,46,32,102,105,108,
-    101,44,32,114,101,116,117,114,110,32,116,104,101,32,112,97,
-    116,104,32,116,111,32,105,116,115,32,46,112,121,32,102,105,
-    108,101,46,10,10,32,32,32,32,84,104,101,32,46,112,121,
-    99,32,102,105,108,101,32,100,111,101,115,32,110,111,116,32,
-    110,101,101,100,32,116,111,32,101,120,105,115,116,59,32,116,
-    104,105,115,32,115,105,109,112,108,121,32,114,101,116,117,114,
-    110,115,32,116,104,101,32,112,97,116,104,32,116,111,10,32,
-    32,32,32,116,104,101,32,46,112,121,32,102,105,108,101,32,
-    99,97,108,99,117,108,97,116,101,100,32,116,111,32,99,111,
-    114,114,101,115,112,111,110,100,32,116,111,32,116,104,101,32,
-    46,112,121,99,32,102,105,108,101,46,32,32,73,102,32,112,
-    97,116,104,32,100,111,101,115,10,32,32,32,32,110,111,116,
-    32,99,111,110,102,111,114,109,32,116,111,32,80,69,80,32,
-    51,49,52,55,47,52,56,56,32,102,111,114,109,97,116,44,
-    32,86,97,108,117,101,69,114,114,111,114,32,119,105,108,108,
-    32,98,101,32,114,97,105,115,101,100,46,32,73,102,10,32,
-    32,32,32,115,121,115,46,105,109,112,108,101,109,101,110,116,
-    97,116,105,111,110,46,99,97,99,104,101,95,116,97,103,32,
-    105,115,32,78,111,110,101,32,116,104,101,110,32,78,111,116,
+    115,46,112,97,116,104,46,115,112,108,105,116,40,41,46,3,
+    5,114,102,105,110,100,2,30,95,112,97,116,104,95,115,112,
+    108,105,116,46,60,108,111,99,97,108,115,62,46,60,103,101,
+    110,101,120,112,114,62,3,3,109,97,120,3,1,105,3,11,
+    95,112,97,116,104,95,115,112,108,105,116,2,126,83,116,97,
+    116,32,116,104,101,32,112,97,116,104,46,10,10,32,32,32,
+    32,77,97,100,101,32,97,32,115,101,112,97,114,97,116,101,
+    32,102,117,110,99,116,105,111,110,32,116,111,32,109,97,107,
+    101,32,105,116,32,101,97,115,105,101,114,32,116,111,32,111,
+    118,101,114,114,105,100,101,32,105,110,32,101,120,112,101,114,
+    105,109,101,110,116,115,10,32,32,32,32,40,101,46,103,46,
+    32,99,97,99,104,101,32,115,116,97,116,32,114,101,115,117,
+    108,116,115,41,46,10,10,32,32,32,32,3,4,115,116,97,
+    116,3,10,95,112,97,116,104,95,115,116,97,116,2,49,84,
+    101,115,116,32,119,104,101,116,104,101,114,32,116,104,101,32,
+    112,97,116,104,32,105,115,32,116,104,101,32,115,112,101,99,
+    105,102,105,101,100,32,109,111,100,101,32,116,121,112,101,46,
+    3,7,79,83,69,114,114,111,114,3,7,115,116,95,109,111,
+    100,101,3,4,109,111,100,101,3,9,115,116,97,116,95,105,
+    110,102,111,3,18,95,112,97,116,104,95,105,115,95,109,111,
+    100,101,95,116,121,112,101,2,31,82,101,112,108,97,99,101,
+    109,101,110,116,32,102,111,114,32,111,115,46,112,97,116,104,
+    46,105,115,102,105,108,101,46,3,12,95,112,97,116,104,95,
+    105,115,102,105,108,101,2,30,82,101,112,108,97,99,101,109,
+    101,110,116,32,102,111,114,32,111,115,46,112,97,116,104,46,
+    105,115,100,105,114,46,3,6,103,101,116,99,119,100,3,11,
+    95,112,97,116,104,95,105,115,100,105,114,2,30,82,101,112,
+    108,97,99,101,109,101,110,116,32,102,111,114,32,111,115,46,
+    112,97,116,104,46,105,115,97,98,115,46,2,2,92,92,3,
+    7,114,101,112,108,97,99,101,3,11,95,112,97,116,104,95,
+    105,115,97,98,115,2,162,1,66,101,115,116,45,101,102,102,
+    111,114,116,32,102,117,110,99,116,105,111,110,32,116,111,32,
+    119,114,105,116,101,32,100,97,116,97,32,116,111,32,97,32,
+    112,97,116,104,32,97,116,111,109,105,99,97,108,108,121,46,
+    10,32,32,32,32,66,101,32,112,114,101,112,97,114,101,100,
+    32,116,111,32,104,97,110,100,108,101,32,97,32,70,105,108,
+    101,69,120,105,115,116,115,69,114,114,111,114,32,105,102,32,
+    99,111,110,99,117,114,114,101,110,116,32,119,114,105,116,105,
+    110,103,32,111,102,32,116,104,101,10,32,32,32,32,116,101,
+    109,112,111,114,97,114,121,32,102,105,108,101,32,105,115,32,
+    97,116,116,101,109,112,116,101,100,46,2,5,123,125,46,123,
+    125,3,2,119,98,3,6,102,111,114,109,97,116,3,2,105,
+    100,3,4,111,112,101,110,3,6,79,95,69,88,67,76,3,
+    7,79,95,67,82,69,65,84,3,8,79,95,87,82,79,78,
+    76,89,3,3,95,105,111,3,6,70,105,108,101,73,79,3,
+    5,119,114,105,116,101,3,6,117,110,108,105,110,107,3,8,
+    112,97,116,104,95,116,109,112,3,2,102,100,3,4,102,105,
+    108,101,3,13,95,119,114,105,116,101,95,97,116,111,109,105,
+    99,3,11,95,95,112,121,99,97,99,104,101,95,95,2,4,
+    111,112,116,45,2,3,46,112,121,2,4,46,112,121,119,2,
+    4,46,112,121,99,3,12,111,112,116,105,109,105,122,97,116,
+    105,111,110,2,254,5,71,105,118,101,110,32,116,104,101,32,
+    112,97,116,104,32,116,111,32,97,32,46,112,121,32,102,105,
+    108,101,44,32,114,101,116,117,114,110,32,116,104,101,32,112,
+    97,116,104,32,116,111,32,105,116,115,32,46,112,121,99,32,
+    102,105,108,101,46,10,10,32,32,32,32,84,104,101,32,46,
+    112,121,32,102,105,108,101,32,100,111,101,115,32,110,111,116,
+    32,110,101,101,100,32,116,111,32,101,120,105,115,116,59,32,
+    116,104,105,115,32,115,105,109,112,108,121,32,114,101,116,117,
+    114,110,115,32,116,104,101,32,112,97,116,104,32,116,111,32,
+    116,104,101,10,32,32,32,32,46,112,121,99,32,102,105,108,
+    101,32,99,97,108,99,117,108,97,116,101,100,32,97,115,32,
+    105,102,32,116,104,101,32,46,112,121,32,102,105,108,101,32,
+    119,101,114,101,32,105,109,112,111,114,116,101,100,46,10,10,
+    32,32,32,32,84,104,101,32,39,111,112,116,105,109,105,122,
+    97,116,105,111,110,39,32,112,97,114,97,109,101,116,101,114,
+    32,99,111,110,116,114,111,108,115,32,116,104,101,32,112,114,
+    101,115,117,109,101,100,32,111,112,116,105,109,105,122,97,116,
+    105,111,110,32,108,101,118,101,108,32,111,102,10,32,32,32,
+    32,116,104,101,32,98,121,116,101,99,111,100,101,32,102,105,
+    108,101,46,32,73,102,32,39,111,112,116,105,109,105,122,97,
+    116,105,111,110,39,32,105,115,32,110,111,116,32,78,111,110,
+    101,44,32,116,104,101,32,115,116,114,105,110,103,32,114,101,
+    112,114,101,115,101,110,116,97,116,105,111,110,10,32,32,32,
+    32,111,102,32,116,104,101,32,97,114,103,117,109,101,110,116,
+    32,105,115,32,116,97,107,101,110,32,97,110,100,32,118,101,
+    114,105,102,105,101,100,32,116,111,32,98,101,32,97,108,112,
+    104,97,110,117,109,101,114,105,99,32,40,101,108,115,101,32,
+    86,97,108,117,101,69,114,114,111,114,10,32,32,32,32,105,
+    115,32,114,97,105,115,101,100,41,46,10,10,32,32,32,32,
+    84,104,101,32,100,101,98,117,103,95,111,118,101,114,114,105,
+    100,101,32,112,97,114,97,109,101,116,101,114,32,105,115,32,
+    100,101,112,114,101,99,97,116,101,100,46,32,73,102,32,100,
+    101,98,117,103,95,111,118,101,114,114,105,100,101,32,105,115,
+    32,110,111,116,32,78,111,110,101,44,10,32,32,32,32,97,
+    32,84,114,117,101,32,118,97,108,117,101,32,105,115,32,116,
+    104,101,32,115,97,109,101,32,97,115,32,115,101,116,116,105,
+    110,103,32,39,111,112,116,105,109,105,122,97,116,105,111,110,
+    39,32,116,111,32,116,104,101,32,101,109,112,116,121,32,115,
+    116,114,105,110,103,10,32,32,32,32,119,104,105,108,101,32,
+    97,32,70,97,108,115,101,32,118,97,108,117,101,32,105,115,
+    32,101,113,117,105,118,97,108,101,110,116,32,116,111,32,115,
+    101,116,116,105,110,103,32,39,111,112,116,105,109,105,122,97,
+    116,105,111,110,39,32,116,111,32,39,49,39,46,10,10,32,
+    32,32,32,73,102,32,115,121,115,46,105,109,112,108,101,109,
+    101,110,116,97,116,105,111,110,46,99,97,99,104,101,95,116,
+    97,103,32,105,115,32,78,111,110,101,32,116,104,101,110,32,
+    78,111,116,73,109,112,108,101,109,101,110,116,101,100,69,114,
+    114,111,114,32,105,115,32,114,97,105,115,101,100,46,10,10,
+    32,32,32,32,2,70,116,104,101,32,100,101,98,117,103,95,
+    111,118,101,114,114,105,100,101,32,112,97,114,97,109,101,116,
+    101,114,32,105,115,32,100,101,112,114,101,99,97,116,101,100,
+    59,32,117,115,101,32,39,111,112,116,105,109,105,122,97,116,
+    105,111,110,39,32,105,110,115,116,101,97,100,2,50,100,101,
+    98,117,103,95,111,118,101,114,114,105,100,101,32,111,114,32,
+    111,112,116,105,109,105,122,97,116,105,111,110,32,109,117,115,
+    116,32,98,101,32,115,101,116,32,116,111,32,78,111,110,101,
+    3,1,46,2,36,115,121,115,46,105,109,112,108,101,109,101,
+    110,116,97,116,105,111,110,46,99,97,99,104,101,95,116,97,
+    103,32,105,115,32,78,111,110,101,2,24,123,33,114,125,32,
+    105,115,32,110,111,116,32,97,108,112,104,97,110,117,109,101,
+    114,105,99,2,7,123,125,46,123,125,123,125,3,9,95,119,
+    97,114,110,105,110,103,115,3,4,119,97,114,110,3,18,68,
+    101,112,114,101,99,97,116,105,111,110,87,97,114,110,105,110,
+    103,3,9,84,121,112,101,69,114,114,111,114,3,6,102,115,
+    112,97,116,104,3,10,114,112,97,114,116,105,116,105,111,110,
+    3,14,105,109,112,108,101,109,101,110,116,97,116,105,111,110,
+    3,9,99,97,99,104,101,95,116,97,103,3,19,78,111,116,
     73,109,112,108,101,109,101,110,116,101,100,69,114,114,111,114,
-    32,105,115,32,114,97,105,115,101,100,46,10,10,32,32,32,
-    32,78,114,98,0,0,0,70,84,122,31,32,110,111,116,32,
-    98,111,116,116,111,109,45,108,101,118,101,108,32,100,105,114,
-    101,99,116,111,114,121,32,105,110,32,114,97,0,0,0,62,
-    2,0,0,0,114,44,0,0,0,233,3,0,0,0,122,29,
-    101,120,112,101,99,116,101,100,32,111,110,108,121,32,50,32,
-    111,114,32,51,32,100,111,116,115,32,105,110,32,114,122,0,
-    0,0,114,44,0,0,0,233,254,255,255,255,122,53,111,112,
-    116,105,109,105,122,97,116,105,111,110,32,112,111,114,116,105,
-    111,110,32,111,102,32,102,105,108,101,110,97,109,101,32,100,
-    111,101,115,32,110,111,116,32,115,116,97,114,116,32,119,105,
-    116,104,32,122,19,111,112,116,105,109,105,122,97,116,105,111,
-    110,32,108,101,118,101,108,32,122,29,32,105,115,32,110,111,
-    116,32,97,110,32,97,108,112,104,97,110,117,109,101,114,105,
-    99,32,118,97,108,117,101,114,0,0,0,0,41,22,114,15,
-    0,0,0,114,105,0,0,0,114,106,0,0,0,114,107,0,
-    0,0,114,18,0,0,0,114,103,0,0,0,114,74,0,0,
-    0,114,114,0,0,0,114,49,0,0,0,114,50,0,0,0,
-    114,26,0,0,0,114,59,0,0,0,114,4,0,0,0,114,
-    116,0,0,0,114,111,0,0,0,218,5,99,111,117,110,116,
-    218,6,114,115,112,108,105,116,114,112,0,0,0,114,110,0,
-    0,0,218,9,112,97,114,116,105,116,105,111,110,114,67,0,
-    0,0,218,15,83,79,85,82,67,69,95,83,85,70,70,73,
-    88,69,83,41,10,114,65,0,0,0,114,118,0,0,0,90,
-    16,112,121,99,97,99,104,101,95,102,105,108,101,110,97,109,
-    101,90,23,102,111,117,110,100,95,105,110,95,112,121,99,97,
-    99,104,101,95,112,114,101,102,105,120,90,13,115,116,114,105,
-    112,112,101,100,95,112,97,116,104,90,7,112,121,99,97,99,
-    104,101,90,9,100,111,116,95,99,111,117,110,116,114,96,0,
-    0,0,90,9,111,112,116,95,108,101,118,101,108,90,13,98,
-    97,115,101,95,102,105,108,101,110,97,109,101,114,7,0,0,
-    0,114,7,0,0,0,114,8,0,0,0,218,17,115,111,117,
-    114,99,101,95,102,114,111,109,95,99,97,99,104,101,193,1,
-    0,0,115,62,0,0,0,12,9,8,1,10,1,12,1,4,
-    1,10,1,12,1,14,1,16,1,4,1,4,1,12,1,8,
-    1,8,1,2,1,8,255,10,2,8,1,14,1,8,1,16,
-    1,10,1,4,1,2,1,8,255,16,2,8,1,16,1,14,
-    2,18,1,255,128,114,128,0,0,0,99,1,0,0,0,0,
-    0,0,0,0,0,0,0,5,0,0,0,9,0,0,0,67,
-    0,0,0,115,122,0,0,0,116,0,124,0,131,1,100,1,
-    107,2,114,8,100,2,83,0,124,0,160,1,100,3,161,1,
-    92,3,125,1,125,2,125,3,124,1,114,28,124,3,160,2,
-    161,0,100,4,100,5,133,2,25,0,100,6,107,3,114,30,
-    124,0,83,0,122,6,116,3,124,0,131,1,125,4,87,0,
-    110,15,4,0,116,4,116,5,102,2,121,60,1,0,1,0,
-    1,0,124,0,100,2,100,5,133,2,25,0,125,4,89,0,
-    116,6,124,4,131,1,114,58,124,4,83,0,124,0,83,0,
-    119,0,41,7,122,188,67,111,110,118,101,114,116,32,97,32,
-    98,121,116,101,99,111,100,101,32,102,105,108,101,32,112,97,
-    116,104,32,116,111,32,97,32,115,111,117,114,99,101,32,112,
-    97,116,104,32,40,105,102,32,112,111,115,115,105,98,108,101,
-    41,46,10,10,32,32,32,32,84,104,105,115,32,102,117,110,
-    99,116,105,111,110,32,101,120,105,115,116,115,32,112,117,114,
-    101,108,121,32,102,111,114,32,98,97,99,107,119,97,114,100,
-    115,45,99,111,109,112,97,116,105,98,105,108,105,116,121,32,
-    102,111,114,10,32,32,32,32,80,121,73,109,112,111,114,116,
-    95,69,120,101,99,67,111,100,101,77,111,100,117,108,101,87,
-    105,116,104,70,105,108,101,110,97,109,101,115,40,41,32,105,
-    110,32,116,104,101,32,67,32,65,80,73,46,10,10,32,32,
-    32,32,114,0,0,0,0,78,114,97,0,0,0,233,253,255,
-    255,255,233,255,255,255,255,90,2,112,121,41,7,114,4,0,
-    0,0,114,104,0,0,0,218,5,108,111,119,101,114,114,128,
-    0,0,0,114,107,0,0,0,114,111,0,0,0,114,80,0,
-    0,0,41,5,218,13,98,121,116,101,99,111,100,101,95,112,
-    97,116,104,114,119,0,0,0,218,1,95,90,9,101,120,116,
-    101,110,115,105,111,110,218,11,115,111,117,114,99,101,95,112,
-    97,116,104,114,7,0,0,0,114,7,0,0,0,114,8,0,
-    0,0,218,15,95,103,101,116,95,115,111,117,114,99,101,102,
-    105,108,101,233,1,0,0,115,24,0,0,0,12,7,4,1,
-    16,1,24,1,4,1,2,1,12,1,16,1,14,1,16,1,
-    2,254,255,128,114,135,0,0,0,99,1,0,0,0,0,0,
-    0,0,0,0,0,0,1,0,0,0,8,0,0,0,67,0,
-    0,0,115,68,0,0,0,124,0,160,0,116,1,116,2,131,
-    1,161,1,114,22,122,5,116,3,124,0,131,1,87,0,83,
-    0,4,0,116,4,121,33,1,0,1,0,1,0,89,0,100,
-    0,83,0,124,0,160,0,116,1,116,5,131,1,161,1,114,
-    31,124,0,83,0,100,0,83,0,119,0,114,69,0,0,0,
-    41,6,114,58,0,0,0,218,5,116,117,112,108,101,114,127,
-    0,0,0,114,121,0,0,0,114,107,0,0,0,114,113,0,
-    0,0,41,1,114,120,0,0,0,114,7,0,0,0,114,7,
-    0,0,0,114,8,0,0,0,218,11,95,103,101,116,95,99,
-    97,99,104,101,100,252,1,0,0,115,20,0,0,0,14,1,
-    2,1,10,1,12,1,6,1,14,1,4,1,4,2,2,251,
-    255,128,114,137,0,0,0,99,1,0,0,0,0,0,0,0,
-    0,0,0,0,2,0,0,0,8,0,0,0,67,0,0,0,
-    115,48,0,0,0,122,7,116,0,124,0,131,1,106,1,125,
-    1,87,0,110,9,4,0,116,2,121,23,1,0,1,0,1,
-    0,100,1,125,1,89,0,124,1,100,2,79,0,125,1,124,
-    1,83,0,119,0,41,4,122,51,67,97,108,99,117,108,97,
-    116,101,32,116,104,101,32,109,111,100,101,32,112,101,114,109,
-    105,115,115,105,111,110,115,32,102,111,114,32,97,32,98,121,
-    116,101,99,111,100,101,32,102,105,108,101,46,114,87,0,0,
-    0,233,128,0,0,0,78,41,3,114,75,0,0,0,114,77,
-    0,0,0,114,76,0,0,0,41,2,114,65,0,0,0,114,
-    78,0,0,0,114,7,0,0,0,114,7,0,0,0,114,8,
-    0,0,0,218,10,95,99,97,108,99,95,109,111,100,101,8,
-    2,0,0,115,16,0,0,0,2,2,14,1,12,1,6,1,
-    8,3,4,1,2,251,255,128,114,139,0,0,0,99,1,0,
-    0,0,0,0,0,0,0,0,0,0,3,0,0,0,4,0,
-    0,0,3,0,0,0,115,52,0,0,0,100,6,135,0,102,
-    1,100,2,100,3,132,9,125,1,116,0,100,1,117,1,114,
-    15,116,0,106,1,125,2,110,4,100,4,100,5,132,0,125,
-    2,124,2,124,1,136,0,131,2,1,0,124,1,83,0,41,
-    7,122,252,68,101,99,111,114,97,116,111,114,32,116,111,32,
-    118,101,114,105,102,121,32,116,104,97,116,32,116,104,101,32,
-    109,111,100,117,108,101,32,98,101,105,110,103,32,114,101,113,
-    117,101,115,116,101,100,32,109,97,116,99,104,101,115,32,116,
-    104,101,32,111,110,101,32,116,104,101,10,32,32,32,32,108,
-    111,97,100,101,114,32,99,97,110,32,104,97,110,100,108,101,
-    46,10,10,32,32,32,32,84,104,101,32,102,105,114,115,116,
-    32,97,114,103,117,109,101,110,116,32,40,115,101,108,102,41,
-    32,109,117,115,116,32,100,101,102,105,110,101,32,95,110,97,
-    109,101,32,119,104,105,99,104,32,116,104,101,32,115,101,99,
-    111,110,100,32,97,114,103,117,109,101,110,116,32,105,115,10,
-    32,32,32,32,99,111,109,112,97,114,101,100,32,97,103,97,
-    105,110,115,116,46,32,73,102,32,116,104,101,32,99,111,109,
-    112,97,114,105,115,111,110,32,102,97,105,108,115,32,116,104,
-    101,110,32,73,109,112,111,114,116,69,114,114,111,114,32,105,
-    115,32,114,97,105,115,101,100,46,10,10,32,32,32,32,78,
-    99,2,0,0,0,0,0,0,0,0,0,0,0,4,0,0,
-    0,4,0,0,0,31,0,0,0,115,72,0,0,0,124,1,
-    100,0,117,0,114,8,124,0,106,0,125,1,110,16,124,0,
-    106,0,124,1,107,3,114,24,116,1,100,1,124,0,106,0,
-    124,1,102,2,22,0,124,1,100,2,141,2,130,1,136,0,
-    124,0,124,1,103,2,124,2,162,1,82,0,105,0,124,3,
-    164,1,142,1,83,0,41,3,78,122,30,108,111,97,100,101,
-    114,32,102,111,114,32,37,115,32,99,97,110,110,111,116,32,
-    104,97,110,100,108,101,32,37,115,169,1,218,4,110,97,109,
-    101,41,2,114,141,0,0,0,218,11,73,109,112,111,114,116,
-    69,114,114,111,114,41,4,218,4,115,101,108,102,114,141,0,
-    0,0,218,4,97,114,103,115,218,6,107,119,97,114,103,115,
-    169,1,218,6,109,101,116,104,111,100,114,7,0,0,0,114,
-    8,0,0,0,218,19,95,99,104,101,99,107,95,110,97,109,
-    101,95,119,114,97,112,112,101,114,28,2,0,0,115,20,0,
-    0,0,8,1,8,1,10,1,4,1,8,1,2,255,2,1,
-    6,255,24,2,255,128,122,40,95,99,104,101,99,107,95,110,
-    97,109,101,46,60,108,111,99,97,108,115,62,46,95,99,104,
-    101,99,107,95,110,97,109,101,95,119,114,97,112,112,101,114,
-    99,2,0,0,0,0,0,0,0,0,0,0,0,3,0,0,
-    0,7,0,0,0,83,0,0,0,115,56,0,0,0,100,1,
-    68,0,93,16,125,2,116,0,124,1,124,2,131,2,114,18,
-    116,1,124,0,124,2,116,2,124,1,124,2,131,2,131,3,
-    1,0,113,2,124,0,106,3,160,4,124,1,106,3,161,1,
-    1,0,100,0,83,0,41,2,78,41,4,218,10,95,95,109,
-    111,100,117,108,101,95,95,218,8,95,95,110,97,109,101,95,
-    95,218,12,95,95,113,117,97,108,110,97,109,101,95,95,218,
-    7,95,95,100,111,99,95,95,41,5,218,7,104,97,115,97,
-    116,116,114,218,7,115,101,116,97,116,116,114,218,7,103,101,
-    116,97,116,116,114,218,8,95,95,100,105,99,116,95,95,218,
-    6,117,112,100,97,116,101,41,3,90,3,110,101,119,90,3,
-    111,108,100,114,85,0,0,0,114,7,0,0,0,114,7,0,
-    0,0,114,8,0,0,0,218,5,95,119,114,97,112,41,2,
-    0,0,115,12,0,0,0,8,1,10,1,18,1,2,128,18,
-    1,255,128,122,26,95,99,104,101,99,107,95,110,97,109,101,
-    46,60,108,111,99,97,108,115,62,46,95,119,114,97,112,114,
-    69,0,0,0,41,2,218,10,95,98,111,111,116,115,116,114,
-    97,112,114,158,0,0,0,41,3,114,147,0,0,0,114,148,
-    0,0,0,114,158,0,0,0,114,7,0,0,0,114,146,0,
-    0,0,114,8,0,0,0,218,11,95,99,104,101,99,107,95,
-    110,97,109,101,20,2,0,0,115,14,0,0,0,14,8,8,
-    10,8,1,8,2,10,6,4,1,255,128,114,160,0,0,0,
-    99,2,0,0,0,0,0,0,0,0,0,0,0,5,0,0,
-    0,6,0,0,0,67,0,0,0,115,72,0,0,0,116,0,
-    160,1,100,1,116,2,161,2,1,0,124,0,160,3,124,1,
-    161,1,92,2,125,2,125,3,124,2,100,2,117,0,114,34,
-    116,4,124,3,131,1,114,34,100,3,125,4,116,0,160,1,
-    124,4,160,5,124,3,100,4,25,0,161,1,116,6,161,2,
-    1,0,124,2,83,0,41,5,122,155,84,114,121,32,116,111,
-    32,102,105,110,100,32,97,32,108,111,97,100,101,114,32,102,
-    111,114,32,116,104,101,32,115,112,101,99,105,102,105,101,100,
-    32,109,111,100,117,108,101,32,98,121,32,100,101,108,101,103,
-    97,116,105,110,103,32,116,111,10,32,32,32,32,115,101,108,
-    102,46,102,105,110,100,95,108,111,97,100,101,114,40,41,46,
-    10,10,32,32,32,32,84,104,105,115,32,109,101,116,104,111,
-    100,32,105,115,32,100,101,112,114,101,99,97,116,101,100,32,
-    105,110,32,102,97,118,111,114,32,111,102,32,102,105,110,100,
-    101,114,46,102,105,110,100,95,115,112,101,99,40,41,46,10,
-    10,32,32,32,32,122,90,102,105,110,100,95,109,111,100,117,
-    108,101,40,41,32,105,115,32,100,101,112,114,101,99,97,116,
-    101,100,32,97,110,100,32,115,108,97,116,101,100,32,102,111,
-    114,32,114,101,109,111,118,97,108,32,105,110,32,80,121,116,
-    104,111,110,32,51,46,49,50,59,32,117,115,101,32,102,105,
-    110,100,95,115,112,101,99,40,41,32,105,110,115,116,101,97,
-    100,78,122,44,78,111,116,32,105,109,112,111,114,116,105,110,
-    103,32,100,105,114,101,99,116,111,114,121,32,123,125,58,32,
-    109,105,115,115,105,110,103,32,95,95,105,110,105,116,95,95,
-    114,0,0,0,0,41,7,114,99,0,0,0,114,100,0,0,
-    0,114,101,0,0,0,218,11,102,105,110,100,95,108,111,97,
-    100,101,114,114,4,0,0,0,114,89,0,0,0,218,13,73,
-    109,112,111,114,116,87,97,114,110,105,110,103,41,5,114,143,
-    0,0,0,218,8,102,117,108,108,110,97,109,101,218,6,108,
-    111,97,100,101,114,218,8,112,111,114,116,105,111,110,115,218,
-    3,109,115,103,114,7,0,0,0,114,7,0,0,0,114,8,
-    0,0,0,218,17,95,102,105,110,100,95,109,111,100,117,108,
-    101,95,115,104,105,109,51,2,0,0,115,18,0,0,0,6,
-    7,2,2,4,254,14,6,16,1,4,1,22,1,4,1,255,
-    128,114,167,0,0,0,99,3,0,0,0,0,0,0,0,0,
-    0,0,0,6,0,0,0,4,0,0,0,67,0,0,0,115,
-    166,0,0,0,124,0,100,1,100,2,133,2,25,0,125,3,
-    124,3,116,0,107,3,114,32,100,3,124,1,155,2,100,4,
-    124,3,155,2,157,4,125,4,116,1,160,2,100,5,124,4,
-    161,2,1,0,116,3,124,4,102,1,105,0,124,2,164,1,
-    142,1,130,1,116,4,124,0,131,1,100,6,107,0,114,53,
-    100,7,124,1,155,2,157,2,125,4,116,1,160,2,100,5,
-    124,4,161,2,1,0,116,5,124,4,131,1,130,1,116,6,
-    124,0,100,2,100,8,133,2,25,0,131,1,125,5,124,5,
-    100,9,64,0,114,81,100,10,124,5,155,2,100,11,124,1,
-    155,2,157,4,125,4,116,3,124,4,102,1,105,0,124,2,
-    164,1,142,1,130,1,124,5,83,0,41,12,97,84,2,0,
-    0,80,101,114,102,111,114,109,32,98,97,115,105,99,32,118,
+    3,8,111,112,116,105,109,105,122,101,3,3,115,116,114,3,
+    7,105,115,97,108,110,117,109,3,10,86,97,108,117,101,69,
+    114,114,111,114,3,4,95,79,80,84,3,17,66,89,84,69,
+    67,79,68,69,95,83,85,70,70,73,88,69,83,3,14,112,
+    121,99,97,99,104,101,95,112,114,101,102,105,120,3,6,108,
+    115,116,114,105,112,3,8,95,80,89,67,65,67,72,69,3,
+    14,100,101,98,117,103,95,111,118,101,114,114,105,100,101,3,
+    7,109,101,115,115,97,103,101,3,4,104,101,97,100,3,4,
+    98,97,115,101,3,4,114,101,115,116,3,3,116,97,103,3,
+    15,97,108,109,111,115,116,95,102,105,108,101,110,97,109,101,
+    3,8,102,105,108,101,110,97,109,101,3,17,99,97,99,104,
+    101,95,102,114,111,109,95,115,111,117,114,99,101,2,238,2,
+    71,105,118,101,110,32,116,104,101,32,112,97,116,104,32,116,
+    111,32,97,32,46,112,121,99,46,32,102,105,108,101,44,32,
+    114,101,116,117,114,110,32,116,104,101,32,112,97,116,104,32,
+    116,111,32,105,116,115,32,46,112,121,32,102,105,108,101,46,
+    10,10,32,32,32,32,84,104,101,32,46,112,121,99,32,102,
+    105,108,101,32,100,111,101,115,32,110,111,116,32,110,101,101,
+    100,32,116,111,32,101,120,105,115,116,59,32,116,104,105,115,
+    32,115,105,109,112,108,121,32,114,101,116,117,114,110,115,32,
+    116,104,101,32,112,97,116,104,32,116,111,10,32,32,32,32,
+    116,104,101,32,46,112,121,32,102,105,108,101,32,99,97,108,
+    99,117,108,97,116,101,100,32,116,111,32,99,111,114,114,101,
+    115,112,111,110,100,32,116,111,32,116,104,101,32,46,112,121,
+    99,32,102,105,108,101,46,32,32,73,102,32,112,97,116,104,
+    32,100,111,101,115,10,32,32,32,32,110,111,116,32,99,111,
+    110,102,111,114,109,32,116,111,32,80,69,80,32,51,49,52,
+    55,47,52,56,56,32,102,111,114,109,97,116,44,32,86,97,
+    108,117,101,69,114,114,111,114,32,119,105,108,108,32,98,101,
+    32,114,97,105,115,101,100,46,32,73,102,10,32,32,32,32,
+    115,121,115,46,105,109,112,108,101,109,101,110,116,97,116,105,
+    111,110,46,99,97,99,104,101,95,116,97,103,32,105,115,32,
+    78,111,110,101,32,116,104,101,110,32,78,111,116,73,109,112,
+    108,101,109,101,110,116,101,100,69,114,114,111,114,32,105,115,
+    32,114,97,105,115,101,100,46,10,10,32,32,32,32,2,31,
+    32,110,111,116,32,98,111,116,116,111,109,45,108,101,118,101,
+    108,32,100,105,114,101,99,116,111,114,121,32,105,110,32,2,
+    29,101,120,112,101,99,116,101,100,32,111,110,108,121,32,50,
+    32,111,114,32,51,32,100,111,116,115,32,105,110,32,2,53,
+    111,112,116,105,109,105,122,97,116,105,111,110,32,112,111,114,
+    116,105,111,110,32,111,102,32,102,105,108,101,110,97,109,101,
+    32,100,111,101,115,32,110,111,116,32,115,116,97,114,116,32,
+    119,105,116,104,32,2,19,111,112,116,105,109,105,122,97,116,
+    105,111,110,32,108,101,118,101,108,32,2,29,32,105,115,32,
+    110,111,116,32,97,110,32,97,108,112,104,97,110,117,109,101,
+    114,105,99,32,118,97,108,117,101,3,5,99,111,117,110,116,
+    3,6,114,115,112,108,105,116,3,9,112,97,114,116,105,116,
+    105,111,110,3,15,83,79,85,82,67,69,95,83,85,70,70,
+    73,88,69,83,3,16,112,121,99,97,99,104,101,95,102,105,
+    108,101,110,97,109,101,3,23,102,111,117,110,100,95,105,110,
+    95,112,121,99,97,99,104,101,95,112,114,101,102,105,120,3,
+    13,115,116,114,105,112,112,101,100,95,112,97,116,104,3,7,
+    112,121,99,97,99,104,101,3,9,100,111,116,95,99,111,117,
+    110,116,3,9,111,112,116,95,108,101,118,101,108,3,13,98,
+    97,115,101,95,102,105,108,101,110,97,109,101,3,17,115,111,
+    117,114,99,101,95,102,114,111,109,95,99,97,99,104,101,2,
+    188,1,67,111,110,118,101,114,116,32,97,32,98,121,116,101,
+    99,111,100,101,32,102,105,108,101,32,112,97,116,104,32,116,
+    111,32,97,32,115,111,117,114,99,101,32,112,97,116,104,32,
+    40,105,102,32,112,111,115,115,105,98,108,101,41,46,10,10,
+    32,32,32,32,84,104,105,115,32,102,117,110,99,116,105,111,
+    110,32,101,120,105,115,116,115,32,112,117,114,101,108,121,32,
+    102,111,114,32,98,97,99,107,119,97,114,100,115,45,99,111,
+    109,112,97,116,105,98,105,108,105,116,121,32,102,111,114,10,
+    32,32,32,32,80,121,73,109,112,111,114,116,95,69,120,101,
+    99,67,111,100,101,77,111,100,117,108,101,87,105,116,104,70,
+    105,108,101,110,97,109,101,115,40,41,32,105,110,32,116,104,
+    101,32,67,32,65,80,73,46,10,10,32,32,32,32,3,2,
+    112,121,3,5,108,111,119,101,114,3,13,98,121,116,101,99,
+    111,100,101,95,112,97,116,104,3,1,95,3,9,101,120,116,
+    101,110,115,105,111,110,3,11,115,111,117,114,99,101,95,112,
+    97,116,104,3,15,95,103,101,116,95,115,111,117,114,99,101,
+    102,105,108,101,3,5,116,117,112,108,101,3,11,95,103,101,
+    116,95,99,97,99,104,101,100,2,51,67,97,108,99,117,108,
+    97,116,101,32,116,104,101,32,109,111,100,101,32,112,101,114,
+    109,105,115,115,105,111,110,115,32,102,111,114,32,97,32,98,
+    121,116,101,99,111,100,101,32,102,105,108,101,46,3,10,95,
+    99,97,108,99,95,109,111,100,101,2,252,1,68,101,99,111,
+    114,97,116,111,114,32,116,111,32,118,101,114,105,102,121,32,
+    116,104,97,116,32,116,104,101,32,109,111,100,117,108,101,32,
+    98,101,105,110,103,32,114,101,113,117,101,115,116,101,100,32,
+    109,97,116,99,104,101,115,32,116,104,101,32,111,110,101,32,
+    116,104,101,10,32,32,32,32,108,111,97,100,101,114,32,99,
+    97,110,32,104,97,110,100,108,101,46,10,10,32,32,32,32,
+    84,104,101,32,102,105,114,115,116,32,97,114,103,117,109,101,
+    110,116,32,40,115,101,108,102,41,32,109,117,115,116,32,100,
+    101,102,105,110,101,32,95,110,97,109,101,32,119,104,105,99,
+    104,32,116,104,101,32,115,101,99,111,110,100,32,97,114,103,
+    117,109,101,110,116,32,105,115,10,32,32,32,32,99,111,109,
+    112,97,114,101,100,32,97,103,97,105,110,115,116,46,32,73,
+    102,32,116,104,101,32,99,111,109,112,97,114,105,115,111,110,
+    32,102,97,105,108,115,32,116,104,101,110,32,73,109,112,111,
+    114,116,69,114,114,111,114,32,105,115,32,114,97,105,115,101,
+    100,46,10,10,32,32,32,32,2,30,108,111,97,100,101,114,
+    32,102,111,114,32,37,115,32,99,97,110,110,111,116,32,104,
+    97,110,100,108,101,32,37,115,3,4,110,97,109,101,3,11,
+    73,109,112,111,114,116,69,114,114,111,114,3,4,115,101,108,
+    102,3,4,97,114,103,115,3,6,107,119,97,114,103,115,3,
+    6,109,101,116,104,111,100,3,19,95,99,104,101,99,107,95,
+    110,97,109,101,95,119,114,97,112,112,101,114,2,40,95,99,
+    104,101,99,107,95,110,97,109,101,46,60,108,111,99,97,108,
+    115,62,46,95,99,104,101,99,107,95,110,97,109,101,95,119,
+    114,97,112,112,101,114,3,10,95,95,109,111,100,117,108,101,
+    95,95,3,8,95,95,110,97,109,101,95,95,3,12,95,95,
+    113,117,97,108,110,97,109,101,95,95,3,7,95,95,100,111,
+    99,95,95,3,7,104,97,115,97,116,116,114,3,7,115,101,
+    116,97,116,116,114,3,7,103,101,116,97,116,116,114,3,8,
+    95,95,100,105,99,116,95,95,3,6,117,112,100,97,116,101,
+    3,3,110,101,119,3,3,111,108,100,3,5,95,119,114,97,
+    112,2,26,95,99,104,101,99,107,95,110,97,109,101,46,60,
+    108,111,99,97,108,115,62,46,95,119,114,97,112,3,10,95,
+    98,111,111,116,115,116,114,97,112,3,11,95,99,104,101,99,
+    107,95,110,97,109,101,2,155,1,84,114,121,32,116,111,32,
+    102,105,110,100,32,97,32,108,111,97,100,101,114,32,102,111,
+    114,32,116,104,101,32,115,112,101,99,105,102,105,101,100,32,
+    109,111,100,117,108,101,32,98,121,32,100,101,108,101,103,97,
+    116,105,110,103,32,116,111,10,32,32,32,32,115,101,108,102,
+    46,102,105,110,100,95,108,111,97,100,101,114,40,41,46,10,
+    10,32,32,32,32,84,104,105,115,32,109,101,116,104,111,100,
+    32,105,115,32,100,101,112,114,101,99,97,116,101,100,32,105,
+    110,32,102,97,118,111,114,32,111,102,32,102,105,110,100,101,
+    114,46,102,105,110,100,95,115,112,101,99,40,41,46,10,10,
+    32,32,32,32,2,90,102,105,110,100,95,109,111,100,117,108,
+    101,40,41,32,105,115,32,100,101,112,114,101,99,97,116,101,
+    100,32,97,110,100,32,115,108,97,116,101,100,32,102,111,114,
+    32,114,101,109,111,118,97,108,32,105,110,32,80,121,116,104,
+    111,110,32,51,46,49,50,59,32,117,115,101,32,102,105,110,
+    100,95,115,112,101,99,40,41,32,105,110,115,116,101,97,100,
+    2,44,78,111,116,32,105,109,112,111,114,116,105,110,103,32,
+    100,105,114,101,99,116,111,114,121,32,123,125,58,32,109,105,
+    115,115,105,110,103,32,95,95,105,110,105,116,95,95,3,11,
+    102,105,110,100,95,108,111,97,100,101,114,3,13,73,109,112,
+    111,114,116,87,97,114,110,105,110,103,3,8,102,117,108,108,
+    110,97,109,101,3,6,108,111,97,100,101,114,3,8,112,111,
+    114,116,105,111,110,115,3,3,109,115,103,3,17,95,102,105,
+    110,100,95,109,111,100,117,108,101,95,115,104,105,109,2,212,
+    4,80,101,114,102,111,114,109,32,98,97,115,105,99,32,118,
     97,108,105,100,105,116,121,32,99,104,101,99,107,105,110,103,
     32,111,102,32,97,32,112,121,99,32,104,101,97,100,101,114,
     32,97,110,100,32,114,101,116,117,114,110,32,116,104,101,32,
@@ -768,1461 +376,1850 @@ const unsigned char _Py_M__importlib_bootstrap_external[] = {
     32,114,97,105,115,101,100,32,119,104,101,110,32,116,104,101,
     32,100,97,116,97,32,105,115,32,102,111,117,110,100,32,116,
     111,32,98,101,32,116,114,117,110,99,97,116,101,100,46,10,
-    10,32,32,32,32,78,114,31,0,0,0,122,20,98,97,100,
-    32,109,97,103,105,99,32,110,117,109,98,101,114,32,105,110,
-    32,122,2,58,32,250,2,123,125,233,16,0,0,0,122,40,
-    114,101,97,99,104,101,100,32,69,79,70,32,119,104,105,108,
-    101,32,114,101,97,100,105,110,103,32,112,121,99,32,104,101,
-    97,100,101,114,32,111,102,32,233,8,0,0,0,233,252,255,
-    255,255,122,14,105,110,118,97,108,105,100,32,102,108,97,103,
-    115,32,122,4,32,105,110,32,41,7,218,12,77,65,71,73,
-    67,95,78,85,77,66,69,82,114,159,0,0,0,218,16,95,
-    118,101,114,98,111,115,101,95,109,101,115,115,97,103,101,114,
-    142,0,0,0,114,4,0,0,0,218,8,69,79,70,69,114,
-    114,111,114,114,42,0,0,0,41,6,114,41,0,0,0,114,
-    141,0,0,0,218,11,101,120,99,95,100,101,116,97,105,108,
-    115,90,5,109,97,103,105,99,114,117,0,0,0,114,16,0,
-    0,0,114,7,0,0,0,114,7,0,0,0,114,8,0,0,
-    0,218,13,95,99,108,97,115,115,105,102,121,95,112,121,99,
-    71,2,0,0,115,30,0,0,0,12,16,8,1,16,1,12,
-    1,16,1,12,1,10,1,12,1,8,1,16,1,8,2,16,
-    1,16,1,4,1,255,128,114,176,0,0,0,99,5,0,0,
-    0,0,0,0,0,0,0,0,0,6,0,0,0,4,0,0,
-    0,67,0,0,0,115,124,0,0,0,116,0,124,0,100,1,
-    100,2,133,2,25,0,131,1,124,1,100,3,64,0,107,3,
-    114,31,100,4,124,3,155,2,157,2,125,5,116,1,160,2,
-    100,5,124,5,161,2,1,0,116,3,124,5,102,1,105,0,
-    124,4,164,1,142,1,130,1,124,2,100,6,117,1,114,60,
-    116,0,124,0,100,2,100,7,133,2,25,0,131,1,124,2,
-    100,3,64,0,107,3,114,58,116,3,100,4,124,3,155,2,
-    157,2,102,1,105,0,124,4,164,1,142,1,130,1,100,6,
-    83,0,100,6,83,0,41,8,97,7,2,0,0,86,97,108,
-    105,100,97,116,101,32,97,32,112,121,99,32,97,103,97,105,
-    110,115,116,32,116,104,101,32,115,111,117,114,99,101,32,108,
-    97,115,116,45,109,111,100,105,102,105,101,100,32,116,105,109,
-    101,46,10,10,32,32,32,32,42,100,97,116,97,42,32,105,
-    115,32,116,104,101,32,99,111,110,116,101,110,116,115,32,111,
-    102,32,116,104,101,32,112,121,99,32,102,105,108,101,46,32,
-    40,79,110,108,121,32,116,104,101,32,102,105,114,115,116,32,
-    49,54,32,98,121,116,101,115,32,97,114,101,10,32,32,32,
-    32,114,101,113,117,105,114,101,100,46,41,10,10,32,32,32,
-    32,42,115,111,117,114,99,101,95,109,116,105,109,101,42,32,
-    105,115,32,116,104,101,32,108,97,115,116,32,109,111,100,105,
-    102,105,101,100,32,116,105,109,101,115,116,97,109,112,32,111,
-    102,32,116,104,101,32,115,111,117,114,99,101,32,102,105,108,
-    101,46,10,10,32,32,32,32,42,115,111,117,114,99,101,95,
-    115,105,122,101,42,32,105,115,32,78,111,110,101,32,111,114,
-    32,116,104,101,32,115,105,122,101,32,111,102,32,116,104,101,
-    32,115,111,117,114,99,101,32,102,105,108,101,32,105,110,32,
-    98,121,116,101,115,46,10,10,32,32,32,32,42,110,97,109,
-    101,42,32,105,115,32,116,104,101,32,110,97,109,101,32,111,
-    102,32,116,104,101,32,109,111,100,117,108,101,32,98,101,105,
-    110,103,32,105,109,112,111,114,116,101,100,46,32,73,116,32,
-    105,115,32,117,115,101,100,32,102,111,114,32,108,111,103,103,
-    105,110,103,46,10,10,32,32,32,32,42,101,120,99,95,100,
-    101,116,97,105,108,115,42,32,105,115,32,97,32,100,105,99,
-    116,105,111,110,97,114,121,32,112,97,115,115,101,100,32,116,
-    111,32,73,109,112,111,114,116,69,114,114,111,114,32,105,102,
-    32,105,116,32,114,97,105,115,101,100,32,102,111,114,10,32,
-    32,32,32,105,109,112,114,111,118,101,100,32,100,101,98,117,
-    103,103,105,110,103,46,10,10,32,32,32,32,65,110,32,73,
-    109,112,111,114,116,69,114,114,111,114,32,105,115,32,114,97,
-    105,115,101,100,32,105,102,32,116,104,101,32,98,121,116,101,
-    99,111,100,101,32,105,115,32,115,116,97,108,101,46,10,10,
-    32,32,32,32,114,170,0,0,0,233,12,0,0,0,114,30,
-    0,0,0,122,22,98,121,116,101,99,111,100,101,32,105,115,
-    32,115,116,97,108,101,32,102,111,114,32,114,168,0,0,0,
-    78,114,169,0,0,0,41,4,114,42,0,0,0,114,159,0,
-    0,0,114,173,0,0,0,114,142,0,0,0,41,6,114,41,
-    0,0,0,218,12,115,111,117,114,99,101,95,109,116,105,109,
-    101,218,11,115,111,117,114,99,101,95,115,105,122,101,114,141,
-    0,0,0,114,175,0,0,0,114,117,0,0,0,114,7,0,
-    0,0,114,7,0,0,0,114,8,0,0,0,218,23,95,118,
-    97,108,105,100,97,116,101,95,116,105,109,101,115,116,97,109,
-    112,95,112,121,99,104,2,0,0,115,20,0,0,0,24,19,
-    10,1,12,1,16,1,8,1,22,1,2,255,22,2,8,254,
-    255,128,114,180,0,0,0,99,4,0,0,0,0,0,0,0,
-    0,0,0,0,4,0,0,0,4,0,0,0,67,0,0,0,
-    115,42,0,0,0,124,0,100,1,100,2,133,2,25,0,124,
-    1,107,3,114,19,116,0,100,3,124,2,155,2,157,2,102,
-    1,105,0,124,3,164,1,142,1,130,1,100,4,83,0,41,
-    5,97,243,1,0,0,86,97,108,105,100,97,116,101,32,97,
-    32,104,97,115,104,45,98,97,115,101,100,32,112,121,99,32,
-    98,121,32,99,104,101,99,107,105,110,103,32,116,104,101,32,
-    114,101,97,108,32,115,111,117,114,99,101,32,104,97,115,104,
-    32,97,103,97,105,110,115,116,32,116,104,101,32,111,110,101,
-    32,105,110,10,32,32,32,32,116,104,101,32,112,121,99,32,
-    104,101,97,100,101,114,46,10,10,32,32,32,32,42,100,97,
-    116,97,42,32,105,115,32,116,104,101,32,99,111,110,116,101,
-    110,116,115,32,111,102,32,116,104,101,32,112,121,99,32,102,
-    105,108,101,46,32,40,79,110,108,121,32,116,104,101,32,102,
-    105,114,115,116,32,49,54,32,98,121,116,101,115,32,97,114,
-    101,10,32,32,32,32,114,101,113,117,105,114,101,100,46,41,
-    10,10,32,32,32,32,42,115,111,117,114,99,101,95,104,97,
-    115,104,42,32,105,115,32,116,104,101,32,105,109,112,111,114,
-    116,108,105,98,46,117,116,105,108,46,115,111,117,114,99,101,
-    95,104,97,115,104,40,41,32,111,102,32,116,104,101,32,115,
-    111,117,114,99,101,32,102,105,108,101,46,10,10,32,32,32,
-    32,42,110,97,109,101,42,32,105,115,32,116,104,101,32,110,
-    97,109,101,32,111,102,32,116,104,101,32,109,111,100,117,108,
-    101,32,98,101,105,110,103,32,105,109,112,111,114,116,101,100,
-    46,32,73,116,32,105,115,32,117,115,101,100,32,102,111,114,
-    32,108,111,103,103,105,110,103,46,10,10,32,32,32,32,42,
-    101,120,99,95,100,101,116,97,105,108,115,42,32,105,115,32,
-    97,32,100,105,99,116,105,111,110,97,114,121,32,112,97,115,
-    115,101,100,32,116,111,32,73,109,112,111,114,116,69,114,114,
-    111,114,32,105,102,32,105,116,32,114,97,105,115,101,100,32,
-    102,111,114,10,32,32,32,32,105,109,112,114,111,118,101,100,
-    32,100,101,98,117,103,103,105,110,103,46,10,10,32,32,32,
-    32,65,110,32,73,109,112,111,114,116,69,114,114,111,114,32,
-    105,115,32,114,97,105,115,101,100,32,105,102,32,116,104,101,
-    32,98,121,116,101,99,111,100,101,32,105,115,32,115,116,97,
-    108,101,46,10,10,32,32,32,32,114,170,0,0,0,114,169,
-    0,0,0,122,46,104,97,115,104,32,105,110,32,98,121,116,
-    101,99,111,100,101,32,100,111,101,115,110,39,116,32,109,97,
-    116,99,104,32,104,97,115,104,32,111,102,32,115,111,117,114,
-    99,101,32,78,41,1,114,142,0,0,0,41,4,114,41,0,
-    0,0,218,11,115,111,117,114,99,101,95,104,97,115,104,114,
-    141,0,0,0,114,175,0,0,0,114,7,0,0,0,114,7,
-    0,0,0,114,8,0,0,0,218,18,95,118,97,108,105,100,
-    97,116,101,95,104,97,115,104,95,112,121,99,132,2,0,0,
-    115,16,0,0,0,16,17,2,1,8,1,4,255,2,2,6,
-    254,4,255,255,128,114,182,0,0,0,99,4,0,0,0,0,
-    0,0,0,0,0,0,0,5,0,0,0,5,0,0,0,67,
-    0,0,0,115,76,0,0,0,116,0,160,1,124,0,161,1,
-    125,4,116,2,124,4,116,3,131,2,114,28,116,4,160,5,
-    100,1,124,2,161,2,1,0,124,3,100,2,117,1,114,26,
-    116,6,160,7,124,4,124,3,161,2,1,0,124,4,83,0,
-    116,8,100,3,160,9,124,2,161,1,124,1,124,2,100,4,
-    141,3,130,1,41,5,122,35,67,111,109,112,105,108,101,32,
-    98,121,116,101,99,111,100,101,32,97,115,32,102,111,117,110,
-    100,32,105,110,32,97,32,112,121,99,46,122,21,99,111,100,
-    101,32,111,98,106,101,99,116,32,102,114,111,109,32,123,33,
-    114,125,78,122,23,78,111,110,45,99,111,100,101,32,111,98,
-    106,101,99,116,32,105,110,32,123,33,114,125,169,2,114,141,
-    0,0,0,114,65,0,0,0,41,10,218,7,109,97,114,115,
-    104,97,108,90,5,108,111,97,100,115,218,10,105,115,105,110,
-    115,116,97,110,99,101,218,10,95,99,111,100,101,95,116,121,
-    112,101,114,159,0,0,0,114,173,0,0,0,218,4,95,105,
-    109,112,90,16,95,102,105,120,95,99,111,95,102,105,108,101,
-    110,97,109,101,114,142,0,0,0,114,89,0,0,0,41,5,
-    114,41,0,0,0,114,141,0,0,0,114,132,0,0,0,114,
-    134,0,0,0,218,4,99,111,100,101,114,7,0,0,0,114,
-    7,0,0,0,114,8,0,0,0,218,17,95,99,111,109,112,
-    105,108,101,95,98,121,116,101,99,111,100,101,156,2,0,0,
-    115,20,0,0,0,10,2,10,1,12,1,8,1,12,1,4,
-    1,10,2,4,1,6,255,255,128,114,189,0,0,0,99,3,
-    0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,5,
-    0,0,0,67,0,0,0,115,70,0,0,0,116,0,116,1,
-    131,1,125,3,124,3,160,2,116,3,100,1,131,1,161,1,
-    1,0,124,3,160,2,116,3,124,1,131,1,161,1,1,0,
-    124,3,160,2,116,3,124,2,131,1,161,1,1,0,124,3,
-    160,2,116,4,160,5,124,0,161,1,161,1,1,0,124,3,
-    83,0,41,3,122,43,80,114,111,100,117,99,101,32,116,104,
-    101,32,100,97,116,97,32,102,111,114,32,97,32,116,105,109,
-    101,115,116,97,109,112,45,98,97,115,101,100,32,112,121,99,
-    46,114,0,0,0,0,78,41,6,218,9,98,121,116,101,97,
-    114,114,97,121,114,172,0,0,0,218,6,101,120,116,101,110,
-    100,114,36,0,0,0,114,184,0,0,0,218,5,100,117,109,
-    112,115,41,4,114,188,0,0,0,218,5,109,116,105,109,101,
-    114,179,0,0,0,114,41,0,0,0,114,7,0,0,0,114,
-    7,0,0,0,114,8,0,0,0,218,22,95,99,111,100,101,
+    10,32,32,32,32,2,20,98,97,100,32,109,97,103,105,99,
+    32,110,117,109,98,101,114,32,105,110,32,2,2,58,32,2,
+    2,123,125,2,40,114,101,97,99,104,101,100,32,69,79,70,
+    32,119,104,105,108,101,32,114,101,97,100,105,110,103,32,112,
+    121,99,32,104,101,97,100,101,114,32,111,102,32,2,14,105,
+    110,118,97,108,105,100,32,102,108,97,103,115,32,2,4,32,
+    105,110,32,3,12,77,65,71,73,67,95,78,85,77,66,69,
+    82,3,16,95,118,101,114,98,111,115,101,95,109,101,115,115,
+    97,103,101,3,8,69,79,70,69,114,114,111,114,3,11,101,
+    120,99,95,100,101,116,97,105,108,115,3,5,109,97,103,105,
+    99,3,13,95,99,108,97,115,115,105,102,121,95,112,121,99,
+    2,135,4,86,97,108,105,100,97,116,101,32,97,32,112,121,
+    99,32,97,103,97,105,110,115,116,32,116,104,101,32,115,111,
+    117,114,99,101,32,108,97,115,116,45,109,111,100,105,102,105,
+    101,100,32,116,105,109,101,46,10,10,32,32,32,32,42,100,
+    97,116,97,42,32,105,115,32,116,104,101,32,99,111,110,116,
+    101,110,116,115,32,111,102,32,116,104,101,32,112,121,99,32,
+    102,105,108,101,46,32,40,79,110,108,121,32,116,104,101,32,
+    102,105,114,115,116,32,49,54,32,98,121,116,101,115,32,97,
+    114,101,10,32,32,32,32,114,101,113,117,105,114,101,100,46,
+    41,10,10,32,32,32,32,42,115,111,117,114,99,101,95,109,
+    116,105,109,101,42,32,105,115,32,116,104,101,32,108,97,115,
+    116,32,109,111,100,105,102,105,101,100,32,116,105,109,101,115,
+    116,97,109,112,32,111,102,32,116,104,101,32,115,111,117,114,
+    99,101,32,102,105,108,101,46,10,10,32,32,32,32,42,115,
+    111,117,114,99,101,95,115,105,122,101,42,32,105,115,32,78,
+    111,110,101,32,111,114,32,116,104,101,32,115,105,122,101,32,
+    111,102,32,116,104,101,32,115,111,117,114,99,101,32,102,105,
+    108,101,32,105,110,32,98,121,116,101,115,46,10,10,32,32,
+    32,32,42,110,97,109,101,42,32,105,115,32,116,104,101,32,
+    110,97,109,101,32,111,102,32,116,104,101,32,109,111,100,117,
+    108,101,32,98,101,105,110,103,32,105,109,112,111,114,116,101,
+    100,46,32,73,116,32,105,115,32,117,115,101,100,32,102,111,
+    114,32,108,111,103,103,105,110,103,46,10,10,32,32,32,32,
+    42,101,120,99,95,100,101,116,97,105,108,115,42,32,105,115,
+    32,97,32,100,105,99,116,105,111,110,97,114,121,32,112,97,
+    115,115,101,100,32,116,111,32,73,109,112,111,114,116,69,114,
+    114,111,114,32,105,102,32,105,116,32,114,97,105,115,101,100,
+    32,102,111,114,10,32,32,32,32,105,109,112,114,111,118,101,
+    100,32,100,101,98,117,103,103,105,110,103,46,10,10,32,32,
+    32,32,65,110,32,73,109,112,111,114,116,69,114,114,111,114,
+    32,105,115,32,114,97,105,115,101,100,32,105,102,32,116,104,
+    101,32,98,121,116,101,99,111,100,101,32,105,115,32,115,116,
+    97,108,101,46,10,10,32,32,32,32,2,22,98,121,116,101,
+    99,111,100,101,32,105,115,32,115,116,97,108,101,32,102,111,
+    114,32,3,12,115,111,117,114,99,101,95,109,116,105,109,101,
+    3,11,115,111,117,114,99,101,95,115,105,122,101,3,23,95,
+    118,97,108,105,100,97,116,101,95,116,105,109,101,115,116,97,
+    109,112,95,112,121,99,2,243,3,86,97,108,105,100,97,116,
+    101,32,97,32,104,97,115,104,45,98,97,115,101,100,32,112,
+    121,99,32,98,121,32,99,104,101,99,107,105,110,103,32,116,
+    104,101,32,114,101,97,108,32,115,111,117,114,99,101,32,104,
+    97,115,104,32,97,103,97,105,110,115,116,32,116,104,101,32,
+    111,110,101,32,105,110,10,32,32,32,32,116,104,101,32,112,
+    121,99,32,104,101,97,100,101,114,46,10,10,32,32,32,32,
+    42,100,97,116,97,42,32,105,115,32,116,104,101,32,99,111,
+    110,116,101,110,116,115,32,111,102,32,116,104,101,32,112,121,
+    99,32,102,105,108,101,46,32,40,79,110,108,121,32,116,104,
+    101,32,102,105,114,115,116,32,49,54,32,98,121,116,101,115,
+    32,97,114,101,10,32,32,32,32,114,101,113,117,105,114,101,
+    100,46,41,10,10,32,32,32,32,42,115,111,117,114,99,101,
+    95,104,97,115,104,42,32,105,115,32,116,104,101,32,105,109,
+    112,111,114,116,108,105,98,46,117,116,105,108,46,115,111,117,
+    114,99,101,95,104,97,115,104,40,41,32,111,102,32,116,104,
+    101,32,115,111,117,114,99,101,32,102,105,108,101,46,10,10,
+    32,32,32,32,42,110,97,109,101,42,32,105,115,32,116,104,
+    101,32,110,97,109,101,32,111,102,32,116,104,101,32,109,111,
+    100,117,108,101,32,98,101,105,110,103,32,105,109,112,111,114,
+    116,101,100,46,32,73,116,32,105,115,32,117,115,101,100,32,
+    102,111,114,32,108,111,103,103,105,110,103,46,10,10,32,32,
+    32,32,42,101,120,99,95,100,101,116,97,105,108,115,42,32,
+    105,115,32,97,32,100,105,99,116,105,111,110,97,114,121,32,
+    112,97,115,115,101,100,32,116,111,32,73,109,112,111,114,116,
+    69,114,114,111,114,32,105,102,32,105,116,32,114,97,105,115,
+    101,100,32,102,111,114,10,32,32,32,32,105,109,112,114,111,
+    118,101,100,32,100,101,98,117,103,103,105,110,103,46,10,10,
+    32,32,32,32,65,110,32,73,109,112,111,114,116,69,114,114,
+    111,114,32,105,115,32,114,97,105,115,101,100,32,105,102,32,
+    116,104,101,32,98,121,116,101,99,111,100,101,32,105,115,32,
+    115,116,97,108,101,46,10,10,32,32,32,32,2,46,104,97,
+    115,104,32,105,110,32,98,121,116,101,99,111,100,101,32,100,
+    111,101,115,110,39,116,32,109,97,116,99,104,32,104,97,115,
+    104,32,111,102,32,115,111,117,114,99,101,32,3,11,115,111,
+    117,114,99,101,95,104,97,115,104,3,18,95,118,97,108,105,
+    100,97,116,101,95,104,97,115,104,95,112,121,99,2,35,67,
+    111,109,112,105,108,101,32,98,121,116,101,99,111,100,101,32,
+    97,115,32,102,111,117,110,100,32,105,110,32,97,32,112,121,
+    99,46,2,21,99,111,100,101,32,111,98,106,101,99,116,32,
+    102,114,111,109,32,123,33,114,125,2,23,78,111,110,45,99,
+    111,100,101,32,111,98,106,101,99,116,32,105,110,32,123,33,
+    114,125,3,7,109,97,114,115,104,97,108,3,5,108,111,97,
+    100,115,3,10,105,115,105,110,115,116,97,110,99,101,3,10,
+    95,99,111,100,101,95,116,121,112,101,3,4,95,105,109,112,
+    3,16,95,102,105,120,95,99,111,95,102,105,108,101,110,97,
+    109,101,3,4,99,111,100,101,3,17,95,99,111,109,112,105,
+    108,101,95,98,121,116,101,99,111,100,101,2,43,80,114,111,
+    100,117,99,101,32,116,104,101,32,100,97,116,97,32,102,111,
+    114,32,97,32,116,105,109,101,115,116,97,109,112,45,98,97,
+    115,101,100,32,112,121,99,46,3,9,98,121,116,101,97,114,
+    114,97,121,3,6,101,120,116,101,110,100,3,5,100,117,109,
+    112,115,3,5,109,116,105,109,101,3,22,95,99,111,100,101,
     95,116,111,95,116,105,109,101,115,116,97,109,112,95,112,121,
-    99,169,2,0,0,115,14,0,0,0,8,2,14,1,14,1,
-    14,1,16,1,4,1,255,128,114,194,0,0,0,84,99,3,
-    0,0,0,0,0,0,0,0,0,0,0,5,0,0,0,5,
-    0,0,0,67,0,0,0,115,80,0,0,0,116,0,116,1,
-    131,1,125,3,100,1,124,2,100,1,62,0,66,0,125,4,
-    124,3,160,2,116,3,124,4,131,1,161,1,1,0,116,4,
-    124,1,131,1,100,2,107,2,115,25,74,0,130,1,124,3,
-    160,2,124,1,161,1,1,0,124,3,160,2,116,5,160,6,
-    124,0,161,1,161,1,1,0,124,3,83,0,41,4,122,38,
-    80,114,111,100,117,99,101,32,116,104,101,32,100,97,116,97,
-    32,102,111,114,32,97,32,104,97,115,104,45,98,97,115,101,
-    100,32,112,121,99,46,114,3,0,0,0,114,170,0,0,0,
-    78,41,7,114,190,0,0,0,114,172,0,0,0,114,191,0,
-    0,0,114,36,0,0,0,114,4,0,0,0,114,184,0,0,
-    0,114,192,0,0,0,41,5,114,188,0,0,0,114,181,0,
-    0,0,90,7,99,104,101,99,107,101,100,114,41,0,0,0,
-    114,16,0,0,0,114,7,0,0,0,114,7,0,0,0,114,
-    8,0,0,0,218,17,95,99,111,100,101,95,116,111,95,104,
-    97,115,104,95,112,121,99,179,2,0,0,115,16,0,0,0,
-    8,2,12,1,14,1,16,1,10,1,16,1,4,1,255,128,
-    114,195,0,0,0,99,1,0,0,0,0,0,0,0,0,0,
-    0,0,5,0,0,0,6,0,0,0,67,0,0,0,115,62,
-    0,0,0,100,1,100,2,108,0,125,1,116,1,160,2,124,
-    0,161,1,106,3,125,2,124,1,160,4,124,2,161,1,125,
-    3,116,1,160,5,100,2,100,3,161,2,125,4,124,4,160,
-    6,124,0,160,6,124,3,100,1,25,0,161,1,161,1,83,
-    0,41,4,122,121,68,101,99,111,100,101,32,98,121,116,101,
-    115,32,114,101,112,114,101,115,101,110,116,105,110,103,32,115,
-    111,117,114,99,101,32,99,111,100,101,32,97,110,100,32,114,
-    101,116,117,114,110,32,116,104,101,32,115,116,114,105,110,103,
-    46,10,10,32,32,32,32,85,110,105,118,101,114,115,97,108,
-    32,110,101,119,108,105,110,101,32,115,117,112,112,111,114,116,
-    32,105,115,32,117,115,101,100,32,105,110,32,116,104,101,32,
-    100,101,99,111,100,105,110,103,46,10,32,32,32,32,114,0,
-    0,0,0,78,84,41,7,218,8,116,111,107,101,110,105,122,
-    101,114,91,0,0,0,90,7,66,121,116,101,115,73,79,90,
-    8,114,101,97,100,108,105,110,101,90,15,100,101,116,101,99,
-    116,95,101,110,99,111,100,105,110,103,90,25,73,110,99,114,
-    101,109,101,110,116,97,108,78,101,119,108,105,110,101,68,101,
-    99,111,100,101,114,218,6,100,101,99,111,100,101,41,5,218,
-    12,115,111,117,114,99,101,95,98,121,116,101,115,114,196,0,
-    0,0,90,21,115,111,117,114,99,101,95,98,121,116,101,115,
-    95,114,101,97,100,108,105,110,101,218,8,101,110,99,111,100,
-    105,110,103,90,15,110,101,119,108,105,110,101,95,100,101,99,
-    111,100,101,114,114,7,0,0,0,114,7,0,0,0,114,8,
-    0,0,0,218,13,100,101,99,111,100,101,95,115,111,117,114,
-    99,101,190,2,0,0,115,12,0,0,0,8,5,12,1,10,
-    1,12,1,20,1,255,128,114,200,0,0,0,169,2,114,164,
-    0,0,0,218,26,115,117,98,109,111,100,117,108,101,95,115,
-    101,97,114,99,104,95,108,111,99,97,116,105,111,110,115,99,
-    2,0,0,0,0,0,0,0,2,0,0,0,9,0,0,0,
-    8,0,0,0,67,0,0,0,115,52,1,0,0,124,1,100,
-    1,117,0,114,28,100,2,125,1,116,0,124,2,100,3,131,
-    2,114,27,122,7,124,2,160,1,124,0,161,1,125,1,87,
-    0,110,35,4,0,116,2,121,153,1,0,1,0,1,0,89,
-    0,110,27,110,26,116,3,160,4,124,1,161,1,125,1,116,
-    5,124,1,131,1,115,54,122,9,116,6,116,3,160,7,161,
-    0,124,1,131,2,125,1,87,0,110,7,4,0,116,8,121,
-    152,1,0,1,0,1,0,89,0,116,9,106,10,124,0,124,
-    2,124,1,100,4,141,3,125,4,100,5,124,4,95,11,124,
-    2,100,1,117,0,114,96,116,12,131,0,68,0,93,21,92,
-    2,125,5,125,6,124,1,160,13,116,14,124,6,131,1,161,
-    1,114,93,124,5,124,0,124,1,131,2,125,2,124,2,124,
-    4,95,15,1,0,113,96,113,72,100,1,83,0,124,3,116,
-    16,117,0,114,127,116,0,124,2,100,6,131,2,114,126,122,
-    7,124,2,160,17,124,0,161,1,125,7,87,0,110,8,4,
-    0,116,2,121,151,1,0,1,0,1,0,89,0,110,9,124,
-    7,114,126,103,0,124,4,95,18,110,3,124,3,124,4,95,
-    18,124,4,106,18,103,0,107,2,114,149,124,1,114,149,116,
-    19,124,1,131,1,100,7,25,0,125,8,124,4,106,18,160,
-    20,124,8,161,1,1,0,124,4,83,0,119,0,119,0,119,
-    0,41,8,97,61,1,0,0,82,101,116,117,114,110,32,97,
-    32,109,111,100,117,108,101,32,115,112,101,99,32,98,97,115,
-    101,100,32,111,110,32,97,32,102,105,108,101,32,108,111,99,
-    97,116,105,111,110,46,10,10,32,32,32,32,84,111,32,105,
-    110,100,105,99,97,116,101,32,116,104,97,116,32,116,104,101,
-    32,109,111,100,117,108,101,32,105,115,32,97,32,112,97,99,
-    107,97,103,101,44,32,115,101,116,10,32,32,32,32,115,117,
-    98,109,111,100,117,108,101,95,115,101,97,114,99,104,95,108,
-    111,99,97,116,105,111,110,115,32,116,111,32,97,32,108,105,
-    115,116,32,111,102,32,100,105,114,101,99,116,111,114,121,32,
-    112,97,116,104,115,46,32,32,65,110,10,32,32,32,32,101,
-    109,112,116,121,32,108,105,115,116,32,105,115,32,115,117,102,
-    102,105,99,105,101,110,116,44,32,116,104,111,117,103,104,32,
-    105,116,115,32,110,111,116,32,111,116,104,101,114,119,105,115,
-    101,32,117,115,101,102,117,108,32,116,111,32,116,104,101,10,
-    32,32,32,32,105,109,112,111,114,116,32,115,121,115,116,101,
-    109,46,10,10,32,32,32,32,84,104,101,32,108,111,97,100,
-    101,114,32,109,117,115,116,32,116,97,107,101,32,97,32,115,
-    112,101,99,32,97,115,32,105,116,115,32,111,110,108,121,32,
-    95,95,105,110,105,116,95,95,40,41,32,97,114,103,46,10,
-    10,32,32,32,32,78,122,9,60,117,110,107,110,111,119,110,
-    62,218,12,103,101,116,95,102,105,108,101,110,97,109,101,169,
-    1,218,6,111,114,105,103,105,110,84,218,10,105,115,95,112,
-    97,99,107,97,103,101,114,0,0,0,0,41,21,114,153,0,
-    0,0,114,203,0,0,0,114,142,0,0,0,114,18,0,0,
-    0,114,103,0,0,0,114,86,0,0,0,114,67,0,0,0,
-    114,82,0,0,0,114,76,0,0,0,114,159,0,0,0,218,
-    10,77,111,100,117,108,101,83,112,101,99,90,13,95,115,101,
-    116,95,102,105,108,101,97,116,116,114,218,27,95,103,101,116,
-    95,115,117,112,112,111,114,116,101,100,95,102,105,108,101,95,
-    108,111,97,100,101,114,115,114,58,0,0,0,114,136,0,0,
-    0,114,164,0,0,0,218,9,95,80,79,80,85,76,65,84,
-    69,114,206,0,0,0,114,202,0,0,0,114,74,0,0,0,
-    114,61,0,0,0,41,9,114,141,0,0,0,90,8,108,111,
-    99,97,116,105,111,110,114,164,0,0,0,114,202,0,0,0,
-    218,4,115,112,101,99,218,12,108,111,97,100,101,114,95,99,
-    108,97,115,115,218,8,115,117,102,102,105,120,101,115,114,206,
-    0,0,0,90,7,100,105,114,110,97,109,101,114,7,0,0,
-    0,114,7,0,0,0,114,8,0,0,0,218,23,115,112,101,
-    99,95,102,114,111,109,95,102,105,108,101,95,108,111,99,97,
-    116,105,111,110,207,2,0,0,115,86,0,0,0,8,12,4,
-    4,10,1,2,2,14,1,12,1,4,1,2,251,10,7,8,
-    1,2,1,18,1,12,1,2,1,16,8,6,1,8,3,14,
-    1,14,1,10,1,6,1,4,1,2,253,4,5,8,3,10,
-    2,2,1,14,1,12,1,4,1,4,2,6,1,2,128,6,
-    2,10,1,4,1,12,1,12,1,4,2,2,244,2,228,2,
-    249,255,128,114,213,0,0,0,99,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,0,0,4,0,0,0,64,0,0,
-    0,115,88,0,0,0,101,0,90,1,100,0,90,2,100,1,
-    90,3,100,2,90,4,100,3,90,5,101,6,111,15,100,4,
-    101,7,118,0,90,8,101,9,100,5,100,6,132,0,131,1,
-    90,10,101,11,100,7,100,8,132,0,131,1,90,12,101,11,
-    100,14,100,10,100,11,132,1,131,1,90,13,101,11,100,15,
-    100,12,100,13,132,1,131,1,90,14,100,9,83,0,41,16,
-    218,21,87,105,110,100,111,119,115,82,101,103,105,115,116,114,
-    121,70,105,110,100,101,114,122,62,77,101,116,97,32,112,97,
-    116,104,32,102,105,110,100,101,114,32,102,111,114,32,109,111,
-    100,117,108,101,115,32,100,101,99,108,97,114,101,100,32,105,
-    110,32,116,104,101,32,87,105,110,100,111,119,115,32,114,101,
-    103,105,115,116,114,121,46,122,59,83,111,102,116,119,97,114,
-    101,92,80,121,116,104,111,110,92,80,121,116,104,111,110,67,
-    111,114,101,92,123,115,121,115,95,118,101,114,115,105,111,110,
-    125,92,77,111,100,117,108,101,115,92,123,102,117,108,108,110,
-    97,109,101,125,122,65,83,111,102,116,119,97,114,101,92,80,
-    121,116,104,111,110,92,80,121,116,104,111,110,67,111,114,101,
-    92,123,115,121,115,95,118,101,114,115,105,111,110,125,92,77,
-    111,100,117,108,101,115,92,123,102,117,108,108,110,97,109,101,
-    125,92,68,101,98,117,103,122,6,95,100,46,112,121,100,99,
-    1,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,
-    8,0,0,0,67,0,0,0,115,50,0,0,0,122,8,116,
-    0,160,1,116,0,106,2,124,0,161,2,87,0,83,0,4,
-    0,116,3,121,24,1,0,1,0,1,0,116,0,160,1,116,
-    0,106,4,124,0,161,2,6,0,89,0,83,0,119,0,114,
-    69,0,0,0,41,5,218,6,119,105,110,114,101,103,90,7,
-    79,112,101,110,75,101,121,90,17,72,75,69,89,95,67,85,
-    82,82,69,78,84,95,85,83,69,82,114,76,0,0,0,90,
-    18,72,75,69,89,95,76,79,67,65,76,95,77,65,67,72,
-    73,78,69,114,19,0,0,0,114,7,0,0,0,114,7,0,
-    0,0,114,8,0,0,0,218,14,95,111,112,101,110,95,114,
-    101,103,105,115,116,114,121,36,3,0,0,115,12,0,0,0,
-    2,2,16,1,12,1,18,1,2,255,255,128,122,36,87,105,
-    110,100,111,119,115,82,101,103,105,115,116,114,121,70,105,110,
-    100,101,114,46,95,111,112,101,110,95,114,101,103,105,115,116,
-    114,121,99,2,0,0,0,0,0,0,0,0,0,0,0,6,
-    0,0,0,8,0,0,0,67,0,0,0,115,130,0,0,0,
-    124,0,106,0,114,7,124,0,106,1,125,2,110,3,124,0,
-    106,2,125,2,124,2,106,3,124,1,100,1,116,4,106,5,
-    100,0,100,2,133,2,25,0,22,0,100,3,141,2,125,3,
-    122,30,124,0,160,6,124,3,161,1,143,14,125,4,116,7,
-    160,8,124,4,100,4,161,2,125,5,87,0,100,0,4,0,
-    4,0,131,3,1,0,110,8,49,0,115,47,119,1,1,0,
-    1,0,1,0,89,0,1,0,87,0,124,5,83,0,4,0,
-    116,9,121,64,1,0,1,0,1,0,89,0,100,0,83,0,
-    119,0,41,5,78,122,5,37,100,46,37,100,114,44,0,0,
-    0,41,2,114,163,0,0,0,90,11,115,121,115,95,118,101,
-    114,115,105,111,110,114,10,0,0,0,41,10,218,11,68,69,
-    66,85,71,95,66,85,73,76,68,218,18,82,69,71,73,83,
-    84,82,89,95,75,69,89,95,68,69,66,85,71,218,12,82,
-    69,71,73,83,84,82,89,95,75,69,89,114,89,0,0,0,
-    114,15,0,0,0,218,12,118,101,114,115,105,111,110,95,105,
-    110,102,111,114,216,0,0,0,114,215,0,0,0,90,10,81,
-    117,101,114,121,86,97,108,117,101,114,76,0,0,0,41,6,
-    218,3,99,108,115,114,163,0,0,0,90,12,114,101,103,105,
-    115,116,114,121,95,107,101,121,114,20,0,0,0,90,4,104,
-    107,101,121,218,8,102,105,108,101,112,97,116,104,114,7,0,
-    0,0,114,7,0,0,0,114,8,0,0,0,218,16,95,115,
-    101,97,114,99,104,95,114,101,103,105,115,116,114,121,43,3,
-    0,0,115,30,0,0,0,6,2,8,1,6,2,6,1,16,
-    1,6,255,2,2,12,1,26,1,18,128,4,3,12,254,6,
-    1,2,255,255,128,122,38,87,105,110,100,111,119,115,82,101,
+    99,2,38,80,114,111,100,117,99,101,32,116,104,101,32,100,
+    97,116,97,32,102,111,114,32,97,32,104,97,115,104,45,98,
+    97,115,101,100,32,112,121,99,46,3,7,99,104,101,99,107,
+    101,100,3,17,95,99,111,100,101,95,116,111,95,104,97,115,
+    104,95,112,121,99,2,121,68,101,99,111,100,101,32,98,121,
+    116,101,115,32,114,101,112,114,101,115,101,110,116,105,110,103,
+    32,115,111,117,114,99,101,32,99,111,100,101,32,97,110,100,
+    32,114,101,116,117,114,110,32,116,104,101,32,115,116,114,105,
+    110,103,46,10,10,32,32,32,32,85,110,105,118,101,114,115,
+    97,108,32,110,101,119,108,105,110,101,32,115,117,112,112,111,
+    114,116,32,105,115,32,117,115,101,100,32,105,110,32,116,104,
+    101,32,100,101,99,111,100,105,110,103,46,10,32,32,32,32,
+    3,8,116,111,107,101,110,105,122,101,3,7,66,121,116,101,
+    115,73,79,3,8,114,101,97,100,108,105,110,101,3,15,100,
+    101,116,101,99,116,95,101,110,99,111,100,105,110,103,3,25,
+    73,110,99,114,101,109,101,110,116,97,108,78,101,119,108,105,
+    110,101,68,101,99,111,100,101,114,3,6,100,101,99,111,100,
+    101,3,12,115,111,117,114,99,101,95,98,121,116,101,115,3,
+    21,115,111,117,114,99,101,95,98,121,116,101,115,95,114,101,
+    97,100,108,105,110,101,3,8,101,110,99,111,100,105,110,103,
+    3,15,110,101,119,108,105,110,101,95,100,101,99,111,100,101,
+    114,3,13,100,101,99,111,100,101,95,115,111,117,114,99,101,
+    3,26,115,117,98,109,111,100,117,108,101,95,115,101,97,114,
+    99,104,95,108,111,99,97,116,105,111,110,115,2,189,2,82,
+    101,116,117,114,110,32,97,32,109,111,100,117,108,101,32,115,
+    112,101,99,32,98,97,115,101,100,32,111,110,32,97,32,102,
+    105,108,101,32,108,111,99,97,116,105,111,110,46,10,10,32,
+    32,32,32,84,111,32,105,110,100,105,99,97,116,101,32,116,
+    104,97,116,32,116,104,101,32,109,111,100,117,108,101,32,105,
+    115,32,97,32,112,97,99,107,97,103,101,44,32,115,101,116,
+    10,32,32,32,32,115,117,98,109,111,100,117,108,101,95,115,
+    101,97,114,99,104,95,108,111,99,97,116,105,111,110,115,32,
+    116,111,32,97,32,108,105,115,116,32,111,102,32,100,105,114,
+    101,99,116,111,114,121,32,112,97,116,104,115,46,32,32,65,
+    110,10,32,32,32,32,101,109,112,116,121,32,108,105,115,116,
+    32,105,115,32,115,117,102,102,105,99,105,101,110,116,44,32,
+    116,104,111,117,103,104,32,105,116,115,32,110,111,116,32,111,
+    116,104,101,114,119,105,115,101,32,117,115,101,102,117,108,32,
+    116,111,32,116,104,101,10,32,32,32,32,105,109,112,111,114,
+    116,32,115,121,115,116,101,109,46,10,10,32,32,32,32,84,
+    104,101,32,108,111,97,100,101,114,32,109,117,115,116,32,116,
+    97,107,101,32,97,32,115,112,101,99,32,97,115,32,105,116,
+    115,32,111,110,108,121,32,95,95,105,110,105,116,95,95,40,
+    41,32,97,114,103,46,10,10,32,32,32,32,2,9,60,117,
+    110,107,110,111,119,110,62,3,12,103,101,116,95,102,105,108,
+    101,110,97,109,101,3,6,111,114,105,103,105,110,3,10,105,
+    115,95,112,97,99,107,97,103,101,3,10,77,111,100,117,108,
+    101,83,112,101,99,3,13,95,115,101,116,95,102,105,108,101,
+    97,116,116,114,3,27,95,103,101,116,95,115,117,112,112,111,
+    114,116,101,100,95,102,105,108,101,95,108,111,97,100,101,114,
+    115,3,9,95,80,79,80,85,76,65,84,69,3,8,108,111,
+    99,97,116,105,111,110,3,4,115,112,101,99,3,12,108,111,
+    97,100,101,114,95,99,108,97,115,115,3,8,115,117,102,102,
+    105,120,101,115,3,7,100,105,114,110,97,109,101,3,23,115,
+    112,101,99,95,102,114,111,109,95,102,105,108,101,95,108,111,
+    99,97,116,105,111,110,3,21,87,105,110,100,111,119,115,82,
+    101,103,105,115,116,114,121,70,105,110,100,101,114,2,62,77,
+    101,116,97,32,112,97,116,104,32,102,105,110,100,101,114,32,
+    102,111,114,32,109,111,100,117,108,101,115,32,100,101,99,108,
+    97,114,101,100,32,105,110,32,116,104,101,32,87,105,110,100,
+    111,119,115,32,114,101,103,105,115,116,114,121,46,2,59,83,
+    111,102,116,119,97,114,101,92,80,121,116,104,111,110,92,80,
+    121,116,104,111,110,67,111,114,101,92,123,115,121,115,95,118,
+    101,114,115,105,111,110,125,92,77,111,100,117,108,101,115,92,
+    123,102,117,108,108,110,97,109,101,125,2,65,83,111,102,116,
+    119,97,114,101,92,80,121,116,104,111,110,92,80,121,116,104,
+    111,110,67,111,114,101,92,123,115,121,115,95,118,101,114,115,
+    105,111,110,125,92,77,111,100,117,108,101,115,92,123,102,117,
+    108,108,110,97,109,101,125,92,68,101,98,117,103,2,6,95,
+    100,46,112,121,100,3,6,119,105,110,114,101,103,3,7,79,
+    112,101,110,75,101,121,3,17,72,75,69,89,95,67,85,82,
+    82,69,78,84,95,85,83,69,82,3,18,72,75,69,89,95,
+    76,79,67,65,76,95,77,65,67,72,73,78,69,3,14,95,
+    111,112,101,110,95,114,101,103,105,115,116,114,121,2,36,87,
+    105,110,100,111,119,115,82,101,103,105,115,116,114,121,70,105,
+    110,100,101,114,46,95,111,112,101,110,95,114,101,103,105,115,
+    116,114,121,2,5,37,100,46,37,100,3,11,115,121,115,95,
+    118,101,114,115,105,111,110,3,11,68,69,66,85,71,95,66,
+    85,73,76,68,3,18,82,69,71,73,83,84,82,89,95,75,
+    69,89,95,68,69,66,85,71,3,12,82,69,71,73,83,84,
+    82,89,95,75,69,89,3,12,118,101,114,115,105,111,110,95,
+    105,110,102,111,3,10,81,117,101,114,121,86,97,108,117,101,
+    3,3,99,108,115,3,12,114,101,103,105,115,116,114,121,95,
+    107,101,121,3,4,104,107,101,121,3,8,102,105,108,101,112,
+    97,116,104,3,16,95,115,101,97,114,99,104,95,114,101,103,
+    105,115,116,114,121,2,38,87,105,110,100,111,119,115,82,101,
     103,105,115,116,114,121,70,105,110,100,101,114,46,95,115,101,
-    97,114,99,104,95,114,101,103,105,115,116,114,121,78,99,4,
-    0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,8,
-    0,0,0,67,0,0,0,115,120,0,0,0,124,0,160,0,
-    124,1,161,1,125,4,124,4,100,0,117,0,114,11,100,0,
-    83,0,122,6,116,1,124,4,131,1,1,0,87,0,110,9,
-    4,0,116,2,121,59,1,0,1,0,1,0,89,0,100,0,
-    83,0,116,3,131,0,68,0,93,26,92,2,125,5,125,6,
-    124,4,160,4,116,5,124,6,131,1,161,1,114,56,116,6,
-    106,7,124,1,124,5,124,1,124,4,131,2,124,4,100,1,
-    141,3,125,7,124,7,2,0,1,0,83,0,113,30,100,0,
-    83,0,119,0,41,2,78,114,204,0,0,0,41,8,114,223,
-    0,0,0,114,75,0,0,0,114,76,0,0,0,114,208,0,
-    0,0,114,58,0,0,0,114,136,0,0,0,114,159,0,0,
-    0,218,16,115,112,101,99,95,102,114,111,109,95,108,111,97,
-    100,101,114,41,8,114,221,0,0,0,114,163,0,0,0,114,
-    65,0,0,0,218,6,116,97,114,103,101,116,114,222,0,0,
-    0,114,164,0,0,0,114,212,0,0,0,114,210,0,0,0,
-    114,7,0,0,0,114,7,0,0,0,114,8,0,0,0,218,
-    9,102,105,110,100,95,115,112,101,99,58,3,0,0,115,36,
-    0,0,0,10,2,8,1,4,1,2,1,12,1,12,1,6,
-    1,14,1,14,1,6,1,8,1,2,1,6,254,8,3,2,
-    252,4,255,2,254,255,128,122,31,87,105,110,100,111,119,115,
-    82,101,103,105,115,116,114,121,70,105,110,100,101,114,46,102,
-    105,110,100,95,115,112,101,99,99,3,0,0,0,0,0,0,
-    0,0,0,0,0,4,0,0,0,4,0,0,0,67,0,0,
-    0,115,42,0,0,0,116,0,160,1,100,1,116,2,161,2,
-    1,0,124,0,160,3,124,1,124,2,161,2,125,3,124,3,
-    100,2,117,1,114,19,124,3,106,4,83,0,100,2,83,0,
-    41,3,122,106,70,105,110,100,32,109,111,100,117,108,101,32,
-    110,97,109,101,100,32,105,110,32,116,104,101,32,114,101,103,
-    105,115,116,114,121,46,10,10,32,32,32,32,32,32,32,32,
-    84,104,105,115,32,109,101,116,104,111,100,32,105,115,32,100,
-    101,112,114,101,99,97,116,101,100,46,32,32,85,115,101,32,
-    102,105,110,100,95,115,112,101,99,40,41,32,105,110,115,116,
-    101,97,100,46,10,10,32,32,32,32,32,32,32,32,122,112,
+    97,114,99,104,95,114,101,103,105,115,116,114,121,3,16,115,
+    112,101,99,95,102,114,111,109,95,108,111,97,100,101,114,3,
+    6,116,97,114,103,101,116,3,9,102,105,110,100,95,115,112,
+    101,99,2,31,87,105,110,100,111,119,115,82,101,103,105,115,
+    116,114,121,70,105,110,100,101,114,46,102,105,110,100,95,115,
+    112,101,99,2,106,70,105,110,100,32,109,111,100,117,108,101,
+    32,110,97,109,101,100,32,105,110,32,116,104,101,32,114,101,
+    103,105,115,116,114,121,46,10,10,32,32,32,32,32,32,32,
+    32,84,104,105,115,32,109,101,116,104,111,100,32,105,115,32,
+    100,101,112,114,101,99,97,116,101,100,46,32,32,85,115,101,
+    32,102,105,110,100,95,115,112,101,99,40,41,32,105,110,115,
+    116,101,97,100,46,10,10,32,32,32,32,32,32,32,32,2,
+    112,87,105,110,100,111,119,115,82,101,103,105,115,116,114,121,
+    70,105,110,100,101,114,46,102,105,110,100,95,109,111,100,117,
+    108,101,40,41,32,105,115,32,100,101,112,114,101,99,97,116,
+    101,100,32,97,110,100,32,115,108,97,116,101,100,32,102,111,
+    114,32,114,101,109,111,118,97,108,32,105,110,32,80,121,116,
+    104,111,110,32,51,46,49,50,59,32,117,115,101,32,102,105,
+    110,100,95,115,112,101,99,40,41,32,105,110,115,116,101,97,
+    100,3,11,102,105,110,100,95,109,111,100,117,108,101,2,33,
     87,105,110,100,111,119,115,82,101,103,105,115,116,114,121,70,
     105,110,100,101,114,46,102,105,110,100,95,109,111,100,117,108,
-    101,40,41,32,105,115,32,100,101,112,114,101,99,97,116,101,
-    100,32,97,110,100,32,115,108,97,116,101,100,32,102,111,114,
-    32,114,101,109,111,118,97,108,32,105,110,32,80,121,116,104,
-    111,110,32,51,46,49,50,59,32,117,115,101,32,102,105,110,
-    100,95,115,112,101,99,40,41,32,105,110,115,116,101,97,100,
-    78,169,5,114,99,0,0,0,114,100,0,0,0,114,101,0,
-    0,0,114,226,0,0,0,114,164,0,0,0,169,4,114,221,
-    0,0,0,114,163,0,0,0,114,65,0,0,0,114,210,0,
-    0,0,114,7,0,0,0,114,7,0,0,0,114,8,0,0,
-    0,218,11,102,105,110,100,95,109,111,100,117,108,101,74,3,
-    0,0,115,16,0,0,0,6,7,2,2,4,254,12,3,8,
-    1,6,1,4,2,255,128,122,33,87,105,110,100,111,119,115,
-    82,101,103,105,115,116,114,121,70,105,110,100,101,114,46,102,
-    105,110,100,95,109,111,100,117,108,101,169,2,78,78,114,69,
-    0,0,0,41,15,114,150,0,0,0,114,149,0,0,0,114,
-    151,0,0,0,114,152,0,0,0,114,219,0,0,0,114,218,
-    0,0,0,218,11,95,77,83,95,87,73,78,68,79,87,83,
-    218,18,69,88,84,69,78,83,73,79,78,95,83,85,70,70,
-    73,88,69,83,114,217,0,0,0,218,12,115,116,97,116,105,
-    99,109,101,116,104,111,100,114,216,0,0,0,218,11,99,108,
-    97,115,115,109,101,116,104,111,100,114,223,0,0,0,114,226,
-    0,0,0,114,229,0,0,0,114,7,0,0,0,114,7,0,
-    0,0,114,7,0,0,0,114,8,0,0,0,114,214,0,0,
-    0,24,3,0,0,115,32,0,0,0,8,0,4,2,2,3,
-    2,255,2,4,2,255,12,3,2,2,10,1,2,6,10,1,
-    2,14,12,1,2,15,16,1,255,128,114,214,0,0,0,99,
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    2,0,0,0,64,0,0,0,115,48,0,0,0,101,0,90,
-    1,100,0,90,2,100,1,90,3,100,2,100,3,132,0,90,
-    4,100,4,100,5,132,0,90,5,100,6,100,7,132,0,90,
-    6,100,8,100,9,132,0,90,7,100,10,83,0,41,11,218,
-    13,95,76,111,97,100,101,114,66,97,115,105,99,115,122,83,
-    66,97,115,101,32,99,108,97,115,115,32,111,102,32,99,111,
-    109,109,111,110,32,99,111,100,101,32,110,101,101,100,101,100,
-    32,98,121,32,98,111,116,104,32,83,111,117,114,99,101,76,
-    111,97,100,101,114,32,97,110,100,10,32,32,32,32,83,111,
-    117,114,99,101,108,101,115,115,70,105,108,101,76,111,97,100,
-    101,114,46,99,2,0,0,0,0,0,0,0,0,0,0,0,
-    5,0,0,0,4,0,0,0,67,0,0,0,115,64,0,0,
-    0,116,0,124,0,160,1,124,1,161,1,131,1,100,1,25,
-    0,125,2,124,2,160,2,100,2,100,1,161,2,100,3,25,
-    0,125,3,124,1,160,3,100,2,161,1,100,4,25,0,125,
-    4,124,3,100,5,107,2,111,31,124,4,100,5,107,3,83,
-    0,41,7,122,141,67,111,110,99,114,101,116,101,32,105,109,
-    112,108,101,109,101,110,116,97,116,105,111,110,32,111,102,32,
-    73,110,115,112,101,99,116,76,111,97,100,101,114,46,105,115,
-    95,112,97,99,107,97,103,101,32,98,121,32,99,104,101,99,
-    107,105,110,103,32,105,102,10,32,32,32,32,32,32,32,32,
-    116,104,101,32,112,97,116,104,32,114,101,116,117,114,110,101,
-    100,32,98,121,32,103,101,116,95,102,105,108,101,110,97,109,
-    101,32,104,97,115,32,97,32,102,105,108,101,110,97,109,101,
-    32,111,102,32,39,95,95,105,110,105,116,95,95,46,112,121,
-    39,46,114,3,0,0,0,114,97,0,0,0,114,0,0,0,
-    0,114,44,0,0,0,218,8,95,95,105,110,105,116,95,95,
-    78,41,4,114,74,0,0,0,114,203,0,0,0,114,125,0,
-    0,0,114,104,0,0,0,41,5,114,143,0,0,0,114,163,
-    0,0,0,114,120,0,0,0,90,13,102,105,108,101,110,97,
-    109,101,95,98,97,115,101,90,9,116,97,105,108,95,110,97,
-    109,101,114,7,0,0,0,114,7,0,0,0,114,8,0,0,
-    0,114,206,0,0,0,96,3,0,0,115,10,0,0,0,18,
-    3,16,1,14,1,16,1,255,128,122,24,95,76,111,97,100,
-    101,114,66,97,115,105,99,115,46,105,115,95,112,97,99,107,
-    97,103,101,99,2,0,0,0,0,0,0,0,0,0,0,0,
-    2,0,0,0,1,0,0,0,67,0,0,0,114,23,0,0,
-    0,169,2,122,42,85,115,101,32,100,101,102,97,117,108,116,
-    32,115,101,109,97,110,116,105,99,115,32,102,111,114,32,109,
-    111,100,117,108,101,32,99,114,101,97,116,105,111,110,46,78,
-    114,7,0,0,0,169,2,114,143,0,0,0,114,210,0,0,
-    0,114,7,0,0,0,114,7,0,0,0,114,8,0,0,0,
-    218,13,99,114,101,97,116,101,95,109,111,100,117,108,101,104,
-    3,0,0,243,4,0,0,0,4,0,255,128,122,27,95,76,
-    111,97,100,101,114,66,97,115,105,99,115,46,99,114,101,97,
-    116,101,95,109,111,100,117,108,101,99,2,0,0,0,0,0,
-    0,0,0,0,0,0,3,0,0,0,5,0,0,0,67,0,
-    0,0,115,56,0,0,0,124,0,160,0,124,1,106,1,161,
-    1,125,2,124,2,100,1,117,0,114,18,116,2,100,2,160,
-    3,124,1,106,1,161,1,131,1,130,1,116,4,160,5,116,
-    6,124,2,124,1,106,7,161,3,1,0,100,1,83,0,41,
-    3,122,19,69,120,101,99,117,116,101,32,116,104,101,32,109,
-    111,100,117,108,101,46,78,122,52,99,97,110,110,111,116,32,
-    108,111,97,100,32,109,111,100,117,108,101,32,123,33,114,125,
-    32,119,104,101,110,32,103,101,116,95,99,111,100,101,40,41,
-    32,114,101,116,117,114,110,115,32,78,111,110,101,41,8,218,
-    8,103,101,116,95,99,111,100,101,114,150,0,0,0,114,142,
-    0,0,0,114,89,0,0,0,114,159,0,0,0,218,25,95,
-    99,97,108,108,95,119,105,116,104,95,102,114,97,109,101,115,
-    95,114,101,109,111,118,101,100,218,4,101,120,101,99,114,156,
-    0,0,0,41,3,114,143,0,0,0,218,6,109,111,100,117,
-    108,101,114,188,0,0,0,114,7,0,0,0,114,7,0,0,
-    0,114,8,0,0,0,218,11,101,120,101,99,95,109,111,100,
-    117,108,101,107,3,0,0,115,14,0,0,0,12,2,8,1,
-    4,1,8,1,4,255,20,2,255,128,122,25,95,76,111,97,
-    100,101,114,66,97,115,105,99,115,46,101,120,101,99,95,109,
-    111,100,117,108,101,99,2,0,0,0,0,0,0,0,0,0,
-    0,0,2,0,0,0,4,0,0,0,67,0,0,0,115,12,
-    0,0,0,116,0,160,1,124,0,124,1,161,2,83,0,41,
-    2,122,26,84,104,105,115,32,109,101,116,104,111,100,32,105,
-    115,32,100,101,112,114,101,99,97,116,101,100,46,78,41,2,
-    114,159,0,0,0,218,17,95,108,111,97,100,95,109,111,100,
-    117,108,101,95,115,104,105,109,169,2,114,143,0,0,0,114,
-    163,0,0,0,114,7,0,0,0,114,7,0,0,0,114,8,
-    0,0,0,218,11,108,111,97,100,95,109,111,100,117,108,101,
-    115,3,0,0,115,4,0,0,0,12,3,255,128,122,25,95,
-    76,111,97,100,101,114,66,97,115,105,99,115,46,108,111,97,
-    100,95,109,111,100,117,108,101,78,41,8,114,150,0,0,0,
-    114,149,0,0,0,114,151,0,0,0,114,152,0,0,0,114,
-    206,0,0,0,114,239,0,0,0,114,245,0,0,0,114,248,
-    0,0,0,114,7,0,0,0,114,7,0,0,0,114,7,0,
-    0,0,114,8,0,0,0,114,235,0,0,0,91,3,0,0,
-    115,14,0,0,0,8,0,4,2,8,3,8,8,8,3,12,
-    8,255,128,114,235,0,0,0,99,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,0,0,3,0,0,0,64,0,0,
-    0,115,74,0,0,0,101,0,90,1,100,0,90,2,100,1,
-    100,2,132,0,90,3,100,3,100,4,132,0,90,4,100,5,
-    100,6,132,0,90,5,100,7,100,8,132,0,90,6,100,9,
-    100,10,132,0,90,7,100,11,100,12,156,1,100,13,100,14,
-    132,2,90,8,100,15,100,16,132,0,90,9,100,17,83,0,
-    41,18,218,12,83,111,117,114,99,101,76,111,97,100,101,114,
-    99,2,0,0,0,0,0,0,0,0,0,0,0,2,0,0,
-    0,1,0,0,0,67,0,0,0,115,4,0,0,0,116,0,
-    130,1,41,2,122,165,79,112,116,105,111,110,97,108,32,109,
-    101,116,104,111,100,32,116,104,97,116,32,114,101,116,117,114,
-    110,115,32,116,104,101,32,109,111,100,105,102,105,99,97,116,
-    105,111,110,32,116,105,109,101,32,40,97,110,32,105,110,116,
-    41,32,102,111,114,32,116,104,101,10,32,32,32,32,32,32,
-    32,32,115,112,101,99,105,102,105,101,100,32,112,97,116,104,
-    32,40,97,32,115,116,114,41,46,10,10,32,32,32,32,32,
-    32,32,32,82,97,105,115,101,115,32,79,83,69,114,114,111,
-    114,32,119,104,101,110,32,116,104,101,32,112,97,116,104,32,
-    99,97,110,110,111,116,32,98,101,32,104,97,110,100,108,101,
-    100,46,10,32,32,32,32,32,32,32,32,78,41,1,114,76,
-    0,0,0,169,2,114,143,0,0,0,114,65,0,0,0,114,
-    7,0,0,0,114,7,0,0,0,114,8,0,0,0,218,10,
-    112,97,116,104,95,109,116,105,109,101,123,3,0,0,115,4,
-    0,0,0,4,6,255,128,122,23,83,111,117,114,99,101,76,
-    111,97,100,101,114,46,112,97,116,104,95,109,116,105,109,101,
-    99,2,0,0,0,0,0,0,0,0,0,0,0,2,0,0,
-    0,4,0,0,0,67,0,0,0,115,14,0,0,0,100,1,
-    124,0,160,0,124,1,161,1,105,1,83,0,41,3,97,158,
-    1,0,0,79,112,116,105,111,110,97,108,32,109,101,116,104,
-    111,100,32,114,101,116,117,114,110,105,110,103,32,97,32,109,
-    101,116,97,100,97,116,97,32,100,105,99,116,32,102,111,114,
-    32,116,104,101,32,115,112,101,99,105,102,105,101,100,10,32,
-    32,32,32,32,32,32,32,112,97,116,104,32,40,97,32,115,
-    116,114,41,46,10,10,32,32,32,32,32,32,32,32,80,111,
-    115,115,105,98,108,101,32,107,101,121,115,58,10,32,32,32,
-    32,32,32,32,32,45,32,39,109,116,105,109,101,39,32,40,
-    109,97,110,100,97,116,111,114,121,41,32,105,115,32,116,104,
-    101,32,110,117,109,101,114,105,99,32,116,105,109,101,115,116,
-    97,109,112,32,111,102,32,108,97,115,116,32,115,111,117,114,
-    99,101,10,32,32,32,32,32,32,32,32,32,32,99,111,100,
-    101,32,109,111,100,105,102,105,99,97,116,105,111,110,59,10,
-    32,32,32,32,32,32,32,32,45,32,39,115,105,122,101,39,
-    32,40,111,112,116,105,111,110,97,108,41,32,105,115,32,116,
-    104,101,32,115,105,122,101,32,105,110,32,98,121,116,101,115,
-    32,111,102,32,116,104,101,32,115,111,117,114,99,101,32,99,
-    111,100,101,46,10,10,32,32,32,32,32,32,32,32,73,109,
-    112,108,101,109,101,110,116,105,110,103,32,116,104,105,115,32,
-    109,101,116,104,111,100,32,97,108,108,111,119,115,32,116,104,
-    101,32,108,111,97,100,101,114,32,116,111,32,114,101,97,100,
-    32,98,121,116,101,99,111,100,101,32,102,105,108,101,115,46,
-    10,32,32,32,32,32,32,32,32,82,97,105,115,101,115,32,
-    79,83,69,114,114,111,114,32,119,104,101,110,32,116,104,101,
-    32,112,97,116,104,32,99,97,110,110,111,116,32,98,101,32,
-    104,97,110,100,108,101,100,46,10,32,32,32,32,32,32,32,
-    32,114,193,0,0,0,78,41,1,114,251,0,0,0,114,250,
-    0,0,0,114,7,0,0,0,114,7,0,0,0,114,8,0,
-    0,0,218,10,112,97,116,104,95,115,116,97,116,115,131,3,
-    0,0,115,4,0,0,0,14,12,255,128,122,23,83,111,117,
-    114,99,101,76,111,97,100,101,114,46,112,97,116,104,95,115,
-    116,97,116,115,99,4,0,0,0,0,0,0,0,0,0,0,
-    0,4,0,0,0,4,0,0,0,67,0,0,0,115,12,0,
-    0,0,124,0,160,0,124,2,124,3,161,2,83,0,41,2,
-    122,228,79,112,116,105,111,110,97,108,32,109,101,116,104,111,
-    100,32,119,104,105,99,104,32,119,114,105,116,101,115,32,100,
-    97,116,97,32,40,98,121,116,101,115,41,32,116,111,32,97,
-    32,102,105,108,101,32,112,97,116,104,32,40,97,32,115,116,
-    114,41,46,10,10,32,32,32,32,32,32,32,32,73,109,112,
+    101,3,11,95,77,83,95,87,73,78,68,79,87,83,3,18,
+    69,88,84,69,78,83,73,79,78,95,83,85,70,70,73,88,
+    69,83,3,12,115,116,97,116,105,99,109,101,116,104,111,100,
+    3,11,99,108,97,115,115,109,101,116,104,111,100,3,13,95,
+    76,111,97,100,101,114,66,97,115,105,99,115,2,83,66,97,
+    115,101,32,99,108,97,115,115,32,111,102,32,99,111,109,109,
+    111,110,32,99,111,100,101,32,110,101,101,100,101,100,32,98,
+    121,32,98,111,116,104,32,83,111,117,114,99,101,76,111,97,
+    100,101,114,32,97,110,100,10,32,32,32,32,83,111,117,114,
+    99,101,108,101,115,115,70,105,108,101,76,111,97,100,101,114,
+    46,2,141,1,67,111,110,99,114,101,116,101,32,105,109,112,
+    108,101,109,101,110,116,97,116,105,111,110,32,111,102,32,73,
+    110,115,112,101,99,116,76,111,97,100,101,114,46,105,115,95,
+    112,97,99,107,97,103,101,32,98,121,32,99,104,101,99,107,
+    105,110,103,32,105,102,10,32,32,32,32,32,32,32,32,116,
+    104,101,32,112,97,116,104,32,114,101,116,117,114,110,101,100,
+    32,98,121,32,103,101,116,95,102,105,108,101,110,97,109,101,
+    32,104,97,115,32,97,32,102,105,108,101,110,97,109,101,32,
+    111,102,32,39,95,95,105,110,105,116,95,95,46,112,121,39,
+    46,3,8,95,95,105,110,105,116,95,95,3,13,102,105,108,
+    101,110,97,109,101,95,98,97,115,101,3,9,116,97,105,108,
+    95,110,97,109,101,2,24,95,76,111,97,100,101,114,66,97,
+    115,105,99,115,46,105,115,95,112,97,99,107,97,103,101,2,
+    42,85,115,101,32,100,101,102,97,117,108,116,32,115,101,109,
+    97,110,116,105,99,115,32,102,111,114,32,109,111,100,117,108,
+    101,32,99,114,101,97,116,105,111,110,46,3,13,99,114,101,
+    97,116,101,95,109,111,100,117,108,101,2,27,95,76,111,97,
+    100,101,114,66,97,115,105,99,115,46,99,114,101,97,116,101,
+    95,109,111,100,117,108,101,2,19,69,120,101,99,117,116,101,
+    32,116,104,101,32,109,111,100,117,108,101,46,2,52,99,97,
+    110,110,111,116,32,108,111,97,100,32,109,111,100,117,108,101,
+    32,123,33,114,125,32,119,104,101,110,32,103,101,116,95,99,
+    111,100,101,40,41,32,114,101,116,117,114,110,115,32,78,111,
+    110,101,3,8,103,101,116,95,99,111,100,101,3,25,95,99,
+    97,108,108,95,119,105,116,104,95,102,114,97,109,101,115,95,
+    114,101,109,111,118,101,100,3,4,101,120,101,99,3,6,109,
+    111,100,117,108,101,3,11,101,120,101,99,95,109,111,100,117,
+    108,101,2,25,95,76,111,97,100,101,114,66,97,115,105,99,
+    115,46,101,120,101,99,95,109,111,100,117,108,101,2,26,84,
+    104,105,115,32,109,101,116,104,111,100,32,105,115,32,100,101,
+    112,114,101,99,97,116,101,100,46,3,17,95,108,111,97,100,
+    95,109,111,100,117,108,101,95,115,104,105,109,3,11,108,111,
+    97,100,95,109,111,100,117,108,101,2,25,95,76,111,97,100,
+    101,114,66,97,115,105,99,115,46,108,111,97,100,95,109,111,
+    100,117,108,101,3,12,83,111,117,114,99,101,76,111,97,100,
+    101,114,2,165,1,79,112,116,105,111,110,97,108,32,109,101,
+    116,104,111,100,32,116,104,97,116,32,114,101,116,117,114,110,
+    115,32,116,104,101,32,109,111,100,105,102,105,99,97,116,105,
+    111,110,32,116,105,109,101,32,40,97,110,32,105,110,116,41,
+    32,102,111,114,32,116,104,101,10,32,32,32,32,32,32,32,
+    32,115,112,101,99,105,102,105,101,100,32,112,97,116,104,32,
+    40,97,32,115,116,114,41,46,10,10,32,32,32,32,32,32,
+    32,32,82,97,105,115,101,115,32,79,83,69,114,114,111,114,
+    32,119,104,101,110,32,116,104,101,32,112,97,116,104,32,99,
+    97,110,110,111,116,32,98,101,32,104,97,110,100,108,101,100,
+    46,10,32,32,32,32,32,32,32,32,3,10,112,97,116,104,
+    95,109,116,105,109,101,2,23,83,111,117,114,99,101,76,111,
+    97,100,101,114,46,112,97,116,104,95,109,116,105,109,101,2,
+    158,3,79,112,116,105,111,110,97,108,32,109,101,116,104,111,
+    100,32,114,101,116,117,114,110,105,110,103,32,97,32,109,101,
+    116,97,100,97,116,97,32,100,105,99,116,32,102,111,114,32,
+    116,104,101,32,115,112,101,99,105,102,105,101,100,10,32,32,
+    32,32,32,32,32,32,112,97,116,104,32,40,97,32,115,116,
+    114,41,46,10,10,32,32,32,32,32,32,32,32,80,111,115,
+    115,105,98,108,101,32,107,101,121,115,58,10,32,32,32,32,
+    32,32,32,32,45,32,39,109,116,105,109,101,39,32,40,109,
+    97,110,100,97,116,111,114,121,41,32,105,115,32,116,104,101,
+    32,110,117,109,101,114,105,99,32,116,105,109,101,115,116,97,
+    109,112,32,111,102,32,108,97,115,116,32,115,111,117,114,99,
+    101,10,32,32,32,32,32,32,32,32,32,32,99,111,100,101,
+    32,109,111,100,105,102,105,99,97,116,105,111,110,59,10,32,
+    32,32,32,32,32,32,32,45,32,39,115,105,122,101,39,32,
+    40,111,112,116,105,111,110,97,108,41,32,105,115,32,116,104,
+    101,32,115,105,122,101,32,105,110,32,98,121,116,101,115,32,
+    111,102,32,116,104,101,32,115,111,117,114,99,101,32,99,111,
+    100,101,46,10,10,32,32,32,32,32,32,32,32,73,109,112,
     108,101,109,101,110,116,105,110,103,32,116,104,105,115,32,109,
-    101,116,104,111,100,32,97,108,108,111,119,115,32,102,111,114,
-    32,116,104,101,32,119,114,105,116,105,110,103,32,111,102,32,
+    101,116,104,111,100,32,97,108,108,111,119,115,32,116,104,101,
+    32,108,111,97,100,101,114,32,116,111,32,114,101,97,100,32,
     98,121,116,101,99,111,100,101,32,102,105,108,101,115,46,10,
-    10,32,32,32,32,32,32,32,32,84,104,101,32,115,111,117,
-    114,99,101,32,112,97,116,104,32,105,115,32,110,101,101,100,
-    101,100,32,105,110,32,111,114,100,101,114,32,116,111,32,99,
-    111,114,114,101,99,116,108,121,32,116,114,97,110,115,102,101,
-    114,32,112,101,114,109,105,115,115,105,111,110,115,10,32,32,
-    32,32,32,32,32,32,78,41,1,218,8,115,101,116,95,100,
-    97,116,97,41,4,114,143,0,0,0,114,134,0,0,0,90,
-    10,99,97,99,104,101,95,112,97,116,104,114,41,0,0,0,
-    114,7,0,0,0,114,7,0,0,0,114,8,0,0,0,218,
-    15,95,99,97,99,104,101,95,98,121,116,101,99,111,100,101,
-    145,3,0,0,115,4,0,0,0,12,8,255,128,122,28,83,
-    111,117,114,99,101,76,111,97,100,101,114,46,95,99,97,99,
-    104,101,95,98,121,116,101,99,111,100,101,99,3,0,0,0,
-    0,0,0,0,0,0,0,0,3,0,0,0,1,0,0,0,
-    67,0,0,0,114,23,0,0,0,41,2,122,150,79,112,116,
-    105,111,110,97,108,32,109,101,116,104,111,100,32,119,104,105,
-    99,104,32,119,114,105,116,101,115,32,100,97,116,97,32,40,
-    98,121,116,101,115,41,32,116,111,32,97,32,102,105,108,101,
-    32,112,97,116,104,32,40,97,32,115,116,114,41,46,10,10,
-    32,32,32,32,32,32,32,32,73,109,112,108,101,109,101,110,
-    116,105,110,103,32,116,104,105,115,32,109,101,116,104,111,100,
-    32,97,108,108,111,119,115,32,102,111,114,32,116,104,101,32,
-    119,114,105,116,105,110,103,32,111,102,32,98,121,116,101,99,
-    111,100,101,32,102,105,108,101,115,46,10,32,32,32,32,32,
-    32,32,32,78,114,7,0,0,0,41,3,114,143,0,0,0,
-    114,65,0,0,0,114,41,0,0,0,114,7,0,0,0,114,
-    7,0,0,0,114,8,0,0,0,114,253,0,0,0,155,3,
-    0,0,114,240,0,0,0,122,21,83,111,117,114,99,101,76,
-    111,97,100,101,114,46,115,101,116,95,100,97,116,97,99,2,
-    0,0,0,0,0,0,0,0,0,0,0,5,0,0,0,10,
-    0,0,0,67,0,0,0,115,70,0,0,0,124,0,160,0,
-    124,1,161,1,125,2,122,10,124,0,160,1,124,2,161,1,
-    125,3,87,0,116,4,124,3,131,1,83,0,4,0,116,2,
-    121,34,1,0,125,4,1,0,122,7,116,3,100,1,124,1,
-    100,2,141,2,124,4,130,2,100,3,125,4,126,4,119,1,
-    119,0,41,4,122,52,67,111,110,99,114,101,116,101,32,105,
-    109,112,108,101,109,101,110,116,97,116,105,111,110,32,111,102,
-    32,73,110,115,112,101,99,116,76,111,97,100,101,114,46,103,
-    101,116,95,115,111,117,114,99,101,46,122,39,115,111,117,114,
-    99,101,32,110,111,116,32,97,118,97,105,108,97,98,108,101,
-    32,116,104,114,111,117,103,104,32,103,101,116,95,100,97,116,
-    97,40,41,114,140,0,0,0,78,41,5,114,203,0,0,0,
-    218,8,103,101,116,95,100,97,116,97,114,76,0,0,0,114,
-    142,0,0,0,114,200,0,0,0,41,5,114,143,0,0,0,
-    114,163,0,0,0,114,65,0,0,0,114,198,0,0,0,218,
-    3,101,120,99,114,7,0,0,0,114,7,0,0,0,114,8,
-    0,0,0,218,10,103,101,116,95,115,111,117,114,99,101,162,
-    3,0,0,115,26,0,0,0,10,2,2,1,12,1,8,4,
-    14,253,4,1,2,1,4,255,2,1,2,255,8,128,2,255,
-    255,128,122,23,83,111,117,114,99,101,76,111,97,100,101,114,
-    46,103,101,116,95,115,111,117,114,99,101,114,130,0,0,0,
-    41,1,218,9,95,111,112,116,105,109,105,122,101,99,3,0,
-    0,0,0,0,0,0,1,0,0,0,4,0,0,0,8,0,
-    0,0,67,0,0,0,115,22,0,0,0,116,0,106,1,116,
-    2,124,1,124,2,100,1,100,2,124,3,100,3,141,6,83,
-    0,41,5,122,130,82,101,116,117,114,110,32,116,104,101,32,
-    99,111,100,101,32,111,98,106,101,99,116,32,99,111,109,112,
-    105,108,101,100,32,102,114,111,109,32,115,111,117,114,99,101,
-    46,10,10,32,32,32,32,32,32,32,32,84,104,101,32,39,
-    100,97,116,97,39,32,97,114,103,117,109,101,110,116,32,99,
-    97,110,32,98,101,32,97,110,121,32,111,98,106,101,99,116,
-    32,116,121,112,101,32,116,104,97,116,32,99,111,109,112,105,
-    108,101,40,41,32,115,117,112,112,111,114,116,115,46,10,32,
-    32,32,32,32,32,32,32,114,243,0,0,0,84,41,2,218,
-    12,100,111,110,116,95,105,110,104,101,114,105,116,114,108,0,
-    0,0,78,41,3,114,159,0,0,0,114,242,0,0,0,218,
-    7,99,111,109,112,105,108,101,41,4,114,143,0,0,0,114,
-    41,0,0,0,114,65,0,0,0,114,2,1,0,0,114,7,
-    0,0,0,114,7,0,0,0,114,8,0,0,0,218,14,115,
-    111,117,114,99,101,95,116,111,95,99,111,100,101,172,3,0,
-    0,115,8,0,0,0,12,5,4,1,6,255,255,128,122,27,
-    83,111,117,114,99,101,76,111,97,100,101,114,46,115,111,117,
-    114,99,101,95,116,111,95,99,111,100,101,99,2,0,0,0,
-    0,0,0,0,0,0,0,0,15,0,0,0,9,0,0,0,
-    67,0,0,0,115,12,2,0,0,124,0,160,0,124,1,161,
-    1,125,2,100,1,125,3,100,1,125,4,100,1,125,5,100,
-    2,125,6,100,3,125,7,122,6,116,1,124,2,131,1,125,
-    8,87,0,110,11,4,0,116,2,144,1,121,5,1,0,1,
-    0,1,0,100,1,125,8,89,0,110,143,122,7,124,0,160,
-    3,124,2,161,1,125,9,87,0,110,9,4,0,116,4,144,
-    1,121,4,1,0,1,0,1,0,89,0,110,126,116,5,124,
-    9,100,4,25,0,131,1,125,3,122,7,124,0,160,6,124,
-    8,161,1,125,10,87,0,110,9,4,0,116,4,144,1,121,
-    3,1,0,1,0,1,0,89,0,110,103,124,1,124,8,100,
-    5,156,2,125,11,122,71,116,7,124,10,124,1,124,11,131,
-    3,125,12,116,8,124,10,131,1,100,6,100,1,133,2,25,
-    0,125,13,124,12,100,7,64,0,100,8,107,3,125,6,124,
-    6,114,138,124,12,100,9,64,0,100,8,107,3,125,7,116,
-    9,106,10,100,10,107,3,114,137,124,7,115,119,116,9,106,
-    10,100,11,107,2,114,137,124,0,160,6,124,2,161,1,125,
-    4,116,9,160,11,116,12,124,4,161,2,125,5,116,13,124,
-    10,124,5,124,1,124,11,131,4,1,0,110,10,116,14,124,
-    10,124,3,124,9,100,12,25,0,124,1,124,11,131,5,1,
-    0,87,0,110,11,4,0,116,15,116,16,102,2,144,1,121,
-    2,1,0,1,0,1,0,89,0,110,15,116,17,160,18,100,
-    13,124,8,124,2,161,3,1,0,116,19,124,13,124,1,124,
-    8,124,2,100,14,141,4,83,0,124,4,100,1,117,0,114,
-    185,124,0,160,6,124,2,161,1,125,4,124,0,160,20,124,
-    4,124,2,161,2,125,14,116,17,160,18,100,15,124,2,161,
-    2,1,0,116,21,106,22,115,255,124,8,100,1,117,1,114,
-    255,124,3,100,1,117,1,114,255,124,6,114,226,124,5,100,
-    1,117,0,114,219,116,9,160,11,124,4,161,1,125,5,116,
-    23,124,14,124,5,124,7,131,3,125,10,110,8,116,24,124,
-    14,124,3,116,25,124,4,131,1,131,3,125,10,122,10,124,
-    0,160,26,124,2,124,8,124,10,161,3,1,0,87,0,124,
-    14,83,0,4,0,116,2,144,1,121,1,1,0,1,0,1,
-    0,89,0,124,14,83,0,124,14,83,0,119,0,119,0,119,
-    0,119,0,119,0,41,16,122,190,67,111,110,99,114,101,116,
-    101,32,105,109,112,108,101,109,101,110,116,97,116,105,111,110,
-    32,111,102,32,73,110,115,112,101,99,116,76,111,97,100,101,
-    114,46,103,101,116,95,99,111,100,101,46,10,10,32,32,32,
-    32,32,32,32,32,82,101,97,100,105,110,103,32,111,102,32,
-    98,121,116,101,99,111,100,101,32,114,101,113,117,105,114,101,
-    115,32,112,97,116,104,95,115,116,97,116,115,32,116,111,32,
-    98,101,32,105,109,112,108,101,109,101,110,116,101,100,46,32,
-    84,111,32,119,114,105,116,101,10,32,32,32,32,32,32,32,
-    32,98,121,116,101,99,111,100,101,44,32,115,101,116,95,100,
-    97,116,97,32,109,117,115,116,32,97,108,115,111,32,98,101,
-    32,105,109,112,108,101,109,101,110,116,101,100,46,10,10,32,
-    32,32,32,32,32,32,32,78,70,84,114,193,0,0,0,114,
-    183,0,0,0,114,169,0,0,0,114,3,0,0,0,114,0,
-    0,0,0,114,44,0,0,0,90,5,110,101,118,101,114,90,
-    6,97,108,119,97,121,115,218,4,115,105,122,101,122,13,123,
-    125,32,109,97,116,99,104,101,115,32,123,125,41,3,114,141,
-    0,0,0,114,132,0,0,0,114,134,0,0,0,122,19,99,
+    32,32,32,32,32,32,32,32,82,97,105,115,101,115,32,79,
+    83,69,114,114,111,114,32,119,104,101,110,32,116,104,101,32,
+    112,97,116,104,32,99,97,110,110,111,116,32,98,101,32,104,
+    97,110,100,108,101,100,46,10,32,32,32,32,32,32,32,32,
+    3,10,112,97,116,104,95,115,116,97,116,115,2,23,83,111,
+    117,114,99,101,76,111,97,100,101,114,46,112,97,116,104,95,
+    115,116,97,116,115,2,228,1,79,112,116,105,111,110,97,108,
+    32,109,101,116,104,111,100,32,119,104,105,99,104,32,119,114,
+    105,116,101,115,32,100,97,116,97,32,40,98,121,116,101,115,
+    41,32,116,111,32,97,32,102,105,108,101,32,112,97,116,104,
+    32,40,97,32,115,116,114,41,46,10,10,32,32,32,32,32,
+    32,32,32,73,109,112,108,101,109,101,110,116,105,110,103,32,
+    116,104,105,115,32,109,101,116,104,111,100,32,97,108,108,111,
+    119,115,32,102,111,114,32,116,104,101,32,119,114,105,116,105,
+    110,103,32,111,102,32,98,121,116,101,99,111,100,101,32,102,
+    105,108,101,115,46,10,10,32,32,32,32,32,32,32,32,84,
+    104,101,32,115,111,117,114,99,101,32,112,97,116,104,32,105,
+    115,32,110,101,101,100,101,100,32,105,110,32,111,114,100,101,
+    114,32,116,111,32,99,111,114,114,101,99,116,108,121,32,116,
+    114,97,110,115,102,101,114,32,112,101,114,109,105,115,115,105,
+    111,110,115,10,32,32,32,32,32,32,32,32,3,8,115,101,
+    116,95,100,97,116,97,3,10,99,97,99,104,101,95,112,97,
+    116,104,3,15,95,99,97,99,104,101,95,98,121,116,101,99,
+    111,100,101,2,28,83,111,117,114,99,101,76,111,97,100,101,
+    114,46,95,99,97,99,104,101,95,98,121,116,101,99,111,100,
+    101,2,150,1,79,112,116,105,111,110,97,108,32,109,101,116,
+    104,111,100,32,119,104,105,99,104,32,119,114,105,116,101,115,
+    32,100,97,116,97,32,40,98,121,116,101,115,41,32,116,111,
+    32,97,32,102,105,108,101,32,112,97,116,104,32,40,97,32,
+    115,116,114,41,46,10,10,32,32,32,32,32,32,32,32,73,
+    109,112,108,101,109,101,110,116,105,110,103,32,116,104,105,115,
+    32,109,101,116,104,111,100,32,97,108,108,111,119,115,32,102,
+    111,114,32,116,104,101,32,119,114,105,116,105,110,103,32,111,
+    102,32,98,121,116,101,99,111,100,101,32,102,105,108,101,115,
+    46,10,32,32,32,32,32,32,32,32,2,21,83,111,117,114,
+    99,101,76,111,97,100,101,114,46,115,101,116,95,100,97,116,
+    97,2,52,67,111,110,99,114,101,116,101,32,105,109,112,108,
+    101,109,101,110,116,97,116,105,111,110,32,111,102,32,73,110,
+    115,112,101,99,116,76,111,97,100,101,114,46,103,101,116,95,
+    115,111,117,114,99,101,46,2,39,115,111,117,114,99,101,32,
+    110,111,116,32,97,118,97,105,108,97,98,108,101,32,116,104,
+    114,111,117,103,104,32,103,101,116,95,100,97,116,97,40,41,
+    3,8,103,101,116,95,100,97,116,97,3,3,101,120,99,3,
+    10,103,101,116,95,115,111,117,114,99,101,2,23,83,111,117,
+    114,99,101,76,111,97,100,101,114,46,103,101,116,95,115,111,
+    117,114,99,101,3,9,95,111,112,116,105,109,105,122,101,2,
+    130,1,82,101,116,117,114,110,32,116,104,101,32,99,111,100,
+    101,32,111,98,106,101,99,116,32,99,111,109,112,105,108,101,
+    100,32,102,114,111,109,32,115,111,117,114,99,101,46,10,10,
+    32,32,32,32,32,32,32,32,84,104,101,32,39,100,97,116,
+    97,39,32,97,114,103,117,109,101,110,116,32,99,97,110,32,
+    98,101,32,97,110,121,32,111,98,106,101,99,116,32,116,121,
+    112,101,32,116,104,97,116,32,99,111,109,112,105,108,101,40,
+    41,32,115,117,112,112,111,114,116,115,46,10,32,32,32,32,
+    32,32,32,32,3,12,100,111,110,116,95,105,110,104,101,114,
+    105,116,3,7,99,111,109,112,105,108,101,3,14,115,111,117,
+    114,99,101,95,116,111,95,99,111,100,101,2,27,83,111,117,
+    114,99,101,76,111,97,100,101,114,46,115,111,117,114,99,101,
+    95,116,111,95,99,111,100,101,2,190,1,67,111,110,99,114,
+    101,116,101,32,105,109,112,108,101,109,101,110,116,97,116,105,
+    111,110,32,111,102,32,73,110,115,112,101,99,116,76,111,97,
+    100,101,114,46,103,101,116,95,99,111,100,101,46,10,10,32,
+    32,32,32,32,32,32,32,82,101,97,100,105,110,103,32,111,
+    102,32,98,121,116,101,99,111,100,101,32,114,101,113,117,105,
+    114,101,115,32,112,97,116,104,95,115,116,97,116,115,32,116,
+    111,32,98,101,32,105,109,112,108,101,109,101,110,116,101,100,
+    46,32,84,111,32,119,114,105,116,101,10,32,32,32,32,32,
+    32,32,32,98,121,116,101,99,111,100,101,44,32,115,101,116,
+    95,100,97,116,97,32,109,117,115,116,32,97,108,115,111,32,
+    98,101,32,105,109,112,108,101,109,101,110,116,101,100,46,10,
+    10,32,32,32,32,32,32,32,32,3,5,110,101,118,101,114,
+    3,6,97,108,119,97,121,115,3,4,115,105,122,101,2,13,
+    123,125,32,109,97,116,99,104,101,115,32,123,125,2,19,99,
     111,100,101,32,111,98,106,101,99,116,32,102,114,111,109,32,
-    123,125,41,27,114,203,0,0,0,114,121,0,0,0,114,107,
-    0,0,0,114,252,0,0,0,114,76,0,0,0,114,33,0,
-    0,0,114,255,0,0,0,114,176,0,0,0,218,10,109,101,
-    109,111,114,121,118,105,101,119,114,187,0,0,0,90,21,99,
-    104,101,99,107,95,104,97,115,104,95,98,97,115,101,100,95,
-    112,121,99,115,114,181,0,0,0,218,17,95,82,65,87,95,
-    77,65,71,73,67,95,78,85,77,66,69,82,114,182,0,0,
-    0,114,180,0,0,0,114,142,0,0,0,114,174,0,0,0,
-    114,159,0,0,0,114,173,0,0,0,114,189,0,0,0,114,
-    5,1,0,0,114,15,0,0,0,218,19,100,111,110,116,95,
-    119,114,105,116,101,95,98,121,116,101,99,111,100,101,114,195,
-    0,0,0,114,194,0,0,0,114,4,0,0,0,114,254,0,
-    0,0,41,15,114,143,0,0,0,114,163,0,0,0,114,134,
-    0,0,0,114,178,0,0,0,114,198,0,0,0,114,181,0,
-    0,0,90,10,104,97,115,104,95,98,97,115,101,100,90,12,
-    99,104,101,99,107,95,115,111,117,114,99,101,114,132,0,0,
-    0,218,2,115,116,114,41,0,0,0,114,175,0,0,0,114,
-    16,0,0,0,90,10,98,121,116,101,115,95,100,97,116,97,
-    90,11,99,111,100,101,95,111,98,106,101,99,116,114,7,0,
-    0,0,114,7,0,0,0,114,8,0,0,0,114,241,0,0,
-    0,180,3,0,0,115,170,0,0,0,10,7,4,1,4,1,
-    4,1,4,1,4,1,2,1,12,1,14,1,8,1,2,2,
-    14,1,14,1,4,1,12,2,2,1,14,1,14,1,4,1,
-    2,3,2,1,6,254,2,4,12,1,16,1,12,1,4,1,
-    12,1,10,1,2,1,2,255,8,2,2,254,10,3,4,1,
-    2,1,2,1,4,254,8,4,2,1,4,255,2,128,2,3,
-    2,1,2,1,6,1,2,1,2,1,4,251,4,128,18,7,
-    4,1,8,2,2,1,4,255,6,2,2,1,2,1,6,254,
-    8,3,10,1,12,1,12,1,14,1,6,1,2,255,4,2,
-    8,1,10,1,14,1,6,2,6,1,4,255,2,2,16,1,
-    4,3,14,254,2,1,8,1,2,254,2,233,2,225,2,250,
-    2,251,255,128,122,21,83,111,117,114,99,101,76,111,97,100,
-    101,114,46,103,101,116,95,99,111,100,101,78,41,10,114,150,
-    0,0,0,114,149,0,0,0,114,151,0,0,0,114,251,0,
-    0,0,114,252,0,0,0,114,254,0,0,0,114,253,0,0,
-    0,114,1,1,0,0,114,5,1,0,0,114,241,0,0,0,
-    114,7,0,0,0,114,7,0,0,0,114,7,0,0,0,114,
-    8,0,0,0,114,249,0,0,0,121,3,0,0,115,18,0,
-    0,0,8,0,8,2,8,8,8,14,8,10,8,7,14,10,
-    12,8,255,128,114,249,0,0,0,99,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,
-    0,0,115,92,0,0,0,101,0,90,1,100,0,90,2,100,
-    1,90,3,100,2,100,3,132,0,90,4,100,4,100,5,132,
-    0,90,5,100,6,100,7,132,0,90,6,101,7,135,0,102,
-    1,100,8,100,9,132,8,131,1,90,8,101,7,100,10,100,
-    11,132,0,131,1,90,9,100,12,100,13,132,0,90,10,101,
-    7,100,14,100,15,132,0,131,1,90,11,135,0,4,0,90,
-    12,83,0,41,16,218,10,70,105,108,101,76,111,97,100,101,
-    114,122,103,66,97,115,101,32,102,105,108,101,32,108,111,97,
-    100,101,114,32,99,108,97,115,115,32,119,104,105,99,104,32,
-    105,109,112,108,101,109,101,110,116,115,32,116,104,101,32,108,
-    111,97,100,101,114,32,112,114,111,116,111,99,111,108,32,109,
-    101,116,104,111,100,115,32,116,104,97,116,10,32,32,32,32,
-    114,101,113,117,105,114,101,32,102,105,108,101,32,115,121,115,
-    116,101,109,32,117,115,97,103,101,46,99,3,0,0,0,0,
-    0,0,0,0,0,0,0,3,0,0,0,2,0,0,0,67,
-    0,0,0,115,16,0,0,0,124,1,124,0,95,0,124,2,
-    124,0,95,1,100,1,83,0,41,2,122,75,67,97,99,104,
-    101,32,116,104,101,32,109,111,100,117,108,101,32,110,97,109,
-    101,32,97,110,100,32,116,104,101,32,112,97,116,104,32,116,
-    111,32,116,104,101,32,102,105,108,101,32,102,111,117,110,100,
-    32,98,121,32,116,104,101,10,32,32,32,32,32,32,32,32,
-    102,105,110,100,101,114,46,78,114,183,0,0,0,41,3,114,
-    143,0,0,0,114,163,0,0,0,114,65,0,0,0,114,7,
-    0,0,0,114,7,0,0,0,114,8,0,0,0,114,236,0,
-    0,0,14,4,0,0,115,6,0,0,0,6,3,10,1,255,
-    128,122,19,70,105,108,101,76,111,97,100,101,114,46,95,95,
-    105,110,105,116,95,95,99,2,0,0,0,0,0,0,0,0,
-    0,0,0,2,0,0,0,2,0,0,0,67,0,0,0,243,
-    24,0,0,0,124,0,106,0,124,1,106,0,107,2,111,11,
-    124,0,106,1,124,1,106,1,107,2,83,0,114,69,0,0,
-    0,169,2,218,9,95,95,99,108,97,115,115,95,95,114,156,
-    0,0,0,169,2,114,143,0,0,0,90,5,111,116,104,101,
-    114,114,7,0,0,0,114,7,0,0,0,114,8,0,0,0,
-    218,6,95,95,101,113,95,95,20,4,0,0,243,8,0,0,
-    0,12,1,10,1,2,255,255,128,122,17,70,105,108,101,76,
-    111,97,100,101,114,46,95,95,101,113,95,95,99,1,0,0,
-    0,0,0,0,0,0,0,0,0,1,0,0,0,3,0,0,
-    0,67,0,0,0,243,20,0,0,0,116,0,124,0,106,1,
-    131,1,116,0,124,0,106,2,131,1,65,0,83,0,114,69,
-    0,0,0,169,3,218,4,104,97,115,104,114,141,0,0,0,
-    114,65,0,0,0,169,1,114,143,0,0,0,114,7,0,0,
-    0,114,7,0,0,0,114,8,0,0,0,218,8,95,95,104,
-    97,115,104,95,95,24,4,0,0,243,4,0,0,0,20,1,
-    255,128,122,19,70,105,108,101,76,111,97,100,101,114,46,95,
-    95,104,97,115,104,95,95,99,2,0,0,0,0,0,0,0,
-    0,0,0,0,2,0,0,0,3,0,0,0,3,0,0,0,
-    115,16,0,0,0,116,0,116,1,124,0,131,2,160,2,124,
-    1,161,1,83,0,41,2,122,100,76,111,97,100,32,97,32,
-    109,111,100,117,108,101,32,102,114,111,109,32,97,32,102,105,
-    108,101,46,10,10,32,32,32,32,32,32,32,32,84,104,105,
-    115,32,109,101,116,104,111,100,32,105,115,32,100,101,112,114,
-    101,99,97,116,101,100,46,32,32,85,115,101,32,101,120,101,
-    99,95,109,111,100,117,108,101,40,41,32,105,110,115,116,101,
-    97,100,46,10,10,32,32,32,32,32,32,32,32,78,41,3,
-    218,5,115,117,112,101,114,114,11,1,0,0,114,248,0,0,
-    0,114,247,0,0,0,169,1,114,14,1,0,0,114,7,0,
-    0,0,114,8,0,0,0,114,248,0,0,0,27,4,0,0,
-    115,4,0,0,0,16,10,255,128,122,22,70,105,108,101,76,
-    111,97,100,101,114,46,108,111,97,100,95,109,111,100,117,108,
-    101,99,2,0,0,0,0,0,0,0,0,0,0,0,2,0,
-    0,0,1,0,0,0,67,0,0,0,243,6,0,0,0,124,
-    0,106,0,83,0,169,2,122,58,82,101,116,117,114,110,32,
-    116,104,101,32,112,97,116,104,32,116,111,32,116,104,101,32,
-    115,111,117,114,99,101,32,102,105,108,101,32,97,115,32,102,
-    111,117,110,100,32,98,121,32,116,104,101,32,102,105,110,100,
-    101,114,46,78,114,71,0,0,0,114,247,0,0,0,114,7,
-    0,0,0,114,7,0,0,0,114,8,0,0,0,114,203,0,
-    0,0,39,4,0,0,243,4,0,0,0,6,3,255,128,122,
-    23,70,105,108,101,76,111,97,100,101,114,46,103,101,116,95,
-    102,105,108,101,110,97,109,101,99,2,0,0,0,0,0,0,
-    0,0,0,0,0,3,0,0,0,8,0,0,0,67,0,0,
-    0,115,128,0,0,0,116,0,124,0,116,1,116,2,102,2,
-    131,2,114,36,116,3,160,4,116,5,124,1,131,1,161,1,
-    143,12,125,2,124,2,160,6,161,0,87,0,2,0,100,1,
-    4,0,4,0,131,3,1,0,83,0,49,0,115,29,119,1,
-    1,0,1,0,1,0,89,0,1,0,100,1,83,0,116,3,
-    160,7,124,1,100,2,161,2,143,12,125,2,124,2,160,6,
-    161,0,87,0,2,0,100,1,4,0,4,0,131,3,1,0,
-    83,0,49,0,115,57,119,1,1,0,1,0,1,0,89,0,
-    1,0,100,1,83,0,41,3,122,39,82,101,116,117,114,110,
-    32,116,104,101,32,100,97,116,97,32,102,114,111,109,32,112,
-    97,116,104,32,97,115,32,114,97,119,32,98,121,116,101,115,
-    46,78,218,1,114,41,8,114,185,0,0,0,114,249,0,0,
-    0,218,19,69,120,116,101,110,115,105,111,110,70,105,108,101,
-    76,111,97,100,101,114,114,91,0,0,0,90,9,111,112,101,
-    110,95,99,111,100,101,114,109,0,0,0,90,4,114,101,97,
-    100,114,92,0,0,0,41,3,114,143,0,0,0,114,65,0,
-    0,0,114,94,0,0,0,114,7,0,0,0,114,7,0,0,
-    0,114,8,0,0,0,114,255,0,0,0,44,4,0,0,115,
-    16,0,0,0,14,2,16,1,22,1,20,128,14,2,22,1,
-    20,128,255,128,122,19,70,105,108,101,76,111,97,100,101,114,
-    46,103,101,116,95,100,97,116,97,99,2,0,0,0,0,0,
-    0,0,0,0,0,0,3,0,0,0,2,0,0,0,67,0,
-    0,0,115,20,0,0,0,100,1,100,2,108,0,109,1,125,
-    2,1,0,124,2,124,0,131,1,83,0,41,3,78,114,0,
-    0,0,0,41,1,218,10,70,105,108,101,82,101,97,100,101,
-    114,41,2,218,17,105,109,112,111,114,116,108,105,98,46,114,
-    101,97,100,101,114,115,114,31,1,0,0,41,3,114,143,0,
-    0,0,114,244,0,0,0,114,31,1,0,0,114,7,0,0,
-    0,114,7,0,0,0,114,8,0,0,0,218,19,103,101,116,
-    95,114,101,115,111,117,114,99,101,95,114,101,97,100,101,114,
-    53,4,0,0,115,6,0,0,0,12,2,8,1,255,128,122,
-    30,70,105,108,101,76,111,97,100,101,114,46,103,101,116,95,
-    114,101,115,111,117,114,99,101,95,114,101,97,100,101,114,41,
-    13,114,150,0,0,0,114,149,0,0,0,114,151,0,0,0,
-    114,152,0,0,0,114,236,0,0,0,114,16,1,0,0,114,
-    22,1,0,0,114,160,0,0,0,114,248,0,0,0,114,203,
-    0,0,0,114,255,0,0,0,114,33,1,0,0,90,13,95,
-    95,99,108,97,115,115,99,101,108,108,95,95,114,7,0,0,
-    0,114,7,0,0,0,114,25,1,0,0,114,8,0,0,0,
-    114,11,1,0,0,9,4,0,0,115,26,0,0,0,8,0,
-    4,2,8,3,8,6,8,4,2,3,14,1,2,11,10,1,
-    8,4,2,9,18,1,255,128,114,11,1,0,0,99,0,0,
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,
-    0,0,64,0,0,0,115,46,0,0,0,101,0,90,1,100,
-    0,90,2,100,1,90,3,100,2,100,3,132,0,90,4,100,
-    4,100,5,132,0,90,5,100,6,100,7,156,1,100,8,100,
-    9,132,2,90,6,100,10,83,0,41,11,218,16,83,111,117,
-    114,99,101,70,105,108,101,76,111,97,100,101,114,122,62,67,
-    111,110,99,114,101,116,101,32,105,109,112,108,101,109,101,110,
-    116,97,116,105,111,110,32,111,102,32,83,111,117,114,99,101,
-    76,111,97,100,101,114,32,117,115,105,110,103,32,116,104,101,
-    32,102,105,108,101,32,115,121,115,116,101,109,46,99,2,0,
-    0,0,0,0,0,0,0,0,0,0,3,0,0,0,3,0,
-    0,0,67,0,0,0,115,22,0,0,0,116,0,124,1,131,
-    1,125,2,124,2,106,1,124,2,106,2,100,1,156,2,83,
-    0,41,3,122,33,82,101,116,117,114,110,32,116,104,101,32,
-    109,101,116,97,100,97,116,97,32,102,111,114,32,116,104,101,
-    32,112,97,116,104,46,41,2,114,193,0,0,0,114,6,1,
-    0,0,78,41,3,114,75,0,0,0,218,8,115,116,95,109,
-    116,105,109,101,90,7,115,116,95,115,105,122,101,41,3,114,
-    143,0,0,0,114,65,0,0,0,114,10,1,0,0,114,7,
-    0,0,0,114,7,0,0,0,114,8,0,0,0,114,252,0,
-    0,0,63,4,0,0,115,6,0,0,0,8,2,14,1,255,
-    128,122,27,83,111,117,114,99,101,70,105,108,101,76,111,97,
-    100,101,114,46,112,97,116,104,95,115,116,97,116,115,99,4,
-    0,0,0,0,0,0,0,0,0,0,0,5,0,0,0,5,
-    0,0,0,67,0,0,0,115,24,0,0,0,116,0,124,1,
-    131,1,125,4,124,0,106,1,124,2,124,3,124,4,100,1,
-    141,3,83,0,41,2,78,169,1,218,5,95,109,111,100,101,
-    41,2,114,139,0,0,0,114,253,0,0,0,41,5,114,143,
-    0,0,0,114,134,0,0,0,114,132,0,0,0,114,41,0,
-    0,0,114,78,0,0,0,114,7,0,0,0,114,7,0,0,
-    0,114,8,0,0,0,114,254,0,0,0,68,4,0,0,115,
-    6,0,0,0,8,2,16,1,255,128,122,32,83,111,117,114,
-    99,101,70,105,108,101,76,111,97,100,101,114,46,95,99,97,
-    99,104,101,95,98,121,116,101,99,111,100,101,114,87,0,0,
-    0,114,36,1,0,0,99,3,0,0,0,0,0,0,0,1,
-    0,0,0,9,0,0,0,11,0,0,0,67,0,0,0,115,
-    254,0,0,0,116,0,124,1,131,1,92,2,125,4,125,5,
-    103,0,125,6,124,4,114,31,116,1,124,4,131,1,115,31,
-    116,0,124,4,131,1,92,2,125,4,125,7,124,6,160,2,
-    124,7,161,1,1,0,124,4,114,31,116,1,124,4,131,1,
-    114,14,116,3,124,6,131,1,68,0,93,48,125,7,116,4,
-    124,4,124,7,131,2,125,4,122,7,116,5,160,6,124,4,
-    161,1,1,0,87,0,113,35,4,0,116,7,121,58,1,0,
-    1,0,1,0,89,0,113,35,4,0,116,8,121,126,1,0,
-    125,8,1,0,122,15,116,9,160,10,100,1,124,4,124,8,
-    161,3,1,0,87,0,89,0,100,2,125,8,126,8,1,0,
-    100,2,83,0,100,2,125,8,126,8,119,1,122,15,116,11,
-    124,1,124,2,124,3,131,3,1,0,116,9,160,10,100,3,
-    124,1,161,2,1,0,87,0,100,2,83,0,4,0,116,8,
-    121,125,1,0,125,8,1,0,122,14,116,9,160,10,100,1,
-    124,1,124,8,161,3,1,0,87,0,89,0,100,2,125,8,
-    126,8,100,2,83,0,100,2,125,8,126,8,119,1,119,0,
-    119,0,41,4,122,27,87,114,105,116,101,32,98,121,116,101,
-    115,32,100,97,116,97,32,116,111,32,97,32,102,105,108,101,
-    46,122,27,99,111,117,108,100,32,110,111,116,32,99,114,101,
-    97,116,101,32,123,33,114,125,58,32,123,33,114,125,78,122,
-    12,99,114,101,97,116,101,100,32,123,33,114,125,41,12,114,
-    74,0,0,0,114,83,0,0,0,114,61,0,0,0,218,8,
-    114,101,118,101,114,115,101,100,114,67,0,0,0,114,18,0,
-    0,0,90,5,109,107,100,105,114,218,15,70,105,108,101,69,
-    120,105,115,116,115,69,114,114,111,114,114,76,0,0,0,114,
-    159,0,0,0,114,173,0,0,0,114,95,0,0,0,41,9,
-    114,143,0,0,0,114,65,0,0,0,114,41,0,0,0,114,
-    37,1,0,0,218,6,112,97,114,101,110,116,114,120,0,0,
-    0,114,63,0,0,0,114,68,0,0,0,114,0,1,0,0,
-    114,7,0,0,0,114,7,0,0,0,114,8,0,0,0,114,
-    253,0,0,0,73,4,0,0,115,58,0,0,0,12,2,4,
-    1,12,2,12,1,10,1,12,254,12,4,10,1,2,1,14,
-    1,12,1,4,2,14,1,6,3,4,1,4,255,16,2,8,
-    128,2,1,12,1,18,1,14,1,8,2,2,1,18,255,8,
-    128,2,254,2,247,255,128,122,25,83,111,117,114,99,101,70,
-    105,108,101,76,111,97,100,101,114,46,115,101,116,95,100,97,
-    116,97,78,41,7,114,150,0,0,0,114,149,0,0,0,114,
-    151,0,0,0,114,152,0,0,0,114,252,0,0,0,114,254,
-    0,0,0,114,253,0,0,0,114,7,0,0,0,114,7,0,
-    0,0,114,7,0,0,0,114,8,0,0,0,114,34,1,0,
-    0,59,4,0,0,115,12,0,0,0,8,0,4,2,8,2,
-    8,5,18,5,255,128,114,34,1,0,0,99,0,0,0,0,
-    0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,
-    64,0,0,0,115,32,0,0,0,101,0,90,1,100,0,90,
-    2,100,1,90,3,100,2,100,3,132,0,90,4,100,4,100,
-    5,132,0,90,5,100,6,83,0,41,7,218,20,83,111,117,
-    114,99,101,108,101,115,115,70,105,108,101,76,111,97,100,101,
-    114,122,45,76,111,97,100,101,114,32,119,104,105,99,104,32,
-    104,97,110,100,108,101,115,32,115,111,117,114,99,101,108,101,
-    115,115,32,102,105,108,101,32,105,109,112,111,114,116,115,46,
-    99,2,0,0,0,0,0,0,0,0,0,0,0,5,0,0,
-    0,5,0,0,0,67,0,0,0,115,68,0,0,0,124,0,
-    160,0,124,1,161,1,125,2,124,0,160,1,124,2,161,1,
-    125,3,124,1,124,2,100,1,156,2,125,4,116,2,124,3,
-    124,1,124,4,131,3,1,0,116,3,116,4,124,3,131,1,
-    100,2,100,0,133,2,25,0,124,1,124,2,100,3,141,3,
-    83,0,41,4,78,114,183,0,0,0,114,169,0,0,0,41,
-    2,114,141,0,0,0,114,132,0,0,0,41,5,114,203,0,
-    0,0,114,255,0,0,0,114,176,0,0,0,114,189,0,0,
-    0,114,7,1,0,0,41,5,114,143,0,0,0,114,163,0,
-    0,0,114,65,0,0,0,114,41,0,0,0,114,175,0,0,
-    0,114,7,0,0,0,114,7,0,0,0,114,8,0,0,0,
-    114,241,0,0,0,108,4,0,0,115,24,0,0,0,10,1,
-    10,1,2,4,2,1,6,254,12,4,2,1,14,1,2,1,
-    2,1,6,253,255,128,122,29,83,111,117,114,99,101,108,101,
-    115,115,70,105,108,101,76,111,97,100,101,114,46,103,101,116,
-    95,99,111,100,101,99,2,0,0,0,0,0,0,0,0,0,
-    0,0,2,0,0,0,1,0,0,0,67,0,0,0,114,23,
-    0,0,0,41,2,122,39,82,101,116,117,114,110,32,78,111,
-    110,101,32,97,115,32,116,104,101,114,101,32,105,115,32,110,
-    111,32,115,111,117,114,99,101,32,99,111,100,101,46,78,114,
-    7,0,0,0,114,247,0,0,0,114,7,0,0,0,114,7,
-    0,0,0,114,8,0,0,0,114,1,1,0,0,124,4,0,
-    0,114,24,0,0,0,122,31,83,111,117,114,99,101,108,101,
-    115,115,70,105,108,101,76,111,97,100,101,114,46,103,101,116,
-    95,115,111,117,114,99,101,78,41,6,114,150,0,0,0,114,
-    149,0,0,0,114,151,0,0,0,114,152,0,0,0,114,241,
-    0,0,0,114,1,1,0,0,114,7,0,0,0,114,7,0,
-    0,0,114,7,0,0,0,114,8,0,0,0,114,41,1,0,
-    0,104,4,0,0,115,10,0,0,0,8,0,4,2,8,2,
-    12,16,255,128,114,41,1,0,0,99,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,0,0,0,3,0,0,0,64,0,
-    0,0,115,92,0,0,0,101,0,90,1,100,0,90,2,100,
-    1,90,3,100,2,100,3,132,0,90,4,100,4,100,5,132,
-    0,90,5,100,6,100,7,132,0,90,6,100,8,100,9,132,
-    0,90,7,100,10,100,11,132,0,90,8,100,12,100,13,132,
-    0,90,9,100,14,100,15,132,0,90,10,100,16,100,17,132,
-    0,90,11,101,12,100,18,100,19,132,0,131,1,90,13,100,
-    20,83,0,41,21,114,30,1,0,0,122,93,76,111,97,100,
-    101,114,32,102,111,114,32,101,120,116,101,110,115,105,111,110,
-    32,109,111,100,117,108,101,115,46,10,10,32,32,32,32,84,
-    104,101,32,99,111,110,115,116,114,117,99,116,111,114,32,105,
-    115,32,100,101,115,105,103,110,101,100,32,116,111,32,119,111,
-    114,107,32,119,105,116,104,32,70,105,108,101,70,105,110,100,
-    101,114,46,10,10,32,32,32,32,99,3,0,0,0,0,0,
-    0,0,0,0,0,0,3,0,0,0,2,0,0,0,67,0,
-    0,0,115,16,0,0,0,124,1,124,0,95,0,124,2,124,
-    0,95,1,100,0,83,0,114,69,0,0,0,114,183,0,0,
-    0,41,3,114,143,0,0,0,114,141,0,0,0,114,65,0,
-    0,0,114,7,0,0,0,114,7,0,0,0,114,8,0,0,
-    0,114,236,0,0,0,137,4,0,0,115,6,0,0,0,6,
-    1,10,1,255,128,122,28,69,120,116,101,110,115,105,111,110,
-    70,105,108,101,76,111,97,100,101,114,46,95,95,105,110,105,
-    116,95,95,99,2,0,0,0,0,0,0,0,0,0,0,0,
-    2,0,0,0,2,0,0,0,67,0,0,0,114,12,1,0,
-    0,114,69,0,0,0,114,13,1,0,0,114,15,1,0,0,
-    114,7,0,0,0,114,7,0,0,0,114,8,0,0,0,114,
-    16,1,0,0,141,4,0,0,114,17,1,0,0,122,26,69,
-    120,116,101,110,115,105,111,110,70,105,108,101,76,111,97,100,
-    101,114,46,95,95,101,113,95,95,99,1,0,0,0,0,0,
-    0,0,0,0,0,0,1,0,0,0,3,0,0,0,67,0,
-    0,0,114,18,1,0,0,114,69,0,0,0,114,19,1,0,
-    0,114,21,1,0,0,114,7,0,0,0,114,7,0,0,0,
-    114,8,0,0,0,114,22,1,0,0,145,4,0,0,114,23,
-    1,0,0,122,28,69,120,116,101,110,115,105,111,110,70,105,
-    108,101,76,111,97,100,101,114,46,95,95,104,97,115,104,95,
-    95,99,2,0,0,0,0,0,0,0,0,0,0,0,3,0,
-    0,0,5,0,0,0,67,0,0,0,115,36,0,0,0,116,
-    0,160,1,116,2,106,3,124,1,161,2,125,2,116,0,160,
-    4,100,1,124,1,106,5,124,0,106,6,161,3,1,0,124,
-    2,83,0,41,3,122,38,67,114,101,97,116,101,32,97,110,
-    32,117,110,105,116,105,97,108,105,122,101,100,32,101,120,116,
-    101,110,115,105,111,110,32,109,111,100,117,108,101,122,38,101,
-    120,116,101,110,115,105,111,110,32,109,111,100,117,108,101,32,
-    123,33,114,125,32,108,111,97,100,101,100,32,102,114,111,109,
-    32,123,33,114,125,78,41,7,114,159,0,0,0,114,242,0,
-    0,0,114,187,0,0,0,90,14,99,114,101,97,116,101,95,
-    100,121,110,97,109,105,99,114,173,0,0,0,114,141,0,0,
-    0,114,65,0,0,0,41,3,114,143,0,0,0,114,210,0,
-    0,0,114,244,0,0,0,114,7,0,0,0,114,7,0,0,
-    0,114,8,0,0,0,114,239,0,0,0,148,4,0,0,115,
-    16,0,0,0,4,2,6,1,4,255,6,2,8,1,4,255,
-    4,2,255,128,122,33,69,120,116,101,110,115,105,111,110,70,
-    105,108,101,76,111,97,100,101,114,46,99,114,101,97,116,101,
-    95,109,111,100,117,108,101,99,2,0,0,0,0,0,0,0,
-    0,0,0,0,2,0,0,0,5,0,0,0,67,0,0,0,
-    115,36,0,0,0,116,0,160,1,116,2,106,3,124,1,161,
-    2,1,0,116,0,160,4,100,1,124,0,106,5,124,0,106,
-    6,161,3,1,0,100,2,83,0,41,3,122,30,73,110,105,
+    123,125,3,10,109,101,109,111,114,121,118,105,101,119,3,21,
+    99,104,101,99,107,95,104,97,115,104,95,98,97,115,101,100,
+    95,112,121,99,115,3,17,95,82,65,87,95,77,65,71,73,
+    67,95,78,85,77,66,69,82,3,19,100,111,110,116,95,119,
+    114,105,116,101,95,98,121,116,101,99,111,100,101,3,10,104,
+    97,115,104,95,98,97,115,101,100,3,12,99,104,101,99,107,
+    95,115,111,117,114,99,101,3,2,115,116,3,10,98,121,116,
+    101,115,95,100,97,116,97,3,11,99,111,100,101,95,111,98,
+    106,101,99,116,2,21,83,111,117,114,99,101,76,111,97,100,
+    101,114,46,103,101,116,95,99,111,100,101,3,10,70,105,108,
+    101,76,111,97,100,101,114,2,103,66,97,115,101,32,102,105,
+    108,101,32,108,111,97,100,101,114,32,99,108,97,115,115,32,
+    119,104,105,99,104,32,105,109,112,108,101,109,101,110,116,115,
+    32,116,104,101,32,108,111,97,100,101,114,32,112,114,111,116,
+    111,99,111,108,32,109,101,116,104,111,100,115,32,116,104,97,
+    116,10,32,32,32,32,114,101,113,117,105,114,101,32,102,105,
+    108,101,32,115,121,115,116,101,109,32,117,115,97,103,101,46,
+    2,75,67,97,99,104,101,32,116,104,101,32,109,111,100,117,
+    108,101,32,110,97,109,101,32,97,110,100,32,116,104,101,32,
+    112,97,116,104,32,116,111,32,116,104,101,32,102,105,108,101,
+    32,102,111,117,110,100,32,98,121,32,116,104,101,10,32,32,
+    32,32,32,32,32,32,102,105,110,100,101,114,46,2,19,70,
+    105,108,101,76,111,97,100,101,114,46,95,95,105,110,105,116,
+    95,95,3,9,95,95,99,108,97,115,115,95,95,3,5,111,
+    116,104,101,114,3,6,95,95,101,113,95,95,2,17,70,105,
+    108,101,76,111,97,100,101,114,46,95,95,101,113,95,95,3,
+    4,104,97,115,104,3,8,95,95,104,97,115,104,95,95,2,
+    19,70,105,108,101,76,111,97,100,101,114,46,95,95,104,97,
+    115,104,95,95,2,100,76,111,97,100,32,97,32,109,111,100,
+    117,108,101,32,102,114,111,109,32,97,32,102,105,108,101,46,
+    10,10,32,32,32,32,32,32,32,32,84,104,105,115,32,109,
+    101,116,104,111,100,32,105,115,32,100,101,112,114,101,99,97,
+    116,101,100,46,32,32,85,115,101,32,101,120,101,99,95,109,
+    111,100,117,108,101,40,41,32,105,110,115,116,101,97,100,46,
+    10,10,32,32,32,32,32,32,32,32,3,5,115,117,112,101,
+    114,2,22,70,105,108,101,76,111,97,100,101,114,46,108,111,
+    97,100,95,109,111,100,117,108,101,2,58,82,101,116,117,114,
+    110,32,116,104,101,32,112,97,116,104,32,116,111,32,116,104,
+    101,32,115,111,117,114,99,101,32,102,105,108,101,32,97,115,
+    32,102,111,117,110,100,32,98,121,32,116,104,101,32,102,105,
+    110,100,101,114,46,2,23,70,105,108,101,76,111,97,100,101,
+    114,46,103,101,116,95,102,105,108,101,110,97,109,101,2,39,
+    82,101,116,117,114,110,32,116,104,101,32,100,97,116,97,32,
+    102,114,111,109,32,112,97,116,104,32,97,115,32,114,97,119,
+    32,98,121,116,101,115,46,3,1,114,3,19,69,120,116,101,
+    110,115,105,111,110,70,105,108,101,76,111,97,100,101,114,3,
+    9,111,112,101,110,95,99,111,100,101,3,4,114,101,97,100,
+    2,19,70,105,108,101,76,111,97,100,101,114,46,103,101,116,
+    95,100,97,116,97,3,10,70,105,108,101,82,101,97,100,101,
+    114,3,17,105,109,112,111,114,116,108,105,98,46,114,101,97,
+    100,101,114,115,3,19,103,101,116,95,114,101,115,111,117,114,
+    99,101,95,114,101,97,100,101,114,2,30,70,105,108,101,76,
+    111,97,100,101,114,46,103,101,116,95,114,101,115,111,117,114,
+    99,101,95,114,101,97,100,101,114,3,13,95,95,99,108,97,
+    115,115,99,101,108,108,95,95,3,16,83,111,117,114,99,101,
+    70,105,108,101,76,111,97,100,101,114,2,62,67,111,110,99,
+    114,101,116,101,32,105,109,112,108,101,109,101,110,116,97,116,
+    105,111,110,32,111,102,32,83,111,117,114,99,101,76,111,97,
+    100,101,114,32,117,115,105,110,103,32,116,104,101,32,102,105,
+    108,101,32,115,121,115,116,101,109,46,2,33,82,101,116,117,
+    114,110,32,116,104,101,32,109,101,116,97,100,97,116,97,32,
+    102,111,114,32,116,104,101,32,112,97,116,104,46,3,8,115,
+    116,95,109,116,105,109,101,3,7,115,116,95,115,105,122,101,
+    2,27,83,111,117,114,99,101,70,105,108,101,76,111,97,100,
+    101,114,46,112,97,116,104,95,115,116,97,116,115,3,5,95,
+    109,111,100,101,2,32,83,111,117,114,99,101,70,105,108,101,
+    76,111,97,100,101,114,46,95,99,97,99,104,101,95,98,121,
+    116,101,99,111,100,101,2,27,87,114,105,116,101,32,98,121,
+    116,101,115,32,100,97,116,97,32,116,111,32,97,32,102,105,
+    108,101,46,2,27,99,111,117,108,100,32,110,111,116,32,99,
+    114,101,97,116,101,32,123,33,114,125,58,32,123,33,114,125,
+    2,12,99,114,101,97,116,101,100,32,123,33,114,125,3,8,
+    114,101,118,101,114,115,101,100,3,5,109,107,100,105,114,3,
+    15,70,105,108,101,69,120,105,115,116,115,69,114,114,111,114,
+    3,6,112,97,114,101,110,116,2,25,83,111,117,114,99,101,
+    70,105,108,101,76,111,97,100,101,114,46,115,101,116,95,100,
+    97,116,97,3,20,83,111,117,114,99,101,108,101,115,115,70,
+    105,108,101,76,111,97,100,101,114,2,45,76,111,97,100,101,
+    114,32,119,104,105,99,104,32,104,97,110,100,108,101,115,32,
+    115,111,117,114,99,101,108,101,115,115,32,102,105,108,101,32,
+    105,109,112,111,114,116,115,46,2,29,83,111,117,114,99,101,
+    108,101,115,115,70,105,108,101,76,111,97,100,101,114,46,103,
+    101,116,95,99,111,100,101,2,39,82,101,116,117,114,110,32,
+    78,111,110,101,32,97,115,32,116,104,101,114,101,32,105,115,
+    32,110,111,32,115,111,117,114,99,101,32,99,111,100,101,46,
+    2,31,83,111,117,114,99,101,108,101,115,115,70,105,108,101,
+    76,111,97,100,101,114,46,103,101,116,95,115,111,117,114,99,
+    101,2,93,76,111,97,100,101,114,32,102,111,114,32,101,120,
+    116,101,110,115,105,111,110,32,109,111,100,117,108,101,115,46,
+    10,10,32,32,32,32,84,104,101,32,99,111,110,115,116,114,
+    117,99,116,111,114,32,105,115,32,100,101,115,105,103,110,101,
+    100,32,116,111,32,119,111,114,107,32,119,105,116,104,32,70,
+    105,108,101,70,105,110,100,101,114,46,10,10,32,32,32,32,
+    2,28,69,120,116,101,110,115,105,111,110,70,105,108,101,76,
+    111,97,100,101,114,46,95,95,105,110,105,116,95,95,2,26,
+    69,120,116,101,110,115,105,111,110,70,105,108,101,76,111,97,
+    100,101,114,46,95,95,101,113,95,95,2,28,69,120,116,101,
+    110,115,105,111,110,70,105,108,101,76,111,97,100,101,114,46,
+    95,95,104,97,115,104,95,95,2,38,67,114,101,97,116,101,
+    32,97,110,32,117,110,105,116,105,97,108,105,122,101,100,32,
+    101,120,116,101,110,115,105,111,110,32,109,111,100,117,108,101,
+    2,38,101,120,116,101,110,115,105,111,110,32,109,111,100,117,
+    108,101,32,123,33,114,125,32,108,111,97,100,101,100,32,102,
+    114,111,109,32,123,33,114,125,3,14,99,114,101,97,116,101,
+    95,100,121,110,97,109,105,99,2,33,69,120,116,101,110,115,
+    105,111,110,70,105,108,101,76,111,97,100,101,114,46,99,114,
+    101,97,116,101,95,109,111,100,117,108,101,2,30,73,110,105,
     116,105,97,108,105,122,101,32,97,110,32,101,120,116,101,110,
-    115,105,111,110,32,109,111,100,117,108,101,122,40,101,120,116,
+    115,105,111,110,32,109,111,100,117,108,101,2,40,101,120,116,
     101,110,115,105,111,110,32,109,111,100,117,108,101,32,123,33,
     114,125,32,101,120,101,99,117,116,101,100,32,102,114,111,109,
-    32,123,33,114,125,78,41,7,114,159,0,0,0,114,242,0,
-    0,0,114,187,0,0,0,90,12,101,120,101,99,95,100,121,
-    110,97,109,105,99,114,173,0,0,0,114,141,0,0,0,114,
-    65,0,0,0,169,2,114,143,0,0,0,114,244,0,0,0,
-    114,7,0,0,0,114,7,0,0,0,114,8,0,0,0,114,
-    245,0,0,0,156,4,0,0,115,10,0,0,0,14,2,6,
-    1,8,1,8,255,255,128,122,31,69,120,116,101,110,115,105,
-    111,110,70,105,108,101,76,111,97,100,101,114,46,101,120,101,
-    99,95,109,111,100,117,108,101,99,2,0,0,0,0,0,0,
-    0,0,0,0,0,2,0,0,0,4,0,0,0,3,0,0,
-    0,115,36,0,0,0,116,0,124,0,106,1,131,1,100,1,
-    25,0,137,0,116,2,135,0,102,1,100,2,100,3,132,8,
-    116,3,68,0,131,1,131,1,83,0,41,5,122,49,82,101,
-    116,117,114,110,32,84,114,117,101,32,105,102,32,116,104,101,
-    32,101,120,116,101,110,115,105,111,110,32,109,111,100,117,108,
-    101,32,105,115,32,97,32,112,97,99,107,97,103,101,46,114,
-    3,0,0,0,99,1,0,0,0,0,0,0,0,0,0,0,
-    0,2,0,0,0,4,0,0,0,51,0,0,0,115,28,0,
-    0,0,129,0,124,0,93,9,125,1,136,0,100,0,124,1,
-    23,0,107,2,86,0,1,0,113,2,100,1,83,0,41,2,
-    114,236,0,0,0,78,114,7,0,0,0,169,2,114,5,0,
-    0,0,218,6,115,117,102,102,105,120,169,1,90,9,102,105,
-    108,101,95,110,97,109,101,114,7,0,0,0,114,8,0,0,
-    0,114,9,0,0,0,165,4,0,0,115,8,0,0,0,6,
-    128,2,1,20,255,255,128,122,49,69,120,116,101,110,115,105,
-    111,110,70,105,108,101,76,111,97,100,101,114,46,105,115,95,
-    112,97,99,107,97,103,101,46,60,108,111,99,97,108,115,62,
-    46,60,103,101,110,101,120,112,114,62,78,41,4,114,74,0,
-    0,0,114,65,0,0,0,218,3,97,110,121,114,232,0,0,
-    0,114,247,0,0,0,114,7,0,0,0,114,45,1,0,0,
-    114,8,0,0,0,114,206,0,0,0,162,4,0,0,115,10,
-    0,0,0,14,2,12,1,2,1,8,255,255,128,122,30,69,
-    120,116,101,110,115,105,111,110,70,105,108,101,76,111,97,100,
-    101,114,46,105,115,95,112,97,99,107,97,103,101,99,2,0,
-    0,0,0,0,0,0,0,0,0,0,2,0,0,0,1,0,
-    0,0,67,0,0,0,114,23,0,0,0,41,2,122,63,82,
-    101,116,117,114,110,32,78,111,110,101,32,97,115,32,97,110,
-    32,101,120,116,101,110,115,105,111,110,32,109,111,100,117,108,
-    101,32,99,97,110,110,111,116,32,99,114,101,97,116,101,32,
-    97,32,99,111,100,101,32,111,98,106,101,99,116,46,78,114,
-    7,0,0,0,114,247,0,0,0,114,7,0,0,0,114,7,
-    0,0,0,114,8,0,0,0,114,241,0,0,0,168,4,0,
-    0,114,24,0,0,0,122,28,69,120,116,101,110,115,105,111,
-    110,70,105,108,101,76,111,97,100,101,114,46,103,101,116,95,
-    99,111,100,101,99,2,0,0,0,0,0,0,0,0,0,0,
-    0,2,0,0,0,1,0,0,0,67,0,0,0,114,23,0,
-    0,0,41,2,122,53,82,101,116,117,114,110,32,78,111,110,
-    101,32,97,115,32,101,120,116,101,110,115,105,111,110,32,109,
-    111,100,117,108,101,115,32,104,97,118,101,32,110,111,32,115,
-    111,117,114,99,101,32,99,111,100,101,46,78,114,7,0,0,
-    0,114,247,0,0,0,114,7,0,0,0,114,7,0,0,0,
-    114,8,0,0,0,114,1,1,0,0,172,4,0,0,114,24,
-    0,0,0,122,30,69,120,116,101,110,115,105,111,110,70,105,
-    108,101,76,111,97,100,101,114,46,103,101,116,95,115,111,117,
-    114,99,101,99,2,0,0,0,0,0,0,0,0,0,0,0,
-    2,0,0,0,1,0,0,0,67,0,0,0,114,26,1,0,
-    0,114,27,1,0,0,114,71,0,0,0,114,247,0,0,0,
-    114,7,0,0,0,114,7,0,0,0,114,8,0,0,0,114,
-    203,0,0,0,176,4,0,0,114,28,1,0,0,122,32,69,
-    120,116,101,110,115,105,111,110,70,105,108,101,76,111,97,100,
-    101,114,46,103,101,116,95,102,105,108,101,110,97,109,101,78,
-    41,14,114,150,0,0,0,114,149,0,0,0,114,151,0,0,
-    0,114,152,0,0,0,114,236,0,0,0,114,16,1,0,0,
-    114,22,1,0,0,114,239,0,0,0,114,245,0,0,0,114,
-    206,0,0,0,114,241,0,0,0,114,1,1,0,0,114,160,
-    0,0,0,114,203,0,0,0,114,7,0,0,0,114,7,0,
-    0,0,114,7,0,0,0,114,8,0,0,0,114,30,1,0,
-    0,129,4,0,0,115,26,0,0,0,8,0,4,2,8,6,
-    8,4,8,4,8,3,8,8,8,6,8,6,8,4,2,4,
-    14,1,255,128,114,30,1,0,0,99,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,0,0,0,2,0,0,0,64,0,
-    0,0,115,104,0,0,0,101,0,90,1,100,0,90,2,100,
-    1,90,3,100,2,100,3,132,0,90,4,100,4,100,5,132,
-    0,90,5,100,6,100,7,132,0,90,6,100,8,100,9,132,
-    0,90,7,100,10,100,11,132,0,90,8,100,12,100,13,132,
-    0,90,9,100,14,100,15,132,0,90,10,100,16,100,17,132,
-    0,90,11,100,18,100,19,132,0,90,12,100,20,100,21,132,
-    0,90,13,100,22,100,23,132,0,90,14,100,24,83,0,41,
-    25,218,14,95,78,97,109,101,115,112,97,99,101,80,97,116,
-    104,97,38,1,0,0,82,101,112,114,101,115,101,110,116,115,
-    32,97,32,110,97,109,101,115,112,97,99,101,32,112,97,99,
-    107,97,103,101,39,115,32,112,97,116,104,46,32,32,73,116,
-    32,117,115,101,115,32,116,104,101,32,109,111,100,117,108,101,
-    32,110,97,109,101,10,32,32,32,32,116,111,32,102,105,110,
-    100,32,105,116,115,32,112,97,114,101,110,116,32,109,111,100,
-    117,108,101,44,32,97,110,100,32,102,114,111,109,32,116,104,
-    101,114,101,32,105,116,32,108,111,111,107,115,32,117,112,32,
-    116,104,101,32,112,97,114,101,110,116,39,115,10,32,32,32,
-    32,95,95,112,97,116,104,95,95,46,32,32,87,104,101,110,
-    32,116,104,105,115,32,99,104,97,110,103,101,115,44,32,116,
-    104,101,32,109,111,100,117,108,101,39,115,32,111,119,110,32,
-    112,97,116,104,32,105,115,32,114,101,99,111,109,112,117,116,
-    101,100,44,10,32,32,32,32,117,115,105,110,103,32,112,97,
-    116,104,95,102,105,110,100,101,114,46,32,32,70,111,114,32,
-    116,111,112,45,108,101,118,101,108,32,109,111,100,117,108,101,
-    115,44,32,116,104,101,32,112,97,114,101,110,116,32,109,111,
-    100,117,108,101,39,115,32,112,97,116,104,10,32,32,32,32,
-    105,115,32,115,121,115,46,112,97,116,104,46,99,4,0,0,
-    0,0,0,0,0,0,0,0,0,4,0,0,0,3,0,0,
-    0,67,0,0,0,115,36,0,0,0,124,1,124,0,95,0,
-    124,2,124,0,95,1,116,2,124,0,160,3,161,0,131,1,
-    124,0,95,4,124,3,124,0,95,5,100,0,83,0,114,69,
-    0,0,0,41,6,218,5,95,110,97,109,101,218,5,95,112,
-    97,116,104,114,136,0,0,0,218,16,95,103,101,116,95,112,
-    97,114,101,110,116,95,112,97,116,104,218,17,95,108,97,115,
-    116,95,112,97,114,101,110,116,95,112,97,116,104,218,12,95,
-    112,97,116,104,95,102,105,110,100,101,114,169,4,114,143,0,
-    0,0,114,141,0,0,0,114,65,0,0,0,90,11,112,97,
-    116,104,95,102,105,110,100,101,114,114,7,0,0,0,114,7,
-    0,0,0,114,8,0,0,0,114,236,0,0,0,189,4,0,
-    0,115,10,0,0,0,6,1,6,1,14,1,10,1,255,128,
-    122,23,95,78,97,109,101,115,112,97,99,101,80,97,116,104,
-    46,95,95,105,110,105,116,95,95,99,1,0,0,0,0,0,
-    0,0,0,0,0,0,4,0,0,0,3,0,0,0,67,0,
-    0,0,115,38,0,0,0,124,0,106,0,160,1,100,1,161,
-    1,92,3,125,1,125,2,125,3,124,2,100,2,107,2,114,
-    15,100,3,83,0,124,1,100,4,102,2,83,0,41,6,122,
-    62,82,101,116,117,114,110,115,32,97,32,116,117,112,108,101,
-    32,111,102,32,40,112,97,114,101,110,116,45,109,111,100,117,
-    108,101,45,110,97,109,101,44,32,112,97,114,101,110,116,45,
-    112,97,116,104,45,97,116,116,114,45,110,97,109,101,41,114,
-    97,0,0,0,114,10,0,0,0,41,2,114,15,0,0,0,
-    114,65,0,0,0,90,8,95,95,112,97,116,104,95,95,78,
-    41,2,114,48,1,0,0,114,104,0,0,0,41,4,114,143,
-    0,0,0,114,40,1,0,0,218,3,100,111,116,90,2,109,
-    101,114,7,0,0,0,114,7,0,0,0,114,8,0,0,0,
-    218,23,95,102,105,110,100,95,112,97,114,101,110,116,95,112,
-    97,116,104,95,110,97,109,101,115,195,4,0,0,115,10,0,
-    0,0,18,2,8,1,4,2,8,3,255,128,122,38,95,78,
-    97,109,101,115,112,97,99,101,80,97,116,104,46,95,102,105,
-    110,100,95,112,97,114,101,110,116,95,112,97,116,104,95,110,
-    97,109,101,115,99,1,0,0,0,0,0,0,0,0,0,0,
-    0,3,0,0,0,3,0,0,0,67,0,0,0,115,28,0,
-    0,0,124,0,160,0,161,0,92,2,125,1,125,2,116,1,
-    116,2,106,3,124,1,25,0,124,2,131,2,83,0,114,69,
-    0,0,0,41,4,114,55,1,0,0,114,155,0,0,0,114,
-    15,0,0,0,218,7,109,111,100,117,108,101,115,41,3,114,
-    143,0,0,0,90,18,112,97,114,101,110,116,95,109,111,100,
-    117,108,101,95,110,97,109,101,90,14,112,97,116,104,95,97,
-    116,116,114,95,110,97,109,101,114,7,0,0,0,114,7,0,
-    0,0,114,8,0,0,0,114,50,1,0,0,205,4,0,0,
-    115,6,0,0,0,12,1,16,1,255,128,122,31,95,78,97,
+    32,123,33,114,125,3,12,101,120,101,99,95,100,121,110,97,
+    109,105,99,2,31,69,120,116,101,110,115,105,111,110,70,105,
+    108,101,76,111,97,100,101,114,46,101,120,101,99,95,109,111,
+    100,117,108,101,2,49,82,101,116,117,114,110,32,84,114,117,
+    101,32,105,102,32,116,104,101,32,101,120,116,101,110,115,105,
+    111,110,32,109,111,100,117,108,101,32,105,115,32,97,32,112,
+    97,99,107,97,103,101,46,3,6,115,117,102,102,105,120,3,
+    9,102,105,108,101,95,110,97,109,101,2,49,69,120,116,101,
+    110,115,105,111,110,70,105,108,101,76,111,97,100,101,114,46,
+    105,115,95,112,97,99,107,97,103,101,46,60,108,111,99,97,
+    108,115,62,46,60,103,101,110,101,120,112,114,62,3,3,97,
+    110,121,2,30,69,120,116,101,110,115,105,111,110,70,105,108,
+    101,76,111,97,100,101,114,46,105,115,95,112,97,99,107,97,
+    103,101,2,63,82,101,116,117,114,110,32,78,111,110,101,32,
+    97,115,32,97,110,32,101,120,116,101,110,115,105,111,110,32,
+    109,111,100,117,108,101,32,99,97,110,110,111,116,32,99,114,
+    101,97,116,101,32,97,32,99,111,100,101,32,111,98,106,101,
+    99,116,46,2,28,69,120,116,101,110,115,105,111,110,70,105,
+    108,101,76,111,97,100,101,114,46,103,101,116,95,99,111,100,
+    101,2,53,82,101,116,117,114,110,32,78,111,110,101,32,97,
+    115,32,101,120,116,101,110,115,105,111,110,32,109,111,100,117,
+    108,101,115,32,104,97,118,101,32,110,111,32,115,111,117,114,
+    99,101,32,99,111,100,101,46,2,30,69,120,116,101,110,115,
+    105,111,110,70,105,108,101,76,111,97,100,101,114,46,103,101,
+    116,95,115,111,117,114,99,101,2,32,69,120,116,101,110,115,
+    105,111,110,70,105,108,101,76,111,97,100,101,114,46,103,101,
+    116,95,102,105,108,101,110,97,109,101,3,14,95,78,97,109,
+    101,115,112,97,99,101,80,97,116,104,2,166,2,82,101,112,
+    114,101,115,101,110,116,115,32,97,32,110,97,109,101,115,112,
+    97,99,101,32,112,97,99,107,97,103,101,39,115,32,112,97,
+    116,104,46,32,32,73,116,32,117,115,101,115,32,116,104,101,
+    32,109,111,100,117,108,101,32,110,97,109,101,10,32,32,32,
+    32,116,111,32,102,105,110,100,32,105,116,115,32,112,97,114,
+    101,110,116,32,109,111,100,117,108,101,44,32,97,110,100,32,
+    102,114,111,109,32,116,104,101,114,101,32,105,116,32,108,111,
+    111,107,115,32,117,112,32,116,104,101,32,112,97,114,101,110,
+    116,39,115,10,32,32,32,32,95,95,112,97,116,104,95,95,
+    46,32,32,87,104,101,110,32,116,104,105,115,32,99,104,97,
+    110,103,101,115,44,32,116,104,101,32,109,111,100,117,108,101,
+    39,115,32,111,119,110,32,112,97,116,104,32,105,115,32,114,
+    101,99,111,109,112,117,116,101,100,44,10,32,32,32,32,117,
+    115,105,110,103,32,112,97,116,104,95,102,105,110,100,101,114,
+    46,32,32,70,111,114,32,116,111,112,45,108,101,118,101,108,
+    32,109,111,100,117,108,101,115,44,32,116,104,101,32,112,97,
+    114,101,110,116,32,109,111,100,117,108,101,39,115,32,112,97,
+    116,104,10,32,32,32,32,105,115,32,115,121,115,46,112,97,
+    116,104,46,3,5,95,110,97,109,101,3,5,95,112,97,116,
+    104,3,16,95,103,101,116,95,112,97,114,101,110,116,95,112,
+    97,116,104,3,17,95,108,97,115,116,95,112,97,114,101,110,
+    116,95,112,97,116,104,3,12,95,112,97,116,104,95,102,105,
+    110,100,101,114,3,11,112,97,116,104,95,102,105,110,100,101,
+    114,2,23,95,78,97,109,101,115,112,97,99,101,80,97,116,
+    104,46,95,95,105,110,105,116,95,95,2,62,82,101,116,117,
+    114,110,115,32,97,32,116,117,112,108,101,32,111,102,32,40,
+    112,97,114,101,110,116,45,109,111,100,117,108,101,45,110,97,
+    109,101,44,32,112,97,114,101,110,116,45,112,97,116,104,45,
+    97,116,116,114,45,110,97,109,101,41,3,8,95,95,112,97,
+    116,104,95,95,3,3,100,111,116,3,2,109,101,3,23,95,
+    102,105,110,100,95,112,97,114,101,110,116,95,112,97,116,104,
+    95,110,97,109,101,115,2,38,95,78,97,109,101,115,112,97,
+    99,101,80,97,116,104,46,95,102,105,110,100,95,112,97,114,
+    101,110,116,95,112,97,116,104,95,110,97,109,101,115,3,7,
+    109,111,100,117,108,101,115,3,18,112,97,114,101,110,116,95,
+    109,111,100,117,108,101,95,110,97,109,101,3,14,112,97,116,
+    104,95,97,116,116,114,95,110,97,109,101,2,31,95,78,97,
     109,101,115,112,97,99,101,80,97,116,104,46,95,103,101,116,
-    95,112,97,114,101,110,116,95,112,97,116,104,99,1,0,0,
-    0,0,0,0,0,0,0,0,0,3,0,0,0,4,0,0,
-    0,67,0,0,0,115,80,0,0,0,116,0,124,0,160,1,
-    161,0,131,1,125,1,124,1,124,0,106,2,107,3,114,37,
-    124,0,160,3,124,0,106,4,124,1,161,2,125,2,124,2,
-    100,0,117,1,114,34,124,2,106,5,100,0,117,0,114,34,
-    124,2,106,6,114,34,124,2,106,6,124,0,95,7,124,1,
-    124,0,95,2,124,0,106,7,83,0,114,69,0,0,0,41,
-    8,114,136,0,0,0,114,50,1,0,0,114,51,1,0,0,
-    114,52,1,0,0,114,48,1,0,0,114,164,0,0,0,114,
-    202,0,0,0,114,49,1,0,0,41,3,114,143,0,0,0,
-    90,11,112,97,114,101,110,116,95,112,97,116,104,114,210,0,
-    0,0,114,7,0,0,0,114,7,0,0,0,114,8,0,0,
-    0,218,12,95,114,101,99,97,108,99,117,108,97,116,101,209,
-    4,0,0,115,18,0,0,0,12,2,10,1,14,1,18,3,
-    6,1,8,1,6,1,6,1,255,128,122,27,95,78,97,109,
-    101,115,112,97,99,101,80,97,116,104,46,95,114,101,99,97,
-    108,99,117,108,97,116,101,99,1,0,0,0,0,0,0,0,
-    0,0,0,0,1,0,0,0,3,0,0,0,67,0,0,0,
-    243,12,0,0,0,116,0,124,0,160,1,161,0,131,1,83,
-    0,114,69,0,0,0,41,2,218,4,105,116,101,114,114,57,
-    1,0,0,114,21,1,0,0,114,7,0,0,0,114,7,0,
-    0,0,114,8,0,0,0,218,8,95,95,105,116,101,114,95,
-    95,222,4,0,0,243,4,0,0,0,12,1,255,128,122,23,
-    95,78,97,109,101,115,112,97,99,101,80,97,116,104,46,95,
-    95,105,116,101,114,95,95,99,2,0,0,0,0,0,0,0,
-    0,0,0,0,2,0,0,0,2,0,0,0,67,0,0,0,
-    115,12,0,0,0,124,0,160,0,161,0,124,1,25,0,83,
-    0,114,69,0,0,0,169,1,114,57,1,0,0,41,2,114,
-    143,0,0,0,218,5,105,110,100,101,120,114,7,0,0,0,
-    114,7,0,0,0,114,8,0,0,0,218,11,95,95,103,101,
-    116,105,116,101,109,95,95,225,4,0,0,114,61,1,0,0,
-    122,26,95,78,97,109,101,115,112,97,99,101,80,97,116,104,
-    46,95,95,103,101,116,105,116,101,109,95,95,99,3,0,0,
-    0,0,0,0,0,0,0,0,0,3,0,0,0,3,0,0,
-    0,67,0,0,0,115,14,0,0,0,124,2,124,0,106,0,
-    124,1,60,0,100,0,83,0,114,69,0,0,0,41,1,114,
-    49,1,0,0,41,3,114,143,0,0,0,114,63,1,0,0,
-    114,65,0,0,0,114,7,0,0,0,114,7,0,0,0,114,
-    8,0,0,0,218,11,95,95,115,101,116,105,116,101,109,95,
-    95,228,4,0,0,115,4,0,0,0,14,1,255,128,122,26,
-    95,78,97,109,101,115,112,97,99,101,80,97,116,104,46,95,
-    95,115,101,116,105,116,101,109,95,95,99,1,0,0,0,0,
-    0,0,0,0,0,0,0,1,0,0,0,3,0,0,0,67,
-    0,0,0,114,58,1,0,0,114,69,0,0,0,41,2,114,
-    4,0,0,0,114,57,1,0,0,114,21,1,0,0,114,7,
-    0,0,0,114,7,0,0,0,114,8,0,0,0,218,7,95,
-    95,108,101,110,95,95,231,4,0,0,114,61,1,0,0,122,
+    95,112,97,114,101,110,116,95,112,97,116,104,3,11,112,97,
+    114,101,110,116,95,112,97,116,104,3,12,95,114,101,99,97,
+    108,99,117,108,97,116,101,2,27,95,78,97,109,101,115,112,
+    97,99,101,80,97,116,104,46,95,114,101,99,97,108,99,117,
+    108,97,116,101,3,4,105,116,101,114,3,8,95,95,105,116,
+    101,114,95,95,2,23,95,78,97,109,101,115,112,97,99,101,
+    80,97,116,104,46,95,95,105,116,101,114,95,95,3,5,105,
+    110,100,101,120,3,11,95,95,103,101,116,105,116,101,109,95,
+    95,2,26,95,78,97,109,101,115,112,97,99,101,80,97,116,
+    104,46,95,95,103,101,116,105,116,101,109,95,95,3,11,95,
+    95,115,101,116,105,116,101,109,95,95,2,26,95,78,97,109,
+    101,115,112,97,99,101,80,97,116,104,46,95,95,115,101,116,
+    105,116,101,109,95,95,3,7,95,95,108,101,110,95,95,2,
     22,95,78,97,109,101,115,112,97,99,101,80,97,116,104,46,
-    95,95,108,101,110,95,95,99,1,0,0,0,0,0,0,0,
-    0,0,0,0,1,0,0,0,3,0,0,0,67,0,0,0,
-    243,12,0,0,0,100,1,160,0,124,0,106,1,161,1,83,
-    0,41,2,78,122,20,95,78,97,109,101,115,112,97,99,101,
-    80,97,116,104,40,123,33,114,125,41,41,2,114,89,0,0,
-    0,114,49,1,0,0,114,21,1,0,0,114,7,0,0,0,
-    114,7,0,0,0,114,8,0,0,0,218,8,95,95,114,101,
-    112,114,95,95,234,4,0,0,114,61,1,0,0,122,23,95,
-    78,97,109,101,115,112,97,99,101,80,97,116,104,46,95,95,
-    114,101,112,114,95,95,99,2,0,0,0,0,0,0,0,0,
-    0,0,0,2,0,0,0,3,0,0,0,67,0,0,0,115,
-    12,0,0,0,124,1,124,0,160,0,161,0,118,0,83,0,
-    114,69,0,0,0,114,62,1,0,0,169,2,114,143,0,0,
-    0,218,4,105,116,101,109,114,7,0,0,0,114,7,0,0,
-    0,114,8,0,0,0,218,12,95,95,99,111,110,116,97,105,
-    110,115,95,95,237,4,0,0,114,61,1,0,0,122,27,95,
-    78,97,109,101,115,112,97,99,101,80,97,116,104,46,95,95,
-    99,111,110,116,97,105,110,115,95,95,99,2,0,0,0,0,
-    0,0,0,0,0,0,0,2,0,0,0,3,0,0,0,67,
-    0,0,0,115,16,0,0,0,124,0,106,0,160,1,124,1,
-    161,1,1,0,100,0,83,0,114,69,0,0,0,41,2,114,
-    49,1,0,0,114,61,0,0,0,114,69,1,0,0,114,7,
-    0,0,0,114,7,0,0,0,114,8,0,0,0,114,61,0,
-    0,0,240,4,0,0,243,4,0,0,0,16,1,255,128,122,
-    21,95,78,97,109,101,115,112,97,99,101,80,97,116,104,46,
-    97,112,112,101,110,100,78,41,15,114,150,0,0,0,114,149,
-    0,0,0,114,151,0,0,0,114,152,0,0,0,114,236,0,
-    0,0,114,55,1,0,0,114,50,1,0,0,114,57,1,0,
-    0,114,60,1,0,0,114,64,1,0,0,114,65,1,0,0,
-    114,66,1,0,0,114,68,1,0,0,114,71,1,0,0,114,
-    61,0,0,0,114,7,0,0,0,114,7,0,0,0,114,7,
-    0,0,0,114,8,0,0,0,114,47,1,0,0,182,4,0,
-    0,115,28,0,0,0,8,0,4,1,8,6,8,6,8,10,
-    8,4,8,13,8,3,8,3,8,3,8,3,8,3,12,3,
-    255,128,114,47,1,0,0,99,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,0,3,0,0,0,64,0,0,0,
-    115,88,0,0,0,101,0,90,1,100,0,90,2,100,1,100,
-    2,132,0,90,3,101,4,100,3,100,4,132,0,131,1,90,
-    5,100,5,100,6,132,0,90,6,100,7,100,8,132,0,90,
-    7,100,9,100,10,132,0,90,8,100,11,100,12,132,0,90,
-    9,100,13,100,14,132,0,90,10,100,15,100,16,132,0,90,
-    11,100,17,100,18,132,0,90,12,100,19,83,0,41,20,218,
-    16,95,78,97,109,101,115,112,97,99,101,76,111,97,100,101,
-    114,99,4,0,0,0,0,0,0,0,0,0,0,0,4,0,
-    0,0,4,0,0,0,67,0,0,0,115,18,0,0,0,116,
-    0,124,1,124,2,124,3,131,3,124,0,95,1,100,0,83,
-    0,114,69,0,0,0,41,2,114,47,1,0,0,114,49,1,
-    0,0,114,53,1,0,0,114,7,0,0,0,114,7,0,0,
-    0,114,8,0,0,0,114,236,0,0,0,246,4,0,0,115,
-    4,0,0,0,18,1,255,128,122,25,95,78,97,109,101,115,
-    112,97,99,101,76,111,97,100,101,114,46,95,95,105,110,105,
-    116,95,95,99,1,0,0,0,0,0,0,0,0,0,0,0,
-    1,0,0,0,4,0,0,0,67,0,0,0,115,24,0,0,
-    0,116,0,160,1,100,1,116,2,161,2,1,0,100,2,160,
-    3,124,0,106,4,161,1,83,0,41,4,122,115,82,101,116,
-    117,114,110,32,114,101,112,114,32,102,111,114,32,116,104,101,
-    32,109,111,100,117,108,101,46,10,10,32,32,32,32,32,32,
-    32,32,84,104,101,32,109,101,116,104,111,100,32,105,115,32,
-    100,101,112,114,101,99,97,116,101,100,46,32,32,84,104,101,
-    32,105,109,112,111,114,116,32,109,97,99,104,105,110,101,114,
-    121,32,100,111,101,115,32,116,104,101,32,106,111,98,32,105,
-    116,115,101,108,102,46,10,10,32,32,32,32,32,32,32,32,
-    122,82,95,78,97,109,101,115,112,97,99,101,76,111,97,100,
-    101,114,46,109,111,100,117,108,101,95,114,101,112,114,40,41,
-    32,105,115,32,100,101,112,114,101,99,97,116,101,100,32,97,
-    110,100,32,115,108,97,116,101,100,32,102,111,114,32,114,101,
-    109,111,118,97,108,32,105,110,32,80,121,116,104,111,110,32,
-    51,46,49,50,122,25,60,109,111,100,117,108,101,32,123,33,
-    114,125,32,40,110,97,109,101,115,112,97,99,101,41,62,78,
-    41,5,114,99,0,0,0,114,100,0,0,0,114,101,0,0,
-    0,114,89,0,0,0,114,150,0,0,0,41,1,114,244,0,
-    0,0,114,7,0,0,0,114,7,0,0,0,114,8,0,0,
-    0,218,11,109,111,100,117,108,101,95,114,101,112,114,249,4,
-    0,0,115,10,0,0,0,6,7,2,1,4,255,12,2,255,
-    128,122,28,95,78,97,109,101,115,112,97,99,101,76,111,97,
-    100,101,114,46,109,111,100,117,108,101,95,114,101,112,114,99,
-    2,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,
-    1,0,0,0,67,0,0,0,114,23,0,0,0,41,2,78,
-    84,114,7,0,0,0,114,247,0,0,0,114,7,0,0,0,
-    114,7,0,0,0,114,8,0,0,0,114,206,0,0,0,4,
-    5,0,0,243,4,0,0,0,4,1,255,128,122,27,95,78,
-    97,109,101,115,112,97,99,101,76,111,97,100,101,114,46,105,
-    115,95,112,97,99,107,97,103,101,99,2,0,0,0,0,0,
-    0,0,0,0,0,0,2,0,0,0,1,0,0,0,67,0,
-    0,0,114,23,0,0,0,41,2,78,114,10,0,0,0,114,
-    7,0,0,0,114,247,0,0,0,114,7,0,0,0,114,7,
-    0,0,0,114,8,0,0,0,114,1,1,0,0,7,5,0,
-    0,114,75,1,0,0,122,27,95,78,97,109,101,115,112,97,
-    99,101,76,111,97,100,101,114,46,103,101,116,95,115,111,117,
-    114,99,101,99,2,0,0,0,0,0,0,0,0,0,0,0,
-    2,0,0,0,6,0,0,0,67,0,0,0,115,16,0,0,
-    0,116,0,100,1,100,2,100,3,100,4,100,5,141,4,83,
-    0,41,6,78,114,10,0,0,0,122,8,60,115,116,114,105,
-    110,103,62,114,243,0,0,0,84,41,1,114,3,1,0,0,
-    41,1,114,4,1,0,0,114,247,0,0,0,114,7,0,0,
-    0,114,7,0,0,0,114,8,0,0,0,114,241,0,0,0,
-    10,5,0,0,114,72,1,0,0,122,25,95,78,97,109,101,
-    115,112,97,99,101,76,111,97,100,101,114,46,103,101,116,95,
-    99,111,100,101,99,2,0,0,0,0,0,0,0,0,0,0,
-    0,2,0,0,0,1,0,0,0,67,0,0,0,114,23,0,
-    0,0,114,237,0,0,0,114,7,0,0,0,114,238,0,0,
-    0,114,7,0,0,0,114,7,0,0,0,114,8,0,0,0,
-    114,239,0,0,0,13,5,0,0,114,240,0,0,0,122,30,
-    95,78,97,109,101,115,112,97,99,101,76,111,97,100,101,114,
-    46,99,114,101,97,116,101,95,109,111,100,117,108,101,99,2,
-    0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,1,
-    0,0,0,67,0,0,0,115,4,0,0,0,100,0,83,0,
-    114,69,0,0,0,114,7,0,0,0,114,42,1,0,0,114,
-    7,0,0,0,114,7,0,0,0,114,8,0,0,0,114,245,
-    0,0,0,16,5,0,0,114,75,1,0,0,122,28,95,78,
-    97,109,101,115,112,97,99,101,76,111,97,100,101,114,46,101,
-    120,101,99,95,109,111,100,117,108,101,99,2,0,0,0,0,
-    0,0,0,0,0,0,0,2,0,0,0,4,0,0,0,67,
-    0,0,0,115,26,0,0,0,116,0,160,1,100,1,124,0,
-    106,2,161,2,1,0,116,0,160,3,124,0,124,1,161,2,
-    83,0,41,3,122,98,76,111,97,100,32,97,32,110,97,109,
-    101,115,112,97,99,101,32,109,111,100,117,108,101,46,10,10,
-    32,32,32,32,32,32,32,32,84,104,105,115,32,109,101,116,
-    104,111,100,32,105,115,32,100,101,112,114,101,99,97,116,101,
-    100,46,32,32,85,115,101,32,101,120,101,99,95,109,111,100,
-    117,108,101,40,41,32,105,110,115,116,101,97,100,46,10,10,
-    32,32,32,32,32,32,32,32,122,38,110,97,109,101,115,112,
-    97,99,101,32,109,111,100,117,108,101,32,108,111,97,100,101,
-    100,32,119,105,116,104,32,112,97,116,104,32,123,33,114,125,
-    78,41,4,114,159,0,0,0,114,173,0,0,0,114,49,1,
-    0,0,114,246,0,0,0,114,247,0,0,0,114,7,0,0,
-    0,114,7,0,0,0,114,8,0,0,0,114,248,0,0,0,
-    19,5,0,0,115,10,0,0,0,6,7,4,1,4,255,12,
-    3,255,128,122,28,95,78,97,109,101,115,112,97,99,101,76,
-    111,97,100,101,114,46,108,111,97,100,95,109,111,100,117,108,
-    101,99,2,0,0,0,0,0,0,0,0,0,0,0,3,0,
-    0,0,2,0,0,0,67,0,0,0,115,22,0,0,0,100,
-    1,100,2,108,0,109,1,125,2,1,0,124,2,124,0,106,
-    2,131,1,83,0,41,3,78,114,0,0,0,0,41,1,218,
-    15,78,97,109,101,115,112,97,99,101,82,101,97,100,101,114,
-    41,3,114,32,1,0,0,114,76,1,0,0,114,49,1,0,
-    0,41,3,114,143,0,0,0,114,244,0,0,0,114,76,1,
-    0,0,114,7,0,0,0,114,7,0,0,0,114,8,0,0,
-    0,114,33,1,0,0,31,5,0,0,115,6,0,0,0,12,
-    1,10,1,255,128,122,36,95,78,97,109,101,115,112,97,99,
-    101,76,111,97,100,101,114,46,103,101,116,95,114,101,115,111,
-    117,114,99,101,95,114,101,97,100,101,114,78,41,13,114,150,
-    0,0,0,114,149,0,0,0,114,151,0,0,0,114,236,0,
-    0,0,114,233,0,0,0,114,74,1,0,0,114,206,0,0,
-    0,114,1,1,0,0,114,241,0,0,0,114,239,0,0,0,
-    114,245,0,0,0,114,248,0,0,0,114,33,1,0,0,114,
-    7,0,0,0,114,7,0,0,0,114,7,0,0,0,114,8,
-    0,0,0,114,73,1,0,0,245,4,0,0,115,24,0,0,
-    0,8,0,8,1,2,3,10,1,8,10,8,3,8,3,8,
-    3,8,3,8,3,12,12,255,128,114,73,1,0,0,99,0,
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,
-    0,0,0,64,0,0,0,115,118,0,0,0,101,0,90,1,
-    100,0,90,2,100,1,90,3,101,4,100,2,100,3,132,0,
-    131,1,90,5,101,4,100,4,100,5,132,0,131,1,90,6,
-    101,7,100,6,100,7,132,0,131,1,90,8,101,7,100,8,
-    100,9,132,0,131,1,90,9,101,7,100,19,100,11,100,12,
-    132,1,131,1,90,10,101,7,100,20,100,13,100,14,132,1,
-    131,1,90,11,101,7,100,19,100,15,100,16,132,1,131,1,
-    90,12,101,4,100,17,100,18,132,0,131,1,90,13,100,10,
-    83,0,41,21,218,10,80,97,116,104,70,105,110,100,101,114,
-    122,62,77,101,116,97,32,112,97,116,104,32,102,105,110,100,
-    101,114,32,102,111,114,32,115,121,115,46,112,97,116,104,32,
-    97,110,100,32,112,97,99,107,97,103,101,32,95,95,112,97,
-    116,104,95,95,32,97,116,116,114,105,98,117,116,101,115,46,
-    99,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,
-    0,4,0,0,0,67,0,0,0,115,64,0,0,0,116,0,
-    116,1,106,2,160,3,161,0,131,1,68,0,93,22,92,2,
-    125,0,125,1,124,1,100,1,117,0,114,20,116,1,106,2,
-    124,0,61,0,113,7,116,4,124,1,100,2,131,2,114,29,
-    124,1,160,5,161,0,1,0,113,7,100,1,83,0,41,3,
-    122,125,67,97,108,108,32,116,104,101,32,105,110,118,97,108,
-    105,100,97,116,101,95,99,97,99,104,101,115,40,41,32,109,
-    101,116,104,111,100,32,111,110,32,97,108,108,32,112,97,116,
-    104,32,101,110,116,114,121,32,102,105,110,100,101,114,115,10,
-    32,32,32,32,32,32,32,32,115,116,111,114,101,100,32,105,
-    110,32,115,121,115,46,112,97,116,104,95,105,109,112,111,114,
-    116,101,114,95,99,97,99,104,101,115,32,40,119,104,101,114,
-    101,32,105,109,112,108,101,109,101,110,116,101,100,41,46,78,
-    218,17,105,110,118,97,108,105,100,97,116,101,95,99,97,99,
-    104,101,115,41,6,218,4,108,105,115,116,114,15,0,0,0,
-    218,19,112,97,116,104,95,105,109,112,111,114,116,101,114,95,
-    99,97,99,104,101,218,5,105,116,101,109,115,114,153,0,0,
-    0,114,78,1,0,0,41,2,114,141,0,0,0,218,6,102,
-    105,110,100,101,114,114,7,0,0,0,114,7,0,0,0,114,
-    8,0,0,0,114,78,1,0,0,42,5,0,0,115,16,0,
-    0,0,22,4,8,1,10,1,10,1,8,1,2,128,4,252,
-    255,128,122,28,80,97,116,104,70,105,110,100,101,114,46,105,
+    95,95,108,101,110,95,95,2,20,95,78,97,109,101,115,112,
+    97,99,101,80,97,116,104,40,123,33,114,125,41,3,8,95,
+    95,114,101,112,114,95,95,2,23,95,78,97,109,101,115,112,
+    97,99,101,80,97,116,104,46,95,95,114,101,112,114,95,95,
+    3,4,105,116,101,109,3,12,95,95,99,111,110,116,97,105,
+    110,115,95,95,2,27,95,78,97,109,101,115,112,97,99,101,
+    80,97,116,104,46,95,95,99,111,110,116,97,105,110,115,95,
+    95,2,21,95,78,97,109,101,115,112,97,99,101,80,97,116,
+    104,46,97,112,112,101,110,100,3,16,95,78,97,109,101,115,
+    112,97,99,101,76,111,97,100,101,114,2,25,95,78,97,109,
+    101,115,112,97,99,101,76,111,97,100,101,114,46,95,95,105,
+    110,105,116,95,95,2,115,82,101,116,117,114,110,32,114,101,
+    112,114,32,102,111,114,32,116,104,101,32,109,111,100,117,108,
+    101,46,10,10,32,32,32,32,32,32,32,32,84,104,101,32,
+    109,101,116,104,111,100,32,105,115,32,100,101,112,114,101,99,
+    97,116,101,100,46,32,32,84,104,101,32,105,109,112,111,114,
+    116,32,109,97,99,104,105,110,101,114,121,32,100,111,101,115,
+    32,116,104,101,32,106,111,98,32,105,116,115,101,108,102,46,
+    10,10,32,32,32,32,32,32,32,32,2,82,95,78,97,109,
+    101,115,112,97,99,101,76,111,97,100,101,114,46,109,111,100,
+    117,108,101,95,114,101,112,114,40,41,32,105,115,32,100,101,
+    112,114,101,99,97,116,101,100,32,97,110,100,32,115,108,97,
+    116,101,100,32,102,111,114,32,114,101,109,111,118,97,108,32,
+    105,110,32,80,121,116,104,111,110,32,51,46,49,50,2,25,
+    60,109,111,100,117,108,101,32,123,33,114,125,32,40,110,97,
+    109,101,115,112,97,99,101,41,62,3,11,109,111,100,117,108,
+    101,95,114,101,112,114,2,28,95,78,97,109,101,115,112,97,
+    99,101,76,111,97,100,101,114,46,109,111,100,117,108,101,95,
+    114,101,112,114,2,27,95,78,97,109,101,115,112,97,99,101,
+    76,111,97,100,101,114,46,105,115,95,112,97,99,107,97,103,
+    101,2,27,95,78,97,109,101,115,112,97,99,101,76,111,97,
+    100,101,114,46,103,101,116,95,115,111,117,114,99,101,2,8,
+    60,115,116,114,105,110,103,62,2,25,95,78,97,109,101,115,
+    112,97,99,101,76,111,97,100,101,114,46,103,101,116,95,99,
+    111,100,101,2,30,95,78,97,109,101,115,112,97,99,101,76,
+    111,97,100,101,114,46,99,114,101,97,116,101,95,109,111,100,
+    117,108,101,2,28,95,78,97,109,101,115,112,97,99,101,76,
+    111,97,100,101,114,46,101,120,101,99,95,109,111,100,117,108,
+    101,2,98,76,111,97,100,32,97,32,110,97,109,101,115,112,
+    97,99,101,32,109,111,100,117,108,101,46,10,10,32,32,32,
+    32,32,32,32,32,84,104,105,115,32,109,101,116,104,111,100,
+    32,105,115,32,100,101,112,114,101,99,97,116,101,100,46,32,
+    32,85,115,101,32,101,120,101,99,95,109,111,100,117,108,101,
+    40,41,32,105,110,115,116,101,97,100,46,10,10,32,32,32,
+    32,32,32,32,32,2,38,110,97,109,101,115,112,97,99,101,
+    32,109,111,100,117,108,101,32,108,111,97,100,101,100,32,119,
+    105,116,104,32,112,97,116,104,32,123,33,114,125,2,28,95,
+    78,97,109,101,115,112,97,99,101,76,111,97,100,101,114,46,
+    108,111,97,100,95,109,111,100,117,108,101,3,15,78,97,109,
+    101,115,112,97,99,101,82,101,97,100,101,114,2,36,95,78,
+    97,109,101,115,112,97,99,101,76,111,97,100,101,114,46,103,
+    101,116,95,114,101,115,111,117,114,99,101,95,114,101,97,100,
+    101,114,3,10,80,97,116,104,70,105,110,100,101,114,2,62,
+    77,101,116,97,32,112,97,116,104,32,102,105,110,100,101,114,
+    32,102,111,114,32,115,121,115,46,112,97,116,104,32,97,110,
+    100,32,112,97,99,107,97,103,101,32,95,95,112,97,116,104,
+    95,95,32,97,116,116,114,105,98,117,116,101,115,46,2,125,
+    67,97,108,108,32,116,104,101,32,105,110,118,97,108,105,100,
+    97,116,101,95,99,97,99,104,101,115,40,41,32,109,101,116,
+    104,111,100,32,111,110,32,97,108,108,32,112,97,116,104,32,
+    101,110,116,114,121,32,102,105,110,100,101,114,115,10,32,32,
+    32,32,32,32,32,32,115,116,111,114,101,100,32,105,110,32,
+    115,121,115,46,112,97,116,104,95,105,109,112,111,114,116,101,
+    114,95,99,97,99,104,101,115,32,40,119,104,101,114,101,32,
+    105,109,112,108,101,109,101,110,116,101,100,41,46,3,17,105,
     110,118,97,108,105,100,97,116,101,95,99,97,99,104,101,115,
-    99,1,0,0,0,0,0,0,0,0,0,0,0,2,0,0,
-    0,9,0,0,0,67,0,0,0,115,76,0,0,0,116,0,
-    106,1,100,1,117,1,114,14,116,0,106,1,115,14,116,2,
-    160,3,100,2,116,4,161,2,1,0,116,0,106,1,68,0,
-    93,17,125,1,122,7,124,1,124,0,131,1,87,0,2,0,
-    1,0,83,0,4,0,116,5,121,37,1,0,1,0,1,0,
-    89,0,113,17,100,1,83,0,119,0,41,3,122,46,83,101,
-    97,114,99,104,32,115,121,115,46,112,97,116,104,95,104,111,
-    111,107,115,32,102,111,114,32,97,32,102,105,110,100,101,114,
-    32,102,111,114,32,39,112,97,116,104,39,46,78,122,23,115,
-    121,115,46,112,97,116,104,95,104,111,111,107,115,32,105,115,
-    32,101,109,112,116,121,41,6,114,15,0,0,0,218,10,112,
-    97,116,104,95,104,111,111,107,115,114,99,0,0,0,114,100,
-    0,0,0,114,162,0,0,0,114,142,0,0,0,41,2,114,
-    65,0,0,0,90,4,104,111,111,107,114,7,0,0,0,114,
-    7,0,0,0,114,8,0,0,0,218,11,95,112,97,116,104,
-    95,104,111,111,107,115,52,5,0,0,115,20,0,0,0,16,
-    3,12,1,10,1,2,1,14,1,12,1,4,1,4,2,2,
-    253,255,128,122,22,80,97,116,104,70,105,110,100,101,114,46,
-    95,112,97,116,104,95,104,111,111,107,115,99,2,0,0,0,
-    0,0,0,0,0,0,0,0,3,0,0,0,8,0,0,0,
-    67,0,0,0,115,100,0,0,0,124,1,100,1,107,2,114,
-    20,122,6,116,0,160,1,161,0,125,1,87,0,110,9,4,
-    0,116,2,121,49,1,0,1,0,1,0,89,0,100,2,83,
-    0,122,8,116,3,106,4,124,1,25,0,125,2,87,0,124,
-    2,83,0,4,0,116,5,121,48,1,0,1,0,1,0,124,
-    0,160,6,124,1,161,1,125,2,124,2,116,3,106,4,124,
-    1,60,0,89,0,124,2,83,0,119,0,119,0,41,3,122,
-    210,71,101,116,32,116,104,101,32,102,105,110,100,101,114,32,
-    102,111,114,32,116,104,101,32,112,97,116,104,32,101,110,116,
-    114,121,32,102,114,111,109,32,115,121,115,46,112,97,116,104,
-    95,105,109,112,111,114,116,101,114,95,99,97,99,104,101,46,
-    10,10,32,32,32,32,32,32,32,32,73,102,32,116,104,101,
-    32,112,97,116,104,32,101,110,116,114,121,32,105,115,32,110,
-    111,116,32,105,110,32,116,104,101,32,99,97,99,104,101,44,
-    32,102,105,110,100,32,116,104,101,32,97,112,112,114,111,112,
-    114,105,97,116,101,32,102,105,110,100,101,114,10,32,32,32,
-    32,32,32,32,32,97,110,100,32,99,97,99,104,101,32,105,
-    116,46,32,73,102,32,110,111,32,102,105,110,100,101,114,32,
-    105,115,32,97,118,97,105,108,97,98,108,101,44,32,115,116,
-    111,114,101,32,78,111,110,101,46,10,10,32,32,32,32,32,
-    32,32,32,114,10,0,0,0,78,41,7,114,18,0,0,0,
-    114,82,0,0,0,218,17,70,105,108,101,78,111,116,70,111,
-    117,110,100,69,114,114,111,114,114,15,0,0,0,114,80,1,
-    0,0,218,8,75,101,121,69,114,114,111,114,114,84,1,0,
-    0,41,3,114,221,0,0,0,114,65,0,0,0,114,82,1,
-    0,0,114,7,0,0,0,114,7,0,0,0,114,8,0,0,
-    0,218,20,95,112,97,116,104,95,105,109,112,111,114,116,101,
-    114,95,99,97,99,104,101,65,5,0,0,115,30,0,0,0,
-    8,8,2,1,12,1,12,1,6,3,2,1,12,1,4,4,
-    12,253,10,1,12,1,4,1,2,253,2,250,255,128,122,31,
-    80,97,116,104,70,105,110,100,101,114,46,95,112,97,116,104,
-    95,105,109,112,111,114,116,101,114,95,99,97,99,104,101,99,
-    3,0,0,0,0,0,0,0,0,0,0,0,7,0,0,0,
-    4,0,0,0,67,0,0,0,115,138,0,0,0,116,0,124,
+    3,4,108,105,115,116,3,19,112,97,116,104,95,105,109,112,
+    111,114,116,101,114,95,99,97,99,104,101,3,5,105,116,101,
+    109,115,3,6,102,105,110,100,101,114,2,28,80,97,116,104,
+    70,105,110,100,101,114,46,105,110,118,97,108,105,100,97,116,
+    101,95,99,97,99,104,101,115,2,46,83,101,97,114,99,104,
+    32,115,121,115,46,112,97,116,104,95,104,111,111,107,115,32,
+    102,111,114,32,97,32,102,105,110,100,101,114,32,102,111,114,
+    32,39,112,97,116,104,39,46,2,23,115,121,115,46,112,97,
+    116,104,95,104,111,111,107,115,32,105,115,32,101,109,112,116,
+    121,3,10,112,97,116,104,95,104,111,111,107,115,3,4,104,
+    111,111,107,3,11,95,112,97,116,104,95,104,111,111,107,115,
+    2,22,80,97,116,104,70,105,110,100,101,114,46,95,112,97,
+    116,104,95,104,111,111,107,115,2,210,1,71,101,116,32,116,
+    104,101,32,102,105,110,100,101,114,32,102,111,114,32,116,104,
+    101,32,112,97,116,104,32,101,110,116,114,121,32,102,114,111,
+    109,32,115,121,115,46,112,97,116,104,95,105,109,112,111,114,
+    116,101,114,95,99,97,99,104,101,46,10,10,32,32,32,32,
+    32,32,32,32,73,102,32,116,104,101,32,112,97,116,104,32,
+    101,110,116,114,121,32,105,115,32,110,111,116,32,105,110,32,
+    116,104,101,32,99,97,99,104,101,44,32,102,105,110,100,32,
+    116,104,101,32,97,112,112,114,111,112,114,105,97,116,101,32,
+    102,105,110,100,101,114,10,32,32,32,32,32,32,32,32,97,
+    110,100,32,99,97,99,104,101,32,105,116,46,32,73,102,32,
+    110,111,32,102,105,110,100,101,114,32,105,115,32,97,118,97,
+    105,108,97,98,108,101,44,32,115,116,111,114,101,32,78,111,
+    110,101,46,10,10,32,32,32,32,32,32,32,32,3,17,70,
+    105,108,101,78,111,116,70,111,117,110,100,69,114,114,111,114,
+    3,8,75,101,121,69,114,114,111,114,3,20,95,112,97,116,
+    104,95,105,109,112,111,114,116,101,114,95,99,97,99,104,101,
+    2,31,80,97,116,104,70,105,110,100,101,114,46,95,112,97,
+    116,104,95,105,109,112,111,114,116,101,114,95,99,97,99,104,
+    101,2,53,46,102,105,110,100,95,115,112,101,99,40,41,32,
+    110,111,116,32,102,111,117,110,100,59,32,102,97,108,108,105,
+    110,103,32,98,97,99,107,32,116,111,32,102,105,110,100,95,
+    108,111,97,100,101,114,40,41,2,53,46,102,105,110,100,95,
+    115,112,101,99,40,41,32,110,111,116,32,102,111,117,110,100,
+    59,32,102,97,108,108,105,110,103,32,98,97,99,107,32,116,
+    111,32,102,105,110,100,95,109,111,100,117,108,101,40,41,3,
+    12,95,111,98,106,101,99,116,95,110,97,109,101,3,16,95,
+    108,101,103,97,99,121,95,103,101,116,95,115,112,101,99,2,
+    27,80,97,116,104,70,105,110,100,101,114,46,95,108,101,103,
+    97,99,121,95,103,101,116,95,115,112,101,99,2,63,70,105,
+    110,100,32,116,104,101,32,108,111,97,100,101,114,32,111,114,
+    32,110,97,109,101,115,112,97,99,101,95,112,97,116,104,32,
+    102,111,114,32,116,104,105,115,32,109,111,100,117,108,101,47,
+    112,97,99,107,97,103,101,32,110,97,109,101,46,2,19,115,
+    112,101,99,32,109,105,115,115,105,110,103,32,108,111,97,100,
+    101,114,3,5,98,121,116,101,115,3,14,110,97,109,101,115,
+    112,97,99,101,95,112,97,116,104,3,5,101,110,116,114,121,
+    3,9,95,103,101,116,95,115,112,101,99,2,20,80,97,116,
+    104,70,105,110,100,101,114,46,95,103,101,116,95,115,112,101,
+    99,2,141,1,84,114,121,32,116,111,32,102,105,110,100,32,
+    97,32,115,112,101,99,32,102,111,114,32,39,102,117,108,108,
+    110,97,109,101,39,32,111,110,32,115,121,115,46,112,97,116,
+    104,32,111,114,32,39,112,97,116,104,39,46,10,10,32,32,
+    32,32,32,32,32,32,84,104,101,32,115,101,97,114,99,104,
+    32,105,115,32,98,97,115,101,100,32,111,110,32,115,121,115,
+    46,112,97,116,104,95,104,111,111,107,115,32,97,110,100,32,
+    115,121,115,46,112,97,116,104,95,105,109,112,111,114,116,101,
+    114,95,99,97,99,104,101,46,10,32,32,32,32,32,32,32,
+    32,2,20,80,97,116,104,70,105,110,100,101,114,46,102,105,
+    110,100,95,115,112,101,99,2,170,1,102,105,110,100,32,116,
+    104,101,32,109,111,100,117,108,101,32,111,110,32,115,121,115,
+    46,112,97,116,104,32,111,114,32,39,112,97,116,104,39,32,
+    98,97,115,101,100,32,111,110,32,115,121,115,46,112,97,116,
+    104,95,104,111,111,107,115,32,97,110,100,10,32,32,32,32,
+    32,32,32,32,115,121,115,46,112,97,116,104,95,105,109,112,
+    111,114,116,101,114,95,99,97,99,104,101,46,10,10,32,32,
+    32,32,32,32,32,32,84,104,105,115,32,109,101,116,104,111,
+    100,32,105,115,32,100,101,112,114,101,99,97,116,101,100,46,
+    32,32,85,115,101,32,102,105,110,100,95,115,112,101,99,40,
+    41,32,105,110,115,116,101,97,100,46,10,10,32,32,32,32,
+    32,32,32,32,2,101,80,97,116,104,70,105,110,100,101,114,
+    46,102,105,110,100,95,109,111,100,117,108,101,40,41,32,105,
+    115,32,100,101,112,114,101,99,97,116,101,100,32,97,110,100,
+    32,115,108,97,116,101,100,32,102,111,114,32,114,101,109,111,
+    118,97,108,32,105,110,32,80,121,116,104,111,110,32,51,46,
+    49,50,59,32,117,115,101,32,102,105,110,100,95,115,112,101,
+    99,40,41,32,105,110,115,116,101,97,100,2,22,80,97,116,
+    104,70,105,110,100,101,114,46,102,105,110,100,95,109,111,100,
+    117,108,101,2,160,2,10,32,32,32,32,32,32,32,32,70,
+    105,110,100,32,100,105,115,116,114,105,98,117,116,105,111,110,
+    115,46,10,10,32,32,32,32,32,32,32,32,82,101,116,117,
+    114,110,32,97,110,32,105,116,101,114,97,98,108,101,32,111,
+    102,32,97,108,108,32,68,105,115,116,114,105,98,117,116,105,
+    111,110,32,105,110,115,116,97,110,99,101,115,32,99,97,112,
+    97,98,108,101,32,111,102,10,32,32,32,32,32,32,32,32,
+    108,111,97,100,105,110,103,32,116,104,101,32,109,101,116,97,
+    100,97,116,97,32,102,111,114,32,112,97,99,107,97,103,101,
+    115,32,109,97,116,99,104,105,110,103,32,96,96,99,111,110,
+    116,101,120,116,46,110,97,109,101,96,96,10,32,32,32,32,
+    32,32,32,32,40,111,114,32,97,108,108,32,110,97,109,101,
+    115,32,105,102,32,96,96,78,111,110,101,96,96,32,105,110,
+    100,105,99,97,116,101,100,41,32,97,108,111,110,103,32,116,
+    104,101,32,112,97,116,104,115,32,105,110,32,116,104,101,32,
+    108,105,115,116,10,32,32,32,32,32,32,32,32,111,102,32,
+    100,105,114,101,99,116,111,114,105,101,115,32,96,96,99,111,
+    110,116,101,120,116,46,112,97,116,104,96,96,46,10,32,32,
+    32,32,32,32,32,32,3,18,77,101,116,97,100,97,116,97,
+    80,97,116,104,70,105,110,100,101,114,3,18,105,109,112,111,
+    114,116,108,105,98,46,109,101,116,97,100,97,116,97,3,18,
+    102,105,110,100,95,100,105,115,116,114,105,98,117,116,105,111,
+    110,115,2,29,80,97,116,104,70,105,110,100,101,114,46,102,
+    105,110,100,95,100,105,115,116,114,105,98,117,116,105,111,110,
+    115,3,10,70,105,108,101,70,105,110,100,101,114,2,172,1,
+    70,105,108,101,45,98,97,115,101,100,32,102,105,110,100,101,
+    114,46,10,10,32,32,32,32,73,110,116,101,114,97,99,116,
+    105,111,110,115,32,119,105,116,104,32,116,104,101,32,102,105,
+    108,101,32,115,121,115,116,101,109,32,97,114,101,32,99,97,
+    99,104,101,100,32,102,111,114,32,112,101,114,102,111,114,109,
+    97,110,99,101,44,32,98,101,105,110,103,10,32,32,32,32,
+    114,101,102,114,101,115,104,101,100,32,119,104,101,110,32,116,
+    104,101,32,100,105,114,101,99,116,111,114,121,32,116,104,101,
+    32,102,105,110,100,101,114,32,105,115,32,104,97,110,100,108,
+    105,110,103,32,104,97,115,32,98,101,101,110,32,109,111,100,
+    105,102,105,101,100,46,10,10,32,32,32,32,2,154,1,73,
+    110,105,116,105,97,108,105,122,101,32,119,105,116,104,32,116,
+    104,101,32,112,97,116,104,32,116,111,32,115,101,97,114,99,
+    104,32,111,110,32,97,110,100,32,97,32,118,97,114,105,97,
+    98,108,101,32,110,117,109,98,101,114,32,111,102,10,32,32,
+    32,32,32,32,32,32,50,45,116,117,112,108,101,115,32,99,
+    111,110,116,97,105,110,105,110,103,32,116,104,101,32,108,111,
+    97,100,101,114,32,97,110,100,32,116,104,101,32,102,105,108,
+    101,32,115,117,102,102,105,120,101,115,32,116,104,101,32,108,
+    111,97,100,101,114,10,32,32,32,32,32,32,32,32,114,101,
+    99,111,103,110,105,122,101,115,46,2,38,70,105,108,101,70,
+    105,110,100,101,114,46,95,95,105,110,105,116,95,95,46,60,
+    108,111,99,97,108,115,62,46,60,103,101,110,101,120,112,114,
+    62,3,8,95,108,111,97,100,101,114,115,3,11,95,112,97,
+    116,104,95,109,116,105,109,101,3,3,115,101,116,3,11,95,
+    112,97,116,104,95,99,97,99,104,101,3,19,95,114,101,108,
+    97,120,101,100,95,112,97,116,104,95,99,97,99,104,101,3,
+    14,108,111,97,100,101,114,95,100,101,116,97,105,108,115,3,
+    7,108,111,97,100,101,114,115,2,19,70,105,108,101,70,105,
+    110,100,101,114,46,95,95,105,110,105,116,95,95,2,31,73,
+    110,118,97,108,105,100,97,116,101,32,116,104,101,32,100,105,
+    114,101,99,116,111,114,121,32,109,116,105,109,101,46,2,28,
+    70,105,108,101,70,105,110,100,101,114,46,105,110,118,97,108,
+    105,100,97,116,101,95,99,97,99,104,101,115,2,197,1,84,
+    114,121,32,116,111,32,102,105,110,100,32,97,32,108,111,97,
+    100,101,114,32,102,111,114,32,116,104,101,32,115,112,101,99,
+    105,102,105,101,100,32,109,111,100,117,108,101,44,32,111,114,
+    32,116,104,101,32,110,97,109,101,115,112,97,99,101,10,32,
+    32,32,32,32,32,32,32,112,97,99,107,97,103,101,32,112,
+    111,114,116,105,111,110,115,46,32,82,101,116,117,114,110,115,
+    32,40,108,111,97,100,101,114,44,32,108,105,115,116,45,111,
+    102,45,112,111,114,116,105,111,110,115,41,46,10,10,32,32,
+    32,32,32,32,32,32,84,104,105,115,32,109,101,116,104,111,
+    100,32,105,115,32,100,101,112,114,101,99,97,116,101,100,46,
+    32,32,85,115,101,32,102,105,110,100,95,115,112,101,99,40,
+    41,32,105,110,115,116,101,97,100,46,10,10,32,32,32,32,
+    32,32,32,32,2,101,70,105,108,101,70,105,110,100,101,114,
+    46,102,105,110,100,95,108,111,97,100,101,114,40,41,32,105,
+    115,32,100,101,112,114,101,99,97,116,101,100,32,97,110,100,
+    32,115,108,97,116,101,100,32,102,111,114,32,114,101,109,111,
+    118,97,108,32,105,110,32,80,121,116,104,111,110,32,51,46,
+    49,50,59,32,117,115,101,32,102,105,110,100,95,115,112,101,
+    99,40,41,32,105,110,115,116,101,97,100,2,22,70,105,108,
+    101,70,105,110,100,101,114,46,102,105,110,100,95,108,111,97,
+    100,101,114,3,4,115,109,115,108,2,20,70,105,108,101,70,
+    105,110,100,101,114,46,95,103,101,116,95,115,112,101,99,2,
+    111,84,114,121,32,116,111,32,102,105,110,100,32,97,32,115,
+    112,101,99,32,102,111,114,32,116,104,101,32,115,112,101,99,
+    105,102,105,101,100,32,109,111,100,117,108,101,46,10,10,32,
+    32,32,32,32,32,32,32,82,101,116,117,114,110,115,32,116,
+    104,101,32,109,97,116,99,104,105,110,103,32,115,112,101,99,
+    44,32,111,114,32,78,111,110,101,32,105,102,32,110,111,116,
+    32,102,111,117,110,100,46,10,32,32,32,32,32,32,32,32,
+    2,9,116,114,121,105,110,103,32,123,125,3,9,118,101,114,
+    98,111,115,105,116,121,2,25,112,111,115,115,105,98,108,101,
+    32,110,97,109,101,115,112,97,99,101,32,102,111,114,32,123,
+    125,3,11,95,102,105,108,108,95,99,97,99,104,101,3,12,
+    105,115,95,110,97,109,101,115,112,97,99,101,3,11,116,97,
+    105,108,95,109,111,100,117,108,101,3,5,99,97,99,104,101,
+    3,12,99,97,99,104,101,95,109,111,100,117,108,101,3,9,
+    98,97,115,101,95,112,97,116,104,3,13,105,110,105,116,95,
+    102,105,108,101,110,97,109,101,3,9,102,117,108,108,95,112,
+    97,116,104,2,20,70,105,108,101,70,105,110,100,101,114,46,
+    102,105,110,100,95,115,112,101,99,2,68,70,105,108,108,32,
+    116,104,101,32,99,97,99,104,101,32,111,102,32,112,111,116,
+    101,110,116,105,97,108,32,109,111,100,117,108,101,115,32,97,
+    110,100,32,112,97,99,107,97,103,101,115,32,102,111,114,32,
+    116,104,105,115,32,100,105,114,101,99,116,111,114,121,46,3,
+    2,102,110,2,41,70,105,108,101,70,105,110,100,101,114,46,
+    95,102,105,108,108,95,99,97,99,104,101,46,60,108,111,99,
+    97,108,115,62,46,60,115,101,116,99,111,109,112,62,3,7,
+    108,105,115,116,100,105,114,3,15,80,101,114,109,105,115,115,
+    105,111,110,69,114,114,111,114,3,18,78,111,116,65,68,105,
+    114,101,99,116,111,114,121,69,114,114,111,114,3,3,97,100,
+    100,3,8,99,111,110,116,101,110,116,115,3,21,108,111,119,
+    101,114,95,115,117,102,102,105,120,95,99,111,110,116,101,110,
+    116,115,3,8,110,101,119,95,110,97,109,101,2,22,70,105,
+    108,101,70,105,110,100,101,114,46,95,102,105,108,108,95,99,
+    97,99,104,101,2,148,2,65,32,99,108,97,115,115,32,109,
+    101,116,104,111,100,32,119,104,105,99,104,32,114,101,116,117,
+    114,110,115,32,97,32,99,108,111,115,117,114,101,32,116,111,
+    32,117,115,101,32,111,110,32,115,121,115,46,112,97,116,104,
+    95,104,111,111,107,10,32,32,32,32,32,32,32,32,119,104,
+    105,99,104,32,119,105,108,108,32,114,101,116,117,114,110,32,
+    97,110,32,105,110,115,116,97,110,99,101,32,117,115,105,110,
+    103,32,116,104,101,32,115,112,101,99,105,102,105,101,100,32,
+    108,111,97,100,101,114,115,32,97,110,100,32,116,104,101,32,
+    112,97,116,104,10,32,32,32,32,32,32,32,32,99,97,108,
+    108,101,100,32,111,110,32,116,104,101,32,99,108,111,115,117,
+    114,101,46,10,10,32,32,32,32,32,32,32,32,73,102,32,
+    116,104,101,32,112,97,116,104,32,99,97,108,108,101,100,32,
+    111,110,32,116,104,101,32,99,108,111,115,117,114,101,32,105,
+    115,32,110,111,116,32,97,32,100,105,114,101,99,116,111,114,
+    121,44,32,73,109,112,111,114,116,69,114,114,111,114,32,105,
+    115,10,32,32,32,32,32,32,32,32,114,97,105,115,101,100,
+    46,10,10,32,32,32,32,32,32,32,32,2,45,80,97,116,
+    104,32,104,111,111,107,32,102,111,114,32,105,109,112,111,114,
+    116,108,105,98,46,109,97,99,104,105,110,101,114,121,46,70,
+    105,108,101,70,105,110,100,101,114,46,2,30,111,110,108,121,
+    32,100,105,114,101,99,116,111,114,105,101,115,32,97,114,101,
+    32,115,117,112,112,111,114,116,101,100,3,24,112,97,116,104,
+    95,104,111,111,107,95,102,111,114,95,70,105,108,101,70,105,
+    110,100,101,114,2,54,70,105,108,101,70,105,110,100,101,114,
+    46,112,97,116,104,95,104,111,111,107,46,60,108,111,99,97,
+    108,115,62,46,112,97,116,104,95,104,111,111,107,95,102,111,
+    114,95,70,105,108,101,70,105,110,100,101,114,3,9,112,97,
+    116,104,95,104,111,111,107,2,20,70,105,108,101,70,105,110,
+    100,101,114,46,112,97,116,104,95,104,111,111,107,2,16,70,
+    105,108,101,70,105,110,100,101,114,40,123,33,114,125,41,2,
+    19,70,105,108,101,70,105,110,100,101,114,46,95,95,114,101,
+    112,114,95,95,3,10,95,95,108,111,97,100,101,114,95,95,
+    3,8,95,95,115,112,101,99,95,95,3,8,95,95,102,105,
+    108,101,95,95,3,10,95,95,99,97,99,104,101,100,95,95,
+    3,3,103,101,116,3,9,69,120,99,101,112,116,105,111,110,
+    3,2,110,115,3,8,112,97,116,104,110,97,109,101,3,9,
+    99,112,97,116,104,110,97,109,101,3,14,95,102,105,120,95,
+    117,112,95,109,111,100,117,108,101,2,95,82,101,116,117,114,
+    110,115,32,97,32,108,105,115,116,32,111,102,32,102,105,108,
+    101,45,98,97,115,101,100,32,109,111,100,117,108,101,32,108,
+    111,97,100,101,114,115,46,10,10,32,32,32,32,69,97,99,
+    104,32,105,116,101,109,32,105,115,32,97,32,116,117,112,108,
+    101,32,40,108,111,97,100,101,114,44,32,115,117,102,102,105,
+    120,101,115,41,46,10,32,32,32,32,3,18,101,120,116,101,
+    110,115,105,111,110,95,115,117,102,102,105,120,101,115,3,10,
+    101,120,116,101,110,115,105,111,110,115,3,6,115,111,117,114,
+    99,101,3,8,98,121,116,101,99,111,100,101,3,17,95,98,
+    111,111,116,115,116,114,97,112,95,109,111,100,117,108,101,3,
+    21,95,115,101,116,95,98,111,111,116,115,116,114,97,112,95,
+    109,111,100,117,108,101,2,41,73,110,115,116,97,108,108,32,
+    116,104,101,32,112,97,116,104,45,98,97,115,101,100,32,105,
+    109,112,111,114,116,32,99,111,109,112,111,110,101,110,116,115,
+    46,3,9,109,101,116,97,95,112,97,116,104,3,17,115,117,
+    112,112,111,114,116,101,100,95,108,111,97,100,101,114,115,3,
+    8,95,105,110,115,116,97,108,108,3,2,110,116,3,5,112,
+    111,115,105,120,3,3,97,108,108,3,20,95,112,97,116,104,
+    115,101,112,115,95,119,105,116,104,95,99,111,108,111,110,3,
+    37,95,67,65,83,69,95,73,78,83,69,78,83,73,84,73,
+    86,69,95,80,76,65,84,70,79,82,77,83,95,66,89,84,
+    69,83,95,75,69,89,3,4,116,121,112,101,3,8,95,95,
+    99,111,100,101,95,95,3,23,68,69,66,85,71,95,66,89,
+    84,69,67,79,68,69,95,83,85,70,70,73,88,69,83,3,
+    27,79,80,84,73,77,73,90,69,68,95,66,89,84,69,67,
+    79,68,69,95,83,85,70,70,73,88,69,83,3,6,111,98,
+    106,101,99,116,3,8,60,109,111,100,117,108,101,62,67,0,
+    0,0,0,10,128,1,115,250,2,0,0,100,0,90,0,100,
+    1,97,1,100,2,100,1,108,2,90,2,100,2,100,1,108,
+    3,90,3,100,2,100,1,108,4,90,4,100,2,100,1,108,
+    5,90,5,100,2,100,1,108,6,90,6,101,4,106,7,100,
+    3,107,2,90,8,101,8,114,40,100,2,100,1,108,9,90,
+    10,100,2,100,1,108,11,90,11,110,4,100,2,100,1,108,
+    12,90,10,101,8,114,51,100,4,100,5,103,2,90,13,110,
+    3,100,5,103,1,90,13,101,14,100,6,100,7,132,0,101,
+    13,68,0,131,1,131,1,115,65,74,0,130,1,101,13,100,
+    2,25,0,90,15,101,16,101,13,131,1,90,17,100,8,160,
+    18,101,13,161,1,90,13,100,9,100,10,132,0,101,13,68,
+    0,131,1,90,19,100,11,90,20,100,12,90,21,101,21,101,
+    20,23,0,90,22,100,13,100,14,132,0,90,23,101,23,131,
+    0,90,24,100,15,100,16,132,0,90,25,100,17,100,18,132,
+    0,90,26,100,19,100,20,132,0,90,27,101,8,114,119,100,
+    21,100,22,132,0,90,28,110,4,100,23,100,22,132,0,90,
+    28,100,24,100,25,132,0,90,29,100,26,100,27,132,0,90,
+    30,100,28,100,29,132,0,90,31,100,30,100,31,132,0,90,
+    32,100,32,100,33,132,0,90,33,101,8,114,150,100,34,100,
+    35,132,0,90,34,110,4,100,36,100,35,132,0,90,34,100,
+    112,100,38,100,39,132,1,90,35,101,36,101,35,106,37,131,
+    1,90,38,100,40,160,39,100,41,100,42,161,2,100,43,23,
+    0,90,40,101,41,160,42,101,40,100,42,161,2,90,43,100,
+    44,90,44,100,45,90,45,100,46,103,1,90,46,101,8,114,
+    192,101,46,160,47,100,47,161,1,1,0,101,2,160,48,161,
+    0,90,49,100,48,103,1,90,50,101,50,4,0,90,51,90,
+    52,100,113,100,1,100,49,156,1,100,50,100,51,132,3,90,
+    53,100,52,100,53,132,0,90,54,100,54,100,55,132,0,90,
+    55,100,56,100,57,132,0,90,56,100,58,100,59,132,0,90,
+    57,100,60,100,61,132,0,90,58,100,62,100,63,132,0,90,
+    59,100,64,100,65,132,0,90,60,100,66,100,67,132,0,90,
+    61,100,68,100,69,132,0,90,62,100,114,100,70,100,71,132,
+    1,90,63,100,115,100,72,100,73,132,1,90,64,100,116,100,
+    75,100,76,132,1,90,65,100,77,100,78,132,0,90,66,101,
+    67,131,0,90,68,100,113,100,1,101,68,100,79,156,2,100,
+    80,100,81,132,3,90,69,71,0,100,82,100,83,132,0,100,
+    83,131,2,90,70,71,0,100,84,100,85,132,0,100,85,131,
+    2,90,71,71,0,100,86,100,87,132,0,100,87,101,71,131,
+    3,90,72,71,0,100,88,100,89,132,0,100,89,131,2,90,
+    73,71,0,100,90,100,91,132,0,100,91,101,73,101,72,131,
+    4,90,74,71,0,100,92,100,93,132,0,100,93,101,73,101,
+    71,131,4,90,75,71,0,100,94,100,95,132,0,100,95,101,
+    73,101,71,131,4,90,76,71,0,100,96,100,97,132,0,100,
+    97,131,2,90,77,71,0,100,98,100,99,132,0,100,99,131,
+    2,90,78,71,0,100,100,100,101,132,0,100,101,131,2,90,
+    79,71,0,100,102,100,103,132,0,100,103,131,2,90,80,100,
+    113,100,104,100,105,132,1,90,81,100,106,100,107,132,0,90,
+    82,100,108,100,109,132,0,90,83,100,110,100,111,132,0,90,
+    84,100,1,83,0,41,117,113,0,78,246,0,113,1,113,2,
+    113,3,67,2,0,0,4,6,198,1,115,28,0,0,0,129,
+    0,124,0,93,9,125,1,116,0,124,1,131,1,100,0,107,
+    2,86,0,1,0,113,2,100,1,83,0,41,2,246,2,78,
+    41,1,113,4,41,2,113,5,113,6,169,0,82,2,113,7,
+    113,8,92,115,6,0,0,0,6,128,22,0,255,128,113,8,
+    113,9,67,2,0,0,4,8,134,1,115,22,0,0,0,104,
+    0,124,0,93,7,125,1,100,0,124,1,155,0,157,2,146,
+    2,113,2,83,0,41,1,113,10,82,2,41,2,113,5,113,
+    11,82,2,82,2,113,7,113,12,100,115,4,0,0,0,22,
+    0,255,128,113,12,41,1,113,13,41,2,113,14,113,15,67,
+    0,0,0,2,6,6,115,62,0,0,0,116,0,106,1,160,
+    2,116,3,161,1,114,25,116,0,106,1,160,2,116,4,161,
+    1,114,15,100,1,137,0,110,2,100,2,137,0,135,0,102,
+    1,100,3,100,4,132,8,125,0,124,0,83,0,100,5,100,
+    4,132,0,125,0,124,0,83,0,41,6,78,113,16,115,12,
+    0,0,0,80,89,84,72,79,78,67,65,83,69,79,75,67,
+    0,0,0,0,4,38,115,20,0,0,0,116,0,106,1,106,
+    2,12,0,111,9,136,0,116,3,106,4,118,0,83,0,41,
+    2,113,17,78,41,5,113,18,113,19,113,20,113,21,113,22,
+    82,2,169,1,113,23,82,2,113,7,113,24,134,1,243,4,
+    0,0,0,20,2,255,128,113,25,67,0,0,0,0,2,166,
+    1,243,4,0,0,0,100,1,83,0,41,3,113,26,70,78,
+    82,2,82,2,82,2,82,2,113,7,113,24,142,1,243,4,
+    0,0,0,4,2,255,128,41,5,113,18,113,27,113,28,113,
+    29,113,30,41,1,113,24,82,2,82,3,113,7,113,31,120,
+    115,18,0,0,0,12,1,12,1,6,1,4,2,12,2,4,
+    7,8,253,4,3,255,128,113,31,67,2,0,0,2,8,134,
+    1,115,20,0,0,0,116,0,124,0,131,1,100,1,64,0,
+    160,1,100,2,100,3,161,2,83,0,41,5,113,32,236,3,
+    0,0,0,255,127,255,127,3,0,246,8,113,33,78,41,2,
+    113,34,113,35,41,1,113,36,82,2,82,2,113,7,113,37,
+    158,1,82,4,113,37,67,2,0,0,2,8,134,1,243,28,
+    0,0,0,116,0,124,0,131,1,100,1,107,2,115,8,74,
+    0,130,1,116,1,160,2,124,0,100,2,161,2,83,0,41,
+    4,113,38,82,8,113,33,78,169,3,113,4,113,34,113,39,
+    169,1,113,40,82,2,82,2,113,7,113,41,168,1,243,6,
+    0,0,0,16,2,12,1,255,128,113,41,67,2,0,0,2,
+    8,134,1,82,9,41,4,113,42,246,4,113,33,78,82,10,
+    82,11,82,2,82,2,113,7,113,43,178,1,82,12,113,43,
+    67,0,0,0,10,8,142,1,115,228,0,0,0,124,0,115,
+    4,100,1,83,0,116,0,124,0,131,1,100,2,107,2,114,
+    14,124,0,100,3,25,0,83,0,100,1,125,1,103,0,125,
+    2,116,1,116,2,106,3,124,0,131,2,68,0,93,61,92,
+    2,125,3,125,4,124,3,160,4,116,5,161,1,115,38,124,
+    3,160,6,116,5,161,1,114,51,124,3,160,7,116,8,161,
+    1,112,44,124,1,125,1,116,9,124,4,23,0,103,1,125,
+    2,113,24,124,3,160,6,100,4,161,1,114,76,124,1,160,
+    10,161,0,124,3,160,10,161,0,107,3,114,70,124,3,125,
+    1,124,4,103,1,125,2,113,24,124,2,160,11,124,4,161,
+    1,1,0,113,24,124,3,112,79,124,1,125,1,124,2,160,
+    11,124,4,161,1,1,0,113,24,100,5,100,6,132,0,124,
+    2,68,0,131,1,125,2,116,0,124,2,131,1,100,2,107,
+    2,114,107,124,2,100,3,25,0,115,107,124,1,116,9,23,
+    0,83,0,124,1,116,9,160,12,124,2,161,1,23,0,83,
+    0,41,8,113,44,113,9,82,1,82,0,113,10,67,2,0,
+    0,4,10,166,1,243,26,0,0,0,103,0,124,0,93,9,
+    125,1,124,1,114,2,124,1,160,0,116,1,161,1,145,2,
+    113,2,83,0,82,2,169,2,113,45,113,46,169,2,113,5,
+    113,47,82,2,82,2,113,7,113,48,238,1,115,4,0,0,
+    0,26,0,255,128,113,49,78,41,13,113,4,113,50,113,21,
+    113,51,113,28,113,52,113,53,113,45,113,46,113,54,113,55,
+    113,56,113,57,41,5,113,58,113,59,113,60,113,61,113,62,
+    82,2,82,2,113,7,113,63,192,1,115,44,0,0,0,4,
+    2,4,1,12,1,8,1,4,1,4,1,20,1,20,1,14,
+    1,12,1,10,1,16,1,4,3,8,1,12,2,8,2,12,
+    1,14,1,20,1,8,2,14,1,255,128,113,63,67,0,0,
+    0,2,8,142,1,115,20,0,0,0,116,0,160,1,100,1,
+    100,2,132,0,124,0,68,0,131,1,161,1,83,0,41,4,
+    113,44,67,2,0,0,4,10,166,1,82,14,82,2,82,15,
+    41,2,113,5,113,64,82,2,82,2,113,7,113,48,128,2,
+    115,8,0,0,0,6,0,6,1,14,255,255,128,113,49,78,
+    41,2,113,54,113,57,41,1,113,58,82,2,82,2,113,7,
+    113,63,252,1,115,8,0,0,0,10,2,2,1,8,255,255,
+    128,67,2,0,0,4,8,6,115,66,0,0,0,116,0,135,
+    0,102,1,100,1,100,2,132,8,116,1,68,0,131,1,131,
+    1,125,1,124,1,100,3,107,0,114,19,100,4,136,0,102,
+    2,83,0,136,0,100,5,124,1,133,2,25,0,136,0,124,
+    1,100,6,23,0,100,5,133,2,25,0,102,2,83,0,41,
+    7,113,65,67,2,0,0,4,8,102,115,26,0,0,0,129,
+    0,124,0,93,8,125,1,136,0,160,0,124,1,161,1,86,
+    0,1,0,113,2,100,0,83,0,169,1,78,41,1,113,66,
+    82,16,169,1,113,60,82,2,113,7,113,8,140,2,115,6,
+    0,0,0,6,128,20,0,255,128,113,67,82,0,113,9,78,
+    82,1,41,2,113,68,113,46,41,2,113,60,113,69,82,2,
+    82,18,113,7,113,70,136,2,115,10,0,0,0,22,2,8,
+    1,8,1,28,1,255,128,113,70,67,2,0,0,2,6,134,
+    1,115,10,0,0,0,116,0,160,1,124,0,161,1,83,0,
+    41,2,113,71,78,41,2,113,21,113,72,82,18,82,2,82,
+    2,113,7,113,73,152,2,115,4,0,0,0,10,7,255,128,
+    113,73,67,4,0,0,6,16,134,1,115,48,0,0,0,122,
+    6,116,0,124,0,131,1,125,2,87,0,110,9,4,0,116,
+    1,121,23,1,0,1,0,1,0,89,0,100,1,83,0,124,
+    2,106,2,100,2,64,0,124,1,107,2,83,0,119,0,41,
+    4,113,74,70,118,128,192,7,78,41,3,113,73,113,75,113,
+    76,41,3,113,60,113,77,113,78,82,2,82,2,113,7,113,
+    79,172,2,115,14,0,0,0,2,2,12,1,12,1,6,1,
+    14,1,2,254,255,128,113,79,67,2,0,0,2,6,134,1,
+    115,10,0,0,0,116,0,124,0,100,1,131,2,83,0,41,
+    3,113,80,118,128,128,4,78,41,1,113,79,82,18,82,2,
+    82,2,113,7,113,81,190,2,243,4,0,0,0,10,2,255,
+    128,113,81,67,2,0,0,2,6,134,1,115,22,0,0,0,
+    124,0,115,6,116,0,160,1,161,0,125,0,116,2,124,0,
+    100,1,131,2,83,0,41,3,113,82,118,128,128,2,78,41,
+    3,113,21,113,83,113,79,82,18,82,2,82,2,113,7,113,
+    84,200,2,115,8,0,0,0,4,2,8,1,10,1,255,128,
+    113,84,67,2,0,0,4,8,134,1,115,62,0,0,0,124,
+    0,115,4,100,1,83,0,116,0,160,1,124,0,161,1,100,
+    2,25,0,160,2,100,3,100,4,161,2,125,1,116,3,124,
+    1,131,1,100,5,107,4,111,30,124,1,160,4,100,6,161,
+    1,112,30,124,1,160,5,100,4,161,1,83,0,41,8,113,
+    85,70,82,0,113,3,113,2,82,1,113,86,78,41,6,113,
+    21,113,51,113,87,113,4,113,28,113,53,41,2,113,60,113,
+    59,82,2,82,2,113,7,113,88,216,2,115,10,0,0,0,
+    4,2,4,1,22,1,32,1,255,128,113,88,67,2,0,0,
+    2,6,134,1,115,10,0,0,0,124,0,160,0,116,1,161,
+    1,83,0,41,2,113,85,78,41,2,113,28,113,46,82,18,
+    82,2,82,2,113,7,113,88,232,2,82,19,246,236,6,67,
+    6,0,0,12,22,134,1,115,170,0,0,0,100,1,160,0,
+    124,0,116,1,124,0,131,1,161,2,125,3,116,2,160,3,
+    124,3,116,2,106,4,116,2,106,5,66,0,116,2,106,6,
+    66,0,124,2,100,2,64,0,161,3,125,4,122,36,116,7,
+    160,8,124,4,100,3,161,2,143,13,125,5,124,5,160,9,
+    124,1,161,1,1,0,87,0,100,4,4,0,4,0,131,3,
+    1,0,110,8,49,0,115,47,119,1,1,0,1,0,1,0,
+    89,0,1,0,116,2,160,10,124,3,124,0,161,2,1,0,
+    87,0,100,4,83,0,4,0,116,11,121,84,1,0,1,0,
+    1,0,122,7,116,2,160,12,124,3,161,1,1,0,87,0,
+    130,0,4,0,116,11,121,83,1,0,1,0,1,0,89,0,
+    130,0,119,0,119,0,41,5,113,89,113,90,82,20,113,91,
+    78,41,13,113,92,113,93,113,21,113,94,113,95,113,96,113,
+    97,113,98,113,99,113,100,113,87,113,75,113,101,41,6,113,
+    60,113,40,113,77,113,102,113,103,113,104,82,2,82,2,113,
+    7,113,105,242,2,115,38,0,0,0,16,5,6,1,22,1,
+    4,255,2,2,14,3,24,1,16,128,18,1,12,1,2,1,
+    12,1,2,3,12,254,2,1,2,1,2,254,2,253,255,128,
+    113,105,118,220,53,82,13,113,33,115,2,0,0,0,13,10,
+    113,106,113,107,113,108,113,109,113,110,41,1,113,111,67,4,
+    0,2,24,10,134,1,115,80,1,0,0,124,1,100,1,117,
+    1,114,26,116,0,160,1,100,2,116,2,161,2,1,0,124,
+    2,100,1,117,1,114,20,100,3,125,3,116,3,124,3,131,
+    1,130,1,124,1,114,24,100,4,110,1,100,5,125,2,116,
+    4,160,5,124,0,161,1,125,0,116,6,124,0,131,1,92,
+    2,125,4,125,5,124,5,160,7,100,6,161,1,92,3,125,
+    6,125,7,125,8,116,8,106,9,106,10,125,9,124,9,100,
+    1,117,0,114,57,116,11,100,7,131,1,130,1,100,4,160,
+    12,124,6,114,63,124,6,110,1,124,8,124,7,124,9,103,
+    3,161,1,125,10,124,2,100,1,117,0,114,86,116,8,106,
+    13,106,14,100,8,107,2,114,82,100,4,125,2,110,4,116,
+    8,106,13,106,14,125,2,116,15,124,2,131,1,125,2,124,
+    2,100,4,107,3,114,112,124,2,160,16,161,0,115,105,116,
+    17,100,9,160,18,124,2,161,1,131,1,130,1,100,10,160,
+    18,124,10,116,19,124,2,161,3,125,10,124,10,116,20,100,
+    8,25,0,23,0,125,11,116,8,106,21,100,1,117,1,114,
+    162,116,22,124,4,131,1,115,134,116,23,116,4,160,24,161,
+    0,124,4,131,2,125,4,124,4,100,5,25,0,100,11,107,
+    2,114,152,124,4,100,8,25,0,116,25,118,1,114,152,124,
+    4,100,12,100,1,133,2,25,0,125,4,116,23,116,8,106,
+    21,124,4,160,26,116,25,161,1,124,11,131,3,83,0,116,
+    23,124,4,116,27,124,11,131,3,83,0,41,13,113,112,78,
+    113,113,113,114,113,9,82,1,113,115,113,116,82,0,113,117,
+    113,118,113,10,82,13,41,28,113,119,113,120,113,121,113,122,
+    113,21,113,123,113,70,113,124,113,18,113,125,113,126,113,127,
+    113,57,113,19,113,128,1,113,129,1,113,130,1,113,131,1,
+    113,92,113,132,1,113,133,1,113,134,1,113,88,113,63,113,
+    83,113,46,113,135,1,113,136,1,41,12,113,60,113,137,1,
+    113,111,113,138,1,113,139,1,113,62,113,140,1,113,6,113,
+    141,1,113,142,1,113,143,1,113,144,1,82,2,82,2,113,
+    7,113,145,1,246,5,115,74,0,0,0,8,18,6,1,2,
+    1,4,255,8,2,4,1,8,1,12,1,10,1,12,1,16,
+    1,8,1,8,1,8,1,24,1,8,1,12,1,6,1,8,
+    2,8,1,8,1,8,1,14,1,14,1,12,1,10,1,8,
+    9,14,1,24,5,12,1,2,4,4,1,8,1,2,1,4,
+    253,12,5,255,128,113,145,1,67,2,0,0,20,10,134,1,
+    115,40,1,0,0,116,0,106,1,106,2,100,1,117,0,114,
+    10,116,3,100,2,131,1,130,1,116,4,160,5,124,0,161,
+    1,125,0,116,6,124,0,131,1,92,2,125,1,125,2,100,
+    3,125,3,116,0,106,7,100,1,117,1,114,51,116,0,106,
+    7,160,8,116,9,161,1,125,4,124,1,160,10,124,4,116,
+    11,23,0,161,1,114,51,124,1,116,12,124,4,131,1,100,
+    1,133,2,25,0,125,1,100,4,125,3,124,3,115,72,116,
+    6,124,1,131,1,92,2,125,1,125,5,124,5,116,13,107,
+    3,114,72,116,14,116,13,155,0,100,5,124,0,155,2,157,
+    3,131,1,130,1,124,2,160,15,100,6,161,1,125,6,124,
+    6,100,7,118,1,114,88,116,14,100,8,124,2,155,2,157,
+    2,131,1,130,1,124,6,100,9,107,2,114,132,124,2,160,
+    16,100,6,100,10,161,2,100,11,25,0,125,7,124,7,160,
+    10,116,17,161,1,115,112,116,14,100,12,116,17,155,2,157,
+    2,131,1,130,1,124,7,116,12,116,17,131,1,100,1,133,
+    2,25,0,125,8,124,8,160,18,161,0,115,132,116,14,100,
+    13,124,7,155,2,100,14,157,3,131,1,130,1,124,2,160,
+    19,100,6,161,1,100,15,25,0,125,9,116,20,124,1,124,
+    9,116,21,100,15,25,0,23,0,131,2,83,0,41,16,113,
+    146,1,78,113,116,70,84,113,147,1,113,115,62,2,0,0,
+    0,82,13,246,6,113,148,1,82,21,82,13,246,3,113,149,
+    1,113,150,1,113,151,1,82,0,41,22,113,18,113,125,113,
+    126,113,127,113,21,113,123,113,70,113,134,1,113,45,113,46,
+    113,28,113,54,113,4,113,136,1,113,131,1,113,152,1,113,
+    153,1,113,132,1,113,130,1,113,154,1,113,63,113,155,1,
+    41,10,113,60,113,139,1,113,156,1,113,157,1,113,158,1,
+    113,159,1,113,160,1,113,111,113,161,1,113,162,1,82,2,
+    82,2,113,7,113,163,1,132,7,115,62,0,0,0,12,9,
+    8,1,10,1,12,1,4,1,10,1,12,1,14,1,16,1,
+    4,1,4,1,12,1,8,1,8,1,2,1,8,255,10,2,
+    8,1,14,1,8,1,16,1,10,1,4,1,2,1,8,255,
+    16,2,8,1,16,1,14,2,18,1,255,128,113,163,1,67,
+    2,0,0,10,18,134,1,115,122,0,0,0,116,0,124,0,
+    131,1,100,1,107,2,114,8,100,2,83,0,124,0,160,1,
+    100,3,161,1,92,3,125,1,125,2,125,3,124,1,114,28,
+    124,3,160,2,161,0,100,4,100,5,133,2,25,0,100,6,
+    107,3,114,30,124,0,83,0,122,6,116,3,124,0,131,1,
+    125,4,87,0,110,15,4,0,116,4,116,5,102,2,121,60,
+    1,0,1,0,1,0,124,0,100,2,100,5,133,2,25,0,
+    125,4,89,0,116,6,124,4,131,1,114,58,124,4,83,0,
+    124,0,83,0,119,0,41,7,113,164,1,82,0,78,113,115,
+    246,5,246,1,113,165,1,41,7,113,4,113,124,113,166,1,
+    113,163,1,113,127,113,131,1,113,81,41,5,113,167,1,113,
+    141,1,113,168,1,113,169,1,113,170,1,82,2,82,2,113,
+    7,113,171,1,212,7,115,24,0,0,0,12,7,4,1,16,
+    1,24,1,4,1,2,1,12,1,16,1,14,1,16,1,2,
+    254,255,128,113,171,1,67,2,0,0,2,16,134,1,115,68,
+    0,0,0,124,0,160,0,116,1,116,2,131,1,161,1,114,
+    22,122,5,116,3,124,0,131,1,87,0,83,0,4,0,116,
+    4,121,33,1,0,1,0,1,0,89,0,100,0,83,0,124,
+    0,160,0,116,1,116,5,131,1,161,1,114,31,124,0,83,
+    0,100,0,83,0,119,0,82,17,41,6,113,53,113,172,1,
+    113,155,1,113,145,1,113,127,113,133,1,41,1,113,144,1,
+    82,2,82,2,113,7,113,173,1,250,7,115,20,0,0,0,
+    14,1,2,1,10,1,12,1,6,1,14,1,4,1,4,2,
+    2,251,255,128,113,173,1,67,2,0,0,4,16,134,1,115,
+    48,0,0,0,122,7,116,0,124,0,131,1,106,1,125,1,
+    87,0,110,9,4,0,116,2,121,23,1,0,1,0,1,0,
+    100,1,125,1,89,0,124,1,100,2,79,0,125,1,124,1,
+    83,0,119,0,41,4,113,174,1,82,20,246,128,2,78,41,
+    3,113,73,113,76,113,75,41,2,113,60,113,77,82,2,82,
+    2,113,7,113,175,1,146,8,115,16,0,0,0,2,2,14,
+    1,12,1,6,1,8,3,4,1,2,251,255,128,113,175,1,
+    67,2,0,0,6,8,6,115,52,0,0,0,100,6,135,0,
+    102,1,100,2,100,3,132,9,125,1,116,0,100,1,117,1,
+    114,15,116,0,106,1,125,2,110,4,100,4,100,5,132,0,
+    125,2,124,2,124,1,136,0,131,2,1,0,124,1,83,0,
+    41,7,113,176,1,78,67,4,0,0,8,8,62,115,72,0,
+    0,0,124,1,100,0,117,0,114,8,124,0,106,0,125,1,
+    110,16,124,0,106,0,124,1,107,3,114,24,116,1,100,1,
+    124,0,106,0,124,1,102,2,22,0,124,1,100,2,141,2,
+    130,1,136,0,124,0,124,1,103,2,124,2,162,1,82,0,
+    105,0,124,3,164,1,142,1,83,0,41,3,78,113,177,1,
+    169,1,113,178,1,41,2,113,178,1,113,179,1,41,4,113,
+    180,1,113,178,1,113,181,1,113,182,1,169,1,113,183,1,
+    82,2,113,7,113,184,1,186,8,115,20,0,0,0,8,1,
+    8,1,10,1,4,1,8,1,2,255,2,1,6,255,24,2,
+    255,128,113,185,1,67,4,0,0,6,14,166,1,115,56,0,
+    0,0,100,1,68,0,93,16,125,2,116,0,124,1,124,2,
+    131,2,114,18,116,1,124,0,124,2,116,2,124,1,124,2,
+    131,2,131,3,1,0,113,2,124,0,106,3,160,4,124,1,
+    106,3,161,1,1,0,100,0,83,0,41,2,78,41,4,113,
+    186,1,113,187,1,113,188,1,113,189,1,41,5,113,190,1,
+    113,191,1,113,192,1,113,193,1,113,194,1,41,3,113,195,
+    1,113,196,1,113,87,82,2,82,2,113,7,113,197,1,212,
+    8,115,12,0,0,0,8,1,10,1,18,1,2,128,18,1,
+    255,128,113,198,1,82,17,41,2,113,199,1,113,197,1,41,
+    3,113,183,1,113,184,1,113,197,1,82,2,82,27,113,7,
+    113,200,1,170,8,115,14,0,0,0,14,8,8,10,8,1,
+    8,2,10,6,4,1,255,128,113,200,1,67,4,0,0,10,
+    12,134,1,115,72,0,0,0,116,0,160,1,100,1,116,2,
+    161,2,1,0,124,0,160,3,124,1,161,1,92,2,125,2,
+    125,3,124,2,100,2,117,0,114,34,116,4,124,3,131,1,
+    114,34,100,3,125,4,116,0,160,1,124,4,160,5,124,3,
+    100,4,25,0,161,1,116,6,161,2,1,0,124,2,83,0,
+    41,5,113,201,1,113,202,1,78,113,203,1,82,0,41,7,
+    113,119,113,120,113,121,113,204,1,113,4,113,92,113,205,1,
+    41,5,113,180,1,113,206,1,113,207,1,113,208,1,113,209,
+    1,82,2,82,2,113,7,113,210,1,232,8,115,18,0,0,
+    0,6,7,2,2,4,254,14,6,16,1,4,1,22,1,4,
+    1,255,128,113,210,1,67,6,0,0,12,8,134,1,115,166,
+    0,0,0,124,0,100,1,100,2,133,2,25,0,125,3,124,
+    3,116,0,107,3,114,32,100,3,124,1,155,2,100,4,124,
+    3,155,2,157,4,125,4,116,1,160,2,100,5,124,4,161,
+    2,1,0,116,3,124,4,102,1,105,0,124,2,164,1,142,
+    1,130,1,116,4,124,0,131,1,100,6,107,0,114,53,100,
+    7,124,1,155,2,157,2,125,4,116,1,160,2,100,5,124,
+    4,161,2,1,0,116,5,124,4,131,1,130,1,116,6,124,
+    0,100,2,100,8,133,2,25,0,131,1,125,5,124,5,100,
+    9,64,0,114,81,100,10,124,5,155,2,100,11,124,1,155,
+    2,157,4,125,4,116,3,124,4,102,1,105,0,124,2,164,
+    1,142,1,130,1,124,5,83,0,41,12,113,211,1,78,82,
+    8,113,212,1,113,213,1,113,214,1,246,32,113,215,1,246,
+    16,246,7,113,216,1,113,217,1,41,7,113,218,1,113,199,
+    1,113,219,1,113,179,1,113,4,113,220,1,113,41,41,6,
+    113,40,113,178,1,113,221,1,113,222,1,113,138,1,113,19,
+    82,2,82,2,113,7,113,223,1,144,9,115,30,0,0,0,
+    12,16,8,1,16,1,12,1,16,1,12,1,10,1,12,1,
+    8,1,16,1,8,2,16,1,16,1,4,1,255,128,113,223,
+    1,67,10,0,0,12,8,134,1,115,124,0,0,0,116,0,
+    124,0,100,1,100,2,133,2,25,0,131,1,124,1,100,3,
+    64,0,107,3,114,31,100,4,124,3,155,2,157,2,125,5,
+    116,1,160,2,100,5,124,5,161,2,1,0,116,3,124,5,
+    102,1,105,0,124,4,164,1,142,1,130,1,124,2,100,6,
+    117,1,114,60,116,0,124,0,100,2,100,7,133,2,25,0,
+    131,1,124,2,100,3,64,0,107,3,114,58,116,3,100,4,
+    124,3,155,2,157,2,102,1,105,0,124,4,164,1,142,1,
+    130,1,100,6,83,0,100,6,83,0,41,8,113,224,1,82,
+    29,246,24,82,7,113,225,1,113,214,1,78,82,28,41,4,
+    113,41,113,199,1,113,219,1,113,179,1,41,6,113,40,113,
+    226,1,113,227,1,113,178,1,113,221,1,113,138,1,82,2,
+    82,2,113,7,113,228,1,210,9,115,20,0,0,0,24,19,
+    10,1,12,1,16,1,8,1,22,1,2,255,22,2,8,254,
+    255,128,113,228,1,67,8,0,0,8,8,134,1,115,42,0,
+    0,0,124,0,100,1,100,2,133,2,25,0,124,1,107,3,
+    114,19,116,0,100,3,124,2,155,2,157,2,102,1,105,0,
+    124,3,164,1,142,1,130,1,100,4,83,0,41,5,113,229,
+    1,82,29,82,28,113,230,1,78,41,1,113,179,1,41,4,
+    113,40,113,231,1,113,178,1,113,221,1,82,2,82,2,113,
+    7,113,232,1,138,10,115,16,0,0,0,16,17,2,1,8,
+    1,4,255,2,2,6,254,4,255,255,128,113,232,1,67,8,
+    0,0,10,10,134,1,115,76,0,0,0,116,0,160,1,124,
+    0,161,1,125,4,116,2,124,4,116,3,131,2,114,28,116,
+    4,160,5,100,1,124,2,161,2,1,0,124,3,100,2,117,
+    1,114,26,116,6,160,7,124,4,124,3,161,2,1,0,124,
+    4,83,0,116,8,100,3,160,9,124,2,161,1,124,1,124,
+    2,100,4,141,3,130,1,41,5,113,233,1,113,234,1,78,
+    113,235,1,169,2,113,178,1,113,60,41,10,113,236,1,113,
+    237,1,113,238,1,113,239,1,113,199,1,113,219,1,113,240,
+    1,113,241,1,113,179,1,113,92,41,5,113,40,113,178,1,
+    113,167,1,113,170,1,113,242,1,82,2,82,2,113,7,113,
+    243,1,186,10,115,20,0,0,0,10,2,10,1,12,1,8,
+    1,12,1,4,1,10,2,4,1,6,255,255,128,113,243,1,
+    67,6,0,0,8,10,134,1,115,70,0,0,0,116,0,116,
+    1,131,1,125,3,124,3,160,2,116,3,100,1,131,1,161,
+    1,1,0,124,3,160,2,116,3,124,1,131,1,161,1,1,
+    0,124,3,160,2,116,3,124,2,131,1,161,1,1,0,124,
+    3,160,2,116,4,160,5,124,0,161,1,161,1,1,0,124,
+    3,83,0,41,3,113,244,1,82,0,78,41,6,113,245,1,
+    113,218,1,113,246,1,113,37,113,236,1,113,247,1,41,4,
+    113,242,1,113,248,1,113,227,1,113,40,82,2,82,2,113,
+    7,113,249,1,212,10,115,14,0,0,0,8,2,14,1,14,
+    1,14,1,16,1,4,1,255,128,113,249,1,84,67,6,0,
+    0,10,10,134,1,115,80,0,0,0,116,0,116,1,131,1,
+    125,3,100,1,124,2,100,1,62,0,66,0,125,4,124,3,
+    160,2,116,3,124,4,131,1,161,1,1,0,116,4,124,1,
+    131,1,100,2,107,2,115,25,74,0,130,1,124,3,160,2,
+    124,1,161,1,1,0,124,3,160,2,116,5,160,6,124,0,
+    161,1,161,1,1,0,124,3,83,0,41,4,113,250,1,82,
+    1,82,29,78,41,7,113,245,1,113,218,1,113,246,1,113,
+    37,113,4,113,236,1,113,247,1,41,5,113,242,1,113,231,
+    1,113,251,1,113,40,113,19,82,2,82,2,113,7,113,252,
+    1,232,10,115,16,0,0,0,8,2,12,1,14,1,16,1,
+    10,1,16,1,4,1,255,128,113,252,1,67,2,0,0,10,
+    12,134,1,115,62,0,0,0,100,1,100,2,108,0,125,1,
+    116,1,160,2,124,0,161,1,106,3,125,2,124,1,160,4,
+    124,2,161,1,125,3,116,1,160,5,100,2,100,3,161,2,
+    125,4,124,4,160,6,124,0,160,6,124,3,100,1,25,0,
+    161,1,161,1,83,0,41,4,113,253,1,82,0,78,84,41,
+    7,113,254,1,113,98,113,255,1,113,128,2,113,129,2,113,
+    130,2,113,131,2,41,5,113,132,2,113,254,1,113,133,2,
+    113,134,2,113,135,2,82,2,82,2,113,7,113,136,2,254,
+    10,115,12,0,0,0,8,5,12,1,10,1,12,1,20,1,
+    255,128,113,136,2,169,2,113,207,1,113,137,2,67,4,0,
+    4,18,16,134,1,115,52,1,0,0,124,1,100,1,117,0,
+    114,28,100,2,125,1,116,0,124,2,100,3,131,2,114,27,
+    122,7,124,2,160,1,124,0,161,1,125,1,87,0,110,35,
+    4,0,116,2,121,153,1,0,1,0,1,0,89,0,110,27,
+    110,26,116,3,160,4,124,1,161,1,125,1,116,5,124,1,
+    131,1,115,54,122,9,116,6,116,3,160,7,161,0,124,1,
+    131,2,125,1,87,0,110,7,4,0,116,8,121,152,1,0,
+    1,0,1,0,89,0,116,9,106,10,124,0,124,2,124,1,
+    100,4,141,3,125,4,100,5,124,4,95,11,124,2,100,1,
+    117,0,114,96,116,12,131,0,68,0,93,21,92,2,125,5,
+    125,6,124,1,160,13,116,14,124,6,131,1,161,1,114,93,
+    124,5,124,0,124,1,131,2,125,2,124,2,124,4,95,15,
+    1,0,113,96,113,72,100,1,83,0,124,3,116,16,117,0,
+    114,127,116,0,124,2,100,6,131,2,114,126,122,7,124,2,
+    160,17,124,0,161,1,125,7,87,0,110,8,4,0,116,2,
+    121,151,1,0,1,0,1,0,89,0,110,9,124,7,114,126,
+    103,0,124,4,95,18,110,3,124,3,124,4,95,18,124,4,
+    106,18,103,0,107,2,114,149,124,1,114,149,116,19,124,1,
+    131,1,100,7,25,0,125,8,124,4,106,18,160,20,124,8,
+    161,1,1,0,124,4,83,0,119,0,119,0,119,0,41,8,
+    113,138,2,78,113,139,2,113,140,2,169,1,113,141,2,84,
+    113,142,2,82,0,41,21,113,190,1,113,140,2,113,179,1,
+    113,21,113,123,113,88,113,63,113,83,113,75,113,199,1,113,
+    143,2,113,144,2,113,145,2,113,53,113,172,1,113,207,1,
+    113,146,2,113,142,2,113,137,2,113,70,113,56,41,9,113,
+    178,1,113,147,2,113,207,1,113,137,2,113,148,2,113,149,
+    2,113,150,2,113,142,2,113,151,2,82,2,82,2,113,7,
+    113,152,2,160,11,115,86,0,0,0,8,12,4,4,10,1,
+    2,2,14,1,12,1,4,1,2,251,10,7,8,1,2,1,
+    18,1,12,1,2,1,16,8,6,1,8,3,14,1,14,1,
+    10,1,6,1,4,1,2,253,4,5,8,3,10,2,2,1,
+    14,1,12,1,4,1,4,2,6,1,2,128,6,2,10,1,
+    4,1,12,1,12,1,4,2,2,244,2,228,2,249,255,128,
+    113,152,2,67,0,0,0,0,8,128,1,115,88,0,0,0,
+    101,0,90,1,100,0,90,2,100,1,90,3,100,2,90,4,
+    100,3,90,5,101,6,111,15,100,4,101,7,118,0,90,8,
+    101,9,100,5,100,6,132,0,131,1,90,10,101,11,100,7,
+    100,8,132,0,131,1,90,12,101,11,100,14,100,10,100,11,
+    132,1,131,1,90,13,101,11,100,15,100,12,100,13,132,1,
+    131,1,90,14,100,9,83,0,41,16,113,153,2,113,154,2,
+    113,155,2,113,156,2,113,157,2,67,2,0,0,2,16,134,
+    1,115,50,0,0,0,122,8,116,0,160,1,116,0,106,2,
+    124,0,161,2,87,0,83,0,4,0,116,3,121,24,1,0,
+    1,0,1,0,116,0,160,1,116,0,106,4,124,0,161,2,
+    6,0,89,0,83,0,119,0,82,17,41,5,113,158,2,113,
+    159,2,113,160,2,113,75,113,161,2,82,3,82,2,82,2,
+    113,7,113,162,2,202,12,115,12,0,0,0,2,2,16,1,
+    12,1,18,1,2,255,255,128,113,163,2,67,4,0,0,12,
+    16,134,1,115,130,0,0,0,124,0,106,0,114,7,124,0,
+    106,1,125,2,110,3,124,0,106,2,125,2,124,2,106,3,
+    124,1,100,1,116,4,106,5,100,0,100,2,133,2,25,0,
+    22,0,100,3,141,2,125,3,122,30,124,0,160,6,124,3,
+    161,1,143,14,125,4,116,7,160,8,124,4,100,4,161,2,
+    125,5,87,0,100,0,4,0,4,0,131,3,1,0,110,8,
+    49,0,115,47,119,1,1,0,1,0,1,0,89,0,1,0,
+    87,0,124,5,83,0,4,0,116,9,121,64,1,0,1,0,
+    1,0,89,0,100,0,83,0,119,0,41,5,78,113,164,2,
+    82,13,41,2,113,206,1,113,165,2,113,9,41,10,113,166,
+    2,113,167,2,113,168,2,113,92,113,18,113,169,2,113,162,
+    2,113,158,2,113,170,2,113,75,41,6,113,171,2,113,206,
+    1,113,172,2,113,23,113,173,2,113,174,2,82,2,82,2,
+    113,7,113,175,2,216,12,115,30,0,0,0,6,2,8,1,
+    6,2,6,1,16,1,6,255,2,2,12,1,26,1,18,128,
+    4,3,12,254,6,1,2,255,255,128,113,176,2,78,67,8,
+    0,0,16,16,134,1,115,120,0,0,0,124,0,160,0,124,
+    1,161,1,125,4,124,4,100,0,117,0,114,11,100,0,83,
+    0,122,6,116,1,124,4,131,1,1,0,87,0,110,9,4,
+    0,116,2,121,59,1,0,1,0,1,0,89,0,100,0,83,
+    0,116,3,131,0,68,0,93,26,92,2,125,5,125,6,124,
+    4,160,4,116,5,124,6,131,1,161,1,114,56,116,6,106,
+    7,124,1,124,5,124,1,124,4,131,2,124,4,100,1,141,
+    3,125,7,124,7,2,0,1,0,83,0,113,30,100,0,83,
+    0,119,0,41,2,78,82,34,41,8,113,175,2,113,73,113,
+    75,113,145,2,113,53,113,172,1,113,199,1,113,177,2,41,
+    8,113,171,2,113,206,1,113,60,113,178,2,113,174,2,113,
+    207,1,113,150,2,113,148,2,82,2,82,2,113,7,113,179,
+    2,246,12,115,36,0,0,0,10,2,8,1,4,1,2,1,
+    12,1,12,1,6,1,14,1,14,1,6,1,8,1,2,1,
+    6,254,8,3,2,252,4,255,2,254,255,128,113,180,2,67,
+    6,0,0,8,8,134,1,115,42,0,0,0,116,0,160,1,
+    100,1,116,2,161,2,1,0,124,0,160,3,124,1,124,2,
+    161,2,125,3,124,3,100,2,117,1,114,19,124,3,106,4,
+    83,0,100,2,83,0,41,3,113,181,2,113,182,2,78,169,
+    5,113,119,113,120,113,121,113,179,2,113,207,1,169,4,113,
+    171,2,113,206,1,113,60,113,148,2,82,2,82,2,113,7,
+    113,183,2,150,13,115,16,0,0,0,6,7,2,2,4,254,
+    12,3,8,1,6,1,4,2,255,128,113,184,2,169,2,78,
+    78,82,17,41,15,113,187,1,113,186,1,113,188,1,113,189,
+    1,113,168,2,113,167,2,113,185,2,113,186,2,113,166,2,
+    113,187,2,113,162,2,113,188,2,113,175,2,113,179,2,113,
+    183,2,82,2,82,2,82,2,113,7,113,153,2,178,12,115,
+    32,0,0,0,8,0,4,2,2,3,2,255,2,4,2,255,
+    12,3,2,2,10,1,2,6,10,1,2,14,12,1,2,15,
+    16,1,255,128,113,153,2,67,0,0,0,0,4,128,1,115,
+    48,0,0,0,101,0,90,1,100,0,90,2,100,1,90,3,
+    100,2,100,3,132,0,90,4,100,4,100,5,132,0,90,5,
+    100,6,100,7,132,0,90,6,100,8,100,9,132,0,90,7,
+    100,10,83,0,41,11,113,189,2,113,190,2,67,4,0,0,
+    10,8,134,1,115,64,0,0,0,116,0,124,0,160,1,124,
+    1,161,1,131,1,100,1,25,0,125,2,124,2,160,2,100,
+    2,100,1,161,2,100,3,25,0,125,3,124,1,160,3,100,
+    2,161,1,100,4,25,0,125,4,124,3,100,5,107,2,111,
+    31,124,4,100,5,107,3,83,0,41,7,113,191,2,82,1,
+    113,115,82,0,82,13,113,192,2,78,41,4,113,70,113,140,
+    2,113,153,1,113,124,41,5,113,180,1,113,206,1,113,144,
+    1,113,193,2,113,194,2,82,2,82,2,113,7,113,142,2,
+    194,13,115,10,0,0,0,18,3,16,1,14,1,16,1,255,
+    128,113,195,2,67,4,0,0,4,2,134,1,82,5,169,2,
+    113,196,2,78,82,2,169,2,113,180,1,113,148,2,82,2,
+    82,2,113,7,113,197,2,210,13,243,4,0,0,0,4,0,
+    255,128,113,198,2,67,4,0,0,6,10,134,1,115,56,0,
+    0,0,124,0,160,0,124,1,106,1,161,1,125,2,124,2,
+    100,1,117,0,114,18,116,2,100,2,160,3,124,1,106,1,
+    161,1,131,1,130,1,116,4,160,5,116,6,124,2,124,1,
+    106,7,161,3,1,0,100,1,83,0,41,3,113,199,2,78,
+    113,200,2,41,8,113,201,2,113,187,1,113,179,1,113,92,
+    113,199,1,113,202,2,113,203,2,113,193,1,41,3,113,180,
+    1,113,204,2,113,242,1,82,2,82,2,113,7,113,205,2,
+    216,13,115,14,0,0,0,12,2,8,1,4,1,8,1,4,
+    255,20,2,255,128,113,206,2,67,4,0,0,4,8,134,1,
+    115,12,0,0,0,116,0,160,1,124,0,124,1,161,2,83,
+    0,41,2,113,207,2,78,41,2,113,199,1,113,208,2,169,
+    2,113,180,1,113,206,1,82,2,82,2,113,7,113,209,2,
+    232,13,115,4,0,0,0,12,3,255,128,113,210,2,78,41,
+    8,113,187,1,113,186,1,113,188,1,113,189,1,113,142,2,
+    113,197,2,113,205,2,113,209,2,82,2,82,2,82,2,113,
+    7,113,189,2,184,13,115,14,0,0,0,8,0,4,2,8,
+    3,8,8,8,3,12,8,255,128,113,189,2,67,0,0,0,
+    0,6,128,1,115,74,0,0,0,101,0,90,1,100,0,90,
+    2,100,1,100,2,132,0,90,3,100,3,100,4,132,0,90,
+    4,100,5,100,6,132,0,90,5,100,7,100,8,132,0,90,
+    6,100,9,100,10,132,0,90,7,100,11,100,12,156,1,100,
+    13,100,14,132,2,90,8,100,15,100,16,132,0,90,9,100,
+    17,83,0,41,18,113,211,2,67,4,0,0,4,2,134,1,
+    115,4,0,0,0,116,0,130,1,41,2,113,212,2,78,41,
+    1,113,75,169,2,113,180,1,113,60,82,2,82,2,113,7,
+    113,213,2,248,13,115,4,0,0,0,4,6,255,128,113,214,
+    2,67,4,0,0,4,8,134,1,115,14,0,0,0,100,1,
+    124,0,160,0,124,1,161,1,105,1,83,0,41,3,113,215,
+    2,113,248,1,78,41,1,113,213,2,82,42,82,2,82,2,
+    113,7,113,216,2,136,14,115,4,0,0,0,14,12,255,128,
+    113,217,2,67,8,0,0,8,8,134,1,115,12,0,0,0,
+    124,0,160,0,124,2,124,3,161,2,83,0,41,2,113,218,
+    2,78,41,1,113,219,2,41,4,113,180,1,113,170,1,113,
+    220,2,113,40,82,2,82,2,113,7,113,221,2,164,14,115,
+    4,0,0,0,12,8,255,128,113,222,2,67,6,0,0,6,
+    2,134,1,82,5,41,2,113,223,2,78,82,2,41,3,113,
+    180,1,113,60,113,40,82,2,82,2,113,7,113,219,2,184,
+    14,82,40,113,224,2,67,4,0,0,10,20,134,1,115,70,
+    0,0,0,124,0,160,0,124,1,161,1,125,2,122,10,124,
+    0,160,1,124,2,161,1,125,3,87,0,116,4,124,3,131,
+    1,83,0,4,0,116,2,121,34,1,0,125,4,1,0,122,
+    7,116,3,100,1,124,1,100,2,141,2,124,4,130,2,100,
+    3,125,4,126,4,119,1,119,0,41,4,113,225,2,113,226,
+    2,82,26,78,41,5,113,140,2,113,227,2,113,75,113,179,
+    1,113,136,2,41,5,113,180,1,113,206,1,113,60,113,132,
+    2,113,228,2,82,2,82,2,113,7,113,229,2,198,14,115,
+    26,0,0,0,10,2,2,1,12,1,8,4,14,253,4,1,
+    2,1,4,255,2,1,2,255,8,128,2,255,255,128,113,230,
+    2,82,24,41,1,113,231,2,67,6,0,2,8,16,134,1,
+    115,22,0,0,0,116,0,106,1,116,2,124,1,124,2,100,
+    1,100,2,124,3,100,3,141,6,83,0,41,5,113,232,2,
+    113,203,2,84,41,2,113,233,2,113,128,1,78,41,3,113,
+    199,1,113,202,2,113,234,2,41,4,113,180,1,113,40,113,
+    60,113,231,2,82,2,82,2,113,7,113,235,2,218,14,115,
+    8,0,0,0,12,5,4,1,6,255,255,128,113,236,2,67,
+    4,0,0,30,18,134,1,115,12,2,0,0,124,0,160,0,
+    124,1,161,1,125,2,100,1,125,3,100,1,125,4,100,1,
+    125,5,100,2,125,6,100,3,125,7,122,6,116,1,124,2,
+    131,1,125,8,87,0,110,11,4,0,116,2,144,1,121,5,
+    1,0,1,0,1,0,100,1,125,8,89,0,110,143,122,7,
+    124,0,160,3,124,2,161,1,125,9,87,0,110,9,4,0,
+    116,4,144,1,121,4,1,0,1,0,1,0,89,0,110,126,
+    116,5,124,9,100,4,25,0,131,1,125,3,122,7,124,0,
+    160,6,124,8,161,1,125,10,87,0,110,9,4,0,116,4,
+    144,1,121,3,1,0,1,0,1,0,89,0,110,103,124,1,
+    124,8,100,5,156,2,125,11,122,71,116,7,124,10,124,1,
+    124,11,131,3,125,12,116,8,124,10,131,1,100,6,100,1,
+    133,2,25,0,125,13,124,12,100,7,64,0,100,8,107,3,
+    125,6,124,6,114,138,124,12,100,9,64,0,100,8,107,3,
+    125,7,116,9,106,10,100,10,107,3,114,137,124,7,115,119,
+    116,9,106,10,100,11,107,2,114,137,124,0,160,6,124,2,
+    161,1,125,4,116,9,160,11,116,12,124,4,161,2,125,5,
+    116,13,124,10,124,5,124,1,124,11,131,4,1,0,110,10,
+    116,14,124,10,124,3,124,9,100,12,25,0,124,1,124,11,
+    131,5,1,0,87,0,110,11,4,0,116,15,116,16,102,2,
+    144,1,121,2,1,0,1,0,1,0,89,0,110,15,116,17,
+    160,18,100,13,124,8,124,2,161,3,1,0,116,19,124,13,
+    124,1,124,8,124,2,100,14,141,4,83,0,124,4,100,1,
+    117,0,114,185,124,0,160,6,124,2,161,1,125,4,124,0,
+    160,20,124,4,124,2,161,2,125,14,116,17,160,18,100,15,
+    124,2,161,2,1,0,116,21,106,22,115,255,124,8,100,1,
+    117,1,114,255,124,3,100,1,117,1,114,255,124,6,114,226,
+    124,5,100,1,117,0,114,219,116,9,160,11,124,4,161,1,
+    125,5,116,23,124,14,124,5,124,7,131,3,125,10,110,8,
+    116,24,124,14,124,3,116,25,124,4,131,1,131,3,125,10,
+    122,10,124,0,160,26,124,2,124,8,124,10,161,3,1,0,
+    87,0,124,14,83,0,4,0,116,2,144,1,121,1,1,0,
+    1,0,1,0,89,0,124,14,83,0,124,14,83,0,119,0,
+    119,0,119,0,119,0,119,0,41,16,113,237,2,78,70,84,
+    113,248,1,82,32,82,28,82,1,82,0,82,13,113,238,2,
+    113,239,2,113,240,2,113,241,2,41,3,113,178,1,113,167,
+    1,113,170,1,113,242,2,41,27,113,140,2,113,145,1,113,
+    127,113,216,2,113,75,113,34,113,227,2,113,223,1,113,243,
+    2,113,240,1,113,244,2,113,231,1,113,245,2,113,232,1,
+    113,228,1,113,179,1,113,220,1,113,199,1,113,219,1,113,
+    243,1,113,235,2,113,18,113,246,2,113,252,1,113,249,1,
+    113,4,113,221,2,41,15,113,180,1,113,206,1,113,170,1,
+    113,226,1,113,132,2,113,231,1,113,247,2,113,248,2,113,
+    167,1,113,249,2,113,40,113,221,1,113,19,113,250,2,113,
+    251,2,82,2,82,2,113,7,113,201,2,234,14,115,170,0,
+    0,0,10,7,4,1,4,1,4,1,4,1,4,1,2,1,
+    12,1,14,1,8,1,2,2,14,1,14,1,4,1,12,2,
+    2,1,14,1,14,1,4,1,2,3,2,1,6,254,2,4,
+    12,1,16,1,12,1,4,1,12,1,10,1,2,1,2,255,
+    8,2,2,254,10,3,4,1,2,1,2,1,4,254,8,4,
+    2,1,4,255,2,128,2,3,2,1,2,1,6,1,2,1,
+    2,1,4,251,4,128,18,7,4,1,8,2,2,1,4,255,
+    6,2,2,1,2,1,6,254,8,3,10,1,12,1,12,1,
+    14,1,6,1,2,255,4,2,8,1,10,1,14,1,6,2,
+    6,1,4,255,2,2,16,1,4,3,14,254,2,1,8,1,
+    2,254,2,233,2,225,2,250,2,251,255,128,113,252,2,78,
+    41,10,113,187,1,113,186,1,113,188,1,113,213,2,113,216,
+    2,113,221,2,113,219,2,113,229,2,113,235,2,113,201,2,
+    82,2,82,2,82,2,113,7,113,211,2,244,13,115,18,0,
+    0,0,8,0,8,2,8,8,8,14,8,10,8,7,14,10,
+    12,8,255,128,113,211,2,67,0,0,0,0,8,0,115,92,
+    0,0,0,101,0,90,1,100,0,90,2,100,1,90,3,100,
+    2,100,3,132,0,90,4,100,4,100,5,132,0,90,5,100,
+    6,100,7,132,0,90,6,101,7,135,0,102,1,100,8,100,
+    9,132,8,131,1,90,8,101,7,100,10,100,11,132,0,131,
+    1,90,9,100,12,100,13,132,0,90,10,101,7,100,14,100,
+    15,132,0,131,1,90,11,135,0,4,0,90,12,83,0,41,
+    16,113,253,2,113,254,2,67,6,0,0,6,4,134,1,115,
+    16,0,0,0,124,1,124,0,95,0,124,2,124,0,95,1,
+    100,1,83,0,41,2,113,255,2,78,82,32,41,3,113,180,
+    1,113,206,1,113,60,82,2,82,2,113,7,113,192,2,158,
+    16,115,6,0,0,0,6,3,10,1,255,128,113,128,3,67,
+    4,0,0,4,4,134,1,243,24,0,0,0,124,0,106,0,
+    124,1,106,0,107,2,111,11,124,0,106,1,124,1,106,1,
+    107,2,83,0,82,17,169,2,113,129,3,113,193,1,169,2,
+    113,180,1,113,130,3,82,2,82,2,113,7,113,131,3,170,
+    16,243,8,0,0,0,12,1,10,1,2,255,255,128,113,132,
+    3,67,2,0,0,2,6,134,1,243,20,0,0,0,116,0,
+    124,0,106,1,131,1,116,0,124,0,106,2,131,1,65,0,
+    83,0,82,17,169,3,113,133,3,113,178,1,113,60,169,1,
+    113,180,1,82,2,82,2,113,7,113,134,3,178,16,243,4,
+    0,0,0,20,1,255,128,113,135,3,67,4,0,0,4,6,
+    6,115,16,0,0,0,116,0,116,1,124,0,131,2,160,2,
+    124,1,161,1,83,0,41,2,113,136,3,78,41,3,113,137,
+    3,113,253,2,113,209,2,82,41,169,1,113,129,3,82,2,
+    113,7,113,209,2,184,16,115,4,0,0,0,16,10,255,128,
+    113,138,3,67,4,0,0,4,2,134,1,243,6,0,0,0,
+    124,0,106,0,83,0,169,2,113,139,3,78,82,18,82,41,
+    82,2,82,2,113,7,113,140,2,208,16,243,4,0,0,0,
+    6,3,255,128,113,140,3,67,4,0,0,6,16,134,1,115,
+    128,0,0,0,116,0,124,0,116,1,116,2,102,2,131,2,
+    114,36,116,3,160,4,116,5,124,1,131,1,161,1,143,12,
+    125,2,124,2,160,6,161,0,87,0,2,0,100,1,4,0,
+    4,0,131,3,1,0,83,0,49,0,115,29,119,1,1,0,
+    1,0,1,0,89,0,1,0,100,1,83,0,116,3,160,7,
+    124,1,100,2,161,2,143,12,125,2,124,2,160,6,161,0,
+    87,0,2,0,100,1,4,0,4,0,131,3,1,0,83,0,
+    49,0,115,57,119,1,1,0,1,0,1,0,89,0,1,0,
+    100,1,83,0,41,3,113,141,3,78,113,142,3,41,8,113,
+    238,1,113,211,2,113,143,3,113,98,113,144,3,113,129,1,
+    113,145,3,113,99,41,3,113,180,1,113,60,113,104,82,2,
+    82,2,113,7,113,227,2,218,16,115,16,0,0,0,14,2,
+    16,1,22,1,20,128,14,2,22,1,20,128,255,128,113,146,
+    3,67,4,0,0,6,4,134,1,115,20,0,0,0,100,1,
+    100,2,108,0,109,1,125,2,1,0,124,2,124,0,131,1,
+    83,0,41,3,78,82,0,41,1,113,147,3,41,2,113,148,
+    3,113,147,3,41,3,113,180,1,113,204,2,113,147,3,82,
+    2,82,2,113,7,113,149,3,236,16,115,6,0,0,0,12,
+    2,8,1,255,128,113,150,3,41,13,113,187,1,113,186,1,
+    113,188,1,113,189,1,113,192,2,113,131,3,113,134,3,113,
+    200,1,113,209,2,113,140,2,113,227,2,113,149,3,113,151,
+    3,82,2,82,2,82,51,113,7,113,253,2,148,16,115,26,
+    0,0,0,8,0,4,2,8,3,8,6,8,4,2,3,14,
+    1,2,11,10,1,8,4,2,9,18,1,255,128,113,253,2,
+    67,0,0,0,0,6,128,1,115,46,0,0,0,101,0,90,
+    1,100,0,90,2,100,1,90,3,100,2,100,3,132,0,90,
+    4,100,4,100,5,132,0,90,5,100,6,100,7,156,1,100,
+    8,100,9,132,2,90,6,100,10,83,0,41,11,113,152,3,
+    113,153,3,67,4,0,0,6,6,134,1,115,22,0,0,0,
+    116,0,124,1,131,1,125,2,124,2,106,1,124,2,106,2,
+    100,1,156,2,83,0,41,3,113,154,3,41,2,113,248,1,
+    113,240,2,78,41,3,113,73,113,155,3,113,156,3,41,3,
+    113,180,1,113,60,113,249,2,82,2,82,2,113,7,113,216,
+    2,128,17,115,6,0,0,0,8,2,14,1,255,128,113,157,
+    3,67,8,0,0,10,10,134,1,115,24,0,0,0,116,0,
+    124,1,131,1,125,4,124,0,106,1,124,2,124,3,124,4,
+    100,1,141,3,83,0,41,2,78,169,1,113,158,3,41,2,
+    113,175,1,113,219,2,41,5,113,180,1,113,170,1,113,167,
+    1,113,40,113,77,82,2,82,2,113,7,113,221,2,138,17,
+    115,6,0,0,0,8,2,16,1,255,128,113,159,3,82,20,
+    82,55,67,6,0,2,18,22,134,1,115,254,0,0,0,116,
+    0,124,1,131,1,92,2,125,4,125,5,103,0,125,6,124,
+    4,114,31,116,1,124,4,131,1,115,31,116,0,124,4,131,
+    1,92,2,125,4,125,7,124,6,160,2,124,7,161,1,1,
+    0,124,4,114,31,116,1,124,4,131,1,114,14,116,3,124,
+    6,131,1,68,0,93,48,125,7,116,4,124,4,124,7,131,
+    2,125,4,122,7,116,5,160,6,124,4,161,1,1,0,87,
+    0,113,35,4,0,116,7,121,58,1,0,1,0,1,0,89,
+    0,113,35,4,0,116,8,121,126,1,0,125,8,1,0,122,
+    15,116,9,160,10,100,1,124,4,124,8,161,3,1,0,87,
+    0,89,0,100,2,125,8,126,8,1,0,100,2,83,0,100,
+    2,125,8,126,8,119,1,122,15,116,11,124,1,124,2,124,
+    3,131,3,1,0,116,9,160,10,100,3,124,1,161,2,1,
+    0,87,0,100,2,83,0,4,0,116,8,121,125,1,0,125,
+    8,1,0,122,14,116,9,160,10,100,1,124,1,124,8,161,
+    3,1,0,87,0,89,0,100,2,125,8,126,8,100,2,83,
+    0,100,2,125,8,126,8,119,1,119,0,119,0,41,4,113,
+    160,3,113,161,3,78,113,162,3,41,12,113,70,113,84,113,
+    56,113,163,3,113,63,113,21,113,164,3,113,165,3,113,75,
+    113,199,1,113,219,1,113,105,41,9,113,180,1,113,60,113,
+    40,113,158,3,113,166,3,113,144,1,113,58,113,64,113,228,
+    2,82,2,82,2,113,7,113,219,2,148,17,115,58,0,0,
+    0,12,2,4,1,12,2,12,1,10,1,12,254,12,4,10,
+    1,2,1,14,1,12,1,4,2,14,1,6,3,4,1,4,
+    255,16,2,8,128,2,1,12,1,18,1,14,1,8,2,2,
+    1,18,255,8,128,2,254,2,247,255,128,113,167,3,78,41,
+    7,113,187,1,113,186,1,113,188,1,113,189,1,113,216,2,
+    113,221,2,113,219,2,82,2,82,2,82,2,113,7,113,152,
+    3,248,16,115,12,0,0,0,8,0,4,2,8,2,8,5,
+    18,5,255,128,113,152,3,67,0,0,0,0,4,128,1,115,
+    32,0,0,0,101,0,90,1,100,0,90,2,100,1,90,3,
+    100,2,100,3,132,0,90,4,100,4,100,5,132,0,90,5,
+    100,6,83,0,41,7,113,168,3,113,169,3,67,4,0,0,
+    10,10,134,1,115,68,0,0,0,124,0,160,0,124,1,161,
+    1,125,2,124,0,160,1,124,2,161,1,125,3,124,1,124,
+    2,100,1,156,2,125,4,116,2,124,3,124,1,124,4,131,
+    3,1,0,116,3,116,4,124,3,131,1,100,2,100,0,133,
+    2,25,0,124,1,124,2,100,3,141,3,83,0,41,4,78,
+    82,32,82,28,41,2,113,178,1,113,167,1,41,5,113,140,
+    2,113,227,2,113,223,1,113,243,1,113,243,2,41,5,113,
+    180,1,113,206,1,113,60,113,40,113,221,1,82,2,82,2,
+    113,7,113,201,2,218,17,115,24,0,0,0,10,1,10,1,
+    2,4,2,1,6,254,12,4,2,1,14,1,2,1,2,1,
+    6,253,255,128,113,170,3,67,4,0,0,4,2,134,1,82,
+    5,41,2,113,171,3,78,82,2,82,41,82,2,82,2,113,
+    7,113,229,2,250,17,82,6,113,172,3,78,41,6,113,187,
+    1,113,186,1,113,188,1,113,189,1,113,201,2,113,229,2,
+    82,2,82,2,82,2,113,7,113,168,3,210,17,115,10,0,
+    0,0,8,0,4,2,8,2,12,16,255,128,113,168,3,67,
+    0,0,0,0,6,128,1,115,92,0,0,0,101,0,90,1,
+    100,0,90,2,100,1,90,3,100,2,100,3,132,0,90,4,
+    100,4,100,5,132,0,90,5,100,6,100,7,132,0,90,6,
+    100,8,100,9,132,0,90,7,100,10,100,11,132,0,90,8,
+    100,12,100,13,132,0,90,9,100,14,100,15,132,0,90,10,
+    100,16,100,17,132,0,90,11,101,12,100,18,100,19,132,0,
+    131,1,90,13,100,20,83,0,41,21,113,143,3,113,173,3,
+    67,6,0,0,6,4,134,1,115,16,0,0,0,124,1,124,
+    0,95,0,124,2,124,0,95,1,100,0,83,0,82,17,82,
+    32,41,3,113,180,1,113,178,1,113,60,82,2,82,2,113,
+    7,113,192,2,148,18,115,6,0,0,0,6,1,10,1,255,
+    128,113,174,3,67,4,0,0,4,4,134,1,82,43,82,17,
+    82,44,82,45,82,2,82,2,113,7,113,131,3,156,18,82,
+    46,113,175,3,67,2,0,0,2,6,134,1,82,47,82,17,
+    82,48,82,49,82,2,82,2,113,7,113,134,3,164,18,82,
+    50,113,176,3,67,4,0,0,6,10,134,1,115,36,0,0,
+    0,116,0,160,1,116,2,106,3,124,1,161,2,125,2,116,
+    0,160,4,100,1,124,1,106,5,124,0,106,6,161,3,1,
+    0,124,2,83,0,41,3,113,177,3,113,178,3,78,41,7,
+    113,199,1,113,202,2,113,240,1,113,179,3,113,219,1,113,
+    178,1,113,60,41,3,113,180,1,113,148,2,113,204,2,82,
+    2,82,2,113,7,113,197,2,170,18,115,16,0,0,0,4,
+    2,6,1,4,255,6,2,8,1,4,255,4,2,255,128,113,
+    180,3,67,4,0,0,4,10,134,1,115,36,0,0,0,116,
+    0,160,1,116,2,106,3,124,1,161,2,1,0,116,0,160,
+    4,100,1,124,0,106,5,124,0,106,6,161,3,1,0,100,
+    2,83,0,41,3,113,181,3,113,182,3,78,41,7,113,199,
+    1,113,202,2,113,240,1,113,183,3,113,219,1,113,178,1,
+    113,60,169,2,113,180,1,113,204,2,82,2,82,2,113,7,
+    113,205,2,186,18,115,10,0,0,0,14,2,6,1,8,1,
+    8,255,255,128,113,184,3,67,4,0,0,4,8,6,115,36,
+    0,0,0,116,0,124,0,106,1,131,1,100,1,25,0,137,
+    0,116,2,135,0,102,1,100,2,100,3,132,8,116,3,68,
+    0,131,1,131,1,83,0,41,5,113,185,3,82,1,67,2,
+    0,0,4,8,102,115,28,0,0,0,129,0,124,0,93,9,
+    125,1,136,0,100,0,124,1,23,0,107,2,86,0,1,0,
+    113,2,100,1,83,0,41,2,113,192,2,78,82,2,169,2,
+    113,5,113,186,3,169,1,113,187,3,82,2,113,7,113,8,
+    204,18,115,8,0,0,0,6,128,2,1,20,255,255,128,113,
+    188,3,78,41,4,113,70,113,60,113,189,3,113,186,2,82,
+    41,82,2,82,58,113,7,113,142,2,198,18,115,10,0,0,
+    0,14,2,12,1,2,1,8,255,255,128,113,190,3,67,4,
+    0,0,4,2,134,1,82,5,41,2,113,191,3,78,82,2,
+    82,41,82,2,82,2,113,7,113,201,2,210,18,82,6,113,
+    192,3,67,4,0,0,4,2,134,1,82,5,41,2,113,193,
+    3,78,82,2,82,41,82,2,82,2,113,7,113,229,2,218,
+    18,82,6,113,194,3,67,4,0,0,4,2,134,1,82,52,
+    82,53,82,18,82,41,82,2,82,2,113,7,113,140,2,226,
+    18,82,54,113,195,3,78,41,14,113,187,1,113,186,1,113,
+    188,1,113,189,1,113,192,2,113,131,3,113,134,3,113,197,
+    2,113,205,2,113,142,2,113,201,2,113,229,2,113,200,1,
+    113,140,2,82,2,82,2,82,2,113,7,113,143,3,132,18,
+    115,26,0,0,0,8,0,4,2,8,6,8,4,8,4,8,
+    3,8,8,8,6,8,6,8,4,2,4,14,1,255,128,113,
+    143,3,67,0,0,0,0,4,128,1,115,104,0,0,0,101,
+    0,90,1,100,0,90,2,100,1,90,3,100,2,100,3,132,
+    0,90,4,100,4,100,5,132,0,90,5,100,6,100,7,132,
+    0,90,6,100,8,100,9,132,0,90,7,100,10,100,11,132,
+    0,90,8,100,12,100,13,132,0,90,9,100,14,100,15,132,
+    0,90,10,100,16,100,17,132,0,90,11,100,18,100,19,132,
+    0,90,12,100,20,100,21,132,0,90,13,100,22,100,23,132,
+    0,90,14,100,24,83,0,41,25,113,196,3,113,197,3,67,
+    8,0,0,8,6,134,1,115,36,0,0,0,124,1,124,0,
+    95,0,124,2,124,0,95,1,116,2,124,0,160,3,161,0,
+    131,1,124,0,95,4,124,3,124,0,95,5,100,0,83,0,
+    82,17,41,6,113,198,3,113,199,3,113,172,1,113,200,3,
+    113,201,3,113,202,3,169,4,113,180,1,113,178,1,113,60,
+    113,203,3,82,2,82,2,113,7,113,192,2,252,18,115,10,
+    0,0,0,6,1,6,1,14,1,10,1,255,128,113,204,3,
+    67,2,0,0,8,6,134,1,115,38,0,0,0,124,0,106,
+    0,160,1,100,1,161,1,92,3,125,1,125,2,125,3,124,
+    2,100,2,107,2,114,15,100,3,83,0,124,1,100,4,102,
+    2,83,0,41,6,113,205,3,113,115,113,9,41,2,113,18,
+    113,60,113,206,3,78,41,2,113,198,3,113,124,41,4,113,
+    180,1,113,166,3,113,207,3,113,208,3,82,2,82,2,113,
+    7,113,209,3,136,19,115,10,0,0,0,18,2,8,1,4,
+    2,8,3,255,128,113,210,3,67,2,0,0,6,6,134,1,
+    115,28,0,0,0,124,0,160,0,161,0,92,2,125,1,125,
+    2,116,1,116,2,106,3,124,1,25,0,124,2,131,2,83,
+    0,82,17,41,4,113,209,3,113,192,1,113,18,113,211,3,
+    41,3,113,180,1,113,212,3,113,213,3,82,2,82,2,113,
+    7,113,200,3,156,19,115,6,0,0,0,12,1,16,1,255,
+    128,113,214,3,67,2,0,0,6,8,134,1,115,80,0,0,
+    0,116,0,124,0,160,1,161,0,131,1,125,1,124,1,124,
+    0,106,2,107,3,114,37,124,0,160,3,124,0,106,4,124,
+    1,161,2,125,2,124,2,100,0,117,1,114,34,124,2,106,
+    5,100,0,117,0,114,34,124,2,106,6,114,34,124,2,106,
+    6,124,0,95,7,124,1,124,0,95,2,124,0,106,7,83,
+    0,82,17,41,8,113,172,1,113,200,3,113,201,3,113,202,
+    3,113,198,3,113,207,1,113,137,2,113,199,3,41,3,113,
+    180,1,113,215,3,113,148,2,82,2,82,2,113,7,113,216,
+    3,164,19,115,18,0,0,0,12,2,10,1,14,1,18,3,
+    6,1,8,1,6,1,6,1,255,128,113,217,3,67,2,0,
+    0,2,6,134,1,243,12,0,0,0,116,0,124,0,160,1,
+    161,0,131,1,83,0,82,17,41,2,113,218,3,113,216,3,
+    82,49,82,2,82,2,113,7,113,219,3,190,19,243,4,0,
+    0,0,12,1,255,128,113,220,3,67,4,0,0,4,4,134,
+    1,115,12,0,0,0,124,0,160,0,161,0,124,1,25,0,
+    83,0,82,17,169,1,113,216,3,41,2,113,180,1,113,221,
+    3,82,2,82,2,113,7,113,222,3,196,19,82,61,113,223,
+    3,67,6,0,0,6,6,134,1,115,14,0,0,0,124,2,
+    124,0,106,0,124,1,60,0,100,0,83,0,82,17,41,1,
+    113,199,3,41,3,113,180,1,113,221,3,113,60,82,2,82,
+    2,113,7,113,224,3,202,19,115,4,0,0,0,14,1,255,
+    128,113,225,3,67,2,0,0,2,6,134,1,82,60,82,17,
+    41,2,113,4,113,216,3,82,49,82,2,82,2,113,7,113,
+    226,3,208,19,82,61,113,227,3,67,2,0,0,2,6,134,
+    1,243,12,0,0,0,100,1,160,0,124,0,106,1,161,1,
+    83,0,41,2,78,113,228,3,41,2,113,92,113,199,3,82,
+    49,82,2,82,2,113,7,113,229,3,214,19,82,61,113,230,
+    3,67,4,0,0,4,6,134,1,115,12,0,0,0,124,1,
+    124,0,160,0,161,0,118,0,83,0,82,17,82,62,169,2,
+    113,180,1,113,231,3,82,2,82,2,113,7,113,232,3,220,
+    19,82,61,113,233,3,67,4,0,0,4,6,134,1,115,16,
+    0,0,0,124,0,106,0,160,1,124,1,161,1,1,0,100,
+    0,83,0,82,17,41,2,113,199,3,113,56,82,64,82,2,
+    82,2,113,7,113,56,226,19,243,4,0,0,0,16,1,255,
+    128,113,234,3,78,41,15,113,187,1,113,186,1,113,188,1,
+    113,189,1,113,192,2,113,209,3,113,200,3,113,216,3,113,
+    219,3,113,222,3,113,224,3,113,226,3,113,229,3,113,232,
+    3,113,56,82,2,82,2,82,2,113,7,113,196,3,238,18,
+    115,28,0,0,0,8,0,4,1,8,6,8,6,8,10,8,
+    4,8,13,8,3,8,3,8,3,8,3,8,3,12,3,255,
+    128,113,196,3,67,0,0,0,0,6,128,1,115,88,0,0,
+    0,101,0,90,1,100,0,90,2,100,1,100,2,132,0,90,
+    3,101,4,100,3,100,4,132,0,131,1,90,5,100,5,100,
+    6,132,0,90,6,100,7,100,8,132,0,90,7,100,9,100,
+    10,132,0,90,8,100,11,100,12,132,0,90,9,100,13,100,
+    14,132,0,90,10,100,15,100,16,132,0,90,11,100,17,100,
+    18,132,0,90,12,100,19,83,0,41,20,113,235,3,67,8,
+    0,0,8,8,134,1,115,18,0,0,0,116,0,124,1,124,
+    2,124,3,131,3,124,0,95,1,100,0,83,0,82,17,41,
+    2,113,196,3,113,199,3,82,59,82,2,82,2,113,7,113,
+    192,2,238,19,115,4,0,0,0,18,1,255,128,113,236,3,
+    67,2,0,0,2,8,134,1,115,24,0,0,0,116,0,160,
+    1,100,1,116,2,161,2,1,0,100,2,160,3,124,0,106,
+    4,161,1,83,0,41,4,113,237,3,113,238,3,113,239,3,
+    78,41,5,113,119,113,120,113,121,113,92,113,187,1,41,1,
+    113,204,2,82,2,82,2,113,7,113,240,3,244,19,115,10,
+    0,0,0,6,7,2,1,4,255,12,2,255,128,113,241,3,
+    67,4,0,0,4,2,134,1,82,5,41,2,78,84,82,2,
+    82,41,82,2,82,2,113,7,113,142,2,138,20,243,4,0,
+    0,0,4,1,255,128,113,242,3,67,4,0,0,4,2,134,
+    1,82,5,41,2,78,113,9,82,2,82,41,82,2,82,2,
+    113,7,113,229,2,144,20,82,66,113,243,3,67,4,0,0,
+    4,12,134,1,115,16,0,0,0,116,0,100,1,100,2,100,
+    3,100,4,100,5,141,4,83,0,41,6,78,113,9,113,244,
+    3,113,203,2,84,41,1,113,233,2,41,1,113,234,2,82,
+    41,82,2,82,2,113,7,113,201,2,150,20,82,65,113,245,
+    3,67,4,0,0,4,2,134,1,82,5,82,38,82,2,82,
+    39,82,2,82,2,113,7,113,197,2,156,20,82,40,113,246,
+    3,67,4,0,0,4,2,134,1,115,4,0,0,0,100,0,
+    83,0,82,17,82,2,82,56,82,2,82,2,113,7,113,205,
+    2,162,20,82,66,113,247,3,67,4,0,0,4,8,134,1,
+    115,26,0,0,0,116,0,160,1,100,1,124,0,106,2,161,
+    2,1,0,116,0,160,3,124,0,124,1,161,2,83,0,41,
+    3,113,248,3,113,249,3,78,41,4,113,199,1,113,219,1,
+    113,199,3,113,208,2,82,41,82,2,82,2,113,7,113,209,
+    2,168,20,115,10,0,0,0,6,7,4,1,4,255,12,3,
+    255,128,113,250,3,67,4,0,0,6,4,134,1,115,22,0,
+    0,0,100,1,100,2,108,0,109,1,125,2,1,0,124,2,
+    124,0,106,2,131,1,83,0,41,3,78,82,0,41,1,113,
+    251,3,41,3,113,148,3,113,251,3,113,199,3,41,3,113,
+    180,1,113,204,2,113,251,3,82,2,82,2,113,7,113,149,
+    3,192,20,115,6,0,0,0,12,1,10,1,255,128,113,252,
+    3,78,41,13,113,187,1,113,186,1,113,188,1,113,192,2,
+    113,187,2,113,240,3,113,142,2,113,229,2,113,201,2,113,
+    197,2,113,205,2,113,209,2,113,149,3,82,2,82,2,82,
+    2,113,7,113,235,3,236,19,115,24,0,0,0,8,0,8,
+    1,2,3,10,1,8,10,8,3,8,3,8,3,8,3,8,
+    3,12,12,255,128,113,235,3,67,0,0,0,0,8,128,1,
+    115,118,0,0,0,101,0,90,1,100,0,90,2,100,1,90,
+    3,101,4,100,2,100,3,132,0,131,1,90,5,101,4,100,
+    4,100,5,132,0,131,1,90,6,101,7,100,6,100,7,132,
+    0,131,1,90,8,101,7,100,8,100,9,132,0,131,1,90,
+    9,101,7,100,19,100,11,100,12,132,1,131,1,90,10,101,
+    7,100,20,100,13,100,14,132,1,131,1,90,11,101,7,100,
+    19,100,15,100,16,132,1,131,1,90,12,101,4,100,17,100,
+    18,132,0,131,1,90,13,100,10,83,0,41,21,113,253,3,
+    113,254,3,67,0,0,0,4,8,134,1,115,64,0,0,0,
+    116,0,116,1,106,2,160,3,161,0,131,1,68,0,93,22,
+    92,2,125,0,125,1,124,1,100,1,117,0,114,20,116,1,
+    106,2,124,0,61,0,113,7,116,4,124,1,100,2,131,2,
+    114,29,124,1,160,5,161,0,1,0,113,7,100,1,83,0,
+    41,3,113,255,3,78,113,128,4,41,6,113,129,4,113,18,
+    113,130,4,113,131,4,113,190,1,113,128,4,41,2,113,178,
+    1,113,132,4,82,2,82,2,113,7,113,128,4,214,20,115,
+    16,0,0,0,22,4,8,1,10,1,10,1,8,1,2,128,
+    4,252,255,128,113,133,4,67,2,0,0,4,18,134,1,115,
+    76,0,0,0,116,0,106,1,100,1,117,1,114,14,116,0,
+    106,1,115,14,116,2,160,3,100,2,116,4,161,2,1,0,
+    116,0,106,1,68,0,93,17,125,1,122,7,124,1,124,0,
+    131,1,87,0,2,0,1,0,83,0,4,0,116,5,121,37,
+    1,0,1,0,1,0,89,0,113,17,100,1,83,0,119,0,
+    41,3,113,134,4,78,113,135,4,41,6,113,18,113,136,4,
+    113,119,113,120,113,205,1,113,179,1,41,2,113,60,113,137,
+    4,82,2,82,2,113,7,113,138,4,234,20,115,20,0,0,
+    0,16,3,12,1,10,1,2,1,14,1,12,1,4,1,4,
+    2,2,253,255,128,113,139,4,67,4,0,0,6,16,134,1,
+    115,100,0,0,0,124,1,100,1,107,2,114,20,122,6,116,
+    0,160,1,161,0,125,1,87,0,110,9,4,0,116,2,121,
+    49,1,0,1,0,1,0,89,0,100,2,83,0,122,8,116,
+    3,106,4,124,1,25,0,125,2,87,0,124,2,83,0,4,
+    0,116,5,121,48,1,0,1,0,1,0,124,0,160,6,124,
+    1,161,1,125,2,124,2,116,3,106,4,124,1,60,0,89,
+    0,124,2,83,0,119,0,119,0,41,3,113,140,4,113,9,
+    78,41,7,113,21,113,83,113,141,4,113,18,113,130,4,113,
+    142,4,113,138,4,41,3,113,171,2,113,60,113,132,4,82,
+    2,82,2,113,7,113,143,4,132,21,115,30,0,0,0,8,
+    8,2,1,12,1,12,1,6,3,2,1,12,1,4,4,12,
+    253,10,1,12,1,4,1,2,253,2,250,255,128,113,144,4,
+    67,6,0,0,14,8,134,1,115,138,0,0,0,116,0,124,
     2,100,1,131,2,114,27,116,1,160,2,124,2,161,1,155,
     0,100,2,157,2,125,3,116,3,160,4,124,3,116,5,161,
     2,1,0,124,2,160,6,124,1,161,1,92,2,125,4,125,
@@ -2231,550 +2228,257 @@ const unsigned char _Py_M__importlib_bootstrap_external[] = {
     2,160,7,124,1,161,1,125,4,103,0,125,5,124,4,100,
     0,117,1,114,58,116,1,160,8,124,1,124,4,161,2,83,
     0,116,1,160,9,124,1,100,0,161,2,125,6,124,5,124,
-    6,95,10,124,6,83,0,41,4,78,114,161,0,0,0,122,
-    53,46,102,105,110,100,95,115,112,101,99,40,41,32,110,111,
-    116,32,102,111,117,110,100,59,32,102,97,108,108,105,110,103,
-    32,98,97,99,107,32,116,111,32,102,105,110,100,95,108,111,
-    97,100,101,114,40,41,122,53,46,102,105,110,100,95,115,112,
-    101,99,40,41,32,110,111,116,32,102,111,117,110,100,59,32,
-    102,97,108,108,105,110,103,32,98,97,99,107,32,116,111,32,
-    102,105,110,100,95,109,111,100,117,108,101,40,41,41,11,114,
-    153,0,0,0,114,159,0,0,0,90,12,95,111,98,106,101,
-    99,116,95,110,97,109,101,114,99,0,0,0,114,100,0,0,
-    0,114,162,0,0,0,114,161,0,0,0,114,229,0,0,0,
-    114,224,0,0,0,114,207,0,0,0,114,202,0,0,0,41,
-    7,114,221,0,0,0,114,163,0,0,0,114,82,1,0,0,
-    114,166,0,0,0,114,164,0,0,0,114,165,0,0,0,114,
-    210,0,0,0,114,7,0,0,0,114,7,0,0,0,114,8,
-    0,0,0,218,16,95,108,101,103,97,99,121,95,103,101,116,
-    95,115,112,101,99,87,5,0,0,115,28,0,0,0,10,4,
-    16,1,12,2,16,1,16,2,12,2,10,1,4,1,8,1,
-    12,1,12,1,6,1,4,1,255,128,122,27,80,97,116,104,
-    70,105,110,100,101,114,46,95,108,101,103,97,99,121,95,103,
-    101,116,95,115,112,101,99,78,99,4,0,0,0,0,0,0,
-    0,0,0,0,0,9,0,0,0,5,0,0,0,67,0,0,
-    0,115,166,0,0,0,103,0,125,4,124,2,68,0,93,67,
-    125,5,116,0,124,5,116,1,116,2,102,2,131,2,115,14,
-    113,4,124,0,160,3,124,5,161,1,125,6,124,6,100,1,
-    117,1,114,71,116,4,124,6,100,2,131,2,114,35,124,6,
-    160,5,124,1,124,3,161,2,125,7,110,6,124,0,160,6,
-    124,1,124,6,161,2,125,7,124,7,100,1,117,0,114,46,
-    113,4,124,7,106,7,100,1,117,1,114,55,124,7,2,0,
-    1,0,83,0,124,7,106,8,125,8,124,8,100,1,117,0,
-    114,66,116,9,100,3,131,1,130,1,124,4,160,10,124,8,
-    161,1,1,0,113,4,116,11,160,12,124,1,100,1,161,2,
-    125,7,124,4,124,7,95,8,124,7,83,0,41,4,122,63,
-    70,105,110,100,32,116,104,101,32,108,111,97,100,101,114,32,
-    111,114,32,110,97,109,101,115,112,97,99,101,95,112,97,116,
-    104,32,102,111,114,32,116,104,105,115,32,109,111,100,117,108,
-    101,47,112,97,99,107,97,103,101,32,110,97,109,101,46,78,
-    114,226,0,0,0,122,19,115,112,101,99,32,109,105,115,115,
-    105,110,103,32,108,111,97,100,101,114,41,13,114,185,0,0,
-    0,114,109,0,0,0,218,5,98,121,116,101,115,114,87,1,
-    0,0,114,153,0,0,0,114,226,0,0,0,114,88,1,0,
-    0,114,164,0,0,0,114,202,0,0,0,114,142,0,0,0,
-    114,191,0,0,0,114,159,0,0,0,114,207,0,0,0,41,
-    9,114,221,0,0,0,114,163,0,0,0,114,65,0,0,0,
-    114,225,0,0,0,218,14,110,97,109,101,115,112,97,99,101,
-    95,112,97,116,104,90,5,101,110,116,114,121,114,82,1,0,
-    0,114,210,0,0,0,114,165,0,0,0,114,7,0,0,0,
-    114,7,0,0,0,114,8,0,0,0,218,9,95,103,101,116,
-    95,115,112,101,99,108,5,0,0,115,44,0,0,0,4,5,
-    8,1,14,1,2,1,10,1,8,1,10,1,14,1,12,2,
-    8,1,2,1,10,1,8,1,6,1,8,1,8,1,10,5,
-    2,128,12,2,6,1,4,1,255,128,122,20,80,97,116,104,
-    70,105,110,100,101,114,46,95,103,101,116,95,115,112,101,99,
-    99,4,0,0,0,0,0,0,0,0,0,0,0,6,0,0,
-    0,5,0,0,0,67,0,0,0,115,94,0,0,0,124,2,
-    100,1,117,0,114,7,116,0,106,1,125,2,124,0,160,2,
-    124,1,124,2,124,3,161,3,125,4,124,4,100,1,117,0,
-    114,20,100,1,83,0,124,4,106,3,100,1,117,0,114,45,
-    124,4,106,4,125,5,124,5,114,43,100,1,124,4,95,5,
-    116,6,124,1,124,5,124,0,106,2,131,3,124,4,95,4,
-    124,4,83,0,100,1,83,0,124,4,83,0,41,2,122,141,
-    84,114,121,32,116,111,32,102,105,110,100,32,97,32,115,112,
-    101,99,32,102,111,114,32,39,102,117,108,108,110,97,109,101,
-    39,32,111,110,32,115,121,115,46,112,97,116,104,32,111,114,
-    32,39,112,97,116,104,39,46,10,10,32,32,32,32,32,32,
-    32,32,84,104,101,32,115,101,97,114,99,104,32,105,115,32,
-    98,97,115,101,100,32,111,110,32,115,121,115,46,112,97,116,
-    104,95,104,111,111,107,115,32,97,110,100,32,115,121,115,46,
-    112,97,116,104,95,105,109,112,111,114,116,101,114,95,99,97,
-    99,104,101,46,10,32,32,32,32,32,32,32,32,78,41,7,
-    114,15,0,0,0,114,65,0,0,0,114,91,1,0,0,114,
-    164,0,0,0,114,202,0,0,0,114,205,0,0,0,114,47,
-    1,0,0,41,6,114,221,0,0,0,114,163,0,0,0,114,
-    65,0,0,0,114,225,0,0,0,114,210,0,0,0,114,90,
-    1,0,0,114,7,0,0,0,114,7,0,0,0,114,8,0,
-    0,0,114,226,0,0,0,140,5,0,0,115,28,0,0,0,
-    8,6,6,1,14,1,8,1,4,1,10,1,6,1,4,1,
-    6,3,16,1,4,1,4,2,4,2,255,128,122,20,80,97,
-    116,104,70,105,110,100,101,114,46,102,105,110,100,95,115,112,
-    101,99,99,3,0,0,0,0,0,0,0,0,0,0,0,4,
-    0,0,0,4,0,0,0,67,0,0,0,115,42,0,0,0,
-    116,0,160,1,100,1,116,2,161,2,1,0,124,0,160,3,
-    124,1,124,2,161,2,125,3,124,3,100,2,117,0,114,18,
-    100,2,83,0,124,3,106,4,83,0,41,3,122,170,102,105,
-    110,100,32,116,104,101,32,109,111,100,117,108,101,32,111,110,
-    32,115,121,115,46,112,97,116,104,32,111,114,32,39,112,97,
-    116,104,39,32,98,97,115,101,100,32,111,110,32,115,121,115,
-    46,112,97,116,104,95,104,111,111,107,115,32,97,110,100,10,
-    32,32,32,32,32,32,32,32,115,121,115,46,112,97,116,104,
-    95,105,109,112,111,114,116,101,114,95,99,97,99,104,101,46,
-    10,10,32,32,32,32,32,32,32,32,84,104,105,115,32,109,
-    101,116,104,111,100,32,105,115,32,100,101,112,114,101,99,97,
-    116,101,100,46,32,32,85,115,101,32,102,105,110,100,95,115,
-    112,101,99,40,41,32,105,110,115,116,101,97,100,46,10,10,
-    32,32,32,32,32,32,32,32,122,101,80,97,116,104,70,105,
-    110,100,101,114,46,102,105,110,100,95,109,111,100,117,108,101,
-    40,41,32,105,115,32,100,101,112,114,101,99,97,116,101,100,
-    32,97,110,100,32,115,108,97,116,101,100,32,102,111,114,32,
-    114,101,109,111,118,97,108,32,105,110,32,80,121,116,104,111,
-    110,32,51,46,49,50,59,32,117,115,101,32,102,105,110,100,
-    95,115,112,101,99,40,41,32,105,110,115,116,101,97,100,78,
-    114,227,0,0,0,114,228,0,0,0,114,7,0,0,0,114,
-    7,0,0,0,114,8,0,0,0,114,229,0,0,0,164,5,
-    0,0,115,16,0,0,0,6,8,2,2,4,254,12,3,8,
-    1,4,1,6,1,255,128,122,22,80,97,116,104,70,105,110,
-    100,101,114,46,102,105,110,100,95,109,111,100,117,108,101,99,
-    0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,
-    4,0,0,0,79,0,0,0,115,28,0,0,0,100,1,100,
-    2,108,0,109,1,125,2,1,0,124,2,106,2,124,0,105,
-    0,124,1,164,1,142,1,83,0,41,4,97,32,1,0,0,
-    10,32,32,32,32,32,32,32,32,70,105,110,100,32,100,105,
-    115,116,114,105,98,117,116,105,111,110,115,46,10,10,32,32,
-    32,32,32,32,32,32,82,101,116,117,114,110,32,97,110,32,
-    105,116,101,114,97,98,108,101,32,111,102,32,97,108,108,32,
-    68,105,115,116,114,105,98,117,116,105,111,110,32,105,110,115,
-    116,97,110,99,101,115,32,99,97,112,97,98,108,101,32,111,
-    102,10,32,32,32,32,32,32,32,32,108,111,97,100,105,110,
-    103,32,116,104,101,32,109,101,116,97,100,97,116,97,32,102,
-    111,114,32,112,97,99,107,97,103,101,115,32,109,97,116,99,
-    104,105,110,103,32,96,96,99,111,110,116,101,120,116,46,110,
-    97,109,101,96,96,10,32,32,32,32,32,32,32,32,40,111,
-    114,32,97,108,108,32,110,97,109,101,115,32,105,102,32,96,
-    96,78,111,110,101,96,96,32,105,110,100,105,99,97,116,101,
-    100,41,32,97,108,111,110,103,32,116,104,101,32,112,97,116,
-    104,115,32,105,110,32,116,104,101,32,108,105,115,116,10,32,
-    32,32,32,32,32,32,32,111,102,32,100,105,114,101,99,116,
-    111,114,105,101,115,32,96,96,99,111,110,116,101,120,116,46,
-    112,97,116,104,96,96,46,10,32,32,32,32,32,32,32,32,
-    114,0,0,0,0,41,1,218,18,77,101,116,97,100,97,116,
-    97,80,97,116,104,70,105,110,100,101,114,78,41,3,90,18,
-    105,109,112,111,114,116,108,105,98,46,109,101,116,97,100,97,
-    116,97,114,92,1,0,0,218,18,102,105,110,100,95,100,105,
-    115,116,114,105,98,117,116,105,111,110,115,41,3,114,144,0,
-    0,0,114,145,0,0,0,114,92,1,0,0,114,7,0,0,
-    0,114,7,0,0,0,114,8,0,0,0,114,93,1,0,0,
-    180,5,0,0,115,6,0,0,0,12,10,16,1,255,128,122,
-    29,80,97,116,104,70,105,110,100,101,114,46,102,105,110,100,
-    95,100,105,115,116,114,105,98,117,116,105,111,110,115,114,69,
-    0,0,0,114,230,0,0,0,41,14,114,150,0,0,0,114,
-    149,0,0,0,114,151,0,0,0,114,152,0,0,0,114,233,
-    0,0,0,114,78,1,0,0,114,84,1,0,0,114,234,0,
-    0,0,114,87,1,0,0,114,88,1,0,0,114,91,1,0,
-    0,114,226,0,0,0,114,229,0,0,0,114,93,1,0,0,
-    114,7,0,0,0,114,7,0,0,0,114,7,0,0,0,114,
-    8,0,0,0,114,77,1,0,0,38,5,0,0,115,38,0,
-    0,0,8,0,4,2,2,2,10,1,2,9,10,1,2,12,
-    10,1,2,21,10,1,2,20,12,1,2,31,12,1,2,23,
-    12,1,2,15,14,1,255,128,114,77,1,0,0,99,0,0,
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,
-    0,0,64,0,0,0,115,90,0,0,0,101,0,90,1,100,
-    0,90,2,100,1,90,3,100,2,100,3,132,0,90,4,100,
-    4,100,5,132,0,90,5,101,6,90,7,100,6,100,7,132,
-    0,90,8,100,8,100,9,132,0,90,9,100,19,100,11,100,
-    12,132,1,90,10,100,13,100,14,132,0,90,11,101,12,100,
-    15,100,16,132,0,131,1,90,13,100,17,100,18,132,0,90,
-    14,100,10,83,0,41,20,218,10,70,105,108,101,70,105,110,
-    100,101,114,122,172,70,105,108,101,45,98,97,115,101,100,32,
-    102,105,110,100,101,114,46,10,10,32,32,32,32,73,110,116,
-    101,114,97,99,116,105,111,110,115,32,119,105,116,104,32,116,
-    104,101,32,102,105,108,101,32,115,121,115,116,101,109,32,97,
-    114,101,32,99,97,99,104,101,100,32,102,111,114,32,112,101,
-    114,102,111,114,109,97,110,99,101,44,32,98,101,105,110,103,
-    10,32,32,32,32,114,101,102,114,101,115,104,101,100,32,119,
-    104,101,110,32,116,104,101,32,100,105,114,101,99,116,111,114,
-    121,32,116,104,101,32,102,105,110,100,101,114,32,105,115,32,
-    104,97,110,100,108,105,110,103,32,104,97,115,32,98,101,101,
-    110,32,109,111,100,105,102,105,101,100,46,10,10,32,32,32,
-    32,99,2,0,0,0,0,0,0,0,0,0,0,0,5,0,
-    0,0,6,0,0,0,7,0,0,0,115,112,0,0,0,103,
-    0,125,3,124,2,68,0,93,16,92,2,137,0,125,4,124,
-    3,160,0,135,0,102,1,100,1,100,2,132,8,124,4,68,
-    0,131,1,161,1,1,0,113,4,124,3,124,0,95,1,124,
-    1,112,27,100,3,124,0,95,2,116,3,124,0,106,2,131,
-    1,115,43,116,4,116,5,160,6,161,0,124,0,106,2,131,
-    2,124,0,95,2,100,4,124,0,95,7,116,8,131,0,124,
-    0,95,9,116,8,131,0,124,0,95,10,100,5,83,0,41,
-    6,122,154,73,110,105,116,105,97,108,105,122,101,32,119,105,
-    116,104,32,116,104,101,32,112,97,116,104,32,116,111,32,115,
-    101,97,114,99,104,32,111,110,32,97,110,100,32,97,32,118,
-    97,114,105,97,98,108,101,32,110,117,109,98,101,114,32,111,
-    102,10,32,32,32,32,32,32,32,32,50,45,116,117,112,108,
-    101,115,32,99,111,110,116,97,105,110,105,110,103,32,116,104,
-    101,32,108,111,97,100,101,114,32,97,110,100,32,116,104,101,
-    32,102,105,108,101,32,115,117,102,102,105,120,101,115,32,116,
-    104,101,32,108,111,97,100,101,114,10,32,32,32,32,32,32,
-    32,32,114,101,99,111,103,110,105,122,101,115,46,99,1,0,
-    0,0,0,0,0,0,0,0,0,0,2,0,0,0,3,0,
-    0,0,51,0,0,0,115,24,0,0,0,129,0,124,0,93,
-    7,125,1,124,1,136,0,102,2,86,0,1,0,113,2,100,
-    0,83,0,114,69,0,0,0,114,7,0,0,0,114,43,1,
-    0,0,169,1,114,164,0,0,0,114,7,0,0,0,114,8,
-    0,0,0,114,9,0,0,0,209,5,0,0,115,6,0,0,
-    0,6,128,18,0,255,128,122,38,70,105,108,101,70,105,110,
-    100,101,114,46,95,95,105,110,105,116,95,95,46,60,108,111,
-    99,97,108,115,62,46,60,103,101,110,101,120,112,114,62,114,
-    97,0,0,0,114,130,0,0,0,78,41,11,114,191,0,0,
-    0,218,8,95,108,111,97,100,101,114,115,114,65,0,0,0,
-    114,86,0,0,0,114,67,0,0,0,114,18,0,0,0,114,
-    82,0,0,0,218,11,95,112,97,116,104,95,109,116,105,109,
-    101,218,3,115,101,116,218,11,95,112,97,116,104,95,99,97,
-    99,104,101,218,19,95,114,101,108,97,120,101,100,95,112,97,
-    116,104,95,99,97,99,104,101,41,5,114,143,0,0,0,114,
-    65,0,0,0,218,14,108,111,97,100,101,114,95,100,101,116,
-    97,105,108,115,90,7,108,111,97,100,101,114,115,114,212,0,
-    0,0,114,7,0,0,0,114,95,1,0,0,114,8,0,0,
-    0,114,236,0,0,0,203,5,0,0,115,22,0,0,0,4,
-    4,12,1,26,1,6,1,10,2,10,1,18,1,6,1,8,
-    1,12,1,255,128,122,19,70,105,108,101,70,105,110,100,101,
-    114,46,95,95,105,110,105,116,95,95,99,1,0,0,0,0,
-    0,0,0,0,0,0,0,1,0,0,0,2,0,0,0,67,
-    0,0,0,115,10,0,0,0,100,1,124,0,95,0,100,2,
-    83,0,41,3,122,31,73,110,118,97,108,105,100,97,116,101,
-    32,116,104,101,32,100,105,114,101,99,116,111,114,121,32,109,
-    116,105,109,101,46,114,130,0,0,0,78,41,1,114,97,1,
-    0,0,114,21,1,0,0,114,7,0,0,0,114,7,0,0,
-    0,114,8,0,0,0,114,78,1,0,0,219,5,0,0,114,
-    81,0,0,0,122,28,70,105,108,101,70,105,110,100,101,114,
-    46,105,110,118,97,108,105,100,97,116,101,95,99,97,99,104,
-    101,115,99,2,0,0,0,0,0,0,0,0,0,0,0,3,
-    0,0,0,4,0,0,0,67,0,0,0,115,54,0,0,0,
-    116,0,160,1,100,1,116,2,161,2,1,0,124,0,160,3,
-    124,1,161,1,125,2,124,2,100,2,117,0,114,19,100,2,
-    103,0,102,2,83,0,124,2,106,4,124,2,106,5,112,25,
-    103,0,102,2,83,0,41,3,122,197,84,114,121,32,116,111,
-    32,102,105,110,100,32,97,32,108,111,97,100,101,114,32,102,
-    111,114,32,116,104,101,32,115,112,101,99,105,102,105,101,100,
-    32,109,111,100,117,108,101,44,32,111,114,32,116,104,101,32,
-    110,97,109,101,115,112,97,99,101,10,32,32,32,32,32,32,
-    32,32,112,97,99,107,97,103,101,32,112,111,114,116,105,111,
-    110,115,46,32,82,101,116,117,114,110,115,32,40,108,111,97,
-    100,101,114,44,32,108,105,115,116,45,111,102,45,112,111,114,
-    116,105,111,110,115,41,46,10,10,32,32,32,32,32,32,32,
-    32,84,104,105,115,32,109,101,116,104,111,100,32,105,115,32,
-    100,101,112,114,101,99,97,116,101,100,46,32,32,85,115,101,
-    32,102,105,110,100,95,115,112,101,99,40,41,32,105,110,115,
-    116,101,97,100,46,10,10,32,32,32,32,32,32,32,32,122,
-    101,70,105,108,101,70,105,110,100,101,114,46,102,105,110,100,
-    95,108,111,97,100,101,114,40,41,32,105,115,32,100,101,112,
-    114,101,99,97,116,101,100,32,97,110,100,32,115,108,97,116,
-    101,100,32,102,111,114,32,114,101,109,111,118,97,108,32,105,
-    110,32,80,121,116,104,111,110,32,51,46,49,50,59,32,117,
-    115,101,32,102,105,110,100,95,115,112,101,99,40,41,32,105,
-    110,115,116,101,97,100,78,41,6,114,99,0,0,0,114,100,
-    0,0,0,114,101,0,0,0,114,226,0,0,0,114,164,0,
-    0,0,114,202,0,0,0,41,3,114,143,0,0,0,114,163,
-    0,0,0,114,210,0,0,0,114,7,0,0,0,114,7,0,
-    0,0,114,8,0,0,0,114,161,0,0,0,225,5,0,0,
-    115,16,0,0,0,6,7,2,2,4,254,10,3,8,1,8,
-    1,16,1,255,128,122,22,70,105,108,101,70,105,110,100,101,
-    114,46,102,105,110,100,95,108,111,97,100,101,114,99,6,0,
-    0,0,0,0,0,0,0,0,0,0,7,0,0,0,6,0,
-    0,0,67,0,0,0,115,26,0,0,0,124,1,124,2,124,
-    3,131,2,125,6,116,0,124,2,124,3,124,6,124,4,100,
-    1,141,4,83,0,41,2,78,114,201,0,0,0,41,1,114,
-    213,0,0,0,41,7,114,143,0,0,0,114,211,0,0,0,
-    114,163,0,0,0,114,65,0,0,0,90,4,115,109,115,108,
-    114,225,0,0,0,114,164,0,0,0,114,7,0,0,0,114,
-    7,0,0,0,114,8,0,0,0,114,91,1,0,0,240,5,
-    0,0,115,10,0,0,0,10,1,8,1,2,1,6,255,255,
-    128,122,20,70,105,108,101,70,105,110,100,101,114,46,95,103,
-    101,116,95,115,112,101,99,78,99,3,0,0,0,0,0,0,
-    0,0,0,0,0,14,0,0,0,9,0,0,0,67,0,0,
-    0,115,120,1,0,0,100,1,125,3,124,1,160,0,100,2,
-    161,1,100,3,25,0,125,4,122,12,116,1,124,0,106,2,
-    112,17,116,3,160,4,161,0,131,1,106,5,125,5,87,0,
-    110,9,4,0,116,6,121,187,1,0,1,0,1,0,100,4,
-    125,5,89,0,124,5,124,0,106,7,107,3,114,43,124,0,
-    160,8,161,0,1,0,124,5,124,0,95,7,116,9,131,0,
-    114,54,124,0,106,10,125,6,124,4,160,11,161,0,125,7,
-    110,5,124,0,106,12,125,6,124,4,125,7,124,7,124,6,
-    118,0,114,106,116,13,124,0,106,2,124,4,131,2,125,8,
-    124,0,106,14,68,0,93,29,92,2,125,9,125,10,100,5,
-    124,9,23,0,125,11,116,13,124,8,124,11,131,2,125,12,
-    116,15,124,12,131,1,114,101,124,0,160,16,124,10,124,1,
-    124,12,124,8,103,1,124,2,161,5,2,0,1,0,83,0,
-    113,72,116,17,124,8,131,1,125,3,124,0,106,14,68,0,
-    93,54,92,2,125,9,125,10,122,10,116,13,124,0,106,2,
-    124,4,124,9,23,0,131,2,125,12,87,0,110,10,4,0,
-    116,18,121,186,1,0,1,0,1,0,89,0,1,0,100,6,
-    83,0,116,19,106,20,100,7,124,12,100,3,100,8,141,3,
-    1,0,124,7,124,9,23,0,124,6,118,0,114,163,116,15,
-    124,12,131,1,114,163,124,0,160,16,124,10,124,1,124,12,
-    100,6,124,2,161,5,2,0,1,0,83,0,113,109,124,3,
-    114,184,116,19,160,20,100,9,124,8,161,2,1,0,116,19,
-    160,21,124,1,100,6,161,2,125,13,124,8,103,1,124,13,
-    95,22,124,13,83,0,100,6,83,0,119,0,119,0,41,10,
-    122,111,84,114,121,32,116,111,32,102,105,110,100,32,97,32,
-    115,112,101,99,32,102,111,114,32,116,104,101,32,115,112,101,
-    99,105,102,105,101,100,32,109,111,100,117,108,101,46,10,10,
-    32,32,32,32,32,32,32,32,82,101,116,117,114,110,115,32,
-    116,104,101,32,109,97,116,99,104,105,110,103,32,115,112,101,
-    99,44,32,111,114,32,78,111,110,101,32,105,102,32,110,111,
-    116,32,102,111,117,110,100,46,10,32,32,32,32,32,32,32,
-    32,70,114,97,0,0,0,114,44,0,0,0,114,130,0,0,
-    0,114,236,0,0,0,78,122,9,116,114,121,105,110,103,32,
-    123,125,41,1,90,9,118,101,114,98,111,115,105,116,121,122,
-    25,112,111,115,115,105,98,108,101,32,110,97,109,101,115,112,
-    97,99,101,32,102,111,114,32,123,125,41,23,114,104,0,0,
-    0,114,75,0,0,0,114,65,0,0,0,114,18,0,0,0,
-    114,82,0,0,0,114,35,1,0,0,114,76,0,0,0,114,
-    97,1,0,0,218,11,95,102,105,108,108,95,99,97,99,104,
-    101,114,21,0,0,0,114,100,1,0,0,114,131,0,0,0,
-    114,99,1,0,0,114,67,0,0,0,114,96,1,0,0,114,
-    80,0,0,0,114,91,1,0,0,114,83,0,0,0,114,111,
-    0,0,0,114,159,0,0,0,114,173,0,0,0,114,207,0,
-    0,0,114,202,0,0,0,41,14,114,143,0,0,0,114,163,
-    0,0,0,114,225,0,0,0,90,12,105,115,95,110,97,109,
-    101,115,112,97,99,101,90,11,116,97,105,108,95,109,111,100,
-    117,108,101,114,193,0,0,0,90,5,99,97,99,104,101,90,
-    12,99,97,99,104,101,95,109,111,100,117,108,101,90,9,98,
-    97,115,101,95,112,97,116,104,114,44,1,0,0,114,211,0,
-    0,0,90,13,105,110,105,116,95,102,105,108,101,110,97,109,
-    101,90,9,102,117,108,108,95,112,97,116,104,114,210,0,0,
-    0,114,7,0,0,0,114,7,0,0,0,114,8,0,0,0,
-    114,226,0,0,0,245,5,0,0,115,88,0,0,0,4,5,
-    14,1,2,1,24,1,12,1,6,1,10,1,8,1,6,1,
-    6,2,6,1,10,1,6,2,4,1,8,2,12,1,14,1,
-    8,1,10,1,8,1,24,1,2,255,8,5,14,2,2,1,
-    20,1,12,1,8,1,16,1,12,1,8,1,10,1,4,1,
-    8,255,2,128,4,2,12,1,12,1,8,1,4,1,4,1,
-    2,244,2,228,255,128,122,20,70,105,108,101,70,105,110,100,
-    101,114,46,102,105,110,100,95,115,112,101,99,99,1,0,0,
-    0,0,0,0,0,0,0,0,0,9,0,0,0,10,0,0,
-    0,67,0,0,0,115,190,0,0,0,124,0,106,0,125,1,
-    122,11,116,1,160,2,124,1,112,11,116,1,160,3,161,0,
-    161,1,125,2,87,0,110,12,4,0,116,4,116,5,116,6,
-    102,3,121,94,1,0,1,0,1,0,103,0,125,2,89,0,
-    116,7,106,8,160,9,100,1,161,1,115,39,116,10,124,2,
-    131,1,124,0,95,11,110,37,116,10,131,0,125,3,124,2,
-    68,0,93,28,125,4,124,4,160,12,100,2,161,1,92,3,
-    125,5,125,6,125,7,124,6,114,65,100,3,160,13,124,5,
-    124,7,160,14,161,0,161,2,125,8,110,2,124,5,125,8,
-    124,3,160,15,124,8,161,1,1,0,113,44,124,3,124,0,
-    95,11,116,7,106,8,160,9,116,16,161,1,114,92,100,4,
-    100,5,132,0,124,2,68,0,131,1,124,0,95,17,100,6,
-    83,0,100,6,83,0,119,0,41,7,122,68,70,105,108,108,
-    32,116,104,101,32,99,97,99,104,101,32,111,102,32,112,111,
-    116,101,110,116,105,97,108,32,109,111,100,117,108,101,115,32,
-    97,110,100,32,112,97,99,107,97,103,101,115,32,102,111,114,
-    32,116,104,105,115,32,100,105,114,101,99,116,111,114,121,46,
-    114,14,0,0,0,114,97,0,0,0,114,88,0,0,0,99,
-    1,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,
-    4,0,0,0,83,0,0,0,115,20,0,0,0,104,0,124,
-    0,93,6,125,1,124,1,160,0,161,0,146,2,113,2,83,
-    0,114,7,0,0,0,41,1,114,131,0,0,0,41,2,114,
-    5,0,0,0,90,2,102,110,114,7,0,0,0,114,7,0,
-    0,0,114,8,0,0,0,114,13,0,0,0,69,6,0,0,
-    115,4,0,0,0,20,0,255,128,122,41,70,105,108,101,70,
-    105,110,100,101,114,46,95,102,105,108,108,95,99,97,99,104,
-    101,46,60,108,111,99,97,108,115,62,46,60,115,101,116,99,
-    111,109,112,62,78,41,18,114,65,0,0,0,114,18,0,0,
-    0,90,7,108,105,115,116,100,105,114,114,82,0,0,0,114,
-    85,1,0,0,218,15,80,101,114,109,105,115,115,105,111,110,
-    69,114,114,111,114,218,18,78,111,116,65,68,105,114,101,99,
-    116,111,114,121,69,114,114,111,114,114,15,0,0,0,114,25,
-    0,0,0,114,26,0,0,0,114,98,1,0,0,114,99,1,
-    0,0,114,126,0,0,0,114,89,0,0,0,114,131,0,0,
-    0,218,3,97,100,100,114,27,0,0,0,114,100,1,0,0,
-    41,9,114,143,0,0,0,114,65,0,0,0,90,8,99,111,
-    110,116,101,110,116,115,90,21,108,111,119,101,114,95,115,117,
-    102,102,105,120,95,99,111,110,116,101,110,116,115,114,70,1,
-    0,0,114,141,0,0,0,114,54,1,0,0,114,44,1,0,
-    0,90,8,110,101,119,95,110,97,109,101,114,7,0,0,0,
-    114,7,0,0,0,114,8,0,0,0,114,102,1,0,0,40,
-    6,0,0,115,40,0,0,0,6,2,2,1,22,1,18,1,
-    6,3,12,3,12,1,6,7,8,1,16,1,4,1,18,1,
-    4,2,12,1,6,1,12,1,20,1,4,255,2,233,255,128,
-    122,22,70,105,108,101,70,105,110,100,101,114,46,95,102,105,
-    108,108,95,99,97,99,104,101,99,1,0,0,0,0,0,0,
-    0,0,0,0,0,3,0,0,0,3,0,0,0,7,0,0,
-    0,115,18,0,0,0,135,0,135,1,102,2,100,1,100,2,
-    132,8,125,2,124,2,83,0,41,4,97,20,1,0,0,65,
-    32,99,108,97,115,115,32,109,101,116,104,111,100,32,119,104,
-    105,99,104,32,114,101,116,117,114,110,115,32,97,32,99,108,
-    111,115,117,114,101,32,116,111,32,117,115,101,32,111,110,32,
-    115,121,115,46,112,97,116,104,95,104,111,111,107,10,32,32,
-    32,32,32,32,32,32,119,104,105,99,104,32,119,105,108,108,
-    32,114,101,116,117,114,110,32,97,110,32,105,110,115,116,97,
-    110,99,101,32,117,115,105,110,103,32,116,104,101,32,115,112,
-    101,99,105,102,105,101,100,32,108,111,97,100,101,114,115,32,
-    97,110,100,32,116,104,101,32,112,97,116,104,10,32,32,32,
-    32,32,32,32,32,99,97,108,108,101,100,32,111,110,32,116,
-    104,101,32,99,108,111,115,117,114,101,46,10,10,32,32,32,
-    32,32,32,32,32,73,102,32,116,104,101,32,112,97,116,104,
-    32,99,97,108,108,101,100,32,111,110,32,116,104,101,32,99,
-    108,111,115,117,114,101,32,105,115,32,110,111,116,32,97,32,
-    100,105,114,101,99,116,111,114,121,44,32,73,109,112,111,114,
-    116,69,114,114,111,114,32,105,115,10,32,32,32,32,32,32,
-    32,32,114,97,105,115,101,100,46,10,10,32,32,32,32,32,
-    32,32,32,99,1,0,0,0,0,0,0,0,0,0,0,0,
-    1,0,0,0,4,0,0,0,19,0,0,0,115,36,0,0,
-    0,116,0,124,0,131,1,115,10,116,1,100,1,124,0,100,
-    2,141,2,130,1,136,0,124,0,103,1,136,1,162,1,82,
-    0,142,0,83,0,41,4,122,45,80,97,116,104,32,104,111,
-    111,107,32,102,111,114,32,105,109,112,111,114,116,108,105,98,
-    46,109,97,99,104,105,110,101,114,121,46,70,105,108,101,70,
-    105,110,100,101,114,46,122,30,111,110,108,121,32,100,105,114,
-    101,99,116,111,114,105,101,115,32,97,114,101,32,115,117,112,
-    112,111,114,116,101,100,114,71,0,0,0,78,41,2,114,83,
-    0,0,0,114,142,0,0,0,114,71,0,0,0,169,2,114,
-    221,0,0,0,114,101,1,0,0,114,7,0,0,0,114,8,
-    0,0,0,218,24,112,97,116,104,95,104,111,111,107,95,102,
-    111,114,95,70,105,108,101,70,105,110,100,101,114,81,6,0,
-    0,115,8,0,0,0,8,2,12,1,16,1,255,128,122,54,
-    70,105,108,101,70,105,110,100,101,114,46,112,97,116,104,95,
-    104,111,111,107,46,60,108,111,99,97,108,115,62,46,112,97,
-    116,104,95,104,111,111,107,95,102,111,114,95,70,105,108,101,
-    70,105,110,100,101,114,78,114,7,0,0,0,41,3,114,221,
-    0,0,0,114,101,1,0,0,114,107,1,0,0,114,7,0,
-    0,0,114,106,1,0,0,114,8,0,0,0,218,9,112,97,
-    116,104,95,104,111,111,107,71,6,0,0,115,6,0,0,0,
-    14,10,4,6,255,128,122,20,70,105,108,101,70,105,110,100,
-    101,114,46,112,97,116,104,95,104,111,111,107,99,1,0,0,
-    0,0,0,0,0,0,0,0,0,1,0,0,0,3,0,0,
-    0,67,0,0,0,114,67,1,0,0,41,2,78,122,16,70,
-    105,108,101,70,105,110,100,101,114,40,123,33,114,125,41,41,
-    2,114,89,0,0,0,114,65,0,0,0,114,21,1,0,0,
-    114,7,0,0,0,114,7,0,0,0,114,8,0,0,0,114,
-    68,1,0,0,89,6,0,0,114,61,1,0,0,122,19,70,
-    105,108,101,70,105,110,100,101,114,46,95,95,114,101,112,114,
-    95,95,114,69,0,0,0,41,15,114,150,0,0,0,114,149,
-    0,0,0,114,151,0,0,0,114,152,0,0,0,114,236,0,
-    0,0,114,78,1,0,0,114,167,0,0,0,114,229,0,0,
-    0,114,161,0,0,0,114,91,1,0,0,114,226,0,0,0,
-    114,102,1,0,0,114,234,0,0,0,114,108,1,0,0,114,
-    68,1,0,0,114,7,0,0,0,114,7,0,0,0,114,7,
-    0,0,0,114,8,0,0,0,114,94,1,0,0,194,5,0,
-    0,115,26,0,0,0,8,0,4,2,8,7,8,16,4,4,
-    8,2,8,15,10,5,8,51,2,31,10,1,12,17,255,128,
-    114,94,1,0,0,99,4,0,0,0,0,0,0,0,0,0,
-    0,0,6,0,0,0,8,0,0,0,67,0,0,0,115,144,
-    0,0,0,124,0,160,0,100,1,161,1,125,4,124,0,160,
-    0,100,2,161,1,125,5,124,4,115,33,124,5,114,18,124,
-    5,106,1,125,4,110,15,124,2,124,3,107,2,114,28,116,
-    2,124,1,124,2,131,2,125,4,110,5,116,3,124,1,124,
-    2,131,2,125,4,124,5,115,42,116,4,124,1,124,2,124,
-    4,100,3,141,3,125,5,122,19,124,5,124,0,100,2,60,
-    0,124,4,124,0,100,1,60,0,124,2,124,0,100,4,60,
-    0,124,3,124,0,100,5,60,0,87,0,100,0,83,0,4,
-    0,116,5,121,71,1,0,1,0,1,0,89,0,100,0,83,
-    0,119,0,41,6,78,218,10,95,95,108,111,97,100,101,114,
-    95,95,218,8,95,95,115,112,101,99,95,95,114,95,1,0,
-    0,90,8,95,95,102,105,108,101,95,95,90,10,95,95,99,
-    97,99,104,101,100,95,95,41,6,218,3,103,101,116,114,164,
-    0,0,0,114,41,1,0,0,114,34,1,0,0,114,213,0,
-    0,0,218,9,69,120,99,101,112,116,105,111,110,41,6,90,
-    2,110,115,114,141,0,0,0,90,8,112,97,116,104,110,97,
-    109,101,90,9,99,112,97,116,104,110,97,109,101,114,164,0,
-    0,0,114,210,0,0,0,114,7,0,0,0,114,7,0,0,
-    0,114,8,0,0,0,218,14,95,102,105,120,95,117,112,95,
-    109,111,100,117,108,101,95,6,0,0,115,38,0,0,0,10,
-    2,10,1,4,1,4,1,8,1,8,1,12,1,10,2,4,
-    1,14,1,2,1,8,1,8,1,8,1,14,1,12,1,6,
-    2,2,254,255,128,114,113,1,0,0,99,0,0,0,0,0,
-    0,0,0,0,0,0,0,3,0,0,0,3,0,0,0,67,
-    0,0,0,115,38,0,0,0,116,0,116,1,160,2,161,0,
-    102,2,125,0,116,3,116,4,102,2,125,1,116,5,116,6,
-    102,2,125,2,124,0,124,1,124,2,103,3,83,0,41,2,
-    122,95,82,101,116,117,114,110,115,32,97,32,108,105,115,116,
-    32,111,102,32,102,105,108,101,45,98,97,115,101,100,32,109,
-    111,100,117,108,101,32,108,111,97,100,101,114,115,46,10,10,
-    32,32,32,32,69,97,99,104,32,105,116,101,109,32,105,115,
-    32,97,32,116,117,112,108,101,32,40,108,111,97,100,101,114,
-    44,32,115,117,102,102,105,120,101,115,41,46,10,32,32,32,
-    32,78,41,7,114,30,1,0,0,114,187,0,0,0,218,18,
-    101,120,116,101,110,115,105,111,110,95,115,117,102,102,105,120,
-    101,115,114,34,1,0,0,114,127,0,0,0,114,41,1,0,
-    0,114,113,0,0,0,41,3,90,10,101,120,116,101,110,115,
-    105,111,110,115,90,6,115,111,117,114,99,101,90,8,98,121,
-    116,101,99,111,100,101,114,7,0,0,0,114,7,0,0,0,
-    114,8,0,0,0,114,208,0,0,0,118,6,0,0,115,10,
-    0,0,0,12,5,8,1,8,1,10,1,255,128,114,208,0,
-    0,0,99,1,0,0,0,0,0,0,0,0,0,0,0,1,
-    0,0,0,1,0,0,0,67,0,0,0,115,8,0,0,0,
-    124,0,97,0,100,0,83,0,114,69,0,0,0,41,1,114,
-    159,0,0,0,41,1,218,17,95,98,111,111,116,115,116,114,
-    97,112,95,109,111,100,117,108,101,114,7,0,0,0,114,7,
-    0,0,0,114,8,0,0,0,218,21,95,115,101,116,95,98,
-    111,111,116,115,116,114,97,112,95,109,111,100,117,108,101,129,
-    6,0,0,115,4,0,0,0,8,2,255,128,114,116,1,0,
-    0,99,1,0,0,0,0,0,0,0,0,0,0,0,2,0,
-    0,0,4,0,0,0,67,0,0,0,115,50,0,0,0,116,
-    0,124,0,131,1,1,0,116,1,131,0,125,1,116,2,106,
-    3,160,4,116,5,106,6,124,1,142,0,103,1,161,1,1,
-    0,116,2,106,7,160,8,116,9,161,1,1,0,100,1,83,
-    0,41,2,122,41,73,110,115,116,97,108,108,32,116,104,101,
-    32,112,97,116,104,45,98,97,115,101,100,32,105,109,112,111,
-    114,116,32,99,111,109,112,111,110,101,110,116,115,46,78,41,
-    10,114,116,1,0,0,114,208,0,0,0,114,15,0,0,0,
-    114,83,1,0,0,114,191,0,0,0,114,94,1,0,0,114,
-    108,1,0,0,218,9,109,101,116,97,95,112,97,116,104,114,
-    61,0,0,0,114,77,1,0,0,41,2,114,115,1,0,0,
-    90,17,115,117,112,112,111,114,116,101,100,95,108,111,97,100,
-    101,114,115,114,7,0,0,0,114,7,0,0,0,114,8,0,
-    0,0,218,8,95,105,110,115,116,97,108,108,134,6,0,0,
-    115,10,0,0,0,8,2,6,1,20,1,16,1,255,128,114,
-    118,1,0,0,41,1,114,87,0,0,0,114,69,0,0,0,
-    41,3,78,78,78,41,2,114,0,0,0,0,114,0,0,0,
-    0,41,1,84,41,85,114,152,0,0,0,114,159,0,0,0,
-    114,187,0,0,0,114,91,0,0,0,114,15,0,0,0,114,
-    99,0,0,0,114,184,0,0,0,114,25,0,0,0,114,231,
-    0,0,0,90,2,110,116,114,18,0,0,0,114,215,0,0,
-    0,90,5,112,111,115,105,120,114,50,0,0,0,218,3,97,
-    108,108,114,59,0,0,0,114,136,0,0,0,114,57,0,0,
-    0,114,62,0,0,0,90,20,95,112,97,116,104,115,101,112,
-    115,95,119,105,116,104,95,99,111,108,111,110,114,28,0,0,
-    0,90,37,95,67,65,83,69,95,73,78,83,69,78,83,73,
-    84,73,86,69,95,80,76,65,84,70,79,82,77,83,95,66,
-    89,84,69,83,95,75,69,89,114,27,0,0,0,114,29,0,
-    0,0,114,21,0,0,0,114,36,0,0,0,114,42,0,0,
-    0,114,45,0,0,0,114,67,0,0,0,114,74,0,0,0,
-    114,75,0,0,0,114,79,0,0,0,114,80,0,0,0,114,
-    83,0,0,0,114,86,0,0,0,114,95,0,0,0,218,4,
-    116,121,112,101,218,8,95,95,99,111,100,101,95,95,114,186,
-    0,0,0,114,34,0,0,0,114,172,0,0,0,114,33,0,
-    0,0,114,39,0,0,0,114,8,1,0,0,114,116,0,0,
-    0,114,112,0,0,0,114,127,0,0,0,114,61,0,0,0,
-    114,114,1,0,0,114,232,0,0,0,114,113,0,0,0,90,
-    23,68,69,66,85,71,95,66,89,84,69,67,79,68,69,95,
-    83,85,70,70,73,88,69,83,90,27,79,80,84,73,77,73,
-    90,69,68,95,66,89,84,69,67,79,68,69,95,83,85,70,
-    70,73,88,69,83,114,121,0,0,0,114,128,0,0,0,114,
-    135,0,0,0,114,137,0,0,0,114,139,0,0,0,114,160,
-    0,0,0,114,167,0,0,0,114,176,0,0,0,114,180,0,
-    0,0,114,182,0,0,0,114,189,0,0,0,114,194,0,0,
-    0,114,195,0,0,0,114,200,0,0,0,218,6,111,98,106,
-    101,99,116,114,209,0,0,0,114,213,0,0,0,114,214,0,
-    0,0,114,235,0,0,0,114,249,0,0,0,114,11,1,0,
-    0,114,34,1,0,0,114,41,1,0,0,114,30,1,0,0,
-    114,47,1,0,0,114,73,1,0,0,114,77,1,0,0,114,
-    94,1,0,0,114,113,1,0,0,114,208,0,0,0,114,116,
-    1,0,0,114,118,1,0,0,114,7,0,0,0,114,7,0,
-    0,0,114,7,0,0,0,114,8,0,0,0,218,8,60,109,
-    111,100,117,108,101,62,1,0,0,0,115,182,0,0,0,4,
-    0,4,22,8,3,8,1,8,1,8,1,8,1,10,3,4,
-    1,8,1,10,1,8,2,4,3,10,1,6,2,22,2,8,
-    1,8,1,10,1,14,1,4,4,4,1,2,1,2,1,4,
-    255,8,4,6,16,8,3,8,5,8,5,4,6,10,1,8,
-    30,8,6,8,8,8,10,8,9,8,5,4,7,10,1,8,
-    8,10,5,10,22,0,127,16,28,12,1,4,2,4,1,6,
-    2,4,1,10,1,8,2,6,2,8,2,16,2,8,71,8,
-    40,8,19,8,12,8,12,8,31,8,20,8,33,8,28,10,
-    24,10,13,10,10,8,11,6,14,4,3,2,1,12,255,14,
-    73,14,67,16,30,0,127,14,17,18,50,18,45,18,25,14,
-    53,14,63,14,49,0,127,14,29,0,127,10,30,8,23,8,
-    11,12,5,255,128,
+    6,95,10,124,6,83,0,41,4,78,113,204,1,113,145,4,
+    113,146,4,41,11,113,190,1,113,199,1,113,147,4,113,119,
+    113,120,113,205,1,113,204,1,113,183,2,113,177,2,113,143,
+    2,113,137,2,41,7,113,171,2,113,206,1,113,132,4,113,
+    209,1,113,207,1,113,208,1,113,148,2,82,2,82,2,113,
+    7,113,148,4,176,21,115,28,0,0,0,10,4,16,1,12,
+    2,16,1,16,2,12,2,10,1,4,1,8,1,12,1,12,
+    1,6,1,4,1,255,128,113,149,4,78,67,8,0,0,18,
+    10,134,1,115,166,0,0,0,103,0,125,4,124,2,68,0,
+    93,67,125,5,116,0,124,5,116,1,116,2,102,2,131,2,
+    115,14,113,4,124,0,160,3,124,5,161,1,125,6,124,6,
+    100,1,117,1,114,71,116,4,124,6,100,2,131,2,114,35,
+    124,6,160,5,124,1,124,3,161,2,125,7,110,6,124,0,
+    160,6,124,1,124,6,161,2,125,7,124,7,100,1,117,0,
+    114,46,113,4,124,7,106,7,100,1,117,1,114,55,124,7,
+    2,0,1,0,83,0,124,7,106,8,125,8,124,8,100,1,
+    117,0,114,66,116,9,100,3,131,1,130,1,124,4,160,10,
+    124,8,161,1,1,0,113,4,116,11,160,12,124,1,100,1,
+    161,2,125,7,124,4,124,7,95,8,124,7,83,0,41,4,
+    113,150,4,78,113,179,2,113,151,4,41,13,113,238,1,113,
+    129,1,113,152,4,113,143,4,113,190,1,113,179,2,113,148,
+    4,113,207,1,113,137,2,113,179,1,113,246,1,113,199,1,
+    113,143,2,41,9,113,171,2,113,206,1,113,60,113,178,2,
+    113,153,4,113,154,4,113,132,4,113,148,2,113,208,1,82,
+    2,82,2,113,7,113,155,4,218,21,115,44,0,0,0,4,
+    5,8,1,14,1,2,1,10,1,8,1,10,1,14,1,12,
+    2,8,1,2,1,10,1,8,1,6,1,8,1,8,1,10,
+    5,2,128,12,2,6,1,4,1,255,128,113,156,4,67,8,
+    0,0,12,10,134,1,115,94,0,0,0,124,2,100,1,117,
+    0,114,7,116,0,106,1,125,2,124,0,160,2,124,1,124,
+    2,124,3,161,3,125,4,124,4,100,1,117,0,114,20,100,
+    1,83,0,124,4,106,3,100,1,117,0,114,45,124,4,106,
+    4,125,5,124,5,114,43,100,1,124,4,95,5,116,6,124,
+    1,124,5,124,0,106,2,131,3,124,4,95,4,124,4,83,
+    0,100,1,83,0,124,4,83,0,41,2,113,157,4,78,41,
+    7,113,18,113,60,113,155,4,113,207,1,113,137,2,113,141,
+    2,113,196,3,41,6,113,171,2,113,206,1,113,60,113,178,
+    2,113,148,2,113,153,4,82,2,82,2,113,7,113,179,2,
+    154,22,115,28,0,0,0,8,6,6,1,14,1,8,1,4,
+    1,10,1,6,1,4,1,6,3,16,1,4,1,4,2,4,
+    2,255,128,113,158,4,67,6,0,0,8,8,134,1,115,42,
+    0,0,0,116,0,160,1,100,1,116,2,161,2,1,0,124,
+    0,160,3,124,1,124,2,161,2,125,3,124,3,100,2,117,
+    0,114,18,100,2,83,0,124,3,106,4,83,0,41,3,113,
+    159,4,113,160,4,78,82,35,82,36,82,2,82,2,113,7,
+    113,183,2,202,22,115,16,0,0,0,6,8,2,2,4,254,
+    12,3,8,1,4,1,6,1,255,128,113,161,4,67,0,0,
+    0,6,8,158,1,115,28,0,0,0,100,1,100,2,108,0,
+    109,1,125,2,1,0,124,2,106,2,124,0,105,0,124,1,
+    164,1,142,1,83,0,41,4,113,162,4,82,0,41,1,113,
+    163,4,78,41,3,113,164,4,113,163,4,113,165,4,41,3,
+    113,181,1,113,182,1,113,163,4,82,2,82,2,113,7,113,
+    165,4,234,22,115,6,0,0,0,12,10,16,1,255,128,113,
+    166,4,82,17,82,37,41,14,113,187,1,113,186,1,113,188,
+    1,113,189,1,113,187,2,113,128,4,113,138,4,113,188,2,
+    113,143,4,113,148,4,113,155,4,113,179,2,113,183,2,113,
+    165,4,82,2,82,2,82,2,113,7,113,253,3,206,20,115,
+    38,0,0,0,8,0,4,2,2,2,10,1,2,9,10,1,
+    2,12,10,1,2,21,10,1,2,20,12,1,2,31,12,1,
+    2,23,12,1,2,15,14,1,255,128,113,253,3,67,0,0,
+    0,0,6,128,1,115,90,0,0,0,101,0,90,1,100,0,
+    90,2,100,1,90,3,100,2,100,3,132,0,90,4,100,4,
+    100,5,132,0,90,5,101,6,90,7,100,6,100,7,132,0,
+    90,8,100,8,100,9,132,0,90,9,100,19,100,11,100,12,
+    132,1,90,10,100,13,100,14,132,0,90,11,101,12,100,15,
+    100,16,132,0,131,1,90,13,100,17,100,18,132,0,90,14,
+    100,10,83,0,41,20,113,167,4,113,168,4,67,4,0,0,
+    10,12,14,115,112,0,0,0,103,0,125,3,124,2,68,0,
+    93,16,92,2,137,0,125,4,124,3,160,0,135,0,102,1,
+    100,1,100,2,132,8,124,4,68,0,131,1,161,1,1,0,
+    113,4,124,3,124,0,95,1,124,1,112,27,100,3,124,0,
+    95,2,116,3,124,0,106,2,131,1,115,43,116,4,116,5,
+    160,6,161,0,124,0,106,2,131,2,124,0,95,2,100,4,
+    124,0,95,7,116,8,131,0,124,0,95,9,116,8,131,0,
+    124,0,95,10,100,5,83,0,41,6,113,169,4,67,2,0,
+    0,4,6,102,115,24,0,0,0,129,0,124,0,93,7,125,
+    1,124,1,136,0,102,2,86,0,1,0,113,2,100,0,83,
+    0,82,17,82,2,82,57,169,1,113,207,1,82,2,113,7,
+    113,8,164,23,115,6,0,0,0,6,128,18,0,255,128,113,
+    170,4,113,115,82,24,78,41,11,113,246,1,113,171,4,113,
+    60,113,88,113,63,113,21,113,83,113,172,4,113,173,4,113,
+    174,4,113,175,4,41,5,113,180,1,113,60,113,176,4,113,
+    177,4,113,150,2,82,2,82,67,113,7,113,192,2,152,23,
+    115,22,0,0,0,4,4,12,1,26,1,6,1,10,2,10,
+    1,18,1,6,1,8,1,12,1,255,128,113,178,4,67,2,
+    0,0,2,4,134,1,115,10,0,0,0,100,1,124,0,95,
+    0,100,2,83,0,41,3,113,179,4,82,24,78,41,1,113,
+    172,4,82,49,82,2,82,2,113,7,113,128,4,184,23,82,
+    19,113,180,4,67,4,0,0,6,8,134,1,115,54,0,0,
+    0,116,0,160,1,100,1,116,2,161,2,1,0,124,0,160,
+    3,124,1,161,1,125,2,124,2,100,2,117,0,114,19,100,
+    2,103,0,102,2,83,0,124,2,106,4,124,2,106,5,112,
+    25,103,0,102,2,83,0,41,3,113,181,4,113,182,4,78,
+    41,6,113,119,113,120,113,121,113,179,2,113,207,1,113,137,
+    2,41,3,113,180,1,113,206,1,113,148,2,82,2,82,2,
+    113,7,113,204,1,196,23,115,16,0,0,0,6,7,2,2,
+    4,254,10,3,8,1,8,1,16,1,255,128,113,183,4,67,
+    12,0,0,14,12,134,1,115,26,0,0,0,124,1,124,2,
+    124,3,131,2,125,6,116,0,124,2,124,3,124,6,124,4,
+    100,1,141,4,83,0,41,2,78,82,33,41,1,113,152,2,
+    41,7,113,180,1,113,149,2,113,206,1,113,60,113,184,4,
+    113,178,2,113,207,1,82,2,82,2,113,7,113,155,4,226,
+    23,115,10,0,0,0,10,1,8,1,2,1,6,255,255,128,
+    113,185,4,78,67,6,0,0,28,18,134,1,115,120,1,0,
+    0,100,1,125,3,124,1,160,0,100,2,161,1,100,3,25,
+    0,125,4,122,12,116,1,124,0,106,2,112,17,116,3,160,
+    4,161,0,131,1,106,5,125,5,87,0,110,9,4,0,116,
+    6,121,187,1,0,1,0,1,0,100,4,125,5,89,0,124,
+    5,124,0,106,7,107,3,114,43,124,0,160,8,161,0,1,
+    0,124,5,124,0,95,7,116,9,131,0,114,54,124,0,106,
+    10,125,6,124,4,160,11,161,0,125,7,110,5,124,0,106,
+    12,125,6,124,4,125,7,124,7,124,6,118,0,114,106,116,
+    13,124,0,106,2,124,4,131,2,125,8,124,0,106,14,68,
+    0,93,29,92,2,125,9,125,10,100,5,124,9,23,0,125,
+    11,116,13,124,8,124,11,131,2,125,12,116,15,124,12,131,
+    1,114,101,124,0,160,16,124,10,124,1,124,12,124,8,103,
+    1,124,2,161,5,2,0,1,0,83,0,113,72,116,17,124,
+    8,131,1,125,3,124,0,106,14,68,0,93,54,92,2,125,
+    9,125,10,122,10,116,13,124,0,106,2,124,4,124,9,23,
+    0,131,2,125,12,87,0,110,10,4,0,116,18,121,186,1,
+    0,1,0,1,0,89,0,1,0,100,6,83,0,116,19,106,
+    20,100,7,124,12,100,3,100,8,141,3,1,0,124,7,124,
+    9,23,0,124,6,118,0,114,163,116,15,124,12,131,1,114,
+    163,124,0,160,16,124,10,124,1,124,12,100,6,124,2,161,
+    5,2,0,1,0,83,0,113,109,124,3,114,184,116,19,160,
+    20,100,9,124,8,161,2,1,0,116,19,160,21,124,1,100,
+    6,161,2,125,13,124,8,103,1,124,13,95,22,124,13,83,
+    0,100,6,83,0,119,0,119,0,41,10,113,186,4,70,113,
+    115,82,13,82,24,113,192,2,78,113,187,4,41,1,113,188,
+    4,113,189,4,41,23,113,124,113,73,113,60,113,21,113,83,
+    113,155,3,113,75,113,172,4,113,190,4,113,24,113,175,4,
+    113,166,1,113,174,4,113,63,113,171,4,113,81,113,155,4,
+    113,84,113,131,1,113,199,1,113,219,1,113,143,2,113,137,
+    2,41,14,113,180,1,113,206,1,113,178,2,113,191,4,113,
+    192,4,113,248,1,113,193,4,113,194,4,113,195,4,113,186,
+    3,113,149,2,113,196,4,113,197,4,113,148,2,82,2,82,
+    2,113,7,113,179,2,236,23,115,88,0,0,0,4,5,14,
+    1,2,1,24,1,12,1,6,1,10,1,8,1,6,1,6,
+    2,6,1,10,1,6,2,4,1,8,2,12,1,14,1,8,
+    1,10,1,8,1,24,1,2,255,8,5,14,2,2,1,20,
+    1,12,1,8,1,16,1,12,1,8,1,10,1,4,1,8,
+    255,2,128,4,2,12,1,12,1,8,1,4,1,4,1,2,
+    244,2,228,255,128,113,198,4,67,2,0,0,18,20,134,1,
+    115,190,0,0,0,124,0,106,0,125,1,122,11,116,1,160,
+    2,124,1,112,11,116,1,160,3,161,0,161,1,125,2,87,
+    0,110,12,4,0,116,4,116,5,116,6,102,3,121,94,1,
+    0,1,0,1,0,103,0,125,2,89,0,116,7,106,8,160,
+    9,100,1,161,1,115,39,116,10,124,2,131,1,124,0,95,
+    11,110,37,116,10,131,0,125,3,124,2,68,0,93,28,125,
+    4,124,4,160,12,100,2,161,1,92,3,125,5,125,6,125,
+    7,124,6,114,65,100,3,160,13,124,5,124,7,160,14,161,
+    0,161,2,125,8,110,2,124,5,125,8,124,3,160,15,124,
+    8,161,1,1,0,113,44,124,3,124,0,95,11,116,7,106,
+    8,160,9,116,16,161,1,114,92,100,4,100,5,132,0,124,
+    2,68,0,131,1,124,0,95,17,100,6,83,0,100,6,83,
+    0,119,0,41,7,113,199,4,113,13,113,115,113,90,67,2,
+    0,0,4,8,166,1,115,20,0,0,0,104,0,124,0,93,
+    6,125,1,124,1,160,0,161,0,146,2,113,2,83,0,82,
+    2,41,1,113,166,1,41,2,113,5,113,200,4,82,2,82,
+    2,113,7,113,12,140,25,115,4,0,0,0,20,0,255,128,
+    113,201,4,78,41,18,113,60,113,21,113,202,4,113,83,113,
+    141,4,113,203,4,113,204,4,113,18,113,27,113,28,113,173,
+    4,113,174,4,113,154,1,113,92,113,166,1,113,205,4,113,
+    29,113,175,4,41,9,113,180,1,113,60,113,206,4,113,207,
+    4,113,231,3,113,178,1,113,207,3,113,186,3,113,208,4,
+    82,2,82,2,113,7,113,190,4,210,24,115,40,0,0,0,
+    6,2,2,1,22,1,18,1,6,3,12,3,12,1,6,7,
+    8,1,16,1,4,1,18,1,4,2,12,1,6,1,12,1,
+    20,1,4,255,2,233,255,128,113,209,4,67,2,0,0,6,
+    6,14,115,18,0,0,0,135,0,135,1,102,2,100,1,100,
+    2,132,8,125,2,124,2,83,0,41,4,113,210,4,67,2,
+    0,0,2,8,38,115,36,0,0,0,116,0,124,0,131,1,
+    115,10,116,1,100,1,124,0,100,2,141,2,130,1,136,0,
+    124,0,103,1,136,1,162,1,82,0,142,0,83,0,41,4,
+    113,211,4,113,212,4,82,18,78,41,2,113,84,113,179,1,
+    82,18,169,2,113,171,2,113,176,4,82,2,113,7,113,213,
+    4,164,25,115,8,0,0,0,8,2,12,1,16,1,255,128,
+    113,214,4,78,82,2,41,3,113,171,2,113,176,4,113,213,
+    4,82,2,82,68,113,7,113,215,4,144,25,115,6,0,0,
+    0,14,10,4,6,255,128,113,216,4,67,2,0,0,2,6,
+    134,1,82,63,41,2,78,113,217,4,41,2,113,92,113,60,
+    82,49,82,2,82,2,113,7,113,229,3,180,25,82,61,113,
+    218,4,82,17,41,15,113,187,1,113,186,1,113,188,1,113,
+    189,1,113,192,2,113,128,4,113,210,1,113,183,2,113,204,
+    1,113,155,4,113,179,2,113,190,4,113,188,2,113,215,4,
+    113,229,3,82,2,82,2,82,2,113,7,113,167,4,134,23,
+    115,26,0,0,0,8,0,4,2,8,7,8,16,4,4,8,
+    2,8,15,10,5,8,51,2,31,10,1,12,17,255,128,113,
+    167,4,67,8,0,0,12,16,134,1,115,144,0,0,0,124,
+    0,160,0,100,1,161,1,125,4,124,0,160,0,100,2,161,
+    1,125,5,124,4,115,33,124,5,114,18,124,5,106,1,125,
+    4,110,15,124,2,124,3,107,2,114,28,116,2,124,1,124,
+    2,131,2,125,4,110,5,116,3,124,1,124,2,131,2,125,
+    4,124,5,115,42,116,4,124,1,124,2,124,4,100,3,141,
+    3,125,5,122,19,124,5,124,0,100,2,60,0,124,4,124,
+    0,100,1,60,0,124,2,124,0,100,4,60,0,124,3,124,
+    0,100,5,60,0,87,0,100,0,83,0,4,0,116,5,121,
+    71,1,0,1,0,1,0,89,0,100,0,83,0,119,0,41,
+    6,78,113,219,4,113,220,4,82,67,113,221,4,113,222,4,
+    41,6,113,223,4,113,207,1,113,168,3,113,152,3,113,152,
+    2,113,224,4,41,6,113,225,4,113,178,1,113,226,4,113,
+    227,4,113,207,1,113,148,2,82,2,82,2,113,7,113,228,
+    4,192,25,115,38,0,0,0,10,2,10,1,4,1,4,1,
+    8,1,8,1,12,1,10,2,4,1,14,1,2,1,8,1,
+    8,1,8,1,14,1,12,1,6,2,2,254,255,128,113,228,
+    4,67,0,0,0,6,6,134,1,115,38,0,0,0,116,0,
+    116,1,160,2,161,0,102,2,125,0,116,3,116,4,102,2,
+    125,1,116,5,116,6,102,2,125,2,124,0,124,1,124,2,
+    103,3,83,0,41,2,113,229,4,78,41,7,113,143,3,113,
+    240,1,113,230,4,113,152,3,113,155,1,113,168,3,113,133,
+    1,41,3,113,231,4,113,232,4,113,233,4,82,2,82,2,
+    113,7,113,145,2,238,25,115,10,0,0,0,12,5,8,1,
+    8,1,10,1,255,128,113,145,2,67,2,0,0,2,2,134,
+    1,115,8,0,0,0,124,0,97,0,100,0,83,0,82,17,
+    41,1,113,199,1,41,1,113,234,4,82,2,82,2,113,7,
+    113,235,4,132,26,115,4,0,0,0,8,2,255,128,113,235,
+    4,67,2,0,0,4,8,134,1,115,50,0,0,0,116,0,
+    124,0,131,1,1,0,116,1,131,0,125,1,116,2,106,3,
+    160,4,116,5,106,6,124,1,142,0,103,1,161,1,1,0,
+    116,2,106,7,160,8,116,9,161,1,1,0,100,1,83,0,
+    41,2,113,236,4,78,41,10,113,235,4,113,145,2,113,18,
+    113,136,4,113,246,1,113,167,4,113,215,4,113,237,4,113,
+    56,113,253,3,41,2,113,234,4,113,238,4,82,2,82,2,
+    113,7,113,239,4,142,26,115,10,0,0,0,8,2,6,1,
+    20,1,16,1,255,128,113,239,4,41,1,82,20,82,17,41,
+    3,78,78,78,41,2,82,0,82,0,41,1,84,41,85,113,
+    189,1,113,199,1,113,240,1,113,98,113,18,113,119,113,236,
+    1,113,27,113,185,2,113,240,4,113,21,113,158,2,113,241,
+    4,113,46,113,242,4,113,54,113,172,1,113,52,113,57,113,
+    243,4,113,30,113,244,4,113,29,113,31,113,24,113,37,113,
+    41,113,43,113,63,113,70,113,73,113,79,113,81,113,84,113,
+    88,113,105,113,245,4,113,246,4,113,239,1,113,35,113,218,
+    1,113,34,113,39,113,245,2,113,136,1,113,132,1,113,155,
+    1,113,56,113,230,4,113,186,2,113,133,1,113,247,4,113,
+    248,4,113,145,1,113,163,1,113,171,1,113,173,1,113,175,
+    1,113,200,1,113,210,1,113,223,1,113,228,1,113,232,1,
+    113,243,1,113,249,1,113,252,1,113,136,2,113,249,4,113,
+    146,2,113,152,2,113,153,2,113,189,2,113,211,2,113,253,
+    2,113,152,3,113,168,3,113,143,3,113,196,3,113,235,3,
+    113,253,3,113,167,4,113,228,4,113,145,2,113,235,4,113,
+    239,4,82,2,82,2,82,2,113,7,113,250,4,2,115,182,
+    0,0,0,4,0,4,22,8,3,8,1,8,1,8,1,8,
+    1,10,3,4,1,8,1,10,1,8,2,4,3,10,1,6,
+    2,22,2,8,1,8,1,10,1,14,1,4,4,4,1,2,
+    1,2,1,4,255,8,4,6,16,8,3,8,5,8,5,4,
+    6,10,1,8,30,8,6,8,8,8,10,8,9,8,5,4,
+    7,10,1,8,8,10,5,10,22,0,127,16,29,12,1,4,
+    2,4,1,6,2,4,1,10,1,8,2,6,2,8,2,16,
+    2,8,71,8,40,8,19,8,12,8,12,8,31,8,20,8,
+    33,8,28,10,24,10,13,10,10,8,11,6,14,4,3,2,
+    1,12,255,14,73,14,67,16,30,0,127,14,17,18,50,18,
+    45,18,25,14,53,14,63,14,49,0,127,14,29,0,127,10,
+    30,8,23,8,11,12,5,255,128,
 };
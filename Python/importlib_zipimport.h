@@ -1,621 +1,708 @@
 /* Auto-generated by Programs/_freeze_importlib.c */
 const unsigned char _Py_M__zipimport[] = {
-    99,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,4,0,0,0,64,0,0,0,115,80,1,0,0,100,0,
-    90,0,100,1,100,2,108,1,90,2,100,1,100,3,108,1,
-    109,3,90,3,109,4,90,4,1,0,100,1,100,2,108,5,
-    90,6,100,1,100,2,108,7,90,7,100,1,100,2,108,8,
-    90,8,100,1,100,2,108,9,90,9,100,1,100,2,108,10,
-    90,10,100,1,100,2,108,11,90,11,100,1,100,2,108,12,
-    90,12,100,4,100,5,103,2,90,13,101,2,106,14,90,14,
-    101,2,106,15,100,6,100,2,133,2,25,0,90,16,71,0,
-    100,7,100,4,132,0,100,4,101,17,131,3,90,18,105,0,
-    90,19,101,20,101,10,131,1,90,21,100,8,90,22,100,9,
-    90,23,100,10,90,24,71,0,100,11,100,5,132,0,100,5,
-    101,2,106,25,131,3,90,26,101,14,100,12,23,0,100,13,
-    100,13,102,3,101,14,100,14,23,0,100,15,100,13,102,3,
-    100,16,100,17,102,4,90,27,100,18,100,19,132,0,90,28,
-    100,20,100,21,132,0,90,29,100,22,100,23,132,0,90,30,
-    100,24,100,25,132,0,90,31,100,26,90,32,100,15,97,33,
-    100,27,100,28,132,0,90,34,100,29,100,30,132,0,90,35,
-    100,31,100,32,132,0,90,36,100,33,100,34,132,0,90,37,
-    101,20,101,37,106,38,131,1,90,39,100,35,100,36,132,0,
-    90,40,100,37,100,38,132,0,90,41,100,39,100,40,132,0,
-    90,42,100,41,100,42,132,0,90,43,100,43,100,44,132,0,
-    90,44,100,45,100,46,132,0,90,45,100,2,83,0,41,47,
-    97,80,2,0,0,122,105,112,105,109,112,111,114,116,32,112,
-    114,111,118,105,100,101,115,32,115,117,112,112,111,114,116,32,
-    102,111,114,32,105,109,112,111,114,116,105,110,103,32,80,121,
-    116,104,111,110,32,109,111,100,117,108,101,115,32,102,114,111,
-    109,32,90,105,112,32,97,114,99,104,105,118,101,115,46,10,
-    10,84,104,105,115,32,109,111,100,117,108,101,32,101,120,112,
-    111,114,116,115,32,116,104,114,101,101,32,111,98,106,101,99,
-    116,115,58,10,45,32,122,105,112,105,109,112,111,114,116,101,
-    114,58,32,97,32,99,108,97,115,115,59,32,105,116,115,32,
-    99,111,110,115,116,114,117,99,116,111,114,32,116,97,107,101,
-    115,32,97,32,112,97,116,104,32,116,111,32,97,32,90,105,
-    112,32,97,114,99,104,105,118,101,46,10,45,32,90,105,112,
-    73,109,112,111,114,116,69,114,114,111,114,58,32,101,120,99,
-    101,112,116,105,111,110,32,114,97,105,115,101,100,32,98,121,
-    32,122,105,112,105,109,112,111,114,116,101,114,32,111,98,106,
-    101,99,116,115,46,32,73,116,39,115,32,97,10,32,32,115,
-    117,98,99,108,97,115,115,32,111,102,32,73,109,112,111,114,
-    116,69,114,114,111,114,44,32,115,111,32,105,116,32,99,97,
-    110,32,98,101,32,99,97,117,103,104,116,32,97,115,32,73,
-    109,112,111,114,116,69,114,114,111,114,44,32,116,111,111,46,
-    10,45,32,95,122,105,112,95,100,105,114,101,99,116,111,114,
-    121,95,99,97,99,104,101,58,32,97,32,100,105,99,116,44,
-    32,109,97,112,112,105,110,103,32,97,114,99,104,105,118,101,
-    32,112,97,116,104,115,32,116,111,32,122,105,112,32,100,105,
-    114,101,99,116,111,114,121,10,32,32,105,110,102,111,32,100,
-    105,99,116,115,44,32,97,115,32,117,115,101,100,32,105,110,
-    32,122,105,112,105,109,112,111,114,116,101,114,46,95,102,105,
-    108,101,115,46,10,10,73,116,32,105,115,32,117,115,117,97,
-    108,108,121,32,110,111,116,32,110,101,101,100,101,100,32,116,
-    111,32,117,115,101,32,116,104,101,32,122,105,112,105,109,112,
-    111,114,116,32,109,111,100,117,108,101,32,101,120,112,108,105,
-    99,105,116,108,121,59,32,105,116,32,105,115,10,117,115,101,
-    100,32,98,121,32,116,104,101,32,98,117,105,108,116,105,110,
-    32,105,109,112,111,114,116,32,109,101,99,104,97,110,105,115,
-    109,32,102,111,114,32,115,121,115,46,112,97,116,104,32,105,
-    116,101,109,115,32,116,104,97,116,32,97,114,101,32,112,97,
-    116,104,115,10,116,111,32,90,105,112,32,97,114,99,104,105,
-    118,101,115,46,10,233,0,0,0,0,78,41,2,218,14,95,
-    117,110,112,97,99,107,95,117,105,110,116,49,54,218,14,95,
-    117,110,112,97,99,107,95,117,105,110,116,51,50,218,14,90,
-    105,112,73,109,112,111,114,116,69,114,114,111,114,218,11,122,
-    105,112,105,109,112,111,114,116,101,114,233,1,0,0,0,99,
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    1,0,0,0,64,0,0,0,115,12,0,0,0,101,0,90,
-    1,100,0,90,2,100,1,83,0,41,2,114,3,0,0,0,
-    78,41,3,218,8,95,95,110,97,109,101,95,95,218,10,95,
-    95,109,111,100,117,108,101,95,95,218,12,95,95,113,117,97,
-    108,110,97,109,101,95,95,169,0,114,9,0,0,0,114,9,
-    0,0,0,250,18,60,102,114,111,122,101,110,32,122,105,112,
-    105,109,112,111,114,116,62,114,3,0,0,0,34,0,0,0,
-    115,6,0,0,0,8,0,4,1,255,128,233,22,0,0,0,
-    115,4,0,0,0,80,75,5,6,105,255,255,0,0,99,0,
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,
-    0,0,0,64,0,0,0,115,126,0,0,0,101,0,90,1,
-    100,0,90,2,100,1,90,3,100,2,100,3,132,0,90,4,
-    100,29,100,5,100,6,132,1,90,5,100,29,100,7,100,8,
-    132,1,90,6,100,29,100,9,100,10,132,1,90,7,100,11,
-    100,12,132,0,90,8,100,13,100,14,132,0,90,9,100,15,
-    100,16,132,0,90,10,100,17,100,18,132,0,90,11,100,19,
-    100,20,132,0,90,12,100,21,100,22,132,0,90,13,100,23,
-    100,24,132,0,90,14,100,25,100,26,132,0,90,15,100,27,
-    100,28,132,0,90,16,100,4,83,0,41,30,114,4,0,0,
-    0,97,255,1,0,0,122,105,112,105,109,112,111,114,116,101,
-    114,40,97,114,99,104,105,118,101,112,97,116,104,41,32,45,
-    62,32,122,105,112,105,109,112,111,114,116,101,114,32,111,98,
-    106,101,99,116,10,10,32,32,32,32,67,114,101,97,116,101,
-    32,97,32,110,101,119,32,122,105,112,105,109,112,111,114,116,
-    101,114,32,105,110,115,116,97,110,99,101,46,32,39,97,114,
-    99,104,105,118,101,112,97,116,104,39,32,109,117,115,116,32,
-    98,101,32,97,32,112,97,116,104,32,116,111,10,32,32,32,
-    32,97,32,122,105,112,102,105,108,101,44,32,111,114,32,116,
-    111,32,97,32,115,112,101,99,105,102,105,99,32,112,97,116,
-    104,32,105,110,115,105,100,101,32,97,32,122,105,112,102,105,
-    108,101,46,32,70,111,114,32,101,120,97,109,112,108,101,44,
-    32,105,116,32,99,97,110,32,98,101,10,32,32,32,32,39,
+    88,132,2,2,208,4,122,105,112,105,109,112,111,114,116,32,
+    112,114,111,118,105,100,101,115,32,115,117,112,112,111,114,116,
+    32,102,111,114,32,105,109,112,111,114,116,105,110,103,32,80,
+    121,116,104,111,110,32,109,111,100,117,108,101,115,32,102,114,
+    111,109,32,90,105,112,32,97,114,99,104,105,118,101,115,46,
+    10,10,84,104,105,115,32,109,111,100,117,108,101,32,101,120,
+    112,111,114,116,115,32,116,104,114,101,101,32,111,98,106,101,
+    99,116,115,58,10,45,32,122,105,112,105,109,112,111,114,116,
+    101,114,58,32,97,32,99,108,97,115,115,59,32,105,116,115,
+    32,99,111,110,115,116,114,117,99,116,111,114,32,116,97,107,
+    101,115,32,97,32,112,97,116,104,32,116,111,32,97,32,90,
+    105,112,32,97,114,99,104,105,118,101,46,10,45,32,90,105,
+    112,73,109,112,111,114,116,69,114,114,111,114,58,32,101,120,
+    99,101,112,116,105,111,110,32,114,97,105,115,101,100,32,98,
+    121,32,122,105,112,105,109,112,111,114,116,101,114,32,111,98,
+    106,101,99,116,115,46,32,73,116,39,115,32,97,10,32,32,
+    115,117,98,99,108,97,115,115,32,111,102,32,73,109,112,111,
+    114,116,69,114,114,111,114,44,32,115,111,32,105,116,32,99,
+    97,110,32,98,101,32,99,97,117,103,104,116,32,97,115,32,
+    73,109,112,111,114,116,69,114,114,111,114,44,32,116,111,111,
+    46,10,45,32,95,122,105,112,95,100,105,114,101,99,116,111,
+    114,121,95,99,97,99,104,101,58,32,97,32,100,105,99,116,
+    44,32,109,97,112,112,105,110,103,32,97,114,99,104,105,118,
+    101,32,112,97,116,104,115,32,116,111,32,122,105,112,32,100,
+    105,114,101,99,116,111,114,121,10,32,32,105,110,102,111,32,
+    100,105,99,116,115,44,32,97,115,32,117,115,101,100,32,105,
+    110,32,122,105,112,105,109,112,111,114,116,101,114,46,95,102,
+    105,108,101,115,46,10,10,73,116,32,105,115,32,117,115,117,
+    97,108,108,121,32,110,111,116,32,110,101,101,100,101,100,32,
+    116,111,32,117,115,101,32,116,104,101,32,122,105,112,105,109,
+    112,111,114,116,32,109,111,100,117,108,101,32,101,120,112,108,
+    105,99,105,116,108,121,59,32,105,116,32,105,115,10,117,115,
+    101,100,32,98,121,32,116,104,101,32,98,117,105,108,116,105,
+    110,32,105,109,112,111,114,116,32,109,101,99,104,97,110,105,
+    115,109,32,102,111,114,32,115,121,115,46,112,97,116,104,32,
+    105,116,101,109,115,32,116,104,97,116,32,97,114,101,32,112,
+    97,116,104,115,10,116,111,32,90,105,112,32,97,114,99,104,
+    105,118,101,115,46,10,3,14,95,117,110,112,97,99,107,95,
+    117,105,110,116,49,54,3,14,95,117,110,112,97,99,107,95,
+    117,105,110,116,51,50,3,14,90,105,112,73,109,112,111,114,
+    116,69,114,114,111,114,3,11,122,105,112,105,109,112,111,114,
+    116,101,114,3,8,95,95,110,97,109,101,95,95,3,10,95,
+    95,109,111,100,117,108,101,95,95,3,12,95,95,113,117,97,
+    108,110,97,109,101,95,95,2,18,60,102,114,111,122,101,110,
+    32,122,105,112,105,109,112,111,114,116,62,2,255,3,122,105,
+    112,105,109,112,111,114,116,101,114,40,97,114,99,104,105,118,
+    101,112,97,116,104,41,32,45,62,32,122,105,112,105,109,112,
+    111,114,116,101,114,32,111,98,106,101,99,116,10,10,32,32,
+    32,32,67,114,101,97,116,101,32,97,32,110,101,119,32,122,
+    105,112,105,109,112,111,114,116,101,114,32,105,110,115,116,97,
+    110,99,101,46,32,39,97,114,99,104,105,118,101,112,97,116,
+    104,39,32,109,117,115,116,32,98,101,32,97,32,112,97,116,
+    104,32,116,111,10,32,32,32,32,97,32,122,105,112,102,105,
+    108,101,44,32,111,114,32,116,111,32,97,32,115,112,101,99,
+    105,102,105,99,32,112,97,116,104,32,105,110,115,105,100,101,
+    32,97,32,122,105,112,102,105,108,101,46,32,70,111,114,32,
+    101,120,97,109,112,108,101,44,32,105,116,32,99,97,110,32,
+    98,101,10,32,32,32,32,39,47,116,109,112,47,109,121,105,
+    109,112,111,114,116,46,122,105,112,39,44,32,111,114,32,39,
     47,116,109,112,47,109,121,105,109,112,111,114,116,46,122,105,
-    112,39,44,32,111,114,32,39,47,116,109,112,47,109,121,105,
-    109,112,111,114,116,46,122,105,112,47,109,121,100,105,114,101,
-    99,116,111,114,121,39,44,32,105,102,32,109,121,100,105,114,
-    101,99,116,111,114,121,32,105,115,32,97,10,32,32,32,32,
-    118,97,108,105,100,32,100,105,114,101,99,116,111,114,121,32,
-    105,110,115,105,100,101,32,116,104,101,32,97,114,99,104,105,
-    118,101,46,10,10,32,32,32,32,39,90,105,112,73,109,112,
-    111,114,116,69,114,114,111,114,32,105,115,32,114,97,105,115,
-    101,100,32,105,102,32,39,97,114,99,104,105,118,101,112,97,
-    116,104,39,32,100,111,101,115,110,39,116,32,112,111,105,110,
-    116,32,116,111,32,97,32,118,97,108,105,100,32,90,105,112,
-    10,32,32,32,32,97,114,99,104,105,118,101,46,10,10,32,
-    32,32,32,84,104,101,32,39,97,114,99,104,105,118,101,39,
-    32,97,116,116,114,105,98,117,116,101,32,111,102,32,122,105,
-    112,105,109,112,111,114,116,101,114,32,111,98,106,101,99,116,
-    115,32,99,111,110,116,97,105,110,115,32,116,104,101,32,110,
-    97,109,101,32,111,102,32,116,104,101,10,32,32,32,32,122,
-    105,112,102,105,108,101,32,116,97,114,103,101,116,101,100,46,
-    10,32,32,32,32,99,2,0,0,0,0,0,0,0,0,0,
-    0,0,8,0,0,0,9,0,0,0,67,0,0,0,115,34,
-    1,0,0,116,0,124,1,116,1,131,2,115,14,100,1,100,
-    0,108,2,125,2,124,2,160,3,124,1,161,1,125,1,124,
-    1,115,22,116,4,100,2,124,1,100,3,141,2,130,1,116,
-    5,114,30,124,1,160,6,116,5,116,7,161,2,125,1,103,
-    0,125,3,9,0,122,7,116,8,160,9,124,1,161,1,125,
-    4,87,0,110,34,4,0,116,10,116,11,102,2,121,144,1,
-    0,1,0,1,0,116,8,160,12,124,1,161,1,92,2,125,
-    5,125,6,124,5,124,1,107,2,114,66,116,4,100,5,124,
-    1,100,3,141,2,130,1,124,5,125,1,124,3,160,13,124,
-    6,161,1,1,0,89,0,110,14,124,4,106,14,100,6,64,
-    0,100,7,107,3,114,88,116,4,100,5,124,1,100,3,141,
-    2,130,1,113,90,113,33,122,6,116,15,124,1,25,0,125,
-    7,87,0,110,15,4,0,116,16,121,143,1,0,1,0,1,
-    0,116,17,124,1,131,1,125,7,124,7,116,15,124,1,60,
-    0,89,0,124,7,124,0,95,18,124,1,124,0,95,19,116,
-    8,106,20,124,3,100,0,100,0,100,8,133,3,25,0,142,
-    0,124,0,95,21,124,0,106,21,114,141,124,0,4,0,106,
-    21,116,7,55,0,2,0,95,21,100,0,83,0,100,0,83,
-    0,119,0,119,0,41,9,78,114,0,0,0,0,122,21,97,
+    112,47,109,121,100,105,114,101,99,116,111,114,121,39,44,32,
+    105,102,32,109,121,100,105,114,101,99,116,111,114,121,32,105,
+    115,32,97,10,32,32,32,32,118,97,108,105,100,32,100,105,
+    114,101,99,116,111,114,121,32,105,110,115,105,100,101,32,116,
+    104,101,32,97,114,99,104,105,118,101,46,10,10,32,32,32,
+    32,39,90,105,112,73,109,112,111,114,116,69,114,114,111,114,
+    32,105,115,32,114,97,105,115,101,100,32,105,102,32,39,97,
+    114,99,104,105,118,101,112,97,116,104,39,32,100,111,101,115,
+    110,39,116,32,112,111,105,110,116,32,116,111,32,97,32,118,
+    97,108,105,100,32,90,105,112,10,32,32,32,32,97,114,99,
+    104,105,118,101,46,10,10,32,32,32,32,84,104,101,32,39,
+    97,114,99,104,105,118,101,39,32,97,116,116,114,105,98,117,
+    116,101,32,111,102,32,122,105,112,105,109,112,111,114,116,101,
+    114,32,111,98,106,101,99,116,115,32,99,111,110,116,97,105,
+    110,115,32,116,104,101,32,110,97,109,101,32,111,102,32,116,
+    104,101,10,32,32,32,32,122,105,112,102,105,108,101,32,116,
+    97,114,103,101,116,101,100,46,10,32,32,32,32,2,21,97,
     114,99,104,105,118,101,32,112,97,116,104,32,105,115,32,101,
-    109,112,116,121,169,1,218,4,112,97,116,104,84,122,14,110,
-    111,116,32,97,32,90,105,112,32,102,105,108,101,105,0,240,
-    0,0,105,0,128,0,0,233,255,255,255,255,41,22,218,10,
-    105,115,105,110,115,116,97,110,99,101,218,3,115,116,114,218,
-    2,111,115,90,8,102,115,100,101,99,111,100,101,114,3,0,
-    0,0,218,12,97,108,116,95,112,97,116,104,95,115,101,112,
-    218,7,114,101,112,108,97,99,101,218,8,112,97,116,104,95,
-    115,101,112,218,19,95,98,111,111,116,115,116,114,97,112,95,
-    101,120,116,101,114,110,97,108,90,10,95,112,97,116,104,95,
-    115,116,97,116,218,7,79,83,69,114,114,111,114,218,10,86,
-    97,108,117,101,69,114,114,111,114,90,11,95,112,97,116,104,
-    95,115,112,108,105,116,218,6,97,112,112,101,110,100,90,7,
-    115,116,95,109,111,100,101,218,20,95,122,105,112,95,100,105,
-    114,101,99,116,111,114,121,95,99,97,99,104,101,218,8,75,
-    101,121,69,114,114,111,114,218,15,95,114,101,97,100,95,100,
-    105,114,101,99,116,111,114,121,218,6,95,102,105,108,101,115,
-    218,7,97,114,99,104,105,118,101,218,10,95,112,97,116,104,
-    95,106,111,105,110,218,6,112,114,101,102,105,120,41,8,218,
-    4,115,101,108,102,114,13,0,0,0,114,17,0,0,0,114,
-    31,0,0,0,90,2,115,116,90,7,100,105,114,110,97,109,
-    101,90,8,98,97,115,101,110,97,109,101,218,5,102,105,108,
-    101,115,114,9,0,0,0,114,9,0,0,0,114,10,0,0,
-    0,218,8,95,95,105,110,105,116,95,95,64,0,0,0,115,
-    70,0,0,0,10,1,8,1,10,1,4,1,12,1,4,1,
-    12,1,4,2,2,1,2,1,14,1,16,1,14,3,8,1,
-    12,1,4,1,14,1,14,3,12,2,2,1,2,240,2,18,
-    12,1,12,1,8,1,10,1,6,1,6,1,22,2,6,1,
-    18,1,4,255,2,249,2,239,255,128,122,20,122,105,112,105,
-    109,112,111,114,116,101,114,46,95,95,105,110,105,116,95,95,
-    78,99,3,0,0,0,0,0,0,0,0,0,0,0,5,0,
-    0,0,4,0,0,0,67,0,0,0,115,90,0,0,0,116,
-    0,160,1,100,1,116,2,161,2,1,0,116,3,124,0,124,
-    1,131,2,125,3,124,3,100,2,117,1,114,19,124,0,103,
-    0,102,2,83,0,116,4,124,0,124,1,131,2,125,4,116,
-    5,124,0,124,4,131,2,114,41,100,2,124,0,106,6,155,
-    0,116,7,155,0,124,4,155,0,157,3,103,1,102,2,83,
-    0,100,2,103,0,102,2,83,0,41,3,97,47,2,0,0,
-    102,105,110,100,95,108,111,97,100,101,114,40,102,117,108,108,
-    110,97,109,101,44,32,112,97,116,104,61,78,111,110,101,41,
-    32,45,62,32,115,101,108,102,44,32,115,116,114,32,111,114,
-    32,78,111,110,101,46,10,10,32,32,32,32,32,32,32,32,
-    83,101,97,114,99,104,32,102,111,114,32,97,32,109,111,100,
-    117,108,101,32,115,112,101,99,105,102,105,101,100,32,98,121,
-    32,39,102,117,108,108,110,97,109,101,39,46,32,39,102,117,
-    108,108,110,97,109,101,39,32,109,117,115,116,32,98,101,32,
-    116,104,101,10,32,32,32,32,32,32,32,32,102,117,108,108,
-    121,32,113,117,97,108,105,102,105,101,100,32,40,100,111,116,
-    116,101,100,41,32,109,111,100,117,108,101,32,110,97,109,101,
-    46,32,73,116,32,114,101,116,117,114,110,115,32,116,104,101,
-    32,122,105,112,105,109,112,111,114,116,101,114,10,32,32,32,
-    32,32,32,32,32,105,110,115,116,97,110,99,101,32,105,116,
-    115,101,108,102,32,105,102,32,116,104,101,32,109,111,100,117,
-    108,101,32,119,97,115,32,102,111,117,110,100,44,32,97,32,
-    115,116,114,105,110,103,32,99,111,110,116,97,105,110,105,110,
-    103,32,116,104,101,10,32,32,32,32,32,32,32,32,102,117,
-    108,108,32,112,97,116,104,32,110,97,109,101,32,105,102,32,
-    105,116,39,115,32,112,111,115,115,105,98,108,121,32,97,32,
-    112,111,114,116,105,111,110,32,111,102,32,97,32,110,97,109,
-    101,115,112,97,99,101,32,112,97,99,107,97,103,101,44,10,
-    32,32,32,32,32,32,32,32,111,114,32,78,111,110,101,32,
-    111,116,104,101,114,119,105,115,101,46,32,84,104,101,32,111,
+    109,112,116,121,3,4,112,97,116,104,2,14,110,111,116,32,
+    97,32,90,105,112,32,102,105,108,101,3,10,105,115,105,110,
+    115,116,97,110,99,101,3,3,115,116,114,3,2,111,115,3,
+    8,102,115,100,101,99,111,100,101,3,12,97,108,116,95,112,
+    97,116,104,95,115,101,112,3,7,114,101,112,108,97,99,101,
+    3,8,112,97,116,104,95,115,101,112,3,19,95,98,111,111,
+    116,115,116,114,97,112,95,101,120,116,101,114,110,97,108,3,
+    10,95,112,97,116,104,95,115,116,97,116,3,7,79,83,69,
+    114,114,111,114,3,10,86,97,108,117,101,69,114,114,111,114,
+    3,11,95,112,97,116,104,95,115,112,108,105,116,3,6,97,
+    112,112,101,110,100,3,7,115,116,95,109,111,100,101,3,20,
+    95,122,105,112,95,100,105,114,101,99,116,111,114,121,95,99,
+    97,99,104,101,3,8,75,101,121,69,114,114,111,114,3,15,
+    95,114,101,97,100,95,100,105,114,101,99,116,111,114,121,3,
+    6,95,102,105,108,101,115,3,7,97,114,99,104,105,118,101,
+    3,10,95,112,97,116,104,95,106,111,105,110,3,6,112,114,
+    101,102,105,120,3,4,115,101,108,102,3,2,115,116,3,7,
+    100,105,114,110,97,109,101,3,8,98,97,115,101,110,97,109,
+    101,3,5,102,105,108,101,115,3,8,95,95,105,110,105,116,
+    95,95,2,20,122,105,112,105,109,112,111,114,116,101,114,46,
+    95,95,105,110,105,116,95,95,2,175,4,102,105,110,100,95,
+    108,111,97,100,101,114,40,102,117,108,108,110,97,109,101,44,
+    32,112,97,116,104,61,78,111,110,101,41,32,45,62,32,115,
+    101,108,102,44,32,115,116,114,32,111,114,32,78,111,110,101,
+    46,10,10,32,32,32,32,32,32,32,32,83,101,97,114,99,
+    104,32,102,111,114,32,97,32,109,111,100,117,108,101,32,115,
+    112,101,99,105,102,105,101,100,32,98,121,32,39,102,117,108,
+    108,110,97,109,101,39,46,32,39,102,117,108,108,110,97,109,
+    101,39,32,109,117,115,116,32,98,101,32,116,104,101,10,32,
+    32,32,32,32,32,32,32,102,117,108,108,121,32,113,117,97,
+    108,105,102,105,101,100,32,40,100,111,116,116,101,100,41,32,
+    109,111,100,117,108,101,32,110,97,109,101,46,32,73,116,32,
+    114,101,116,117,114,110,115,32,116,104,101,32,122,105,112,105,
+    109,112,111,114,116,101,114,10,32,32,32,32,32,32,32,32,
+    105,110,115,116,97,110,99,101,32,105,116,115,101,108,102,32,
+    105,102,32,116,104,101,32,109,111,100,117,108,101,32,119,97,
+    115,32,102,111,117,110,100,44,32,97,32,115,116,114,105,110,
+    103,32,99,111,110,116,97,105,110,105,110,103,32,116,104,101,
+    10,32,32,32,32,32,32,32,32,102,117,108,108,32,112,97,
+    116,104,32,110,97,109,101,32,105,102,32,105,116,39,115,32,
+    112,111,115,115,105,98,108,121,32,97,32,112,111,114,116,105,
+    111,110,32,111,102,32,97,32,110,97,109,101,115,112,97,99,
+    101,32,112,97,99,107,97,103,101,44,10,32,32,32,32,32,
+    32,32,32,111,114,32,78,111,110,101,32,111,116,104,101,114,
+    119,105,115,101,46,32,84,104,101,32,111,112,116,105,111,110,
+    97,108,32,39,112,97,116,104,39,32,97,114,103,117,109,101,
+    110,116,32,105,115,32,105,103,110,111,114,101,100,32,45,45,
+    32,105,116,39,115,10,32,32,32,32,32,32,32,32,116,104,
+    101,114,101,32,102,111,114,32,99,111,109,112,97,116,105,98,
+    105,108,105,116,121,32,119,105,116,104,32,116,104,101,32,105,
+    109,112,111,114,116,101,114,32,112,114,111,116,111,99,111,108,
+    46,10,10,32,32,32,32,32,32,32,32,68,101,112,114,101,
+    99,97,116,101,100,32,115,105,110,99,101,32,80,121,116,104,
+    111,110,32,51,46,49,48,46,32,85,115,101,32,102,105,110,
+    100,95,115,112,101,99,40,41,32,105,110,115,116,101,97,100,
+    46,10,32,32,32,32,32,32,32,32,2,102,122,105,112,105,
+    109,112,111,114,116,101,114,46,102,105,110,100,95,108,111,97,
+    100,101,114,40,41,32,105,115,32,100,101,112,114,101,99,97,
+    116,101,100,32,97,110,100,32,115,108,97,116,101,100,32,102,
+    111,114,32,114,101,109,111,118,97,108,32,105,110,32,80,121,
+    116,104,111,110,32,51,46,49,50,59,32,117,115,101,32,102,
+    105,110,100,95,115,112,101,99,40,41,32,105,110,115,116,101,
+    97,100,3,9,95,119,97,114,110,105,110,103,115,3,4,119,
+    97,114,110,3,18,68,101,112,114,101,99,97,116,105,111,110,
+    87,97,114,110,105,110,103,3,16,95,103,101,116,95,109,111,
+    100,117,108,101,95,105,110,102,111,3,16,95,103,101,116,95,
+    109,111,100,117,108,101,95,112,97,116,104,3,7,95,105,115,
+    95,100,105,114,3,8,102,117,108,108,110,97,109,101,3,2,
+    109,105,3,7,109,111,100,112,97,116,104,3,11,102,105,110,
+    100,95,108,111,97,100,101,114,2,23,122,105,112,105,109,112,
+    111,114,116,101,114,46,102,105,110,100,95,108,111,97,100,101,
+    114,2,203,3,102,105,110,100,95,109,111,100,117,108,101,40,
+    102,117,108,108,110,97,109,101,44,32,112,97,116,104,61,78,
+    111,110,101,41,32,45,62,32,115,101,108,102,32,111,114,32,
+    78,111,110,101,46,10,10,32,32,32,32,32,32,32,32,83,
+    101,97,114,99,104,32,102,111,114,32,97,32,109,111,100,117,
+    108,101,32,115,112,101,99,105,102,105,101,100,32,98,121,32,
+    39,102,117,108,108,110,97,109,101,39,46,32,39,102,117,108,
+    108,110,97,109,101,39,32,109,117,115,116,32,98,101,32,116,
+    104,101,10,32,32,32,32,32,32,32,32,102,117,108,108,121,
+    32,113,117,97,108,105,102,105,101,100,32,40,100,111,116,116,
+    101,100,41,32,109,111,100,117,108,101,32,110,97,109,101,46,
+    32,73,116,32,114,101,116,117,114,110,115,32,116,104,101,32,
+    122,105,112,105,109,112,111,114,116,101,114,10,32,32,32,32,
+    32,32,32,32,105,110,115,116,97,110,99,101,32,105,116,115,
+    101,108,102,32,105,102,32,116,104,101,32,109,111,100,117,108,
+    101,32,119,97,115,32,102,111,117,110,100,44,32,111,114,32,
+    78,111,110,101,32,105,102,32,105,116,32,119,97,115,110,39,
+    116,46,10,32,32,32,32,32,32,32,32,84,104,101,32,111,
     112,116,105,111,110,97,108,32,39,112,97,116,104,39,32,97,
     114,103,117,109,101,110,116,32,105,115,32,105,103,110,111,114,
-    101,100,32,45,45,32,105,116,39,115,10,32,32,32,32,32,
-    32,32,32,116,104,101,114,101,32,102,111,114,32,99,111,109,
-    112,97,116,105,98,105,108,105,116,121,32,119,105,116,104,32,
+    101,100,32,45,45,32,105,116,39,115,32,116,104,101,114,101,
+    32,102,111,114,32,99,111,109,112,97,116,105,98,105,108,105,
+    116,121,10,32,32,32,32,32,32,32,32,119,105,116,104,32,
     116,104,101,32,105,109,112,111,114,116,101,114,32,112,114,111,
     116,111,99,111,108,46,10,10,32,32,32,32,32,32,32,32,
     68,101,112,114,101,99,97,116,101,100,32,115,105,110,99,101,
     32,80,121,116,104,111,110,32,51,46,49,48,46,32,85,115,
     101,32,102,105,110,100,95,115,112,101,99,40,41,32,105,110,
-    115,116,101,97,100,46,10,32,32,32,32,32,32,32,32,122,
+    115,116,101,97,100,46,10,32,32,32,32,32,32,32,32,2,
     102,122,105,112,105,109,112,111,114,116,101,114,46,102,105,110,
-    100,95,108,111,97,100,101,114,40,41,32,105,115,32,100,101,
+    100,95,109,111,100,117,108,101,40,41,32,105,115,32,100,101,
     112,114,101,99,97,116,101,100,32,97,110,100,32,115,108,97,
     116,101,100,32,102,111,114,32,114,101,109,111,118,97,108,32,
     105,110,32,80,121,116,104,111,110,32,51,46,49,50,59,32,
     117,115,101,32,102,105,110,100,95,115,112,101,99,40,41,32,
-    105,110,115,116,101,97,100,78,41,8,218,9,95,119,97,114,
-    110,105,110,103,115,218,4,119,97,114,110,218,18,68,101,112,
-    114,101,99,97,116,105,111,110,87,97,114,110,105,110,103,218,
-    16,95,103,101,116,95,109,111,100,117,108,101,95,105,110,102,
-    111,218,16,95,103,101,116,95,109,111,100,117,108,101,95,112,
-    97,116,104,218,7,95,105,115,95,100,105,114,114,29,0,0,
-    0,114,20,0,0,0,41,5,114,32,0,0,0,218,8,102,
-    117,108,108,110,97,109,101,114,13,0,0,0,218,2,109,105,
-    218,7,109,111,100,112,97,116,104,114,9,0,0,0,114,9,
-    0,0,0,114,10,0,0,0,218,11,102,105,110,100,95,108,
-    111,97,100,101,114,110,0,0,0,115,22,0,0,0,6,12,
-    2,2,4,254,10,3,8,1,8,2,10,7,10,1,24,4,
-    8,2,255,128,122,23,122,105,112,105,109,112,111,114,116,101,
-    114,46,102,105,110,100,95,108,111,97,100,101,114,99,3,0,
-    0,0,0,0,0,0,0,0,0,0,3,0,0,0,4,0,
-    0,0,67,0,0,0,115,28,0,0,0,116,0,160,1,100,
-    1,116,2,161,2,1,0,124,0,160,3,124,1,124,2,161,
-    2,100,2,25,0,83,0,41,4,97,203,1,0,0,102,105,
-    110,100,95,109,111,100,117,108,101,40,102,117,108,108,110,97,
-    109,101,44,32,112,97,116,104,61,78,111,110,101,41,32,45,
-    62,32,115,101,108,102,32,111,114,32,78,111,110,101,46,10,
-    10,32,32,32,32,32,32,32,32,83,101,97,114,99,104,32,
-    102,111,114,32,97,32,109,111,100,117,108,101,32,115,112,101,
-    99,105,102,105,101,100,32,98,121,32,39,102,117,108,108,110,
-    97,109,101,39,46,32,39,102,117,108,108,110,97,109,101,39,
-    32,109,117,115,116,32,98,101,32,116,104,101,10,32,32,32,
-    32,32,32,32,32,102,117,108,108,121,32,113,117,97,108,105,
-    102,105,101,100,32,40,100,111,116,116,101,100,41,32,109,111,
-    100,117,108,101,32,110,97,109,101,46,32,73,116,32,114,101,
-    116,117,114,110,115,32,116,104,101,32,122,105,112,105,109,112,
-    111,114,116,101,114,10,32,32,32,32,32,32,32,32,105,110,
-    115,116,97,110,99,101,32,105,116,115,101,108,102,32,105,102,
-    32,116,104,101,32,109,111,100,117,108,101,32,119,97,115,32,
-    102,111,117,110,100,44,32,111,114,32,78,111,110,101,32,105,
-    102,32,105,116,32,119,97,115,110,39,116,46,10,32,32,32,
-    32,32,32,32,32,84,104,101,32,111,112,116,105,111,110,97,
-    108,32,39,112,97,116,104,39,32,97,114,103,117,109,101,110,
-    116,32,105,115,32,105,103,110,111,114,101,100,32,45,45,32,
-    105,116,39,115,32,116,104,101,114,101,32,102,111,114,32,99,
-    111,109,112,97,116,105,98,105,108,105,116,121,10,32,32,32,
-    32,32,32,32,32,119,105,116,104,32,116,104,101,32,105,109,
-    112,111,114,116,101,114,32,112,114,111,116,111,99,111,108,46,
-    10,10,32,32,32,32,32,32,32,32,68,101,112,114,101,99,
-    97,116,101,100,32,115,105,110,99,101,32,80,121,116,104,111,
-    110,32,51,46,49,48,46,32,85,115,101,32,102,105,110,100,
-    95,115,112,101,99,40,41,32,105,110,115,116,101,97,100,46,
-    10,32,32,32,32,32,32,32,32,122,102,122,105,112,105,109,
-    112,111,114,116,101,114,46,102,105,110,100,95,109,111,100,117,
-    108,101,40,41,32,105,115,32,100,101,112,114,101,99,97,116,
-    101,100,32,97,110,100,32,115,108,97,116,101,100,32,102,111,
-    114,32,114,101,109,111,118,97,108,32,105,110,32,80,121,116,
-    104,111,110,32,51,46,49,50,59,32,117,115,101,32,102,105,
-    110,100,95,115,112,101,99,40,41,32,105,110,115,116,101,97,
-    100,114,0,0,0,0,78,41,4,114,35,0,0,0,114,36,
-    0,0,0,114,37,0,0,0,114,44,0,0,0,41,3,114,
-    32,0,0,0,114,41,0,0,0,114,13,0,0,0,114,9,
-    0,0,0,114,9,0,0,0,114,10,0,0,0,218,11,102,
-    105,110,100,95,109,111,100,117,108,101,147,0,0,0,115,10,
-    0,0,0,6,11,2,2,4,254,16,3,255,128,122,23,122,
-    105,112,105,109,112,111,114,116,101,114,46,102,105,110,100,95,
-    109,111,100,117,108,101,99,3,0,0,0,0,0,0,0,0,
-    0,0,0,7,0,0,0,5,0,0,0,67,0,0,0,115,
-    108,0,0,0,116,0,124,0,124,1,131,2,125,3,124,3,
-    100,1,117,1,114,17,116,1,106,2,124,1,124,0,124,3,
-    100,2,141,3,83,0,116,3,124,0,124,1,131,2,125,4,
-    116,4,124,0,124,4,131,2,114,52,124,0,106,5,155,0,
-    116,6,155,0,124,4,155,0,157,3,125,5,116,1,106,7,
-    124,1,100,1,100,3,100,4,141,3,125,6,124,6,106,8,
-    160,9,124,5,161,1,1,0,124,6,83,0,100,1,83,0,
-    41,5,122,107,67,114,101,97,116,101,32,97,32,77,111,100,
-    117,108,101,83,112,101,99,32,102,111,114,32,116,104,101,32,
-    115,112,101,99,105,102,105,101,100,32,109,111,100,117,108,101,
+    105,110,115,116,101,97,100,3,11,102,105,110,100,95,109,111,
+    100,117,108,101,2,23,122,105,112,105,109,112,111,114,116,101,
+    114,46,102,105,110,100,95,109,111,100,117,108,101,2,107,67,
+    114,101,97,116,101,32,97,32,77,111,100,117,108,101,83,112,
+    101,99,32,102,111,114,32,116,104,101,32,115,112,101,99,105,
+    102,105,101,100,32,109,111,100,117,108,101,46,10,10,32,32,
+    32,32,32,32,32,32,82,101,116,117,114,110,115,32,78,111,
+    110,101,32,105,102,32,116,104,101,32,109,111,100,117,108,101,
+    32,99,97,110,110,111,116,32,98,101,32,102,111,117,110,100,
+    46,10,32,32,32,32,32,32,32,32,3,10,105,115,95,112,
+    97,99,107,97,103,101,3,4,110,97,109,101,3,6,108,111,
+    97,100,101,114,3,10,95,98,111,111,116,115,116,114,97,112,
+    3,16,115,112,101,99,95,102,114,111,109,95,108,111,97,100,
+    101,114,3,10,77,111,100,117,108,101,83,112,101,99,3,26,
+    115,117,98,109,111,100,117,108,101,95,115,101,97,114,99,104,
+    95,108,111,99,97,116,105,111,110,115,3,6,116,97,114,103,
+    101,116,3,11,109,111,100,117,108,101,95,105,110,102,111,3,
+    4,115,112,101,99,3,9,102,105,110,100,95,115,112,101,99,
+    2,21,122,105,112,105,109,112,111,114,116,101,114,46,102,105,
+    110,100,95,115,112,101,99,2,166,1,103,101,116,95,99,111,
+    100,101,40,102,117,108,108,110,97,109,101,41,32,45,62,32,
+    99,111,100,101,32,111,98,106,101,99,116,46,10,10,32,32,
+    32,32,32,32,32,32,82,101,116,117,114,110,32,116,104,101,
+    32,99,111,100,101,32,111,98,106,101,99,116,32,102,111,114,
+    32,116,104,101,32,115,112,101,99,105,102,105,101,100,32,109,
+    111,100,117,108,101,46,32,82,97,105,115,101,32,90,105,112,
+    73,109,112,111,114,116,69,114,114,111,114,10,32,32,32,32,
+    32,32,32,32,105,102,32,116,104,101,32,109,111,100,117,108,
+    101,32,99,111,117,108,100,110,39,116,32,98,101,32,105,109,
+    112,111,114,116,101,100,46,10,32,32,32,32,32,32,32,32,
+    3,16,95,103,101,116,95,109,111,100,117,108,101,95,99,111,
+    100,101,3,4,99,111,100,101,3,9,105,115,112,97,99,107,
+    97,103,101,3,8,103,101,116,95,99,111,100,101,2,20,122,
+    105,112,105,109,112,111,114,116,101,114,46,103,101,116,95,99,
+    111,100,101,2,154,1,103,101,116,95,100,97,116,97,40,112,
+    97,116,104,110,97,109,101,41,32,45,62,32,115,116,114,105,
+    110,103,32,119,105,116,104,32,102,105,108,101,32,100,97,116,
+    97,46,10,10,32,32,32,32,32,32,32,32,82,101,116,117,
+    114,110,32,116,104,101,32,100,97,116,97,32,97,115,115,111,
+    99,105,97,116,101,100,32,119,105,116,104,32,39,112,97,116,
+    104,110,97,109,101,39,46,32,82,97,105,115,101,32,79,83,
+    69,114,114,111,114,32,105,102,10,32,32,32,32,32,32,32,
+    32,116,104,101,32,102,105,108,101,32,119,97,115,110,39,116,
+    32,102,111,117,110,100,46,10,32,32,32,32,32,32,32,32,
+    3,0,3,10,115,116,97,114,116,115,119,105,116,104,3,3,
+    108,101,110,3,9,95,103,101,116,95,100,97,116,97,3,8,
+    112,97,116,104,110,97,109,101,3,3,107,101,121,3,9,116,
+    111,99,95,101,110,116,114,121,3,8,103,101,116,95,100,97,
+    116,97,2,20,122,105,112,105,109,112,111,114,116,101,114,46,
+    103,101,116,95,100,97,116,97,2,165,1,103,101,116,95,102,
+    105,108,101,110,97,109,101,40,102,117,108,108,110,97,109,101,
+    41,32,45,62,32,102,105,108,101,110,97,109,101,32,115,116,
+    114,105,110,103,46,10,10,32,32,32,32,32,32,32,32,82,
+    101,116,117,114,110,32,116,104,101,32,102,105,108,101,110,97,
+    109,101,32,102,111,114,32,116,104,101,32,115,112,101,99,105,
+    102,105,101,100,32,109,111,100,117,108,101,32,111,114,32,114,
+    97,105,115,101,32,90,105,112,73,109,112,111,114,116,69,114,
+    114,111,114,10,32,32,32,32,32,32,32,32,105,102,32,105,
+    116,32,99,111,117,108,100,110,39,116,32,98,101,32,105,109,
+    112,111,114,116,101,100,46,10,32,32,32,32,32,32,32,32,
+    3,12,103,101,116,95,102,105,108,101,110,97,109,101,2,24,
+    122,105,112,105,109,112,111,114,116,101,114,46,103,101,116,95,
+    102,105,108,101,110,97,109,101,2,253,1,103,101,116,95,115,
+    111,117,114,99,101,40,102,117,108,108,110,97,109,101,41,32,
+    45,62,32,115,111,117,114,99,101,32,115,116,114,105,110,103,
     46,10,10,32,32,32,32,32,32,32,32,82,101,116,117,114,
-    110,115,32,78,111,110,101,32,105,102,32,116,104,101,32,109,
-    111,100,117,108,101,32,99,97,110,110,111,116,32,98,101,32,
-    102,111,117,110,100,46,10,32,32,32,32,32,32,32,32,78,
-    41,1,218,10,105,115,95,112,97,99,107,97,103,101,84,41,
-    3,218,4,110,97,109,101,90,6,108,111,97,100,101,114,114,
-    46,0,0,0,41,10,114,38,0,0,0,218,10,95,98,111,
-    111,116,115,116,114,97,112,90,16,115,112,101,99,95,102,114,
-    111,109,95,108,111,97,100,101,114,114,39,0,0,0,114,40,
-    0,0,0,114,29,0,0,0,114,20,0,0,0,90,10,77,
-    111,100,117,108,101,83,112,101,99,90,26,115,117,98,109,111,
-    100,117,108,101,95,115,101,97,114,99,104,95,108,111,99,97,
-    116,105,111,110,115,114,24,0,0,0,41,7,114,32,0,0,
-    0,114,41,0,0,0,90,6,116,97,114,103,101,116,90,11,
-    109,111,100,117,108,101,95,105,110,102,111,114,43,0,0,0,
-    114,13,0,0,0,90,4,115,112,101,99,114,9,0,0,0,
-    114,9,0,0,0,114,10,0,0,0,218,9,102,105,110,100,
-    95,115,112,101,99,163,0,0,0,115,26,0,0,0,10,5,
-    8,1,16,1,10,7,10,1,18,4,8,1,2,1,6,255,
-    12,2,4,1,4,2,255,128,122,21,122,105,112,105,109,112,
-    111,114,116,101,114,46,102,105,110,100,95,115,112,101,99,99,
-    2,0,0,0,0,0,0,0,0,0,0,0,5,0,0,0,
-    3,0,0,0,67,0,0,0,115,20,0,0,0,116,0,124,
-    0,124,1,131,2,92,3,125,2,125,3,125,4,124,2,83,
-    0,41,2,122,166,103,101,116,95,99,111,100,101,40,102,117,
-    108,108,110,97,109,101,41,32,45,62,32,99,111,100,101,32,
-    111,98,106,101,99,116,46,10,10,32,32,32,32,32,32,32,
-    32,82,101,116,117,114,110,32,116,104,101,32,99,111,100,101,
-    32,111,98,106,101,99,116,32,102,111,114,32,116,104,101,32,
-    115,112,101,99,105,102,105,101,100,32,109,111,100,117,108,101,
-    46,32,82,97,105,115,101,32,90,105,112,73,109,112,111,114,
-    116,69,114,114,111,114,10,32,32,32,32,32,32,32,32,105,
-    102,32,116,104,101,32,109,111,100,117,108,101,32,99,111,117,
-    108,100,110,39,116,32,98,101,32,105,109,112,111,114,116,101,
-    100,46,10,32,32,32,32,32,32,32,32,78,169,1,218,16,
-    95,103,101,116,95,109,111,100,117,108,101,95,99,111,100,101,
-    169,5,114,32,0,0,0,114,41,0,0,0,218,4,99,111,
-    100,101,218,9,105,115,112,97,99,107,97,103,101,114,43,0,
-    0,0,114,9,0,0,0,114,9,0,0,0,114,10,0,0,
-    0,218,8,103,101,116,95,99,111,100,101,190,0,0,0,115,
-    6,0,0,0,16,6,4,1,255,128,122,20,122,105,112,105,
-    109,112,111,114,116,101,114,46,103,101,116,95,99,111,100,101,
-    99,2,0,0,0,0,0,0,0,0,0,0,0,4,0,0,
-    0,8,0,0,0,67,0,0,0,115,112,0,0,0,116,0,
-    114,8,124,1,160,1,116,0,116,2,161,2,125,1,124,1,
-    125,2,124,1,160,3,124,0,106,4,116,2,23,0,161,1,
-    114,29,124,1,116,5,124,0,106,4,116,2,23,0,131,1,
-    100,1,133,2,25,0,125,2,122,7,124,0,106,6,124,2,
-    25,0,125,3,87,0,110,12,4,0,116,7,121,55,1,0,
-    1,0,1,0,116,8,100,2,100,3,124,2,131,3,130,1,
-    116,9,124,0,106,4,124,3,131,2,83,0,119,0,41,4,
-    122,154,103,101,116,95,100,97,116,97,40,112,97,116,104,110,
-    97,109,101,41,32,45,62,32,115,116,114,105,110,103,32,119,
-    105,116,104,32,102,105,108,101,32,100,97,116,97,46,10,10,
-    32,32,32,32,32,32,32,32,82,101,116,117,114,110,32,116,
-    104,101,32,100,97,116,97,32,97,115,115,111,99,105,97,116,
-    101,100,32,119,105,116,104,32,39,112,97,116,104,110,97,109,
-    101,39,46,32,82,97,105,115,101,32,79,83,69,114,114,111,
-    114,32,105,102,10,32,32,32,32,32,32,32,32,116,104,101,
-    32,102,105,108,101,32,119,97,115,110,39,116,32,102,111,117,
-    110,100,46,10,32,32,32,32,32,32,32,32,78,114,0,0,
-    0,0,218,0,41,10,114,18,0,0,0,114,19,0,0,0,
-    114,20,0,0,0,218,10,115,116,97,114,116,115,119,105,116,
-    104,114,29,0,0,0,218,3,108,101,110,114,28,0,0,0,
-    114,26,0,0,0,114,22,0,0,0,218,9,95,103,101,116,
-    95,100,97,116,97,41,4,114,32,0,0,0,218,8,112,97,
-    116,104,110,97,109,101,90,3,107,101,121,218,9,116,111,99,
-    95,101,110,116,114,121,114,9,0,0,0,114,9,0,0,0,
-    114,10,0,0,0,218,8,103,101,116,95,100,97,116,97,200,
-    0,0,0,115,24,0,0,0,4,6,12,1,4,2,16,1,
-    22,1,2,2,14,1,12,1,12,1,12,1,2,254,255,128,
-    122,20,122,105,112,105,109,112,111,114,116,101,114,46,103,101,
-    116,95,100,97,116,97,99,2,0,0,0,0,0,0,0,0,
-    0,0,0,5,0,0,0,3,0,0,0,67,0,0,0,115,
-    20,0,0,0,116,0,124,0,124,1,131,2,92,3,125,2,
-    125,3,125,4,124,4,83,0,41,2,122,165,103,101,116,95,
-    102,105,108,101,110,97,109,101,40,102,117,108,108,110,97,109,
-    101,41,32,45,62,32,102,105,108,101,110,97,109,101,32,115,
-    116,114,105,110,103,46,10,10,32,32,32,32,32,32,32,32,
-    82,101,116,117,114,110,32,116,104,101,32,102,105,108,101,110,
-    97,109,101,32,102,111,114,32,116,104,101,32,115,112,101,99,
-    105,102,105,101,100,32,109,111,100,117,108,101,32,111,114,32,
-    114,97,105,115,101,32,90,105,112,73,109,112,111,114,116,69,
-    114,114,111,114,10,32,32,32,32,32,32,32,32,105,102,32,
-    105,116,32,99,111,117,108,100,110,39,116,32,98,101,32,105,
-    109,112,111,114,116,101,100,46,10,32,32,32,32,32,32,32,
-    32,78,114,50,0,0,0,114,52,0,0,0,114,9,0,0,
-    0,114,9,0,0,0,114,10,0,0,0,218,12,103,101,116,
-    95,102,105,108,101,110,97,109,101,221,0,0,0,115,6,0,
-    0,0,16,8,4,1,255,128,122,24,122,105,112,105,109,112,
-    111,114,116,101,114,46,103,101,116,95,102,105,108,101,110,97,
-    109,101,99,2,0,0,0,0,0,0,0,0,0,0,0,6,
-    0,0,0,8,0,0,0,67,0,0,0,115,126,0,0,0,
-    116,0,124,0,124,1,131,2,125,2,124,2,100,1,117,0,
-    114,18,116,1,100,2,124,1,155,2,157,2,124,1,100,3,
-    141,2,130,1,116,2,124,0,124,1,131,2,125,3,124,2,
-    114,32,116,3,160,4,124,3,100,4,161,2,125,4,110,5,
-    124,3,155,0,100,5,157,2,125,4,122,7,124,0,106,5,
-    124,4,25,0,125,5,87,0,110,9,4,0,116,6,121,62,
-    1,0,1,0,1,0,89,0,100,1,83,0,116,7,124,0,
-    106,8,124,5,131,2,160,9,161,0,83,0,119,0,41,6,
-    122,253,103,101,116,95,115,111,117,114,99,101,40,102,117,108,
-    108,110,97,109,101,41,32,45,62,32,115,111,117,114,99,101,
-    32,115,116,114,105,110,103,46,10,10,32,32,32,32,32,32,
-    32,32,82,101,116,117,114,110,32,116,104,101,32,115,111,117,
-    114,99,101,32,99,111,100,101,32,102,111,114,32,116,104,101,
-    32,115,112,101,99,105,102,105,101,100,32,109,111,100,117,108,
-    101,46,32,82,97,105,115,101,32,90,105,112,73,109,112,111,
-    114,116,69,114,114,111,114,10,32,32,32,32,32,32,32,32,
-    105,102,32,116,104,101,32,109,111,100,117,108,101,32,99,111,
-    117,108,100,110,39,116,32,98,101,32,102,111,117,110,100,44,
-    32,114,101,116,117,114,110,32,78,111,110,101,32,105,102,32,
-    116,104,101,32,97,114,99,104,105,118,101,32,100,111,101,115,
-    10,32,32,32,32,32,32,32,32,99,111,110,116,97,105,110,
-    32,116,104,101,32,109,111,100,117,108,101,44,32,98,117,116,
-    32,104,97,115,32,110,111,32,115,111,117,114,99,101,32,102,
-    111,114,32,105,116,46,10,32,32,32,32,32,32,32,32,78,
-    250,18,99,97,110,39,116,32,102,105,110,100,32,109,111,100,
-    117,108,101,32,169,1,114,47,0,0,0,250,11,95,95,105,
-    110,105,116,95,95,46,112,121,250,3,46,112,121,41,10,114,
-    38,0,0,0,114,3,0,0,0,114,39,0,0,0,114,21,
-    0,0,0,114,30,0,0,0,114,28,0,0,0,114,26,0,
-    0,0,114,59,0,0,0,114,29,0,0,0,218,6,100,101,
-    99,111,100,101,41,6,114,32,0,0,0,114,41,0,0,0,
-    114,42,0,0,0,114,13,0,0,0,218,8,102,117,108,108,
-    112,97,116,104,114,61,0,0,0,114,9,0,0,0,114,9,
-    0,0,0,114,10,0,0,0,218,10,103,101,116,95,115,111,
-    117,114,99,101,233,0,0,0,115,28,0,0,0,10,7,8,
-    1,18,1,10,2,4,1,14,1,10,2,2,2,14,1,12,
-    1,6,2,16,1,2,253,255,128,122,22,122,105,112,105,109,
-    112,111,114,116,101,114,46,103,101,116,95,115,111,117,114,99,
-    101,99,2,0,0,0,0,0,0,0,0,0,0,0,3,0,
-    0,0,4,0,0,0,67,0,0,0,115,40,0,0,0,116,
-    0,124,0,124,1,131,2,125,2,124,2,100,1,117,0,114,
-    18,116,1,100,2,124,1,155,2,157,2,124,1,100,3,141,
-    2,130,1,124,2,83,0,41,4,122,171,105,115,95,112,97,
-    99,107,97,103,101,40,102,117,108,108,110,97,109,101,41,32,
-    45,62,32,98,111,111,108,46,10,10,32,32,32,32,32,32,
-    32,32,82,101,116,117,114,110,32,84,114,117,101,32,105,102,
-    32,116,104,101,32,109,111,100,117,108,101,32,115,112,101,99,
-    105,102,105,101,100,32,98,121,32,102,117,108,108,110,97,109,
-    101,32,105,115,32,97,32,112,97,99,107,97,103,101,46,10,
-    32,32,32,32,32,32,32,32,82,97,105,115,101,32,90,105,
-    112,73,109,112,111,114,116,69,114,114,111,114,32,105,102,32,
-    116,104,101,32,109,111,100,117,108,101,32,99,111,117,108,100,
-    110,39,116,32,98,101,32,102,111,117,110,100,46,10,32,32,
-    32,32,32,32,32,32,78,114,64,0,0,0,114,65,0,0,
-    0,41,2,114,38,0,0,0,114,3,0,0,0,41,3,114,
-    32,0,0,0,114,41,0,0,0,114,42,0,0,0,114,9,
-    0,0,0,114,9,0,0,0,114,10,0,0,0,114,46,0,
-    0,0,3,1,0,0,115,10,0,0,0,10,6,8,1,18,
-    1,4,1,255,128,122,22,122,105,112,105,109,112,111,114,116,
-    101,114,46,105,115,95,112,97,99,107,97,103,101,99,2,0,
-    0,0,0,0,0,0,0,0,0,0,9,0,0,0,8,0,
-    0,0,67,0,0,0,115,252,0,0,0,100,1,125,2,116,
-    0,160,1,124,2,116,2,161,2,1,0,116,3,124,0,124,
-    1,131,2,92,3,125,3,125,4,125,5,116,4,106,5,160,
-    6,124,1,161,1,125,6,124,6,100,2,117,0,115,31,116,
-    7,124,6,116,8,131,2,115,40,116,8,124,1,131,1,125,
-    6,124,6,116,4,106,5,124,1,60,0,124,0,124,6,95,
-    9,122,42,124,4,114,62,116,10,124,0,124,1,131,2,125,
-    7,116,11,160,12,124,0,106,13,124,7,161,2,125,8,124,
-    8,103,1,124,6,95,14,116,15,124,6,100,3,131,2,115,
-    70,116,16,124,6,95,16,116,11,160,17,124,6,106,18,124,
-    1,124,5,161,3,1,0,116,19,124,3,124,6,106,18,131,
-    2,1,0,87,0,110,8,1,0,1,0,1,0,116,4,106,
-    5,124,1,61,0,130,0,122,7,116,4,106,5,124,1,25,
-    0,125,6,87,0,110,14,4,0,116,20,121,125,1,0,1,
-    0,1,0,116,21,100,4,124,1,155,2,100,5,157,3,131,
-    1,130,1,116,22,160,23,100,6,124,1,124,5,161,3,1,
-    0,124,6,83,0,119,0,41,7,97,64,1,0,0,108,111,
-    97,100,95,109,111,100,117,108,101,40,102,117,108,108,110,97,
-    109,101,41,32,45,62,32,109,111,100,117,108,101,46,10,10,
-    32,32,32,32,32,32,32,32,76,111,97,100,32,116,104,101,
+    110,32,116,104,101,32,115,111,117,114,99,101,32,99,111,100,
+    101,32,102,111,114,32,116,104,101,32,115,112,101,99,105,102,
+    105,101,100,32,109,111,100,117,108,101,46,32,82,97,105,115,
+    101,32,90,105,112,73,109,112,111,114,116,69,114,114,111,114,
+    10,32,32,32,32,32,32,32,32,105,102,32,116,104,101,32,
+    109,111,100,117,108,101,32,99,111,117,108,100,110,39,116,32,
+    98,101,32,102,111,117,110,100,44,32,114,101,116,117,114,110,
+    32,78,111,110,101,32,105,102,32,116,104,101,32,97,114,99,
+    104,105,118,101,32,100,111,101,115,10,32,32,32,32,32,32,
+    32,32,99,111,110,116,97,105,110,32,116,104,101,32,109,111,
+    100,117,108,101,44,32,98,117,116,32,104,97,115,32,110,111,
+    32,115,111,117,114,99,101,32,102,111,114,32,105,116,46,10,
+    32,32,32,32,32,32,32,32,2,18,99,97,110,39,116,32,
+    102,105,110,100,32,109,111,100,117,108,101,32,2,11,95,95,
+    105,110,105,116,95,95,46,112,121,2,3,46,112,121,3,6,
+    100,101,99,111,100,101,3,8,102,117,108,108,112,97,116,104,
+    3,10,103,101,116,95,115,111,117,114,99,101,2,22,122,105,
+    112,105,109,112,111,114,116,101,114,46,103,101,116,95,115,111,
+    117,114,99,101,2,171,1,105,115,95,112,97,99,107,97,103,
+    101,40,102,117,108,108,110,97,109,101,41,32,45,62,32,98,
+    111,111,108,46,10,10,32,32,32,32,32,32,32,32,82,101,
+    116,117,114,110,32,84,114,117,101,32,105,102,32,116,104,101,
     32,109,111,100,117,108,101,32,115,112,101,99,105,102,105,101,
-    100,32,98,121,32,39,102,117,108,108,110,97,109,101,39,46,
-    32,39,102,117,108,108,110,97,109,101,39,32,109,117,115,116,
-    32,98,101,32,116,104,101,10,32,32,32,32,32,32,32,32,
-    102,117,108,108,121,32,113,117,97,108,105,102,105,101,100,32,
-    40,100,111,116,116,101,100,41,32,109,111,100,117,108,101,32,
-    110,97,109,101,46,32,73,116,32,114,101,116,117,114,110,115,
-    32,116,104,101,32,105,109,112,111,114,116,101,100,10,32,32,
-    32,32,32,32,32,32,109,111,100,117,108,101,44,32,111,114,
-    32,114,97,105,115,101,115,32,90,105,112,73,109,112,111,114,
-    116,69,114,114,111,114,32,105,102,32,105,116,32,99,111,117,
-    108,100,32,110,111,116,32,98,101,32,105,109,112,111,114,116,
-    101,100,46,10,10,32,32,32,32,32,32,32,32,68,101,112,
-    114,101,99,97,116,101,100,32,115,105,110,99,101,32,80,121,
-    116,104,111,110,32,51,46,49,48,46,32,85,115,101,32,101,
-    120,101,99,95,109,111,100,117,108,101,40,41,32,105,110,115,
-    116,101,97,100,46,10,32,32,32,32,32,32,32,32,122,114,
-    122,105,112,105,109,112,111,114,116,46,122,105,112,105,109,112,
-    111,114,116,101,114,46,108,111,97,100,95,109,111,100,117,108,
-    101,40,41,32,105,115,32,100,101,112,114,101,99,97,116,101,
-    100,32,97,110,100,32,115,108,97,116,101,100,32,102,111,114,
-    32,114,101,109,111,118,97,108,32,105,110,32,80,121,116,104,
-    111,110,32,51,46,49,50,59,32,117,115,101,32,101,120,101,
-    99,95,109,111,100,117,108,101,40,41,32,105,110,115,116,101,
-    97,100,78,218,12,95,95,98,117,105,108,116,105,110,115,95,
-    95,122,14,76,111,97,100,101,100,32,109,111,100,117,108,101,
-    32,122,25,32,110,111,116,32,102,111,117,110,100,32,105,110,
-    32,115,121,115,46,109,111,100,117,108,101,115,122,30,105,109,
-    112,111,114,116,32,123,125,32,35,32,108,111,97,100,101,100,
-    32,102,114,111,109,32,90,105,112,32,123,125,41,24,114,35,
-    0,0,0,114,36,0,0,0,114,37,0,0,0,114,51,0,
-    0,0,218,3,115,121,115,218,7,109,111,100,117,108,101,115,
-    218,3,103,101,116,114,15,0,0,0,218,12,95,109,111,100,
-    117,108,101,95,116,121,112,101,218,10,95,95,108,111,97,100,
-    101,114,95,95,114,39,0,0,0,114,21,0,0,0,114,30,
-    0,0,0,114,29,0,0,0,90,8,95,95,112,97,116,104,
-    95,95,218,7,104,97,115,97,116,116,114,114,71,0,0,0,
-    90,14,95,102,105,120,95,117,112,95,109,111,100,117,108,101,
-    218,8,95,95,100,105,99,116,95,95,218,4,101,120,101,99,
-    114,26,0,0,0,218,11,73,109,112,111,114,116,69,114,114,
-    111,114,114,48,0,0,0,218,16,95,118,101,114,98,111,115,
-    101,95,109,101,115,115,97,103,101,41,9,114,32,0,0,0,
-    114,41,0,0,0,218,3,109,115,103,114,53,0,0,0,114,
-    54,0,0,0,114,43,0,0,0,90,3,109,111,100,114,13,
-    0,0,0,114,69,0,0,0,114,9,0,0,0,114,9,0,
-    0,0,114,10,0,0,0,218,11,108,111,97,100,95,109,111,
-    100,117,108,101,16,1,0,0,115,56,0,0,0,4,9,12,
-    2,16,1,12,1,18,1,8,1,10,1,6,1,2,2,4,
-    1,10,3,14,1,8,1,10,2,6,1,16,1,16,1,6,
-    1,8,1,2,1,2,2,14,1,12,1,16,1,14,1,4,
-    1,2,253,255,128,122,23,122,105,112,105,109,112,111,114,116,
-    101,114,46,108,111,97,100,95,109,111,100,117,108,101,99,2,
-    0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,8,
-    0,0,0,67,0,0,0,115,64,0,0,0,122,10,124,0,
-    160,0,124,1,161,1,115,9,87,0,100,1,83,0,87,0,
-    110,9,4,0,116,1,121,31,1,0,1,0,1,0,89,0,
-    100,1,83,0,100,2,100,3,108,2,109,3,125,2,1,0,
-    124,2,124,0,124,1,131,2,83,0,119,0,41,4,122,204,
-    82,101,116,117,114,110,32,116,104,101,32,82,101,115,111,117,
-    114,99,101,82,101,97,100,101,114,32,102,111,114,32,97,32,
-    112,97,99,107,97,103,101,32,105,110,32,97,32,122,105,112,
-    32,102,105,108,101,46,10,10,32,32,32,32,32,32,32,32,
-    73,102,32,39,102,117,108,108,110,97,109,101,39,32,105,115,
-    32,97,32,112,97,99,107,97,103,101,32,119,105,116,104,105,
-    110,32,116,104,101,32,122,105,112,32,102,105,108,101,44,32,
-    114,101,116,117,114,110,32,116,104,101,10,32,32,32,32,32,
-    32,32,32,39,82,101,115,111,117,114,99,101,82,101,97,100,
-    101,114,39,32,111,98,106,101,99,116,32,102,111,114,32,116,
-    104,101,32,112,97,99,107,97,103,101,46,32,32,79,116,104,
-    101,114,119,105,115,101,32,114,101,116,117,114,110,32,78,111,
-    110,101,46,10,32,32,32,32,32,32,32,32,78,114,0,0,
-    0,0,41,1,218,9,90,105,112,82,101,97,100,101,114,41,
-    4,114,46,0,0,0,114,3,0,0,0,90,17,105,109,112,
-    111,114,116,108,105,98,46,114,101,97,100,101,114,115,114,84,
-    0,0,0,41,3,114,32,0,0,0,114,41,0,0,0,114,
-    84,0,0,0,114,9,0,0,0,114,9,0,0,0,114,10,
-    0,0,0,218,19,103,101,116,95,114,101,115,111,117,114,99,
-    101,95,114,101,97,100,101,114,59,1,0,0,115,20,0,0,
-    0,2,6,10,1,6,1,4,255,12,2,6,1,12,1,10,
-    1,2,253,255,128,122,31,122,105,112,105,109,112,111,114,116,
-    101,114,46,103,101,116,95,114,101,115,111,117,114,99,101,95,
-    114,101,97,100,101,114,99,1,0,0,0,0,0,0,0,0,
-    0,0,0,1,0,0,0,8,0,0,0,67,0,0,0,115,
-    72,0,0,0,122,15,116,0,124,0,106,1,131,1,124,0,
-    95,2,124,0,106,2,116,3,124,0,106,1,60,0,87,0,
-    100,1,83,0,4,0,116,4,121,35,1,0,1,0,1,0,
-    116,3,160,5,124,0,106,1,100,1,161,2,1,0,100,1,
-    124,0,95,2,89,0,100,1,83,0,119,0,41,2,122,41,
-    82,101,108,111,97,100,32,116,104,101,32,102,105,108,101,32,
-    100,97,116,97,32,111,102,32,116,104,101,32,97,114,99,104,
-    105,118,101,32,112,97,116,104,46,78,41,6,114,27,0,0,
-    0,114,29,0,0,0,114,28,0,0,0,114,25,0,0,0,
-    114,3,0,0,0,218,3,112,111,112,169,1,114,32,0,0,
-    0,114,9,0,0,0,114,9,0,0,0,114,10,0,0,0,
-    218,17,105,110,118,97,108,105,100,97,116,101,95,99,97,99,
-    104,101,115,74,1,0,0,115,16,0,0,0,2,2,12,1,
-    18,1,12,1,14,1,12,1,2,254,255,128,122,29,122,105,
-    112,105,109,112,111,114,116,101,114,46,105,110,118,97,108,105,
-    100,97,116,101,95,99,97,99,104,101,115,99,1,0,0,0,
-    0,0,0,0,0,0,0,0,1,0,0,0,5,0,0,0,
-    67,0,0,0,115,24,0,0,0,100,1,124,0,106,0,155,
-    0,116,1,155,0,124,0,106,2,155,0,100,2,157,5,83,
-    0,41,3,78,122,21,60,122,105,112,105,109,112,111,114,116,
-    101,114,32,111,98,106,101,99,116,32,34,122,2,34,62,41,
-    3,114,29,0,0,0,114,20,0,0,0,114,31,0,0,0,
-    114,87,0,0,0,114,9,0,0,0,114,9,0,0,0,114,
-    10,0,0,0,218,8,95,95,114,101,112,114,95,95,84,1,
-    0,0,115,4,0,0,0,24,1,255,128,122,20,122,105,112,
-    105,109,112,111,114,116,101,114,46,95,95,114,101,112,114,95,
-    95,169,1,78,41,17,114,6,0,0,0,114,7,0,0,0,
-    114,8,0,0,0,218,7,95,95,100,111,99,95,95,114,34,
-    0,0,0,114,44,0,0,0,114,45,0,0,0,114,49,0,
-    0,0,114,55,0,0,0,114,62,0,0,0,114,63,0,0,
-    0,114,70,0,0,0,114,46,0,0,0,114,83,0,0,0,
-    114,85,0,0,0,114,88,0,0,0,114,89,0,0,0,114,
-    9,0,0,0,114,9,0,0,0,114,9,0,0,0,114,10,
-    0,0,0,114,4,0,0,0,46,0,0,0,115,32,0,0,
-    0,8,0,4,1,8,17,10,46,10,37,10,16,8,27,8,
-    10,8,21,8,12,8,26,8,13,8,43,8,15,12,10,255,
-    128,122,12,95,95,105,110,105,116,95,95,46,112,121,99,84,
-    114,66,0,0,0,70,41,3,122,4,46,112,121,99,84,70,
-    41,3,114,67,0,0,0,70,70,99,2,0,0,0,0,0,
-    0,0,0,0,0,0,2,0,0,0,4,0,0,0,67,0,
-    0,0,115,20,0,0,0,124,0,106,0,124,1,160,1,100,
-    1,161,1,100,2,25,0,23,0,83,0,41,3,78,218,1,
-    46,233,2,0,0,0,41,2,114,31,0,0,0,218,10,114,
-    112,97,114,116,105,116,105,111,110,41,2,114,32,0,0,0,
-    114,41,0,0,0,114,9,0,0,0,114,9,0,0,0,114,
-    10,0,0,0,114,39,0,0,0,102,1,0,0,115,4,0,
-    0,0,20,1,255,128,114,39,0,0,0,99,2,0,0,0,
-    0,0,0,0,0,0,0,0,3,0,0,0,2,0,0,0,
-    67,0,0,0,115,18,0,0,0,124,1,116,0,23,0,125,
-    2,124,2,124,0,106,1,118,0,83,0,114,90,0,0,0,
-    41,2,114,20,0,0,0,114,28,0,0,0,41,3,114,32,
-    0,0,0,114,13,0,0,0,90,7,100,105,114,112,97,116,
-    104,114,9,0,0,0,114,9,0,0,0,114,10,0,0,0,
-    114,40,0,0,0,106,1,0,0,115,6,0,0,0,8,4,
-    10,2,255,128,114,40,0,0,0,99,2,0,0,0,0,0,
-    0,0,0,0,0,0,7,0,0,0,4,0,0,0,67,0,
-    0,0,115,56,0,0,0,116,0,124,0,124,1,131,2,125,
-    2,116,1,68,0,93,18,92,3,125,3,125,4,125,5,124,
-    2,124,3,23,0,125,6,124,6,124,0,106,2,118,0,114,
-    25,124,5,2,0,1,0,83,0,113,7,100,0,83,0,114,
-    90,0,0,0,41,3,114,39,0,0,0,218,16,95,122,105,
-    112,95,115,101,97,114,99,104,111,114,100,101,114,114,28,0,
-    0,0,41,7,114,32,0,0,0,114,41,0,0,0,114,13,
-    0,0,0,218,6,115,117,102,102,105,120,218,10,105,115,98,
-    121,116,101,99,111,100,101,114,54,0,0,0,114,69,0,0,
-    0,114,9,0,0,0,114,9,0,0,0,114,10,0,0,0,
-    114,38,0,0,0,115,1,0,0,115,16,0,0,0,10,1,
-    14,1,8,1,10,1,8,1,2,255,4,2,255,128,114,38,
-    0,0,0,99,1,0,0,0,0,0,0,0,0,0,0,0,
-    26,0,0,0,9,0,0,0,67,0,0,0,115,226,4,0,
+    100,32,98,121,32,102,117,108,108,110,97,109,101,32,105,115,
+    32,97,32,112,97,99,107,97,103,101,46,10,32,32,32,32,
+    32,32,32,32,82,97,105,115,101,32,90,105,112,73,109,112,
+    111,114,116,69,114,114,111,114,32,105,102,32,116,104,101,32,
+    109,111,100,117,108,101,32,99,111,117,108,100,110,39,116,32,
+    98,101,32,102,111,117,110,100,46,10,32,32,32,32,32,32,
+    32,32,2,22,122,105,112,105,109,112,111,114,116,101,114,46,
+    105,115,95,112,97,99,107,97,103,101,2,192,2,108,111,97,
+    100,95,109,111,100,117,108,101,40,102,117,108,108,110,97,109,
+    101,41,32,45,62,32,109,111,100,117,108,101,46,10,10,32,
+    32,32,32,32,32,32,32,76,111,97,100,32,116,104,101,32,
+    109,111,100,117,108,101,32,115,112,101,99,105,102,105,101,100,
+    32,98,121,32,39,102,117,108,108,110,97,109,101,39,46,32,
+    39,102,117,108,108,110,97,109,101,39,32,109,117,115,116,32,
+    98,101,32,116,104,101,10,32,32,32,32,32,32,32,32,102,
+    117,108,108,121,32,113,117,97,108,105,102,105,101,100,32,40,
+    100,111,116,116,101,100,41,32,109,111,100,117,108,101,32,110,
+    97,109,101,46,32,73,116,32,114,101,116,117,114,110,115,32,
+    116,104,101,32,105,109,112,111,114,116,101,100,10,32,32,32,
+    32,32,32,32,32,109,111,100,117,108,101,44,32,111,114,32,
+    114,97,105,115,101,115,32,90,105,112,73,109,112,111,114,116,
+    69,114,114,111,114,32,105,102,32,105,116,32,99,111,117,108,
+    100,32,110,111,116,32,98,101,32,105,109,112,111,114,116,101,
+    100,46,10,10,32,32,32,32,32,32,32,32,68,101,112,114,
+    101,99,97,116,101,100,32,115,105,110,99,101,32,80,121,116,
+    104,111,110,32,51,46,49,48,46,32,85,115,101,32,101,120,
+    101,99,95,109,111,100,117,108,101,40,41,32,105,110,115,116,
+    101,97,100,46,10,32,32,32,32,32,32,32,32,2,114,122,
+    105,112,105,109,112,111,114,116,46,122,105,112,105,109,112,111,
+    114,116,101,114,46,108,111,97,100,95,109,111,100,117,108,101,
+    40,41,32,105,115,32,100,101,112,114,101,99,97,116,101,100,
+    32,97,110,100,32,115,108,97,116,101,100,32,102,111,114,32,
+    114,101,109,111,118,97,108,32,105,110,32,80,121,116,104,111,
+    110,32,51,46,49,50,59,32,117,115,101,32,101,120,101,99,
+    95,109,111,100,117,108,101,40,41,32,105,110,115,116,101,97,
+    100,3,12,95,95,98,117,105,108,116,105,110,115,95,95,2,
+    14,76,111,97,100,101,100,32,109,111,100,117,108,101,32,2,
+    25,32,110,111,116,32,102,111,117,110,100,32,105,110,32,115,
+    121,115,46,109,111,100,117,108,101,115,2,30,105,109,112,111,
+    114,116,32,123,125,32,35,32,108,111,97,100,101,100,32,102,
+    114,111,109,32,90,105,112,32,123,125,3,3,115,121,115,3,
+    7,109,111,100,117,108,101,115,3,3,103,101,116,3,12,95,
+    109,111,100,117,108,101,95,116,121,112,101,3,10,95,95,108,
+    111,97,100,101,114,95,95,3,8,95,95,112,97,116,104,95,
+    95,3,7,104,97,115,97,116,116,114,3,14,95,102,105,120,
+    95,117,112,95,109,111,100,117,108,101,3,8,95,95,100,105,
+    99,116,95,95,3,4,101,120,101,99,3,11,73,109,112,111,
+    114,116,69,114,114,111,114,3,16,95,118,101,114,98,111,115,
+    101,95,109,101,115,115,97,103,101,3,3,109,115,103,3,3,
+    109,111,100,3,11,108,111,97,100,95,109,111,100,117,108,101,
+    2,23,122,105,112,105,109,112,111,114,116,101,114,46,108,111,
+    97,100,95,109,111,100,117,108,101,2,204,1,82,101,116,117,
+    114,110,32,116,104,101,32,82,101,115,111,117,114,99,101,82,
+    101,97,100,101,114,32,102,111,114,32,97,32,112,97,99,107,
+    97,103,101,32,105,110,32,97,32,122,105,112,32,102,105,108,
+    101,46,10,10,32,32,32,32,32,32,32,32,73,102,32,39,
+    102,117,108,108,110,97,109,101,39,32,105,115,32,97,32,112,
+    97,99,107,97,103,101,32,119,105,116,104,105,110,32,116,104,
+    101,32,122,105,112,32,102,105,108,101,44,32,114,101,116,117,
+    114,110,32,116,104,101,10,32,32,32,32,32,32,32,32,39,
+    82,101,115,111,117,114,99,101,82,101,97,100,101,114,39,32,
+    111,98,106,101,99,116,32,102,111,114,32,116,104,101,32,112,
+    97,99,107,97,103,101,46,32,32,79,116,104,101,114,119,105,
+    115,101,32,114,101,116,117,114,110,32,78,111,110,101,46,10,
+    32,32,32,32,32,32,32,32,3,9,90,105,112,82,101,97,
+    100,101,114,3,17,105,109,112,111,114,116,108,105,98,46,114,
+    101,97,100,101,114,115,3,19,103,101,116,95,114,101,115,111,
+    117,114,99,101,95,114,101,97,100,101,114,2,31,122,105,112,
+    105,109,112,111,114,116,101,114,46,103,101,116,95,114,101,115,
+    111,117,114,99,101,95,114,101,97,100,101,114,2,41,82,101,
+    108,111,97,100,32,116,104,101,32,102,105,108,101,32,100,97,
+    116,97,32,111,102,32,116,104,101,32,97,114,99,104,105,118,
+    101,32,112,97,116,104,46,3,3,112,111,112,3,17,105,110,
+    118,97,108,105,100,97,116,101,95,99,97,99,104,101,115,2,
+    29,122,105,112,105,109,112,111,114,116,101,114,46,105,110,118,
+    97,108,105,100,97,116,101,95,99,97,99,104,101,115,2,21,
+    60,122,105,112,105,109,112,111,114,116,101,114,32,111,98,106,
+    101,99,116,32,34,2,2,34,62,3,8,95,95,114,101,112,
+    114,95,95,2,20,122,105,112,105,109,112,111,114,116,101,114,
+    46,95,95,114,101,112,114,95,95,3,7,95,95,100,111,99,
+    95,95,2,12,95,95,105,110,105,116,95,95,46,112,121,99,
+    2,4,46,112,121,99,3,1,46,3,10,114,112,97,114,116,
+    105,116,105,111,110,3,7,100,105,114,112,97,116,104,3,16,
+    95,122,105,112,95,115,101,97,114,99,104,111,114,100,101,114,
+    3,6,115,117,102,102,105,120,3,10,105,115,98,121,116,101,
+    99,111,100,101,2,21,99,97,110,39,116,32,111,112,101,110,
+    32,90,105,112,32,102,105,108,101,58,32,2,21,99,97,110,
+    39,116,32,114,101,97,100,32,90,105,112,32,102,105,108,101,
+    58,32,2,16,110,111,116,32,97,32,90,105,112,32,102,105,
+    108,101,58,32,2,18,99,111,114,114,117,112,116,32,90,105,
+    112,32,102,105,108,101,58,32,2,28,98,97,100,32,99,101,
+    110,116,114,97,108,32,100,105,114,101,99,116,111,114,121,32,
+    115,105,122,101,58,32,2,30,98,97,100,32,99,101,110,116,
+    114,97,108,32,100,105,114,101,99,116,111,114,121,32,111,102,
+    102,115,101,116,58,32,2,38,98,97,100,32,99,101,110,116,
+    114,97,108,32,100,105,114,101,99,116,111,114,121,32,115,105,
+    122,101,32,111,114,32,111,102,102,115,101,116,58,32,2,27,
+    69,79,70,32,114,101,97,100,32,119,104,101,114,101,32,110,
+    111,116,32,101,120,112,101,99,116,101,100,2,25,98,97,100,
+    32,108,111,99,97,108,32,104,101,97,100,101,114,32,111,102,
+    102,115,101,116,58,32,3,5,97,115,99,105,105,3,6,108,
+    97,116,105,110,49,2,1,47,2,33,122,105,112,105,109,112,
+    111,114,116,58,32,102,111,117,110,100,32,123,125,32,110,97,
+    109,101,115,32,105,110,32,123,33,114,125,3,3,95,105,111,
+    3,9,111,112,101,110,95,99,111,100,101,3,4,115,101,101,
+    107,3,20,69,78,68,95,67,69,78,84,82,65,76,95,68,
+    73,82,95,83,73,90,69,3,4,116,101,108,108,3,4,114,
+    101,97,100,3,18,83,84,82,73,78,71,95,69,78,68,95,
+    65,82,67,72,73,86,69,3,3,109,97,120,3,15,77,65,
+    88,95,67,79,77,77,69,78,84,95,76,69,78,3,5,114,
+    102,105,110,100,3,8,69,79,70,69,114,114,111,114,3,18,
+    85,110,105,99,111,100,101,68,101,99,111,100,101,69,114,114,
+    111,114,3,9,116,114,97,110,115,108,97,116,101,3,11,99,
+    112,52,51,55,95,116,97,98,108,101,3,2,102,112,3,15,
+    104,101,97,100,101,114,95,112,111,115,105,116,105,111,110,3,
+    6,98,117,102,102,101,114,3,9,102,105,108,101,95,115,105,
+    122,101,3,17,109,97,120,95,99,111,109,109,101,110,116,95,
+    115,116,97,114,116,3,4,100,97,116,97,3,3,112,111,115,
+    3,11,104,101,97,100,101,114,95,115,105,122,101,3,13,104,
+    101,97,100,101,114,95,111,102,102,115,101,116,3,10,97,114,
+    99,95,111,102,102,115,101,116,3,5,99,111,117,110,116,3,
+    5,102,108,97,103,115,3,8,99,111,109,112,114,101,115,115,
+    3,4,116,105,109,101,3,4,100,97,116,101,3,3,99,114,
+    99,3,9,100,97,116,97,95,115,105,122,101,3,9,110,97,
+    109,101,95,115,105,122,101,3,10,101,120,116,114,97,95,115,
+    105,122,101,3,12,99,111,109,109,101,110,116,95,115,105,122,
+    101,3,11,102,105,108,101,95,111,102,102,115,101,116,3,1,
+    116,0,190,3,0,1,2,3,4,5,6,7,8,9,10,11,
+    12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,
+    28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,
+    44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,
+    60,61,62,63,64,65,66,67,68,69,70,71,72,73,74,75,
+    76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,
+    92,93,94,95,96,97,98,99,100,101,102,103,104,105,106,107,
+    108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,
+    124,125,126,127,195,135,195,188,195,169,195,162,195,164,195,160,
+    195,165,195,167,195,170,195,171,195,168,195,175,195,174,195,172,
+    195,132,195,133,195,137,195,166,195,134,195,180,195,182,195,178,
+    195,187,195,185,195,191,195,150,195,156,194,162,194,163,194,165,
+    226,130,167,198,146,195,161,195,173,195,179,195,186,195,177,195,
+    145,194,170,194,186,194,191,226,140,144,194,172,194,189,194,188,
+    194,161,194,171,194,187,226,150,145,226,150,146,226,150,147,226,
+    148,130,226,148,164,226,149,161,226,149,162,226,149,150,226,149,
+    149,226,149,163,226,149,145,226,149,151,226,149,157,226,149,156,
+    226,149,155,226,148,144,226,148,148,226,148,180,226,148,172,226,
+    148,156,226,148,128,226,148,188,226,149,158,226,149,159,226,149,
+    154,226,149,148,226,149,169,226,149,166,226,149,160,226,149,144,
+    226,149,172,226,149,167,226,149,168,226,149,164,226,149,165,226,
+    149,153,226,149,152,226,149,146,226,149,147,226,149,171,226,149,
+    170,226,148,152,226,148,140,226,150,136,226,150,132,226,150,140,
+    226,150,144,226,150,128,206,177,195,159,206,147,207,128,206,163,
+    207,131,194,181,207,132,206,166,206,152,206,169,206,180,226,136,
+    158,207,134,206,181,226,136,169,226,137,161,194,177,226,137,165,
+    226,137,164,226,140,160,226,140,161,195,183,226,137,136,194,176,
+    226,136,153,194,183,226,136,154,226,129,191,194,178,226,150,160,
+    194,160,2,27,122,105,112,105,109,112,111,114,116,58,32,122,
+    108,105,98,32,85,78,65,86,65,73,76,65,66,76,69,2,
+    41,99,97,110,39,116,32,100,101,99,111,109,112,114,101,115,
+    115,32,100,97,116,97,59,32,122,108,105,98,32,110,111,116,
+    32,97,118,97,105,108,97,98,108,101,3,10,100,101,99,111,
+    109,112,114,101,115,115,2,25,122,105,112,105,109,112,111,114,
+    116,58,32,122,108,105,98,32,97,118,97,105,108,97,98,108,
+    101,3,15,95,105,109,112,111,114,116,105,110,103,95,122,108,
+    105,98,3,4,122,108,105,98,3,9,69,120,99,101,112,116,
+    105,111,110,3,20,95,103,101,116,95,100,101,99,111,109,112,
+    114,101,115,115,95,102,117,110,99,2,18,110,101,103,97,116,
+    105,118,101,32,100,97,116,97,32,115,105,122,101,2,23,98,
+    97,100,32,108,111,99,97,108,32,102,105,108,101,32,104,101,
+    97,100,101,114,58,32,2,26,122,105,112,105,109,112,111,114,
+    116,58,32,99,97,110,39,116,32,114,101,97,100,32,100,97,
+    116,97,3,8,100,97,116,97,112,97,116,104,3,8,114,97,
+    119,95,100,97,116,97,3,3,97,98,115,3,2,116,49,3,
+    2,116,50,3,9,95,101,113,95,109,116,105,109,101,3,5,
+    110,101,118,101,114,3,6,97,108,119,97,121,115,2,22,98,
+    121,116,101,99,111,100,101,32,105,115,32,115,116,97,108,101,
+    32,102,111,114,32,2,16,99,111,109,112,105,108,101,100,32,
+    109,111,100,117,108,101,32,2,21,32,105,115,32,110,111,116,
+    32,97,32,99,111,100,101,32,111,98,106,101,99,116,3,13,
+    95,99,108,97,115,115,105,102,121,95,112,121,99,3,4,95,
+    105,109,112,3,21,99,104,101,99,107,95,104,97,115,104,95,
+    98,97,115,101,100,95,112,121,99,115,3,15,95,103,101,116,
+    95,112,121,99,95,115,111,117,114,99,101,3,11,115,111,117,
+    114,99,101,95,104,97,115,104,3,17,95,82,65,87,95,77,
+    65,71,73,67,95,78,85,77,66,69,82,3,18,95,118,97,
+    108,105,100,97,116,101,95,104,97,115,104,95,112,121,99,3,
+    29,95,103,101,116,95,109,116,105,109,101,95,97,110,100,95,
+    115,105,122,101,95,111,102,95,115,111,117,114,99,101,3,7,
+    109,97,114,115,104,97,108,3,5,108,111,97,100,115,3,10,
+    95,99,111,100,101,95,116,121,112,101,3,9,84,121,112,101,
+    69,114,114,111,114,3,11,101,120,99,95,100,101,116,97,105,
+    108,115,3,10,104,97,115,104,95,98,97,115,101,100,3,12,
+    99,104,101,99,107,95,115,111,117,114,99,101,3,12,115,111,
+    117,114,99,101,95,98,121,116,101,115,3,12,115,111,117,114,
+    99,101,95,109,116,105,109,101,3,11,115,111,117,114,99,101,
+    95,115,105,122,101,3,15,95,117,110,109,97,114,115,104,97,
+    108,95,99,111,100,101,3,6,115,111,117,114,99,101,3,23,
+    95,110,111,114,109,97,108,105,122,101,95,108,105,110,101,95,
+    101,110,100,105,110,103,115,3,12,100,111,110,116,95,105,110,
+    104,101,114,105,116,3,7,99,111,109,112,105,108,101,3,15,
+    95,99,111,109,112,105,108,101,95,115,111,117,114,99,101,3,
+    6,109,107,116,105,109,101,3,1,100,3,14,95,112,97,114,
+    115,101,95,100,111,115,116,105,109,101,3,1,99,3,1,111,
+    3,10,73,110,100,101,120,69,114,114,111,114,3,17,117,110,
+    99,111,109,112,114,101,115,115,101,100,95,115,105,122,101,2,
+    13,116,114,121,105,110,103,32,123,125,123,125,123,125,3,9,
+    118,101,114,98,111,115,105,116,121,2,20,109,111,100,117,108,
+    101,32,108,111,97,100,32,102,97,105,108,101,100,58,32,3,
+    12,105,109,112,111,114,116,95,101,114,114,111,114,3,3,101,
+    120,99,3,26,95,102,114,111,122,101,110,95,105,109,112,111,
+    114,116,108,105,98,95,101,120,116,101,114,110,97,108,3,17,
+    95,102,114,111,122,101,110,95,105,109,112,111,114,116,108,105,
+    98,3,7,95,95,97,108,108,95,95,3,15,112,97,116,104,
+    95,115,101,112,97,114,97,116,111,114,115,3,4,116,121,112,
+    101,3,13,95,76,111,97,100,101,114,66,97,115,105,99,115,
+    3,8,95,95,99,111,100,101,95,95,3,8,60,109,111,100,
+    117,108,101,62,67,0,0,0,0,8,128,1,115,80,1,0,
+    0,100,0,90,0,100,1,100,2,108,1,90,2,100,1,100,
+    3,108,1,109,3,90,3,109,4,90,4,1,0,100,1,100,
+    2,108,5,90,6,100,1,100,2,108,7,90,7,100,1,100,
+    2,108,8,90,8,100,1,100,2,108,9,90,9,100,1,100,
+    2,108,10,90,10,100,1,100,2,108,11,90,11,100,1,100,
+    2,108,12,90,12,100,4,100,5,103,2,90,13,101,2,106,
+    14,90,14,101,2,106,15,100,6,100,2,133,2,25,0,90,
+    16,71,0,100,7,100,4,132,0,100,4,101,17,131,3,90,
+    18,105,0,90,19,101,20,101,10,131,1,90,21,100,8,90,
+    22,100,9,90,23,100,10,90,24,71,0,100,11,100,5,132,
+    0,100,5,101,2,106,25,131,3,90,26,101,14,100,12,23,
+    0,100,13,100,13,102,3,101,14,100,14,23,0,100,15,100,
+    13,102,3,100,16,100,17,102,4,90,27,100,18,100,19,132,
+    0,90,28,100,20,100,21,132,0,90,29,100,22,100,23,132,
+    0,90,30,100,24,100,25,132,0,90,31,100,26,90,32,100,
+    15,97,33,100,27,100,28,132,0,90,34,100,29,100,30,132,
+    0,90,35,100,31,100,32,132,0,90,36,100,33,100,34,132,
+    0,90,37,101,20,101,37,106,38,131,1,90,39,100,35,100,
+    36,132,0,90,40,100,37,100,38,132,0,90,41,100,39,100,
+    40,132,0,90,42,100,41,100,42,132,0,90,43,100,43,100,
+    44,132,0,90,44,100,45,100,46,132,0,90,45,100,2,83,
+    0,41,47,113,0,246,0,78,41,2,113,1,113,2,113,3,
+    113,4,246,2,67,0,0,0,0,2,128,1,115,12,0,0,
+    0,101,0,90,1,100,0,90,2,100,1,83,0,41,2,113,
+    3,78,41,3,113,5,113,6,113,7,169,0,82,2,82,2,
+    113,8,113,3,68,115,6,0,0,0,8,0,4,1,255,128,
+    246,44,115,4,0,0,0,80,75,5,6,118,254,255,7,67,
+    0,0,0,0,6,128,1,115,126,0,0,0,101,0,90,1,
+    100,0,90,2,100,1,90,3,100,2,100,3,132,0,90,4,
+    100,29,100,5,100,6,132,1,90,5,100,29,100,7,100,8,
+    132,1,90,6,100,29,100,9,100,10,132,1,90,7,100,11,
+    100,12,132,0,90,8,100,13,100,14,132,0,90,9,100,15,
+    100,16,132,0,90,10,100,17,100,18,132,0,90,11,100,19,
+    100,20,132,0,90,12,100,21,100,22,132,0,90,13,100,23,
+    100,24,132,0,90,14,100,25,100,26,132,0,90,15,100,27,
+    100,28,132,0,90,16,100,4,83,0,41,30,113,4,113,9,
+    67,4,0,0,16,18,134,1,115,34,1,0,0,116,0,124,
+    1,116,1,131,2,115,14,100,1,100,0,108,2,125,2,124,
+    2,160,3,124,1,161,1,125,1,124,1,115,22,116,4,100,
+    2,124,1,100,3,141,2,130,1,116,5,114,30,124,1,160,
+    6,116,5,116,7,161,2,125,1,103,0,125,3,9,0,122,
+    7,116,8,160,9,124,1,161,1,125,4,87,0,110,34,4,
+    0,116,10,116,11,102,2,121,144,1,0,1,0,1,0,116,
+    8,160,12,124,1,161,1,92,2,125,5,125,6,124,5,124,
+    1,107,2,114,66,116,4,100,5,124,1,100,3,141,2,130,
+    1,124,5,125,1,124,3,160,13,124,6,161,1,1,0,89,
+    0,110,14,124,4,106,14,100,6,64,0,100,7,107,3,114,
+    88,116,4,100,5,124,1,100,3,141,2,130,1,113,90,113,
+    33,122,6,116,15,124,1,25,0,125,7,87,0,110,15,4,
+    0,116,16,121,143,1,0,1,0,1,0,116,17,124,1,131,
+    1,125,7,124,7,116,15,124,1,60,0,89,0,124,7,124,
+    0,95,18,124,1,124,0,95,19,116,8,106,20,124,3,100,
+    0,100,0,100,8,133,3,25,0,142,0,124,0,95,21,124,
+    0,106,21,114,141,124,0,4,0,106,21,116,7,55,0,2,
+    0,95,21,100,0,83,0,100,0,83,0,119,0,119,0,41,
+    9,78,82,0,113,10,169,1,113,11,84,113,12,118,128,192,
+    7,118,128,128,4,246,1,41,22,113,13,113,14,113,15,113,
+    16,113,3,113,17,113,18,113,19,113,20,113,21,113,22,113,
+    23,113,24,113,25,113,26,113,27,113,28,113,29,113,30,113,
+    31,113,32,113,33,41,8,113,34,113,11,113,15,113,33,113,
+    35,113,36,113,37,113,38,82,2,82,2,113,8,113,39,128,
+    1,115,70,0,0,0,10,1,8,1,10,1,4,1,12,1,
+    4,1,12,1,4,2,2,1,2,1,14,1,16,1,14,3,
+    8,1,12,1,4,1,14,1,14,3,12,2,2,1,2,240,
+    2,18,12,1,12,1,8,1,10,1,6,1,6,1,22,2,
+    6,1,18,1,4,255,2,249,2,239,255,128,113,40,78,67,
+    6,0,0,10,8,134,1,115,90,0,0,0,116,0,160,1,
+    100,1,116,2,161,2,1,0,116,3,124,0,124,1,131,2,
+    125,3,124,3,100,2,117,1,114,19,124,0,103,0,102,2,
+    83,0,116,4,124,0,124,1,131,2,125,4,116,5,124,0,
+    124,4,131,2,114,41,100,2,124,0,106,6,155,0,116,7,
+    155,0,124,4,155,0,157,3,103,1,102,2,83,0,100,2,
+    103,0,102,2,83,0,41,3,113,41,113,42,78,41,8,113,
+    43,113,44,113,45,113,46,113,47,113,48,113,31,113,19,41,
+    5,113,34,113,49,113,11,113,50,113,51,82,2,82,2,113,
+    8,113,52,220,1,115,22,0,0,0,6,12,2,2,4,254,
+    10,3,8,1,8,2,10,7,10,1,24,4,8,2,255,128,
+    113,53,67,6,0,0,6,8,134,1,115,28,0,0,0,116,
+    0,160,1,100,1,116,2,161,2,1,0,124,0,160,3,124,
+    1,124,2,161,2,100,2,25,0,83,0,41,4,113,54,113,
+    55,82,0,78,41,4,113,43,113,44,113,45,113,52,41,3,
+    113,34,113,49,113,11,82,2,82,2,113,8,113,56,166,2,
+    115,10,0,0,0,6,11,2,2,4,254,16,3,255,128,113,
+    57,67,6,0,0,14,10,134,1,115,108,0,0,0,116,0,
+    124,0,124,1,131,2,125,3,124,3,100,1,117,1,114,17,
+    116,1,106,2,124,1,124,0,124,3,100,2,141,3,83,0,
+    116,3,124,0,124,1,131,2,125,4,116,4,124,0,124,4,
+    131,2,114,52,124,0,106,5,155,0,116,6,155,0,124,4,
+    155,0,157,3,125,5,116,1,106,7,124,1,100,1,100,3,
+    100,4,141,3,125,6,124,6,106,8,160,9,124,5,161,1,
+    1,0,124,6,83,0,100,1,83,0,41,5,113,58,78,41,
+    1,113,59,84,41,3,113,60,113,61,113,59,41,10,113,46,
+    113,62,113,63,113,47,113,48,113,31,113,19,113,64,113,65,
+    113,25,41,7,113,34,113,49,113,66,113,67,113,51,113,11,
+    113,68,82,2,82,2,113,8,113,69,198,2,115,26,0,0,
+    0,10,5,8,1,16,1,10,7,10,1,18,4,8,1,2,
+    1,6,255,12,2,4,1,4,2,255,128,113,70,67,4,0,
+    0,10,6,134,1,115,20,0,0,0,116,0,124,0,124,1,
+    131,2,92,3,125,2,125,3,125,4,124,2,83,0,41,2,
+    113,71,78,169,1,113,72,169,5,113,34,113,49,113,73,113,
+    74,113,51,82,2,82,2,113,8,113,75,252,2,115,6,0,
+    0,0,16,6,4,1,255,128,113,76,67,4,0,0,8,16,
+    134,1,115,112,0,0,0,116,0,114,8,124,1,160,1,116,
+    0,116,2,161,2,125,1,124,1,125,2,124,1,160,3,124,
+    0,106,4,116,2,23,0,161,1,114,29,124,1,116,5,124,
+    0,106,4,116,2,23,0,131,1,100,1,133,2,25,0,125,
+    2,122,7,124,0,106,6,124,2,25,0,125,3,87,0,110,
+    12,4,0,116,7,121,55,1,0,1,0,1,0,116,8,100,
+    2,100,3,124,2,131,3,130,1,116,9,124,0,106,4,124,
+    3,131,2,83,0,119,0,41,4,113,77,78,82,0,113,78,
+    41,10,113,17,113,18,113,19,113,79,113,31,113,80,113,30,
+    113,28,113,22,113,81,41,4,113,34,113,82,113,83,113,84,
+    82,2,82,2,113,8,113,85,144,3,115,24,0,0,0,4,
+    6,12,1,4,2,16,1,22,1,2,2,14,1,12,1,12,
+    1,12,1,2,254,255,128,113,86,67,4,0,0,10,6,134,
+    1,115,20,0,0,0,116,0,124,0,124,1,131,2,92,3,
+    125,2,125,3,125,4,124,4,83,0,41,2,113,87,78,82,
+    6,82,7,82,2,82,2,113,8,113,88,186,3,115,6,0,
+    0,0,16,8,4,1,255,128,113,89,67,4,0,0,12,16,
+    134,1,115,126,0,0,0,116,0,124,0,124,1,131,2,125,
+    2,124,2,100,1,117,0,114,18,116,1,100,2,124,1,155,
+    2,157,2,124,1,100,3,141,2,130,1,116,2,124,0,124,
+    1,131,2,125,3,124,2,114,32,116,3,160,4,124,3,100,
+    4,161,2,125,4,110,5,124,3,155,0,100,5,157,2,125,
+    4,122,7,124,0,106,5,124,4,25,0,125,5,87,0,110,
+    9,4,0,116,6,121,62,1,0,1,0,1,0,89,0,100,
+    1,83,0,116,7,124,0,106,8,124,5,131,2,160,9,161,
+    0,83,0,119,0,41,6,113,90,78,113,91,169,1,113,60,
+    113,92,113,93,41,10,113,46,113,3,113,47,113,20,113,32,
+    113,30,113,28,113,81,113,31,113,94,41,6,113,34,113,49,
+    113,50,113,11,113,95,113,84,82,2,82,2,113,8,113,96,
+    210,3,115,28,0,0,0,10,7,8,1,18,1,10,2,4,
+    1,14,1,10,2,2,2,14,1,12,1,6,2,16,1,2,
+    253,255,128,113,97,67,4,0,0,6,8,134,1,115,40,0,
+    0,0,116,0,124,0,124,1,131,2,125,2,124,2,100,1,
+    117,0,114,18,116,1,100,2,124,1,155,2,157,2,124,1,
+    100,3,141,2,130,1,124,2,83,0,41,4,113,98,78,113,
+    91,82,8,41,2,113,46,113,3,41,3,113,34,113,49,113,
+    50,82,2,82,2,113,8,113,59,134,4,115,10,0,0,0,
+    10,6,8,1,18,1,4,1,255,128,113,99,67,4,0,0,
+    18,16,134,1,115,252,0,0,0,100,1,125,2,116,0,160,
+    1,124,2,116,2,161,2,1,0,116,3,124,0,124,1,131,
+    2,92,3,125,3,125,4,125,5,116,4,106,5,160,6,124,
+    1,161,1,125,6,124,6,100,2,117,0,115,31,116,7,124,
+    6,116,8,131,2,115,40,116,8,124,1,131,1,125,6,124,
+    6,116,4,106,5,124,1,60,0,124,0,124,6,95,9,122,
+    42,124,4,114,62,116,10,124,0,124,1,131,2,125,7,116,
+    11,160,12,124,0,106,13,124,7,161,2,125,8,124,8,103,
+    1,124,6,95,14,116,15,124,6,100,3,131,2,115,70,116,
+    16,124,6,95,16,116,11,160,17,124,6,106,18,124,1,124,
+    5,161,3,1,0,116,19,124,3,124,6,106,18,131,2,1,
+    0,87,0,110,8,1,0,1,0,1,0,116,4,106,5,124,
+    1,61,0,130,0,122,7,116,4,106,5,124,1,25,0,125,
+    6,87,0,110,14,4,0,116,20,121,125,1,0,1,0,1,
+    0,116,21,100,4,124,1,155,2,100,5,157,3,131,1,130,
+    1,116,22,160,23,100,6,124,1,124,5,161,3,1,0,124,
+    6,83,0,119,0,41,7,113,100,113,101,78,113,102,113,103,
+    113,104,113,105,41,24,113,43,113,44,113,45,113,72,113,106,
+    113,107,113,108,113,13,113,109,113,110,113,47,113,20,113,32,
+    113,31,113,111,113,112,113,102,113,113,113,114,113,115,113,28,
+    113,116,113,62,113,117,41,9,113,34,113,49,113,118,113,73,
+    113,74,113,51,113,119,113,11,113,95,82,2,82,2,113,8,
+    113,120,160,4,115,56,0,0,0,4,9,12,2,16,1,12,
+    1,18,1,8,1,10,1,6,1,2,2,4,1,10,3,14,
+    1,8,1,10,2,6,1,16,1,16,1,6,1,8,1,2,
+    1,2,2,14,1,12,1,16,1,14,1,4,1,2,253,255,
+    128,113,121,67,4,0,0,6,16,134,1,115,64,0,0,0,
+    122,10,124,0,160,0,124,1,161,1,115,9,87,0,100,1,
+    83,0,87,0,110,9,4,0,116,1,121,31,1,0,1,0,
+    1,0,89,0,100,1,83,0,100,2,100,3,108,2,109,3,
+    125,2,1,0,124,2,124,0,124,1,131,2,83,0,119,0,
+    41,4,113,122,78,82,0,41,1,113,123,41,4,113,59,113,
+    3,113,124,113,123,41,3,113,34,113,49,113,123,82,2,82,
+    2,113,8,113,125,246,4,115,20,0,0,0,2,6,10,1,
+    6,1,4,255,12,2,6,1,12,1,10,1,2,253,255,128,
+    113,126,67,2,0,0,2,16,134,1,115,72,0,0,0,122,
+    15,116,0,124,0,106,1,131,1,124,0,95,2,124,0,106,
+    2,116,3,124,0,106,1,60,0,87,0,100,1,83,0,4,
+    0,116,4,121,35,1,0,1,0,1,0,116,3,160,5,124,
+    0,106,1,100,1,161,2,1,0,100,1,124,0,95,2,89,
+    0,100,1,83,0,119,0,41,2,113,127,78,41,6,113,29,
+    113,31,113,30,113,27,113,3,113,128,1,169,1,113,34,82,
+    2,82,2,113,8,113,129,1,148,5,115,16,0,0,0,2,
+    2,12,1,18,1,12,1,14,1,12,1,2,254,255,128,113,
+    130,1,67,2,0,0,2,10,134,1,115,24,0,0,0,100,
+    1,124,0,106,0,155,0,116,1,155,0,124,0,106,2,155,
+    0,100,2,157,5,83,0,41,3,78,113,131,1,113,132,1,
+    41,3,113,31,113,19,113,33,82,9,82,2,82,2,113,8,
+    113,133,1,168,5,115,4,0,0,0,24,1,255,128,113,134,
+    1,169,1,78,41,17,113,5,113,6,113,7,113,135,1,113,
+    39,113,52,113,56,113,69,113,75,113,85,113,88,113,96,113,
+    59,113,120,113,125,113,129,1,113,133,1,82,2,82,2,82,
+    2,113,8,113,4,92,115,32,0,0,0,8,0,4,1,8,
+    17,10,46,10,37,10,16,8,27,8,10,8,21,8,12,8,
+    26,8,13,8,43,8,15,12,10,255,128,113,136,1,84,113,
+    92,70,41,3,113,137,1,84,70,41,3,113,93,70,70,67,
+    4,0,0,4,8,134,1,115,20,0,0,0,124,0,106,0,
+    124,1,160,1,100,1,161,1,100,2,25,0,23,0,83,0,
+    41,3,78,113,138,1,246,4,41,2,113,33,113,139,1,41,
+    2,113,34,113,49,82,2,82,2,113,8,113,47,204,5,115,
+    4,0,0,0,20,1,255,128,113,47,67,4,0,0,6,4,
+    134,1,115,18,0,0,0,124,1,116,0,23,0,125,2,124,
+    2,124,0,106,1,118,0,83,0,82,10,41,2,113,19,113,
+    30,41,3,113,34,113,11,113,140,1,82,2,82,2,113,8,
+    113,48,212,5,115,6,0,0,0,8,4,10,2,255,128,113,
+    48,67,4,0,0,14,8,134,1,115,56,0,0,0,116,0,
+    124,0,124,1,131,2,125,2,116,1,68,0,93,18,92,3,
+    125,3,125,4,125,5,124,2,124,3,23,0,125,6,124,6,
+    124,0,106,2,118,0,114,25,124,5,2,0,1,0,83,0,
+    113,7,100,0,83,0,82,10,41,3,113,47,113,141,1,113,
+    30,41,7,113,34,113,49,113,11,113,142,1,113,143,1,113,
+    74,113,95,82,2,82,2,113,8,113,46,230,5,115,16,0,
+    0,0,10,1,14,1,8,1,10,1,8,1,2,255,4,2,
+    255,128,113,46,67,2,0,0,52,18,134,1,115,226,4,0,
     0,122,7,116,0,160,1,124,0,161,1,125,1,87,0,110,
     16,4,0,116,2,144,2,121,112,1,0,1,0,1,0,116,
     3,100,1,124,0,155,2,157,2,124,0,100,2,141,2,130,
@@ -694,62 +781,22 @@ const unsigned char _Py_M__zipimport[] = {
     0,144,2,115,91,119,1,1,0,1,0,1,0,89,0,1,
     0,116,24,160,25,100,34,124,12,124,0,161,3,1,0,124,
     11,83,0,119,0,119,0,119,0,119,0,119,0,119,0,119,
-    0,119,0,41,35,78,122,21,99,97,110,39,116,32,111,112,
-    101,110,32,90,105,112,32,102,105,108,101,58,32,114,12,0,
-    0,0,114,93,0,0,0,250,21,99,97,110,39,116,32,114,
-    101,97,100,32,90,105,112,32,102,105,108,101,58,32,233,4,
-    0,0,0,114,0,0,0,0,122,16,110,111,116,32,97,32,
-    90,105,112,32,102,105,108,101,58,32,122,18,99,111,114,114,
-    117,112,116,32,90,105,112,32,102,105,108,101,58,32,233,12,
-    0,0,0,233,16,0,0,0,233,20,0,0,0,122,28,98,
-    97,100,32,99,101,110,116,114,97,108,32,100,105,114,101,99,
-    116,111,114,121,32,115,105,122,101,58,32,122,30,98,97,100,
-    32,99,101,110,116,114,97,108,32,100,105,114,101,99,116,111,
-    114,121,32,111,102,102,115,101,116,58,32,122,38,98,97,100,
-    32,99,101,110,116,114,97,108,32,100,105,114,101,99,116,111,
-    114,121,32,115,105,122,101,32,111,114,32,111,102,102,115,101,
-    116,58,32,84,233,46,0,0,0,250,27,69,79,70,32,114,
-    101,97,100,32,119,104,101,114,101,32,110,111,116,32,101,120,
-    112,101,99,116,101,100,115,4,0,0,0,80,75,1,2,233,
-    8,0,0,0,233,10,0,0,0,233,14,0,0,0,233,24,
-    0,0,0,233,28,0,0,0,233,30,0,0,0,233,32,0,
-    0,0,233,34,0,0,0,233,42,0,0,0,122,25,98,97,
-    100,32,108,111,99,97,108,32,104,101,97,100,101,114,32,111,
-    102,102,115,101,116,58,32,105,0,8,0,0,218,5,97,115,
-    99,105,105,90,6,108,97,116,105,110,49,250,1,47,114,5,
-    0,0,0,122,33,122,105,112,105,109,112,111,114,116,58,32,
-    102,111,117,110,100,32,123,125,32,110,97,109,101,115,32,105,
-    110,32,123,33,114,125,41,26,218,3,95,105,111,218,9,111,
-    112,101,110,95,99,111,100,101,114,22,0,0,0,114,3,0,
-    0,0,218,4,115,101,101,107,218,20,69,78,68,95,67,69,
-    78,84,82,65,76,95,68,73,82,95,83,73,90,69,90,4,
-    116,101,108,108,218,4,114,101,97,100,114,58,0,0,0,218,
-    18,83,84,82,73,78,71,95,69,78,68,95,65,82,67,72,
-    73,86,69,218,3,109,97,120,218,15,77,65,88,95,67,79,
-    77,77,69,78,84,95,76,69,78,218,5,114,102,105,110,100,
-    114,2,0,0,0,218,8,69,79,70,69,114,114,111,114,114,
-    1,0,0,0,114,68,0,0,0,218,18,85,110,105,99,111,
-    100,101,68,101,99,111,100,101,69,114,114,111,114,218,9,116,
-    114,97,110,115,108,97,116,101,218,11,99,112,52,51,55,95,
-    116,97,98,108,101,114,19,0,0,0,114,20,0,0,0,114,
-    21,0,0,0,114,30,0,0,0,114,48,0,0,0,114,81,
-    0,0,0,41,26,114,29,0,0,0,218,2,102,112,90,15,
-    104,101,97,100,101,114,95,112,111,115,105,116,105,111,110,218,
-    6,98,117,102,102,101,114,218,9,102,105,108,101,95,115,105,
-    122,101,90,17,109,97,120,95,99,111,109,109,101,110,116,95,
-    115,116,97,114,116,218,4,100,97,116,97,90,3,112,111,115,
-    218,11,104,101,97,100,101,114,95,115,105,122,101,90,13,104,
-    101,97,100,101,114,95,111,102,102,115,101,116,90,10,97,114,
-    99,95,111,102,102,115,101,116,114,33,0,0,0,218,5,99,
-    111,117,110,116,218,5,102,108,97,103,115,218,8,99,111,109,
-    112,114,101,115,115,218,4,116,105,109,101,218,4,100,97,116,
-    101,218,3,99,114,99,218,9,100,97,116,97,95,115,105,122,
-    101,218,9,110,97,109,101,95,115,105,122,101,218,10,101,120,
-    116,114,97,95,115,105,122,101,90,12,99,111,109,109,101,110,
-    116,95,115,105,122,101,218,11,102,105,108,101,95,111,102,102,
-    115,101,116,114,47,0,0,0,114,13,0,0,0,218,1,116,
-    114,9,0,0,0,114,9,0,0,0,114,10,0,0,0,114,
-    27,0,0,0,146,1,0,0,115,240,0,0,0,2,1,14,
+    0,119,0,41,35,78,113,144,1,82,4,82,11,113,145,1,
+    246,8,82,0,113,146,1,113,147,1,246,24,246,32,246,40,
+    113,148,1,113,149,1,113,150,1,84,246,92,113,151,1,115,
+    4,0,0,0,80,75,1,2,246,16,246,20,246,28,246,48,
+    246,56,246,60,246,64,246,68,246,84,113,152,1,118,128,32,
+    113,153,1,113,154,1,113,155,1,82,1,113,156,1,41,26,
+    113,157,1,113,158,1,113,22,113,3,113,159,1,113,160,1,
+    113,161,1,113,162,1,113,80,113,163,1,113,164,1,113,165,
+    1,113,166,1,113,2,113,167,1,113,1,113,94,113,168,1,
+    113,169,1,113,170,1,113,18,113,19,113,20,113,32,113,62,
+    113,117,41,26,113,31,113,171,1,113,172,1,113,173,1,113,
+    174,1,113,175,1,113,176,1,113,177,1,113,178,1,113,179,
+    1,113,180,1,113,38,113,181,1,113,182,1,113,183,1,113,
+    184,1,113,185,1,113,186,1,113,187,1,113,188,1,113,189,
+    1,113,190,1,113,191,1,113,60,113,11,113,192,1,82,2,
+    82,2,113,8,113,29,164,6,115,240,0,0,0,2,1,14,
     1,14,1,18,1,8,2,2,1,14,1,8,1,14,1,14,
     1,18,1,12,1,18,1,16,1,2,3,12,1,12,1,14,
     1,10,1,2,1,6,255,8,2,2,1,2,255,2,1,4,
@@ -764,304 +811,179 @@ const unsigned char _Py_M__zipimport[] = {
     4,28,1,18,1,4,255,14,2,18,1,10,2,10,2,2,
     3,14,1,14,1,18,1,12,2,12,1,20,1,8,1,8,
     1,4,202,14,6,18,128,14,49,4,1,2,247,2,246,2,
-    246,2,227,2,227,2,248,2,246,2,248,255,128,114,27,0,
-    0,0,117,190,1,0,0,0,1,2,3,4,5,6,7,8,
-    9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,
-    25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,
-    41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,
-    57,58,59,60,61,62,63,64,65,66,67,68,69,70,71,72,
-    73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,
-    89,90,91,92,93,94,95,96,97,98,99,100,101,102,103,104,
-    105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,
-    121,122,123,124,125,126,127,195,135,195,188,195,169,195,162,195,
-    164,195,160,195,165,195,167,195,170,195,171,195,168,195,175,195,
-    174,195,172,195,132,195,133,195,137,195,166,195,134,195,180,195,
-    182,195,178,195,187,195,185,195,191,195,150,195,156,194,162,194,
-    163,194,165,226,130,167,198,146,195,161,195,173,195,179,195,186,
-    195,177,195,145,194,170,194,186,194,191,226,140,144,194,172,194,
-    189,194,188,194,161,194,171,194,187,226,150,145,226,150,146,226,
-    150,147,226,148,130,226,148,164,226,149,161,226,149,162,226,149,
-    150,226,149,149,226,149,163,226,149,145,226,149,151,226,149,157,
-    226,149,156,226,149,155,226,148,144,226,148,148,226,148,180,226,
-    148,172,226,148,156,226,148,128,226,148,188,226,149,158,226,149,
-    159,226,149,154,226,149,148,226,149,169,226,149,166,226,149,160,
-    226,149,144,226,149,172,226,149,167,226,149,168,226,149,164,226,
-    149,165,226,149,153,226,149,152,226,149,146,226,149,147,226,149,
-    171,226,149,170,226,148,152,226,148,140,226,150,136,226,150,132,
-    226,150,140,226,150,144,226,150,128,206,177,195,159,206,147,207,
-    128,206,163,207,131,194,181,207,132,206,166,206,152,206,169,206,
-    180,226,136,158,207,134,206,181,226,136,169,226,137,161,194,177,
-    226,137,165,226,137,164,226,140,160,226,140,161,195,183,226,137,
-    136,194,176,226,136,153,194,183,226,136,154,226,129,191,194,178,
-    226,150,160,194,160,99,0,0,0,0,0,0,0,0,0,0,
-    0,0,1,0,0,0,8,0,0,0,67,0,0,0,115,106,
-    0,0,0,116,0,114,11,116,1,160,2,100,1,161,1,1,
-    0,116,3,100,2,131,1,130,1,100,3,97,0,122,28,122,
-    8,100,4,100,5,108,4,109,5,125,0,1,0,87,0,110,
-    15,4,0,116,6,121,52,1,0,1,0,1,0,116,1,160,
-    2,100,1,161,1,1,0,116,3,100,2,131,1,130,1,87,
-    0,100,6,97,0,110,3,100,6,97,0,119,0,116,1,160,
-    2,100,7,161,1,1,0,124,0,83,0,119,0,41,8,78,
-    122,27,122,105,112,105,109,112,111,114,116,58,32,122,108,105,
-    98,32,85,78,65,86,65,73,76,65,66,76,69,250,41,99,
-    97,110,39,116,32,100,101,99,111,109,112,114,101,115,115,32,
-    100,97,116,97,59,32,122,108,105,98,32,110,111,116,32,97,
-    118,97,105,108,97,98,108,101,84,114,0,0,0,0,169,1,
-    218,10,100,101,99,111,109,112,114,101,115,115,70,122,25,122,
-    105,112,105,109,112,111,114,116,58,32,122,108,105,98,32,97,
-    118,97,105,108,97,98,108,101,41,7,218,15,95,105,109,112,
-    111,114,116,105,110,103,95,122,108,105,98,114,48,0,0,0,
-    114,81,0,0,0,114,3,0,0,0,90,4,122,108,105,98,
-    114,147,0,0,0,218,9,69,120,99,101,112,116,105,111,110,
-    114,146,0,0,0,114,9,0,0,0,114,9,0,0,0,114,
-    10,0,0,0,218,20,95,103,101,116,95,100,101,99,111,109,
-    112,114,101,115,115,95,102,117,110,99,48,2,0,0,115,30,
-    0,0,0,4,2,10,3,8,1,4,2,4,1,16,1,12,
-    1,10,1,8,1,2,253,12,5,10,2,4,1,2,249,255,
-    128,114,150,0,0,0,99,2,0,0,0,0,0,0,0,0,
-    0,0,0,17,0,0,0,9,0,0,0,67,0,0,0,115,
-    120,1,0,0,124,1,92,8,125,2,125,3,125,4,125,5,
-    125,6,125,7,125,8,125,9,124,4,100,1,107,0,114,18,
-    116,0,100,2,131,1,130,1,116,1,160,2,124,0,161,1,
-    143,127,125,10,122,7,124,10,160,3,124,6,161,1,1,0,
-    87,0,110,15,4,0,116,4,121,187,1,0,1,0,1,0,
+    246,2,227,2,227,2,248,2,246,2,248,255,128,113,29,113,
+    193,1,67,0,0,0,2,16,134,1,115,106,0,0,0,116,
+    0,114,11,116,1,160,2,100,1,161,1,1,0,116,3,100,
+    2,131,1,130,1,100,3,97,0,122,28,122,8,100,4,100,
+    5,108,4,109,5,125,0,1,0,87,0,110,15,4,0,116,
+    6,121,52,1,0,1,0,1,0,116,1,160,2,100,1,161,
+    1,1,0,116,3,100,2,131,1,130,1,87,0,100,6,97,
+    0,110,3,100,6,97,0,119,0,116,1,160,2,100,7,161,
+    1,1,0,124,0,83,0,119,0,41,8,78,113,194,1,113,
+    195,1,84,82,0,169,1,113,196,1,70,113,197,1,41,7,
+    113,198,1,113,62,113,117,113,3,113,199,1,113,196,1,113,
+    200,1,82,26,82,2,82,2,113,8,113,201,1,224,8,115,
+    30,0,0,0,4,2,10,3,8,1,4,2,4,1,16,1,
+    12,1,10,1,8,1,2,253,12,5,10,2,4,1,2,249,
+    255,128,113,201,1,67,4,0,0,34,18,134,1,115,120,1,
+    0,0,124,1,92,8,125,2,125,3,125,4,125,5,125,6,
+    125,7,125,8,125,9,124,4,100,1,107,0,114,18,116,0,
+    100,2,131,1,130,1,116,1,160,2,124,0,161,1,143,127,
+    125,10,122,7,124,10,160,3,124,6,161,1,1,0,87,0,
+    110,15,4,0,116,4,121,187,1,0,1,0,1,0,116,0,
+    100,3,124,0,155,2,157,2,124,0,100,4,141,2,130,1,
+    124,10,160,5,100,5,161,1,125,11,116,6,124,11,131,1,
+    100,5,107,3,114,62,116,7,100,6,131,1,130,1,124,11,
+    100,0,100,7,133,2,25,0,100,8,107,3,114,79,116,0,
+    100,9,124,0,155,2,157,2,124,0,100,4,141,2,130,1,
+    116,8,124,11,100,10,100,11,133,2,25,0,131,1,125,12,
+    116,8,124,11,100,11,100,5,133,2,25,0,131,1,125,13,
+    100,5,124,12,23,0,124,13,23,0,125,14,124,6,124,14,
+    55,0,125,6,122,7,124,10,160,3,124,6,161,1,1,0,
+    87,0,110,15,4,0,116,4,121,186,1,0,1,0,1,0,
     116,0,100,3,124,0,155,2,157,2,124,0,100,4,141,2,
-    130,1,124,10,160,5,100,5,161,1,125,11,116,6,124,11,
-    131,1,100,5,107,3,114,62,116,7,100,6,131,1,130,1,
-    124,11,100,0,100,7,133,2,25,0,100,8,107,3,114,79,
-    116,0,100,9,124,0,155,2,157,2,124,0,100,4,141,2,
-    130,1,116,8,124,11,100,10,100,11,133,2,25,0,131,1,
-    125,12,116,8,124,11,100,11,100,5,133,2,25,0,131,1,
-    125,13,100,5,124,12,23,0,124,13,23,0,125,14,124,6,
-    124,14,55,0,125,6,122,7,124,10,160,3,124,6,161,1,
-    1,0,87,0,110,15,4,0,116,4,121,186,1,0,1,0,
-    1,0,116,0,100,3,124,0,155,2,157,2,124,0,100,4,
-    141,2,130,1,124,10,160,5,124,4,161,1,125,15,116,6,
-    124,15,131,1,124,4,107,3,114,143,116,4,100,12,131,1,
-    130,1,87,0,100,0,4,0,4,0,131,3,1,0,110,8,
-    49,0,115,153,119,1,1,0,1,0,1,0,89,0,1,0,
-    124,3,100,1,107,2,114,164,124,15,83,0,122,5,116,9,
-    131,0,125,16,87,0,110,10,4,0,116,10,121,185,1,0,
-    1,0,1,0,116,0,100,13,131,1,130,1,124,16,124,15,
-    100,14,131,2,83,0,119,0,119,0,119,0,41,15,78,114,
-    0,0,0,0,122,18,110,101,103,97,116,105,118,101,32,100,
-    97,116,97,32,115,105,122,101,114,98,0,0,0,114,12,0,
-    0,0,114,110,0,0,0,114,104,0,0,0,114,99,0,0,
-    0,115,4,0,0,0,80,75,3,4,122,23,98,97,100,32,
-    108,111,99,97,108,32,102,105,108,101,32,104,101,97,100,101,
-    114,58,32,233,26,0,0,0,114,109,0,0,0,122,26,122,
-    105,112,105,109,112,111,114,116,58,32,99,97,110,39,116,32,
-    114,101,97,100,32,100,97,116,97,114,145,0,0,0,105,241,
-    255,255,255,41,11,114,3,0,0,0,114,116,0,0,0,114,
-    117,0,0,0,114,118,0,0,0,114,22,0,0,0,114,120,
-    0,0,0,114,58,0,0,0,114,125,0,0,0,114,1,0,
-    0,0,114,150,0,0,0,114,149,0,0,0,41,17,114,29,
-    0,0,0,114,61,0,0,0,90,8,100,97,116,97,112,97,
-    116,104,114,136,0,0,0,114,140,0,0,0,114,131,0,0,
-    0,114,143,0,0,0,114,137,0,0,0,114,138,0,0,0,
-    114,139,0,0,0,114,129,0,0,0,114,130,0,0,0,114,
-    141,0,0,0,114,142,0,0,0,114,133,0,0,0,90,8,
-    114,97,119,95,100,97,116,97,114,147,0,0,0,114,9,0,
-    0,0,114,9,0,0,0,114,10,0,0,0,114,59,0,0,
-    0,69,2,0,0,115,74,0,0,0,20,1,8,1,8,1,
-    12,2,2,2,14,1,12,1,18,1,10,1,12,1,8,1,
-    16,2,18,2,16,2,16,1,12,1,8,1,2,1,14,1,
-    12,1,18,1,10,1,12,1,8,1,14,255,16,128,8,3,
-    4,2,2,3,10,1,12,1,8,1,10,1,2,254,2,243,
-    2,240,255,128,114,59,0,0,0,99,2,0,0,0,0,0,
-    0,0,0,0,0,0,2,0,0,0,3,0,0,0,67,0,
-    0,0,115,16,0,0,0,116,0,124,0,124,1,24,0,131,
-    1,100,1,107,1,83,0,41,2,78,114,5,0,0,0,41,
-    1,218,3,97,98,115,41,2,90,2,116,49,90,2,116,50,
-    114,9,0,0,0,114,9,0,0,0,114,10,0,0,0,218,
-    9,95,101,113,95,109,116,105,109,101,115,2,0,0,115,4,
-    0,0,0,16,2,255,128,114,153,0,0,0,99,5,0,0,
-    0,0,0,0,0,0,0,0,0,14,0,0,0,6,0,0,
-    0,67,0,0,0,115,254,0,0,0,124,3,124,2,100,1,
-    156,2,125,5,116,0,160,1,124,4,124,3,124,5,161,3,
-    125,6,124,6,100,2,64,0,100,3,107,3,125,7,124,7,
-    114,63,124,6,100,4,64,0,100,3,107,3,125,8,116,2,
-    106,3,100,5,107,3,114,62,124,8,115,38,116,2,106,3,
-    100,6,107,2,114,62,116,4,124,0,124,2,131,2,125,9,
-    124,9,100,0,117,1,114,62,116,2,160,5,116,0,106,6,
-    124,9,161,2,125,10,116,0,160,7,124,4,124,10,124,3,
-    124,5,161,4,1,0,110,40,116,8,124,0,124,2,131,2,
-    92,2,125,11,125,12,124,11,114,103,116,9,116,10,124,4,
-    100,7,100,8,133,2,25,0,131,1,124,11,131,2,114,93,
-    116,10,124,4,100,8,100,9,133,2,25,0,131,1,124,12,
-    107,3,114,103,116,11,160,12,100,10,124,3,155,2,157,2,
-    161,1,1,0,100,0,83,0,116,13,160,14,124,4,100,9,
-    100,0,133,2,25,0,161,1,125,13,116,15,124,13,116,16,
-    131,2,115,125,116,17,100,11,124,1,155,2,100,12,157,3,
-    131,1,130,1,124,13,83,0,41,13,78,41,2,114,47,0,
-    0,0,114,13,0,0,0,114,5,0,0,0,114,0,0,0,
-    0,114,93,0,0,0,90,5,110,101,118,101,114,90,6,97,
-    108,119,97,121,115,114,105,0,0,0,114,100,0,0,0,114,
-    101,0,0,0,122,22,98,121,116,101,99,111,100,101,32,105,
-    115,32,115,116,97,108,101,32,102,111,114,32,122,16,99,111,
-    109,112,105,108,101,100,32,109,111,100,117,108,101,32,122,21,
-    32,105,115,32,110,111,116,32,97,32,99,111,100,101,32,111,
-    98,106,101,99,116,41,18,114,21,0,0,0,90,13,95,99,
-    108,97,115,115,105,102,121,95,112,121,99,218,4,95,105,109,
-    112,90,21,99,104,101,99,107,95,104,97,115,104,95,98,97,
-    115,101,100,95,112,121,99,115,218,15,95,103,101,116,95,112,
-    121,99,95,115,111,117,114,99,101,218,11,115,111,117,114,99,
-    101,95,104,97,115,104,90,17,95,82,65,87,95,77,65,71,
-    73,67,95,78,85,77,66,69,82,90,18,95,118,97,108,105,
-    100,97,116,101,95,104,97,115,104,95,112,121,99,218,29,95,
-    103,101,116,95,109,116,105,109,101,95,97,110,100,95,115,105,
-    122,101,95,111,102,95,115,111,117,114,99,101,114,153,0,0,
-    0,114,2,0,0,0,114,48,0,0,0,114,81,0,0,0,
-    218,7,109,97,114,115,104,97,108,90,5,108,111,97,100,115,
-    114,15,0,0,0,218,10,95,99,111,100,101,95,116,121,112,
-    101,218,9,84,121,112,101,69,114,114,111,114,41,14,114,32,
-    0,0,0,114,60,0,0,0,114,69,0,0,0,114,41,0,
-    0,0,114,132,0,0,0,90,11,101,120,99,95,100,101,116,
-    97,105,108,115,114,135,0,0,0,90,10,104,97,115,104,95,
-    98,97,115,101,100,90,12,99,104,101,99,107,95,115,111,117,
-    114,99,101,90,12,115,111,117,114,99,101,95,98,121,116,101,
-    115,114,156,0,0,0,90,12,115,111,117,114,99,101,95,109,
-    116,105,109,101,90,11,115,111,117,114,99,101,95,115,105,122,
-    101,114,53,0,0,0,114,9,0,0,0,114,9,0,0,0,
-    114,10,0,0,0,218,15,95,117,110,109,97,114,115,104,97,
-    108,95,99,111,100,101,123,2,0,0,115,74,0,0,0,2,
-    2,2,1,6,254,14,5,12,2,4,1,12,1,10,1,2,
-    1,2,255,8,1,2,255,10,2,8,1,4,1,4,1,2,
-    1,4,254,4,5,8,1,4,255,2,128,8,4,6,255,4,
-    3,22,3,18,1,2,255,4,2,8,1,4,255,4,2,18,
-    2,10,1,16,1,4,1,255,128,114,161,0,0,0,99,1,
-    0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,4,
-    0,0,0,67,0,0,0,115,28,0,0,0,124,0,160,0,
+    130,1,124,10,160,5,124,4,161,1,125,15,116,6,124,15,
+    131,1,124,4,107,3,114,143,116,4,100,12,131,1,130,1,
+    87,0,100,0,4,0,4,0,131,3,1,0,110,8,49,0,
+    115,153,119,1,1,0,1,0,1,0,89,0,1,0,124,3,
+    100,1,107,2,114,164,124,15,83,0,122,5,116,9,131,0,
+    125,16,87,0,110,10,4,0,116,10,121,185,1,0,1,0,
+    1,0,116,0,100,13,131,1,130,1,124,16,124,15,100,14,
+    131,2,83,0,119,0,119,0,119,0,41,15,78,82,0,113,
+    202,1,113,145,1,82,4,82,22,113,151,1,82,12,115,4,
+    0,0,0,80,75,3,4,113,203,1,246,52,82,21,113,204,
+    1,113,195,1,118,29,41,11,113,3,113,157,1,113,158,1,
+    113,159,1,113,22,113,162,1,113,80,113,167,1,113,1,113,
+    201,1,113,200,1,41,17,113,31,113,84,113,205,1,113,183,
+    1,113,187,1,113,174,1,113,191,1,113,184,1,113,185,1,
+    113,186,1,113,171,1,113,173,1,113,188,1,113,189,1,113,
+    178,1,113,206,1,113,196,1,82,2,82,2,113,8,113,81,
+    138,9,115,74,0,0,0,20,1,8,1,8,1,12,2,2,
+    2,14,1,12,1,18,1,10,1,12,1,8,1,16,2,18,
+    2,16,2,16,1,12,1,8,1,2,1,14,1,12,1,18,
+    1,10,1,12,1,8,1,14,255,16,128,8,3,4,2,2,
+    3,10,1,12,1,8,1,10,1,2,254,2,243,2,240,255,
+    128,113,81,67,4,0,0,4,6,134,1,115,16,0,0,0,
+    116,0,124,0,124,1,24,0,131,1,100,1,107,1,83,0,
+    41,2,78,82,1,41,1,113,207,1,41,2,113,208,1,113,
+    209,1,82,2,82,2,113,8,113,210,1,230,9,115,4,0,
+    0,0,16,2,255,128,113,210,1,67,10,0,0,28,12,134,
+    1,115,254,0,0,0,124,3,124,2,100,1,156,2,125,5,
+    116,0,160,1,124,4,124,3,124,5,161,3,125,6,124,6,
+    100,2,64,0,100,3,107,3,125,7,124,7,114,63,124,6,
+    100,4,64,0,100,3,107,3,125,8,116,2,106,3,100,5,
+    107,3,114,62,124,8,115,38,116,2,106,3,100,6,107,2,
+    114,62,116,4,124,0,124,2,131,2,125,9,124,9,100,0,
+    117,1,114,62,116,2,160,5,116,0,106,6,124,9,161,2,
+    125,10,116,0,160,7,124,4,124,10,124,3,124,5,161,4,
+    1,0,110,40,116,8,124,0,124,2,131,2,92,2,125,11,
+    125,12,124,11,114,103,116,9,116,10,124,4,100,7,100,8,
+    133,2,25,0,131,1,124,11,131,2,114,93,116,10,124,4,
+    100,8,100,9,133,2,25,0,131,1,124,12,107,3,114,103,
+    116,11,160,12,100,10,124,3,155,2,157,2,161,1,1,0,
+    100,0,83,0,116,13,160,14,124,4,100,9,100,0,133,2,
+    25,0,161,1,125,13,116,15,124,13,116,16,131,2,115,125,
+    116,17,100,11,124,1,155,2,100,12,157,3,131,1,130,1,
+    124,13,83,0,41,13,78,41,2,113,60,113,11,82,1,82,
+    0,82,11,113,211,1,113,212,1,82,17,82,13,82,14,113,
+    213,1,113,214,1,113,215,1,41,18,113,20,113,216,1,113,
+    217,1,113,218,1,113,219,1,113,220,1,113,221,1,113,222,
+    1,113,223,1,113,210,1,113,2,113,62,113,117,113,224,1,
+    113,225,1,113,13,113,226,1,113,227,1,41,14,113,34,113,
+    82,113,95,113,49,113,176,1,113,228,1,113,182,1,113,229,
+    1,113,230,1,113,231,1,113,220,1,113,232,1,113,233,1,
+    113,73,82,2,82,2,113,8,113,234,1,246,9,115,74,0,
+    0,0,2,2,2,1,6,254,14,5,12,2,4,1,12,1,
+    10,1,2,1,2,255,8,1,2,255,10,2,8,1,4,1,
+    4,1,2,1,4,254,4,5,8,1,4,255,2,128,8,4,
+    6,255,4,3,22,3,18,1,2,255,4,2,8,1,4,255,
+    4,2,18,2,10,1,16,1,4,1,255,128,113,234,1,67,
+    2,0,0,2,8,134,1,115,28,0,0,0,124,0,160,0,
     100,1,100,2,161,2,125,0,124,0,160,0,100,3,100,2,
     161,2,125,0,124,0,83,0,41,4,78,115,2,0,0,0,
     13,10,243,1,0,0,0,10,243,1,0,0,0,13,41,1,
-    114,19,0,0,0,41,1,218,6,115,111,117,114,99,101,114,
-    9,0,0,0,114,9,0,0,0,114,10,0,0,0,218,23,
-    95,110,111,114,109,97,108,105,122,101,95,108,105,110,101,95,
-    101,110,100,105,110,103,115,168,2,0,0,115,8,0,0,0,
-    12,1,12,1,4,1,255,128,114,165,0,0,0,99,2,0,
-    0,0,0,0,0,0,0,0,0,0,2,0,0,0,6,0,
-    0,0,67,0,0,0,115,24,0,0,0,116,0,124,1,131,
-    1,125,1,116,1,124,1,124,0,100,1,100,2,100,3,141,
-    4,83,0,41,4,78,114,79,0,0,0,84,41,1,90,12,
-    100,111,110,116,95,105,110,104,101,114,105,116,41,2,114,165,
-    0,0,0,218,7,99,111,109,112,105,108,101,41,2,114,60,
-    0,0,0,114,164,0,0,0,114,9,0,0,0,114,9,0,
-    0,0,114,10,0,0,0,218,15,95,99,111,109,112,105,108,
-    101,95,115,111,117,114,99,101,175,2,0,0,115,6,0,0,
-    0,8,1,16,1,255,128,114,167,0,0,0,99,2,0,0,
-    0,0,0,0,0,0,0,0,0,2,0,0,0,11,0,0,
-    0,67,0,0,0,115,68,0,0,0,116,0,160,1,124,0,
-    100,1,63,0,100,2,23,0,124,0,100,3,63,0,100,4,
-    64,0,124,0,100,5,64,0,124,1,100,6,63,0,124,1,
-    100,3,63,0,100,7,64,0,124,1,100,5,64,0,100,8,
-    20,0,100,9,100,9,100,9,102,9,161,1,83,0,41,10,
-    78,233,9,0,0,0,105,188,7,0,0,233,5,0,0,0,
-    233,15,0,0,0,233,31,0,0,0,233,11,0,0,0,233,
-    63,0,0,0,114,93,0,0,0,114,14,0,0,0,41,2,
-    114,137,0,0,0,90,6,109,107,116,105,109,101,41,2,218,
-    1,100,114,144,0,0,0,114,9,0,0,0,114,9,0,0,
-    0,114,10,0,0,0,218,14,95,112,97,114,115,101,95,100,
-    111,115,116,105,109,101,181,2,0,0,115,20,0,0,0,4,
-    1,10,1,10,1,6,1,6,1,10,1,10,1,6,1,6,
-    249,255,128,114,175,0,0,0,99,2,0,0,0,0,0,0,
-    0,0,0,0,0,6,0,0,0,10,0,0,0,67,0,0,
-    0,115,110,0,0,0,122,41,124,1,100,1,100,0,133,2,
-    25,0,100,2,118,0,115,11,74,0,130,1,124,1,100,0,
-    100,1,133,2,25,0,125,1,124,0,106,0,124,1,25,0,
-    125,2,124,2,100,3,25,0,125,3,124,2,100,4,25,0,
-    125,4,124,2,100,5,25,0,125,5,116,1,124,4,124,3,
-    131,2,124,5,102,2,87,0,83,0,4,0,116,2,116,3,
-    116,4,102,3,121,54,1,0,1,0,1,0,89,0,100,6,
-    83,0,119,0,41,7,78,114,14,0,0,0,169,2,218,1,
-    99,218,1,111,114,169,0,0,0,233,6,0,0,0,233,3,
-    0,0,0,41,2,114,0,0,0,0,114,0,0,0,0,41,
-    5,114,28,0,0,0,114,175,0,0,0,114,26,0,0,0,
-    218,10,73,110,100,101,120,69,114,114,111,114,114,160,0,0,
-    0,41,6,114,32,0,0,0,114,13,0,0,0,114,61,0,
-    0,0,114,137,0,0,0,114,138,0,0,0,90,17,117,110,
-    99,111,109,112,114,101,115,115,101,100,95,115,105,122,101,114,
-    9,0,0,0,114,9,0,0,0,114,10,0,0,0,114,157,
-    0,0,0,194,2,0,0,115,24,0,0,0,2,1,20,2,
+    113,18,41,1,113,235,1,82,2,82,2,113,8,113,236,1,
+    208,10,115,8,0,0,0,12,1,12,1,4,1,255,128,113,
+    236,1,67,4,0,0,4,12,134,1,115,24,0,0,0,116,
+    0,124,1,131,1,125,1,116,1,124,1,124,0,100,1,100,
+    2,100,3,141,4,83,0,41,4,78,113,115,84,41,1,113,
+    237,1,41,2,113,236,1,113,238,1,41,2,113,82,113,235,
+    1,82,2,82,2,113,8,113,239,1,222,10,115,6,0,0,
+    0,8,1,16,1,255,128,113,239,1,67,4,0,0,4,22,
+    134,1,115,68,0,0,0,116,0,160,1,124,0,100,1,63,
+    0,100,2,23,0,124,0,100,3,63,0,100,4,64,0,124,
+    0,100,5,64,0,124,1,100,6,63,0,124,1,100,3,63,
+    0,100,7,64,0,124,1,100,5,64,0,100,8,20,0,100,
+    9,100,9,100,9,102,9,161,1,83,0,41,10,78,246,18,
+    118,248,30,246,10,246,30,246,62,246,22,246,126,82,11,82,
+    5,41,2,113,184,1,113,240,1,41,2,113,241,1,113,192,
+    1,82,2,82,2,113,8,113,242,1,234,10,115,20,0,0,
+    0,4,1,10,1,10,1,6,1,6,1,10,1,10,1,6,
+    1,6,249,255,128,113,242,1,67,4,0,0,12,20,134,1,
+    115,110,0,0,0,122,41,124,1,100,1,100,0,133,2,25,
+    0,100,2,118,0,115,11,74,0,130,1,124,1,100,0,100,
+    1,133,2,25,0,125,1,124,0,106,0,124,1,25,0,125,
+    2,124,2,100,3,25,0,125,3,124,2,100,4,25,0,125,
+    4,124,2,100,5,25,0,125,5,116,1,124,4,124,3,131,
+    2,124,5,102,2,87,0,83,0,4,0,116,2,116,3,116,
+    4,102,3,121,54,1,0,1,0,1,0,89,0,100,6,83,
+    0,119,0,41,7,78,82,5,169,2,113,243,1,113,244,1,
+    82,31,246,12,246,6,41,2,82,0,82,0,41,5,113,30,
+    113,242,1,113,28,113,245,1,113,227,1,41,6,113,34,113,
+    11,113,84,113,184,1,113,185,1,113,246,1,82,2,82,2,
+    113,8,113,223,1,132,11,115,24,0,0,0,2,1,20,2,
     12,1,10,1,8,3,8,1,8,1,16,1,18,1,6,1,
-    2,255,255,128,114,157,0,0,0,99,2,0,0,0,0,0,
-    0,0,0,0,0,0,3,0,0,0,8,0,0,0,67,0,
-    0,0,115,80,0,0,0,124,1,100,1,100,0,133,2,25,
-    0,100,2,118,0,115,10,74,0,130,1,124,1,100,0,100,
-    1,133,2,25,0,125,1,122,7,124,0,106,0,124,1,25,
-    0,125,2,87,0,110,9,4,0,116,1,121,39,1,0,1,
-    0,1,0,89,0,100,0,83,0,116,2,124,0,106,3,124,
-    2,131,2,83,0,119,0,41,3,78,114,14,0,0,0,114,
-    176,0,0,0,41,4,114,28,0,0,0,114,26,0,0,0,
-    114,59,0,0,0,114,29,0,0,0,41,3,114,32,0,0,
-    0,114,13,0,0,0,114,61,0,0,0,114,9,0,0,0,
-    114,9,0,0,0,114,10,0,0,0,114,155,0,0,0,213,
-    2,0,0,115,18,0,0,0,20,2,12,1,2,2,14,1,
-    12,1,6,1,12,2,2,253,255,128,114,155,0,0,0,99,
-    2,0,0,0,0,0,0,0,0,0,0,0,14,0,0,0,
-    11,0,0,0,67,0,0,0,115,14,1,0,0,116,0,124,
-    0,124,1,131,2,125,2,100,0,125,3,116,1,68,0,93,
-    100,92,3,125,4,125,5,125,6,124,2,124,4,23,0,125,
-    7,116,2,106,3,100,1,124,0,106,4,116,5,124,7,100,
-    2,100,3,141,5,1,0,122,7,124,0,106,6,124,7,25,
-    0,125,8,87,0,110,8,4,0,116,7,121,134,1,0,1,
-    0,1,0,89,0,113,9,124,8,100,4,25,0,125,9,116,
-    8,124,0,106,4,124,8,131,2,125,10,100,0,125,11,124,
-    5,114,89,122,10,116,9,124,0,124,9,124,7,124,1,124,
-    10,131,5,125,11,87,0,110,24,4,0,116,10,121,133,1,
-    0,125,12,1,0,122,8,124,12,125,3,87,0,89,0,100,
-    0,125,12,126,12,110,9,100,0,125,12,126,12,119,1,116,
-    11,124,9,124,10,131,2,125,11,124,11,100,0,117,0,114,
-    99,113,9,124,8,100,4,25,0,125,9,124,11,124,6,124,
-    9,102,3,2,0,1,0,83,0,124,3,114,124,100,5,124,
-    3,155,0,157,2,125,13,116,12,124,13,124,1,100,6,141,
-    2,124,3,130,2,116,12,100,7,124,1,155,2,157,2,124,
-    1,100,6,141,2,130,1,119,0,119,0,41,8,78,122,13,
-    116,114,121,105,110,103,32,123,125,123,125,123,125,114,93,0,
-    0,0,41,1,90,9,118,101,114,98,111,115,105,116,121,114,
-    0,0,0,0,122,20,109,111,100,117,108,101,32,108,111,97,
-    100,32,102,97,105,108,101,100,58,32,114,65,0,0,0,114,
-    64,0,0,0,41,13,114,39,0,0,0,114,95,0,0,0,
-    114,48,0,0,0,114,81,0,0,0,114,29,0,0,0,114,
-    20,0,0,0,114,28,0,0,0,114,26,0,0,0,114,59,
-    0,0,0,114,161,0,0,0,114,80,0,0,0,114,167,0,
-    0,0,114,3,0,0,0,41,14,114,32,0,0,0,114,41,
-    0,0,0,114,13,0,0,0,90,12,105,109,112,111,114,116,
-    95,101,114,114,111,114,114,96,0,0,0,114,97,0,0,0,
-    114,54,0,0,0,114,69,0,0,0,114,61,0,0,0,114,
-    43,0,0,0,114,132,0,0,0,114,53,0,0,0,90,3,
-    101,120,99,114,82,0,0,0,114,9,0,0,0,114,9,0,
-    0,0,114,10,0,0,0,114,51,0,0,0,228,2,0,0,
-    115,60,0,0,0,10,1,4,1,14,1,8,1,22,1,2,
-    1,14,1,12,1,4,1,8,2,12,1,4,1,4,1,2,
-    1,20,1,14,1,16,1,8,128,10,2,8,1,2,3,8,
-    1,14,1,4,2,10,1,14,1,18,2,2,241,2,247,255,
-    128,114,51,0,0,0,41,46,114,91,0,0,0,90,26,95,
-    102,114,111,122,101,110,95,105,109,112,111,114,116,108,105,98,
-    95,101,120,116,101,114,110,97,108,114,21,0,0,0,114,1,
-    0,0,0,114,2,0,0,0,90,17,95,102,114,111,122,101,
-    110,95,105,109,112,111,114,116,108,105,98,114,48,0,0,0,
-    114,154,0,0,0,114,116,0,0,0,114,158,0,0,0,114,
-    72,0,0,0,114,137,0,0,0,114,35,0,0,0,90,7,
-    95,95,97,108,108,95,95,114,20,0,0,0,90,15,112,97,
-    116,104,95,115,101,112,97,114,97,116,111,114,115,114,18,0,
-    0,0,114,80,0,0,0,114,3,0,0,0,114,25,0,0,
-    0,218,4,116,121,112,101,114,75,0,0,0,114,119,0,0,
-    0,114,121,0,0,0,114,123,0,0,0,90,13,95,76,111,
-    97,100,101,114,66,97,115,105,99,115,114,4,0,0,0,114,
-    95,0,0,0,114,39,0,0,0,114,40,0,0,0,114,38,
-    0,0,0,114,27,0,0,0,114,128,0,0,0,114,148,0,
-    0,0,114,150,0,0,0,114,59,0,0,0,114,153,0,0,
-    0,114,161,0,0,0,218,8,95,95,99,111,100,101,95,95,
-    114,159,0,0,0,114,165,0,0,0,114,167,0,0,0,114,
-    175,0,0,0,114,157,0,0,0,114,155,0,0,0,114,51,
-    0,0,0,114,9,0,0,0,114,9,0,0,0,114,9,0,
-    0,0,114,10,0,0,0,218,8,60,109,111,100,117,108,101,
-    62,1,0,0,0,115,92,0,0,0,4,0,8,16,16,1,
-    8,1,8,1,8,1,8,1,8,1,8,1,8,1,8,2,
-    6,3,14,1,16,3,4,4,8,2,4,2,4,1,4,1,
-    18,2,0,127,0,127,12,50,12,1,2,1,2,1,4,252,
-    8,9,8,4,8,9,8,31,2,126,2,254,4,29,8,5,
-    8,21,8,46,8,8,10,40,8,5,8,7,8,6,8,13,
-    8,19,12,15,255,128,
+    2,255,255,128,113,223,1,67,4,0,0,6,16,134,1,115,
+    80,0,0,0,124,1,100,1,100,0,133,2,25,0,100,2,
+    118,0,115,10,74,0,130,1,124,1,100,0,100,1,133,2,
+    25,0,125,1,122,7,124,0,106,0,124,1,25,0,125,2,
+    87,0,110,9,4,0,116,1,121,39,1,0,1,0,1,0,
+    89,0,100,0,83,0,116,2,124,0,106,3,124,2,131,2,
+    83,0,119,0,41,3,78,82,5,82,36,41,4,113,30,113,
+    28,113,81,113,31,41,3,113,34,113,11,113,84,82,2,82,
+    2,113,8,113,219,1,170,11,115,18,0,0,0,20,2,12,
+    1,2,2,14,1,12,1,6,1,12,2,2,253,255,128,113,
+    219,1,67,4,0,0,28,22,134,1,115,14,1,0,0,116,
+    0,124,0,124,1,131,2,125,2,100,0,125,3,116,1,68,
+    0,93,100,92,3,125,4,125,5,125,6,124,2,124,4,23,
+    0,125,7,116,2,106,3,100,1,124,0,106,4,116,5,124,
+    7,100,2,100,3,141,5,1,0,122,7,124,0,106,6,124,
+    7,25,0,125,8,87,0,110,8,4,0,116,7,121,134,1,
+    0,1,0,1,0,89,0,113,9,124,8,100,4,25,0,125,
+    9,116,8,124,0,106,4,124,8,131,2,125,10,100,0,125,
+    11,124,5,114,89,122,10,116,9,124,0,124,9,124,7,124,
+    1,124,10,131,5,125,11,87,0,110,24,4,0,116,10,121,
+    133,1,0,125,12,1,0,122,8,124,12,125,3,87,0,89,
+    0,100,0,125,12,126,12,110,9,100,0,125,12,126,12,119,
+    1,116,11,124,9,124,10,131,2,125,11,124,11,100,0,117,
+    0,114,99,113,9,124,8,100,4,25,0,125,9,124,11,124,
+    6,124,9,102,3,2,0,1,0,83,0,124,3,114,124,100,
+    5,124,3,155,0,157,2,125,13,116,12,124,13,124,1,100,
+    6,141,2,124,3,130,2,116,12,100,7,124,1,155,2,157,
+    2,124,1,100,6,141,2,130,1,119,0,119,0,41,8,78,
+    113,247,1,82,11,41,1,113,248,1,82,0,113,249,1,82,
+    8,113,91,41,13,113,47,113,141,1,113,62,113,117,113,31,
+    113,19,113,30,113,28,113,81,113,234,1,113,116,113,239,1,
+    113,3,41,14,113,34,113,49,113,11,113,250,1,113,142,1,
+    113,143,1,113,74,113,95,113,84,113,51,113,176,1,113,73,
+    113,251,1,113,118,82,2,82,2,113,8,113,72,200,11,115,
+    60,0,0,0,10,1,4,1,14,1,8,1,22,1,2,1,
+    14,1,12,1,4,1,8,2,12,1,4,1,4,1,2,1,
+    20,1,14,1,16,1,8,128,10,2,8,1,2,3,8,1,
+    14,1,4,2,10,1,14,1,18,2,2,241,2,247,255,128,
+    113,72,41,46,113,135,1,113,252,1,113,20,113,1,113,2,
+    113,253,1,113,62,113,217,1,113,157,1,113,224,1,113,106,
+    113,184,1,113,43,113,254,1,113,19,113,255,1,113,17,113,
+    116,113,3,113,27,113,128,2,113,109,113,160,1,113,163,1,
+    113,165,1,113,129,2,113,4,113,141,1,113,47,113,48,113,
+    46,113,29,113,170,1,113,198,1,113,201,1,113,81,113,210,
+    1,113,234,1,113,130,2,113,226,1,113,236,1,113,239,1,
+    113,242,1,113,223,1,113,219,1,113,72,82,2,82,2,82,
+    2,113,8,113,131,2,2,115,92,0,0,0,4,0,8,16,
+    16,1,8,1,8,1,8,1,8,1,8,1,8,1,8,1,
+    8,2,6,3,14,1,16,3,4,4,8,2,4,2,4,1,
+    4,1,18,2,0,127,0,127,12,50,12,1,2,1,2,1,
+    4,252,8,9,8,4,8,9,8,31,2,126,2,254,4,29,
+    8,5,8,21,8,46,8,8,10,40,8,5,8,7,8,6,
+    8,13,8,19,12,15,255,128,
 };
@@ -4,7 +4,8 @@
    even though dicts, lists, sets and frozensets, not commonly seen in
    code objects, are supported.
    Version 3 of this protocol properly supports circular links
-   and sharing. */
+   and sharing.  Version 5 stores every string once in a table at the
+   front of the data and uses variable-length integers for small values. */
 
 #define PY_SSIZE_T_CLEAN
 
@@ -72,6 +73,17 @@ module marshal
 #define TYPE_SHORT_ASCII        'z'
 #define TYPE_SHORT_ASCII_INTERNED 'Z'
 
+/* Version 5 */
+#define TYPE_STRING_TABLE       'X'
+#define TYPE_STRING_REF         'q'
+#define TYPE_VARINT             'v'
+#define TYPE_VARREF             'R'
+#define TYPE_COMPACT_CODE       'C'
+
+/* Flags of a TYPE_STRING_TABLE entry */
+#define STRING_TABLE_INTERNED   0x01
+#define STRING_TABLE_ASCII      0x02
+
 #define WFERR_OK 0
 #define WFERR_UNMARSHALLABLE 1
 #define WFERR_NESTEDTOODEEP 2
@@ -86,6 +98,8 @@ typedef struct {
     const char *end;
     char *buf;
     _Py_hashtable_t *hashtable;
+    PyObject *strings;  /* str -> index in strlist, version 5 only */
+    PyObject *strlist;
     int version;
 } WFILE;
 
@@ -193,6 +207,27 @@ w_long(long x, WFILE *p)
 # define W_SIZE  w_long
 #endif
 
+/* Unsigned LEB128: 7 bits per byte, least significant group first. */
+static void
+w_varint(unsigned long long x, WFILE *p)
+{
+    while (x >= 0x80) {
+        w_byte((char)((x & 0x7f) | 0x80), p);
+        x >>= 7;
+    }
+    w_byte((char)x, p);
+}
+
+/* Zigzag encoding maps small negative numbers to small varints too. */
+static void
+w_svarint(long long x, WFILE *p)
+{
+    if (x < 0)
+        w_varint(~((unsigned long long)x << 1), p);
+    else
+        w_varint((unsigned long long)x << 1, p);
+}
+
 static void
 w_pstring(const void *s, Py_ssize_t n, WFILE *p)
 {
@@ -308,8 +343,14 @@ w_ref(PyObject *v, char *flag, WFILE *p)
         w = (int)(uintptr_t)entry->value;
         /* we don't store "long" indices in the dict */
         assert(0 <= w && w <= 0x7fffffff);
-        w_byte(TYPE_REF, p);
-        w_long(w, p);
+        if (p->version >= 5) {
+            w_byte(TYPE_VARREF, p);
+            w_varint(w, p);
+        }
+        else {
+            w_byte(TYPE_REF, p);
+            w_long(w, p);
+        }
         return 1;
     } else {
         size_t s = p->hashtable->nentries;
@@ -332,6 +373,52 @@ w_ref(PyObject *v, char *flag, WFILE *p)
     return 1;
 }
 
+/* Version 5 writes each distinct string once, in the table which
+   w_prepend_string_table() puts in front of the data, and refers to it
+   by index.  Equal strings share an entry; it is interned if any of
+   them is. */
+static void
+w_string_ref(PyObject *v, WFILE *p)
+{
+    PyObject *index;
+    Py_ssize_t i;
+
+    index = PyDict_GetItemWithError(p->strings, v);
+    if (index != NULL) {
+        i = PyLong_AsSsize_t(index);
+        if (PyUnicode_CHECK_INTERNED(v) &&
+            !PyUnicode_CHECK_INTERNED(PyList_GET_ITEM(p->strlist, i)))
+        {
+            Py_INCREF(v);
+            Py_SETREF(PyList_GET_ITEM(p->strlist, i), v);
+        }
+    }
+    else {
+        if (PyErr_Occurred())
+            goto err;
+        i = PyList_GET_SIZE(p->strlist);
+        if (i >= 0x7fffffff) {
+            PyErr_SetString(PyExc_ValueError, "too many strings");
+            goto err;
+        }
+        index = PyLong_FromSsize_t(i);
+        if (index == NULL)
+            goto err;
+        if (PyDict_SetItem(p->strings, v, index) < 0) {
+            Py_DECREF(index);
+            goto err;
+        }
+        Py_DECREF(index);
+        if (PyList_Append(p->strlist, v) < 0)
+            goto err;
+    }
+    w_byte(TYPE_STRING_REF, p);
+    w_varint(i, p);
+    return;
+err:
+    p->error = WFERR_UNMARSHALLABLE;
+}
+
 static void
 w_complex_object(PyObject *v, char flag, WFILE *p);
 
@@ -363,12 +450,21 @@ w_object(PyObject *v, WFILE *p)
     else if (v == Py_True) {
         w_byte(TYPE_TRUE, p);
     }
+    else if (p->version >= 5 && PyUnicode_CheckExact(v)) {
+        w_string_ref(v, p);
+    }
     else if (!w_ref(v, &flag, p))
         w_complex_object(v, flag, p);
 
     p->depth--;
 }
 
+static void
+w_code_varint(long x, WFILE *p)
+{
+    w_svarint(x, p);
+}
+
 static void
 w_complex_object(PyObject *v, char flag, WFILE *p)
 {
@@ -389,7 +485,11 @@ w_complex_object(PyObject *v, char flag, WFILE *p)
             }
             else
 #endif
-            {
+            if (p->version >= 5) {
+                W_TYPE(TYPE_VARINT, p);
+                w_svarint(x, p);
+            }
+            else {
                 W_TYPE(TYPE_INT, p);
                 w_long(x, p);
             }
@@ -508,13 +608,20 @@ w_complex_object(PyObject *v, char flag, WFILE *p)
     }
     else if (PyCode_Check(v)) {
         PyCodeObject *co = (PyCodeObject *)v;
-        W_TYPE(TYPE_CODE, p);
-        w_long(co->co_argcount, p);
-        w_long(co->co_posonlyargcount, p);
-        w_long(co->co_kwonlyargcount, p);
-        w_long(co->co_nlocals, p);
-        w_long(co->co_stacksize, p);
-        w_long(co->co_flags, p);
+        void (*w_int)(long, WFILE *) = w_long;
+        if (p->version >= 5) {
+            W_TYPE(TYPE_COMPACT_CODE, p);
+            w_int = w_code_varint;
+        }
+        else {
+            W_TYPE(TYPE_CODE, p);
+        }
+        w_int(co->co_argcount, p);
+        w_int(co->co_posonlyargcount, p);
+        w_int(co->co_kwonlyargcount, p);
+        w_int(co->co_nlocals, p);
+        w_int(co->co_stacksize, p);
+        w_int(co->co_flags, p);
         w_object(co->co_code, p);
         w_object(co->co_consts, p);
         w_object(co->co_names, p);
@@ -523,7 +630,7 @@ w_complex_object(PyObject *v, char flag, WFILE *p)
         w_object(co->co_cellvars, p);
         w_object(co->co_filename, p);
         w_object(co->co_name, p);
-        w_long(co->co_firstlineno, p);
+        w_int(co->co_firstlineno, p);
         w_object(co->co_linetable, p);
     }
     else if (PyObject_CheckBuffer(v)) {
@@ -552,6 +659,17 @@ w_decref_entry(void *key)
     Py_XDECREF(entry_key);
 }
 
+static void
+w_clear_refs(WFILE *wf)
+{
+    if (wf->hashtable != NULL) {
+        _Py_hashtable_destroy(wf->hashtable);
+        wf->hashtable = NULL;
+    }
+    Py_CLEAR(wf->strings);
+    Py_CLEAR(wf->strlist);
+}
+
 static int
 w_init_refs(WFILE *wf, int version)
 {
@@ -564,15 +682,72 @@ w_init_refs(WFILE *wf, int version)
             return -1;
         }
     }
+    if (version >= 5) {
+        wf->strings = PyDict_New();
+        wf->strlist = PyList_New(0);
+        if (wf->strings == NULL || wf->strlist == NULL) {
+            w_clear_refs(wf);
+            return -1;
+        }
+    }
     return 0;
 }
 
+/* Replace the data written to wf->str by a TYPE_STRING_TABLE record
+   holding the strings collected by w_string_ref(), followed by the data. */
 static void
-w_clear_refs(WFILE *wf)
+w_prepend_string_table(WFILE *wf)
 {
-    if (wf->hashtable != NULL) {
-        _Py_hashtable_destroy(wf->hashtable);
+    WFILE tf;
+    Py_ssize_t i, n, size;
+
+    n = PyList_GET_SIZE(wf->strlist);
+    if (n == 0 || wf->str == NULL || wf->error != WFERR_OK)
+        return;
+    size = wf->ptr - wf->buf;
+
+    memset(&tf, 0, sizeof(tf));
+    tf.str = PyBytes_FromStringAndSize((char *)NULL, size + 8 * n + 16);
+    if (tf.str == NULL) {
+        wf->error = WFERR_NOMEMORY;
+        return;
+    }
+    tf.ptr = tf.buf = PyBytes_AS_STRING(tf.str);
+    tf.end = tf.ptr + PyBytes_GET_SIZE(tf.str);
+    tf.error = WFERR_OK;
+    tf.version = wf->version;
+
+    w_byte(TYPE_STRING_TABLE, &tf);
+    w_varint(n, &tf);
+    for (i = 0; i < n; i++) {
+        PyObject *v = PyList_GET_ITEM(wf->strlist, i);
+        int tag = PyUnicode_CHECK_INTERNED(v) ? STRING_TABLE_INTERNED : 0;
+        if (PyUnicode_IS_ASCII(v)) {
+            w_byte(tag | STRING_TABLE_ASCII, &tf);
+            w_varint(PyUnicode_GET_LENGTH(v), &tf);
+            w_string(PyUnicode_1BYTE_DATA(v), PyUnicode_GET_LENGTH(v), &tf);
+        }
+        else {
+            PyObject *utf8;
+            utf8 = PyUnicode_AsEncodedString(v, "utf8", "surrogatepass");
+            if (utf8 == NULL) {
+                tf.error = WFERR_UNMARSHALLABLE;
+                break;
+            }
+            w_byte(tag, &tf);
+            w_varint(PyBytes_GET_SIZE(utf8), &tf);
+            w_string(PyBytes_AS_STRING(utf8), PyBytes_GET_SIZE(utf8), &tf);
+            Py_DECREF(utf8);
+        }
     }
+    w_string(wf->buf, size, &tf);
+
+    Py_SETREF(wf->str, tf.str);
+    wf->buf = tf.buf;
+    wf->ptr = tf.ptr;
+    wf->end = tf.end;
+    if (tf.error != WFERR_OK)
+        wf->error = tf.error;
 }
 
 /* version currently has no effect for writing ints. */
@@ -596,6 +771,15 @@ PyMarshal_WriteObjectToFile(PyObject *x, FILE *fp, int version)
 {
     char buf[BUFSIZ];
     WFILE wf;
+    if (version >= 5) {
+        /* The string table is only complete once everything is written */
+        PyObject *s = PyMarshal_WriteObjectToString(x, version);
+        if (s != NULL) {
+            fwrite(PyBytes_AS_STRING(s), 1, PyBytes_GET_SIZE(s), fp);
+            Py_DECREF(s);
+        }
+        return;
+    }
     memset(&wf, 0, sizeof(wf));
     wf.fp = fp;
     wf.ptr = wf.buf = buf;
@@ -618,6 +802,7 @@ typedef struct {
     char *buf;
     Py_ssize_t buf_size;
     PyObject *refs;  /* a list */
+    PyObject *strings;  /* a tuple, the innermost TYPE_STRING_TABLE */
 } RFILE;
 
 static const char *
@@ -750,6 +935,37 @@ r_long(RFILE *p)
     return x;
 }
 
+static unsigned long long
+r_varint(RFILE *p)
+{
+    unsigned long long x = 0;
+    int shift, c;
+
+    for (shift = 0; shift < 64; shift += 7) {
+        c = r_byte(p);
+        if (c == EOF) {
+            if (!PyErr_Occurred())
+                PyErr_SetString(PyExc_EOFError,
+                                "EOF read where not expected");
+            return (unsigned long long)-1;
+        }
+        x |= (unsigned long long)(c & 0x7f) << shift;
+        if (!(c & 0x80))
+            return x;
+    }
+    PyErr_SetString(PyExc_ValueError, "bad marshal data (varint too long)");
+    return (unsigned long long)-1;
+}
+
+static long long
+r_svarint(RFILE *p)
+{
+    unsigned long long x = r_varint(p);
+    if (x & 1)
+        return -(long long)(x >> 1) - 1;
+    return (long long)(x >> 1);
+}
+
 /* r_long64 deals with the TYPE_INT64 code. */
 static PyObject *
 r_long64(RFILE *p)
@@ -870,6 +1086,85 @@ r_float_str(RFILE *p)
     return PyOS_string_to_double(buf, NULL, NULL);
 }
 
+/* Read the strings of a TYPE_STRING_TABLE record: for each of them a
+   byte of STRING_TABLE_* flags, the length and the encoded data.  Every
+   entry is created and, if needed, interned only once however many
+   times the data refers to it. */
+static PyObject *
+r_string_table(RFILE *p)
+{
+    PyObject *table, *v;
+    unsigned long long n, size;
+    Py_ssize_t i;
+    const char *ptr;
+    int tag;
+
+    n = r_varint(p);
+    if (PyErr_Occurred())
+        return NULL;
+    if (n > SIZE32_MAX) {
+        PyErr_SetString(PyExc_ValueError, "bad marshal data (string table size out of range)");
+        return NULL;
+    }
+    table = PyTuple_New((Py_ssize_t)n);
+    if (table == NULL)
+        return NULL;
+    for (i = 0; i < (Py_ssize_t)n; i++) {
+        tag = r_byte(p);
+        if (tag == EOF) {
+            if (!PyErr_Occurred())
+                PyErr_SetString(PyExc_EOFError,
+                                "EOF read where object expected");
+            goto error;
+        }
+        if (tag & ~(STRING_TABLE_INTERNED | STRING_TABLE_ASCII)) {
+            PyErr_SetString(PyExc_ValueError, "bad marshal data (unknown string table flags)");
+            goto error;
+        }
+        size = r_varint(p);
+        if (PyErr_Occurred())
+            goto error;
+        if (size > SIZE32_MAX) {
+            PyErr_SetString(PyExc_ValueError, "bad marshal data (string size out of range)");
+            goto error;
+        }
+        if (size == 0) {
+            v = PyUnicode_New(0, 0);
+        }
+        else {
+            ptr = r_string((Py_ssize_t)size, p);
+            if (ptr == NULL)
+                goto error;
+            if (tag & STRING_TABLE_ASCII)
+                v = PyUnicode_FromKindAndData(PyUnicode_1BYTE_KIND, ptr,
+                                              (Py_ssize_t)size);
+            else
+                v = PyUnicode_DecodeUTF8(ptr, (Py_ssize_t)size,
+                                         "surrogatepass");
+        }
+        if (v == NULL)
+            goto error;
+        if (tag & STRING_TABLE_INTERNED)
+            PyUnicode_InternInPlace(&v);
+        PyTuple_SET_ITEM(table, i, v);
+    }
+    return table;
+
+error:
+    Py_DECREF(table);
+    return NULL;
+}
+
+/* Read one of the int fields of a code object. */
+static int
+r_code_int(RFILE *p, int compact)
+{
+    /* XXX ignore long->int overflows for now */
+    if (compact)
+        return (int)r_svarint(p);
+    return (int)r_long(p);
+}
+
 /* allocate the reflist index for a new object. Return -1 on failure */
 static Py_ssize_t
 r_ref_reserve(int flag, RFILE *p)
@@ -994,6 +1289,14 @@ r_object(RFILE *p)
         R_REF(retval);
         break;
 
+    case TYPE_VARINT:
+        {
+            long long x = r_svarint(p);
+            retval = PyErr_Occurred() ? NULL : PyLong_FromLongLong(x);
+            R_REF(retval);
+            break;
+        }
+
     case TYPE_INT64:
         retval = r_long64(p);
         R_REF(retval);
@@ -1147,6 +1450,34 @@ r_object(RFILE *p)
         break;
         }
 
+    case TYPE_STRING_TABLE:
+        v = r_string_table(p);
+        if (v == NULL)
+            break;
+        v2 = p->strings;
+        p->strings = v;
+        retval = r_object(p);
+        p->strings = v2;
+        Py_DECREF(v);
+        break;
+
+    case TYPE_STRING_REF:
+        {
+            unsigned long long x = r_varint(p);
+            if (PyErr_Occurred())
+                break;
+            if (p->strings == NULL ||
+                x >= (unsigned long long)PyTuple_GET_SIZE(p->strings))
+            {
+                PyErr_SetString(PyExc_ValueError, "bad marshal data (invalid string reference)");
+                break;
+            }
+            retval = PyTuple_GET_ITEM(p->strings, (Py_ssize_t)x);
+            Py_INCREF(retval);
+            R_REF(retval);
+            break;
+        }
+
     case TYPE_SMALL_TUPLE:
         n = (unsigned char) r_byte(p);
         if (PyErr_Occurred())
@@ -1296,7 +1627,9 @@ r_object(RFILE *p)
         break;
 
     case TYPE_CODE:
+    case TYPE_COMPACT_CODE:
         {
+            int compact = (type == TYPE_COMPACT_CODE);
             int argcount;
             int posonlyargcount;
             int kwonlyargcount;
@@ -1320,24 +1653,23 @@ r_object(RFILE *p)
 
             v = NULL;
 
-            /* XXX ignore long->int overflows for now */
-            argcount = (int)r_long(p);
+            argcount = r_code_int(p, compact);
             if (PyErr_Occurred())
                 goto code_error;
-            posonlyargcount = (int)r_long(p);
+            posonlyargcount = r_code_int(p, compact);
             if (PyErr_Occurred()) {
                 goto code_error;
             }
-            kwonlyargcount = (int)r_long(p);
+            kwonlyargcount = r_code_int(p, compact);
             if (PyErr_Occurred())
                 goto code_error;
-            nlocals = (int)r_long(p);
+            nlocals = r_code_int(p, compact);
             if (PyErr_Occurred())
                 goto code_error;
-            stacksize = (int)r_long(p);
+            stacksize = r_code_int(p, compact);
             if (PyErr_Occurred())
                 goto code_error;
-            flags = (int)r_long(p);
+            flags = r_code_int(p, compact);
             if (PyErr_Occurred())
                 goto code_error;
             code = r_object(p);
@@ -1364,7 +1696,7 @@ r_object(RFILE *p)
             name = r_object(p);
             if (name == NULL)
                 goto code_error;
-            firstlineno = (int)r_long(p);
+            firstlineno = r_code_int(p, compact);
             if (firstlineno == -1 && PyErr_Occurred())
                 break;
             linetable = r_object(p);
@@ -1399,11 +1731,20 @@ r_object(RFILE *p)
         retval = v;
         break;
 
+    case TYPE_VARREF:
+        {
+            unsigned long long x = r_varint(p);
+            if (PyErr_Occurred())
+                break;
+            n = x > SIZE32_MAX ? -1 : (long)x;
+            goto _read_ref;
+        }
     case TYPE_REF:
         n = r_long(p);
+        if (n == -1 && PyErr_Occurred())
+            break;
+    _read_ref:
         if (n < 0 || n >= PyList_GET_SIZE(p->refs)) {
-            if (n == -1 && PyErr_Occurred())
-                break;
             PyErr_SetString(PyExc_ValueError, "bad marshal data (invalid reference)");
             break;
         }
@@ -1528,6 +1869,7 @@ PyMarshal_ReadObjectFromFile(FILE *fp)
     rf.depth = 0;
     rf.ptr = rf.end = NULL;
     rf.buf = NULL;
+    rf.strings = NULL;
     rf.refs = PyList_New(0);
     if (rf.refs == NULL)
         return NULL;
@@ -1549,6 +1891,7 @@ PyMarshal_ReadObjectFromString(const char *str, Py_ssize_t len)
     rf.end = str + len;
     rf.buf = NULL;
     rf.depth = 0;
+    rf.strings = NULL;
     rf.refs = PyList_New(0);
     if (rf.refs == NULL)
         return NULL;
@@ -1577,6 +1920,9 @@ PyMarshal_WriteObjectToString(PyObject *x, int version)
         return NULL;
     }
     w_object(x, &wf);
+    if (wf.strlist != NULL) {
+        w_prepend_string_table(&wf);
+    }
     w_clear_refs(&wf);
     if (wf.str != NULL) {
         const char *base = PyBytes_AS_STRING(wf.str);
@@ -1680,6 +2026,7 @@ marshal_load(PyObject *module, PyObject *file)
         rf.readable = file;
         rf.ptr = rf.end = NULL;
         rf.buf = NULL;
+        rf.strings = NULL;
         if ((rf.refs = PyList_New(0)) != NULL) {
             result = read_object(&rf);
             Py_DECREF(rf.refs);
@@ -1739,6 +2086,7 @@ marshal_loads_impl(PyObject *module, Py_buffer *bytes)
     rf.ptr = s;
     rf.end = s + n;
     rf.depth = 0;
+    rf.strings = NULL;
     if ((rf.refs = PyList_New(0)) == NULL)
         return NULL;
     result = read_object(&rf);
@@ -1776,6 +2124,8 @@ version -- indicates the format that the module uses. Version 0 is the\n\
     historical format, version 1 shares interned strings and version 2\n\
     uses a binary format for floating point numbers.\n\
     Version 3 shares common object references (New in version 3.4).\n\
+    Version 5 stores strings in a table and small integers in a variable\n\
+    length encoding (New in version 3.10).\n\
 \n\
 Functions:\n\
 \n\
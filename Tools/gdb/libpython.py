@@ -746,6 +746,8 @@ def _get_entries(self, keys):
             offset = 4 * dk_size
         else:
             offset = 8 * dk_size
+        # >= Python 3.10: dk_tags (one byte per slot) follow dk_indices
+        offset += dk_size
 
         ent_addr = keys['dk_indices'].address
         ent_addr = ent_addr.cast(_type_unsigned_char_ptr()) + offset
@@ -942,6 +942,12 @@ def detect_simple_extensions(self):
         # asyncio speedups
         self.add(Extension("_asyncio", ["_asynciomodule.c"],
                            extra_compile_args=['-DPy_BUILD_CORE_MODULE']))
+        # io_uring support for asyncio (Linux only)
+        if (HOST_PLATFORM.startswith('linux') and
+                find_file('linux/io_uring.h', self.inc_dirs, []) is not None):
+            self.add(Extension("_uring", ["_uringmodule.c"]))
+        else:
+            self.missing.append('_uring')
         # _abc speedups
         self.add(Extension("_abc", ["_abc.c"],
                            extra_compile_args=['-DPy_BUILD_CORE_MODULE']))
@@ -1682,6 +1688,7 @@ def detect_compress_exts(self):
                         zlib_extra_link_args = ()
                     self.add(Extension('zlib', ['zlibmodule.c'],
                                        libraries=['z'],
+                                       extra_compile_args=['-DPy_BUILD_CORE_MODULE'],
                                        extra_link_args=zlib_extra_link_args))
                     have_zlib = True
                 else:
@@ -1714,6 +1721,7 @@ def detect_compress_exts(self):
                 bz2_extra_link_args = ()
             self.add(Extension('_bz2', ['_bz2module.c'],
                                libraries=['bz2'],
+                               extra_compile_args=['-DPy_BUILD_CORE_MODULE'],
                                extra_link_args=bz2_extra_link_args))
         else:
             self.missing.append('_bz2')
@@ -1721,7 +1729,8 @@ def detect_compress_exts(self):
         # LZMA compression support.
         if self.compiler.find_library_file(self.lib_dirs, 'lzma'):
             self.add(Extension('_lzma', ['_lzmamodule.c'],
-                               libraries=['lzma']))
+                               libraries=['lzma'],
+                               extra_compile_args=['-DPy_BUILD_CORE_MODULE']))
         else:
             self.missing.append('_lzma')
 